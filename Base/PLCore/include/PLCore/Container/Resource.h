@@ -139,6 +139,58 @@ template <class AType> class Resource : public Loadable {
 		*/
 		int GetID() const;
 
+		/**
+		*  @brief
+		*    Marks the resource as used
+		*
+		*  @remarks
+		*    Timestamps the resource with the current resource budget frame of its manager. If the resource
+		*    was evicted by the resource budget, it's reloaded at once, so the caller always gets a loaded
+		*    resource. This function is called automatically when the resource is accessed through a resource
+		*    handler or "ResourceManager::LoadResource()".
+		*
+		*  @note
+		*    - Like the resource manager, this function must be called by the thread owning the manager
+		*
+		*  @see
+		*    - ResourceBudget
+		*/
+		void Touch();
+
+		/**
+		*  @brief
+		*    Returns the resource budget frame the resource was used the last time
+		*
+		*  @return
+		*    Resource budget frame the resource was used the last time
+		*
+		*  @see
+		*    - Touch()
+		*/
+		uint32 GetLastUsedFrame() const;
+
+		/**
+		*  @brief
+		*    Returns whether or not the resource is currently evicted
+		*
+		*  @return
+		*    'true' if the resource is evicted and will be reloaded on the next access, else 'false'
+		*/
+		bool IsEvicted() const;
+
+		/**
+		*  @brief
+		*    Evicts the resource
+		*
+		*  @return
+		*    'true' if all went fine, else 'false' (maybe the resource is protected or wasn't loaded from a file?)
+		*
+		*  @remarks
+		*    The resource is unloaded to free its memory, but stays within its manager and keeps its handlers.
+		*    The next "Touch()" reloads the resource from the file it was loaded from.
+		*/
+		bool Evict();
+
 		//[-------------------------------------------------------]
 		//[ Handler functions                                     ]
 		//[-------------------------------------------------------]
@@ -220,6 +272,30 @@ template <class AType> class Resource : public Loadable {
 		*/
 		virtual Resource<AType> &operator =(const Resource<AType> &cSource);
 
+		/**
+		*  @brief
+		*    Returns the number of bytes in main memory used by the resource
+		*
+		*  @return
+		*    Number of bytes in main memory used by the resource, 0 if unknown
+		*
+		*  @note
+		*    - Used by the resource budget, the default implementation returns 0
+		*/
+		virtual uint64 GetCPUMemoryUsage() const;
+
+		/**
+		*  @brief
+		*    Returns the number of bytes in video memory used by the resource
+		*
+		*  @return
+		*    Number of bytes in video memory used by the resource, 0 if unknown
+		*
+		*  @note
+		*    - Used by the resource budget, the default implementation returns 0
+		*/
+		virtual uint64 GetGPUMemoryUsage() const;
+
 
 	//[-------------------------------------------------------]
 	//[ Private virtual Resource functions                    ]
@@ -251,6 +327,8 @@ template <class AType> class Resource : public Loadable {
 		String							 m_sName;			/**< Resource name */
 		bool							 m_bProtected;		/**< Is the resource protected? */
 		Array<ResourceHandler<AType>*>	 m_lstHandlers;		/**< Resource handler list */
+		uint32							 m_nLastUsedFrame;	/**< Resource budget frame the resource was used the last time */
+		String							 m_sEvictedUrl;		/**< URL to reload the evicted resource from, empty if the resource isn't evicted */
 
 
 };
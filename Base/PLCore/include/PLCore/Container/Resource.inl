@@ -46,7 +46,8 @@ namespace PLCore {
 template <class AType>
 Resource<AType>::Resource(const String &sName, ResourceManager<AType> *pManager) :
 	m_pManager(nullptr),
-	m_bProtected(false)
+	m_bProtected(false),
+	m_nLastUsedFrame(0)
 {
 	// Set unique resource name
 	if (pManager)
@@ -55,8 +56,10 @@ Resource<AType>::Resource(const String &sName, ResourceManager<AType> *pManager)
 		m_sName = sName;
 
 	// Add this resource to the manager
-	if (pManager)
+	if (pManager) {
 		pManager->Add(static_cast<AType&>(*this));
+		m_nLastUsedFrame = pManager->GetBudgetFrame();
+	}
 }
 
 /**
@@ -119,6 +122,69 @@ int Resource<AType>::GetID() const
 	return -1;
 }
 
+/**
+*  @brief
+*    Marks the resource as used
+*/
+template <class AType>
+void Resource<AType>::Touch()
+{
+	// Timestamp the resource
+	if (m_pManager)
+		m_nLastUsedFrame = m_pManager->GetBudgetFrame();
+
+	// Reload the resource if it was evicted
+	if (m_sEvictedUrl.GetLength()) {
+		// Reset the evicted URL before loading, loading may touch this resource again
+		const String sUrl = m_sEvictedUrl;
+		m_sEvictedUrl = "";
+		LoadByFilename(sUrl);
+	}
+}
+
+/**
+*  @brief
+*    Returns the resource budget frame the resource was used the last time
+*/
+template <class AType>
+uint32 Resource<AType>::GetLastUsedFrame() const
+{
+	return m_nLastUsedFrame;
+}
+
+/**
+*  @brief
+*    Returns whether or not the resource is currently evicted
+*/
+template <class AType>
+bool Resource<AType>::IsEvicted() const
+{
+	return (m_sEvictedUrl.GetLength() != 0);
+}
+
+/**
+*  @brief
+*    Evicts the resource
+*/
+template <class AType>
+bool Resource<AType>::Evict()
+{
+	// Only resources loaded from a file can be reloaded
+	if (!m_bProtected && !m_sEvictedUrl.GetLength()) {
+		// Backup the URL, it's reset during unloading
+		const String sUrl = GetUrl();
+		if (sUrl.GetLength() && Unload()) {
+			m_sEvictedUrl = sUrl;
+
+			// Done
+			return true;
+		}
+	}
+
+	// Error!
+	return false;
+}
+
 
 //[-------------------------------------------------------]
 //[ Handler functions                                     ]
@@ -197,6 +263,28 @@ Resource<AType> &Resource<AType>::operator =(const Resource<AType> &cSource)
 	return *this;
 }
 
+/**
+*  @brief
+*    Returns the number of bytes in main memory used by the resource
+*/
+template <class AType>
+uint64 Resource<AType>::GetCPUMemoryUsage() const
+{
+	// Standard implementation, please overwrite in derived class
+	return 0;
+}
+
+/**
+*  @brief
+*    Returns the number of bytes in video memory used by the resource
+*/
+template <class AType>
+uint64 Resource<AType>::GetGPUMemoryUsage() const
+{
+	// Standard implementation, please overwrite in derived class
+	return 0;
+}
+
 
 //[-------------------------------------------------------]
 //[ Protected functions                                   ]
@@ -0,0 +1,276 @@
+/*********************************************************\
+ *  File: ResourceBudget.h                               *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+#ifndef __PLCORE_RESOURCE_BUDGET_H__
+#define __PLCORE_RESOURCE_BUDGET_H__
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "PLCore/Core/Singleton.h"
+#include "PLCore/Container/HashMap.h"
+#include "PLCore/Container/ResourceBudgetClient.h"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace PLCore {
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Global resource budget
+*
+*  @remarks
+*    Central registry knowing all resource managers (see ResourceBudgetClient) and therefore how many bytes
+*    the loaded resources occupy in main and video memory. Resource managers are grouped into budget categories,
+*    by default the category is the manager name. For each category a memory budget can be set. Once per frame
+*    "Update()" must be called, if a category is over its budget, resources which were not used for at least
+*    "GetMinUnusedFrames()" frames are evicted in least recently used order until the category fits into its
+*    budget again. An evicted resource stays within its manager and is reloaded at once as soon as it's
+*    accessed the next time through a resource handler or "ResourceManager::LoadResource()".
+*
+*  @note
+*    - Only resources loaded from a file and not protected can be evicted
+*    - Without a budget for a category, nothing within this category is ever evicted
+*/
+class ResourceBudget : public Singleton<ResourceBudget> {
+
+
+	//[-------------------------------------------------------]
+	//[ Friends                                               ]
+	//[-------------------------------------------------------]
+	friend class Singleton<ResourceBudget>;
+	friend class ResourceBudgetClient;
+
+
+	//[-------------------------------------------------------]
+	//[ Public static PLCore::Singleton functions             ]
+	//[-------------------------------------------------------]
+	// This solution enhances the compatibility with legacy compilers like GCC 4.2.1 used on Mac OS X 10.6
+	// -> The C++11 feature "extern template" (C++11, see e.g. http://www2.research.att.com/~bs/C++0xFAQ.html#extern-templates) can only be used on modern compilers like GCC 4.6
+	// -> We can't break legacy compiler support, especially when only the singletons are responsible for the break
+	// -> See PLCore::Singleton for more details about singletons
+	public:
+		static PLCORE_API ResourceBudget *GetInstance();
+		static PLCORE_API bool HasInstance();
+
+
+	//[-------------------------------------------------------]
+	//[ Public functions                                      ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Returns the current frame
+		*
+		*  @return
+		*    The current frame, incremented by each "Update()" call
+		*/
+		inline uint32 GetFrame() const;
+
+		/**
+		*  @brief
+		*    Returns the number of frames a resource must not be used before it can be evicted
+		*
+		*  @return
+		*    The number of frames a resource must not be used before it can be evicted
+		*/
+		inline uint32 GetMinUnusedFrames() const;
+
+		/**
+		*  @brief
+		*    Sets the number of frames a resource must not be used before it can be evicted
+		*
+		*  @param[in] nMinUnusedFrames
+		*    The number of frames a resource must not be used before it can be evicted (minimum is 1)
+		*/
+		inline void SetMinUnusedFrames(uint32 nMinUnusedFrames = 60);
+
+		/**
+		*  @brief
+		*    Returns the memory budget of a category
+		*
+		*  @param[in] sCategory
+		*    Name of the budget category
+		*
+		*  @return
+		*    Memory budget in bytes (main and video memory), 0 if there's no budget
+		*/
+		PLCORE_API uint64 GetBudget(const String &sCategory) const;
+
+		/**
+		*  @brief
+		*    Sets the memory budget of a category
+		*
+		*  @param[in] sCategory
+		*    Name of the budget category
+		*  @param[in] nBudget
+		*    Memory budget in bytes (main and video memory), 0 to remove the budget
+		*/
+		PLCORE_API void SetBudget(const String &sCategory, uint64 nBudget = 0);
+
+		/**
+		*  @brief
+		*    Returns the number of bytes currently used by the resources of a category
+		*
+		*  @param[in] sCategory
+		*    Name of the budget category, empty string for all categories
+		*
+		*  @return
+		*    Number of bytes (main and video memory) currently used by the resources of the category
+		*/
+		PLCORE_API uint64 GetMemoryUsage(const String &sCategory = "") const;
+
+		/**
+		*  @brief
+		*    Returns the total number of evicted resources
+		*
+		*  @return
+		*    The total number of resources evicted by "Update()"
+		*/
+		inline uint32 GetNumOfEvictions() const;
+
+		/**
+		*  @brief
+		*    Updates the resource budget
+		*
+		*  @return
+		*    Number of resources evicted during this update
+		*
+		*  @note
+		*    - Should be called once per frame, "PLRenderer::RendererContext::Update()" is doing this
+		*/
+		PLCORE_API uint32 Update();
+
+		/**
+		*  @brief
+		*    Returns a diagnostic text listing the top memory consumers
+		*
+		*  @param[in] nNumOfConsumers
+		*    Maximum number of listed resources
+		*
+		*  @return
+		*    Multi line text with the memory usage of each category followed by the top consumers, largest first
+		*/
+		PLCORE_API String GetTopConsumers(uint32 nNumOfConsumers = 10) const;
+
+		/**
+		*  @brief
+		*    Writes the top memory consumers into the log
+		*
+		*  @param[in] nNumOfConsumers
+		*    Maximum number of listed resources
+		*
+		*  @see
+		*    - GetTopConsumers()
+		*/
+		PLCORE_API void LogTopConsumers(uint32 nNumOfConsumers = 10) const;
+
+
+	//[-------------------------------------------------------]
+	//[ Private functions                                     ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Constructor
+		*/
+		ResourceBudget();
+
+		/**
+		*  @brief
+		*    Copy constructor
+		*
+		*  @param[in] cSource
+		*    Source to copy from
+		*/
+		ResourceBudget(const ResourceBudget &cSource);
+
+		/**
+		*  @brief
+		*    Destructor
+		*/
+		virtual ~ResourceBudget();
+
+		/**
+		*  @brief
+		*    Copy operator
+		*
+		*  @param[in] cSource
+		*    Source to copy from
+		*
+		*  @return
+		*    Reference to this instance
+		*/
+		ResourceBudget &operator =(const ResourceBudget &cSource);
+
+		/**
+		*  @brief
+		*    Evicts least recently used resources of a category until it fits into the given budget
+		*
+		*  @param[in] sCategory
+		*    Name of the budget category
+		*  @param[in] nBudget
+		*    Memory budget in bytes
+		*
+		*  @return
+		*    Number of evicted resources
+		*/
+		uint32 EvictCategory(const String &sCategory, uint64 nBudget);
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		Array<ResourceBudgetClient*> m_lstClients;			/**< Registered resource budget clients, the pointers are never a null pointer */
+		HashMap<String, uint64>		 m_mapBudgets;			/**< Memory budgets in bytes per category */
+		uint32						 m_nFrame;				/**< Current frame */
+		uint32						 m_nMinUnusedFrames;	/**< Number of frames a resource must not be used before it can be evicted */
+		uint32						 m_nNumOfEvictions;		/**< Total number of evicted resources */
+
+
+};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // PLCore
+
+
+//[-------------------------------------------------------]
+//[ Implementation                                        ]
+//[-------------------------------------------------------]
+#include "PLCore/Container/ResourceBudget.inl"
+
+
+#endif // __PLCORE_RESOURCE_BUDGET_H__
@@ -0,0 +1,74 @@
+/*********************************************************\
+ *  File: ResourceBudget.inl                             *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace PLCore {
+
+
+//[-------------------------------------------------------]
+//[ Public functions                                      ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Returns the current frame
+*/
+inline uint32 ResourceBudget::GetFrame() const
+{
+	return m_nFrame;
+}
+
+/**
+*  @brief
+*    Returns the number of frames a resource must not be used before it can be evicted
+*/
+inline uint32 ResourceBudget::GetMinUnusedFrames() const
+{
+	return m_nMinUnusedFrames;
+}
+
+/**
+*  @brief
+*    Sets the number of frames a resource must not be used before it can be evicted
+*/
+inline void ResourceBudget::SetMinUnusedFrames(uint32 nMinUnusedFrames)
+{
+	m_nMinUnusedFrames = nMinUnusedFrames ? nMinUnusedFrames : 1;
+}
+
+/**
+*  @brief
+*    Returns the total number of evicted resources
+*/
+inline uint32 ResourceBudget::GetNumOfEvictions() const
+{
+	return m_nNumOfEvictions;
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // PLCore
@@ -0,0 +1,203 @@
+/*********************************************************\
+ *  File: ResourceBudgetClient.h                         *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+#ifndef __PLCORE_RESOURCE_BUDGET_CLIENT_H__
+#define __PLCORE_RESOURCE_BUDGET_CLIENT_H__
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "PLCore/String/String.h"
+#include "PLCore/Container/Array.h"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace PLCore {
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Abstract resource budget client
+*
+*  @remarks
+*    Non template interface of a resource manager taking part in the global resource budget. Each
+*    client registers itself at the resource budget on construction and unregisters on destruction.
+*
+*  @see
+*    - ResourceBudget
+*/
+class ResourceBudgetClient {
+
+
+	//[-------------------------------------------------------]
+	//[ Friends                                               ]
+	//[-------------------------------------------------------]
+	friend class ResourceBudget;
+
+
+	//[-------------------------------------------------------]
+	//[ Public structures                                     ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Memory consumer information about one resource
+		*/
+		struct Consumer {
+			String	sName;				/**< Resource name */
+			uint64	nCPUMemory;			/**< Number of bytes in main memory used by the resource */
+			uint64	nGPUMemory;			/**< Number of bytes in video memory used by the resource */
+			uint32	nLastUsedFrame;		/**< Resource budget frame the resource was used the last time */
+			bool	bEvictable;			/**< Can the resource be evicted and reloaded on the next access? */
+
+			bool operator ==(const Consumer &cOther) const
+			{
+				return (sName == cOther.sName);
+			}
+		};
+
+
+	//[-------------------------------------------------------]
+	//[ Public functions                                      ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Returns the current resource budget frame
+		*
+		*  @return
+		*    The current resource budget frame
+		*
+		*  @note
+		*    - Updated by ResourceBudget::Update(), used to timestamp resource accesses
+		*/
+		inline uint32 GetBudgetFrame() const;
+
+
+	//[-------------------------------------------------------]
+	//[ Public virtual ResourceBudgetClient functions         ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Returns the name of the budget category this client belongs to
+		*
+		*  @return
+		*    Name of the budget category
+		*/
+		virtual String GetBudgetCategory() const = 0;
+
+		/**
+		*  @brief
+		*    Adds information about all resources of this client to the given list
+		*
+		*  @param[out] lstConsumers
+		*    Receives the consumer information, the list is not cleared before new entries are added
+		*/
+		virtual void GetBudgetConsumers(Array<Consumer> &lstConsumers) const = 0;
+
+		/**
+		*  @brief
+		*    Evicts a resource
+		*
+		*  @param[in] sName
+		*    Name of the resource to evict
+		*
+		*  @return
+		*    'true' if all went fine, else 'false' (unknown or not evictable resource)
+		*/
+		virtual bool EvictBudgetConsumer(const String &sName) = 0;
+
+
+	//[-------------------------------------------------------]
+	//[ Protected functions                                   ]
+	//[-------------------------------------------------------]
+	protected:
+		/**
+		*  @brief
+		*    Constructor
+		*/
+		PLCORE_API ResourceBudgetClient();
+
+		/**
+		*  @brief
+		*    Copy constructor
+		*
+		*  @param[in] cSource
+		*    Source to copy from
+		*/
+		PLCORE_API ResourceBudgetClient(const ResourceBudgetClient &cSource);
+
+		/**
+		*  @brief
+		*    Destructor
+		*/
+		PLCORE_API virtual ~ResourceBudgetClient();
+
+		/**
+		*  @brief
+		*    Copy operator
+		*
+		*  @param[in] cSource
+		*    Source to copy from
+		*
+		*  @return
+		*    Reference to this instance
+		*
+		*  @note
+		*    - The registration at the resource budget is not touched
+		*/
+		inline ResourceBudgetClient &operator =(const ResourceBudgetClient &cSource);
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		uint32 m_nBudgetFrame;	/**< Current resource budget frame */
+
+
+};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // PLCore
+
+
+//[-------------------------------------------------------]
+//[ Implementation                                        ]
+//[-------------------------------------------------------]
+#include "PLCore/Container/ResourceBudgetClient.inl"
+
+
+#endif // __PLCORE_RESOURCE_BUDGET_CLIENT_H__
@@ -83,6 +83,10 @@ template <class AType> class ResourceHandler {
 		*
 		*  @return
 		*    A pointer to the handlers resource, a null pointer if no resource
+		*
+		*  @note
+		*    - Marks the resource as used, see "Resource::Touch()"
+		*    - An evicted resource is reloaded at once, see "Resource::Touch()"
 		*/
 		AType *GetResource() const;
 
@@ -65,6 +65,9 @@ ResourceHandler<AType>::~ResourceHandler()
 template <class AType>
 AType *ResourceHandler<AType>::GetResource() const
 {
+	// Mark the resource as used, this reloads the resource in case it was evicted
+	if (m_pResource)
+		m_pResource->Touch();
 	return m_pResource;
 }
 
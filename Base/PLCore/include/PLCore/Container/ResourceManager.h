@@ -34,6 +34,7 @@
 #include "PLCore/Container/Array.h"
 #include "PLCore/Container/HashMap.h"
 #include "PLCore/Base/Event/Event.h"
+#include "PLCore/Container/ResourceBudgetClient.h"
 
 
 //[-------------------------------------------------------]
@@ -54,8 +55,11 @@ template <class AType> class Resource;
 /**
 *  @brief
 *    Abstract resource manager template
+*
+*  @note
+*    - Takes part in the global resource budget, see "ResourceBudget"
 */
-template <class AType> class ResourceManager {
+template <class AType> class ResourceManager : public ResourceBudgetClient {
 
 
 	//[-------------------------------------------------------]
@@ -211,6 +215,18 @@ template <class AType> class ResourceManager {
 		*/
 		uint32 GetNumOfElements() const;
 
+		/**
+		*  @brief
+		*    Sets the name of the resource budget category this manager belongs to
+		*
+		*  @param[in] sCategory
+		*    Name of the resource budget category, if empty the manager name is used as category
+		*
+		*  @see
+		*    - ResourceBudget
+		*/
+		void SetBudgetCategory(const String &sCategory = "");
+
 
 	//[-------------------------------------------------------]
 	//[ Public virtual ResourceManager functions              ]
@@ -231,7 +247,7 @@ template <class AType> class ResourceManager {
 		*    (file)name, this resource is returned instead creating a new one. This function is virtual to
 		*    enable derived managers to add some more features like automatic resource creation instead of
 		*    loading a resource. In this case, 'filenames' normally begin with 'Create ' to indicate automatic
-		*    resource creation.
+		*    resource creation. An already existing resource is marked as used, see "Resource::Touch()".
 		*/
 		virtual AType *LoadResource(const String &sFilename);
 
@@ -330,6 +346,15 @@ template <class AType> class ResourceManager {
 		virtual AType *GetByName(const String &sName) const;
 
 
+	//[-------------------------------------------------------]
+	//[ Public virtual ResourceBudgetClient functions         ]
+	//[-------------------------------------------------------]
+	public:
+		virtual String GetBudgetCategory() const override;
+		virtual void GetBudgetConsumers(Array<Consumer> &lstConsumers) const override;
+		virtual bool EvictBudgetConsumer(const String &sName) override;
+
+
 	//[-------------------------------------------------------]
 	//[ Protected functions                                   ]
 	//[-------------------------------------------------------]
@@ -398,6 +423,7 @@ template <class AType> class ResourceManager {
 		bool					 m_bUnloadUnused;		/**< Unload unused resources? */
 		Array<AType*>			 m_lstResources;		/**< Resource list */
 		HashMap<String, AType*>	 m_mapResources;		/**< Resource map */
+		String					 m_sBudgetCategory;		/**< Resource budget category, if empty the manager name is used */
 
 
 	//[-------------------------------------------------------]
@@ -225,6 +225,16 @@ uint32 ResourceManager<AType>::GetNumOfElements() const
 	return m_lstResources.GetNumOfElements();
 }
 
+/**
+*  @brief
+*    Sets the name of the resource budget category this manager belongs to
+*/
+template <class AType>
+void ResourceManager<AType>::SetBudgetCategory(const String &sCategory)
+{
+	m_sBudgetCategory = sCategory;
+}
+
 
 //[-------------------------------------------------------]
 //[ Public virtual ResourceManager functions              ]
@@ -265,8 +275,11 @@ AType *ResourceManager<AType>::LoadResource(const String &sFilename)
 {
 	// IS there already a resource with this name?
 	AType *pResource = GetByName(sFilename);
-	if (pResource)
+	if (pResource) {
+		// Mark the resource as used, this reloads the resource in case it was evicted
+		pResource->Touch();
 		return pResource;
+	}
 
 	// Create a new resource
 	pResource = Create(sFilename);
@@ -380,6 +393,38 @@ AType *ResourceManager<AType>::GetByName(const String &sName) const
 }
 
 
+//[-------------------------------------------------------]
+//[ Public virtual ResourceBudgetClient functions         ]
+//[-------------------------------------------------------]
+template <class AType>
+String ResourceManager<AType>::GetBudgetCategory() const
+{
+	return m_sBudgetCategory.GetLength() ? m_sBudgetCategory : m_sManagerName;
+}
+
+template <class AType>
+void ResourceManager<AType>::GetBudgetConsumers(Array<Consumer> &lstConsumers) const
+{
+	for (uint32 i=0; i<m_lstResources.GetNumOfElements(); i++) {
+		const AType *pResource = m_lstResources[i];
+		Consumer &sConsumer = lstConsumers.Add();
+		sConsumer.sName			 = pResource->GetName();
+		sConsumer.nCPUMemory	 = pResource->GetCPUMemoryUsage();
+		sConsumer.nGPUMemory	 = pResource->GetGPUMemoryUsage();
+		sConsumer.nLastUsedFrame = pResource->GetLastUsedFrame();
+		sConsumer.bEvictable	 = (pResource != m_pStandardResource && !pResource->IsProtected() && !pResource->IsEvicted() && pResource->GetUrl().GetLength());
+	}
+}
+
+template <class AType>
+bool ResourceManager<AType>::EvictBudgetConsumer(const String &sName)
+{
+	// The standard resource must always be available
+	AType *pResource = m_mapResources.Get(sName);
+	return (pResource && pResource != m_pStandardResource && pResource->Evict());
+}
+
+
 //[-------------------------------------------------------]
 //[ Protected functions                                   ]
 //[-------------------------------------------------------]
@@ -185,6 +185,18 @@ class System : public Singleton<System> {
 		*/
 		inline uint32 GetCPUMhz() const;
 
+		/**
+		*  @brief
+		*    Returns the number of logical processors
+		*
+		*  @return
+		*    Number of logical processors available to this process, always at least 1
+		*
+		*  @remarks
+		*    Use this to decide into how many parts a parallelizable workload should be split.
+		*/
+		inline uint32 GetNumOfProcessors() const;
+
 		/**
 		*  @brief
 		*    Returns the name of the computer
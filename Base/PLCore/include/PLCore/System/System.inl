@@ -97,6 +97,16 @@ inline uint32 System::GetCPUMhz() const
 	return m_pSystemImpl->GetCPUMhz();
 }
 
+/**
+*  @brief
+*    Returns the number of logical processors
+*/
+inline uint32 System::GetNumOfProcessors() const
+{
+	// Call system function
+	return m_pSystemImpl->GetNumOfProcessors();
+}
+
 /**
 *  @brief
 *    Returns the name of the computer
@@ -140,6 +140,15 @@ class SystemImpl {
 		*/
 		virtual uint32 GetCPUMhz() const = 0;
 
+		/**
+		*  @brief
+		*    Returns the number of logical processors
+		*
+		*  @return
+		*    Number of logical processors available to this process, always at least 1
+		*/
+		virtual uint32 GetNumOfProcessors() const = 0;
+
 		/**
 		*  @brief
 		*    Returns the name of the computer
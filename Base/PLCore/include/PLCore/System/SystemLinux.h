@@ -112,6 +112,7 @@ class SystemLinux : public SystemImpl {
 		virtual String GetSharedLibraryPrefix() const override;
 		virtual String GetSharedLibraryExtension() const override;
 		virtual uint32 GetCPUMhz() const override;
+		virtual uint32 GetNumOfProcessors() const override;
 		virtual String GetComputerName() const override;
 		virtual String GetUserName() const override;
 		virtual String GetUserHomeDir() const override;
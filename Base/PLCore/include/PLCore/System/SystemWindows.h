@@ -101,6 +101,7 @@ class SystemWindows : public SystemImpl {
 		virtual String GetSharedLibraryPrefix() const override;
 		virtual String GetSharedLibraryExtension() const override;
 		virtual uint32 GetCPUMhz() const override;
+		virtual uint32 GetNumOfProcessors() const override;
 		virtual String GetComputerName() const override;
 		virtual String GetUserName() const override;
 		virtual String GetUserHomeDir() const override;
@@ -0,0 +1,324 @@
+/*********************************************************\
+ *  File: ResourceBudget.cpp                             *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "PLCore/Log/Log.h"
+#include "PLCore/Container/ResourceBudget.h"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace PLCore {
+
+
+//[-------------------------------------------------------]
+//[ Template instance                                     ]
+//[-------------------------------------------------------]
+template class Singleton<ResourceBudget>;
+
+
+//[-------------------------------------------------------]
+//[ Global helper functions                               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Returns a human readable text for the given number of bytes
+*/
+static String GetMemoryText(uint64 nBytes)
+{
+	return String::Format("%.1f KiB", static_cast<double>(nBytes)/1024.0);
+}
+
+
+//[-------------------------------------------------------]
+//[ Public static PLCore::Singleton functions             ]
+//[-------------------------------------------------------]
+ResourceBudget *ResourceBudget::GetInstance()
+{
+	// The compiler should be able to optimize this extra call, at least inside this project (inlining)
+	return Singleton<ResourceBudget>::GetInstance();
+}
+
+bool ResourceBudget::HasInstance()
+{
+	// The compiler should be able to optimize this extra call, at least inside this project (inlining)
+	return Singleton<ResourceBudget>::HasInstance();
+}
+
+
+//[-------------------------------------------------------]
+//[ Public functions                                      ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Returns the memory budget of a category
+*/
+uint64 ResourceBudget::GetBudget(const String &sCategory) const
+{
+	// The 'Null'-object of the map is 0, meaning "no budget"
+	return m_mapBudgets.Get(sCategory);
+}
+
+/**
+*  @brief
+*    Sets the memory budget of a category
+*/
+void ResourceBudget::SetBudget(const String &sCategory, uint64 nBudget)
+{
+	if (nBudget)
+		m_mapBudgets.Set(sCategory, nBudget);
+	else
+		m_mapBudgets.Remove(sCategory);
+}
+
+/**
+*  @brief
+*    Returns the number of bytes currently used by the resources of a category
+*/
+uint64 ResourceBudget::GetMemoryUsage(const String &sCategory) const
+{
+	// Get the consumers of the category
+	Array<ResourceBudgetClient::Consumer> lstConsumers;
+	for (uint32 i=0; i<m_lstClients.GetNumOfElements(); i++) {
+		const ResourceBudgetClient *pClient = m_lstClients[i];
+		if (!sCategory.GetLength() || pClient->GetBudgetCategory() == sCategory)
+			pClient->GetBudgetConsumers(lstConsumers);
+	}
+
+	// Sum up the memory usage
+	uint64 nMemoryUsage = 0;
+	for (uint32 i=0; i<lstConsumers.GetNumOfElements(); i++) {
+		const ResourceBudgetClient::Consumer &sConsumer = lstConsumers[i];
+		nMemoryUsage += sConsumer.nCPUMemory + sConsumer.nGPUMemory;
+	}
+
+	// Done
+	return nMemoryUsage;
+}
+
+/**
+*  @brief
+*    Updates the resource budget
+*/
+uint32 ResourceBudget::Update()
+{
+	// Next frame, inform the clients so they can timestamp resource accesses
+	m_nFrame++;
+	for (uint32 i=0; i<m_lstClients.GetNumOfElements(); i++)
+		m_lstClients[i]->m_nBudgetFrame = m_nFrame;
+
+	// Enforce the budgets
+	uint32 nNumOfEvictions = 0;
+	Iterator<String> cIterator = m_mapBudgets.GetKeyIterator();
+	while (cIterator.HasNext()) {
+		const String sCategory = cIterator.Next();
+		nNumOfEvictions += EvictCategory(sCategory, m_mapBudgets.Get(sCategory));
+	}
+	m_nNumOfEvictions += nNumOfEvictions;
+
+	// Done
+	return nNumOfEvictions;
+}
+
+/**
+*  @brief
+*    Returns a diagnostic text listing the top memory consumers
+*/
+String ResourceBudget::GetTopConsumers(uint32 nNumOfConsumers) const
+{
+	// Gather all consumers, remember the category of each one
+	Array<ResourceBudgetClient::Consumer> lstConsumers;
+	Array<String> lstConsumerCategories;
+	Array<String> lstCategories;
+	HashMap<String, uint64> mapUsage;
+	for (uint32 i=0; i<m_lstClients.GetNumOfElements(); i++) {
+		const ResourceBudgetClient *pClient = m_lstClients[i];
+		const String sCategory = pClient->GetBudgetCategory();
+		const uint32 nFirstConsumer = lstConsumers.GetNumOfElements();
+		pClient->GetBudgetConsumers(lstConsumers);
+
+		// Update the category usage
+		if (!lstCategories.IsElement(sCategory))
+			lstCategories.Add(sCategory);
+		uint64 nUsage = mapUsage.Get(sCategory);
+		for (uint32 nConsumer=nFirstConsumer; nConsumer<lstConsumers.GetNumOfElements(); nConsumer++) {
+			const ResourceBudgetClient::Consumer &sConsumer = lstConsumers[nConsumer];
+			nUsage += sConsumer.nCPUMemory + sConsumer.nGPUMemory;
+			lstConsumerCategories.Add(sCategory);
+		}
+		mapUsage.Set(sCategory, nUsage);
+	}
+
+	// Category summary
+	String sText = String("Resource budget (frame ") + m_nFrame + ", " + m_nNumOfEvictions + " evictions)\n";
+	for (uint32 i=0; i<lstCategories.GetNumOfElements(); i++) {
+		const String &sCategory = lstCategories[i];
+		sText += "  " + sCategory + ": " + GetMemoryText(mapUsage.Get(sCategory));
+		const uint64 nBudget = GetBudget(sCategory);
+		if (nBudget)
+			sText += " of " + GetMemoryText(nBudget) + " budget";
+		sText += '\n';
+	}
+
+	// Top consumers, largest first
+	Array<bool> lstListed;
+	lstListed.Resize(lstConsumers.GetNumOfElements(), true, true);
+	for (uint32 nRank=1; nRank<=nNumOfConsumers; nRank++) {
+		// Find the largest consumer not listed yet
+		int nLargest = -1;
+		uint64 nLargestMemory = 0;
+		for (uint32 i=0; i<lstConsumers.GetNumOfElements(); i++) {
+			const ResourceBudgetClient::Consumer &sConsumer = lstConsumers[i];
+			const uint64 nMemory = sConsumer.nCPUMemory + sConsumer.nGPUMemory;
+			if (!lstListed[i] && nMemory > nLargestMemory) {
+				nLargest	   = i;
+				nLargestMemory = nMemory;
+			}
+		}
+		if (nLargest < 0)
+			break; // Done, no more resources using memory
+
+		// List the consumer
+		lstListed[nLargest] = true;
+		const ResourceBudgetClient::Consumer &sConsumer = lstConsumers[nLargest];
+		sText += String("  ") + nRank + ". [" + lstConsumerCategories[nLargest] + "] " + sConsumer.sName + ": " +
+				 GetMemoryText(sConsumer.nCPUMemory) + " CPU, " + GetMemoryText(sConsumer.nGPUMemory) + " GPU, last used in frame " + sConsumer.nLastUsedFrame + '\n';
+	}
+
+	// Done
+	return sText;
+}
+
+/**
+*  @brief
+*    Writes the top memory consumers into the log
+*/
+void ResourceBudget::LogTopConsumers(uint32 nNumOfConsumers) const
+{
+	PL_LOG(Info, GetTopConsumers(nNumOfConsumers))
+}
+
+
+//[-------------------------------------------------------]
+//[ Private functions                                     ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Constructor
+*/
+ResourceBudget::ResourceBudget() :
+	m_nFrame(0),
+	m_nMinUnusedFrames(60),
+	m_nNumOfEvictions(0)
+{
+}
+
+/**
+*  @brief
+*    Copy constructor
+*/
+ResourceBudget::ResourceBudget(const ResourceBudget &cSource) :
+	m_nFrame(0),
+	m_nMinUnusedFrames(60),
+	m_nNumOfEvictions(0)
+{
+	// No implementation because the copy constructor is never used
+}
+
+/**
+*  @brief
+*    Destructor
+*/
+ResourceBudget::~ResourceBudget()
+{
+}
+
+/**
+*  @brief
+*    Copy operator
+*/
+ResourceBudget &ResourceBudget::operator =(const ResourceBudget &cSource)
+{
+	// No implementation because the copy operator is never used
+	return *this;
+}
+
+/**
+*  @brief
+*    Evicts least recently used resources of a category until it fits into the given budget
+*/
+uint32 ResourceBudget::EvictCategory(const String &sCategory, uint64 nBudget)
+{
+	// Gather the consumers of the category and remember the client of each one
+	Array<ResourceBudgetClient::Consumer> lstConsumers;
+	Array<ResourceBudgetClient*> lstConsumerClients;
+	uint64 nMemoryUsage = 0;
+	for (uint32 i=0; i<m_lstClients.GetNumOfElements(); i++) {
+		ResourceBudgetClient *pClient = m_lstClients[i];
+		if (pClient->GetBudgetCategory() == sCategory) {
+			const uint32 nFirstConsumer = lstConsumers.GetNumOfElements();
+			pClient->GetBudgetConsumers(lstConsumers);
+			for (uint32 nConsumer=nFirstConsumer; nConsumer<lstConsumers.GetNumOfElements(); nConsumer++) {
+				const ResourceBudgetClient::Consumer &sConsumer = lstConsumers[nConsumer];
+				nMemoryUsage += sConsumer.nCPUMemory + sConsumer.nGPUMemory;
+				lstConsumerClients.Add(pClient);
+			}
+		}
+	}
+
+	// Evict least recently used resources until the category fits into its budget
+	uint32 nNumOfEvictions = 0;
+	while (nMemoryUsage > nBudget) {
+		// Find the least recently used evictable resource
+		int nLeastRecentlyUsed = -1;
+		for (uint32 i=0; i<lstConsumers.GetNumOfElements(); i++) {
+			const ResourceBudgetClient::Consumer &sConsumer = lstConsumers[i];
+			if (sConsumer.bEvictable && (sConsumer.nCPUMemory || sConsumer.nGPUMemory) && m_nFrame - sConsumer.nLastUsedFrame >= m_nMinUnusedFrames &&
+				(nLeastRecentlyUsed < 0 || sConsumer.nLastUsedFrame < lstConsumers[nLeastRecentlyUsed].nLastUsedFrame))
+				nLeastRecentlyUsed = i;
+		}
+		if (nLeastRecentlyUsed < 0)
+			break; // Nothing left we're allowed to evict
+
+		// Evict the resource
+		ResourceBudgetClient::Consumer &sConsumer = lstConsumers[nLeastRecentlyUsed];
+		sConsumer.bEvictable = false;
+		if (lstConsumerClients[nLeastRecentlyUsed]->EvictBudgetConsumer(sConsumer.sName)) {
+			nMemoryUsage -= sConsumer.nCPUMemory + sConsumer.nGPUMemory;
+			nNumOfEvictions++;
+		}
+	}
+
+	// Done
+	return nNumOfEvictions;
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // PLCore
@@ -0,0 +1,83 @@
+/*********************************************************\
+ *  File: ResourceBudgetClient.cpp                       *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "PLCore/Container/ResourceBudget.h"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace PLCore {
+
+
+//[-------------------------------------------------------]
+//[ Protected functions                                   ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Constructor
+*/
+ResourceBudgetClient::ResourceBudgetClient() :
+	m_nBudgetFrame(0)
+{
+	// Register at the resource budget (there's no instance anymore during the shutdown)
+	ResourceBudget *pResourceBudget = ResourceBudget::GetInstance();
+	if (pResourceBudget) {
+		pResourceBudget->m_lstClients.Add(this);
+		m_nBudgetFrame = pResourceBudget->m_nFrame;
+	}
+}
+
+/**
+*  @brief
+*    Copy constructor
+*/
+ResourceBudgetClient::ResourceBudgetClient(const ResourceBudgetClient &cSource) :
+	m_nBudgetFrame(cSource.m_nBudgetFrame)
+{
+	// Register at the resource budget (there's no instance anymore during the shutdown)
+	ResourceBudget *pResourceBudget = ResourceBudget::GetInstance();
+	if (pResourceBudget)
+		pResourceBudget->m_lstClients.Add(this);
+}
+
+/**
+*  @brief
+*    Destructor
+*/
+ResourceBudgetClient::~ResourceBudgetClient()
+{
+	// Unregister from the resource budget
+	if (ResourceBudget::HasInstance())
+		ResourceBudget::GetInstance()->m_lstClients.Remove(this);
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // PLCore
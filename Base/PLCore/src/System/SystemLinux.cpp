@@ -171,6 +171,13 @@ uint32 SystemLinux::GetCPUMhz() const
 	return nMhz;
 }
 
+uint32 SystemLinux::GetNumOfProcessors() const
+{
+	// Ask for the number of processors which are currently online
+	const long nProcessors = sysconf(_SC_NPROCESSORS_ONLN);
+	return (nProcessors > 0) ? static_cast<uint32>(nProcessors) : 1;
+}
+
 String SystemLinux::GetComputerName() const
 {
 	// Get computer name
@@ -414,6 +414,14 @@ uint32 SystemWindows::GetCPUMhz() const
 #endif
 }
 
+uint32 SystemWindows::GetNumOfProcessors() const
+{
+	// Get the number of logical processors
+	SYSTEM_INFO sSystemInfo;
+	GetSystemInfo(&sSystemInfo);
+	return (sSystemInfo.dwNumberOfProcessors > 0) ? static_cast<uint32>(sSystemInfo.dwNumberOfProcessors) : 1;
+}
+
 String SystemWindows::GetComputerName() const
 {
 	// First of all, get the length of the computer name (including the terminating zero)
@@ -0,0 +1,155 @@
+/*********************************************************\
+ *  File: BlockCompressor.h                              *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+
+
+#ifndef __PLGRAPHICS_BLOCKCOMPRESSOR_H__
+#define __PLGRAPHICS_BLOCKCOMPRESSOR_H__
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "PLGraphics/PLGraphics.h"
+
+
+//[-------------------------------------------------------]
+//[ Forward declarations                                  ]
+//[-------------------------------------------------------]
+namespace PLMath {
+	class Vector3i;
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace PLGraphics {
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Static class encoding uncompressed image data into DXT1/3/5 (BC1/2/3) and LATC1/2 (BC4/5) blocks
+*
+*  @remarks
+*    This is the encoder counterpart of "ImageBuffer::Decompress()", the produced blocks use the same
+*    layout and are encoded against exactly the palettes the decoder reconstructs. Each 4x4 block is
+*    encoded independently, so the block rows of all xy-planes (z/depth layers) are split across multiple
+*    threads. The nearest palette entry search and the cluster fit are using SSE2 when available.
+*
+*    DXT color blocks are always encoded in the four color mode, the DXT1 one bit alpha (three color mode)
+*    is not used because "ImageBuffer::Decompress()" doesn't decode alpha for DXT1. Pixels of blocks leaving
+*    the image are replicated from the image border.
+*/
+class BlockCompressor {
+
+
+	//[-------------------------------------------------------]
+	//[ Public static functions                               ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Compresses image data
+		*
+		*  @param[in]  nCompression
+		*    Compression type, must not be "CompressionNone"
+		*  @param[in]  nQuality
+		*    Compression quality
+		*  @param[in]  pnSource
+		*    Uncompressed image data with one byte per component, xy-planes (z/depth layers) are stored one after another
+		*  @param[in]  nComponentsPerPixel
+		*    Number of components per pixel, at least 3 for DXT (component 3 is used as alpha, if there's
+		*    no such component alpha is 255), at least 1 for LATC1 and at least 2 for LATC2
+		*  @param[in]  vSize
+		*    Image size
+		*  @param[out] pnDestination
+		*    Receives the compressed image data, must be able to hold "ImageBuffer::GetCompressedDataSize()" bytes
+		*  @param[in]  nNumOfThreads
+		*    Maximum number of threads to use, 0 for one thread per processor
+		*
+		*  @return
+		*    'true' if all went fine, else 'false' (invalid parameters)
+		*/
+		static PLGRAPHICS_API bool Compress(ECompression nCompression, ECompressionQuality nQuality, const PLCore::uint8 *pnSource, PLCore::uint32 nComponentsPerPixel,
+											const PLMath::Vector3i &vSize, PLCore::uint8 *pnDestination, PLCore::uint32 nNumOfThreads = 0);
+
+		/**
+		*  @brief
+		*    Encodes a DXT color block
+		*
+		*  @param[out] pnDestination
+		*    Receives the 8 bytes of the color block
+		*  @param[in]  pnRGBA
+		*    The 16 pixels of the block in rows, 4 bytes (RGBA) per pixel, alpha is ignored
+		*  @param[in]  nQuality
+		*    Compression quality
+		*
+		*  @return
+		*    Sum of the squared RGB errors of the decoded block
+		*/
+		static PLGRAPHICS_API PLCore::uint32 EncodeDXTColorBlock(PLCore::uint8 *pnDestination, const PLCore::uint8 *pnRGBA, ECompressionQuality nQuality);
+
+		/**
+		*  @brief
+		*    Encodes a DXT3 alpha block
+		*
+		*  @param[out] pnDestination
+		*    Receives the 8 bytes of the alpha block
+		*  @param[in]  pnValues
+		*    The 16 values of the block in rows
+		*/
+		static PLGRAPHICS_API void EncodeDXT3AlphaBlock(PLCore::uint8 *pnDestination, const PLCore::uint8 *pnValues);
+
+		/**
+		*  @brief
+		*    Encodes a DXT5 alpha block (also used for the LATC1/2 channels)
+		*
+		*  @param[out] pnDestination
+		*    Receives the 8 bytes of the alpha block
+		*  @param[in]  pnValues
+		*    The 16 values of the block in rows
+		*  @param[in]  nQuality
+		*    Compression quality
+		*
+		*  @return
+		*    Sum of the squared errors of the decoded block
+		*/
+		static PLGRAPHICS_API PLCore::uint32 EncodeDXT5AlphaBlock(PLCore::uint8 *pnDestination, const PLCore::uint8 *pnValues, ECompressionQuality nQuality);
+
+
+};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // PLGraphics
+
+
+#endif // __PLGRAPHICS_BLOCKCOMPRESSOR_H__
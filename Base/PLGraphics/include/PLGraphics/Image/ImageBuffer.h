@@ -450,8 +450,17 @@ class ImageBuffer {
 		*  @remarks
 		*    If the image contains uncompressed image data, the data will be
 		*    compressed and stored in the compressed image buffer.
+		*
+		*  @param[in] nQuality
+		*    Compression quality
+		*
+		*  @return
+		*    'true' if all went fine, else 'false' (e.g. no compression set or no byte data format)
+		*
+		*  @see
+		*    - "BlockCompressor"
 		*/
-		inline bool Compress();
+		inline bool Compress(ECompressionQuality nQuality = CompressionQualityFast);
 
 		/**
 		*  @brief
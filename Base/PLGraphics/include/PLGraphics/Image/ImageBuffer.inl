@@ -371,13 +371,13 @@ inline PLCore::uint8 *ImageBuffer::GetCompressedData()
 *  @brief
 *    Compress image data
 */
-inline bool ImageBuffer::Compress()
+inline bool ImageBuffer::Compress(ECompressionQuality nQuality)
 {
 	// This does not actually change the image data, so we don't use MakeBufferUnique() here. This also has
 	// the benefit of other images being able to access the compressed/uncompressed data in subsequent calls
 
 	// Compress data
-	return m_pImageData->Compress();
+	return m_pImageData->Compress(nQuality);
 }
 
 /**
@@ -283,8 +283,17 @@ class ImageData : protected PLCore::RefCount<ImageData> {
 		*  @remarks
 		*    If the image contains uncompressed image data, the data will be
 		*    compressed and stored in the compressed image buffer.
+		*
+		*  @param[in] nQuality
+		*    Compression quality
+		*
+		*  @return
+		*    'true' if all went fine, else 'false' (e.g. no compression set or no byte data format)
+		*
+		*  @see
+		*    - "BlockCompressor"
 		*/
-		PLGRAPHICS_API bool Compress();
+		PLGRAPHICS_API bool Compress(ECompressionQuality nQuality = CompressionQualityFast);
 
 		/**
 		*  @brief
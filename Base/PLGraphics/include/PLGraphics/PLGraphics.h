@@ -155,6 +155,15 @@ enum ECompression {
 	CompressionLATC2		/**< 2 component texture compression (luminance & alpha compression 4:1 -> normal map compression, also known as 3DC/ATI2N, known as BC5 in DirectX 10, 16 bytes per block) */
 };
 
+/**
+*  @brief
+*    Compression quality
+*/
+enum ECompressionQuality {
+	CompressionQualityFast = 0,	/**< Range fit, endpoints along the principal axis of the block colors (fast, e.g. when compressing on load) */
+	CompressionQualityHigh		/**< Cluster fit, tests all orderings of the block colors along the principal axis (slow, e.g. for offline tools) */
+};
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
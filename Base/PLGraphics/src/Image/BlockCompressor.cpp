@@ -0,0 +1,937 @@
+/*********************************************************\
+ *  File: BlockCompressor.cpp                            *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <PLCore/Core/MemoryManager.h>
+#include <PLCore/System/System.h>
+#include <PLCore/System/Thread.h>
+#include <PLMath/Math.h>
+#include <PLMath/Vector3i.h>
+#include "PLGraphics/Image/BlockCompressor.h"
+#ifdef PLMATH_SSE2
+	#include <emmintrin.h>
+#endif
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+using namespace PLCore;
+using namespace PLMath;
+namespace PLGraphics {
+
+
+//[-------------------------------------------------------]
+//[ Global definitions                                    ]
+//[-------------------------------------------------------]
+static const uint32 MinBlocksPerThread = 1024;	/**< Images with less blocks per thread are not worth the thread creation */
+static const float  ColorAlpha[4]	   = { 1.0f, 0.0f, 2.0f/3.0f, 1.0f/3.0f };	/**< Weight of color 0 for each color index */
+static const float  AlphaAlpha[8]	   = { 1.0f, 0.0f, 6.0f/7.0f, 5.0f/7.0f, 4.0f/7.0f, 3.0f/7.0f, 2.0f/7.0f, 1.0f/7.0f };	/**< Weight of alpha 0 for each alpha index of the eight value mode */
+
+
+//[-------------------------------------------------------]
+//[ Structures                                            ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Description of the block rows a single thread has to compress
+*/
+struct CompressionJob {
+	ECompression		 nCompression;
+	ECompressionQuality	 nQuality;
+	const uint8			*pnSource;
+	uint32				 nComponentsPerPixel;
+	uint32				 nWidth;
+	uint32				 nHeight;
+	uint32				 nBlocksX;
+	uint32				 nBlocksY;
+	uint32				 nBytesPerBlock;
+	uint8				*pnDestination;
+	uint32				 nFirstRow;
+	uint32				 nNumOfRows;
+};
+
+/**
+*  @brief
+*    The colors of a block as structure of arrays, the SIMD code processes four pixels at once
+*/
+struct ColorBlock {
+	float fR[16];
+	float fG[16];
+	float fB[16];
+};
+
+
+//[-------------------------------------------------------]
+//[ Global variables                                      ]
+//[-------------------------------------------------------]
+static uint8 SingleColor5[256][2];				/**< 5 bit endpoints whose palette entry 2 matches the 8 bit value best */
+static uint8 SingleColor6[256][2];				/**< 6 bit endpoints whose palette entry 2 matches the 8 bit value best */
+
+
+//[-------------------------------------------------------]
+//[ Global helper functions                               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Expands 5/6 bit color components to 8 bit, just as the GPU and "ImageBuffer::Decompress()" are doing it
+*/
+static inline int Expand5(uint32 nValue)
+{
+	return static_cast<int>((nValue << 3) | (nValue >> 2));
+}
+
+static inline int Expand6(uint32 nValue)
+{
+	return static_cast<int>((nValue << 2) | (nValue >> 4));
+}
+
+/**
+*  @brief
+*    Builds a single color table
+*/
+static void BuildSingleColorTable(uint8 nTable[256][2], uint32 nBits)
+{
+	const uint32 nMaximum = (1 << nBits) - 1;
+	for (int nValue=0; nValue<256; nValue++) {
+		int nBestError = 256;
+		for (uint32 n0=0; n0<=nMaximum && nBestError; n0++) {
+			const int nExpanded0 = (nBits == 5) ? Expand5(n0) : Expand6(n0);
+			for (uint32 n1=0; n1<=nMaximum; n1++) {
+				const int nExpanded1 = (nBits == 5) ? Expand5(n1) : Expand6(n1);
+				const int nError = Math::Abs((2*nExpanded0 + nExpanded1 + 1)/3 - nValue);
+				if (nError < nBestError) {
+					nBestError	   = nError;
+					nTable[nValue][0] = static_cast<uint8>(n0);
+					nTable[nValue][1] = static_cast<uint8>(n1);
+				}
+			}
+		}
+	}
+}
+
+/**
+*  @brief
+*    Builds the single color tables during static initialization, so the compression threads are only reading them
+*/
+static struct SingleColorTablesBuilder {
+	SingleColorTablesBuilder()
+	{
+		BuildSingleColorTable(SingleColor5, 5);
+		BuildSingleColorTable(SingleColor6, 6);
+	}
+} SingleColorTables;
+
+/**
+*  @brief
+*    Quantizes a color to 5:6:5
+*/
+static uint32 QuantizeColor(float fR, float fG, float fB)
+{
+	const int nR = Math::Min(Math::Max(static_cast<int>(fR*(31.0f/255.0f) + 0.5f), 0), 31);
+	const int nG = Math::Min(Math::Max(static_cast<int>(fG*(63.0f/255.0f) + 0.5f), 0), 63);
+	const int nB = Math::Min(Math::Max(static_cast<int>(fB*(31.0f/255.0f) + 0.5f), 0), 31);
+	return static_cast<uint32>((nR << 11) | (nG << 5) | nB);
+}
+
+/**
+*  @brief
+*    Chooses the nearest palette entry for each pixel of a color block
+*
+*  @return
+*    Sum of the squared errors
+*/
+static uint32 FindColorIndices(const ColorBlock &sBlock, const float fPalette[4][3], uint8 nIndices[16])
+{
+	#ifdef PLMATH_SSE2
+		__m128 vErrorSum = _mm_setzero_ps();
+		for (int i=0; i<16; i+=4) {
+			const __m128 vR = _mm_loadu_ps(&sBlock.fR[i]);
+			const __m128 vG = _mm_loadu_ps(&sBlock.fG[i]);
+			const __m128 vB = _mm_loadu_ps(&sBlock.fB[i]);
+			__m128  vBestError = _mm_set1_ps(1e30f);
+			__m128i vBestIndex = _mm_setzero_si128();
+			for (int nEntry=0; nEntry<4; nEntry++) {
+				const __m128 vDR = _mm_sub_ps(vR, _mm_set1_ps(fPalette[nEntry][0]));
+				const __m128 vDG = _mm_sub_ps(vG, _mm_set1_ps(fPalette[nEntry][1]));
+				const __m128 vDB = _mm_sub_ps(vB, _mm_set1_ps(fPalette[nEntry][2]));
+				const __m128 vError = _mm_add_ps(_mm_add_ps(_mm_mul_ps(vDR, vDR), _mm_mul_ps(vDG, vDG)), _mm_mul_ps(vDB, vDB));
+
+				// On ties the lower index wins, so equal endpoints result in index 0 everywhere
+				const __m128i vLess = _mm_castps_si128(_mm_cmplt_ps(vError, vBestError));
+				vBestError = _mm_min_ps(vError, vBestError);
+				vBestIndex = _mm_or_si128(_mm_andnot_si128(vLess, vBestIndex), _mm_and_si128(vLess, _mm_set1_epi32(nEntry)));
+			}
+			vErrorSum = _mm_add_ps(vErrorSum, vBestError);
+
+			int nBestIndex[4];
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(nBestIndex), vBestIndex);
+			for (int j=0; j<4; j++)
+				nIndices[i + j] = static_cast<uint8>(nBestIndex[j]);
+		}
+
+		// The errors are sums of squared integers, so they are exact within single precision
+		float fErrors[4];
+		_mm_storeu_ps(fErrors, vErrorSum);
+		return static_cast<uint32>(fErrors[0] + fErrors[1] + fErrors[2] + fErrors[3]);
+	#else
+		float fErrorSum = 0.0f;
+		for (int i=0; i<16; i++) {
+			float fBestError = 1e30f;
+			for (int nEntry=0; nEntry<4; nEntry++) {
+				const float fDR = sBlock.fR[i] - fPalette[nEntry][0];
+				const float fDG = sBlock.fG[i] - fPalette[nEntry][1];
+				const float fDB = sBlock.fB[i] - fPalette[nEntry][2];
+				const float fError = fDR*fDR + fDG*fDG + fDB*fDB;
+				if (fError < fBestError) {
+					fBestError  = fError;
+					nIndices[i] = static_cast<uint8>(nEntry);
+				}
+			}
+			fErrorSum += fBestError;
+		}
+		return static_cast<uint32>(fErrorSum);
+	#endif
+}
+
+/**
+*  @brief
+*    Encodes a color block using the given 5:6:5 endpoints
+*
+*  @return
+*    Sum of the squared errors
+*/
+static uint32 EncodeColorEndpoints(uint8 *pnDestination, const ColorBlock &sBlock, uint32 nColor0, uint32 nColor1)
+{
+	// The four color mode requires color 0 to be greater than color 1, equal colors decode to color 0 anyway
+	if (nColor0 < nColor1) {
+		const uint32 nTemp = nColor0;
+		nColor0 = nColor1;
+		nColor1 = nTemp;
+	}
+
+	// Build the palette exactly as "ImageData::DecodeDXTColorBlock()" does
+	int nPalette[4][3];
+	nPalette[0][0] = Expand5((nColor0 >> 11) & 0x1F);
+	nPalette[0][1] = Expand6((nColor0 >>  5) & 0x3F);
+	nPalette[0][2] = Expand5( nColor0        & 0x1F);
+	nPalette[1][0] = Expand5((nColor1 >> 11) & 0x1F);
+	nPalette[1][1] = Expand6((nColor1 >>  5) & 0x3F);
+	nPalette[1][2] = Expand5( nColor1        & 0x1F);
+	float fPalette[4][3];
+	for (int i=0; i<3; i++) {
+		fPalette[0][i] = static_cast<float>(nPalette[0][i]);
+		fPalette[1][i] = static_cast<float>(nPalette[1][i]);
+		fPalette[2][i] = static_cast<float>((2*nPalette[0][i] +   nPalette[1][i] + 1)/3);
+		fPalette[3][i] = static_cast<float>((  nPalette[0][i] + 2*nPalette[1][i] + 1)/3);
+	}
+
+	// Choose the indices
+	uint8 nIndices[16];
+	const uint32 nError = FindColorIndices(sBlock, fPalette, nIndices);
+
+	// Write the block
+	pnDestination[0] = static_cast<uint8>(nColor0 & 0xFF);
+	pnDestination[1] = static_cast<uint8>(nColor0 >> 8);
+	pnDestination[2] = static_cast<uint8>(nColor1 & 0xFF);
+	pnDestination[3] = static_cast<uint8>(nColor1 >> 8);
+	for (int y=0; y<4; y++)
+		pnDestination[4 + y] = static_cast<uint8>(nIndices[y*4] | (nIndices[y*4 + 1] << 2) | (nIndices[y*4 + 2] << 4) | (nIndices[y*4 + 3] << 6));
+
+	// Done
+	return nError;
+}
+
+/**
+*  @brief
+*    Refines the endpoints of an encoded color block by a least squares fit to its indices
+*
+*  @return
+*    'true' if the block has been improved, else 'false'
+*/
+static bool RefineColorBlock(uint8 *pnBlock, uint32 &nError, const ColorBlock &sBlock)
+{
+	// Setup the normal equations, alpha is the weight of color 0 and beta the weight of color 1
+	float fAlphaAlpha = 0.0f, fBetaBeta = 0.0f, fAlphaBeta = 0.0f;
+	float fAlphaX[3] = { 0.0f, 0.0f, 0.0f };
+	float fBetaX[3]  = { 0.0f, 0.0f, 0.0f };
+	for (int i=0; i<16; i++) {
+		const float fAlpha = ColorAlpha[(pnBlock[4 + i/4] >> (2*(i%4))) & 0x3];
+		const float fBeta  = 1.0f - fAlpha;
+		fAlphaAlpha += fAlpha*fAlpha;
+		fBetaBeta   += fBeta*fBeta;
+		fAlphaBeta  += fAlpha*fBeta;
+		fAlphaX[0]  += fAlpha*sBlock.fR[i];
+		fAlphaX[1]  += fAlpha*sBlock.fG[i];
+		fAlphaX[2]  += fAlpha*sBlock.fB[i];
+		fBetaX[0]   += fBeta*sBlock.fR[i];
+		fBetaX[1]   += fBeta*sBlock.fG[i];
+		fBetaX[2]   += fBeta*sBlock.fB[i];
+	}
+	const float fDeterminant = fAlphaAlpha*fBetaBeta - fAlphaBeta*fAlphaBeta;
+	if (fDeterminant < 0.0001f)
+		return false; // All pixels are using the same endpoint weight
+
+	// Solve them
+	const float fInvDeterminant = 1.0f/fDeterminant;
+	float fA[3], fB[3];
+	for (int i=0; i<3; i++) {
+		fA[i] = (fBetaBeta*fAlphaX[i]   - fAlphaBeta*fBetaX[i])*fInvDeterminant;
+		fB[i] = (fAlphaAlpha*fBetaX[i] - fAlphaBeta*fAlphaX[i])*fInvDeterminant;
+	}
+
+	// Keep the refined block only if it's better
+	uint8 nRefined[8];
+	const uint32 nRefinedError = EncodeColorEndpoints(nRefined, sBlock, QuantizeColor(fA[0], fA[1], fA[2]), QuantizeColor(fB[0], fB[1], fB[2]));
+	if (nRefinedError < nError) {
+		MemoryManager::Copy(pnBlock, nRefined, 8);
+		nError = nRefinedError;
+		return true;
+	}
+	return false;
+}
+
+/**
+*  @brief
+*    Computes the mean and the principal axis of the block colors
+*/
+static void ComputePrincipalAxis(const ColorBlock &sBlock, float fMean[3], float fAxis[3])
+{
+	// Mean
+	fMean[0] = fMean[1] = fMean[2] = 0.0f;
+	for (int i=0; i<16; i++) {
+		fMean[0] += sBlock.fR[i];
+		fMean[1] += sBlock.fG[i];
+		fMean[2] += sBlock.fB[i];
+	}
+	fMean[0] *= 1.0f/16.0f;
+	fMean[1] *= 1.0f/16.0f;
+	fMean[2] *= 1.0f/16.0f;
+
+	// Covariance matrix
+	float fCovariance[3][3] = { { 0.0f, 0.0f, 0.0f }, { 0.0f, 0.0f, 0.0f }, { 0.0f, 0.0f, 0.0f } };
+	for (int i=0; i<16; i++) {
+		const float fR = sBlock.fR[i] - fMean[0];
+		const float fG = sBlock.fG[i] - fMean[1];
+		const float fB = sBlock.fB[i] - fMean[2];
+		fCovariance[0][0] += fR*fR;
+		fCovariance[0][1] += fR*fG;
+		fCovariance[0][2] += fR*fB;
+		fCovariance[1][1] += fG*fG;
+		fCovariance[1][2] += fG*fB;
+		fCovariance[2][2] += fB*fB;
+	}
+	fCovariance[1][0] = fCovariance[0][1];
+	fCovariance[2][0] = fCovariance[0][2];
+	fCovariance[2][1] = fCovariance[1][2];
+
+	// Power iteration, starting with the row of the component with the largest variance
+	int nStart = 0;
+	if (fCovariance[1][1] > fCovariance[nStart][nStart])
+		nStart = 1;
+	if (fCovariance[2][2] > fCovariance[nStart][nStart])
+		nStart = 2;
+	float fVector[3] = { fCovariance[nStart][0], fCovariance[nStart][1], fCovariance[nStart][2] };
+	for (int nIteration=0; nIteration<8; nIteration++) {
+		const float fX = fCovariance[0][0]*fVector[0] + fCovariance[0][1]*fVector[1] + fCovariance[0][2]*fVector[2];
+		const float fY = fCovariance[1][0]*fVector[0] + fCovariance[1][1]*fVector[1] + fCovariance[1][2]*fVector[2];
+		const float fZ = fCovariance[2][0]*fVector[0] + fCovariance[2][1]*fVector[1] + fCovariance[2][2]*fVector[2];
+		const float fMaximum = Math::Max(Math::Max(Math::Abs(fX), Math::Abs(fY)), Math::Abs(fZ));
+		if (fMaximum < 1e-6f)
+			break;
+		fVector[0] = fX/fMaximum;
+		fVector[1] = fY/fMaximum;
+		fVector[2] = fZ/fMaximum;
+	}
+
+	// Normalize, fall back to the luminance axis for degenerated blocks
+	const float fLength = Math::Sqrt(fVector[0]*fVector[0] + fVector[1]*fVector[1] + fVector[2]*fVector[2]);
+	if (fLength > 1e-6f) {
+		fAxis[0] = fVector[0]/fLength;
+		fAxis[1] = fVector[1]/fLength;
+		fAxis[2] = fVector[2]/fLength;
+	} else {
+		fAxis[0] = fAxis[1] = fAxis[2] = 0.57735027f;
+	}
+}
+
+/**
+*  @brief
+*    Cluster fit, returns the 5:6:5 endpoints of the best ordered partition of the pixels along the principal axis
+*
+*  @remarks
+*    The pixels are sorted along the principal axis and each of the 969 ordered partitions into the four palette
+*    entries is tested. The least squares endpoints and the error of a partition are computed in constant time by
+*    using prefix sums of the sorted colors. The endpoints are snapped to the 5:6:5 grid before computing the error.
+*/
+static void ClusterFit(const ColorBlock &sBlock, const float fAxis[3], uint32 &nColor0, uint32 &nColor1)
+{
+	// Sort the pixels along the principal axis (insertion sort, there are just 16 of them)
+	float fDot[16];
+	int   nOrder[16];
+	for (int i=0; i<16; i++) {
+		const float fValue = sBlock.fR[i]*fAxis[0] + sBlock.fG[i]*fAxis[1] + sBlock.fB[i]*fAxis[2];
+		int j = i;
+		for (; j>0 && fDot[j - 1] > fValue; j--) {
+			fDot[j]   = fDot[j - 1];
+			nOrder[j] = nOrder[j - 1];
+		}
+		fDot[j]   = fValue;
+		nOrder[j] = i;
+	}
+
+	// Prefix sums of the sorted colors, the fourth component is unused
+	float fPrefix[17][4];
+	fPrefix[0][0] = fPrefix[0][1] = fPrefix[0][2] = fPrefix[0][3] = 0.0f;
+	for (int i=0; i<16; i++) {
+		fPrefix[i + 1][0] = fPrefix[i][0] + sBlock.fR[nOrder[i]];
+		fPrefix[i + 1][1] = fPrefix[i][1] + sBlock.fG[nOrder[i]];
+		fPrefix[i + 1][2] = fPrefix[i][2] + sBlock.fB[nOrder[i]];
+		fPrefix[i + 1][3] = 0.0f;
+	}
+
+	// The first i sorted pixels are using color 0 (alpha = 1), up to j the 2/3 entry, up to k the 1/3 entry and the rest color 1
+	float fBestA[4] = { fPrefix[16][0]/16.0f, fPrefix[16][1]/16.0f, fPrefix[16][2]/16.0f, 0.0f };
+	float fBestB[4] = { fBestA[0], fBestA[1], fBestA[2], 0.0f };
+	#ifdef PLMATH_SSE2
+		const __m128 vZero		= _mm_setzero_ps();
+		const __m128 vMaximum	= _mm_set1_ps(255.0f);
+		const __m128 vHalf		= _mm_set1_ps(0.5f);
+		const __m128 vThird		= _mm_set1_ps(1.0f/3.0f);
+		const __m128 vGrid		= _mm_setr_ps(31.0f/255.0f, 63.0f/255.0f, 31.0f/255.0f, 0.0f);
+		const __m128 vGridInv	= _mm_setr_ps(255.0f/31.0f, 255.0f/63.0f, 255.0f/31.0f, 0.0f);
+		const __m128 vTotal		= _mm_loadu_ps(fPrefix[16]);
+		__m128 vBestA = _mm_loadu_ps(fBestA);
+		__m128 vBestB = _mm_loadu_ps(fBestB);
+		float  fBestError = 1e30f;
+		for (int i=0; i<=16; i++) {
+			const __m128 vPrefixI = _mm_loadu_ps(fPrefix[i]);
+			for (int j=i; j<=16; j++) {
+				const __m128 vPrefixIJ = _mm_add_ps(vPrefixI, _mm_loadu_ps(fPrefix[j]));
+				for (int k=j; k<=16; k++) {
+					const float fAlphaAlpha  = static_cast<float>(5*i + 3*j + k)/9.0f;
+					const float fBetaBeta    = static_cast<float>(144 - i - 3*j - 5*k)/9.0f;
+					const float fAlphaBeta   = static_cast<float>(2*(k - i))/9.0f;
+					const float fDeterminant = fAlphaAlpha*fBetaBeta - fAlphaBeta*fAlphaBeta;
+					if (fDeterminant < 0.0001f)
+						continue; // All pixels are using the same endpoint weight, the range fit covers this
+
+					// Least squares endpoints
+					const __m128 vAlphaAlpha = _mm_set1_ps(fAlphaAlpha);
+					const __m128 vBetaBeta   = _mm_set1_ps(fBetaBeta);
+					const __m128 vAlphaBeta  = _mm_set1_ps(fAlphaBeta);
+					const __m128 vInvDet     = _mm_set1_ps(1.0f/fDeterminant);
+					const __m128 vAlphaX     = _mm_mul_ps(_mm_add_ps(vPrefixIJ, _mm_loadu_ps(fPrefix[k])), vThird);
+					const __m128 vBetaX      = _mm_sub_ps(vTotal, vAlphaX);
+					__m128 vA = _mm_mul_ps(_mm_sub_ps(_mm_mul_ps(vBetaBeta,  vAlphaX), _mm_mul_ps(vAlphaBeta, vBetaX)),  vInvDet);
+					__m128 vB = _mm_mul_ps(_mm_sub_ps(_mm_mul_ps(vAlphaAlpha, vBetaX), _mm_mul_ps(vAlphaBeta, vAlphaX)), vInvDet);
+
+					// Clamp and snap to the 5:6:5 grid
+					vA = _mm_min_ps(_mm_max_ps(vA, vZero), vMaximum);
+					vB = _mm_min_ps(_mm_max_ps(vB, vZero), vMaximum);
+					vA = _mm_mul_ps(_mm_cvtepi32_ps(_mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(vA, vGrid), vHalf))), vGridInv);
+					vB = _mm_mul_ps(_mm_cvtepi32_ps(_mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(vB, vGrid), vHalf))), vGridInv);
+
+					// Error without the constant sum of the squared colors: a*a*aa + b*b*bb + 2*(a*b*ab - a*ax - b*bx)
+					__m128 vError = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(vA, vA), vAlphaAlpha), _mm_mul_ps(_mm_mul_ps(vB, vB), vBetaBeta));
+					const __m128 vCross = _mm_sub_ps(_mm_sub_ps(_mm_mul_ps(_mm_mul_ps(vA, vB), vAlphaBeta), _mm_mul_ps(vA, vAlphaX)), _mm_mul_ps(vB, vBetaX));
+					vError = _mm_add_ps(vError, _mm_add_ps(vCross, vCross));
+					vError = _mm_add_ps(vError, _mm_movehl_ps(vError, vError));
+					vError = _mm_add_ss(vError, _mm_shuffle_ps(vError, vError, _MM_SHUFFLE(1, 1, 1, 1)));
+					const float fError = _mm_cvtss_f32(vError);
+					if (fError < fBestError) {
+						fBestError = fError;
+						vBestA	   = vA;
+						vBestB	   = vB;
+					}
+				}
+			}
+		}
+		_mm_storeu_ps(fBestA, vBestA);
+		_mm_storeu_ps(fBestB, vBestB);
+	#else
+		static const float fGrid[3]	   = { 31.0f/255.0f, 63.0f/255.0f, 31.0f/255.0f };
+		static const float fGridInv[3] = { 255.0f/31.0f, 255.0f/63.0f, 255.0f/31.0f };
+		float fBestError = 1e30f;
+		for (int i=0; i<=16; i++) {
+			for (int j=i; j<=16; j++) {
+				for (int k=j; k<=16; k++) {
+					const float fAlphaAlpha  = static_cast<float>(5*i + 3*j + k)/9.0f;
+					const float fBetaBeta    = static_cast<float>(144 - i - 3*j - 5*k)/9.0f;
+					const float fAlphaBeta   = static_cast<float>(2*(k - i))/9.0f;
+					const float fDeterminant = fAlphaAlpha*fBetaBeta - fAlphaBeta*fAlphaBeta;
+					if (fDeterminant < 0.0001f)
+						continue; // All pixels are using the same endpoint weight, the range fit covers this
+					const float fInvDeterminant = 1.0f/fDeterminant;
+
+					// Same operations in the same order as the SSE2 version above, so both are giving equal results
+					float fA[3], fB[3], fError[3];
+					for (int c=0; c<3; c++) {
+						const float fAlphaX = (fPrefix[i][c] + fPrefix[j][c] + fPrefix[k][c])*(1.0f/3.0f);
+						const float fBetaX  = fPrefix[16][c] - fAlphaX;
+
+						// Least squares endpoints, clamped and snapped to the 5:6:5 grid
+						fA[c] = Math::Min(Math::Max((fBetaBeta*fAlphaX   - fAlphaBeta*fBetaX)*fInvDeterminant,  0.0f), 255.0f);
+						fB[c] = Math::Min(Math::Max((fAlphaAlpha*fBetaX - fAlphaBeta*fAlphaX)*fInvDeterminant, 0.0f), 255.0f);
+						fA[c] = static_cast<float>(static_cast<int>(fA[c]*fGrid[c] + 0.5f))*fGridInv[c];
+						fB[c] = static_cast<float>(static_cast<int>(fB[c]*fGrid[c] + 0.5f))*fGridInv[c];
+
+						// Error without the constant sum of the squared colors
+						const float fCross = fA[c]*fB[c]*fAlphaBeta - fA[c]*fAlphaX - fB[c]*fBetaX;
+						fError[c] = (fA[c]*fA[c]*fAlphaAlpha + fB[c]*fB[c]*fBetaBeta) + (fCross + fCross);
+					}
+					if ((fError[0] + fError[2]) + fError[1] < fBestError) {
+						fBestError = (fError[0] + fError[2]) + fError[1];
+						for (int c=0; c<3; c++) {
+							fBestA[c] = fA[c];
+							fBestB[c] = fB[c];
+						}
+					}
+				}
+			}
+		}
+	#endif
+
+	// Return the endpoints
+	nColor0 = QuantizeColor(fBestA[0], fBestA[1], fBestA[2]);
+	nColor1 = QuantizeColor(fBestB[0], fBestB[1], fBestB[2]);
+}
+
+/**
+*  @brief
+*    Chooses the nearest palette entry for each value of an alpha block
+*
+*  @return
+*    Sum of the squared errors
+*/
+static uint32 FindAlphaIndices(const uint8 *pnValues, const int nPalette[8], uint8 nIndices[16])
+{
+	#ifdef PLMATH_SSE2
+		// The values are processed as two times eight 16 bit integers
+		const __m128i vBytes	 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pnValues));
+		const __m128i vValues[2] = { _mm_unpacklo_epi8(vBytes, _mm_setzero_si128()), _mm_unpackhi_epi8(vBytes, _mm_setzero_si128()) };
+		__m128i vErrorSum = _mm_setzero_si128();
+		for (int nHalf=0; nHalf<2; nHalf++) {
+			__m128i vBestDistance = _mm_set1_epi16(0x7FFF);
+			__m128i vBestIndex	  = _mm_setzero_si128();
+			for (int nEntry=0; nEntry<8; nEntry++) {
+				const __m128i vEntry	= _mm_set1_epi16(static_cast<short>(nPalette[nEntry]));
+				const __m128i vDistance = _mm_sub_epi16(_mm_max_epi16(vValues[nHalf], vEntry), _mm_min_epi16(vValues[nHalf], vEntry));
+				const __m128i vLess		= _mm_cmplt_epi16(vDistance, vBestDistance);
+				vBestDistance = _mm_min_epi16(vDistance, vBestDistance);
+				vBestIndex	  = _mm_or_si128(_mm_andnot_si128(vLess, vBestIndex), _mm_and_si128(vLess, _mm_set1_epi16(static_cast<short>(nEntry))));
+			}
+			vErrorSum = _mm_add_epi32(vErrorSum, _mm_madd_epi16(vBestDistance, vBestDistance));
+			_mm_storel_epi64(reinterpret_cast<__m128i*>(&nIndices[nHalf*8]), _mm_packus_epi16(vBestIndex, vBestIndex));
+		}
+		int nErrors[4];
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(nErrors), vErrorSum);
+		return static_cast<uint32>(nErrors[0] + nErrors[1] + nErrors[2] + nErrors[3]);
+	#else
+		uint32 nErrorSum = 0;
+		for (int i=0; i<16; i++) {
+			int nBestDistance = 256;
+			for (int nEntry=0; nEntry<8; nEntry++) {
+				const int nDistance = Math::Abs(static_cast<int>(pnValues[i]) - nPalette[nEntry]);
+				if (nDistance < nBestDistance) {
+					nBestDistance = nDistance;
+					nIndices[i]   = static_cast<uint8>(nEntry);
+				}
+			}
+			nErrorSum += nBestDistance*nBestDistance;
+		}
+		return nErrorSum;
+	#endif
+}
+
+/**
+*  @brief
+*    Encodes an alpha block using the given endpoints (alpha 0 > alpha 1 selects the eight value mode)
+*
+*  @return
+*    Sum of the squared errors
+*/
+static uint32 EncodeAlphaEndpoints(uint8 *pnDestination, const uint8 *pnValues, uint32 nAlpha0, uint32 nAlpha1, uint8 nIndices[16])
+{
+	// Build the palette exactly as "ImageData::DecodeDXT5AlphaBlock()" does
+	int nPalette[8];
+	nPalette[0] = static_cast<int>(nAlpha0);
+	nPalette[1] = static_cast<int>(nAlpha1);
+	if (nAlpha0 > nAlpha1) {
+		for (int k=2; k<8; k++)
+			nPalette[k] = ((8 - k)*nPalette[0] + (k - 1)*nPalette[1])/7;
+	} else {
+		for (int k=2; k<6; k++)
+			nPalette[k] = ((6 - k)*nPalette[0] + (k - 1)*nPalette[1])/5;
+		nPalette[6] = 0;
+		nPalette[7] = 255;
+	}
+
+	// Choose the indices
+	const uint32 nError = FindAlphaIndices(pnValues, nPalette, nIndices);
+
+	// Write the block, the 3 bit indices are stored in pixel order starting with the lowest bit
+	pnDestination[0] = static_cast<uint8>(nAlpha0);
+	pnDestination[1] = static_cast<uint8>(nAlpha1);
+	uint64 nBits = 0;
+	for (int i=0; i<16; i++)
+		nBits |= static_cast<uint64>(nIndices[i]) << (3*i);
+	for (int i=0; i<6; i++)
+		pnDestination[2 + i] = static_cast<uint8>(nBits >> (8*i));
+
+	// Done
+	return nError;
+}
+
+/**
+*  @brief
+*    Compresses the block rows of a job
+*/
+static void CompressRows(const CompressionJob &sJob)
+{
+	const uint32 nComponentsPerPixel = sJob.nComponentsPerPixel;
+	const uint32 nRowStride			 = sJob.nWidth*nComponentsPerPixel;
+	uint8 nRGBA[64];
+	uint8 nValues[16];
+
+	for (uint32 nRow=sJob.nFirstRow; nRow<sJob.nFirstRow+sJob.nNumOfRows; nRow++) {
+		// xy-planes (z/depth layers) are independent when it comes to compressed blocks
+		const uint8 *pnPlane	   = sJob.pnSource + (nRow/sJob.nBlocksY)*sJob.nHeight*nRowStride;
+		const uint32 nY			   = (nRow%sJob.nBlocksY)*4;
+		uint8		*pnDestination = sJob.pnDestination + nRow*sJob.nBlocksX*sJob.nBytesPerBlock;
+
+		for (uint32 nX=0; nX<sJob.nWidth; nX+=4) {
+			// Gather the RGBA pixels of the block, pixels leaving the image are replicated from the image border
+			for (uint32 y=0; y<4; y++) {
+				const uint8 *pnSourceRow = pnPlane + Math::Min(nY + y, sJob.nHeight - 1)*nRowStride;
+				for (uint32 x=0; x<4; x++) {
+					const uint8 *pnPixel = pnSourceRow + Math::Min(nX + x, sJob.nWidth - 1)*nComponentsPerPixel;
+					uint8		*pnTexel = &nRGBA[(y*4 + x)*4];
+					for (uint32 nComponent=0; nComponent<4; nComponent++)
+						pnTexel[nComponent] = (nComponent < nComponentsPerPixel) ? pnPixel[nComponent] : 255;
+				}
+			}
+
+			// Encode the block using the layout "ImageData::Decompress()" expects
+			switch (sJob.nCompression) {
+				case CompressionDXT1:
+					BlockCompressor::EncodeDXTColorBlock(pnDestination, nRGBA, sJob.nQuality);
+					break;
+
+				case CompressionDXT3:
+					for (int i=0; i<16; i++)
+						nValues[i] = nRGBA[i*4 + 3];
+					BlockCompressor::EncodeDXT3AlphaBlock(pnDestination, nValues);
+					BlockCompressor::EncodeDXTColorBlock(pnDestination + 8, nRGBA, sJob.nQuality);
+					break;
+
+				case CompressionDXT5:
+					for (int i=0; i<16; i++)
+						nValues[i] = nRGBA[i*4 + 3];
+					BlockCompressor::EncodeDXT5AlphaBlock(pnDestination, nValues, sJob.nQuality);
+					BlockCompressor::EncodeDXTColorBlock(pnDestination + 8, nRGBA, sJob.nQuality);
+					break;
+
+				case CompressionLATC1:
+					for (int i=0; i<16; i++)
+						nValues[i] = nRGBA[i*4];
+					BlockCompressor::EncodeDXT5AlphaBlock(pnDestination, nValues, sJob.nQuality);
+					break;
+
+				case CompressionLATC2:
+					// The first block holds the second component, the second block the first component
+					for (int i=0; i<16; i++)
+						nValues[i] = nRGBA[i*4 + 1];
+					BlockCompressor::EncodeDXT5AlphaBlock(pnDestination, nValues, sJob.nQuality);
+					for (int i=0; i<16; i++)
+						nValues[i] = nRGBA[i*4];
+					BlockCompressor::EncodeDXT5AlphaBlock(pnDestination + 8, nValues, sJob.nQuality);
+					break;
+
+				case CompressionNone:
+				default:
+					break;
+			}
+			pnDestination += sJob.nBytesPerBlock;
+		}
+	}
+}
+
+/**
+*  @brief
+*    Static thread function
+*/
+static int CompressionThreadFunction(void *pData)
+{
+	CompressRows(*static_cast<const CompressionJob*>(pData));
+	return 0;
+}
+
+
+//[-------------------------------------------------------]
+//[ Public static functions                               ]
+//[-------------------------------------------------------]
+bool BlockCompressor::Compress(ECompression nCompression, ECompressionQuality nQuality, const uint8 *pnSource, uint32 nComponentsPerPixel,
+							   const Vector3i &vSize, uint8 *pnDestination, uint32 nNumOfThreads)
+{
+	// Get the block size and the required number of components
+	uint32 nBytesPerBlock;
+	uint32 nMinComponentsPerPixel;
+	switch (nCompression) {
+		case CompressionDXT1:
+			nBytesPerBlock		   = 8;
+			nMinComponentsPerPixel = 3;
+			break;
+
+		case CompressionDXT3:
+		case CompressionDXT5:
+			nBytesPerBlock		   = 16;
+			nMinComponentsPerPixel = 3;
+			break;
+
+		case CompressionLATC1:
+			nBytesPerBlock		   = 8;
+			nMinComponentsPerPixel = 1;
+			break;
+
+		case CompressionLATC2:
+			nBytesPerBlock		   = 16;
+			nMinComponentsPerPixel = 2;
+			break;
+
+		case CompressionNone:
+		default:
+			// Error!
+			return false;
+	}
+
+	// Check the parameters
+	if (!pnSource || !pnDestination || nComponentsPerPixel < nMinComponentsPerPixel || nComponentsPerPixel > 4 || vSize.x <= 0 || vSize.y <= 0 || vSize.z <= 0)
+		return false; // Error!
+
+	// Setup the job
+	CompressionJob sJob;
+	sJob.nCompression		 = nCompression;
+	sJob.nQuality			 = nQuality;
+	sJob.pnSource			 = pnSource;
+	sJob.nComponentsPerPixel = nComponentsPerPixel;
+	sJob.nWidth				 = vSize.x;
+	sJob.nHeight			 = vSize.y;
+	sJob.nBlocksX			 = (vSize.x + 3)/4;
+	sJob.nBlocksY			 = (vSize.y + 3)/4;
+	sJob.nBytesPerBlock		 = nBytesPerBlock;
+	sJob.pnDestination		 = pnDestination;
+	const uint32 nNumOfRows	 = sJob.nBlocksY*vSize.z;
+
+	// Get the number of threads to use
+	if (!nNumOfThreads)
+		nNumOfThreads = System::GetInstance()->GetNumOfProcessors();
+	nNumOfThreads = Math::Min(nNumOfThreads, Math::Max(static_cast<uint32>(1), (nNumOfRows*sJob.nBlocksX)/MinBlocksPerThread));
+	nNumOfThreads = Math::Min(nNumOfThreads, nNumOfRows);
+
+	if (nNumOfThreads <= 1) {
+		// Do all the work right now
+		sJob.nFirstRow  = 0;
+		sJob.nNumOfRows = nNumOfRows;
+		CompressRows(sJob);
+	} else {
+		// Give each thread a contiguous block of block rows
+		CompressionJob *pJobs	 = new CompressionJob[nNumOfThreads];
+		Thread		  **ppThreads = new Thread*[nNumOfThreads];
+		for (uint32 i=0; i<nNumOfThreads; i++) {
+			pJobs[i] = sJob;
+			pJobs[i].nFirstRow  = static_cast<uint32>((static_cast<uint64>(nNumOfRows)*i)/nNumOfThreads);
+			pJobs[i].nNumOfRows = static_cast<uint32>((static_cast<uint64>(nNumOfRows)*(i + 1))/nNumOfThreads) - pJobs[i].nFirstRow;
+		}
+
+		// Start the worker threads, the calling thread processes the first block itself
+		for (uint32 i=1; i<nNumOfThreads; i++) {
+			ppThreads[i] = new Thread(CompressionThreadFunction, &pJobs[i]);
+			if (!ppThreads[i]->Start()) {
+				// Thread creation failed, do the work within the calling thread instead
+				delete ppThreads[i];
+				ppThreads[i] = nullptr;
+				CompressRows(pJobs[i]);
+			}
+		}
+		CompressRows(pJobs[0]);
+
+		// Wait for the worker threads
+		for (uint32 i=1; i<nNumOfThreads; i++) {
+			if (ppThreads[i]) {
+				ppThreads[i]->Join();
+				delete ppThreads[i];
+			}
+		}
+
+		// Cleanup
+		delete [] ppThreads;
+		delete [] pJobs;
+	}
+
+	// Done
+	return true;
+}
+
+uint32 BlockCompressor::EncodeDXTColorBlock(uint8 *pnDestination, const uint8 *pnRGBA, ECompressionQuality nQuality)
+{
+	// Get the block colors
+	ColorBlock sBlock;
+	bool bSingleColor = true;
+	for (int i=0; i<16; i++) {
+		sBlock.fR[i] = static_cast<float>(pnRGBA[i*4]);
+		sBlock.fG[i] = static_cast<float>(pnRGBA[i*4 + 1]);
+		sBlock.fB[i] = static_cast<float>(pnRGBA[i*4 + 2]);
+		if (pnRGBA[i*4] != pnRGBA[0] || pnRGBA[i*4 + 1] != pnRGBA[1] || pnRGBA[i*4 + 2] != pnRGBA[2])
+			bSingleColor = false;
+	}
+
+	// A single color is encoded best by interpolating two endpoints, the tables know which ones
+	if (bSingleColor) {
+		return EncodeColorEndpoints(pnDestination, sBlock, (SingleColor5[pnRGBA[0]][0] << 11) | (SingleColor6[pnRGBA[1]][0] << 5) | SingleColor5[pnRGBA[2]][0],
+																 (SingleColor5[pnRGBA[0]][1] << 11) | (SingleColor6[pnRGBA[1]][1] << 5) | SingleColor5[pnRGBA[2]][1]);
+	}
+
+	// Range fit: The endpoints are the extremes of the pixels projected onto the principal axis
+	float fMean[3], fAxis[3];
+	ComputePrincipalAxis(sBlock, fMean, fAxis);
+	float fMinimum = 1e30f, fMaximum = -1e30f;
+	for (int i=0; i<16; i++) {
+		const float fValue = (sBlock.fR[i] - fMean[0])*fAxis[0] + (sBlock.fG[i] - fMean[1])*fAxis[1] + (sBlock.fB[i] - fMean[2])*fAxis[2];
+		fMinimum = Math::Min(fMinimum, fValue);
+		fMaximum = Math::Max(fMaximum, fValue);
+	}
+	uint8 nBest[8];
+	uint32 nBestError = EncodeColorEndpoints(nBest, sBlock, QuantizeColor(fMean[0] + fAxis[0]*fMaximum, fMean[1] + fAxis[1]*fMaximum, fMean[2] + fAxis[2]*fMaximum),
+															 QuantizeColor(fMean[0] + fAxis[0]*fMinimum, fMean[1] + fAxis[1]*fMinimum, fMean[2] + fAxis[2]*fMinimum));
+	if (nBestError)
+		RefineColorBlock(nBest, nBestError, sBlock);
+
+	// Cluster fit
+	if (nQuality == CompressionQualityHigh && nBestError) {
+		uint32 nColor0, nColor1;
+		ClusterFit(sBlock, fAxis, nColor0, nColor1);
+		uint8 nCandidate[8];
+		uint32 nCandidateError = EncodeColorEndpoints(nCandidate, sBlock, nColor0, nColor1);
+		if (nCandidateError)
+			RefineColorBlock(nCandidate, nCandidateError, sBlock);
+		if (nCandidateError < nBestError) {
+			MemoryManager::Copy(nBest, nCandidate, 8);
+			nBestError = nCandidateError;
+		}
+	}
+
+	// Done
+	MemoryManager::Copy(pnDestination, nBest, 8);
+	return nBestError;
+}
+
+void BlockCompressor::EncodeDXT3AlphaBlock(uint8 *pnDestination, const uint8 *pnValues)
+{
+	// 4 bit per value, the decoder multiplies by 17
+	for (int y=0; y<4; y++) {
+		uint32 nRow = 0;
+		for (int x=0; x<4; x++)
+			nRow |= ((pnValues[y*4 + x] + 8)/17) << (4*x);
+		pnDestination[y*2]	   = static_cast<uint8>(nRow & 0xFF);
+		pnDestination[y*2 + 1] = static_cast<uint8>(nRow >> 8);
+	}
+}
+
+uint32 BlockCompressor::EncodeDXT5AlphaBlock(uint8 *pnDestination, const uint8 *pnValues, ECompressionQuality nQuality)
+{
+	// Get the value range
+	uint32 nMinimum = 255, nMaximum = 0;
+	for (int i=0; i<16; i++) {
+		nMinimum = Math::Min(nMinimum, static_cast<uint32>(pnValues[i]));
+		nMaximum = Math::Max(nMaximum, static_cast<uint32>(pnValues[i]));
+	}
+
+	// Eight value mode spanning the value range (a single value results in the six value mode with equal endpoints, which is exact as well)
+	uint8 nBest[8];
+	uint8 nBestIndices[16];
+	uint32 nBestError = EncodeAlphaEndpoints(nBest, pnValues, nMaximum, nMinimum, nBestIndices);
+
+	if (nQuality == CompressionQualityHigh && nBestError) {
+		uint8 nCandidate[8];
+		uint8 nCandidateIndices[16];
+
+		// Least squares refinement of the eight value mode endpoints
+		for (int nPass=0; nPass<2 && nBest[0] > nBest[1]; nPass++) {
+			float fAlphaAlpha = 0.0f, fBetaBeta = 0.0f, fAlphaBeta = 0.0f, fAlphaX = 0.0f, fBetaX = 0.0f;
+			for (int i=0; i<16; i++) {
+				const float fAlpha = AlphaAlpha[nBestIndices[i]];
+				const float fBeta  = 1.0f - fAlpha;
+				fAlphaAlpha += fAlpha*fAlpha;
+				fBetaBeta   += fBeta*fBeta;
+				fAlphaBeta  += fAlpha*fBeta;
+				fAlphaX     += fAlpha*pnValues[i];
+				fBetaX      += fBeta*pnValues[i];
+			}
+			const float fDeterminant = fAlphaAlpha*fBetaBeta - fAlphaBeta*fAlphaBeta;
+			if (fDeterminant < 0.0001f)
+				break; // All values are using the same endpoint weight
+			const int nAlpha0 = Math::Min(Math::Max(static_cast<int>((fBetaBeta*fAlphaX   - fAlphaBeta*fBetaX)/fDeterminant  + 0.5f), 0), 255);
+			const int nAlpha1 = Math::Min(Math::Max(static_cast<int>((fAlphaAlpha*fBetaX - fAlphaBeta*fAlphaX)/fDeterminant + 0.5f), 0), 255);
+			if (nAlpha0 == nAlpha1)
+				break; // Would switch to the six value mode
+			const uint32 nCandidateError = EncodeAlphaEndpoints(nCandidate, pnValues, Math::Max(nAlpha0, nAlpha1), Math::Min(nAlpha0, nAlpha1), nCandidateIndices);
+			if (nCandidateError >= nBestError)
+				break;
+			MemoryManager::Copy(nBest, nCandidate, 8);
+			MemoryManager::Copy(nBestIndices, nCandidateIndices, 16);
+			nBestError = nCandidateError;
+		}
+
+		// Six value mode, 0 and 255 are explicit palette entries so the endpoints only have to span the values in between
+		uint32 nInnerMinimum = 255, nInnerMaximum = 0;
+		for (int i=0; i<16; i++) {
+			if (pnValues[i] && pnValues[i] != 255) {
+				nInnerMinimum = Math::Min(nInnerMinimum, static_cast<uint32>(pnValues[i]));
+				nInnerMaximum = Math::Max(nInnerMaximum, static_cast<uint32>(pnValues[i]));
+			}
+		}
+		if (nInnerMinimum > nInnerMaximum)
+			nInnerMinimum = nInnerMaximum = 0;
+		const uint32 nCandidateError = EncodeAlphaEndpoints(nCandidate, pnValues, nInnerMinimum, nInnerMaximum, nCandidateIndices);
+		if (nCandidateError < nBestError) {
+			MemoryManager::Copy(nBest, nCandidate, 8);
+			nBestError = nCandidateError;
+		}
+	}
+
+	// Done
+	MemoryManager::Copy(pnDestination, nBest, 8);
+	return nBestError;
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // PLGraphics
@@ -25,6 +25,7 @@
 //[-------------------------------------------------------]
 //[ Includes                                              ]
 //[-------------------------------------------------------]
+#include <PLMath/Half.h>
 #include "PLGraphics/Image/ImageBuffer.h"
 #include "PLGraphics/Image/ImageEffects.h"
 #include "PLGraphics/Image/Effects/IEConvert.h"
@@ -34,6 +35,7 @@
 //[ Namespace                                             ]
 //[-------------------------------------------------------]
 using namespace PLCore;
+using namespace PLMath;
 namespace PLGraphics {
 
 
@@ -624,9 +626,18 @@ bool IEConvert::Apply(ImageBuffer &cImageBuffer) const
 			ImageEffects::RemovePalette().Apply(cImageBuffer);
 		}
 
-		// Create the new image buffer
-		const ImageBuffer cOldImageBuffer = cImageBuffer;
-		cImageBuffer.CreateImage(m_nDataFormat, m_nColorFormat, cOldImageBuffer.GetSize());
+		// Half data is converted into float data at once, the generic conversion below works with the float data
+		ImageBuffer cOldImageBuffer = cImageBuffer;
+		if (cOldImageBuffer.GetDataFormat() == DataHalf) {
+			ImageBuffer cFloatImageBuffer;
+			cFloatImageBuffer.CreateImage(DataFloat, cOldImageBuffer.GetColorFormat(), cOldImageBuffer.GetSize());
+			Half::ToFloatArray(reinterpret_cast<const uint16*>(cOldImageBuffer.GetData()), reinterpret_cast<float*>(cFloatImageBuffer.GetData()),
+							   cOldImageBuffer.GetNumOfPixels()*cOldImageBuffer.GetComponentsPerPixel());
+			cOldImageBuffer = cFloatImageBuffer;
+		}
+
+		// Create the new image buffer (half data is created as float data and converted at once when we're done)
+		cImageBuffer.CreateImage((m_nDataFormat == DataHalf) ? DataFloat : m_nDataFormat, m_nColorFormat, cOldImageBuffer.GetSize());
 
 		// Convert old data format dependent
 		switch (cOldImageBuffer.GetDataFormat()) {
@@ -651,7 +662,7 @@ bool IEConvert::Apply(ImageBuffer &cImageBuffer) const
 					//   DataByte      Source (old data format)
 					case DataHalf: // Destination (new data format)
 					{
-						// [TODO] DataHalf - Implement me
+						// Not reached, the float data is converted into half data below
 						break;
 					}
 
@@ -692,7 +703,7 @@ bool IEConvert::Apply(ImageBuffer &cImageBuffer) const
 					//   DataWord      Source (old data format)
 					case DataHalf: // Destination (new data format)
 					{
-						// [TODO] DataHalf - Implement me
+						// Not reached, the float data is converted into half data below
 						break;
 					}
 
@@ -714,7 +725,7 @@ bool IEConvert::Apply(ImageBuffer &cImageBuffer) const
 
 			// Source
 			case DataHalf:
-				// [TODO] DataHalf - Implement me
+				// Not reached, the half data was converted into float data above
 				break;
 
 			// Source
@@ -738,7 +749,7 @@ bool IEConvert::Apply(ImageBuffer &cImageBuffer) const
 					//   DataFloat     Source (old data format)
 					case DataHalf: // Destination (new data format)
 					{
-						// [TODO] DataHalf - Implement me
+						// Not reached, the float data is converted into half data below
 						break;
 					}
 
@@ -779,7 +790,7 @@ bool IEConvert::Apply(ImageBuffer &cImageBuffer) const
 					//   DataDouble    Source (old data format)
 					case DataHalf: // Destination (new data format)
 					{
-						// [TODO] DataHalf - Implement me
+						// Not reached, the float data is converted into half data below
 						break;
 					}
 
@@ -799,6 +810,14 @@ bool IEConvert::Apply(ImageBuffer &cImageBuffer) const
 				}
 				break;
 		}
+
+		// Convert the float data into the requested half data at once
+		if (m_nDataFormat == DataHalf) {
+			const ImageBuffer cFloatImageBuffer = cImageBuffer;
+			cImageBuffer.CreateImage(DataHalf, m_nColorFormat, cFloatImageBuffer.GetSize());
+			Half::FromFloatArray(reinterpret_cast<const float*>(cFloatImageBuffer.GetData()), reinterpret_cast<uint16*>(cImageBuffer.GetData()),
+								 cImageBuffer.GetNumOfPixels()*cImageBuffer.GetComponentsPerPixel());
+		}
 	}
 
 	// Done
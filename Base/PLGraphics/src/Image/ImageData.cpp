@@ -29,6 +29,7 @@
 #include "PLGraphics/Image/ImagePalette.h"
 #include "PLGraphics/Image/ImageBuffer.h"
 #include "PLGraphics/Image/ImageData.h"
+#include "PLGraphics/Image/BlockCompressor.h"
 
 
 //[-------------------------------------------------------]
@@ -352,13 +353,19 @@ uint8 *ImageData::GetCompressedData()
 *  @brief
 *    Compress image data
 */
-bool ImageData::Compress()
+bool ImageData::Compress(ECompressionQuality nQuality)
 {
 	// Make sure that both buffers are created
 	CreateBuffer();
 	CreateCompressedBuffer();
 
-	// [TODO] Implement
+	// The supported compression formats only support byte
+	if (m_pData && m_pCompressedData && m_nDataFormat == DataByte) {
+		// Compress
+		return BlockCompressor::Compress(m_nCompression, nQuality, m_pData, ImageBuffer::GetComponentsPerPixel(m_nColorFormat), m_vSize, m_pCompressedData);
+	}
+
+	// Error!
 	return false;
 }
 
@@ -666,13 +673,14 @@ void ImageData::DecodeDXTColorBlock(uint8 *pnDestination, const uint8 *pnSource,
 
 	uint8 nColors[4][3];
 
-	nColors[0][0] = ((c0 >> 11) & 0x1F) << 3;
-	nColors[0][1] = ((c0 >>  5) & 0x3F) << 2;
-	nColors[0][2] =  (c0        & 0x1F) << 3;
+	// Expand the 5:6:5 colors by replicating the high bits into the low bits, just as the GPU does (white has to stay white)
+	nColors[0][0] = static_cast<uint8>((((c0 >> 11) & 0x1F) << 3) | ((c0 >> 13) & 0x07));
+	nColors[0][1] = static_cast<uint8>((((c0 >>  5) & 0x3F) << 2) | ((c0 >>  9) & 0x03));
+	nColors[0][2] = static_cast<uint8>((( c0        & 0x1F) << 3) | ((c0 >>  2) & 0x07));
 
-	nColors[1][0] = ((c1 >> 11) & 0x1F) << 3;
-	nColors[1][1] = ((c1 >>  5) & 0x3F) << 2;
-	nColors[1][2] =  (c1        & 0x1F) << 3;
+	nColors[1][0] = static_cast<uint8>((((c1 >> 11) & 0x1F) << 3) | ((c1 >> 13) & 0x07));
+	nColors[1][1] = static_cast<uint8>((((c1 >>  5) & 0x3F) << 2) | ((c1 >>  9) & 0x03));
+	nColors[1][2] = static_cast<uint8>((( c1        & 0x1F) << 3) | ((c1 >>  2) & 0x07));
 
 	if (c0 > c1 || nCompression == CompressionDXT5) {
 		for (int i=0; i<3; i++) {
@@ -181,6 +181,41 @@ class Half {
 		*/
 		static PLMATH_API PLCore::uint16 FromFloat(float fFloat);
 
+		/**
+		*  @brief
+		*    Converts an array of half values into float values
+		*
+		*  @param[in]  pnSource
+		*    Half values to convert, must be valid and must have at least "nCount" elements
+		*  @param[out] pfDestination
+		*    Receives the float values, must be valid and must have at least "nCount" elements
+		*  @param[in]  nCount
+		*    Number of values to convert
+		*
+		*  @note
+		*    - Uses F16C if the CPU supports it, else SSE2, else ToFloat() for each value
+		*    - The result is bit exact to ToFloat(), except that F16C sets the quiet bit of signaling NANs
+		*/
+		static PLMATH_API void ToFloatArray(const PLCore::uint16 *pnSource, float *pfDestination, PLCore::uint32 nCount);
+
+		/**
+		*  @brief
+		*    Converts an array of float values into half values
+		*
+		*  @param[in]  pfSource
+		*    Float values to convert, must be valid and must have at least "nCount" elements
+		*  @param[out] pnDestination
+		*    Receives the half values, must be valid and must have at least "nCount" elements
+		*  @param[in]  nCount
+		*    Number of values to convert
+		*
+		*  @note
+		*    - Uses F16C if the CPU supports it, else SSE2, else FromFloat() for each value
+		*    - Rounds to the nearest even value, the result is bit exact to FromFloat() except for the
+		*      mantissa bits of NANs when using F16C (not a number stays not a number)
+		*/
+		static PLMATH_API void FromFloatArray(const float *pfSource, PLCore::uint16 *pnDestination, PLCore::uint32 nCount);
+
 
 };
 
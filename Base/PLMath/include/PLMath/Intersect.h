@@ -695,6 +695,31 @@ class Intersect {
 		*/
 		static PLMATH_API bool PlaneSetAABox(const PlaneSet &cPlaneSet, const Vector3 &vMin, const Vector3 &vMax, PLCore::uint32 *pnOutClipMask = nullptr);
 
+		/**
+		*  @brief
+		*    Tests whether an axis aligned box is within the plane set or not, only tests the given planes
+		*
+		*  @param[in]  cPlaneSet
+		*    Plane set to check
+		*  @param[in]  vMin
+		*    Minimum position
+		*  @param[in]  vMax
+		*    Maximum position
+		*  @param[in]  nPlaneMask
+		*    Mask of the planes to test (bit i for plane i, a maximum number of 32 planes)
+		*  @param[out] nOutPlaneMask
+		*    Receives the planes of "nPlaneMask" the box is intersecting, 0 if the box is completely inside
+		*
+		*  @return
+		*    'true' if the axis aligned box is within plane set, else 'false' (in this case "nOutPlaneMask" is not touched)
+		*
+		*  @remarks
+		*    Use this function for hierarchical culling: If a bounding box is completely in front of a plane,
+		*    all boxes within this bounding box are too, so this plane must not be tested again for them.
+		*    Pass the mask received for a node as plane mask when testing the children of this node.
+		*/
+		static PLMATH_API bool PlaneSetAABox(const PlaneSet &cPlaneSet, const Vector3 &vMin, const Vector3 &vMax, PLCore::uint32 nPlaneMask, PLCore::uint32 &nOutPlaneMask);
+
 		//[-------------------------------------------------------]
 		//[ Triangle                                              ]
 		//[-------------------------------------------------------]
@@ -0,0 +1,534 @@
+/*********************************************************\
+ *  File: LooseOctree.h                                  *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+
+
+#ifndef __PLMATH_LOOSEOCTREE_H__
+#define __PLMATH_LOOSEOCTREE_H__
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <PLCore/Container/Array.h>
+#include "PLMath/AABoundingBox.h"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace PLMath {
+
+
+//[-------------------------------------------------------]
+//[ Forward declarations                                  ]
+//[-------------------------------------------------------]
+class PlaneSet;
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Loose octree over items given by axis aligned bounding boxes
+*
+*  @remarks
+*    Other than "Octree", which is a base class for octrees building themselves recursively, this
+*    octree stores all nodes within one flat array and manages the items by itself. Items are identified
+*    by an user defined index (for example a geometry index) and are stored within the deepest node whose
+*    cell contains the item center and whose cell size is not smaller than the item size. This is a loose
+*    octree with a looseness factor of two, so an item never leaves the doubled cell of its node and an
+*    item can be inserted, removed or moved without rebuilding the octree.
+*
+*    Each node stores the fitted bounding box of all items within its subtree, this bounding box is used
+*    by the queries. When an item is removed, the bounding boxes of the nodes above are kept (they are still
+*    conservative) until the subtree becomes empty.
+*
+*    Build() computes a 30 bit Morton code for each item center, sorts the items by this code and creates
+*    the nodes top-down from the sorted ranges. The subtrees of the eight root children are build in parallel.
+*
+*  @note
+*    - The queries are filling caller provided index arrays and are not changing the octree, so multiple
+*      threads can query the same octree at the same time
+*/
+class LooseOctree {
+
+
+	//[-------------------------------------------------------]
+	//[ Public definitions                                    ]
+	//[-------------------------------------------------------]
+	public:
+		static const PLCore::uint32 MaxLevel = 10;			/**< Maximum node level, the root has level 0 (10 bits per Morton code axis) */
+		static const PLCore::uint32 Invalid  = 0xFFFFFFFF;	/**< Invalid node or item index */
+
+
+	//[-------------------------------------------------------]
+	//[ Public functions                                      ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Constructor
+		*/
+		PLMATH_API LooseOctree();
+
+		/**
+		*  @brief
+		*    Destructor
+		*/
+		PLMATH_API ~LooseOctree();
+
+		/**
+		*  @brief
+		*    Initializes an empty octree
+		*
+		*  @param[in] cBox
+		*    Region of the octree, the root cell is the cube enclosing this box
+		*  @param[in] nMaxItemsPerNode
+		*    Maximum number of items within a leaf node before the node is split (at least 1)
+		*
+		*  @note
+		*    - Use this function if the octree should be filled by using Insert(), items outside
+		*      the region are supported but are stored within the root node
+		*/
+		PLMATH_API void Init(const AABoundingBox &cBox, PLCore::uint32 nMaxItemsPerNode = 16);
+
+		/**
+		*  @brief
+		*    Builds the octree from scratch
+		*
+		*  @param[in] pcBoxes
+		*    Bounding boxes of the items, the item index is the index within this array, can be a null pointer if "nNumOfItems" is 0
+		*  @param[in] nNumOfItems
+		*    Number of items
+		*  @param[in] nMaxItemsPerNode
+		*    Maximum number of items within a leaf node (at least 1)
+		*  @param[in] nNumOfThreads
+		*    Maximum number of threads to use, 0 for one thread per processor (there are never more than eight threads, one per root child)
+		*
+		*  @remarks
+		*    The region of the octree is the bounding box of all items.
+		*/
+		PLMATH_API void Build(const AABoundingBox *pcBoxes, PLCore::uint32 nNumOfItems, PLCore::uint32 nMaxItemsPerNode = 16, PLCore::uint32 nNumOfThreads = 0);
+
+		/**
+		*  @brief
+		*    Destroys all nodes and items
+		*/
+		PLMATH_API void Clear();
+
+		/**
+		*  @brief
+		*    Returns the number of items within the octree
+		*
+		*  @return
+		*    Number of items within the octree
+		*/
+		inline PLCore::uint32 GetNumOfItems() const;
+
+		/**
+		*  @brief
+		*    Returns the number of nodes
+		*
+		*  @return
+		*    Number of nodes, 0 if the octree is not initialized
+		*/
+		inline PLCore::uint32 GetNumOfNodes() const;
+
+		/**
+		*  @brief
+		*    Returns the bounding box of all items within the octree
+		*
+		*  @return
+		*    Bounding box of all items (conservative after removals), minimum > maximum if there are no items
+		*/
+		PLMATH_API AABoundingBox GetBoundingBox() const;
+
+		/**
+		*  @brief
+		*    Returns whether or not an item is within the octree
+		*
+		*  @param[in] nItem
+		*    Item index
+		*
+		*  @return
+		*    'true' if the item is within the octree, else 'false'
+		*/
+		inline bool HasItem(PLCore::uint32 nItem) const;
+
+		/**
+		*  @brief
+		*    Inserts an item
+		*
+		*  @param[in] nItem
+		*    Item index, must not be "Invalid"
+		*  @param[in] cBox
+		*    Bounding box of the item
+		*
+		*  @return
+		*    'true' if all went fine, else 'false' (octree not initialized or item already within the octree)
+		*/
+		PLMATH_API bool Insert(PLCore::uint32 nItem, const AABoundingBox &cBox);
+
+		/**
+		*  @brief
+		*    Removes an item
+		*
+		*  @param[in] nItem
+		*    Item index
+		*
+		*  @return
+		*    'true' if all went fine, else 'false' (item is not within the octree)
+		*/
+		PLMATH_API bool Remove(PLCore::uint32 nItem);
+
+		/**
+		*  @brief
+		*    Updates the bounding box of an item
+		*
+		*  @param[in] nItem
+		*    Item index
+		*  @param[in] cBox
+		*    New bounding box of the item
+		*
+		*  @return
+		*    'true' if all went fine, else 'false' (item is not within the octree)
+		*
+		*  @remarks
+		*    If the item still fits into its node only the node bounding boxes are updated, else
+		*    the item is moved to another node.
+		*/
+		PLMATH_API bool Update(PLCore::uint32 nItem, const AABoundingBox &cBox);
+
+		/**
+		*  @brief
+		*    Returns the items intersecting a plane set (for example a view frustum)
+		*
+		*  @param[in]  cPlaneSet
+		*    Plane set to check, an item is inside if it's in front of all planes (maximum 32 planes)
+		*  @param[out] pnItems
+		*    Receives the item indices, must have at least "nMaxItems" elements
+		*  @param[in]  nMaxItems
+		*    Maximum number of item indices to write
+		*
+		*  @return
+		*    Number of written item indices, if this is "nMaxItems" there may be more intersecting items
+		*
+		*  @remarks
+		*    Planes a node is completely in front of are not tested again for the children and items
+		*    of this node, if a node is completely inside all items of its subtree are returned
+		*    without any further tests.
+		*/
+		PLMATH_API PLCore::uint32 GetItems(const PlaneSet &cPlaneSet, PLCore::uint32 *pnItems, PLCore::uint32 nMaxItems) const;
+
+		/**
+		*  @brief
+		*    Returns the items intersecting a ray
+		*
+		*  @param[in]  vRayOrigin
+		*    Ray origin
+		*  @param[in]  vRayDirection
+		*    Ray direction (must not be normalized)
+		*  @param[out] pnItems
+		*    Receives the item indices, must have at least "nMaxItems" elements
+		*  @param[in]  nMaxItems
+		*    Maximum number of item indices to write
+		*  @param[in]  fMaxDistance
+		*    Maximum distance along the ray in units of the ray direction length, there's no limit if negative
+		*
+		*  @return
+		*    Number of written item indices, if this is "nMaxItems" there may be more intersecting items
+		*
+		*  @note
+		*    - The items are not sorted by their distance
+		*/
+		PLMATH_API PLCore::uint32 GetItems(const Vector3 &vRayOrigin, const Vector3 &vRayDirection, PLCore::uint32 *pnItems, PLCore::uint32 nMaxItems, float fMaxDistance = -1.0f) const;
+
+
+	//[-------------------------------------------------------]
+	//[ Private definitions                                   ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Octree node
+		*/
+		struct Node {
+			Vector3		   vMin;				/**< Minimum of the fitted bounding box of all items within the subtree */
+			Vector3		   vMax;				/**< Maximum of the fitted bounding box of all items within the subtree */
+			PLCore::uint32 nChild[8];			/**< Child node indices, "Invalid" if there's no such child */
+			PLCore::uint32 nParent;				/**< Parent node index, "Invalid" for the root */
+			PLCore::uint32 nLevel;				/**< Node level, 0 for the root */
+			PLCore::uint32 nCode;				/**< Morton code of the node cell (the upper 3*level bits of the item codes) */
+			PLCore::uint32 nFirstItem;			/**< First item of the list of items directly within this node, "Invalid" if there's no item */
+			PLCore::uint32 nNumOfItems;			/**< Number of items directly within this node */
+			PLCore::uint32 nNumOfSubtreeItems;	/**< Number of items within the subtree */
+			bool		   bLeaf;				/**< 'true' if new items are stored within this node instead of within children as long as there's space left */
+			bool operator ==(const Node &sNode) const
+			{
+				return (nParent == sNode.nParent && nCode == sNode.nCode && nLevel == sNode.nLevel);
+			}
+		};
+
+		/**
+		*  @brief
+		*    Octree item
+		*/
+		struct Item {
+			Vector3		   vMin;	/**< Bounding box minimum */
+			Vector3		   vMax;	/**< Bounding box maximum */
+			PLCore::uint32 nCode;	/**< Morton code of the bounding box center */
+			PLCore::uint32 nLevel;	/**< Deepest node level the item fits into */
+			PLCore::uint32 nNode;	/**< Node the item is stored in, "Invalid" if the item is not within the octree */
+			PLCore::uint32 nPrev;	/**< Previous item within the node item list, "Invalid" if none */
+			PLCore::uint32 nNext;	/**< Next item within the node item list, "Invalid" if none */
+			bool operator ==(const Item &sItem) const
+			{
+				return (nNode == sItem.nNode && nPrev == sItem.nPrev && nNext == sItem.nNext);
+			}
+		};
+
+		/**
+		*  @brief
+		*    Subtree build job of a worker thread
+		*/
+		struct BuildJob;
+
+
+	//[-------------------------------------------------------]
+	//[ Private functions                                     ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Copy constructor
+		*
+		*  @param[in] cSource
+		*    Source to copy from
+		*/
+		LooseOctree(const LooseOctree &cSource);
+
+		/**
+		*  @brief
+		*    Copy operator
+		*
+		*  @param[in] cSource
+		*    Source to copy from
+		*
+		*  @return
+		*    Reference to this instance
+		*/
+		LooseOctree &operator =(const LooseOctree &cSource);
+
+		/**
+		*  @brief
+		*    Static thread function building the subtrees of a chain of build jobs
+		*
+		*  @param[in] pData
+		*    First build job, must be valid
+		*
+		*  @return
+		*    Always 0
+		*/
+		static int BuildThreadFunction(void *pData);
+
+		/**
+		*  @brief
+		*    Calculates the Morton code and the level of an item
+		*
+		*  @param[in, out] sItem
+		*    Item with valid bounding box, receives the Morton code and level
+		*/
+		void ClassifyItem(Item &sItem) const;
+
+		/**
+		*  @brief
+		*    Adds a node
+		*
+		*  @param[in, out] lstNodes
+		*    Node list to add the node to
+		*  @param[in]      nParent
+		*    Parent node index, "Invalid" for the root
+		*  @param[in]      nLevel
+		*    Node level
+		*  @param[in]      nCode
+		*    Morton code of the node cell
+		*
+		*  @return
+		*    Index of the new node
+		*/
+		static PLCore::uint32 AddNode(PLCore::Array<Node> &lstNodes, PLCore::uint32 nParent, PLCore::uint32 nLevel, PLCore::uint32 nCode);
+
+		/**
+		*  @brief
+		*    Links an item into the item list of a node and grows the bounding box of the node
+		*
+		*  @note
+		*    - The number of subtree items is not touched
+		*
+		*  @param[in, out] lstNodes
+		*    Node list
+		*  @param[in]      nNode
+		*    Node index
+		*  @param[in]      nItem
+		*    Item index
+		*/
+		void LinkItem(PLCore::Array<Node> &lstNodes, PLCore::uint32 nNode, PLCore::uint32 nItem);
+
+		/**
+		*  @brief
+		*    Unlinks an item from the item list of its node
+		*
+		*  @note
+		*    - The number of subtree items and the bounding boxes are not touched
+		*
+		*  @param[in] nItem
+		*    Item index
+		*/
+		void UnlinkItem(PLCore::uint32 nItem);
+
+		/**
+		*  @brief
+		*    Links the items of a sorted item range which are staying within a node
+		*
+		*  @param[in, out] lstNodes
+		*    Node list
+		*  @param[in]      nNode
+		*    Node index
+		*  @param[in]      pnSorted
+		*    Item indices sorted by their Morton code
+		*  @param[in]      nFirst
+		*    First item within "pnSorted"
+		*  @param[in]      nLast
+		*    One behind the last item within "pnSorted"
+		*
+		*  @return
+		*    'true' if the node gets children for the remaining items, else 'false'
+		*/
+		bool LinkNodeItems(PLCore::Array<Node> &lstNodes, PLCore::uint32 nNode, const PLCore::uint32 *pnSorted, PLCore::uint32 nFirst, PLCore::uint32 nLast);
+
+		/**
+		*  @brief
+		*    Builds a subtree from a range of items sorted by their Morton code
+		*
+		*  @param[in, out] lstNodes
+		*    Node list to add the nodes to
+		*  @param[in]      nNode
+		*    Node index of the subtree root, must already be within the node list
+		*  @param[in]      pnSorted
+		*    Item indices sorted by their Morton code
+		*  @param[in]      nFirst
+		*    First item within "pnSorted"
+		*  @param[in]      nLast
+		*    One behind the last item within "pnSorted"
+		*
+		*  @remarks
+		*    Items with a level below the node level must already be linked to the nodes above.
+		*/
+		void BuildNode(PLCore::Array<Node> &lstNodes, PLCore::uint32 nNode, const PLCore::uint32 *pnSorted, PLCore::uint32 nFirst, PLCore::uint32 nLast);
+
+		/**
+		*  @brief
+		*    Splits the items of a node range into the ranges of the eight child cells
+		*
+		*  @param[in]  pnSorted
+		*    Item indices sorted by their Morton code
+		*  @param[in]  nFirst
+		*    First item within "pnSorted"
+		*  @param[in]  nLast
+		*    One behind the last item within "pnSorted"
+		*  @param[in]  nLevel
+		*    Node level
+		*  @param[out] nChildFirst
+		*    Receives the first item of each child range, the range of the last child ends at "nLast"
+		*/
+		void SplitRange(const PLCore::uint32 *pnSorted, PLCore::uint32 nFirst, PLCore::uint32 nLast, PLCore::uint32 nLevel, PLCore::uint32 nChildFirst[9]) const;
+
+		/**
+		*  @brief
+		*    Splits a leaf node by moving its items into child nodes where possible
+		*
+		*  @param[in] nNode
+		*    Node index
+		*/
+		void SplitLeaf(PLCore::uint32 nNode);
+
+		/**
+		*  @brief
+		*    Returns the node an item should be inserted into, creates or splits nodes if required
+		*
+		*  @param[in] nItem
+		*    Classified item index
+		*
+		*  @return
+		*    Node index
+		*/
+		PLCore::uint32 FindInsertNode(PLCore::uint32 nItem);
+
+		/**
+		*  @brief
+		*    Adds all items of a subtree
+		*
+		*  @param[in]      nNode
+		*    Node index
+		*  @param[out]     pnItems
+		*    Receives the item indices
+		*  @param[in, out] nNumOfItems
+		*    Current number of written item indices
+		*  @param[in]      nMaxItems
+		*    Maximum number of item indices to write
+		*/
+		void AddSubtreeItems(PLCore::uint32 nNode, PLCore::uint32 *pnItems, PLCore::uint32 &nNumOfItems, PLCore::uint32 nMaxItems) const;
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		Vector3				 m_vOrigin;				/**< Minimum of the root cell */
+		float				 m_fSize;				/**< Edge length of the root cell, 0 if the octree is not initialized */
+		PLCore::uint32		 m_nMaxItemsPerNode;	/**< Maximum number of items within a leaf node */
+		PLCore::uint32		 m_nNumOfItems;			/**< Number of items within the octree */
+		PLCore::Array<Node>  m_lstNodes;			/**< Nodes, the first one is the root */
+		PLCore::Array<Item>  m_lstItems;			/**< Items, the array index is the item index */
+
+
+};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // PLMath
+
+
+//[-------------------------------------------------------]
+//[ Implementation                                        ]
+//[-------------------------------------------------------]
+#include "PLMath/LooseOctree.inl"
+
+
+#endif // __PLMATH_LOOSEOCTREE_H__
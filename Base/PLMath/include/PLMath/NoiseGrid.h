@@ -0,0 +1,195 @@
+/*********************************************************\
+ *  File: NoiseGrid.h                                    *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+#ifndef __PLMATH_NOISEGRID_H__
+#define __PLMATH_NOISEGRID_H__
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "PLMath/PLMath.h"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace PLMath {
+
+
+//[-------------------------------------------------------]
+//[ Forward declarations                                  ]
+//[-------------------------------------------------------]
+class Vector2;
+class Vector3;
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Static class filling whole 2D/3D grids with noise
+*
+*  @remarks
+*    Evaluating "PerlinNoise", "PerlinNoiseTileable" or "PerlinNoiseTurbulence" sample by sample is
+*    slow when generating e.g. a 256x256x256 volume texture. The functions within this class evaluate
+*    the grid row by row using the SIMD row functions of "PerlinNoise" and "SimplexNoise", and split
+*    the rows across multiple threads. The scalar functions remain the reference, results are equal
+*    to them except for the single precision computation.
+*
+*    Grids are stored with x as the fastest changing coordinate, so sample (x, y, z) is located at
+*    "pfDestination[(z*nHeight + y)*nWidth + x]" and is evaluated at "vOrigin + (x, y, z)*vStep".
+*/
+class NoiseGrid {
+
+
+	//[-------------------------------------------------------]
+	//[ Public definitions                                    ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Noise function
+		*/
+		enum ENoise {
+			Perlin  = 0,	/**< Classic Perlin noise (see "PerlinNoise") */
+			Simplex = 1		/**< Simplex noise (see "SimplexNoise") */
+		};
+
+
+	//[-------------------------------------------------------]
+	//[ Public static functions                               ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Fills a 2D grid with noise
+		*
+		*  @param[in]  nNoise
+		*    Noise function to use
+		*  @param[out] pfDestination
+		*    Receives the noise values, must be able to hold at least "nWidth*nHeight" values
+		*  @param[in]  nWidth
+		*    Number of samples along the x axis
+		*  @param[in]  nHeight
+		*    Number of samples along the y axis
+		*  @param[in]  vOrigin
+		*    Position of the first sample
+		*  @param[in]  vStep
+		*    Distance between two samples along each axis
+		*  @param[in]  nNumOfThreads
+		*    Maximum number of threads to use, 0 for one thread per processor
+		*/
+		static PLMATH_API void Noise2(ENoise nNoise, float *pfDestination, PLCore::uint32 nWidth, PLCore::uint32 nHeight, const Vector2 &vOrigin, const Vector2 &vStep, PLCore::uint32 nNumOfThreads = 0);
+
+		/**
+		*  @brief
+		*    Fills a 3D grid with noise
+		*
+		*  @param[in]  nNoise
+		*    Noise function to use
+		*  @param[out] pfDestination
+		*    Receives the noise values, must be able to hold at least "nWidth*nHeight*nDepth" values
+		*  @param[in]  nWidth
+		*    Number of samples along the x axis
+		*  @param[in]  nHeight
+		*    Number of samples along the y axis
+		*  @param[in]  nDepth
+		*    Number of samples along the z axis
+		*  @param[in]  vOrigin
+		*    Position of the first sample
+		*  @param[in]  vStep
+		*    Distance between two samples along each axis
+		*  @param[in]  nNumOfThreads
+		*    Maximum number of threads to use, 0 for one thread per processor
+		*/
+		static PLMATH_API void Noise3(ENoise nNoise, float *pfDestination, PLCore::uint32 nWidth, PLCore::uint32 nHeight, PLCore::uint32 nDepth, const Vector3 &vOrigin, const Vector3 &vStep, PLCore::uint32 nNumOfThreads = 0);
+
+		/**
+		*  @brief
+		*    Fills a 3D grid with a harmonic sum of noise
+		*
+		*  @param[in]  nNoise
+		*    Noise function to use
+		*  @param[out] pfDestination
+		*    Receives the noise values, must be able to hold at least "nWidth*nHeight*nDepth" values
+		*  @param[in]  nWidth
+		*    Number of samples along the x axis
+		*  @param[in]  nHeight
+		*    Number of samples along the y axis
+		*  @param[in]  nDepth
+		*    Number of samples along the z axis
+		*  @param[in]  vOrigin
+		*    Position of the first sample
+		*  @param[in]  vStep
+		*    Distance between two samples along each axis
+		*  @param[in]  fAlpha
+		*    Weight divisor per octave, typically 2, as this approaches 1 the function is noisier
+		*  @param[in]  fBeta
+		*    Frequency multiplier per octave, typically 2
+		*  @param[in]  nNumOfOctaves
+		*    Number of octaves to sum up
+		*  @param[in]  nNumOfThreads
+		*    Maximum number of threads to use, 0 for one thread per processor
+		*
+		*  @remarks
+		*    Each sample receives "sum(i=0..nNumOfOctaves-1) Noise(p*fBeta^i)/fAlpha^i".
+		*/
+		static PLMATH_API void FractalSum3(ENoise nNoise, float *pfDestination, PLCore::uint32 nWidth, PLCore::uint32 nHeight, PLCore::uint32 nDepth, const Vector3 &vOrigin, const Vector3 &vStep,
+										   float fAlpha, float fBeta, PLCore::uint32 nNumOfOctaves, PLCore::uint32 nNumOfThreads = 0);
+
+		/**
+		*  @brief
+		*    Fills a 3D grid with Perlin turbulence
+		*
+		*  @remarks
+		*    Grid version of "PerlinNoiseTurbulence::Turbulence3()", see "Noise3()" for the other parameters.
+		*/
+		static PLMATH_API void Turbulence3(float *pfDestination, PLCore::uint32 nWidth, PLCore::uint32 nHeight, PLCore::uint32 nDepth, const Vector3 &vOrigin, const Vector3 &vStep,
+										   float fFreq, PLCore::uint32 nNumOfThreads = 0);
+
+		/**
+		*  @brief
+		*    Fills a 3D grid with tileable Perlin turbulence
+		*
+		*  @remarks
+		*    Grid version of "PerlinNoiseTurbulence::TileableTurbulence3()", "vSize" is the tile size
+		*    (fW, fH, fD), see "Noise3()" for the other parameters.
+		*/
+		static PLMATH_API void TileableTurbulence3(float *pfDestination, PLCore::uint32 nWidth, PLCore::uint32 nHeight, PLCore::uint32 nDepth, const Vector3 &vOrigin, const Vector3 &vStep,
+												   const Vector3 &vSize, float fFreq, PLCore::uint32 nNumOfThreads = 0);
+
+
+};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // PLMath
+
+
+#endif // __PLMATH_NOISEGRID_H__
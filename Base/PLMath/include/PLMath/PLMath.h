@@ -57,4 +57,14 @@
 #endif
 
 
+//[-------------------------------------------------------]
+//[ SIMD                                                  ]
+//[-------------------------------------------------------]
+// SSE2 is always available on x64 and enabled by our GCC build settings for x86 (see "-msse3" within "LinuxGCC.cmake"),
+// PLMath functions offering batch processing fall back to plain C++ if this is not defined
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+	#define PLMATH_SSE2
+#endif
+
+
 #endif // __PLMATH_PLMATH_H__
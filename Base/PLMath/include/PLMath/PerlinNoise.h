@@ -60,10 +60,67 @@ class PerlinNoise {
 	//[ Public static functions                               ]
 	//[-------------------------------------------------------]
 	public:
+		/**
+		*  @brief
+		*    Initializes the permutation and gradient tables
+		*
+		*  @remarks
+		*    The tables are initialized automatically on first usage. Because the initialization
+		*    is using "rand()" and is not thread-safe, call this method once from the main thread
+		*    before evaluating noise from multiple threads at the same time.
+		*/
+		static PLMATH_API void Init();
+
 		static PLMATH_API double Noise1(double arg);
 		static PLMATH_API double Noise2(const double vec[2]);
 		static PLMATH_API double Noise3(const double vec[3]);
 
+		/**
+		*  @brief
+		*    Evaluates 2D noise for a row of equidistant samples along the x axis
+		*
+		*  @param[out] pfDestination
+		*    Receives the noise values, must be able to hold at least "nCount" values
+		*  @param[in]  nCount
+		*    Number of samples to evaluate
+		*  @param[in]  fX
+		*    X coordinate of the first sample
+		*  @param[in]  fY
+		*    Y coordinate of all samples
+		*  @param[in]  fStepX
+		*    Distance between two samples along the x axis
+		*
+		*  @remarks
+		*    Sample "i" receives the same value as "Noise2(fX + i*fStepX, fY)" except that the
+		*    computation is done in single precision (SSE2 accelerated if available).
+		*
+		*  @note
+		*    - Call "Init()" first when using this method from multiple threads
+		*/
+		static PLMATH_API void Noise2Row(float *pfDestination, PLCore::uint32 nCount, float fX, float fY, float fStepX);
+
+		/**
+		*  @brief
+		*    Evaluates 3D noise for a row of equidistant samples along the x axis
+		*
+		*  @param[out] pfDestination
+		*    Receives the noise values, must be able to hold at least "nCount" values
+		*  @param[in]  nCount
+		*    Number of samples to evaluate
+		*  @param[in]  fX
+		*    X coordinate of the first sample
+		*  @param[in]  fY
+		*    Y coordinate of all samples
+		*  @param[in]  fZ
+		*    Z coordinate of all samples
+		*  @param[in]  fStepX
+		*    Distance between two samples along the x axis
+		*
+		*  @see
+		*    - Noise2Row()
+		*/
+		static PLMATH_API void Noise3Row(float *pfDestination, PLCore::uint32 nCount, float fX, float fY, float fZ, float fStepX);
+
 
 };
 
@@ -0,0 +1,397 @@
+/*********************************************************\
+ *  File: PoseBuffer.h                                   *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+
+
+#ifndef __PLMATH_POSEBUFFER_H__
+#define __PLMATH_POSEBUFFER_H__
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "PLMath/Vector3.h"
+#include "PLMath/Quaternion.h"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace PLMath {
+
+
+//[-------------------------------------------------------]
+//[ Forward declarations                                  ]
+//[-------------------------------------------------------]
+class Matrix3x4;
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Joint pose buffer stored as structure of arrays
+*
+*  @remarks
+*    Each joint pose consists of a position, a rotation and a scale. Instead of storing one "Vector3",
+*    "Quaternion" and "Vector3" per joint, every component has its own array, e.g. all rotation w
+*    components of all joints are stored one after another. This way, the static batch functions of this
+*    class process four joints at once using SIMD and a whole skeleton pose is evaluated in one pass
+*    instead of joint by joint.
+*
+*    The joint transform is "position + rotation*(scale*vertex)". Model space poses are calculated by
+*    "LocalToModel()" using a parent index array which describes the joint hierarchy.
+*
+*  @note
+*    - The component arrays are 16 byte aligned and padded to a multiple of four joints, the padding
+*      contains identity poses
+*    - The result of a batch function may be one of the input buffers
+*/
+class PoseBuffer {
+
+
+	//[-------------------------------------------------------]
+	//[ Public static functions                               ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Normalized linear interpolation between two poses
+		*
+		*  @param[in]  cPose1
+		*    First pose (fTime = 0)
+		*  @param[in]  cPose2
+		*    Second pose (fTime = 1), must have the same number of joints as "cPose1"
+		*  @param[in]  fTime
+		*    Interpolation time (usually 0-1)
+		*  @param[out] cResult
+		*    Receives the interpolated pose, resized if required
+		*
+		*  @return
+		*    'true' if all went fine, else 'false' (different number of joints?)
+		*
+		*  @remarks
+		*    Positions and scales are interpolated linearly, rotations are interpolated linearly along
+		*    the shortest path and normalized afterwards. This is considerably faster than "Slerp()" and for
+		*    the usual small angles between animation key frames not visually distinguishable.
+		*/
+		static PLMATH_API bool Nlerp(const PoseBuffer &cPose1, const PoseBuffer &cPose2, float fTime, PoseBuffer &cResult);
+
+		/**
+		*  @brief
+		*    Spherical linear interpolation between two poses
+		*
+		*  @param[in]  cPose1
+		*    First pose (fTime = 0)
+		*  @param[in]  cPose2
+		*    Second pose (fTime = 1), must have the same number of joints as "cPose1"
+		*  @param[in]  fTime
+		*    Interpolation time (0-1)
+		*  @param[out] cResult
+		*    Receives the interpolated pose, resized if required
+		*
+		*  @return
+		*    'true' if all went fine, else 'false' (different number of joints?)
+		*
+		*  @remarks
+		*    Positions and scales are interpolated linearly, rotations are interpolated like
+		*    "Quaternion::Slerp()" does by using polynomial approximations of arc cosine and sine.
+		*/
+		static PLMATH_API bool Slerp(const PoseBuffer &cPose1, const PoseBuffer &cPose2, float fTime, PoseBuffer &cResult);
+
+		/**
+		*  @brief
+		*    Blends two poses by using a weight per joint
+		*
+		*  @param[in]  cPose1
+		*    First pose (weight = 0)
+		*  @param[in]  cPose2
+		*    Second pose (weight = 1), must have the same number of joints as "cPose1"
+		*  @param[in]  pfWeights
+		*    Weight per joint (usually 0-1), must be valid and must have at least "cPose1.GetNumOfJoints()" elements
+		*  @param[out] cResult
+		*    Receives the blended pose, resized if required
+		*
+		*  @return
+		*    'true' if all went fine, else 'false' (different number of joints?)
+		*
+		*  @remarks
+		*    Same as "Nlerp()", but with a weight per joint, e.g. to blend only the upper body of
+		*    a character into another animation.
+		*/
+		static PLMATH_API bool Blend(const PoseBuffer &cPose1, const PoseBuffer &cPose2, const float *pfWeights, PoseBuffer &cResult);
+
+		/**
+		*  @brief
+		*    Concatenates a local space pose along the joint hierarchy into a model space pose
+		*
+		*  @param[in]  cLocal
+		*    Local space pose, each joint pose is relative to its parent joint
+		*  @param[in]  pnParents
+		*    Parent joint index per joint, a negative index marks a root joint, must be valid and must
+		*    have at least "cLocal.GetNumOfJoints()" elements. Parents must be located in front of their
+		*    children, invalid parent indices are handled like root joints.
+		*  @param[out] cModel
+		*    Receives the model space pose, resized if required
+		*
+		*  @remarks
+		*    The model space position is "parent position + parent rotation*(parent scale*local position)",
+		*    rotations and scales are concatenated by multiplication (non uniform scales don't shear).
+		*/
+		static PLMATH_API void LocalToModel(const PoseBuffer &cLocal, const PLCore::int32 *pnParents, PoseBuffer &cModel);
+
+		/**
+		*  @brief
+		*    Converts the joint poses into transform matrices
+		*
+		*  @param[in]  cPose
+		*    Pose to convert
+		*  @param[out] pmDestination
+		*    Receives one matrix per joint, must be valid and must have at least "cPose.GetNumOfJoints()" elements
+		*
+		*  @remarks
+		*    The rotation part is the same as "Quaternion::ToRotationMatrix()" returns, with the
+		*    axes scaled by the joint scale, the translation part is the joint position.
+		*/
+		static PLMATH_API void ToMatrices(const PoseBuffer &cPose, Matrix3x4 *pmDestination);
+
+
+	//[-------------------------------------------------------]
+	//[ Public functions                                      ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Constructor
+		*
+		*  @param[in] nNumOfJoints
+		*    Number of joints, all joints are set to identity
+		*/
+		PLMATH_API PoseBuffer(PLCore::uint32 nNumOfJoints = 0);
+
+		/**
+		*  @brief
+		*    Copy constructor
+		*
+		*  @param[in] cSource
+		*    Source to copy from
+		*/
+		PLMATH_API PoseBuffer(const PoseBuffer &cSource);
+
+		/**
+		*  @brief
+		*    Destructor
+		*/
+		PLMATH_API ~PoseBuffer();
+
+		/**
+		*  @brief
+		*    Copy operator
+		*
+		*  @param[in] cSource
+		*    Source to copy from
+		*
+		*  @return
+		*    Reference to this instance
+		*/
+		PLMATH_API PoseBuffer &operator =(const PoseBuffer &cSource);
+
+		/**
+		*  @brief
+		*    Returns the number of joints
+		*
+		*  @return
+		*    The number of joints
+		*/
+		inline PLCore::uint32 GetNumOfJoints() const;
+
+		/**
+		*  @brief
+		*    Sets the number of joints
+		*
+		*  @param[in] nNumOfJoints
+		*    New number of joints
+		*
+		*  @note
+		*    - The poses of existing joints are kept, new joints are set to identity
+		*/
+		PLMATH_API void Resize(PLCore::uint32 nNumOfJoints);
+
+		/**
+		*  @brief
+		*    Sets all joints to identity (no translation, no rotation, scale of one)
+		*/
+		PLMATH_API void SetIdentity();
+
+		/**
+		*  @brief
+		*    Returns a position component array
+		*
+		*  @param[in] nComponent
+		*    Component (Vector3::X, Vector3::Y or Vector3::Z)
+		*
+		*  @return
+		*    The component array with "GetNumOfJoints()" elements
+		*/
+		inline float *GetPositions(PLCore::uint32 nComponent);
+		inline const float *GetPositions(PLCore::uint32 nComponent) const;
+
+		/**
+		*  @brief
+		*    Returns a rotation component array
+		*
+		*  @param[in] nComponent
+		*    Component (Quaternion::W, Quaternion::X, Quaternion::Y or Quaternion::Z)
+		*
+		*  @return
+		*    The component array with "GetNumOfJoints()" elements
+		*/
+		inline float *GetRotations(PLCore::uint32 nComponent);
+		inline const float *GetRotations(PLCore::uint32 nComponent) const;
+
+		/**
+		*  @brief
+		*    Returns a scale component array
+		*
+		*  @param[in] nComponent
+		*    Component (Vector3::X, Vector3::Y or Vector3::Z)
+		*
+		*  @return
+		*    The component array with "GetNumOfJoints()" elements
+		*/
+		inline float *GetScales(PLCore::uint32 nComponent);
+		inline const float *GetScales(PLCore::uint32 nComponent) const;
+
+		/**
+		*  @brief
+		*    Returns the position of a joint
+		*
+		*  @param[in] nJoint
+		*    Joint index, must be valid
+		*
+		*  @return
+		*    The position of the joint
+		*/
+		inline Vector3 GetPosition(PLCore::uint32 nJoint) const;
+
+		/**
+		*  @brief
+		*    Returns the rotation of a joint
+		*
+		*  @param[in] nJoint
+		*    Joint index, must be valid
+		*
+		*  @return
+		*    The rotation of the joint
+		*/
+		inline Quaternion GetRotation(PLCore::uint32 nJoint) const;
+
+		/**
+		*  @brief
+		*    Returns the scale of a joint
+		*
+		*  @param[in] nJoint
+		*    Joint index, must be valid
+		*
+		*  @return
+		*    The scale of the joint
+		*/
+		inline Vector3 GetScale(PLCore::uint32 nJoint) const;
+
+		/**
+		*  @brief
+		*    Sets the pose of a joint
+		*
+		*  @param[in] nJoint
+		*    Joint index, must be valid
+		*  @param[in] vPosition
+		*    Position
+		*  @param[in] qRotation
+		*    Rotation, should be normalized
+		*  @param[in] vScale
+		*    Scale
+		*/
+		inline void SetJoint(PLCore::uint32 nJoint, const Vector3 &vPosition, const Quaternion &qRotation, const Vector3 &vScale = Vector3::One);
+
+
+	//[-------------------------------------------------------]
+	//[ Private definitions                                   ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Component arrays
+		*/
+		enum EArray {
+			PositionX   = 0,	/**< Position x, followed by y and z */
+			RotationW   = 3,	/**< Rotation w, followed by x, y and z */
+			ScaleX      = 7,	/**< Scale x, followed by y and z */
+			NumOfArrays = 10	/**< Number of component arrays */
+		};
+
+
+	//[-------------------------------------------------------]
+	//[ Private functions                                     ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Sets the given joint range to identity
+		*
+		*  @param[in] nFirstJoint
+		*    First joint
+		*  @param[in] nLastJoint
+		*    Last joint (exclusive)
+		*/
+		void SetIdentity(PLCore::uint32 nFirstJoint, PLCore::uint32 nLastJoint);
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		PLCore::uint32  m_nNumOfJoints;				/**< Number of joints */
+		PLCore::uint32  m_nCapacity;				/**< Number of joints per component array, multiple of four */
+		float		   *m_pfMemory;					/**< Allocated memory, can be a null pointer */
+		float		   *m_pfArray[NumOfArrays];	/**< Component arrays (16 byte aligned within "m_pfMemory"), can be null pointers */
+
+
+};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // PLMath
+
+
+//[-------------------------------------------------------]
+//[ Implementation                                        ]
+//[-------------------------------------------------------]
+#include "PLMath/PoseBuffer.inl"
+
+
+#endif // __PLMATH_POSEBUFFER_H__
@@ -0,0 +1,137 @@
+/*********************************************************\
+ *  File: PoseBuffer.inl                                 *
+ *      Joint pose buffer inline implementation
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace PLMath {
+
+
+//[-------------------------------------------------------]
+//[ Public functions                                      ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Returns the number of joints
+*/
+inline PLCore::uint32 PoseBuffer::GetNumOfJoints() const
+{
+	return m_nNumOfJoints;
+}
+
+/**
+*  @brief
+*    Returns a position component array
+*/
+inline float *PoseBuffer::GetPositions(PLCore::uint32 nComponent)
+{
+	return m_pfArray[PositionX + nComponent];
+}
+
+inline const float *PoseBuffer::GetPositions(PLCore::uint32 nComponent) const
+{
+	return m_pfArray[PositionX + nComponent];
+}
+
+/**
+*  @brief
+*    Returns a rotation component array
+*/
+inline float *PoseBuffer::GetRotations(PLCore::uint32 nComponent)
+{
+	return m_pfArray[RotationW + nComponent];
+}
+
+inline const float *PoseBuffer::GetRotations(PLCore::uint32 nComponent) const
+{
+	return m_pfArray[RotationW + nComponent];
+}
+
+/**
+*  @brief
+*    Returns a scale component array
+*/
+inline float *PoseBuffer::GetScales(PLCore::uint32 nComponent)
+{
+	return m_pfArray[ScaleX + nComponent];
+}
+
+inline const float *PoseBuffer::GetScales(PLCore::uint32 nComponent) const
+{
+	return m_pfArray[ScaleX + nComponent];
+}
+
+/**
+*  @brief
+*    Returns the position of a joint
+*/
+inline Vector3 PoseBuffer::GetPosition(PLCore::uint32 nJoint) const
+{
+	return Vector3(m_pfArray[PositionX][nJoint], m_pfArray[PositionX + 1][nJoint], m_pfArray[PositionX + 2][nJoint]);
+}
+
+/**
+*  @brief
+*    Returns the rotation of a joint
+*/
+inline Quaternion PoseBuffer::GetRotation(PLCore::uint32 nJoint) const
+{
+	return Quaternion(m_pfArray[RotationW][nJoint], m_pfArray[RotationW + 1][nJoint], m_pfArray[RotationW + 2][nJoint], m_pfArray[RotationW + 3][nJoint]);
+}
+
+/**
+*  @brief
+*    Returns the scale of a joint
+*/
+inline Vector3 PoseBuffer::GetScale(PLCore::uint32 nJoint) const
+{
+	return Vector3(m_pfArray[ScaleX][nJoint], m_pfArray[ScaleX + 1][nJoint], m_pfArray[ScaleX + 2][nJoint]);
+}
+
+/**
+*  @brief
+*    Sets the pose of a joint
+*/
+inline void PoseBuffer::SetJoint(PLCore::uint32 nJoint, const Vector3 &vPosition, const Quaternion &qRotation, const Vector3 &vScale)
+{
+	m_pfArray[PositionX    ][nJoint] = vPosition.x;
+	m_pfArray[PositionX + 1][nJoint] = vPosition.y;
+	m_pfArray[PositionX + 2][nJoint] = vPosition.z;
+	m_pfArray[RotationW    ][nJoint] = qRotation.w;
+	m_pfArray[RotationW + 1][nJoint] = qRotation.x;
+	m_pfArray[RotationW + 2][nJoint] = qRotation.y;
+	m_pfArray[RotationW + 3][nJoint] = qRotation.z;
+	m_pfArray[ScaleX       ][nJoint] = vScale.x;
+	m_pfArray[ScaleX + 1   ][nJoint] = vScale.y;
+	m_pfArray[ScaleX + 2   ][nJoint] = vScale.z;
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // PLMath
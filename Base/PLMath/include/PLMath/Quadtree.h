@@ -190,10 +190,28 @@ class Quadtree {
 		*    - There must be x size * y size patches in the array!
 		*    - The quadtree patches must have correct bounding boxes
 		*    - If the bounding box of a patch is changed you have to recall this
-		*      function!
+		*      function or UpdatePatchBoundingBox()!
 		*/
 		PLMATH_API void UpdateBoundingBoxes(QuadtreePatch **ppPatch);
 
+		/**
+		*  @brief
+		*    Updates the bounding boxes of the quadtree after the bounding box of a single patch was changed
+		*
+		*  @param[in] ppPatch
+		*    Pointer to the quadtree patches, can be a null pointer (in that case this function is quite useless...)
+		*  @param[in] nX
+		*    X position of the changed patch
+		*  @param[in] nY
+		*    Y position of the changed patch
+		*
+		*  @note
+		*    - Only the quadtrees containing the given patch are updated, so this is much cheaper
+		*      than UpdateBoundingBoxes() when only a few patches were changed
+		*    - UpdateBoundingBoxes() must have been called at least once before
+		*/
+		PLMATH_API void UpdatePatchBoundingBox(QuadtreePatch **ppPatch, PLCore::uint32 nX, PLCore::uint32 nY);
+
 		/**
 		*  @brief
 		*    Updates the visibility information of the quadtree patches
@@ -211,6 +229,30 @@ class Quadtree {
 		*/
 		PLMATH_API void UpdateVisibility(const PlaneSet &cPlaneSet, QuadtreePatch **ppPatch) const;
 
+		/**
+		*  @brief
+		*    Returns the visible patches
+		*
+		*  @param[in]  cPlaneSet
+		*    Plane set to check (a maximum number of 32 planes is used)
+		*  @param[out] pnPatches
+		*    Receives the indices (y*x size + x) of the visible patches, must be valid and must have at least "nMaxPatches" elements
+		*  @param[in]  nMaxPatches
+		*    Maximum number of patch indices to write
+		*
+		*  @return
+		*    Number of written patch indices
+		*
+		*  @remarks
+		*    Unlike UpdateVisibility() this function doesn't touch the patches. Planes a quadtree is completely
+		*    in front of are not tested for its children, and all patches of a quadtree completely within the
+		*    plane set are added without further tests.
+		*
+		*  @note
+		*    - The quadtree bounding boxes must being initialized!
+		*/
+		PLMATH_API PLCore::uint32 GetVisiblePatches(const PlaneSet &cPlaneSet, PLCore::uint32 *pnPatches, PLCore::uint32 nMaxPatches) const;
+
 		/**
 		*  @brief
 		*    Returns the bounding box minimum/maximum values
@@ -269,6 +311,32 @@ class Quadtree {
 		*/
 		Quadtree &operator =(const Quadtree &cSource);
 
+		/**
+		*  @brief
+		*    Updates the bounding box of this quadtree by using the bounding boxes of the children
+		*
+		*  @param[in] ppPatch
+		*    Pointer to the quadtree patches, must be valid
+		*/
+		void UpdateBoundingBoxFromChildren(QuadtreePatch **ppPatch);
+
+		/**
+		*  @brief
+		*    Adds the visible patches of this quadtree
+		*
+		*  @param[in]      cPlaneSet
+		*    Plane set to check
+		*  @param[in]      nPlaneMask
+		*    Planes which still have to be tested
+		*  @param[out]     pnPatches
+		*    Receives the patch indices, must be valid
+		*  @param[in, out] nNumOfPatches
+		*    Number of written patch indices
+		*  @param[in]      nMaxPatches
+		*    Maximum number of patch indices to write
+		*/
+		void AddVisiblePatches(const PlaneSet &cPlaneSet, PLCore::uint32 nPlaneMask, PLCore::uint32 *pnPatches, PLCore::uint32 &nNumOfPatches, PLCore::uint32 nMaxPatches) const;
+
 
 	//[-------------------------------------------------------]
 	//[ Private data                                          ]
@@ -0,0 +1,153 @@
+/*********************************************************\
+ *  File: SimplexNoise.h                                 *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+#ifndef __PLMATH_SIMPLEXNOISE_H__
+#define __PLMATH_SIMPLEXNOISE_H__
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "PLMath/PLMath.h"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace PLMath {
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Static class containing a simplex noise implementation
+*
+*  @remarks
+*    Simplex noise is Ken Perlin's successor of his classic noise function. It has no directional
+*    artifacts and is cheaper to evaluate in higher dimensions because only n+1 instead of 2^n
+*    gradients contribute to each sample. The result is within [-1, 1].
+*
+*    Unlike "PerlinNoise", the permutation table is fixed (Ken Perlin's reference table), so the
+*    noise is deterministic and thread-safe without any initialization.
+*
+*  @note
+*    - This class is using information from "Simplex noise demystified" written by Stefan Gustavson (2005)
+*
+*  @see
+*    - PerlinNoise
+*/
+class SimplexNoise {
+
+
+	//[-------------------------------------------------------]
+	//[ Public static functions                               ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Returns 2D simplex noise
+		*
+		*  @param[in] fX
+		*    X coordinate
+		*  @param[in] fY
+		*    Y coordinate
+		*
+		*  @return
+		*    Noise value within [-1, 1]
+		*/
+		static PLMATH_API float Noise2(float fX, float fY);
+
+		/**
+		*  @brief
+		*    Returns 3D simplex noise
+		*
+		*  @param[in] fX
+		*    X coordinate
+		*  @param[in] fY
+		*    Y coordinate
+		*  @param[in] fZ
+		*    Z coordinate
+		*
+		*  @return
+		*    Noise value within [-1, 1]
+		*/
+		static PLMATH_API float Noise3(float fX, float fY, float fZ);
+
+		/**
+		*  @brief
+		*    Evaluates 2D simplex noise for a row of equidistant samples along the x axis
+		*
+		*  @param[out] pfDestination
+		*    Receives the noise values, must be able to hold at least "nCount" values
+		*  @param[in]  nCount
+		*    Number of samples to evaluate
+		*  @param[in]  fX
+		*    X coordinate of the first sample
+		*  @param[in]  fY
+		*    Y coordinate of all samples
+		*  @param[in]  fStepX
+		*    Distance between two samples along the x axis
+		*
+		*  @remarks
+		*    Sample "i" receives the same value as "Noise2(fX + i*fStepX, fY)", four samples
+		*    at once are evaluated if SSE2 is available.
+		*/
+		static PLMATH_API void Noise2Row(float *pfDestination, PLCore::uint32 nCount, float fX, float fY, float fStepX);
+
+		/**
+		*  @brief
+		*    Evaluates 3D simplex noise for a row of equidistant samples along the x axis
+		*
+		*  @param[out] pfDestination
+		*    Receives the noise values, must be able to hold at least "nCount" values
+		*  @param[in]  nCount
+		*    Number of samples to evaluate
+		*  @param[in]  fX
+		*    X coordinate of the first sample
+		*  @param[in]  fY
+		*    Y coordinate of all samples
+		*  @param[in]  fZ
+		*    Z coordinate of all samples
+		*  @param[in]  fStepX
+		*    Distance between two samples along the x axis
+		*
+		*  @see
+		*    - Noise2Row()
+		*/
+		static PLMATH_API void Noise3Row(float *pfDestination, PLCore::uint32 nCount, float fX, float fY, float fZ, float fStepX);
+
+
+};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // PLMath
+
+
+#endif // __PLMATH_SIMPLEXNOISE_H__
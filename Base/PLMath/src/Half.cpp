@@ -26,6 +26,20 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include "PLMath/Half.h"
+#ifdef PLMATH_SSE2
+	#include <emmintrin.h>
+	#if defined(_MSC_VER)
+		#include <intrin.h>
+		#include <immintrin.h>
+		#define PLMATH_F16C
+		#define PLMATH_F16C_TARGET
+	#elif defined(__clang__) || (defined(__GNUC__) && (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 9)))
+		#include <cpuid.h>
+		#include <immintrin.h>
+		#define PLMATH_F16C
+		#define PLMATH_F16C_TARGET __attribute__((target("f16c")))
+	#endif
+#endif
 
 
 //[-------------------------------------------------------]
@@ -46,6 +60,219 @@ const float	 Half::LargestPositive				= 65504.0f;
 const float	 Half::Epsilon						= 0.00097656f;
 
 
+//[-------------------------------------------------------]
+//[ Global helper functions                               ]
+//[-------------------------------------------------------]
+#ifdef PLMATH_SSE2
+	/**
+	*  @brief
+	*    Converts four half values (within the lower 16 bit of each 32 bit integer) into four float values
+	*
+	*  @remarks
+	*    Branch-free version of Half::ToFloat(), the result is bit exact. Denormalized halfs are renormalized by
+	*    using the floating point unit ("Half to float conversion revisited" by Fabian Giesen, public domain).
+	*/
+	inline __m128 HalfToFloat4(__m128i nHalf)
+	{
+		const __m128i nExponentMask = _mm_set1_epi32(0x7c00 << 13);
+		const __m128  fMagic        = _mm_castsi128_ps(_mm_set1_epi32(113 << 23));
+
+		// Exponent and mantissa bits at the float position, adjust the exponent bias
+		const __m128i nBits     = _mm_slli_epi32(_mm_and_si128(nHalf, _mm_set1_epi32(0x7fff)), 13);
+		const __m128i nExponent = _mm_and_si128(nBits, nExponentMask);
+		__m128i nResult = _mm_add_epi32(nBits, _mm_set1_epi32((127 - 15) << 23));
+
+		// Infinity and NAN: Extra exponent adjust
+		const __m128i nInfNaN = _mm_cmpeq_epi32(nExponent, nExponentMask);
+		nResult = _mm_add_epi32(nResult, _mm_and_si128(nInfNaN, _mm_set1_epi32((128 - 16) << 23)));
+
+		// Zero and denormalized: Extra exponent adjust and renormalize
+		const __m128i nZeroDenormalized = _mm_cmpeq_epi32(nExponent, _mm_setzero_si128());
+		const __m128  fRenormalized     = _mm_sub_ps(_mm_castsi128_ps(_mm_add_epi32(nResult, _mm_set1_epi32(1 << 23))), fMagic);
+		nResult = _mm_or_si128(_mm_andnot_si128(nZeroDenormalized, nResult), _mm_and_si128(nZeroDenormalized, _mm_castps_si128(fRenormalized)));
+
+		// Sign bit
+		return _mm_castsi128_ps(_mm_or_si128(nResult, _mm_slli_epi32(_mm_and_si128(nHalf, _mm_set1_epi32(0x8000)), 16)));
+	}
+
+	/**
+	*  @brief
+	*    Converts four float values into four half values (within the lower 16 bit of each 32 bit integer)
+	*
+	*  @remarks
+	*    Branch-free version of Half::FromFloat(), the result is bit exact (round to nearest even). Results which
+	*    become denormalized halfs are rounded by the floating point unit by adding a magic number which aligns the
+	*    mantissa bits ("float->half variants" by Fabian Giesen, public domain), so the default rounding mode is required.
+	*/
+	inline __m128i FloatToHalf4(__m128 fFloat)
+	{
+		const __m128i nSignMask    = _mm_set1_epi32(static_cast<int>(0x80000000u));
+		const __m128i nInfinity    = _mm_set1_epi32(255 << 23);
+		const __m128i nHalfMax     = _mm_set1_epi32((127 + 16) << 23);
+		const __m128i nDenormMagic = _mm_set1_epi32(((127 - 15) + (23 - 10) + 1) << 23);
+
+		// Split the sign from the absolute value (the comparisons below can now be done by using signed integers)
+		const __m128i nBits = _mm_castps_si128(fFloat);
+		const __m128i nSign = _mm_and_si128(nBits, nSignMask);
+		const __m128i nAbs  = _mm_xor_si128(nBits, nSign);
+
+		// Normalized result: Adjust the exponent bias and round to the nearest even mantissa
+		const __m128i nMantissaOdd = _mm_and_si128(_mm_srli_epi32(nAbs, 13), _mm_set1_epi32(1));
+		__m128i nResult = _mm_srli_epi32(_mm_add_epi32(_mm_add_epi32(nAbs, _mm_set1_epi32(((15 - 127) << 23) + 0xfff)), nMantissaOdd), 13);
+
+		// Denormalized result or zero: Let the floating point unit do the rounding
+		const __m128i nDenormalized = _mm_cmplt_epi32(nAbs, _mm_set1_epi32(113 << 23));
+		const __m128i nDenormResult = _mm_sub_epi32(_mm_castps_si128(_mm_add_ps(_mm_castsi128_ps(nAbs), _mm_castsi128_ps(nDenormMagic))), nDenormMagic);
+		nResult = _mm_or_si128(_mm_andnot_si128(nDenormalized, nResult), _mm_and_si128(nDenormalized, nDenormResult));
+
+		// Overflow and infinity become infinity, NAN keeps the 10 leftmost mantissa bits (at least one bit must be set)
+		const __m128i nInfNaN   = _mm_cmpgt_epi32(nHalfMax, nAbs);
+		const __m128i nNaN      = _mm_cmpgt_epi32(nAbs, nInfinity);
+		__m128i       nMantissa = _mm_and_si128(_mm_srli_epi32(nAbs, 13), _mm_set1_epi32(0x3ff));
+		nMantissa = _mm_or_si128(nMantissa, _mm_and_si128(_mm_cmpeq_epi32(nMantissa, _mm_setzero_si128()), _mm_set1_epi32(1)));
+		const __m128i nSpecial = _mm_or_si128(_mm_set1_epi32(0x7c00), _mm_and_si128(nNaN, nMantissa));
+		nResult = _mm_or_si128(_mm_and_si128(nInfNaN, nResult), _mm_andnot_si128(nInfNaN, nSpecial));
+
+		// Sign bit
+		return _mm_or_si128(nResult, _mm_srli_epi32(nSign, 16));
+	}
+
+	/**
+	*  @brief
+	*    Packs the lower 16 bit of eight 32 bit integers into eight 16 bit integers
+	*/
+	inline __m128i Pack16(__m128i nLow, __m128i nHigh)
+	{
+		// "_mm_packs_epi32()" saturates signed values, so sign extend the lower 16 bit first
+		return _mm_packs_epi32(_mm_srai_epi32(_mm_slli_epi32(nLow, 16), 16), _mm_srai_epi32(_mm_slli_epi32(nHigh, 16), 16));
+	}
+
+	/**
+	*  @brief
+	*    SSE2 implementation of "Half::ToFloatArray()", "nCount" must be a multiple of 8
+	*/
+	void ToFloatArraySSE2(const uint16 *pnSource, float *pfDestination, uint32 nCount)
+	{
+		const __m128i nZero = _mm_setzero_si128();
+		for (const uint16 *pnSourceEnd=pnSource+nCount; pnSource<pnSourceEnd; pnSource+=8, pfDestination+=8) {
+			const __m128i nHalf = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pnSource));
+			_mm_storeu_ps(pfDestination,     HalfToFloat4(_mm_unpacklo_epi16(nHalf, nZero)));
+			_mm_storeu_ps(pfDestination + 4, HalfToFloat4(_mm_unpackhi_epi16(nHalf, nZero)));
+		}
+	}
+
+	/**
+	*  @brief
+	*    SSE2 implementation of "Half::FromFloatArray()", "nCount" must be a multiple of 8
+	*/
+	void FromFloatArraySSE2(const float *pfSource, uint16 *pnDestination, uint32 nCount)
+	{
+		for (const float *pfSourceEnd=pfSource+nCount; pfSource<pfSourceEnd; pfSource+=8, pnDestination+=8)
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(pnDestination), Pack16(FloatToHalf4(_mm_loadu_ps(pfSource)), FloatToHalf4(_mm_loadu_ps(pfSource + 4))));
+	}
+
+	#ifdef PLMATH_F16C
+		/**
+		*  @brief
+		*    Returns whether or not the CPU and the OS support F16C
+		*/
+		bool IsF16CSupported()
+		{
+			// F16C instructions are VEX encoded, so beside the F16C CPUID flag we also need OS support for the AVX state
+			unsigned int nEcx = 0;
+			#ifdef _MSC_VER
+				int nCpuInfo[4];
+				__cpuid(nCpuInfo, 1);
+				nEcx = static_cast<unsigned int>(nCpuInfo[2]);
+			#else
+				unsigned int nEax, nEbx, nEdx;
+				if (!__get_cpuid(1, &nEax, &nEbx, &nEcx, &nEdx))
+					return false;
+			#endif
+			const unsigned int nRequired = (1u << 27) | (1u << 28) | (1u << 29);	// OSXSAVE, AVX, F16C
+			if ((nEcx & nRequired) != nRequired)
+				return false;
+
+			// Check whether or not the OS saves the XMM and YMM state
+			#ifdef _MSC_VER
+				return ((_xgetbv(0) & 6) == 6);
+			#else
+				unsigned int nXcr0Low, nXcr0High;
+				__asm__ __volatile__ ("xgetbv" : "=a"(nXcr0Low), "=d"(nXcr0High) : "c"(0));
+				return ((nXcr0Low & 6) == 6);
+			#endif
+		}
+
+		/**
+		*  @brief
+		*    Returns whether or not F16C should be used (the check is done only once)
+		*/
+		bool UseF16C()
+		{
+			static const bool bF16C = IsF16CSupported();
+			return bF16C;
+		}
+
+		/**
+		*  @brief
+		*    F16C implementation of "Half::ToFloatArray()", "nCount" must be a multiple of 8
+		*/
+		PLMATH_F16C_TARGET void ToFloatArrayF16C(const uint16 *pnSource, float *pfDestination, uint32 nCount)
+		{
+			for (const uint16 *pnSourceEnd=pnSource+nCount; pnSource<pnSourceEnd; pnSource+=8, pfDestination+=8) {
+				const __m128i nHalf = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pnSource));
+				_mm_storeu_ps(pfDestination,     _mm_cvtph_ps(nHalf));
+				_mm_storeu_ps(pfDestination + 4, _mm_cvtph_ps(_mm_unpackhi_epi64(nHalf, nHalf)));
+			}
+		}
+
+		/**
+		*  @brief
+		*    F16C implementation of "Half::FromFloatArray()", "nCount" must be a multiple of 8
+		*/
+		PLMATH_F16C_TARGET void FromFloatArrayF16C(const float *pfSource, uint16 *pnDestination, uint32 nCount)
+		{
+			for (const float *pfSourceEnd=pfSource+nCount; pfSource<pfSourceEnd; pfSource+=8, pnDestination+=8) {
+				// Rounding control 0 = round to nearest even
+				const __m128i nLow  = _mm_cvtps_ph(_mm_loadu_ps(pfSource),     0);
+				const __m128i nHigh = _mm_cvtps_ph(_mm_loadu_ps(pfSource + 4), 0);
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(pnDestination), _mm_unpacklo_epi64(nLow, nHigh));
+			}
+		}
+	#endif
+
+	/**
+	*  @brief
+	*    Converts a multiple of 8 half values into float values by using the best available instruction set
+	*/
+	inline void ToFloatArrayBlocks(const uint16 *pnSource, float *pfDestination, uint32 nCount)
+	{
+		#ifdef PLMATH_F16C
+			if (UseF16C()) {
+				ToFloatArrayF16C(pnSource, pfDestination, nCount);
+				return;
+			}
+		#endif
+		ToFloatArraySSE2(pnSource, pfDestination, nCount);
+	}
+
+	/**
+	*  @brief
+	*    Converts a multiple of 8 float values into half values by using the best available instruction set
+	*/
+	inline void FromFloatArrayBlocks(const float *pfSource, uint16 *pnDestination, uint32 nCount)
+	{
+		#ifdef PLMATH_F16C
+			if (UseF16C()) {
+				FromFloatArrayF16C(pfSource, pnDestination, nCount);
+				return;
+			}
+		#endif
+		FromFloatArraySSE2(pfSource, pnDestination, nCount);
+	}
+#endif
+
+
 //[-------------------------------------------------------]
 //[ Public functions                                      ]
 //[-------------------------------------------------------]
@@ -279,6 +506,64 @@ uint16 Half::FromFloat(float fFloat)
 	}
 }
 
+/**
+*  @brief
+*    Converts an array of half values into float values
+*/
+void Half::ToFloatArray(const uint16 *pnSource, float *pfDestination, uint32 nCount)
+{
+	#ifdef PLMATH_SSE2
+		// Blocks of 8 values
+		const uint32 nBlockCount = nCount & ~7u;
+		if (nBlockCount)
+			ToFloatArrayBlocks(pnSource, pfDestination, nBlockCount);
+
+		// The remaining values are processed as a padded block as well so the result does not depend on the position
+		const uint32 nRemaining = nCount - nBlockCount;
+		if (nRemaining) {
+			uint16 nHalf[8]  = { 0 };
+			float  fFloat[8];
+			for (uint32 i=0; i<nRemaining; i++)
+				nHalf[i] = pnSource[nBlockCount + i];
+			ToFloatArrayBlocks(nHalf, fFloat, 8);
+			for (uint32 i=0; i<nRemaining; i++)
+				pfDestination[nBlockCount + i] = fFloat[i];
+		}
+	#else
+		for (const uint16 *pnSourceEnd=pnSource+nCount; pnSource<pnSourceEnd; pnSource++, pfDestination++)
+			*pfDestination = ToFloat(*pnSource);
+	#endif
+}
+
+/**
+*  @brief
+*    Converts an array of float values into half values
+*/
+void Half::FromFloatArray(const float *pfSource, uint16 *pnDestination, uint32 nCount)
+{
+	#ifdef PLMATH_SSE2
+		// Blocks of 8 values
+		const uint32 nBlockCount = nCount & ~7u;
+		if (nBlockCount)
+			FromFloatArrayBlocks(pfSource, pnDestination, nBlockCount);
+
+		// The remaining values are processed as a padded block as well so the result does not depend on the position
+		const uint32 nRemaining = nCount - nBlockCount;
+		if (nRemaining) {
+			float  fFloat[8] = { 0.0f };
+			uint16 nHalf[8];
+			for (uint32 i=0; i<nRemaining; i++)
+				fFloat[i] = pfSource[nBlockCount + i];
+			FromFloatArrayBlocks(fFloat, nHalf, 8);
+			for (uint32 i=0; i<nRemaining; i++)
+				pnDestination[nBlockCount + i] = nHalf[i];
+		}
+	#else
+		for (const float *pfSourceEnd=pfSource+nCount; pfSource<pfSourceEnd; pfSource++, pnDestination++)
+			*pnDestination = FromFloat(*pfSource);
+	#endif
+}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
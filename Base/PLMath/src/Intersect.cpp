@@ -1532,6 +1532,41 @@ bool Intersect::PlaneSetAABox(const PlaneSet &cPlaneSet, const Vector3 &vMin, co
 	return true;
 }
 
+/**
+*  @brief
+*    Tests whether an axis aligned box is within the plane set or not, only tests the given planes
+*/
+bool Intersect::PlaneSetAABox(const PlaneSet &cPlaneSet, const Vector3 &vMin, const Vector3 &vMax, uint32 nPlaneMask, uint32 &nOutPlaneMask)
+{
+	// Get planes list
+	const Array<Plane> &lstPlane = cPlaneSet.GetList();
+	const uint32 nNumOfPlanes = (lstPlane.GetNumOfElements() < 32) ? lstPlane.GetNumOfElements() : 32;
+
+	// Are there any planes?
+	if (!nNumOfPlanes)
+		return false;
+
+	Vector3 m = (vMin + vMax)*0.5f;	// Center of AABB
+	Vector3 d = vMax - m;				// Half-diagonal
+	uint32 nMask = nPlaneMask;
+	for (uint32 i=0; i<nNumOfPlanes; i++) {
+		const uint32 mk = 1u << i;
+		if (nPlaneMask & mk) {
+			const Plane &cPlane = lstPlane[i];
+			float NP = d.x*Math::Abs(cPlane.fN[Vector3::X])+d.y*Math::Abs(cPlane.fN[Vector3::Y])+d.z*Math::Abs(cPlane.fN[Vector3::Z]);
+			float MP = m.x*cPlane.fN[Vector3::X]+m.y*cPlane.fN[Vector3::Y]+m.z*cPlane.fN[Vector3::Z]+cPlane.fD;
+			if ((MP+NP) < 0.0f)
+				return false;	// Behind clip plane
+			if ((MP-NP) >= 0.0f)
+				nMask &= ~mk;	// Completely in front of this clip plane
+		}
+	}
+
+	// AABB intersects the plane set
+	nOutPlaneMask = nMask;
+	return true;
+}
+
 
 //[-------------------------------------------------------]
 //[ Triangle                                              ]
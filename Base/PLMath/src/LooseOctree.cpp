@@ -0,0 +1,919 @@
+/*********************************************************\
+ *  File: LooseOctree.cpp                                *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <PLCore/System/System.h>
+#include <PLCore/System/Thread.h>
+#include "PLMath/PlaneSet.h"
+#include "PLMath/Intersect.h"
+#include "PLMath/LooseOctree.h"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+using namespace PLCore;
+namespace PLMath {
+
+
+//[-------------------------------------------------------]
+//[ Global definitions                                    ]
+//[-------------------------------------------------------]
+static const uint32 MinItemsPerThread = 4096;				/**< Builds with less items per thread are not worth the thread creation */
+static const float  LargestFloat	  = 3.402823466e+38f;	/**< Largest float, used for empty bounding boxes */
+
+
+//[-------------------------------------------------------]
+//[ Structures                                            ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Subtree build job of a worker thread
+*/
+struct LooseOctree::BuildJob {
+	LooseOctree	   *pOctree;	/**< Owner octree, always valid */
+	const uint32   *pnSorted;	/**< Item indices sorted by their Morton code, always valid */
+	uint32			nFirst;		/**< First item of the subtree within "pnSorted" */
+	uint32			nLast;		/**< One behind the last item of the subtree within "pnSorted" */
+	uint32			nOctant;	/**< Octant of the subtree root within the root node */
+	Array<Node>		lstNodes;	/**< Subtree nodes, the first one is the subtree root */
+	BuildJob	   *pNextJob;	/**< Next job of the same worker thread, can be a null pointer */
+};
+
+
+//[-------------------------------------------------------]
+//[ Global helper functions                               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Spreads the lower 10 bits of a value so that there are two zero bits between each of them
+*/
+inline uint32 SpreadBits(uint32 nValue)
+{
+	nValue &= 0x000003FF;
+	nValue  = (nValue | (nValue << 16)) & 0x030000FF;
+	nValue  = (nValue | (nValue <<  8)) & 0x0300F00F;
+	nValue  = (nValue | (nValue <<  4)) & 0x030C30C3;
+	nValue  = (nValue | (nValue <<  2)) & 0x09249249;
+	return nValue;
+}
+
+/**
+*  @brief
+*    Returns the cell coordinate (0-1023) of a position component within the root cell
+*/
+inline uint32 QuantizeComponent(float fValue, float fOrigin, float fScale)
+{
+	const float fCell = (fValue - fOrigin)*fScale;
+	return (fCell <= 0.0f) ? 0 : ((fCell >= 1023.0f) ? 1023 : static_cast<uint32>(fCell));
+}
+
+/**
+*  @brief
+*    Grows a bounding box so that it encloses another bounding box
+*/
+inline void GrowBox(Vector3 &vMin, Vector3 &vMax, const Vector3 &vOtherMin, const Vector3 &vOtherMax)
+{
+	if (vMin.x > vOtherMin.x)
+		vMin.x = vOtherMin.x;
+	if (vMin.y > vOtherMin.y)
+		vMin.y = vOtherMin.y;
+	if (vMin.z > vOtherMin.z)
+		vMin.z = vOtherMin.z;
+	if (vMax.x < vOtherMax.x)
+		vMax.x = vOtherMax.x;
+	if (vMax.y < vOtherMax.y)
+		vMax.y = vOtherMax.y;
+	if (vMax.z < vOtherMax.z)
+		vMax.z = vOtherMax.z;
+}
+
+/**
+*  @brief
+*    Sorts item indices by their 30 bit keys (LSD radix sort, three passes with 10 bits each)
+*
+*  @param[in, out] pnKeys
+*    Keys, are sorted as well
+*  @param[out]     pnItems
+*    Receives the item indices sorted by their key
+*  @param[in]      nNumOfItems
+*    Number of items
+*/
+void SortByKey(uint32 *pnKeys, uint32 *pnItems, uint32 nNumOfItems)
+{
+	uint32 *pnTempKeys  = new uint32[nNumOfItems];
+	uint32 *pnTempItems = new uint32[nNumOfItems];
+	for (uint32 i=0; i<nNumOfItems; i++)
+		pnItems[i] = i;
+
+	uint32 *pnSourceKeys  = pnKeys,     *pnSourceItems = pnItems;
+	uint32 *pnDestKeys    = pnTempKeys, *pnDestItems   = pnTempItems;
+	uint32 nCount[1024];
+	for (uint32 nShift=0; nShift<30; nShift+=10) {
+		// Histogram
+		MemoryManager::Set(nCount, 0, sizeof(nCount));
+		for (uint32 i=0; i<nNumOfItems; i++)
+			nCount[(pnSourceKeys[i] >> nShift) & 1023]++;
+
+		// Prefix sum
+		uint32 nOffset = 0;
+		for (uint32 i=0; i<1024; i++) {
+			const uint32 nBucketCount = nCount[i];
+			nCount[i] = nOffset;
+			nOffset  += nBucketCount;
+		}
+
+		// Scatter
+		for (uint32 i=0; i<nNumOfItems; i++) {
+			const uint32 nIndex = nCount[(pnSourceKeys[i] >> nShift) & 1023]++;
+			pnDestKeys[nIndex]  = pnSourceKeys[i];
+			pnDestItems[nIndex] = pnSourceItems[i];
+		}
+
+		// Swap the buffers
+		uint32 *pnSwap = pnSourceKeys;
+		pnSourceKeys   = pnDestKeys;
+		pnDestKeys     = pnSwap;
+		pnSwap		   = pnSourceItems;
+		pnSourceItems  = pnDestItems;
+		pnDestItems    = pnSwap;
+	}
+
+	// Three passes, so the result is within the temporary buffers
+	MemoryManager::Copy(pnKeys,  pnSourceKeys,  sizeof(uint32)*nNumOfItems);
+	MemoryManager::Copy(pnItems, pnSourceItems, sizeof(uint32)*nNumOfItems);
+	delete [] pnTempItems;
+	delete [] pnTempKeys;
+}
+
+/**
+*  @brief
+*    Tests a ray against an axis aligned box
+*
+*  @param[in] vOrigin
+*    Ray origin
+*  @param[in] vDirection
+*    Ray direction
+*  @param[in] vInvDirection
+*    Component wise inverse of the ray direction (0 for zero direction components)
+*  @param[in] fMaxDistance
+*    Maximum distance along the ray in units of the ray direction length
+*  @param[in] vMin
+*    Box minimum
+*  @param[in] vMax
+*    Box maximum
+*
+*  @return
+*    'true' if the ray intersects the box, else 'false'
+*/
+bool RayBox(const Vector3 &vOrigin, const Vector3 &vDirection, const Vector3 &vInvDirection, float fMaxDistance, const Vector3 &vMin, const Vector3 &vMax)
+{
+	float fNear = 0.0f;
+	float fFar  = fMaxDistance;
+	for (uint32 i=0; i<3; i++) {
+		if (vDirection[i] == 0.0f) {
+			// Parallel to the slab
+			if (vOrigin[i] < vMin[i] || vOrigin[i] > vMax[i])
+				return false;
+		} else {
+			float fT1 = (vMin[i] - vOrigin[i])*vInvDirection[i];
+			float fT2 = (vMax[i] - vOrigin[i])*vInvDirection[i];
+			if (fT1 > fT2) {
+				const float fSwap = fT1;
+				fT1 = fT2;
+				fT2 = fSwap;
+			}
+			if (fNear < fT1)
+				fNear = fT1;
+			if (fFar > fT2)
+				fFar = fT2;
+			if (fNear > fFar)
+				return false;
+		}
+	}
+	return true;
+}
+
+
+//[-------------------------------------------------------]
+//[ Public static data                                    ]
+//[-------------------------------------------------------]
+const uint32 LooseOctree::MaxLevel;
+const uint32 LooseOctree::Invalid;
+
+
+//[-------------------------------------------------------]
+//[ Public functions                                      ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Constructor
+*/
+LooseOctree::LooseOctree() :
+	m_fSize(0.0f),
+	m_nMaxItemsPerNode(16),
+	m_nNumOfItems(0)
+{
+}
+
+/**
+*  @brief
+*    Destructor
+*/
+LooseOctree::~LooseOctree()
+{
+}
+
+/**
+*  @brief
+*    Initializes an empty octree
+*/
+void LooseOctree::Init(const AABoundingBox &cBox, uint32 nMaxItemsPerNode)
+{
+	// Destroy the old octree
+	Clear();
+
+	// The root cell is a cube
+	m_fSize = cBox.GetLongestAxisLength();
+	if (m_fSize <= 0.0f)
+		m_fSize = 1.0f;
+	m_vOrigin = cBox.GetCenter() - Vector3(m_fSize, m_fSize, m_fSize)*0.5f;
+	m_nMaxItemsPerNode = nMaxItemsPerNode ? nMaxItemsPerNode : 1;
+
+	// Create the root node
+	AddNode(m_lstNodes, Invalid, 0, 0);
+}
+
+/**
+*  @brief
+*    Builds the octree from scratch
+*/
+void LooseOctree::Build(const AABoundingBox *pcBoxes, uint32 nNumOfItems, uint32 nMaxItemsPerNode, uint32 nNumOfThreads)
+{
+	// Get the region of all items
+	AABoundingBox cBox;
+	if (nNumOfItems) {
+		cBox = pcBoxes[0];
+		for (uint32 i=1; i<nNumOfItems; i++)
+			GrowBox(cBox.vMin, cBox.vMax, pcBoxes[i].vMin, pcBoxes[i].vMax);
+	}
+	Init(cBox, nMaxItemsPerNode);
+	if (!nNumOfItems)
+		return; // Done
+
+	// Classify the items
+	m_lstItems.Resize(nNumOfItems);
+	uint32 *pnCodes = new uint32[nNumOfItems];
+	for (uint32 i=0; i<nNumOfItems; i++) {
+		Item &sItem = m_lstItems[i];
+		sItem.vMin  = pcBoxes[i].vMin;
+		sItem.vMax  = pcBoxes[i].vMax;
+		sItem.nNode = sItem.nPrev = sItem.nNext = Invalid;
+		ClassifyItem(sItem);
+		pnCodes[i] = sItem.nCode;
+	}
+	m_nNumOfItems = nNumOfItems;
+
+	// Sort the items by their Morton code, this way the items of each node cell are within one range
+	uint32 *pnSorted = new uint32[nNumOfItems];
+	SortByKey(pnCodes, pnSorted, nNumOfItems);
+	delete [] pnCodes;
+
+	// Get the number of threads to use
+	if (!nNumOfThreads)
+		nNumOfThreads = System::GetInstance()->GetNumOfProcessors();
+	nNumOfThreads = Math::Min(nNumOfThreads, Math::Max(static_cast<uint32>(1), nNumOfItems/MinItemsPerThread));
+	nNumOfThreads = Math::Min(nNumOfThreads, static_cast<uint32>(8));
+
+	if (nNumOfThreads <= 1) {
+		// Build the whole octree right now
+		BuildNode(m_lstNodes, 0, pnSorted, 0, nNumOfItems);
+	} else if (LinkNodeItems(m_lstNodes, 0, pnSorted, 0, nNumOfItems)) {
+		// Create a job for each non-empty root child
+		uint32 nChildFirst[9];
+		SplitRange(pnSorted, 0, nNumOfItems, 0, nChildFirst);
+		BuildJob sJobs[8];
+		uint32 nNumOfJobs = 0;
+		for (uint32 nOctant=0; nOctant<8; nOctant++) {
+			if (nChildFirst[nOctant] < nChildFirst[nOctant + 1]) {
+				BuildJob &sJob = sJobs[nNumOfJobs++];
+				sJob.pOctree  = this;
+				sJob.pnSorted = pnSorted;
+				sJob.nFirst   = nChildFirst[nOctant];
+				sJob.nLast	  = nChildFirst[nOctant + 1];
+				sJob.nOctant  = nOctant;
+				sJob.pNextJob = nullptr;
+				AddNode(sJob.lstNodes, Invalid, 1, nOctant);
+			}
+		}
+
+		// Distribute the jobs, the largest job goes to the worker with the least items
+		BuildJob *pWorkerJobs[8];
+		uint32 nWorkerItems[8];
+		for (uint32 i=0; i<nNumOfThreads; i++) {
+			pWorkerJobs[i]  = nullptr;
+			nWorkerItems[i] = 0;
+		}
+		bool bAssigned[8] = { false, false, false, false, false, false, false, false };
+		for (uint32 nJob=0; nJob<nNumOfJobs; nJob++) {
+			uint32 nLargest = 0;
+			for (uint32 i=1; i<nNumOfJobs; i++) {
+				if (bAssigned[nLargest] || (!bAssigned[i] && sJobs[i].nLast - sJobs[i].nFirst > sJobs[nLargest].nLast - sJobs[nLargest].nFirst))
+					nLargest = i;
+			}
+			uint32 nWorker = 0;
+			for (uint32 i=1; i<nNumOfThreads; i++) {
+				if (nWorkerItems[i] < nWorkerItems[nWorker])
+					nWorker = i;
+			}
+			bAssigned[nLargest]			= true;
+			sJobs[nLargest].pNextJob	= pWorkerJobs[nWorker];
+			pWorkerJobs[nWorker]		= &sJobs[nLargest];
+			nWorkerItems[nWorker]	   += sJobs[nLargest].nLast - sJobs[nLargest].nFirst;
+		}
+
+		// Start the worker threads, the calling thread processes the first chain of jobs itself
+		Thread *pThreads[8];
+		for (uint32 i=1; i<nNumOfThreads; i++) {
+			pThreads[i] = nullptr;
+			if (pWorkerJobs[i]) {
+				pThreads[i] = new Thread(BuildThreadFunction, pWorkerJobs[i]);
+				if (!pThreads[i]->Start()) {
+					// Thread creation failed, do the work within the calling thread instead
+					delete pThreads[i];
+					pThreads[i] = nullptr;
+					BuildThreadFunction(pWorkerJobs[i]);
+				}
+			}
+		}
+		if (pWorkerJobs[0])
+			BuildThreadFunction(pWorkerJobs[0]);
+
+		// Wait for the worker threads
+		for (uint32 i=1; i<nNumOfThreads; i++) {
+			if (pThreads[i]) {
+				pThreads[i]->Join();
+				delete pThreads[i];
+			}
+		}
+
+		// Append the subtrees to the node list
+		for (uint32 nJob=0; nJob<nNumOfJobs; nJob++) {
+			const BuildJob &sJob = sJobs[nJob];
+			const uint32 nOffset = m_lstNodes.GetNumOfElements();
+			m_lstNodes.Resize(nOffset + sJob.lstNodes.GetNumOfElements(), true);
+			for (uint32 i=0; i<sJob.lstNodes.GetNumOfElements(); i++) {
+				Node &sNode = m_lstNodes[nOffset + i];
+				sNode = sJob.lstNodes[i];
+				sNode.nParent = (sNode.nParent == Invalid) ? 0 : sNode.nParent + nOffset;
+				for (uint32 nChild=0; nChild<8; nChild++) {
+					if (sNode.nChild[nChild] != Invalid)
+						sNode.nChild[nChild] += nOffset;
+				}
+			}
+			for (uint32 i=sJob.nFirst; i<sJob.nLast; i++) {
+				Item &sItem = m_lstItems[pnSorted[i]];
+				if (sItem.nLevel)
+					sItem.nNode += nOffset;
+			}
+
+			// Update the root
+			Node &sRoot = m_lstNodes[0];
+			const Node &sChild = m_lstNodes[nOffset];
+			sRoot.nChild[sJob.nOctant] = nOffset;
+			sRoot.nNumOfSubtreeItems += sChild.nNumOfSubtreeItems;
+			GrowBox(sRoot.vMin, sRoot.vMax, sChild.vMin, sChild.vMax);
+		}
+	}
+
+	// Cleanup
+	delete [] pnSorted;
+}
+
+/**
+*  @brief
+*    Destroys all nodes and items
+*/
+void LooseOctree::Clear()
+{
+	m_vOrigin	  = Vector3::Zero;
+	m_fSize		  = 0.0f;
+	m_nNumOfItems = 0;
+	m_lstNodes.Clear();
+	m_lstItems.Clear();
+}
+
+/**
+*  @brief
+*    Returns the bounding box of all items within the octree
+*/
+AABoundingBox LooseOctree::GetBoundingBox() const
+{
+	return m_lstNodes.GetNumOfElements() ? AABoundingBox(m_lstNodes[0].vMin, m_lstNodes[0].vMax) : AABoundingBox(LargestFloat, LargestFloat, LargestFloat, -LargestFloat, -LargestFloat, -LargestFloat);
+}
+
+/**
+*  @brief
+*    Inserts an item
+*/
+bool LooseOctree::Insert(uint32 nItem, const AABoundingBox &cBox)
+{
+	// Check the octree and the item
+	if (!m_lstNodes.GetNumOfElements() || nItem == Invalid || HasItem(nItem))
+		return false; // Error!
+
+	// Add new item slots, the number of slots is doubled to avoid frequent reallocations
+	if (nItem >= m_lstItems.GetNumOfElements()) {
+		if (nItem >= m_lstItems.GetMaxNumOfElements())
+			m_lstItems.Resize(Math::Max(nItem + 1, m_lstItems.GetMaxNumOfElements()*2), false);
+		while (m_lstItems.GetNumOfElements() <= nItem)
+			m_lstItems.Add().nNode = Invalid;
+	}
+
+	// Classify the item
+	Item &sItem = m_lstItems[nItem];
+	sItem.vMin = cBox.vMin;
+	sItem.vMax = cBox.vMax;
+	ClassifyItem(sItem);
+
+	// Link the item and update the nodes above
+	const uint32 nNode = FindInsertNode(nItem);
+	LinkItem(m_lstNodes, nNode, nItem);
+	for (uint32 nParent=nNode; nParent!=Invalid; nParent=m_lstNodes[nParent].nParent) {
+		Node &sNode = m_lstNodes[nParent];
+		sNode.nNumOfSubtreeItems++;
+		GrowBox(sNode.vMin, sNode.vMax, sItem.vMin, sItem.vMax);
+	}
+	m_nNumOfItems++;
+
+	// Done
+	return true;
+}
+
+/**
+*  @brief
+*    Removes an item
+*/
+bool LooseOctree::Remove(uint32 nItem)
+{
+	// Check the item
+	if (!HasItem(nItem))
+		return false; // Error!
+
+	// Unlink the item and update the nodes above, the bounding boxes stay conservative until a subtree becomes empty
+	const uint32 nNode = m_lstItems[nItem].nNode;
+	UnlinkItem(nItem);
+	for (uint32 nParent=nNode; nParent!=Invalid; nParent=m_lstNodes[nParent].nParent) {
+		Node &sNode = m_lstNodes[nParent];
+		sNode.nNumOfSubtreeItems--;
+		if (!sNode.nNumOfSubtreeItems) {
+			sNode.vMin.SetXYZ( LargestFloat,  LargestFloat,  LargestFloat);
+			sNode.vMax.SetXYZ(-LargestFloat, -LargestFloat, -LargestFloat);
+		}
+	}
+	m_nNumOfItems--;
+
+	// Done
+	return true;
+}
+
+/**
+*  @brief
+*    Updates the bounding box of an item
+*/
+bool LooseOctree::Update(uint32 nItem, const AABoundingBox &cBox)
+{
+	// Check the item
+	if (!HasItem(nItem))
+		return false; // Error!
+
+	// Reclassify the item
+	Item &sItem = m_lstItems[nItem];
+	sItem.vMin = cBox.vMin;
+	sItem.vMax = cBox.vMax;
+	ClassifyItem(sItem);
+
+	// Does the item still fit into its node? (center within the node cell and not too large for the node)
+	const Node &sNode = m_lstNodes[sItem.nNode];
+	if (sItem.nLevel >= sNode.nLevel && (sItem.nCode >> (3*(MaxLevel - sNode.nLevel))) == sNode.nCode) {
+		// Just grow the bounding boxes
+		for (uint32 nParent=sItem.nNode; nParent!=Invalid; nParent=m_lstNodes[nParent].nParent)
+			GrowBox(m_lstNodes[nParent].vMin, m_lstNodes[nParent].vMax, sItem.vMin, sItem.vMax);
+	} else {
+		// Move the item to another node
+		Remove(nItem);
+		Insert(nItem, cBox);
+	}
+
+	// Done
+	return true;
+}
+
+/**
+*  @brief
+*    Returns the items intersecting a plane set (for example a view frustum)
+*/
+uint32 LooseOctree::GetItems(const PlaneSet &cPlaneSet, uint32 *pnItems, uint32 nMaxItems) const
+{
+	// Is there anything to do?
+	const uint32 nNumOfPlanes = cPlaneSet.GetNumOfPlanes();
+	if (!nMaxItems || !m_nNumOfItems || !nNumOfPlanes)
+		return 0;
+
+	// Depth first traversal, each stack entry is a node and the mask of the planes which still have to be tested
+	uint32 nStackNodes[7*MaxLevel + 8];
+	uint32 nStackMasks[7*MaxLevel + 8];
+	uint32 nStackSize  = 1;
+	uint32 nNumOfItems = 0;
+	nStackNodes[0] = 0;
+	nStackMasks[0] = (nNumOfPlanes >= 32) ? 0xFFFFFFFF : ((1u << nNumOfPlanes) - 1);
+	while (nStackSize && nNumOfItems < nMaxItems) {
+		nStackSize--;
+		const Node &sNode = m_lstNodes[nStackNodes[nStackSize]];
+		uint32 nMask = nStackMasks[nStackSize];
+		if (sNode.nNumOfSubtreeItems && Intersect::PlaneSetAABox(cPlaneSet, sNode.vMin, sNode.vMax, nMask, nMask)) {
+			if (nMask) {
+				// Partially inside, test the items of this node
+				for (uint32 nItem=sNode.nFirstItem; nItem!=Invalid && nNumOfItems<nMaxItems; nItem=m_lstItems[nItem].nNext) {
+					const Item &sItem = m_lstItems[nItem];
+					uint32 nItemMask;
+					if (Intersect::PlaneSetAABox(cPlaneSet, sItem.vMin, sItem.vMax, nMask, nItemMask))
+						pnItems[nNumOfItems++] = nItem;
+				}
+
+				// Traverse the children
+				for (uint32 i=0; i<8; i++) {
+					if (sNode.nChild[i] != Invalid) {
+						nStackNodes[nStackSize] = sNode.nChild[i];
+						nStackMasks[nStackSize] = nMask;
+						nStackSize++;
+					}
+				}
+			} else {
+				// Completely inside, no further tests required
+				AddSubtreeItems(nStackNodes[nStackSize], pnItems, nNumOfItems, nMaxItems);
+			}
+		}
+	}
+
+	// Done
+	return nNumOfItems;
+}
+
+/**
+*  @brief
+*    Returns the items intersecting a ray
+*/
+uint32 LooseOctree::GetItems(const Vector3 &vRayOrigin, const Vector3 &vRayDirection, uint32 *pnItems, uint32 nMaxItems, float fMaxDistance) const
+{
+	// Is there anything to do?
+	if (!nMaxItems || !m_nNumOfItems)
+		return 0;
+	if (fMaxDistance < 0.0f)
+		fMaxDistance = LargestFloat;
+	const Vector3 vInvDirection(vRayDirection.x ? 1.0f/vRayDirection.x : 0.0f,
+								vRayDirection.y ? 1.0f/vRayDirection.y : 0.0f,
+								vRayDirection.z ? 1.0f/vRayDirection.z : 0.0f);
+
+	// Depth first traversal
+	uint32 nStackNodes[7*MaxLevel + 8];
+	uint32 nStackSize  = 1;
+	uint32 nNumOfItems = 0;
+	nStackNodes[0] = 0;
+	while (nStackSize && nNumOfItems < nMaxItems) {
+		const Node &sNode = m_lstNodes[nStackNodes[--nStackSize]];
+		if (sNode.nNumOfSubtreeItems && RayBox(vRayOrigin, vRayDirection, vInvDirection, fMaxDistance, sNode.vMin, sNode.vMax)) {
+			// Test the items of this node
+			for (uint32 nItem=sNode.nFirstItem; nItem!=Invalid && nNumOfItems<nMaxItems; nItem=m_lstItems[nItem].nNext) {
+				const Item &sItem = m_lstItems[nItem];
+				if (RayBox(vRayOrigin, vRayDirection, vInvDirection, fMaxDistance, sItem.vMin, sItem.vMax))
+					pnItems[nNumOfItems++] = nItem;
+			}
+
+			// Traverse the children
+			for (uint32 i=0; i<8; i++) {
+				if (sNode.nChild[i] != Invalid)
+					nStackNodes[nStackSize++] = sNode.nChild[i];
+			}
+		}
+	}
+
+	// Done
+	return nNumOfItems;
+}
+
+
+//[-------------------------------------------------------]
+//[ Private functions                                     ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Copy constructor
+*/
+LooseOctree::LooseOctree(const LooseOctree &cSource) :
+	m_fSize(0.0f),
+	m_nMaxItemsPerNode(16),
+	m_nNumOfItems(0)
+{
+	// No implementation because the copy constructor is never used
+}
+
+/**
+*  @brief
+*    Copy operator
+*/
+LooseOctree &LooseOctree::operator =(const LooseOctree &cSource)
+{
+	// No implementation because the copy operator is never used
+	return *this;
+}
+
+/**
+*  @brief
+*    Static thread function building the subtrees of a chain of build jobs
+*/
+int LooseOctree::BuildThreadFunction(void *pData)
+{
+	for (BuildJob *pJob=static_cast<BuildJob*>(pData); pJob; pJob=pJob->pNextJob)
+		pJob->pOctree->BuildNode(pJob->lstNodes, 0, pJob->pnSorted, pJob->nFirst, pJob->nLast);
+	return 0;
+}
+
+/**
+*  @brief
+*    Calculates the Morton code and the level of an item
+*/
+void LooseOctree::ClassifyItem(Item &sItem) const
+{
+	// Morton code of the center, centers outside the root cell are clamped
+	const Vector3 vCenter = (sItem.vMin + sItem.vMax)*0.5f;
+	const float   fScale  = 1024.0f/m_fSize;
+	sItem.nCode = SpreadBits(QuantizeComponent(vCenter.x, m_vOrigin.x, fScale)) |
+				 (SpreadBits(QuantizeComponent(vCenter.y, m_vOrigin.y, fScale)) << 1) |
+				 (SpreadBits(QuantizeComponent(vCenter.z, m_vOrigin.z, fScale)) << 2);
+
+	// Deepest level whose cell size is not smaller than the item size
+	const float fExtent = Math::Max(Math::Max(sItem.vMax.x - sItem.vMin.x, sItem.vMax.y - sItem.vMin.y), sItem.vMax.z - sItem.vMin.z);
+	float fCellSize = m_fSize*0.5f;
+	sItem.nLevel = 0;
+	while (sItem.nLevel < MaxLevel && fExtent <= fCellSize) {
+		sItem.nLevel++;
+		fCellSize *= 0.5f;
+	}
+}
+
+/**
+*  @brief
+*    Adds a node
+*/
+uint32 LooseOctree::AddNode(Array<Node> &lstNodes, uint32 nParent, uint32 nLevel, uint32 nCode)
+{
+	// The number of node slots is doubled to avoid frequent reallocations
+	const uint32 nNode = lstNodes.GetNumOfElements();
+	if (nNode == lstNodes.GetMaxNumOfElements())
+		lstNodes.Resize(Math::Max(static_cast<uint32>(16), nNode*2), false);
+
+	// Initialize the node
+	Node &sNode = lstNodes.Add();
+	sNode.vMin.SetXYZ( LargestFloat,  LargestFloat,  LargestFloat);
+	sNode.vMax.SetXYZ(-LargestFloat, -LargestFloat, -LargestFloat);
+	for (uint32 i=0; i<8; i++)
+		sNode.nChild[i] = Invalid;
+	sNode.nParent			 = nParent;
+	sNode.nLevel			 = nLevel;
+	sNode.nCode				 = nCode;
+	sNode.nFirstItem		 = Invalid;
+	sNode.nNumOfItems		 = 0;
+	sNode.nNumOfSubtreeItems = 0;
+	sNode.bLeaf				 = true;
+
+	// Return the node index
+	return nNode;
+}
+
+/**
+*  @brief
+*    Links an item into the item list of a node and grows the bounding box of the node
+*/
+void LooseOctree::LinkItem(Array<Node> &lstNodes, uint32 nNode, uint32 nItem)
+{
+	Node &sNode = lstNodes[nNode];
+	Item &sItem = m_lstItems[nItem];
+	sItem.nNode = nNode;
+	sItem.nPrev = Invalid;
+	sItem.nNext = sNode.nFirstItem;
+	if (sNode.nFirstItem != Invalid)
+		m_lstItems[sNode.nFirstItem].nPrev = nItem;
+	sNode.nFirstItem = nItem;
+	sNode.nNumOfItems++;
+	GrowBox(sNode.vMin, sNode.vMax, sItem.vMin, sItem.vMax);
+}
+
+/**
+*  @brief
+*    Unlinks an item from the item list of its node
+*/
+void LooseOctree::UnlinkItem(uint32 nItem)
+{
+	Item &sItem = m_lstItems[nItem];
+	Node &sNode = m_lstNodes[sItem.nNode];
+	if (sItem.nPrev != Invalid)
+		m_lstItems[sItem.nPrev].nNext = sItem.nNext;
+	else
+		sNode.nFirstItem = sItem.nNext;
+	if (sItem.nNext != Invalid)
+		m_lstItems[sItem.nNext].nPrev = sItem.nPrev;
+	sNode.nNumOfItems--;
+	sItem.nNode = sItem.nPrev = sItem.nNext = Invalid;
+}
+
+/**
+*  @brief
+*    Links the items of a sorted item range which are staying within a node
+*/
+bool LooseOctree::LinkNodeItems(Array<Node> &lstNodes, uint32 nNode, const uint32 *pnSorted, uint32 nFirst, uint32 nLast)
+{
+	// Items with a lower level are already linked to the nodes above, items with the node level can't go deeper
+	const uint32 nLevel = lstNodes[nNode].nLevel;
+	uint32 nNumOfItems = 0, nNumOfDeeperItems = 0;
+	for (uint32 i=nFirst; i<nLast; i++) {
+		const uint32 nItemLevel = m_lstItems[pnSorted[i]].nLevel;
+		if (nItemLevel >= nLevel) {
+			nNumOfItems++;
+			if (nItemLevel > nLevel)
+				nNumOfDeeperItems++;
+		}
+	}
+
+	// Leaf or inner node?
+	const bool bLeaf = (nNumOfItems <= m_nMaxItemsPerNode || !nNumOfDeeperItems || nLevel == MaxLevel);
+	for (uint32 i=nFirst; i<nLast; i++) {
+		const uint32 nItemLevel = m_lstItems[pnSorted[i]].nLevel;
+		if (nItemLevel == nLevel || (bLeaf && nItemLevel > nLevel))
+			LinkItem(lstNodes, nNode, pnSorted[i]);
+	}
+	Node &sNode = lstNodes[nNode];
+	sNode.nNumOfSubtreeItems = sNode.nNumOfItems;
+	sNode.bLeaf				 = bLeaf;
+
+	// Done
+	return !bLeaf;
+}
+
+/**
+*  @brief
+*    Builds a subtree from a range of items sorted by their Morton code
+*/
+void LooseOctree::BuildNode(Array<Node> &lstNodes, uint32 nNode, const uint32 *pnSorted, uint32 nFirst, uint32 nLast)
+{
+	// Link the items staying within this node
+	if (LinkNodeItems(lstNodes, nNode, pnSorted, nFirst, nLast)) {
+		// Build the children
+		const uint32 nLevel = lstNodes[nNode].nLevel;
+		uint32 nChildFirst[9];
+		SplitRange(pnSorted, nFirst, nLast, nLevel, nChildFirst);
+		for (uint32 nOctant=0; nOctant<8; nOctant++) {
+			// Are there items for this child?
+			bool bItems = false;
+			for (uint32 i=nChildFirst[nOctant]; i<nChildFirst[nOctant + 1] && !bItems; i++)
+				bItems = (m_lstItems[pnSorted[i]].nLevel > nLevel);
+			if (bItems) {
+				// Note that adding a node may reallocate the node list, so no node references are kept
+				const uint32 nChild = AddNode(lstNodes, nNode, nLevel + 1, (lstNodes[nNode].nCode << 3) | nOctant);
+				lstNodes[nNode].nChild[nOctant] = nChild;
+				BuildNode(lstNodes, nChild, pnSorted, nChildFirst[nOctant], nChildFirst[nOctant + 1]);
+
+				// Update this node
+				Node &sNode = lstNodes[nNode];
+				const Node &sChild = lstNodes[nChild];
+				sNode.nNumOfSubtreeItems += sChild.nNumOfSubtreeItems;
+				GrowBox(sNode.vMin, sNode.vMax, sChild.vMin, sChild.vMax);
+			}
+		}
+	}
+}
+
+/**
+*  @brief
+*    Splits the items of a node range into the ranges of the eight child cells
+*/
+void LooseOctree::SplitRange(const uint32 *pnSorted, uint32 nFirst, uint32 nLast, uint32 nLevel, uint32 nChildFirst[9]) const
+{
+	// The items are sorted by their Morton code, so the child octants are ascending within the range
+	const uint32 nShift = 3*(MaxLevel - nLevel - 1);
+	uint32 i = nFirst;
+	for (uint32 nOctant=0; nOctant<8; nOctant++) {
+		nChildFirst[nOctant] = i;
+		while (i < nLast && ((m_lstItems[pnSorted[i]].nCode >> nShift) & 7) == nOctant)
+			i++;
+	}
+	nChildFirst[8] = nLast;
+}
+
+/**
+*  @brief
+*    Splits a leaf node by moving its items into child nodes where possible
+*/
+void LooseOctree::SplitLeaf(uint32 nNode)
+{
+	m_lstNodes[nNode].bLeaf = false;
+	const uint32 nLevel = m_lstNodes[nNode].nLevel;
+	const uint32 nShift = 3*(MaxLevel - nLevel - 1);
+	uint32 nItem = m_lstNodes[nNode].nFirstItem;
+	while (nItem != Invalid) {
+		const uint32 nNextItem = m_lstItems[nItem].nNext;
+		if (m_lstItems[nItem].nLevel > nLevel) {
+			// Get the child, create it if required
+			const uint32 nOctant = (m_lstItems[nItem].nCode >> nShift) & 7;
+			uint32 nChild = m_lstNodes[nNode].nChild[nOctant];
+			if (nChild == Invalid) {
+				nChild = AddNode(m_lstNodes, nNode, nLevel + 1, (m_lstNodes[nNode].nCode << 3) | nOctant);
+				m_lstNodes[nNode].nChild[nOctant] = nChild;
+			}
+
+			// Move the item, the bounding box of this node already encloses it
+			UnlinkItem(nItem);
+			LinkItem(m_lstNodes, nChild, nItem);
+			m_lstNodes[nChild].nNumOfSubtreeItems++;
+		}
+		nItem = nNextItem;
+	}
+}
+
+/**
+*  @brief
+*    Returns the node an item should be inserted into, creates or splits nodes if required
+*/
+uint32 LooseOctree::FindInsertNode(uint32 nItem)
+{
+	const Item &sItem = m_lstItems[nItem];
+	uint32 nNode = 0;
+	for (;;) {
+		// Does the item fit no deeper?
+		const uint32 nLevel = m_lstNodes[nNode].nLevel;
+		if (sItem.nLevel <= nLevel)
+			return nNode;
+
+		// Leaf with free space?
+		if (m_lstNodes[nNode].bLeaf) {
+			if (m_lstNodes[nNode].nNumOfItems < m_nMaxItemsPerNode || nLevel == MaxLevel)
+				return nNode;
+			SplitLeaf(nNode);
+		}
+
+		// Go down, create the child if required
+		const uint32 nOctant = (sItem.nCode >> (3*(MaxLevel - nLevel - 1))) & 7;
+		uint32 nChild = m_lstNodes[nNode].nChild[nOctant];
+		if (nChild == Invalid) {
+			nChild = AddNode(m_lstNodes, nNode, nLevel + 1, (m_lstNodes[nNode].nCode << 3) | nOctant);
+			m_lstNodes[nNode].nChild[nOctant] = nChild;
+		}
+		nNode = nChild;
+	}
+}
+
+/**
+*  @brief
+*    Adds all items of a subtree
+*/
+void LooseOctree::AddSubtreeItems(uint32 nNode, uint32 *pnItems, uint32 &nNumOfItems, uint32 nMaxItems) const
+{
+	const Node &sNode = m_lstNodes[nNode];
+	for (uint32 nItem=sNode.nFirstItem; nItem!=Invalid && nNumOfItems<nMaxItems; nItem=m_lstItems[nItem].nNext)
+		pnItems[nNumOfItems++] = nItem;
+	for (uint32 i=0; i<8 && nNumOfItems<nMaxItems; i++) {
+		if (sNode.nChild[i] != Invalid && m_lstNodes[sNode.nChild[i]].nNumOfSubtreeItems)
+			AddSubtreeItems(sNode.nChild[i], pnItems, nNumOfItems, nMaxItems);
+	}
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // PLMath
@@ -0,0 +1,346 @@
+/*********************************************************\
+ *  File: NoiseGrid.cpp                                  *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <PLCore/Core/MemoryManager.h>
+#include <PLCore/System/System.h>
+#include <PLCore/System/Thread.h>
+#include "PLMath/Math.h"
+#include "PLMath/Vector2.h"
+#include "PLMath/Vector3.h"
+#include "PLMath/PerlinNoise.h"
+#include "PLMath/SimplexNoise.h"
+#include "PLMath/NoiseGrid.h"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+using namespace PLCore;
+namespace PLMath {
+
+
+//[-------------------------------------------------------]
+//[ Global definitions                                    ]
+//[-------------------------------------------------------]
+static const uint32 MinSamplesPerThread = 16384;	/**< Grids with less samples per thread are not worth the thread creation */
+
+
+//[-------------------------------------------------------]
+//[ Structures                                            ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Grid function
+*/
+enum EGridFunction {
+	GridNoise2,
+	GridNoise3,
+	GridFractalSum3,
+	GridTurbulence3,
+	GridTileableTurbulence3
+};
+
+/**
+*  @brief
+*    Description of the rows a single thread has to process
+*/
+struct GridJob {
+	EGridFunction      nFunction;
+	NoiseGrid::ENoise  nNoise;
+	float			  *pfDestination;
+	uint32			   nWidth;
+	uint32			   nHeight;
+	float			   fOrigin[3];
+	float			   fStep[3];
+	float			   fSize[3];
+	float			   fAlpha;
+	float			   fBeta;
+	float			   fFreq;
+	uint32			   nNumOfOctaves;
+	uint32			   nFirstRow;
+	uint32			   nNumOfRows;
+};
+
+
+//[-------------------------------------------------------]
+//[ Global helper functions                               ]
+//[-------------------------------------------------------]
+inline void NoiseRow(NoiseGrid::ENoise nNoise, float *pfRow, uint32 nCount, float fX, float fY, float fZ, float fStepX)
+{
+	if (nNoise == NoiseGrid::Simplex)
+		SimplexNoise::Noise3Row(pfRow, nCount, fX, fY, fZ, fStepX);
+	else
+		PerlinNoise::Noise3Row(pfRow, nCount, fX, fY, fZ, fStepX);
+}
+
+/**
+*  @brief
+*    Processes the rows of a job
+*/
+void ProcessRows(const GridJob &sJob)
+{
+	const uint32 nWidth = sJob.nWidth;
+
+	// Scratch row for functions summing up multiple noise evaluations
+	float *pfScratch = (sJob.nFunction != GridNoise2 && sJob.nFunction != GridNoise3) ? new float[nWidth] : nullptr;
+
+	for (uint32 nRow=sJob.nFirstRow; nRow<sJob.nFirstRow+sJob.nNumOfRows; nRow++) {
+		float *pfRow = sJob.pfDestination + nRow*nWidth;
+		const float fX = sJob.fOrigin[0];
+		const float fY = sJob.fOrigin[1] + static_cast<float>(nRow%sJob.nHeight)*sJob.fStep[1];
+		const float fZ = sJob.fOrigin[2] + static_cast<float>(nRow/sJob.nHeight)*sJob.fStep[2];
+
+		switch (sJob.nFunction) {
+			case GridNoise2:
+				if (sJob.nNoise == NoiseGrid::Simplex)
+					SimplexNoise::Noise2Row(pfRow, nWidth, fX, fY, sJob.fStep[0]);
+				else
+					PerlinNoise::Noise2Row(pfRow, nWidth, fX, fY, sJob.fStep[0]);
+				break;
+
+			case GridNoise3:
+				NoiseRow(sJob.nNoise, pfRow, nWidth, fX, fY, fZ, sJob.fStep[0]);
+				break;
+
+			case GridFractalSum3:
+			{
+				MemoryManager::Set(pfRow, 0, nWidth*sizeof(float));
+				float fScale = 1.0f;
+				float fP     = 1.0f;
+				for (uint32 nOctave=0; nOctave<sJob.nNumOfOctaves; nOctave++) {
+					NoiseRow(sJob.nNoise, pfScratch, nWidth, fX*fP, fY*fP, fZ*fP, sJob.fStep[0]*fP);
+					const float fWeight = 1.0f/fScale;
+					for (uint32 i=0; i<nWidth; i++)
+						pfRow[i] += pfScratch[i]*fWeight;
+					fScale *= sJob.fAlpha;
+					fP     *= sJob.fBeta;
+				}
+				break;
+			}
+
+			case GridTurbulence3:
+			{
+				MemoryManager::Set(pfRow, 0, nWidth*sizeof(float));
+				float fFreq = sJob.fFreq;
+				do {
+					NoiseRow(NoiseGrid::Perlin, pfScratch, nWidth, fFreq*fX, fFreq*fY, fFreq*fZ, fFreq*sJob.fStep[0]);
+					const float fWeight = 1.0f/fFreq;
+					for (uint32 i=0; i<nWidth; i++)
+						pfRow[i] += pfScratch[i]*fWeight;
+					fFreq *= 0.5f;
+				} while (fFreq >= 1.0f);
+				break;
+			}
+
+			case GridTileableTurbulence3:
+			{
+				// See "PerlinNoiseTileable::TileableNoise3()": Blend the eight noise values of the tile corners
+				MemoryManager::Set(pfRow, 0, nWidth*sizeof(float));
+				float fFreq = sJob.fFreq;
+				do {
+					const float fW = sJob.fSize[0]*fFreq;
+					const float fH = sJob.fSize[1]*fFreq;
+					const float fD = sJob.fSize[2]*fFreq;
+					const float fFX = fFreq*fX;
+					const float fFY = fFreq*fY;
+					const float fFZ = fFreq*fZ;
+					const float fStepX = fFreq*sJob.fStep[0];
+					const float fNormalize = 1.0f/(fW*fH*fD*fFreq);
+					for (int nCorner=0; nCorner<8; nCorner++) {
+						const bool bX = (nCorner & 1) != 0;
+						const bool bY = (nCorner & 2) != 0;
+						const bool bZ = (nCorner & 4) != 0;
+						NoiseRow(NoiseGrid::Perlin, pfScratch, nWidth, bX ? fFX - fW : fFX, bY ? fFY - fH : fFY, bZ ? fFZ - fD : fFZ, fStepX);
+						const float fWeightYZ = (bY ? fFY : fH - fFY)*(bZ ? fFZ : fD - fFZ)*fNormalize;
+						for (uint32 i=0; i<nWidth; i++) {
+							const float fSampleX = fFX + static_cast<float>(i)*fStepX;
+							pfRow[i] += pfScratch[i]*(bX ? fSampleX : fW - fSampleX)*fWeightYZ;
+						}
+					}
+					fFreq *= 0.5f;
+				} while (fFreq >= 1.0f);
+				break;
+			}
+		}
+	}
+
+	// Cleanup
+	if (pfScratch)
+		delete [] pfScratch;
+}
+
+/**
+*  @brief
+*    Static thread function
+*/
+int GridThreadFunction(void *pData)
+{
+	ProcessRows(*static_cast<const GridJob*>(pData));
+	return 0;
+}
+
+/**
+*  @brief
+*    Splits the rows of a job across multiple threads and waits until all are processed
+*/
+void RunJob(GridJob &sJob, uint32 nNumOfRows, uint32 nNumOfThreads)
+{
+	// The Perlin noise tables must be initialized before the threads are using them
+	PerlinNoise::Init();
+
+	// Get the number of threads to use
+	if (!nNumOfThreads)
+		nNumOfThreads = System::GetInstance()->GetNumOfProcessors();
+	nNumOfThreads = Math::Min(nNumOfThreads, Math::Max(static_cast<uint32>(1), (nNumOfRows*sJob.nWidth)/MinSamplesPerThread));
+	nNumOfThreads = Math::Min(nNumOfThreads, nNumOfRows);
+
+	if (nNumOfThreads <= 1) {
+		// Do all the work right now
+		sJob.nFirstRow  = 0;
+		sJob.nNumOfRows = nNumOfRows;
+		ProcessRows(sJob);
+	} else {
+		// Give each thread a contiguous block of rows
+		GridJob *pJobs    = new GridJob[nNumOfThreads];
+		Thread **ppThreads = new Thread*[nNumOfThreads];
+		for (uint32 i=0; i<nNumOfThreads; i++) {
+			pJobs[i] = sJob;
+			pJobs[i].nFirstRow  = static_cast<uint32>((static_cast<uint64>(nNumOfRows)*i)/nNumOfThreads);
+			pJobs[i].nNumOfRows = static_cast<uint32>((static_cast<uint64>(nNumOfRows)*(i + 1))/nNumOfThreads) - pJobs[i].nFirstRow;
+		}
+
+		// Start the worker threads, the calling thread processes the first block itself
+		for (uint32 i=1; i<nNumOfThreads; i++) {
+			ppThreads[i] = new Thread(GridThreadFunction, &pJobs[i]);
+			if (!ppThreads[i]->Start()) {
+				// Thread creation failed, do the work within the calling thread instead
+				delete ppThreads[i];
+				ppThreads[i] = nullptr;
+				ProcessRows(pJobs[i]);
+			}
+		}
+		ProcessRows(pJobs[0]);
+
+		// Wait for the worker threads
+		for (uint32 i=1; i<nNumOfThreads; i++) {
+			if (ppThreads[i]) {
+				ppThreads[i]->Join();
+				delete ppThreads[i];
+			}
+		}
+
+		// Cleanup
+		delete [] ppThreads;
+		delete [] pJobs;
+	}
+}
+
+/**
+*  @brief
+*    Initializes a job with the common grid parameters
+*/
+void InitJob(GridJob &sJob, EGridFunction nFunction, NoiseGrid::ENoise nNoise, float *pfDestination, uint32 nWidth, uint32 nHeight, const Vector3 &vOrigin, const Vector3 &vStep)
+{
+	MemoryManager::Set(&sJob, 0, sizeof(GridJob));
+	sJob.nFunction	   = nFunction;
+	sJob.nNoise		   = nNoise;
+	sJob.pfDestination = pfDestination;
+	sJob.nWidth		   = nWidth;
+	sJob.nHeight	   = nHeight;
+	sJob.fOrigin[0]	   = vOrigin.x;
+	sJob.fOrigin[1]	   = vOrigin.y;
+	sJob.fOrigin[2]	   = vOrigin.z;
+	sJob.fStep[0]	   = vStep.x;
+	sJob.fStep[1]	   = vStep.y;
+	sJob.fStep[2]	   = vStep.z;
+}
+
+
+//[-------------------------------------------------------]
+//[ Public static functions                               ]
+//[-------------------------------------------------------]
+void NoiseGrid::Noise2(ENoise nNoise, float *pfDestination, uint32 nWidth, uint32 nHeight, const Vector2 &vOrigin, const Vector2 &vStep, uint32 nNumOfThreads)
+{
+	if (pfDestination && nWidth && nHeight) {
+		GridJob sJob;
+		InitJob(sJob, GridNoise2, nNoise, pfDestination, nWidth, nHeight, Vector3(vOrigin.x, vOrigin.y, 0.0f), Vector3(vStep.x, vStep.y, 0.0f));
+		RunJob(sJob, nHeight, nNumOfThreads);
+	}
+}
+
+void NoiseGrid::Noise3(ENoise nNoise, float *pfDestination, uint32 nWidth, uint32 nHeight, uint32 nDepth, const Vector3 &vOrigin, const Vector3 &vStep, uint32 nNumOfThreads)
+{
+	if (pfDestination && nWidth && nHeight && nDepth) {
+		GridJob sJob;
+		InitJob(sJob, GridNoise3, nNoise, pfDestination, nWidth, nHeight, vOrigin, vStep);
+		RunJob(sJob, nHeight*nDepth, nNumOfThreads);
+	}
+}
+
+void NoiseGrid::FractalSum3(ENoise nNoise, float *pfDestination, uint32 nWidth, uint32 nHeight, uint32 nDepth, const Vector3 &vOrigin, const Vector3 &vStep,
+							float fAlpha, float fBeta, uint32 nNumOfOctaves, uint32 nNumOfThreads)
+{
+	if (pfDestination && nWidth && nHeight && nDepth) {
+		GridJob sJob;
+		InitJob(sJob, GridFractalSum3, nNoise, pfDestination, nWidth, nHeight, vOrigin, vStep);
+		sJob.fAlpha		   = fAlpha;
+		sJob.fBeta		   = fBeta;
+		sJob.nNumOfOctaves = nNumOfOctaves;
+		RunJob(sJob, nHeight*nDepth, nNumOfThreads);
+	}
+}
+
+void NoiseGrid::Turbulence3(float *pfDestination, uint32 nWidth, uint32 nHeight, uint32 nDepth, const Vector3 &vOrigin, const Vector3 &vStep,
+							float fFreq, uint32 nNumOfThreads)
+{
+	if (pfDestination && nWidth && nHeight && nDepth) {
+		GridJob sJob;
+		InitJob(sJob, GridTurbulence3, Perlin, pfDestination, nWidth, nHeight, vOrigin, vStep);
+		sJob.fFreq = fFreq;
+		RunJob(sJob, nHeight*nDepth, nNumOfThreads);
+	}
+}
+
+void NoiseGrid::TileableTurbulence3(float *pfDestination, uint32 nWidth, uint32 nHeight, uint32 nDepth, const Vector3 &vOrigin, const Vector3 &vStep,
+									const Vector3 &vSize, float fFreq, uint32 nNumOfThreads)
+{
+	if (pfDestination && nWidth && nHeight && nDepth) {
+		GridJob sJob;
+		InitJob(sJob, GridTileableTurbulence3, Perlin, pfDestination, nWidth, nHeight, vOrigin, vStep);
+		sJob.fSize[0] = vSize.x;
+		sJob.fSize[1] = vSize.y;
+		sJob.fSize[2] = vSize.z;
+		sJob.fFreq	  = fFreq;
+		RunJob(sJob, nHeight*nDepth, nNumOfThreads);
+	}
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // PLMath
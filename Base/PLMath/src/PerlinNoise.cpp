@@ -32,11 +32,15 @@
 #include <math.h>
 #include <stdlib.h>
 #include "PLMath/PerlinNoise.h"
+#ifdef PLMATH_SSE2
+	#include <emmintrin.h>
+#endif
 
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
 //[-------------------------------------------------------]
+using namespace PLCore;
 namespace PLMath {
 
 
@@ -73,6 +77,9 @@ static double g3[B + B + 2][3];
 static double g2[B + B + 2][2];
 static double g1[B + B + 2];
 static int start = 1;
+// Single precision copies of the gradient tables used by the row functions, 3D gradients padded to four components
+static float g3f[B + B + 2][4];
+static float g2f[B + B + 2][2];
 
 
 //[-------------------------------------------------------]
@@ -124,12 +131,108 @@ void init(void)
 		for (j = 0 ; j < 3 ; j++)
 			g3[B + i][j] = g3[i][j];
 	}
+
+	for (i = 0 ; i < B + B + 2 ; i++) {
+		for (j = 0 ; j < 2 ; j++)
+			g2f[i][j] = static_cast<float>(g2[i][j]);
+		for (j = 0 ; j < 3 ; j++)
+			g3f[i][j] = static_cast<float>(g3[i][j]);
+		g3f[i][3] = 0.0f;
+	}
+}
+
+/**
+*  @brief
+*    Single precision version of the "setup" macro
+*
+*  @remarks
+*    "(int)(t + N) & BM" equals "floor(t) & BM" for all t > -N, using floor directly avoids the
+*    precision loss of adding N in single precision.
+*/
+inline void setupf(float t, int &b0, int &b1, float &r0, float &r1)
+{
+	int i = static_cast<int>(t);
+	if (t < static_cast<float>(i))
+		i--;
+	b0 = i & BM;
+	b1 = (b0+1) & BM;
+	r0 = t - static_cast<float>(i);
+	r1 = r0 - 1.0f;
 }
 
+inline float s_curvef(float t)
+{
+	return t*t*(3.0f - 2.0f*t);
+}
+
+inline float lerpf(float t, float a, float b)
+{
+	return a + t*(b - a);
+}
+
+#ifdef PLMATH_SSE2
+	/**
+	*  @brief
+	*    Returns floor(x) of four values (SSE2 has no floor instruction)
+	*/
+	inline __m128 floor_ps(__m128 x, __m128i &i)
+	{
+		i = _mm_cvttps_epi32(x);
+		const __m128 t    = _mm_cvtepi32_ps(i);
+		const __m128 mask = _mm_cmpgt_ps(t, x);
+		// mask is -1 for lanes which were rounded up
+		i = _mm_add_epi32(i, _mm_castps_si128(mask));
+		return _mm_sub_ps(t, _mm_and_ps(mask, _mm_set1_ps(1.0f)));
+	}
+
+	inline __m128 s_curve_ps(__m128 t)
+	{
+		return _mm_mul_ps(_mm_mul_ps(t, t), _mm_sub_ps(_mm_set1_ps(3.0f), _mm_add_ps(t, t)));
+	}
+
+	inline __m128 lerp_ps(__m128 t, __m128 a, __m128 b)
+	{
+		return _mm_add_ps(a, _mm_mul_ps(t, _mm_sub_ps(b, a)));
+	}
+
+	/**
+	*  @brief
+	*    Gathers four 2D gradients and returns their dot products with (rx, ry)
+	*/
+	inline __m128 at2_ps(const int nIndex[4], __m128 rx, __m128 ry)
+	{
+		const __m128 gx = _mm_set_ps(g2f[nIndex[3]][0], g2f[nIndex[2]][0], g2f[nIndex[1]][0], g2f[nIndex[0]][0]);
+		const __m128 gy = _mm_set_ps(g2f[nIndex[3]][1], g2f[nIndex[2]][1], g2f[nIndex[1]][1], g2f[nIndex[0]][1]);
+		return _mm_add_ps(_mm_mul_ps(gx, rx), _mm_mul_ps(gy, ry));
+	}
+
+	/**
+	*  @brief
+	*    Gathers four 3D gradients and returns their dot products with (rx, ry, rz)
+	*/
+	inline __m128 at3_ps(const int nIndex[4], __m128 rx, __m128 ry, __m128 rz)
+	{
+		__m128 gx = _mm_loadu_ps(g3f[nIndex[0]]);
+		__m128 gy = _mm_loadu_ps(g3f[nIndex[1]]);
+		__m128 gz = _mm_loadu_ps(g3f[nIndex[2]]);
+		__m128 gw = _mm_loadu_ps(g3f[nIndex[3]]);
+		_MM_TRANSPOSE4_PS(gx, gy, gz, gw);
+		return _mm_add_ps(_mm_add_ps(_mm_mul_ps(gx, rx), _mm_mul_ps(gy, ry)), _mm_mul_ps(gz, rz));
+	}
+#endif
+
 
 //[-------------------------------------------------------]
 //[ Public static functions                               ]
 //[-------------------------------------------------------]
+void PerlinNoise::Init()
+{
+	if (start) {
+		start = 0;
+		init();
+	}
+}
+
 double PerlinNoise::Noise1(double arg)
 {
 	int bx0, bx1;
@@ -236,6 +339,185 @@ double PerlinNoise::Noise3(const double vec[3])
 	return lerp(sz, c, d);
 }
 
+void PerlinNoise::Noise2Row(float *pfDestination, uint32 nCount, float fX, float fY, float fStepX)
+{
+	int by0, by1;
+	float ry0, ry1;
+
+	Init();
+
+	// The y part is the same for the whole row
+	setupf(fY, by0, by1, ry0, ry1);
+	const float sy = s_curvef(ry0);
+
+	uint32 nSample = 0;
+#ifdef PLMATH_SSE2
+	{
+		const __m128 vOne  = _mm_set1_ps(1.0f);
+		const __m128 vStep = _mm_set1_ps(fStepX);
+		const __m128 vRy0  = _mm_set1_ps(ry0);
+		const __m128 vRy1  = _mm_set1_ps(ry1);
+		const __m128 vSy   = _mm_set1_ps(sy);
+		int nBx[4];
+		int nB00[4], nB10[4], nB01[4], nB11[4];
+
+		for (; nSample+4<=nCount; nSample+=4, pfDestination+=4) {
+			const __m128 vX = _mm_add_ps(_mm_set1_ps(fX), _mm_mul_ps(_mm_set_ps(static_cast<float>(nSample+3), static_cast<float>(nSample+2), static_cast<float>(nSample+1), static_cast<float>(nSample)), vStep));
+			__m128i vXi;
+			const __m128 vRx0 = _mm_sub_ps(vX, floor_ps(vX, vXi));
+			const __m128 vRx1 = _mm_sub_ps(vRx0, vOne);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(nBx), vXi);
+
+			// Permutation table lookups can't be vectorized with SSE2
+			for (int nLane=0; nLane<4; nLane++) {
+				const int bx0 = nBx[nLane] & BM;
+				const int i = p[ bx0 ];
+				const int j = p[ (bx0+1) & BM ];
+				nB00[nLane] = p[ i + by0 ];
+				nB10[nLane] = p[ j + by0 ];
+				nB01[nLane] = p[ i + by1 ];
+				nB11[nLane] = p[ j + by1 ];
+			}
+
+			const __m128 vSx = s_curve_ps(vRx0);
+			const __m128 a = lerp_ps(vSx, at2_ps(nB00, vRx0, vRy0), at2_ps(nB10, vRx1, vRy0));
+			const __m128 b = lerp_ps(vSx, at2_ps(nB01, vRx0, vRy1), at2_ps(nB11, vRx1, vRy1));
+			_mm_storeu_ps(pfDestination, lerp_ps(vSy, a, b));
+		}
+	}
+#endif
+
+	// Remaining samples
+	for (; nSample<nCount; nSample++, pfDestination++) {
+		int bx0, bx1;
+		float rx0, rx1;
+		setupf(fX + static_cast<float>(nSample)*fStepX, bx0, bx1, rx0, rx1);
+
+		const int i = p[ bx0 ];
+		const int j = p[ bx1 ];
+		const float *q;
+		float u, v;
+
+		const float sx = s_curvef(rx0);
+
+		q = g2f[ p[ i + by0 ] ] ; u = at2(rx0,ry0);
+		q = g2f[ p[ j + by0 ] ] ; v = at2(rx1,ry0);
+		const float a = lerpf(sx, u, v);
+
+		q = g2f[ p[ i + by1 ] ] ; u = at2(rx0,ry1);
+		q = g2f[ p[ j + by1 ] ] ; v = at2(rx1,ry1);
+		const float b = lerpf(sx, u, v);
+
+		*pfDestination = lerpf(sy, a, b);
+	}
+}
+
+void PerlinNoise::Noise3Row(float *pfDestination, uint32 nCount, float fX, float fY, float fZ, float fStepX)
+{
+	int by0, by1, bz0, bz1;
+	float ry0, ry1, rz0, rz1;
+
+	Init();
+
+	// The y and z parts are the same for the whole row
+	setupf(fY, by0, by1, ry0, ry1);
+	setupf(fZ, bz0, bz1, rz0, rz1);
+	const float sy = s_curvef(ry0);
+	const float sz = s_curvef(rz0);
+
+	uint32 nSample = 0;
+#ifdef PLMATH_SSE2
+	{
+		const __m128 vOne  = _mm_set1_ps(1.0f);
+		const __m128 vStep = _mm_set1_ps(fStepX);
+		const __m128 vRy0  = _mm_set1_ps(ry0);
+		const __m128 vRy1  = _mm_set1_ps(ry1);
+		const __m128 vRz0  = _mm_set1_ps(rz0);
+		const __m128 vRz1  = _mm_set1_ps(rz1);
+		const __m128 vSy   = _mm_set1_ps(sy);
+		const __m128 vSz   = _mm_set1_ps(sz);
+		int nBx[4];
+		int nCorner[8][4];
+
+		for (; nSample+4<=nCount; nSample+=4, pfDestination+=4) {
+			const __m128 vX = _mm_add_ps(_mm_set1_ps(fX), _mm_mul_ps(_mm_set_ps(static_cast<float>(nSample+3), static_cast<float>(nSample+2), static_cast<float>(nSample+1), static_cast<float>(nSample)), vStep));
+			__m128i vXi;
+			const __m128 vRx0 = _mm_sub_ps(vX, floor_ps(vX, vXi));
+			const __m128 vRx1 = _mm_sub_ps(vRx0, vOne);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(nBx), vXi);
+
+			// Permutation table lookups can't be vectorized with SSE2
+			for (int nLane=0; nLane<4; nLane++) {
+				const int bx0 = nBx[nLane] & BM;
+				const int i = p[ bx0 ];
+				const int j = p[ (bx0+1) & BM ];
+				const int b00 = p[ i + by0 ];
+				const int b10 = p[ j + by0 ];
+				const int b01 = p[ i + by1 ];
+				const int b11 = p[ j + by1 ];
+				nCorner[0][nLane] = b00 + bz0;
+				nCorner[1][nLane] = b10 + bz0;
+				nCorner[2][nLane] = b01 + bz0;
+				nCorner[3][nLane] = b11 + bz0;
+				nCorner[4][nLane] = b00 + bz1;
+				nCorner[5][nLane] = b10 + bz1;
+				nCorner[6][nLane] = b01 + bz1;
+				nCorner[7][nLane] = b11 + bz1;
+			}
+
+			const __m128 t = s_curve_ps(vRx0);
+			__m128 a = lerp_ps(t, at3_ps(nCorner[0], vRx0, vRy0, vRz0), at3_ps(nCorner[1], vRx1, vRy0, vRz0));
+			__m128 b = lerp_ps(t, at3_ps(nCorner[2], vRx0, vRy1, vRz0), at3_ps(nCorner[3], vRx1, vRy1, vRz0));
+			const __m128 c = lerp_ps(vSy, a, b);
+			a = lerp_ps(t, at3_ps(nCorner[4], vRx0, vRy0, vRz1), at3_ps(nCorner[5], vRx1, vRy0, vRz1));
+			b = lerp_ps(t, at3_ps(nCorner[6], vRx0, vRy1, vRz1), at3_ps(nCorner[7], vRx1, vRy1, vRz1));
+			const __m128 d = lerp_ps(vSy, a, b);
+			_mm_storeu_ps(pfDestination, lerp_ps(vSz, c, d));
+		}
+	}
+#endif
+
+	// Remaining samples
+	for (; nSample<nCount; nSample++, pfDestination++) {
+		int bx0, bx1;
+		float rx0, rx1;
+		setupf(fX + static_cast<float>(nSample)*fStepX, bx0, bx1, rx0, rx1);
+
+		const int i = p[ bx0 ];
+		const int j = p[ bx1 ];
+		const int b00 = p[ i + by0 ];
+		const int b10 = p[ j + by0 ];
+		const int b01 = p[ i + by1 ];
+		const int b11 = p[ j + by1 ];
+		const float *q;
+		float u, v, a, b;
+
+		const float t = s_curvef(rx0);
+
+		q = g3f[ b00 + bz0 ] ; u = at3(rx0,ry0,rz0);
+		q = g3f[ b10 + bz0 ] ; v = at3(rx1,ry0,rz0);
+		a = lerpf(t, u, v);
+
+		q = g3f[ b01 + bz0 ] ; u = at3(rx0,ry1,rz0);
+		q = g3f[ b11 + bz0 ] ; v = at3(rx1,ry1,rz0);
+		b = lerpf(t, u, v);
+
+		const float c = lerpf(sy, a, b);
+
+		q = g3f[ b00 + bz1 ] ; u = at3(rx0,ry0,rz1);
+		q = g3f[ b10 + bz1 ] ; v = at3(rx1,ry0,rz1);
+		a = lerpf(t, u, v);
+
+		q = g3f[ b01 + bz1 ] ; u = at3(rx0,ry1,rz1);
+		q = g3f[ b11 + bz1 ] ; v = at3(rx1,ry1,rz1);
+		b = lerpf(t, u, v);
+
+		const float d = lerpf(sy, a, b);
+
+		*pfDestination = lerpf(sz, c, d);
+	}
+}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
@@ -0,0 +1,568 @@
+/*********************************************************\
+ *  File: PoseBuffer.cpp                                 *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <PLCore/Core/MemoryManager.h>
+#include "PLMath/Math.h"
+#include "PLMath/Matrix3x4.h"
+#include "PLMath/PoseBuffer.h"
+#ifdef PLMATH_SSE2
+	#include <emmintrin.h>
+#endif
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+using namespace PLCore;
+namespace PLMath {
+
+
+//[-------------------------------------------------------]
+//[ Global helper functions                               ]
+//[-------------------------------------------------------]
+#ifdef PLMATH_SSE2
+	/**
+	*  @brief
+	*    Returns the arc cosine of four values within [0, 1]
+	*
+	*  @remarks
+	*    Polynomial approximation from Abramowitz and Stegun, "Handbook of Mathematical Functions", 4.4.46 (error <= 2e-8)
+	*/
+	inline __m128 ACos01(__m128 fX)
+	{
+		__m128 fResult = _mm_set1_ps(-0.0012624911f);
+		fResult = _mm_add_ps(_mm_mul_ps(fResult, fX), _mm_set1_ps( 0.0066700901f));
+		fResult = _mm_add_ps(_mm_mul_ps(fResult, fX), _mm_set1_ps(-0.0170881256f));
+		fResult = _mm_add_ps(_mm_mul_ps(fResult, fX), _mm_set1_ps( 0.0308918810f));
+		fResult = _mm_add_ps(_mm_mul_ps(fResult, fX), _mm_set1_ps(-0.0501743046f));
+		fResult = _mm_add_ps(_mm_mul_ps(fResult, fX), _mm_set1_ps( 0.0889789874f));
+		fResult = _mm_add_ps(_mm_mul_ps(fResult, fX), _mm_set1_ps(-0.2145988016f));
+		fResult = _mm_add_ps(_mm_mul_ps(fResult, fX), _mm_set1_ps( 1.5707963050f));
+		return _mm_mul_ps(fResult, _mm_sqrt_ps(_mm_max_ps(_mm_sub_ps(_mm_set1_ps(1.0f), fX), _mm_setzero_ps())));
+	}
+
+	/**
+	*  @brief
+	*    Returns the sine of four values within [-pi/2, pi/2]
+	*
+	*  @remarks
+	*    Taylor series up to x^11 (error < 6e-8 within the valid range)
+	*/
+	inline __m128 SinHalfPi(__m128 fX)
+	{
+		const __m128 fX2 = _mm_mul_ps(fX, fX);
+		__m128 fResult = _mm_set1_ps(-1.0f/39916800.0f);
+		fResult = _mm_add_ps(_mm_mul_ps(fResult, fX2), _mm_set1_ps( 1.0f/362880.0f));
+		fResult = _mm_add_ps(_mm_mul_ps(fResult, fX2), _mm_set1_ps(-1.0f/5040.0f));
+		fResult = _mm_add_ps(_mm_mul_ps(fResult, fX2), _mm_set1_ps( 1.0f/120.0f));
+		fResult = _mm_add_ps(_mm_mul_ps(fResult, fX2), _mm_set1_ps(-1.0f/6.0f));
+		fResult = _mm_add_ps(_mm_mul_ps(fResult, fX2), _mm_set1_ps( 1.0f));
+		return _mm_mul_ps(fResult, fX);
+	}
+
+	/**
+	*  @brief
+	*    Linear interpolation of four values
+	*/
+	inline __m128 Lerp(__m128 fA, __m128 fB, __m128 fTime)
+	{
+		return _mm_add_ps(fA, _mm_mul_ps(_mm_sub_ps(fB, fA), fTime));
+	}
+
+	/**
+	*  @brief
+	*    Dot product of four quaternion pairs
+	*/
+	inline __m128 Dot4(__m128 fW1, __m128 fX1, __m128 fY1, __m128 fZ1, __m128 fW2, __m128 fX2, __m128 fY2, __m128 fZ2)
+	{
+		return _mm_add_ps(_mm_add_ps(_mm_mul_ps(fW1, fW2), _mm_mul_ps(fX1, fX2)), _mm_add_ps(_mm_mul_ps(fY1, fY2), _mm_mul_ps(fZ1, fZ2)));
+	}
+
+	/**
+	*  @brief
+	*    Linear interpolation of the positions and scales of four joints
+	*/
+	inline void LerpPositionsScales(const PoseBuffer &cPose1, const PoseBuffer &cPose2, uint32 nJoint, __m128 fTime, PoseBuffer &cResult)
+	{
+		// Written out instead of using a loop, else GCC -O2 keeps the values on the stack
+		_mm_store_ps(cResult.GetPositions(0) + nJoint, Lerp(_mm_load_ps(cPose1.GetPositions(0) + nJoint), _mm_load_ps(cPose2.GetPositions(0) + nJoint), fTime));
+		_mm_store_ps(cResult.GetPositions(1) + nJoint, Lerp(_mm_load_ps(cPose1.GetPositions(1) + nJoint), _mm_load_ps(cPose2.GetPositions(1) + nJoint), fTime));
+		_mm_store_ps(cResult.GetPositions(2) + nJoint, Lerp(_mm_load_ps(cPose1.GetPositions(2) + nJoint), _mm_load_ps(cPose2.GetPositions(2) + nJoint), fTime));
+		_mm_store_ps(cResult.GetScales(0)    + nJoint, Lerp(_mm_load_ps(cPose1.GetScales(0)    + nJoint), _mm_load_ps(cPose2.GetScales(0)    + nJoint), fTime));
+		_mm_store_ps(cResult.GetScales(1)    + nJoint, Lerp(_mm_load_ps(cPose1.GetScales(1)    + nJoint), _mm_load_ps(cPose2.GetScales(1)    + nJoint), fTime));
+		_mm_store_ps(cResult.GetScales(2)    + nJoint, Lerp(_mm_load_ps(cPose1.GetScales(2)    + nJoint), _mm_load_ps(cPose2.GetScales(2)    + nJoint), fTime));
+	}
+
+	/**
+	*  @brief
+	*    Normalized linear interpolation of the rotations of four joints
+	*/
+	inline void NlerpRotations(const PoseBuffer &cPose1, const PoseBuffer &cPose2, uint32 nJoint, __m128 fTime, PoseBuffer &cResult)
+	{
+		// Load the quaternions
+		const __m128 fFromW = _mm_load_ps(cPose1.GetRotations(0) + nJoint);
+		const __m128 fFromX = _mm_load_ps(cPose1.GetRotations(1) + nJoint);
+		const __m128 fFromY = _mm_load_ps(cPose1.GetRotations(2) + nJoint);
+		const __m128 fFromZ = _mm_load_ps(cPose1.GetRotations(3) + nJoint);
+		__m128 fToW = _mm_load_ps(cPose2.GetRotations(0) + nJoint);
+		__m128 fToX = _mm_load_ps(cPose2.GetRotations(1) + nJoint);
+		__m128 fToY = _mm_load_ps(cPose2.GetRotations(2) + nJoint);
+		__m128 fToZ = _mm_load_ps(cPose2.GetRotations(3) + nJoint);
+
+		// Interpolate along the shortest path: Flip the sign of the target quaternion if the cosine is negative
+		const __m128 fSign = _mm_and_ps(Dot4(fFromW, fFromX, fFromY, fFromZ, fToW, fToX, fToY, fToZ), _mm_castsi128_ps(_mm_set1_epi32(static_cast<int>(0x80000000u))));
+		fToW = Lerp(fFromW, _mm_xor_ps(fToW, fSign), fTime);
+		fToX = Lerp(fFromX, _mm_xor_ps(fToX, fSign), fTime);
+		fToY = Lerp(fFromY, _mm_xor_ps(fToY, fSign), fTime);
+		fToZ = Lerp(fFromZ, _mm_xor_ps(fToZ, fSign), fTime);
+
+		// Normalize
+		const __m128 fInvLength = _mm_div_ps(_mm_set1_ps(1.0f), _mm_max_ps(_mm_sqrt_ps(Dot4(fToW, fToX, fToY, fToZ, fToW, fToX, fToY, fToZ)), _mm_set1_ps(1e-20f)));
+		_mm_store_ps(cResult.GetRotations(0) + nJoint, _mm_mul_ps(fToW, fInvLength));
+		_mm_store_ps(cResult.GetRotations(1) + nJoint, _mm_mul_ps(fToX, fInvLength));
+		_mm_store_ps(cResult.GetRotations(2) + nJoint, _mm_mul_ps(fToY, fInvLength));
+		_mm_store_ps(cResult.GetRotations(3) + nJoint, _mm_mul_ps(fToZ, fInvLength));
+	}
+#else
+	/**
+	*  @brief
+	*    Normalized linear interpolation of the pose of a joint
+	*/
+	void NlerpJoint(const PoseBuffer &cPose1, const PoseBuffer &cPose2, uint32 nJoint, float fTime, PoseBuffer &cResult)
+	{
+		const Quaternion qFrom = cPose1.GetRotation(nJoint);
+		Quaternion qTo = cPose2.GetRotation(nJoint);
+		if (qFrom.DotProduct(qTo) < 0.0f)
+			qTo *= -1.0f;	// Shortest path (note that the unary minus operator of "Quaternion" returns the inverse)
+		cResult.SetJoint(nJoint, cPose1.GetPosition(nJoint) + (cPose2.GetPosition(nJoint) - cPose1.GetPosition(nJoint))*fTime,
+								 (qFrom + (qTo - qFrom)*fTime).GetNormalized(),
+								 cPose1.GetScale(nJoint)    + (cPose2.GetScale(nJoint)    - cPose1.GetScale(nJoint))*fTime);
+	}
+#endif
+
+
+//[-------------------------------------------------------]
+//[ Public static functions                               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Normalized linear interpolation between two poses
+*/
+bool PoseBuffer::Nlerp(const PoseBuffer &cPose1, const PoseBuffer &cPose2, float fTime, PoseBuffer &cResult)
+{
+	// Check the number of joints
+	if (cPose1.m_nNumOfJoints != cPose2.m_nNumOfJoints)
+		return false; // Error!
+	cResult.Resize(cPose1.m_nNumOfJoints);
+
+	#ifdef PLMATH_SSE2
+		// The padding contains identity poses, so we can process blocks of four joints
+		const __m128 fTimeSSE = _mm_set1_ps(fTime);
+		for (uint32 nJoint=0; nJoint<cPose1.m_nNumOfJoints; nJoint+=4) {
+			LerpPositionsScales(cPose1, cPose2, nJoint, fTimeSSE, cResult);
+			NlerpRotations(cPose1, cPose2, nJoint, fTimeSSE, cResult);
+		}
+	#else
+		for (uint32 nJoint=0; nJoint<cPose1.m_nNumOfJoints; nJoint++)
+			NlerpJoint(cPose1, cPose2, nJoint, fTime, cResult);
+	#endif
+
+	// Done
+	return true;
+}
+
+/**
+*  @brief
+*    Spherical linear interpolation between two poses
+*/
+bool PoseBuffer::Slerp(const PoseBuffer &cPose1, const PoseBuffer &cPose2, float fTime, PoseBuffer &cResult)
+{
+	// Check the number of joints
+	if (cPose1.m_nNumOfJoints != cPose2.m_nNumOfJoints)
+		return false; // Error!
+	cResult.Resize(cPose1.m_nNumOfJoints);
+
+	#ifdef PLMATH_SSE2
+		// The padding contains identity poses, so we can process blocks of four joints
+		const __m128 fTimeSSE    = _mm_set1_ps(fTime);
+		const __m128 fOneSSE     = _mm_set1_ps(1.0f);
+		const __m128 fSignMask   = _mm_castsi128_ps(_mm_set1_epi32(static_cast<int>(0x80000000u)));
+		const __m128 fEpsilonSSE = _mm_set1_ps(static_cast<float>(Math::Epsilon));
+		for (uint32 nJoint=0; nJoint<cPose1.m_nNumOfJoints; nJoint+=4) {
+			LerpPositionsScales(cPose1, cPose2, nJoint, fTimeSSE, cResult);
+
+			// Load the quaternions
+			const __m128 fFromW = _mm_load_ps(cPose1.GetRotations(0) + nJoint);
+			const __m128 fFromX = _mm_load_ps(cPose1.GetRotations(1) + nJoint);
+			const __m128 fFromY = _mm_load_ps(cPose1.GetRotations(2) + nJoint);
+			const __m128 fFromZ = _mm_load_ps(cPose1.GetRotations(3) + nJoint);
+			const __m128 fToW   = _mm_load_ps(cPose2.GetRotations(0) + nJoint);
+			const __m128 fToX   = _mm_load_ps(cPose2.GetRotations(1) + nJoint);
+			const __m128 fToY   = _mm_load_ps(cPose2.GetRotations(2) + nJoint);
+			const __m128 fToZ   = _mm_load_ps(cPose2.GetRotations(3) + nJoint);
+
+			// Calculate the cosine and adjust the signs
+			__m128 fCosom = Dot4(fFromW, fFromX, fFromY, fFromZ, fToW, fToX, fToY, fToZ);
+			const __m128 fSign = _mm_and_ps(fCosom, fSignMask);
+			fCosom = _mm_min_ps(_mm_xor_ps(fCosom, fSign), fOneSSE);
+
+			// Calculate coefficients, if the quaternions are very close a linear interpolation is used
+			const __m128 fOmega   = ACos01(fCosom);
+			const __m128 fSinom   = _mm_max_ps(_mm_sqrt_ps(_mm_max_ps(_mm_sub_ps(fOneSSE, _mm_mul_ps(fCosom, fCosom)), _mm_setzero_ps())), fEpsilonSSE);
+			const __m128 fLinear  = _mm_cmple_ps(_mm_sub_ps(fOneSSE, fCosom), fEpsilonSSE);
+			const __m128 fScale0  = _mm_div_ps(SinHalfPi(_mm_mul_ps(_mm_sub_ps(fOneSSE, fTimeSSE), fOmega)), fSinom);
+			const __m128 fScale1  = _mm_div_ps(SinHalfPi(_mm_mul_ps(fTimeSSE, fOmega)), fSinom);
+			const __m128 fScale0F = _mm_or_ps(_mm_and_ps(fLinear, _mm_sub_ps(fOneSSE, fTimeSSE)), _mm_andnot_ps(fLinear, fScale0));
+			const __m128 fScale1F = _mm_xor_ps(_mm_or_ps(_mm_and_ps(fLinear, fTimeSSE), _mm_andnot_ps(fLinear, fScale1)), fSign);
+
+			// Calculate final values
+			_mm_store_ps(cResult.GetRotations(0) + nJoint, _mm_add_ps(_mm_mul_ps(fScale0F, fFromW), _mm_mul_ps(fScale1F, fToW)));
+			_mm_store_ps(cResult.GetRotations(1) + nJoint, _mm_add_ps(_mm_mul_ps(fScale0F, fFromX), _mm_mul_ps(fScale1F, fToX)));
+			_mm_store_ps(cResult.GetRotations(2) + nJoint, _mm_add_ps(_mm_mul_ps(fScale0F, fFromY), _mm_mul_ps(fScale1F, fToY)));
+			_mm_store_ps(cResult.GetRotations(3) + nJoint, _mm_add_ps(_mm_mul_ps(fScale0F, fFromZ), _mm_mul_ps(fScale1F, fToZ)));
+		}
+	#else
+		for (uint32 nJoint=0; nJoint<cPose1.m_nNumOfJoints; nJoint++) {
+			Quaternion qRotation;
+			qRotation.Slerp(cPose1.GetRotation(nJoint), cPose2.GetRotation(nJoint), fTime);
+			cResult.SetJoint(nJoint, cPose1.GetPosition(nJoint) + (cPose2.GetPosition(nJoint) - cPose1.GetPosition(nJoint))*fTime,
+									 qRotation,
+									 cPose1.GetScale(nJoint)    + (cPose2.GetScale(nJoint)    - cPose1.GetScale(nJoint))*fTime);
+		}
+	#endif
+
+	// Done
+	return true;
+}
+
+/**
+*  @brief
+*    Blends two poses by using a weight per joint
+*/
+bool PoseBuffer::Blend(const PoseBuffer &cPose1, const PoseBuffer &cPose2, const float *pfWeights, PoseBuffer &cResult)
+{
+	// Check the number of joints
+	if (cPose1.m_nNumOfJoints != cPose2.m_nNumOfJoints)
+		return false; // Error!
+	cResult.Resize(cPose1.m_nNumOfJoints);
+
+	#ifdef PLMATH_SSE2
+		// The given weights are not padded, so the last block is loaded from a padded copy
+		const uint32 nNumOfFullBlockJoints = cPose1.m_nNumOfJoints & ~3u;
+		for (uint32 nJoint=0; nJoint<cPose1.m_nNumOfJoints; nJoint+=4) {
+			__m128 fWeight;
+			if (nJoint < nNumOfFullBlockJoints) {
+				fWeight = _mm_loadu_ps(pfWeights + nJoint);
+			} else {
+				float fLastWeights[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+				for (uint32 i=nJoint; i<cPose1.m_nNumOfJoints; i++)
+					fLastWeights[i - nJoint] = pfWeights[i];
+				fWeight = _mm_loadu_ps(fLastWeights);
+			}
+			LerpPositionsScales(cPose1, cPose2, nJoint, fWeight, cResult);
+			NlerpRotations(cPose1, cPose2, nJoint, fWeight, cResult);
+		}
+	#else
+		for (uint32 nJoint=0; nJoint<cPose1.m_nNumOfJoints; nJoint++)
+			NlerpJoint(cPose1, cPose2, nJoint, pfWeights[nJoint], cResult);
+	#endif
+
+	// Done
+	return true;
+}
+
+/**
+*  @brief
+*    Concatenates a local space pose along the joint hierarchy into a model space pose
+*/
+void PoseBuffer::LocalToModel(const PoseBuffer &cLocal, const int32 *pnParents, PoseBuffer &cModel)
+{
+	// Copy the local pose, this also gives us the root joints
+	if (&cModel != &cLocal)
+		cModel = cLocal;
+
+	// Get the component arrays
+	float *pfPosition[3], *pfRotation[4], *pfScale[3];
+	for (uint32 i=0; i<3; i++) {
+		pfPosition[i] = cModel.GetPositions(i);
+		pfScale[i]    = cModel.GetScales(i);
+	}
+	for (uint32 i=0; i<4; i++)
+		pfRotation[i] = cModel.GetRotations(i);
+
+	// Parents are located in front of their children, so they are already within model space
+	for (uint32 nJoint=0; nJoint<cModel.m_nNumOfJoints; nJoint++) {
+		const int32 nParent = pnParents[nJoint];
+		if (nParent >= 0 && static_cast<uint32>(nParent) < nJoint) {
+			// Parent rotation
+			const float pw = pfRotation[0][nParent];
+			const float px = pfRotation[1][nParent];
+			const float py = pfRotation[2][nParent];
+			const float pz = pfRotation[3][nParent];
+
+			// Position: Parent position + parent rotation*(parent scale*local position)
+			const float vx = pfScale[0][nParent]*pfPosition[0][nJoint];
+			const float vy = pfScale[1][nParent]*pfPosition[1][nJoint];
+			const float vz = pfScale[2][nParent]*pfPosition[2][nJoint];
+			const float tx = 2.0f*(py*vz - pz*vy);
+			const float ty = 2.0f*(pz*vx - px*vz);
+			const float tz = 2.0f*(px*vy - py*vx);
+			pfPosition[0][nJoint] = pfPosition[0][nParent] + vx + pw*tx + (py*tz - pz*ty);
+			pfPosition[1][nJoint] = pfPosition[1][nParent] + vy + pw*ty + (pz*tx - px*tz);
+			pfPosition[2][nJoint] = pfPosition[2][nParent] + vz + pw*tz + (px*ty - py*tx);
+
+			// Rotation: Parent rotation*local rotation
+			const float lw = pfRotation[0][nJoint];
+			const float lx = pfRotation[1][nJoint];
+			const float ly = pfRotation[2][nJoint];
+			const float lz = pfRotation[3][nJoint];
+			pfRotation[0][nJoint] = pw*lw - px*lx - py*ly - pz*lz;
+			pfRotation[1][nJoint] = pw*lx + px*lw + py*lz - pz*ly;
+			pfRotation[2][nJoint] = pw*ly + py*lw + pz*lx - px*lz;
+			pfRotation[3][nJoint] = pw*lz + pz*lw + px*ly - py*lx;
+
+			// Scale: Parent scale*local scale
+			pfScale[0][nJoint] *= pfScale[0][nParent];
+			pfScale[1][nJoint] *= pfScale[1][nParent];
+			pfScale[2][nJoint] *= pfScale[2][nParent];
+		}
+	}
+}
+
+/**
+*  @brief
+*    Converts the joint poses into transform matrices
+*/
+void PoseBuffer::ToMatrices(const PoseBuffer &cPose, Matrix3x4 *pmDestination)
+{
+	#ifdef PLMATH_SSE2
+		// The padding contains identity poses, so we can process blocks of four joints
+		for (uint32 nJoint=0; nJoint<cPose.m_nNumOfJoints; nJoint+=4) {
+			// Load the rotations
+			const __m128 w = _mm_load_ps(cPose.GetRotations(Quaternion::W) + nJoint);
+			const __m128 x = _mm_load_ps(cPose.GetRotations(Quaternion::X) + nJoint);
+			const __m128 y = _mm_load_ps(cPose.GetRotations(Quaternion::Y) + nJoint);
+			const __m128 z = _mm_load_ps(cPose.GetRotations(Quaternion::Z) + nJoint);
+
+			// See "Quaternion::ToRotationMatrix()"
+			const __m128 fTx  = _mm_add_ps(x, x);
+			const __m128 fTy  = _mm_add_ps(y, y);
+			const __m128 fTz  = _mm_add_ps(z, z);
+			const __m128 fTwx = _mm_mul_ps(fTx, w);
+			const __m128 fTwy = _mm_mul_ps(fTy, w);
+			const __m128 fTwz = _mm_mul_ps(fTz, w);
+			const __m128 fTxx = _mm_mul_ps(fTx, x);
+			const __m128 fTxy = _mm_mul_ps(fTy, x);
+			const __m128 fTxz = _mm_mul_ps(fTz, x);
+			const __m128 fTyy = _mm_mul_ps(fTy, y);
+			const __m128 fTyz = _mm_mul_ps(fTz, y);
+			const __m128 fTzz = _mm_mul_ps(fTz, z);
+			const __m128 fOne = _mm_set1_ps(1.0f);
+
+			// The axes are scaled by the joint scale
+			const __m128 fScaleX = _mm_load_ps(cPose.GetScales(Vector3::X) + nJoint);
+			const __m128 fScaleY = _mm_load_ps(cPose.GetScales(Vector3::Y) + nJoint);
+			const __m128 fScaleZ = _mm_load_ps(cPose.GetScales(Vector3::Z) + nJoint);
+
+			// Matrix elements in memory order (column major: xx, yx, zx, xy, yy, zy, xz, yz, zz, xw, yw, zw)
+			__m128 fM[12] = {
+				_mm_mul_ps(_mm_sub_ps(fOne, _mm_add_ps(fTyy, fTzz)), fScaleX),
+				_mm_mul_ps(_mm_add_ps(fTxy, fTwz), fScaleX),
+				_mm_mul_ps(_mm_sub_ps(fTxz, fTwy), fScaleX),
+				_mm_mul_ps(_mm_sub_ps(fTxy, fTwz), fScaleY),
+				_mm_mul_ps(_mm_sub_ps(fOne, _mm_add_ps(fTxx, fTzz)), fScaleY),
+				_mm_mul_ps(_mm_add_ps(fTyz, fTwx), fScaleY),
+				_mm_mul_ps(_mm_add_ps(fTxz, fTwy), fScaleZ),
+				_mm_mul_ps(_mm_sub_ps(fTyz, fTwx), fScaleZ),
+				_mm_mul_ps(_mm_sub_ps(fOne, _mm_add_ps(fTxx, fTyy)), fScaleZ),
+				_mm_load_ps(cPose.GetPositions(Vector3::X) + nJoint),
+				_mm_load_ps(cPose.GetPositions(Vector3::Y) + nJoint),
+				_mm_load_ps(cPose.GetPositions(Vector3::Z) + nJoint)
+			};
+
+			// Transpose from four joints per register into four consecutive elements of one matrix per register
+			_MM_TRANSPOSE4_PS(fM[0], fM[1], fM[ 2], fM[ 3]);
+			_MM_TRANSPOSE4_PS(fM[4], fM[5], fM[ 6], fM[ 7]);
+			_MM_TRANSPOSE4_PS(fM[8], fM[9], fM[10], fM[11]);
+
+			// Store, the last block may be incomplete
+			const uint32 nNumOfBlockJoints = Math::Min(cPose.m_nNumOfJoints - nJoint, 4u);
+			for (uint32 i=0; i<nNumOfBlockJoints; i++) {
+				float *pfMatrix = pmDestination[nJoint + i].fM;
+				_mm_storeu_ps(pfMatrix,     fM[i]);
+				_mm_storeu_ps(pfMatrix + 4, fM[4 + i]);
+				_mm_storeu_ps(pfMatrix + 8, fM[8 + i]);
+			}
+		}
+	#else
+		for (uint32 nJoint=0; nJoint<cPose.m_nNumOfJoints; nJoint++) {
+			Matrix3x4 &mMatrix = pmDestination[nJoint];
+			cPose.GetRotation(nJoint).ToRotationMatrix(mMatrix);
+			const Vector3 vScale = cPose.GetScale(nJoint);
+			mMatrix.xx *= vScale.x; mMatrix.yx *= vScale.x; mMatrix.zx *= vScale.x;
+			mMatrix.xy *= vScale.y; mMatrix.yy *= vScale.y; mMatrix.zy *= vScale.y;
+			mMatrix.xz *= vScale.z; mMatrix.yz *= vScale.z; mMatrix.zz *= vScale.z;
+			const Vector3 vPosition = cPose.GetPosition(nJoint);
+			mMatrix.xw = vPosition.x;
+			mMatrix.yw = vPosition.y;
+			mMatrix.zw = vPosition.z;
+		}
+	#endif
+}
+
+
+//[-------------------------------------------------------]
+//[ Public functions                                      ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Constructor
+*/
+PoseBuffer::PoseBuffer(uint32 nNumOfJoints) :
+	m_nNumOfJoints(0),
+	m_nCapacity(0),
+	m_pfMemory(nullptr)
+{
+	for (uint32 i=0; i<NumOfArrays; i++)
+		m_pfArray[i] = nullptr;
+	Resize(nNumOfJoints);
+}
+
+/**
+*  @brief
+*    Copy constructor
+*/
+PoseBuffer::PoseBuffer(const PoseBuffer &cSource) :
+	m_nNumOfJoints(0),
+	m_nCapacity(0),
+	m_pfMemory(nullptr)
+{
+	for (uint32 i=0; i<NumOfArrays; i++)
+		m_pfArray[i] = nullptr;
+	*this = cSource;
+}
+
+/**
+*  @brief
+*    Destructor
+*/
+PoseBuffer::~PoseBuffer()
+{
+	if (m_pfMemory)
+		delete [] m_pfMemory;
+}
+
+/**
+*  @brief
+*    Copy operator
+*/
+PoseBuffer &PoseBuffer::operator =(const PoseBuffer &cSource)
+{
+	if (this != &cSource) {
+		// Reset the number of joints so that resizing doesn't need to keep the current poses
+		m_nNumOfJoints = 0;
+		Resize(cSource.m_nNumOfJoints);
+
+		// Copy the component arrays including the identity padding
+		const uint32 nNumOfPaddedJoints = (cSource.m_nNumOfJoints + 3) & ~3u;
+		for (uint32 i=0; i<NumOfArrays; i++)
+			MemoryManager::Copy(m_pfArray[i], cSource.m_pfArray[i], sizeof(float)*nNumOfPaddedJoints);
+	}
+
+	// Return this instance
+	return *this;
+}
+
+/**
+*  @brief
+*    Sets the number of joints
+*/
+void PoseBuffer::Resize(uint32 nNumOfJoints)
+{
+	// Enough memory?
+	if (nNumOfJoints > m_nCapacity) {
+		// Allocate the new component arrays, each one is padded to a multiple of four joints and 16 byte aligned
+		const uint32 nCapacity = (nNumOfJoints + 3) & ~3u;
+		float *pfMemory = new float[nCapacity*NumOfArrays + 3];
+		float *pfArray = reinterpret_cast<float*>((reinterpret_cast<size_t>(pfMemory) + 15) & ~static_cast<size_t>(15));
+
+		// Copy the current poses
+		for (uint32 i=0; i<NumOfArrays; i++) {
+			if (m_nNumOfJoints)
+				MemoryManager::Copy(pfArray + i*nCapacity, m_pfArray[i], sizeof(float)*m_nNumOfJoints);
+			m_pfArray[i] = pfArray + i*nCapacity;
+		}
+
+		// Replace the memory
+		if (m_pfMemory)
+			delete [] m_pfMemory;
+		m_pfMemory  = pfMemory;
+		m_nCapacity = nCapacity;
+
+		// New joints and padding are identity
+		SetIdentity(m_nNumOfJoints, m_nCapacity);
+	} else if (nNumOfJoints < m_nNumOfJoints) {
+		// Removed joints become padding which is identity
+		SetIdentity(nNumOfJoints, m_nNumOfJoints);
+	}
+	m_nNumOfJoints = nNumOfJoints;
+}
+
+/**
+*  @brief
+*    Sets all joints to identity (no translation, no rotation, scale of one)
+*/
+void PoseBuffer::SetIdentity()
+{
+	SetIdentity(0, m_nNumOfJoints);
+}
+
+
+//[-------------------------------------------------------]
+//[ Private functions                                     ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Sets the given joint range to identity
+*/
+void PoseBuffer::SetIdentity(uint32 nFirstJoint, uint32 nLastJoint)
+{
+	for (uint32 i=0; i<NumOfArrays; i++) {
+		const float fValue = (i == RotationW || i >= ScaleX) ? 1.0f : 0.0f;
+		float *pfArray = m_pfArray[i];
+		for (uint32 nJoint=nFirstJoint; nJoint<nLastJoint; nJoint++)
+			pfArray[nJoint] = fValue;
+	}
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // PLMath
@@ -25,6 +25,7 @@
 //[-------------------------------------------------------]
 //[ Includes                                              ]
 //[-------------------------------------------------------]
+#include "PLMath/PlaneSet.h"
 #include "PLMath/Intersect.h"
 #include "PLMath/Quadtree.h"
 
@@ -158,25 +159,29 @@ bool Quadtree::Build()
 		// Allocate memory
 		m_pChild = new Quadtree[m_nNumOfChildren];
 		
-		// Get the half quadtree size
-		uint32 nXHalfSize = (m_nXSize > 1) ? m_nXSize/2 : m_nXSize;
-		uint32 nYHalfSize = (m_nYSize > 1) ? m_nYSize/2 : m_nYSize;
+		// Get the quadtree sizes of the two halves, the second half gets the remainder of odd sizes
+		const uint32 nXHalfSize  = (m_nXSize > 1) ? m_nXSize/2 : m_nXSize;
+		const uint32 nYHalfSize  = (m_nYSize > 1) ? m_nYSize/2 : m_nYSize;
+		const uint32 nXOffset2   = (m_nXSize > 1) ? m_nXOffset + nXHalfSize : m_nXOffset;
+		const uint32 nYOffset2   = (m_nYSize > 1) ? m_nYOffset + nYHalfSize : m_nYOffset;
+		const uint32 nXSize2	 = (m_nXSize > 1) ? m_nXSize - nXHalfSize : m_nXSize;
+		const uint32 nYSize2	 = (m_nYSize > 1) ? m_nYSize - nYHalfSize : m_nYSize;
 
 		Quadtree *pQuadtree = m_pChild;
 		pQuadtree->Init(m_nXOffset, m_nYOffset, nXHalfSize, nYHalfSize, this);
 		pQuadtree->Build();
 		pQuadtree++;
 		if (m_nXSize > 1) {
-			pQuadtree->Init(m_nXOffset+nXHalfSize, m_nYOffset, nXHalfSize, nYHalfSize, this);
+			pQuadtree->Init(nXOffset2, m_nYOffset, nXSize2, nYHalfSize, this);
 			pQuadtree->Build();
 			pQuadtree++;
 		}
 		if (m_nYSize > 1) {
-			pQuadtree->Init(m_nXOffset+nXHalfSize, m_nYOffset+nYHalfSize, nXHalfSize, nYHalfSize, this);
+			pQuadtree->Init(nXOffset2, nYOffset2, nXSize2, nYSize2, this);
 			pQuadtree->Build();
 			pQuadtree++;
 			if (m_nXSize > 1) {
-				pQuadtree->Init(m_nXOffset, m_nYOffset+nYHalfSize, nXHalfSize, nYHalfSize, this);
+				pQuadtree->Init(m_nXOffset, nYOffset2, nXHalfSize, nYSize2, this);
 				pQuadtree->Build();
 			}
 		}
@@ -207,37 +212,25 @@ void Quadtree::UpdateBoundingBoxes(QuadtreePatch **ppPatch)
 {
 	// Check pointer
 	if (ppPatch) {
-		// Init bounding box
-		m_vBoundingBox[0].SetXYZ( 100000.0f,  100000.0f,  100000.0f);
-		m_vBoundingBox[1].SetXYZ(-100000.0f, -100000.0f, -100000.0f);
-
-		// Get bounding box
-		for (uint32 nY=0; nY<m_nYSize; nY++)
-			for (uint32 nX=0; nX<m_nXSize; nX++) {
-				// Get current patch
-				QuadtreePatch *pPatchT = ppPatch[(m_nYOffset+nY)*m_pTopmost->m_nXSize+m_nXOffset+nX];
-
-				// Update min
-				if (m_vBoundingBox[0].x > pPatchT->GetBBMin().x)
-					m_vBoundingBox[0].x = pPatchT->GetBBMin().x;
-				if (m_vBoundingBox[0].y > pPatchT->GetBBMin().y)
-					m_vBoundingBox[0].y = pPatchT->GetBBMin().y;
-				if (m_vBoundingBox[0].z > pPatchT->GetBBMin().z)
-					m_vBoundingBox[0].z = pPatchT->GetBBMin().z;
-
-				// Update max
-				if (m_vBoundingBox[1].x < pPatchT->GetBBMax().x)
-					m_vBoundingBox[1].x = pPatchT->GetBBMax().x;
-				if (m_vBoundingBox[1].y < pPatchT->GetBBMax().y)
-					m_vBoundingBox[1].y = pPatchT->GetBBMax().y;
-				if (m_vBoundingBox[1].z < pPatchT->GetBBMax().z)
-					m_vBoundingBox[1].z = pPatchT->GetBBMax().z;
-				
-			}
-
-		// Update children
+		// Update children first, the bounding box of this quadtree is build by using the children bounding boxes
 		for (uint32 nChild=0; nChild<m_nNumOfChildren; nChild++)
 			m_pChild[nChild].UpdateBoundingBoxes(ppPatch);
+		UpdateBoundingBoxFromChildren(ppPatch);
+	}
+}
+
+/**
+*  @brief
+*    Updates the bounding boxes of the quadtree after the bounding box of a single patch was changed
+*/
+void Quadtree::UpdatePatchBoundingBox(QuadtreePatch **ppPatch, uint32 nX, uint32 nY)
+{
+	// Check pointer and whether or not the patch is within this quadtree
+	if (ppPatch && nX >= m_nXOffset && nX < m_nXOffset+m_nXSize && nY >= m_nYOffset && nY < m_nYOffset+m_nYSize) {
+		// Update the child containing the patch, then this quadtree
+		for (uint32 nChild=0; nChild<m_nNumOfChildren; nChild++)
+			m_pChild[nChild].UpdatePatchBoundingBox(ppPatch, nX, nY);
+		UpdateBoundingBoxFromChildren(ppPatch);
 	}
 }
 
@@ -270,6 +263,22 @@ void Quadtree::UpdateVisibility(const PlaneSet &cPlaneSet, QuadtreePatch **ppPat
 	}
 }
 
+/**
+*  @brief
+*    Returns the visible patches
+*/
+uint32 Quadtree::GetVisiblePatches(const PlaneSet &cPlaneSet, uint32 *pnPatches, uint32 nMaxPatches) const
+{
+	// Test all planes (a maximum number of 32 planes)
+	const uint32 nNumOfPlanes = cPlaneSet.GetNumOfPlanes();
+	uint32 nNumOfPatches = 0;
+	if (nNumOfPlanes && pnPatches)
+		AddVisiblePatches(cPlaneSet, (nNumOfPlanes >= 32) ? 0xFFFFFFFF : ((1u << nNumOfPlanes) - 1), pnPatches, nNumOfPatches, nMaxPatches);
+
+	// Done
+	return nNumOfPatches;
+}
+
 /**
 *  @brief
 *    Returns the bounding box minimum/maximum values
@@ -331,6 +340,68 @@ Quadtree &Quadtree::operator =(const Quadtree &cSource)
 }
 
 
+/**
+*  @brief
+*    Updates the bounding box of this quadtree by using the bounding boxes of the children
+*/
+void Quadtree::UpdateBoundingBoxFromChildren(QuadtreePatch **ppPatch)
+{
+	// Init bounding box
+	m_vBoundingBox[0].SetXYZ( 100000.0f,  100000.0f,  100000.0f);
+	m_vBoundingBox[1].SetXYZ(-100000.0f, -100000.0f, -100000.0f);
+
+	if (m_nNumOfChildren) {
+		// Get bounding box of the children
+		for (uint32 nChild=0; nChild<m_nNumOfChildren; nChild++) {
+			const Quadtree &cChild = m_pChild[nChild];
+			m_vBoundingBox[0].x = Math::Min(m_vBoundingBox[0].x, cChild.m_vBoundingBox[0].x);
+			m_vBoundingBox[0].y = Math::Min(m_vBoundingBox[0].y, cChild.m_vBoundingBox[0].y);
+			m_vBoundingBox[0].z = Math::Min(m_vBoundingBox[0].z, cChild.m_vBoundingBox[0].z);
+			m_vBoundingBox[1].x = Math::Max(m_vBoundingBox[1].x, cChild.m_vBoundingBox[1].x);
+			m_vBoundingBox[1].y = Math::Max(m_vBoundingBox[1].y, cChild.m_vBoundingBox[1].y);
+			m_vBoundingBox[1].z = Math::Max(m_vBoundingBox[1].z, cChild.m_vBoundingBox[1].z);
+		}
+	} else {
+		// Get bounding box of the patches (there's only one patch within a quadtree without children)
+		for (uint32 nY=0; nY<m_nYSize; nY++) {
+			for (uint32 nX=0; nX<m_nXSize; nX++) {
+				// Get current patch
+				QuadtreePatch *pPatchT = ppPatch[(m_nYOffset+nY)*m_pTopmost->m_nXSize+m_nXOffset+nX];
+				m_vBoundingBox[0].x = Math::Min(m_vBoundingBox[0].x, pPatchT->GetBBMin().x);
+				m_vBoundingBox[0].y = Math::Min(m_vBoundingBox[0].y, pPatchT->GetBBMin().y);
+				m_vBoundingBox[0].z = Math::Min(m_vBoundingBox[0].z, pPatchT->GetBBMin().z);
+				m_vBoundingBox[1].x = Math::Max(m_vBoundingBox[1].x, pPatchT->GetBBMax().x);
+				m_vBoundingBox[1].y = Math::Max(m_vBoundingBox[1].y, pPatchT->GetBBMax().y);
+				m_vBoundingBox[1].z = Math::Max(m_vBoundingBox[1].z, pPatchT->GetBBMax().z);
+			}
+		}
+	}
+}
+
+/**
+*  @brief
+*    Adds the visible patches of this quadtree
+*/
+void Quadtree::AddVisiblePatches(const PlaneSet &cPlaneSet, uint32 nPlaneMask, uint32 *pnPatches, uint32 &nNumOfPatches, uint32 nMaxPatches) const
+{
+	// Check whether this quadtree is visible
+	uint32 nMask;
+	if (nNumOfPatches < nMaxPatches && Intersect::PlaneSetAABox(cPlaneSet, m_vBoundingBox[0], m_vBoundingBox[1], nPlaneMask, nMask)) {
+		if (nMask && m_nNumOfChildren) {
+			// Partially visible, check the children
+			for (uint32 nChild=0; nChild<m_nNumOfChildren; nChild++)
+				m_pChild[nChild].AddVisiblePatches(cPlaneSet, nMask, pnPatches, nNumOfPatches, nMaxPatches);
+		} else {
+			// Completely visible (or a single patch), add all patches
+			for (uint32 nY=0; nY<m_nYSize; nY++) {
+				for (uint32 nX=0; nX<m_nXSize && nNumOfPatches<nMaxPatches; nX++)
+					pnPatches[nNumOfPatches++] = (m_nYOffset+nY)*m_pTopmost->m_nXSize+m_nXOffset+nX;
+			}
+		}
+	}
+}
+
+
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
 //[-------------------------------------------------------]
@@ -0,0 +1,396 @@
+/*********************************************************\
+ *  File: SimplexNoise.cpp                               *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "PLMath/SimplexNoise.h"
+#ifdef PLMATH_SSE2
+	#include <emmintrin.h>
+#endif
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+using namespace PLCore;
+namespace PLMath {
+
+
+//[-------------------------------------------------------]
+//[ Global definitions                                    ]
+//[-------------------------------------------------------]
+// Skewing and unskewing factors
+static const float F2 = 0.366025403784438647f;	// 0.5*(sqrt(3)-1)
+static const float G2 = 0.211324865405187118f;	// (3-sqrt(3))/6
+static const float F3 = 1.0f/3.0f;
+static const float G3 = 1.0f/6.0f;
+
+
+//[-------------------------------------------------------]
+//[ Global variables                                      ]
+//[-------------------------------------------------------]
+// Gradients towards the edges of a cube, padded to four components
+static const float Gradient3[12][4] = {
+	{ 1.0f,  1.0f,  0.0f, 0.0f}, {-1.0f,  1.0f,  0.0f, 0.0f}, { 1.0f, -1.0f,  0.0f, 0.0f}, {-1.0f, -1.0f,  0.0f, 0.0f},
+	{ 1.0f,  0.0f,  1.0f, 0.0f}, {-1.0f,  0.0f,  1.0f, 0.0f}, { 1.0f,  0.0f, -1.0f, 0.0f}, {-1.0f,  0.0f, -1.0f, 0.0f},
+	{ 0.0f,  1.0f,  1.0f, 0.0f}, { 0.0f, -1.0f,  1.0f, 0.0f}, { 0.0f,  1.0f, -1.0f, 0.0f}, { 0.0f, -1.0f, -1.0f, 0.0f}
+};
+
+// Ken Perlin's reference permutation table
+static const uint8 Permutation[256] = {
+	151,160,137, 91, 90, 15,131, 13,201, 95, 96, 53,194,233,  7,225,140, 36,103, 30, 69,142,  8, 99, 37,240, 21, 10, 23,190,  6,148,
+	247,120,234, 75,  0, 26,197, 62, 94,252,219,203,117, 35, 11, 32, 57,177, 33, 88,237,149, 56, 87,174, 20,125,136,171,168, 68,175,
+	 74,165, 71,134,139, 48, 27,166, 77,146,158,231, 83,111,229,122, 60,211,133,230,220,105, 92, 41, 55, 46,245, 40,244,102,143, 54,
+	 65, 25, 63,161,  1,216, 80, 73,209, 76,132,187,208, 89, 18,169,200,196,135,130,116,188,159, 86,164,100,109,198,173,186,  3, 64,
+	 52,217,226,250,124,123,  5,202, 38,147,118,126,255, 82, 85,212,207,206, 59,227, 47, 16, 58, 17,182,189, 28, 42,223,183,170,213,
+	119,248,152,  2, 44,154,163, 70,221,153,101,155,167, 43,172,  9,129, 22, 39,253, 19, 98,108,110, 79,113,224,232,178,185,112,104,
+	218,246, 97,228,251, 34,242,193,238,210,144, 12,191,179,162,241, 81, 51,145,235,249, 14,239,107, 49,192,214, 31,181,199,106,157,
+	184, 84,204,176,115,121, 50, 45,127,  4,150,254,138,236,205, 93,222,114, 67, 29, 24, 72,243,141,128,195, 78, 66,215, 61,156,180
+};
+
+/**
+*  @brief
+*    Doubled permutation table (avoids index wrapping) and the matching gradient indices
+*/
+class SimplexTables {
+	public:
+		SimplexTables()
+		{
+			for (int i=0; i<512; i++) {
+				nPerm[i]      = Permutation[i & 255];
+				nPermMod12[i] = nPerm[i] % 12;
+			}
+		}
+		int nPerm[512];
+		int nPermMod12[512];
+};
+static const SimplexTables g_cTables;
+
+
+//[-------------------------------------------------------]
+//[ Global helper functions                               ]
+//[-------------------------------------------------------]
+inline int FastFloor(float fValue)
+{
+	const int nValue = static_cast<int>(fValue);
+	return (fValue < static_cast<float>(nValue)) ? nValue - 1 : nValue;
+}
+
+inline float Corner2(float fX, float fY, int nGradient)
+{
+	float t = 0.5f - fX*fX - fY*fY;
+	if (t < 0.0f)
+		return 0.0f;
+	t *= t;
+	return t*t*(Gradient3[nGradient][0]*fX + Gradient3[nGradient][1]*fY);
+}
+
+inline float Corner3(float fX, float fY, float fZ, int nGradient)
+{
+	float t = 0.6f - fX*fX - fY*fY - fZ*fZ;
+	if (t < 0.0f)
+		return 0.0f;
+	t *= t;
+	return t*t*(Gradient3[nGradient][0]*fX + Gradient3[nGradient][1]*fY + Gradient3[nGradient][2]*fZ);
+}
+
+#ifdef PLMATH_SSE2
+	/**
+	*  @brief
+	*    Returns floor(x) of four values as float and integer (SSE2 has no floor instruction)
+	*/
+	inline __m128 FastFloor(__m128 vValue, __m128i &vInteger)
+	{
+		vInteger = _mm_cvttps_epi32(vValue);
+		const __m128 vTruncated = _mm_cvtepi32_ps(vInteger);
+		const __m128 vMask      = _mm_cmpgt_ps(vTruncated, vValue);
+		// The mask is -1 for lanes which were rounded up
+		vInteger = _mm_add_epi32(vInteger, _mm_castps_si128(vMask));
+		return _mm_sub_ps(vTruncated, _mm_and_ps(vMask, _mm_set1_ps(1.0f)));
+	}
+
+	inline __m128 Corner2(__m128 vX, __m128 vY, const int nGradient[4])
+	{
+		const __m128 vGx = _mm_set_ps(Gradient3[nGradient[3]][0], Gradient3[nGradient[2]][0], Gradient3[nGradient[1]][0], Gradient3[nGradient[0]][0]);
+		const __m128 vGy = _mm_set_ps(Gradient3[nGradient[3]][1], Gradient3[nGradient[2]][1], Gradient3[nGradient[1]][1], Gradient3[nGradient[0]][1]);
+		__m128 t = _mm_max_ps(_mm_sub_ps(_mm_sub_ps(_mm_set1_ps(0.5f), _mm_mul_ps(vX, vX)), _mm_mul_ps(vY, vY)), _mm_setzero_ps());
+		t = _mm_mul_ps(t, t);
+		return _mm_mul_ps(_mm_mul_ps(t, t), _mm_add_ps(_mm_mul_ps(vGx, vX), _mm_mul_ps(vGy, vY)));
+	}
+
+	inline __m128 Corner3(__m128 vX, __m128 vY, __m128 vZ, const int nGradient[4])
+	{
+		__m128 vGx = _mm_loadu_ps(Gradient3[nGradient[0]]);
+		__m128 vGy = _mm_loadu_ps(Gradient3[nGradient[1]]);
+		__m128 vGz = _mm_loadu_ps(Gradient3[nGradient[2]]);
+		__m128 vGw = _mm_loadu_ps(Gradient3[nGradient[3]]);
+		_MM_TRANSPOSE4_PS(vGx, vGy, vGz, vGw);
+		__m128 t = _mm_max_ps(_mm_sub_ps(_mm_sub_ps(_mm_sub_ps(_mm_set1_ps(0.6f), _mm_mul_ps(vX, vX)), _mm_mul_ps(vY, vY)), _mm_mul_ps(vZ, vZ)), _mm_setzero_ps());
+		t = _mm_mul_ps(t, t);
+		return _mm_mul_ps(_mm_mul_ps(t, t), _mm_add_ps(_mm_add_ps(_mm_mul_ps(vGx, vX), _mm_mul_ps(vGy, vY)), _mm_mul_ps(vGz, vZ)));
+	}
+#endif
+
+
+//[-------------------------------------------------------]
+//[ Public static functions                               ]
+//[-------------------------------------------------------]
+float SimplexNoise::Noise2(float fX, float fY)
+{
+	const int *pnPerm      = g_cTables.nPerm;
+	const int *pnPermMod12 = g_cTables.nPermMod12;
+
+	// Skew the input space to determine which simplex cell we're in
+	const float s = (fX + fY)*F2;
+	const int i = FastFloor(fX + s);
+	const int j = FastFloor(fY + s);
+
+	// Unskew the cell origin back to (x, y) space
+	const float t  = static_cast<float>(i + j)*G2;
+	const float x0 = fX - (static_cast<float>(i) - t);
+	const float y0 = fY - (static_cast<float>(j) - t);
+
+	// Determine which simplex we are in, lower triangle (1, 0) or upper triangle (0, 1)
+	const int i1 = (x0 > y0) ? 1 : 0;
+	const int j1 = 1 - i1;
+
+	// Offsets of the middle and last corner
+	const float x1 = x0 - static_cast<float>(i1) + G2;
+	const float y1 = y0 - static_cast<float>(j1) + G2;
+	const float x2 = x0 - 1.0f + 2.0f*G2;
+	const float y2 = y0 - 1.0f + 2.0f*G2;
+
+	// Hashed gradient indices of the three simplex corners
+	const int ii = i & 255;
+	const int jj = j & 255;
+
+	// Add contributions from each corner and scale the result to [-1, 1]
+	return 70.0f*(Corner2(x0, y0, pnPermMod12[ii      + pnPerm[jj]]) +
+				  Corner2(x1, y1, pnPermMod12[ii + i1 + pnPerm[jj + j1]]) +
+				  Corner2(x2, y2, pnPermMod12[ii + 1  + pnPerm[jj + 1]]));
+}
+
+float SimplexNoise::Noise3(float fX, float fY, float fZ)
+{
+	const int *pnPerm      = g_cTables.nPerm;
+	const int *pnPermMod12 = g_cTables.nPermMod12;
+
+	// Skew the input space to determine which simplex cell we're in
+	const float s = (fX + fY + fZ)*F3;
+	const int i = FastFloor(fX + s);
+	const int j = FastFloor(fY + s);
+	const int k = FastFloor(fZ + s);
+
+	// Unskew the cell origin back to (x, y, z) space
+	const float t  = static_cast<float>(i + j + k)*G3;
+	const float x0 = fX - (static_cast<float>(i) - t);
+	const float y0 = fY - (static_cast<float>(j) - t);
+	const float z0 = fZ - (static_cast<float>(k) - t);
+
+	// Determine which of the six simplices we are in (branch free so it matches the SSE2 version)
+	const bool bXY = (x0 >= y0);
+	const bool bXZ = (x0 >= z0);
+	const bool bYZ = (y0 >= z0);
+	const int i1 = ( bXY &&  bXZ) ? 1 : 0;
+	const int j1 = (!bXY &&  bYZ) ? 1 : 0;
+	const int k1 = (!bXZ && !bYZ) ? 1 : 0;
+	const int i2 = ( bXY ||  bXZ) ? 1 : 0;
+	const int j2 = (!bXY ||  bYZ) ? 1 : 0;
+	const int k2 = ( bXZ &&  bYZ) ? 0 : 1;
+
+	// Offsets of the remaining corners
+	const float x1 = x0 - static_cast<float>(i1) + G3;
+	const float y1 = y0 - static_cast<float>(j1) + G3;
+	const float z1 = z0 - static_cast<float>(k1) + G3;
+	const float x2 = x0 - static_cast<float>(i2) + 2.0f*G3;
+	const float y2 = y0 - static_cast<float>(j2) + 2.0f*G3;
+	const float z2 = z0 - static_cast<float>(k2) + 2.0f*G3;
+	const float x3 = x0 - 1.0f + 3.0f*G3;
+	const float y3 = y0 - 1.0f + 3.0f*G3;
+	const float z3 = z0 - 1.0f + 3.0f*G3;
+
+	// Hashed gradient indices of the four simplex corners
+	const int ii = i & 255;
+	const int jj = j & 255;
+	const int kk = k & 255;
+
+	// Add contributions from each corner and scale the result to [-1, 1]
+	return 32.0f*(Corner3(x0, y0, z0, pnPermMod12[ii      + pnPerm[jj      + pnPerm[kk]]]) +
+				  Corner3(x1, y1, z1, pnPermMod12[ii + i1 + pnPerm[jj + j1 + pnPerm[kk + k1]]]) +
+				  Corner3(x2, y2, z2, pnPermMod12[ii + i2 + pnPerm[jj + j2 + pnPerm[kk + k2]]]) +
+				  Corner3(x3, y3, z3, pnPermMod12[ii + 1  + pnPerm[jj + 1  + pnPerm[kk + 1]]]));
+}
+
+void SimplexNoise::Noise2Row(float *pfDestination, uint32 nCount, float fX, float fY, float fStepX)
+{
+	uint32 nSample = 0;
+#ifdef PLMATH_SSE2
+	{
+		const int *pnPerm      = g_cTables.nPerm;
+		const int *pnPermMod12 = g_cTables.nPermMod12;
+		const __m128 vOne  = _mm_set1_ps(1.0f);
+		const __m128 vG2   = _mm_set1_ps(G2);
+		const __m128 vStep = _mm_set1_ps(fStepX);
+		const __m128 vY    = _mm_set1_ps(fY);
+		int nI[4], nJ[4], nI1[4], nGradient[3][4];
+
+		for (; nSample+4<=nCount; nSample+=4, pfDestination+=4) {
+			const __m128 vX = _mm_add_ps(_mm_set1_ps(fX), _mm_mul_ps(_mm_set_ps(static_cast<float>(nSample+3), static_cast<float>(nSample+2), static_cast<float>(nSample+1), static_cast<float>(nSample)), vStep));
+
+			// Skew
+			const __m128 s = _mm_mul_ps(_mm_add_ps(vX, vY), _mm_set1_ps(F2));
+			__m128i vI, vJ;
+			const __m128 vFI = FastFloor(_mm_add_ps(vX, s), vI);
+			const __m128 vFJ = FastFloor(_mm_add_ps(vY, s), vJ);
+
+			// Unskew
+			const __m128 t   = _mm_mul_ps(_mm_cvtepi32_ps(_mm_add_epi32(vI, vJ)), vG2);
+			const __m128 vX0 = _mm_sub_ps(vX, _mm_sub_ps(vFI, t));
+			const __m128 vY0 = _mm_sub_ps(vY, _mm_sub_ps(vFJ, t));
+
+			// Simplex selection
+			const __m128 vMaskI1 = _mm_cmpgt_ps(vX0, vY0);
+			const __m128 vI1 = _mm_and_ps(vMaskI1, vOne);
+			const __m128 vJ1 = _mm_sub_ps(vOne, vI1);
+			const __m128 vX1 = _mm_add_ps(_mm_sub_ps(vX0, vI1), vG2);
+			const __m128 vY1 = _mm_add_ps(_mm_sub_ps(vY0, vJ1), vG2);
+			const __m128 vX2 = _mm_add_ps(_mm_sub_ps(vX0, vOne), _mm_set1_ps(2.0f*G2));
+			const __m128 vY2 = _mm_add_ps(_mm_sub_ps(vY0, vOne), _mm_set1_ps(2.0f*G2));
+
+			// Permutation table lookups can't be vectorized with SSE2
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(nI),  vI);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(nJ),  vJ);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(nI1), _mm_castps_si128(vMaskI1));
+			for (int nLane=0; nLane<4; nLane++) {
+				const int ii = nI[nLane] & 255;
+				const int jj = nJ[nLane] & 255;
+				const int i1 = nI1[nLane] & 1;
+				nGradient[0][nLane] = pnPermMod12[ii      + pnPerm[jj]];
+				nGradient[1][nLane] = pnPermMod12[ii + i1 + pnPerm[jj + 1 - i1]];
+				nGradient[2][nLane] = pnPermMod12[ii + 1  + pnPerm[jj + 1]];
+			}
+
+			const __m128 vN = _mm_add_ps(_mm_add_ps(Corner2(vX0, vY0, nGradient[0]), Corner2(vX1, vY1, nGradient[1])), Corner2(vX2, vY2, nGradient[2]));
+			_mm_storeu_ps(pfDestination, _mm_mul_ps(_mm_set1_ps(70.0f), vN));
+		}
+	}
+#endif
+
+	// Remaining samples
+	for (; nSample<nCount; nSample++, pfDestination++)
+		*pfDestination = Noise2(fX + static_cast<float>(nSample)*fStepX, fY);
+}
+
+void SimplexNoise::Noise3Row(float *pfDestination, uint32 nCount, float fX, float fY, float fZ, float fStepX)
+{
+	uint32 nSample = 0;
+#ifdef PLMATH_SSE2
+	{
+		const int *pnPerm      = g_cTables.nPerm;
+		const int *pnPermMod12 = g_cTables.nPermMod12;
+		const __m128 vOne  = _mm_set1_ps(1.0f);
+		const __m128 vG3   = _mm_set1_ps(G3);
+		const __m128 vStep = _mm_set1_ps(fStepX);
+		const __m128 vY    = _mm_set1_ps(fY);
+		const __m128 vZ    = _mm_set1_ps(fZ);
+		int nI[4], nJ[4], nK[4], nOffset1[4], nOffset2[4], nGradient[4][4];
+
+		for (; nSample+4<=nCount; nSample+=4, pfDestination+=4) {
+			const __m128 vX = _mm_add_ps(_mm_set1_ps(fX), _mm_mul_ps(_mm_set_ps(static_cast<float>(nSample+3), static_cast<float>(nSample+2), static_cast<float>(nSample+1), static_cast<float>(nSample)), vStep));
+
+			// Skew
+			const __m128 s = _mm_mul_ps(_mm_add_ps(_mm_add_ps(vX, vY), vZ), _mm_set1_ps(F3));
+			__m128i vI, vJ, vK;
+			const __m128 vFI = FastFloor(_mm_add_ps(vX, s), vI);
+			const __m128 vFJ = FastFloor(_mm_add_ps(vY, s), vJ);
+			const __m128 vFK = FastFloor(_mm_add_ps(vZ, s), vK);
+
+			// Unskew
+			const __m128 t   = _mm_mul_ps(_mm_cvtepi32_ps(_mm_add_epi32(_mm_add_epi32(vI, vJ), vK)), vG3);
+			const __m128 vX0 = _mm_sub_ps(vX, _mm_sub_ps(vFI, t));
+			const __m128 vY0 = _mm_sub_ps(vY, _mm_sub_ps(vFJ, t));
+			const __m128 vZ0 = _mm_sub_ps(vZ, _mm_sub_ps(vFK, t));
+
+			// Simplex selection, see "Noise3()"
+			const __m128 vXY = _mm_cmpge_ps(vX0, vY0);
+			const __m128 vXZ = _mm_cmpge_ps(vX0, vZ0);
+			const __m128 vYZ = _mm_cmpge_ps(vY0, vZ0);
+			const __m128 vMaskI1 = _mm_and_ps(vXY, vXZ);
+			const __m128 vMaskJ1 = _mm_andnot_ps(vXY, vYZ);
+			const __m128 vMaskK1 = _mm_andnot_ps(_mm_or_ps(vXZ, vYZ), _mm_castsi128_ps(_mm_set1_epi32(-1)));
+			const __m128 vMaskI2 = _mm_or_ps(vXY, vXZ);
+			const __m128 vMaskJ2 = _mm_or_ps(_mm_andnot_ps(vXY, _mm_castsi128_ps(_mm_set1_epi32(-1))), vYZ);
+			const __m128 vMaskK2 = _mm_andnot_ps(_mm_and_ps(vXZ, vYZ), _mm_castsi128_ps(_mm_set1_epi32(-1)));
+
+			const __m128 vX1 = _mm_add_ps(_mm_sub_ps(vX0, _mm_and_ps(vMaskI1, vOne)), vG3);
+			const __m128 vY1 = _mm_add_ps(_mm_sub_ps(vY0, _mm_and_ps(vMaskJ1, vOne)), vG3);
+			const __m128 vZ1 = _mm_add_ps(_mm_sub_ps(vZ0, _mm_and_ps(vMaskK1, vOne)), vG3);
+			const __m128 vX2 = _mm_add_ps(_mm_sub_ps(vX0, _mm_and_ps(vMaskI2, vOne)), _mm_set1_ps(2.0f*G3));
+			const __m128 vY2 = _mm_add_ps(_mm_sub_ps(vY0, _mm_and_ps(vMaskJ2, vOne)), _mm_set1_ps(2.0f*G3));
+			const __m128 vZ2 = _mm_add_ps(_mm_sub_ps(vZ0, _mm_and_ps(vMaskK2, vOne)), _mm_set1_ps(2.0f*G3));
+			const __m128 vX3 = _mm_add_ps(_mm_sub_ps(vX0, vOne), _mm_set1_ps(3.0f*G3));
+			const __m128 vY3 = _mm_add_ps(_mm_sub_ps(vY0, vOne), _mm_set1_ps(3.0f*G3));
+			const __m128 vZ3 = _mm_add_ps(_mm_sub_ps(vZ0, vOne), _mm_set1_ps(3.0f*G3));
+
+			// Pack the corner offsets as bits (i = bit 0, j = bit 1, k = bit 2) for the scalar table lookups
+			const __m128i vBitI = _mm_set1_epi32(1);
+			const __m128i vBitJ = _mm_set1_epi32(2);
+			const __m128i vBitK = _mm_set1_epi32(4);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(nOffset1), _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_castps_si128(vMaskI1), vBitI), _mm_and_si128(_mm_castps_si128(vMaskJ1), vBitJ)), _mm_and_si128(_mm_castps_si128(vMaskK1), vBitK)));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(nOffset2), _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_castps_si128(vMaskI2), vBitI), _mm_and_si128(_mm_castps_si128(vMaskJ2), vBitJ)), _mm_and_si128(_mm_castps_si128(vMaskK2), vBitK)));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(nI), vI);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(nJ), vJ);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(nK), vK);
+
+			// Permutation table lookups can't be vectorized with SSE2
+			for (int nLane=0; nLane<4; nLane++) {
+				const int ii = nI[nLane] & 255;
+				const int jj = nJ[nLane] & 255;
+				const int kk = nK[nLane] & 255;
+				const int o1 = nOffset1[nLane];
+				const int o2 = nOffset2[nLane];
+				nGradient[0][nLane] = pnPermMod12[ii                + pnPerm[jj                     + pnPerm[kk]]];
+				nGradient[1][nLane] = pnPermMod12[ii + (o1 & 1)     + pnPerm[jj + ((o1 >> 1) & 1)   + pnPerm[kk + (o1 >> 2)]]];
+				nGradient[2][nLane] = pnPermMod12[ii + (o2 & 1)     + pnPerm[jj + ((o2 >> 1) & 1)   + pnPerm[kk + (o2 >> 2)]]];
+				nGradient[3][nLane] = pnPermMod12[ii + 1            + pnPerm[jj + 1                 + pnPerm[kk + 1]]];
+			}
+
+			const __m128 vN = _mm_add_ps(_mm_add_ps(_mm_add_ps(Corner3(vX0, vY0, vZ0, nGradient[0]), Corner3(vX1, vY1, vZ1, nGradient[1])),
+															   Corner3(vX2, vY2, vZ2, nGradient[2])), Corner3(vX3, vY3, vZ3, nGradient[3]));
+			_mm_storeu_ps(pfDestination, _mm_mul_ps(_mm_set1_ps(32.0f), vN));
+		}
+	}
+#endif
+
+	// Remaining samples
+	for (; nSample<nCount; nSample++, pfDestination++)
+		*pfDestination = Noise3(fX + static_cast<float>(nSample)*fStepX, fY, fZ);
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // PLMath
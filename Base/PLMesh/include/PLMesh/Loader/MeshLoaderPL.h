@@ -119,7 +119,8 @@ class MeshLoaderPL : public MeshLoader {
 		bool ReadVertexWeights(PLCore::File &cFile, VertexWeights &cVertexWeights) const;
 		bool ReadMorphTarget(PLCore::File &cFile, MeshMorphTarget &cMorphTarget, bool bStatic) const;
 		bool ReadVertexBuffer(PLCore::File &cFile, PLRenderer::VertexBuffer &cVertexBuffer, PLCore::uint32 nIndex, bool bStatic) const;
-		bool ReadVertexAttribute(PLCore::File &cFile, PLRenderer::VertexBuffer &cVertexBuffer) const;
+		bool ReadVertexAttribute(PLCore::File &cFile, PLRenderer::VertexBuffer &cVertexBuffer, MeshFile::VertexAttribute &sVertexAttribute, bool &bConvert) const;
+		bool ReadConvertedVertexData(PLCore::File &cFile, PLRenderer::VertexBuffer &cVertexBuffer, const MeshFile::VertexBuffer &sVertexBuffer, const MeshFile::VertexAttribute *pVertexAttributes) const;
 		bool ReadSkeleton(Mesh &cMesh, PLCore::File &cFile) const;
 		bool ReadAnchorPoints(Mesh &cMesh, PLCore::File &cFile) const;
 		bool ReadAnimations(PLCore::File &cFile) const;
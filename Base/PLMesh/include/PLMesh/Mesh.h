@@ -712,6 +712,14 @@ class Mesh : public PLCore::Resource<Mesh> {
 		PLCore::Array<VertexWeights>	 m_lstVertexWeights;	/**< Optional vertex weights per vertex */
 
 
+	//[-------------------------------------------------------]
+	//[ Public virtual PLCore::Resource functions             ]
+	//[-------------------------------------------------------]
+	public:
+		PLMESH_API virtual PLCore::uint64 GetCPUMemoryUsage() const override;
+		PLMESH_API virtual PLCore::uint64 GetGPUMemoryUsage() const override;
+
+
 	//[-------------------------------------------------------]
 	//[ Public virtual PLCore::Loadable functions             ]
 	//[-------------------------------------------------------]
@@ -308,6 +308,34 @@ class MeshLODLevel {
 		*/
 		PLMESH_API PLCore::Array<MeshEdge> &GetEdgeList();
 
+		/**
+		*  @brief
+		*    Builds the current triangle position list
+		*
+		*  @note
+		*    - Three vertex positions of the first morph target per triangle, ready to be used
+		*      on the CPU without locking any buffer (for example for software occlusion culling)
+		*    - Changing the index buffer or the geometries of this LOD level or reallocating the vertex buffer of the
+		*      first morph target invalidates the list automatically, after changing vertex positions or indices without
+		*      reallocating the buffer the triangle position list must be rebuilt by hand!
+		*/
+		PLMESH_API void BuildTrianglePositionList();
+
+		/**
+		*  @brief
+		*    Gets the triangle position list
+		*
+		*  @return
+		*    Triangle position list, the number of elements is always a multiple of three
+		*
+		*  @note
+		*    - The triangle position list is built if it wasn't built yet or if it's no longer up-to-date
+		*
+		*  @see
+		*    - BuildTrianglePositionList()
+		*/
+		PLMESH_API const PLCore::Array<PLMath::Vector3> &GetTrianglePositionList();
+
 		/**
 		*  @brief
 		*    Gets a triangle of a geometry
@@ -474,8 +502,15 @@ class MeshLODLevel {
 		MeshOctree *m_pOctree;	/**< Octree for geometry visibility determination, can be a null pointer */
 
 		// Precalculated data
-		PLCore::Array<MeshTriangle> m_lstTriangles;	/**< List of triangles */
-		PLCore::Array<MeshEdge>     m_lstEdges;		/**< List of edges */
+		PLCore::Array<MeshTriangle>    m_lstTriangles;			/**< List of triangles */
+		PLCore::Array<MeshEdge>        m_lstEdges;				/**< List of edges */
+		PLCore::Array<PLMath::Vector3> m_lstTrianglePositions;	/**< List of triangle vertex positions, three per triangle */
+
+		// Triangle position list state
+		bool							m_bTrianglePositionsBuilt;			/**< Was the triangle position list built? (it may still be empty) */
+		const PLRenderer::VertexBuffer *m_pTrianglePositionsVertexBuffer;	/**< Vertex buffer the triangle position list was built from, can be a null pointer */
+		PLCore::uint32					m_nTrianglePositionsNumOfVertices;	/**< Number of vertices when the triangle position list was built */
+		PLCore::uint32					m_nTrianglePositionsNumOfIndices;	/**< Number of indices when the triangle position list was built */
 
 
 };
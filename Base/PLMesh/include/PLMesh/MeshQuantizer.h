@@ -0,0 +1,247 @@
+/*********************************************************\
+ *  File: MeshQuantizer.h                                *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+#ifndef __PLMESH_MESHQUANTIZER_H__
+#define __PLMESH_MESHQUANTIZER_H__
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "PLMesh/PLMesh.h"
+
+
+//[-------------------------------------------------------]
+//[ Forward declarations                                  ]
+//[-------------------------------------------------------]
+namespace PLRenderer {
+	class VertexBuffer;
+}
+namespace PLMesh {
+	class Mesh;
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace PLMesh {
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Mesh vertex data quantizer
+*
+*  @remarks
+*    Converts the floating point vertex attributes of a mesh into smaller types:
+*    - Normals, tangents and binormals become "Short4N" (8 instead of 12 bytes)
+*    - Texture coordinates become "Half2" respectively "Half4" (4 instead of 8, 8 instead of 12 or 16 bytes)
+*    - Floating point colors and blend weights become "UByte4N" (4 instead of up to 16 bytes), "RGBA" colors are kept
+*    - Positions become "Half4" (8 instead of 12 bytes), this is disabled by default, see SetQuantizePositions()
+*    An attribute is only quantized if the error introduced by the quantization stays within the given error bound
+*    and if the renderer supports the quantized type, else it's kept as it is. Typically the vertex data size of a
+*    static mesh is nearly halved. Quantize meshes while importing them, then save them (see "MeshLoaderPL").
+*
+*  @note
+*    - Positions, normals, tangents and binormals of skinned or morphed meshes are not quantized
+*      because the software mesh animation works with floating point data
+*    - The normalized integer types "Short4N" and "UByte4N" are not used if Cg is the default shader language of the
+*      renderer, because Cg assembly profiles can't pass the normalization flag to OpenGL
+*    - Quantize a mesh after all other mesh processing like normal or tangent space calculation,
+*      code reading the vertex data directly as floating point data must use "VertexBuffer::GetFloat()"
+*/
+class MeshQuantizer {
+
+
+	//[-------------------------------------------------------]
+	//[ Public structures                                     ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Quantization result
+		*/
+		struct Result {
+			PLCore::uint32 nNumOfVertexBuffers;		/**< Number of processed vertex buffers */
+			PLCore::uint32 nNumOfQuantized;			/**< Number of quantized vertex attributes */
+			PLCore::uint32 nNumOfRejected;			/**< Number of vertex attributes which were kept because the error bound would have been exceeded */
+			PLCore::uint32 nSizeBefore;				/**< Vertex data size before the quantization (in bytes) */
+			PLCore::uint32 nSizeAfter;				/**< Vertex data size after the quantization (in bytes) */
+			float		   fMaxPositionError;		/**< Maximum absolute component error of the quantized positions */
+			float		   fMaxVectorError;			/**< Maximum absolute component error of the quantized normals, tangents and binormals */
+			float		   fMaxTexCoordError;		/**< Maximum absolute component error of the quantized texture coordinates */
+			float		   fMaxColorError;			/**< Maximum absolute component error of the quantized colors and blend weights */
+		};
+
+
+	//[-------------------------------------------------------]
+	//[ Public functions                                      ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Constructor
+		*/
+		PLMESH_API MeshQuantizer();
+
+		/**
+		*  @brief
+		*    Destructor
+		*/
+		PLMESH_API ~MeshQuantizer();
+
+		/**
+		*  @brief
+		*    Returns whether or not positions are quantized
+		*
+		*  @return
+		*    'true' if positions are quantized, else 'false' (default)
+		*/
+		PLMESH_API bool GetQuantizePositions() const;
+
+		/**
+		*  @brief
+		*    Sets whether or not positions are quantized
+		*
+		*  @param[in] bQuantize
+		*    'true' if positions are quantized, else 'false'
+		*
+		*  @note
+		*    - Half positions are only precise enough for meshes with small object space coordinates,
+		*      the error bound given by SetMaxPositionError() makes sure large meshes are kept as they are
+		*/
+		PLMESH_API void SetQuantizePositions(bool bQuantize);
+
+		/**
+		*  @brief
+		*    Returns the error bounds
+		*
+		*  @param[out] fPosition
+		*    Receives the maximum allowed absolute position component error (in object space units)
+		*  @param[out] fVector
+		*    Receives the maximum allowed absolute normal, tangent and binormal component error
+		*  @param[out] fTexCoord
+		*    Receives the maximum allowed absolute texture coordinate component error
+		*  @param[out] fColor
+		*    Receives the maximum allowed absolute color and blend weight component error
+		*/
+		PLMESH_API void GetMaxErrors(float &fPosition, float &fVector, float &fTexCoord, float &fColor) const;
+
+		/**
+		*  @brief
+		*    Sets the error bounds
+		*
+		*  @param[in] fPosition
+		*    Maximum allowed absolute position component error (in object space units)
+		*  @param[in] fVector
+		*    Maximum allowed absolute normal, tangent and binormal component error
+		*  @param[in] fTexCoord
+		*    Maximum allowed absolute texture coordinate component error
+		*  @param[in] fColor
+		*    Maximum allowed absolute color and blend weight component error
+		*
+		*  @note
+		*    - The defaults are 0.001 for positions, 0.001 for vectors, 1/2048 for texture coordinates
+		*      (half a texel of a 1024x1024 texture) and 1/255 for colors
+		*/
+		PLMESH_API void SetMaxErrors(float fPosition = 0.001f, float fVector = 0.001f, float fTexCoord = 1.0f/2048.0f, float fColor = 1.0f/255.0f);
+
+		/**
+		*  @brief
+		*    Quantizes all vertex buffers of a mesh
+		*
+		*  @param[in]  cMesh
+		*    Mesh to quantize
+		*  @param[out] pResult
+		*    If not a null pointer, receives the quantization result
+		*
+		*  @return
+		*    'true' if all went fine, else 'false'
+		*
+		*  @note
+		*    - The saved memory is written into the log
+		*/
+		PLMESH_API bool Quantize(Mesh &cMesh, Result *pResult = nullptr) const;
+
+		/**
+		*  @brief
+		*    Quantizes a vertex buffer
+		*
+		*  @param[in]  cVertexBuffer
+		*    Vertex buffer to quantize, must not be locked
+		*  @param[out] pResult
+		*    If not a null pointer, receives the quantization result
+		*
+		*  @return
+		*    'true' if all went fine, else 'false'
+		*/
+		PLMESH_API bool Quantize(PLRenderer::VertexBuffer &cVertexBuffer, Result *pResult = nullptr) const;
+
+
+	//[-------------------------------------------------------]
+	//[ Private functions                                     ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Quantizes a vertex buffer
+		*
+		*  @param[in]  cVertexBuffer
+		*    Vertex buffer to quantize, must not be locked
+		*  @param[in]  bVectors
+		*    Quantize positions, normals, tangents and binormals?
+		*  @param[out] sResult
+		*    Receives the quantization result, the values are added
+		*
+		*  @return
+		*    'true' if all went fine, else 'false'
+		*/
+		bool QuantizeVertexBuffer(PLRenderer::VertexBuffer &cVertexBuffer, bool bVectors, Result &sResult) const;
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		bool  m_bQuantizePositions;	/**< Quantize positions? */
+		float m_fMaxPositionError;	/**< Maximum allowed absolute position component error */
+		float m_fMaxVectorError;	/**< Maximum allowed absolute normal, tangent and binormal component error */
+		float m_fMaxTexCoordError;	/**< Maximum allowed absolute texture coordinate component error */
+		float m_fMaxColorError;		/**< Maximum allowed absolute color and blend weight component error */
+
+
+};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // PLMesh
+
+
+#endif // __PLMESH_MESHQUANTIZER_H__
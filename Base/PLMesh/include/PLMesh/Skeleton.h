@@ -146,6 +146,13 @@ class Skeleton : public PLCore::Resource<Skeleton>, public PLCore::ElementManage
 		PLMESH_API virtual PLCore::String GetSourceName() const override;
 
 
+	//[-------------------------------------------------------]
+	//[ Public virtual PLCore::Resource functions             ]
+	//[-------------------------------------------------------]
+	public:
+		PLMESH_API virtual PLCore::uint64 GetCPUMemoryUsage() const override;
+
+
 	//[-------------------------------------------------------]
 	//[ Public virtual PLCore::Loadable functions             ]
 	//[-------------------------------------------------------]
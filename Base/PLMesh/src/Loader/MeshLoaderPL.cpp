@@ -30,6 +30,8 @@
 //[-------------------------------------------------------]
 #include <PLCore/File/File.h>
 #include <PLCore/Container/Stack.h>
+#include <PLMath/Math.h>
+#include <PLMath/Half.h>
 #include <PLRenderer/RendererContext.h>
 #include <PLRenderer/Renderer/IndexBuffer.h>
 #include <PLRenderer/Animation/AnimationEvent.h>
@@ -441,13 +443,16 @@ bool MeshLoaderPL::ReadVertexBuffer(File &cFile, VertexBuffer &cVertexBuffer, ui
 		return false; // Error!
 
 	// Read vertex attributes
+	MeshFile::VertexAttribute *pVertexAttributes = new MeshFile::VertexAttribute[sVertexBuffer.nVertexAttributes ? sVertexBuffer.nVertexAttributes : 1];
+	bool bConvert = false;
 	for (uint32 i=0; i<sVertexBuffer.nVertexAttributes; i++) {
 		// Read vertex attribute
 		MeshFile::Chunk sChunk = ReadChunk(cFile);
-		if (sChunk.nType != MeshFile::CHUNK_VERTEXATTRIBUTE)
-			return false; // Error!
-		if (!ReadVertexAttribute(cFile, cVertexBuffer))
-			return false; // Error!
+		if (sChunk.nType != MeshFile::CHUNK_VERTEXATTRIBUTE || !ReadVertexAttribute(cFile, cVertexBuffer, pVertexAttributes[i], bConvert)) {
+			// Error!
+			delete [] pVertexAttributes;
+			return false;
+		}
 	}
 
 	// Allocate the vertex buffer
@@ -458,38 +463,181 @@ bool MeshLoaderPL::ReadVertexBuffer(File &cFile, VertexBuffer &cVertexBuffer, ui
 
 	// Read data
 	bool bResult = true; // No error by default
-	void *pData = cVertexBuffer.Lock(Lock::WriteOnly);
-	if (pData) {
-		if (!cFile.Read(pData, 1, sVertexBuffer.nSize))
-			bResult = false; // Error!
-
-		// Unlock the vertex buffer
-		cVertexBuffer.Unlock();
+	if (bConvert) {
+		// The renderer doesn't support all vertex attribute types of the file, convert the data
+		bResult = ReadConvertedVertexData(cFile, cVertexBuffer, sVertexBuffer, pVertexAttributes);
 	} else {
-		// Error!
-		bResult = false;
+		void *pData = cVertexBuffer.Lock(Lock::WriteOnly);
+		if (pData) {
+			if (!cFile.Read(pData, 1, sVertexBuffer.nSize))
+				bResult = false; // Error!
+
+			// Unlock the vertex buffer
+			cVertexBuffer.Unlock();
+		} else {
+			// Error!
+			bResult = false;
+		}
 	}
+	delete [] pVertexAttributes;
 
 	// Done
 	return bResult;
 }
 
-bool MeshLoaderPL::ReadVertexAttribute(File &cFile, VertexBuffer &cVertexBuffer) const
+bool MeshLoaderPL::ReadVertexAttribute(File &cFile, VertexBuffer &cVertexBuffer, MeshFile::VertexAttribute &sVertexAttribute, bool &bConvert) const
 {
 	// Read vertex attribute
-	MeshFile::VertexAttribute sVertexAttribute;
 	if (!cFile.Read(&sVertexAttribute, 1, sizeof(sVertexAttribute)))
 		return false; // Error!
-	cVertexBuffer.AddVertexAttribute(
-		static_cast<VertexBuffer::ESemantic>(sVertexAttribute.nSemantic),
-		sVertexAttribute.nChannel,
-		static_cast<VertexBuffer::EType>(sVertexAttribute.nType)
-	);
+	const VertexBuffer::ESemantic nSemantic = static_cast<VertexBuffer::ESemantic>(sVertexAttribute.nSemantic);
+	if (!cVertexBuffer.AddVertexAttribute(nSemantic, sVertexAttribute.nChannel, static_cast<VertexBuffer::EType>(sVertexAttribute.nType))) {
+		// Half and normalized integer types may not be supported by the renderer, use a floating point type instead
+		VertexBuffer::EType nType;
+		switch (sVertexAttribute.nType) {
+			case VertexBuffer::Half1:	nType = VertexBuffer::Float1;																							break;
+			case VertexBuffer::Half2:	nType = VertexBuffer::Float2;																							break;
+			case VertexBuffer::Half3:	nType = VertexBuffer::Float3;																							break;
+			case VertexBuffer::Half4:	nType = VertexBuffer::Float4;																							break;
+			case VertexBuffer::UByte4N:	nType = (nSemantic == VertexBuffer::Color) ? VertexBuffer::RGBA : VertexBuffer::Float4;								break;
+			case VertexBuffer::Short2N:	nType = VertexBuffer::Float2;																							break;
+			case VertexBuffer::Short4N:	nType = (nSemantic == VertexBuffer::Normal || nSemantic == VertexBuffer::Tangent || nSemantic == VertexBuffer::Binormal) ? VertexBuffer::Float3 : VertexBuffer::Float4;	break;
+			default:					return true; // Unknown vertex attribute, ignore it as before
+		}
+		if (cVertexBuffer.AddVertexAttribute(nSemantic, sVertexAttribute.nChannel, nType))
+			bConvert = true;
+	}
 
 	// Done
 	return true;
 }
 
+bool MeshLoaderPL::ReadConvertedVertexData(File &cFile, VertexBuffer &cVertexBuffer, const MeshFile::VertexBuffer &sVertexBuffer, const MeshFile::VertexAttribute *pVertexAttributes) const
+{
+	// Get the vertex size used within the file
+	if (!sVertexBuffer.nVertices || sVertexBuffer.nSize%sVertexBuffer.nVertices)
+		return false; // Error!
+	const uint32 nFileVertexSize = sVertexBuffer.nSize/sVertexBuffer.nVertices;
+
+	// Get the size of the vertex attributes within the file, the size of the API dependent "RGBA" is what's left over
+	uint32 nKnownSize = 0;
+	uint32 nNumOfRGBA = 0;
+	for (uint32 i=0; i<sVertexBuffer.nVertexAttributes; i++) {
+		switch (pVertexAttributes[i].nType) {
+			case VertexBuffer::RGBA:	nNumOfRGBA++;		break;
+			case VertexBuffer::Float1:	nKnownSize += 4;	break;
+			case VertexBuffer::Float2:	nKnownSize += 8;	break;
+			case VertexBuffer::Float3:	nKnownSize += 12;	break;
+			case VertexBuffer::Float4:	nKnownSize += 16;	break;
+			case VertexBuffer::Short2:	nKnownSize += 4;	break;
+			case VertexBuffer::Short4:	nKnownSize += 8;	break;
+			case VertexBuffer::Half1:	nKnownSize += 2;	break;
+			case VertexBuffer::Half2:	nKnownSize += 4;	break;
+			case VertexBuffer::Half3:	nKnownSize += 6;	break;
+			case VertexBuffer::Half4:	nKnownSize += 8;	break;
+			case VertexBuffer::UByte4N:	nKnownSize += 4;	break;
+			case VertexBuffer::Short2N:	nKnownSize += 4;	break;
+			case VertexBuffer::Short4N:	nKnownSize += 8;	break;
+			default:					return false; // Error, unknown vertex attribute type!
+		}
+	}
+	if (nKnownSize > nFileVertexSize)
+		return false; // Error!
+	const uint32 nRGBASize = nNumOfRGBA ? (nFileVertexSize - nKnownSize)/nNumOfRGBA : 0;
+	if (nNumOfRGBA && nRGBASize != sizeof(float)*4 && nRGBASize != sizeof(uint32))
+		return false; // Error, unknown API dependent color storage!
+
+	// Read the file data
+	uint8 *pnFileData = new uint8[sVertexBuffer.nSize];
+	bool bResult = (cFile.Read(pnFileData, 1, sVertexBuffer.nSize) == 1);
+
+	// Convert the data
+	if (bResult && cVertexBuffer.Lock(Lock::WriteOnly)) {
+		const uint8 *pnFileVertex = pnFileData;
+		for (uint32 nVertex=0; nVertex<sVertexBuffer.nVertices; nVertex++) {
+			for (uint32 i=0; i<sVertexBuffer.nVertexAttributes; i++) {
+				const MeshFile::VertexAttribute &sVertexAttribute = pVertexAttributes[i];
+				const uint8 *pnData = pnFileVertex;
+				float fValue[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+				switch (sVertexAttribute.nType) {
+					case VertexBuffer::RGBA:
+						if (nRGBASize == sizeof(uint32)) {
+							// D3DCOLOR, the bytes are stored as blue, green, red, alpha
+							fValue[0] = pnData[2]/255.0f;
+							fValue[1] = pnData[1]/255.0f;
+							fValue[2] = pnData[0]/255.0f;
+							fValue[3] = pnData[3]/255.0f;
+						} else {
+							MemoryManager::Copy(fValue, pnData, sizeof(float)*4);
+						}
+						pnFileVertex += nRGBASize;
+						break;
+
+					case VertexBuffer::Float1:
+					case VertexBuffer::Float2:
+					case VertexBuffer::Float3:
+					case VertexBuffer::Float4:
+					{
+						const uint32 nNumOfComponents = sVertexAttribute.nType - VertexBuffer::Float1 + 1;
+						MemoryManager::Copy(fValue, pnData, sizeof(float)*nNumOfComponents);
+						pnFileVertex += sizeof(float)*nNumOfComponents;
+						break;
+					}
+
+					case VertexBuffer::Short2:
+					case VertexBuffer::Short4:
+					{
+						const uint32 nNumOfComponents = (sVertexAttribute.nType == VertexBuffer::Short2) ? 2 : 4;
+						for (uint32 nComponent=0; nComponent<nNumOfComponents; nComponent++)
+							fValue[nComponent] = static_cast<float>(reinterpret_cast<const uint16*>(pnData)[nComponent]);
+						pnFileVertex += sizeof(uint16)*nNumOfComponents;
+						break;
+					}
+
+					case VertexBuffer::Half1:
+					case VertexBuffer::Half2:
+					case VertexBuffer::Half3:
+					case VertexBuffer::Half4:
+					{
+						const uint32 nNumOfComponents = sVertexAttribute.nType - VertexBuffer::Half1 + 1;
+						for (uint32 nComponent=0; nComponent<nNumOfComponents; nComponent++)
+							fValue[nComponent] = Half::ToFloat(reinterpret_cast<const uint16*>(pnData)[nComponent]);
+						pnFileVertex += sizeof(uint16)*nNumOfComponents;
+						break;
+					}
+
+					case VertexBuffer::UByte4N:
+						for (uint32 nComponent=0; nComponent<4; nComponent++)
+							fValue[nComponent] = pnData[nComponent]/255.0f;
+						pnFileVertex += sizeof(uint8)*4;
+						break;
+
+					case VertexBuffer::Short2N:
+					case VertexBuffer::Short4N:
+					{
+						const uint32 nNumOfComponents = (sVertexAttribute.nType == VertexBuffer::Short2N) ? 2 : 4;
+						for (uint32 nComponent=0; nComponent<nNumOfComponents; nComponent++)
+							fValue[nComponent] = Math::Max(reinterpret_cast<const int16*>(pnData)[nComponent]/32767.0f, -1.0f);
+						pnFileVertex += sizeof(int16)*nNumOfComponents;
+						break;
+					}
+				}
+				cVertexBuffer.SetFloat(nVertex, sVertexAttribute.nSemantic, sVertexAttribute.nChannel, fValue[0], fValue[1], fValue[2], fValue[3]);
+			}
+		}
+
+		// Unlock the vertex buffer
+		cVertexBuffer.Unlock();
+	} else {
+		// Error!
+		bResult = false;
+	}
+	delete [] pnFileData;
+
+	// Done
+	return bResult;
+}
+
 bool MeshLoaderPL::ReadSkeleton(Mesh &cMesh, File &cFile) const
 {
 	// Read skeleton header
@@ -551,6 +551,20 @@ bool MeshLoaderPLXml::ReadVertexBuffer(VertexBuffer &cVertexBuffer, uint32 nInde
 						nType = VertexBuffer::Short2;
 					else if (sType == "Short4")
 						nType = VertexBuffer::Short4;
+					else if (sType == "Half1")
+						nType = VertexBuffer::Half1;
+					else if (sType == "Half2")
+						nType = VertexBuffer::Half2;
+					else if (sType == "Half3")
+						nType = VertexBuffer::Half3;
+					else if (sType == "Half4")
+						nType = VertexBuffer::Half4;
+					else if (sType == "UByte4N")
+						nType = VertexBuffer::UByte4N;
+					else if (sType == "Short2N")
+						nType = VertexBuffer::Short2N;
+					else if (sType == "Short4N")
+						nType = VertexBuffer::Short4N;
 
 					// The type must match!
 					if (pVertexAttribute->nType == nType) {
@@ -604,8 +618,16 @@ bool MeshLoaderPLXml::ReadVertexBuffer(VertexBuffer &cVertexBuffer, uint32 nInde
 									case VertexBuffer::Half2:
 									case VertexBuffer::Half3:
 									case VertexBuffer::Half4:
-										// [TODO] Implement me
+									case VertexBuffer::UByte4N:
+									case VertexBuffer::Short2N:
+									case VertexBuffer::Short4N:
+									{
+										// The values are stored as floating point values
+										float fData[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+										ParseTools::ParseFloatArray(sValue, fData, (nType == VertexBuffer::Half1) ? 1 : (nType == VertexBuffer::Half2 || nType == VertexBuffer::Short2N) ? 2 : (nType == VertexBuffer::Half3) ? 3 : 4);
+										cVertexBuffer.SetFloat(nVertex, pVertexAttribute->nSemantic, pVertexAttribute->nChannel, fData[0], fData[1], fData[2], fData[3]);
 										break;
+									}
 								}
 							}
 						}
@@ -677,6 +699,20 @@ bool MeshLoaderPLXml::ReadVertexAttribute(VertexBuffer &cVertexBuffer, const Xml
 		nType = VertexBuffer::Short2;
 	else if (sType == "Short4")
 		nType = VertexBuffer::Short4;
+	else if (sType == "Half1")
+		nType = VertexBuffer::Half1;
+	else if (sType == "Half2")
+		nType = VertexBuffer::Half2;
+	else if (sType == "Half3")
+		nType = VertexBuffer::Half3;
+	else if (sType == "Half4")
+		nType = VertexBuffer::Half4;
+	else if (sType == "UByte4N")
+		nType = VertexBuffer::UByte4N;
+	else if (sType == "Short2N")
+		nType = VertexBuffer::Short2N;
+	else if (sType == "Short4N")
+		nType = VertexBuffer::Short4N;
 
 	// Finally, add the read in vertex attribute!
 	cVertexBuffer.AddVertexAttribute(nSemantic, nChannel, nType);
@@ -1503,6 +1539,13 @@ bool MeshLoaderPLXml::WriteVertexBuffer(VertexBuffer &cVertexBuffer, uint32 nID,
 		lstElementType.Add("Float4");
 		lstElementType.Add("Short2");
 		lstElementType.Add("Short4");
+		lstElementType.Add("Half1");
+		lstElementType.Add("Half2");
+		lstElementType.Add("Half3");
+		lstElementType.Add("Half4");
+		lstElementType.Add("UByte4N");
+		lstElementType.Add("Short2N");
+		lstElementType.Add("Short4N");
 
 		// Loop through all elements
 		for (uint32 nVertex=0; nVertex<cVertexBuffer.GetNumOfElements(); nVertex++) {
@@ -1541,8 +1584,22 @@ bool MeshLoaderPLXml::WriteVertexBuffer(VertexBuffer &cVertexBuffer, uint32 nID,
 					case VertexBuffer::Half2:
 					case VertexBuffer::Half3:
 					case VertexBuffer::Half4:
-						// [TODO] Implement me
+					case VertexBuffer::UByte4N:
+					case VertexBuffer::Short2N:
+					case VertexBuffer::Short4N:
+					{
+						// Store the values as floating point values
+						float fX, fY, fZ, fW;
+						cVertexBuffer.GetFloat(nVertex, pVertexAttribute->nSemantic, pVertexAttribute->nChannel, fX, fY, fZ, fW);
+						switch (pVertexAttribute->nType) {
+							case VertexBuffer::Half1:	sValue = fX;														break;
+							case VertexBuffer::Half2:
+							case VertexBuffer::Short2N:	sValue = String::Format("%f %f", fX, fY);							break;
+							case VertexBuffer::Half3:	sValue = String::Format("%f %f %f", fX, fY, fZ);					break;
+							default:					sValue = String::Format("%f %f %f %f", fX, fY, fZ, fW);			break;
+						}
 						break;
+					}
 				}
 				XmlText *pValue = new XmlText(sValue);
 				pElement->LinkEndChild(*pValue);
@@ -1600,13 +1657,13 @@ bool MeshLoaderPLXml::WriteVertexAttribute(const VertexBuffer::Attribute &cVerte
 		case VertexBuffer::Float4:	pVertexAttributeElement->SetAttribute("Type", "Float4");	break;
 		case VertexBuffer::Short2:	pVertexAttributeElement->SetAttribute("Type", "Short2");	break;
 		case VertexBuffer::Short4:	pVertexAttributeElement->SetAttribute("Type", "Short4");	break;
-
-		case VertexBuffer::Half1:
-		case VertexBuffer::Half2:
-		case VertexBuffer::Half3:
-		case VertexBuffer::Half4:
-			// [TODO] Implement me
-			break;
+		case VertexBuffer::Half1:	pVertexAttributeElement->SetAttribute("Type", "Half1");		break;
+		case VertexBuffer::Half2:	pVertexAttributeElement->SetAttribute("Type", "Half2");		break;
+		case VertexBuffer::Half3:	pVertexAttributeElement->SetAttribute("Type", "Half3");		break;
+		case VertexBuffer::Half4:	pVertexAttributeElement->SetAttribute("Type", "Half4");		break;
+		case VertexBuffer::UByte4N:	pVertexAttributeElement->SetAttribute("Type", "UByte4N");	break;
+		case VertexBuffer::Short2N:	pVertexAttributeElement->SetAttribute("Type", "Short2N");	break;
+		case VertexBuffer::Short4N:	pVertexAttributeElement->SetAttribute("Type", "Short4N");	break;
 	}
 
 	// Link vertex attribute element to parent
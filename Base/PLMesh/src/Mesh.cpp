@@ -876,6 +876,38 @@ Mesh::Mesh(Renderer *pRenderer, ResourceManager<Mesh> &cManager, const String &s
 }
 
 
+//[-------------------------------------------------------]
+//[ Public virtual PLCore::Resource functions             ]
+//[-------------------------------------------------------]
+uint64 Mesh::GetCPUMemoryUsage() const
+{
+	// Weights, the geometry itself lives within the vertex and index buffers
+	return m_lstWeights.GetNumOfElements()*sizeof(Weight) + m_lstVertexWeights.GetNumOfElements()*sizeof(VertexWeights);
+}
+
+uint64 Mesh::GetGPUMemoryUsage() const
+{
+	uint64 nNumOfBytes = 0;
+
+	// Vertex buffers of the morph targets
+	for (uint32 i=0; i<m_lstMorphTargets.GetNumOfElements(); i++) {
+		const VertexBuffer *pVertexBuffer = m_lstMorphTargets[i]->GetVertexBuffer();
+		if (pVertexBuffer)
+			nNumOfBytes += pVertexBuffer->GetSize();
+	}
+
+	// Index buffers of the LOD levels
+	for (uint32 i=0; i<m_lstLODLevels.GetNumOfElements(); i++) {
+		const IndexBuffer *pIndexBuffer = m_lstLODLevels[i]->GetIndexBuffer();
+		if (pIndexBuffer)
+			nNumOfBytes += pIndexBuffer->GetSize();
+	}
+
+	// Done
+	return nNumOfBytes;
+}
+
+
 //[-------------------------------------------------------]
 //[ Public virtual PLCore::Loadable functions             ]
 //[-------------------------------------------------------]
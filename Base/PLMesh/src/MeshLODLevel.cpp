@@ -34,6 +34,7 @@
 #include "PLMesh/Mesh.h"
 #include "PLMesh/Geometry.h"
 #include "PLMesh/MeshOctree.h"
+#include "PLMesh/MeshMorphTarget.h"
 #include "PLMesh/MeshLODLevel.h"
 
 
@@ -58,7 +59,11 @@ MeshLODLevel::MeshLODLevel(Mesh *pMesh) :
 	m_fDistance(0.0f),
 	m_pIndexBuffer(nullptr),
 	m_plstGeometries(nullptr),
-	m_pOctree(nullptr)
+	m_pOctree(nullptr),
+	m_bTrianglePositionsBuilt(false),
+	m_pTrianglePositionsVertexBuffer(nullptr),
+	m_nTrianglePositionsNumOfVertices(0),
+	m_nTrianglePositionsNumOfIndices(0)
 {
 }
 
@@ -163,6 +168,9 @@ MeshLODLevel &MeshLODLevel::operator =(const MeshLODLevel &cSource)
 	m_lstEdges.Resize(cSource.m_lstEdges.GetNumOfElements());
 	for (uint32 i=0; i<m_lstEdges.GetNumOfElements(); i++)
 		MemoryManager::Copy(&m_lstEdges[i], &cSource.m_lstEdges[i], m_lstEdges.GetElementSize());
+	// Triangle positions, they're built again on demand because the vertex buffer of the mesh may be a different one
+	m_lstTrianglePositions.Clear();
+	m_bTrianglePositionsBuilt = false;
 
 	// Return pointer
 	return *this;
@@ -182,6 +190,9 @@ void MeshLODLevel::ClearIndexBuffer()
 		delete m_pIndexBuffer;
 		m_pIndexBuffer = nullptr;
 	}
+
+	// The triangle position list is no longer up-to-date
+	m_bTrianglePositionsBuilt = false;
 }
 
 /**
@@ -240,6 +251,8 @@ void MeshLODLevel::ClearGeometries()
 	// Destroy precalculated data
 	m_lstTriangles.Clear();
 	    m_lstEdges.Clear();
+	m_lstTrianglePositions.Clear();
+	m_bTrianglePositionsBuilt = false;
 }
 
 /**
@@ -514,6 +527,85 @@ Array<MeshEdge> &MeshLODLevel::GetEdgeList()
 	return m_lstEdges;
 }
 
+/**
+*  @brief
+*    Builds the current triangle position list
+*/
+void MeshLODLevel::BuildTrianglePositionList()
+{
+	// Reset the current list
+	m_lstTrianglePositions.Reset();
+
+	// Get the vertex buffer of the first morph target
+	MeshMorphTarget *pMorphTarget = m_pMesh ? m_pMesh->GetMorphTarget() : nullptr;
+	VertexBuffer *pVertexBuffer = pMorphTarget ? pMorphTarget->GetVertexBuffer() : nullptr;
+
+	// Remember what the list is built from, even if it stays empty it's not built again until something changed
+	m_bTrianglePositionsBuilt		  = true;
+	m_pTrianglePositionsVertexBuffer  = pVertexBuffer;
+	m_nTrianglePositionsNumOfVertices = pVertexBuffer ? pVertexBuffer->GetNumOfElements() : 0;
+	m_nTrianglePositionsNumOfIndices  = m_pIndexBuffer ? m_pIndexBuffer->GetNumOfElements() : 0;
+	if (pVertexBuffer && m_plstGeometries && m_pIndexBuffer) {
+		// Lock the vertex buffer
+		if (pVertexBuffer->Lock(Lock::ReadOnly)) {
+			// Lock the index buffer
+			if (m_pIndexBuffer->Lock(Lock::ReadOnly)) {
+				// Allocate the list at once
+				m_lstTrianglePositions.Resize(GetNumOfTriangles()*3, true, false);
+
+				// Loop through all geometries
+				const uint32 nNumOfVertices = pVertexBuffer->GetNumOfElements();
+				uint32 nPosition = 0;
+				for (uint32 nGeo=0; nGeo<m_plstGeometries->GetNumOfElements(); nGeo++) {
+					const Geometry &cGeometry = m_plstGeometries->Get(nGeo);
+					for (uint32 nTri=0; nTri<cGeometry.GetNumOfTriangles(); nTri++) {
+						// Get triangle data
+						uint32 nVertex[3];
+						if (GetTriangle(nGeo, nTri, nVertex[0], nVertex[1], nVertex[2]) &&
+							nVertex[0] < nNumOfVertices && nVertex[1] < nNumOfVertices && nVertex[2] < nNumOfVertices) {
+							for (uint32 i=0; i<3; i++) {
+								const float *pfPos = static_cast<const float*>(pVertexBuffer->GetData(nVertex[i], VertexBuffer::Position));
+								m_lstTrianglePositions[nPosition++].SetXYZ(pfPos);
+							}
+						}
+					}
+				}
+
+				// Invalid triangles were skipped, set the final size
+				m_lstTrianglePositions.Resize(nPosition, true, false);
+
+				// Unlock the index buffer
+				m_pIndexBuffer->Unlock();
+			}
+
+			// Unlock the vertex buffer
+			pVertexBuffer->Unlock();
+		}
+	}
+}
+
+/**
+*  @brief
+*    Gets the triangle position list
+*/
+const Array<Vector3> &MeshLODLevel::GetTrianglePositionList()
+{
+	// Build the triangle position list if it wasn't built yet or if one of the buffers was reallocated since then
+	if (m_bTrianglePositionsBuilt) {
+		const MeshMorphTarget *pMorphTarget = m_pMesh ? m_pMesh->GetMorphTarget() : nullptr;
+		const VertexBuffer *pVertexBuffer = pMorphTarget ? pMorphTarget->GetVertexBuffer() : nullptr;
+		if (pVertexBuffer != m_pTrianglePositionsVertexBuffer ||
+			(pVertexBuffer ? pVertexBuffer->GetNumOfElements() : 0) != m_nTrianglePositionsNumOfVertices ||
+			(m_pIndexBuffer ? m_pIndexBuffer->GetNumOfElements() : 0) != m_nTrianglePositionsNumOfIndices)
+			BuildTrianglePositionList();
+	} else {
+		BuildTrianglePositionList();
+	}
+
+	// Return the triangle position list
+	return m_lstTrianglePositions;
+}
+
 /**
 *  @brief
 *    Gets a triangle of a geometry
@@ -751,6 +843,9 @@ bool MeshLODLevel::SplitGeometries(bool bSingleGeometries, uint32 *pSplit, uint3
 	delete m_pIndexBuffer;
 	m_pIndexBuffer = pIndexBuffer;
 
+	// The triangle position list is no longer up-to-date
+	m_bTrianglePositionsBuilt = false;
+
 	// Destroy old octee
 	DestroyOctree();
 
@@ -866,6 +961,9 @@ bool MeshLODLevel::JoinGeometries(uint32 *pJoin, uint32 nJoinNumber)
 	delete m_pIndexBuffer;
 	m_pIndexBuffer = pIndexBuffer;
 
+	// The triangle position list is no longer up-to-date
+	m_bTrianglePositionsBuilt = false;
+
 	// Destroy old octee
 	DestroyOctree();
 
@@ -0,0 +1,431 @@
+/*********************************************************\
+ *  File: MeshQuantizer.cpp                              *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <PLCore/Log/Log.h>
+#include <PLMath/Math.h>
+#include <PLMath/Half.h>
+#include <PLRenderer/Renderer/Renderer.h>
+#include <PLRenderer/Renderer/VertexBuffer.h>
+#include "PLMesh/Mesh.h"
+#include "PLMesh/MeshMorphTarget.h"
+#include "PLMesh/MeshQuantizer.h"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+using namespace PLCore;
+using namespace PLMath;
+using namespace PLRenderer;
+namespace PLMesh {
+
+
+//[-------------------------------------------------------]
+//[ Global helper functions                               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Returns the number of floating point components "VertexBuffer::GetFloatArray()" uses for the given vertex attribute type
+*/
+static uint32 GetNumOfFloatComponents(VertexBuffer::EType nType)
+{
+	switch (nType) {
+		case VertexBuffer::Float1:
+		case VertexBuffer::Half1:
+			return 1;
+
+		case VertexBuffer::Float2:
+		case VertexBuffer::Short2:
+		case VertexBuffer::Half2:
+		case VertexBuffer::Short2N:
+			return 2;
+
+		case VertexBuffer::Float3:
+		case VertexBuffer::Half3:
+			return 3;
+
+		case VertexBuffer::RGBA:
+		case VertexBuffer::Float4:
+		case VertexBuffer::Short4:
+		case VertexBuffer::Half4:
+		case VertexBuffer::UByte4N:
+		case VertexBuffer::Short4N:
+			return 4;
+
+		default:
+			return 0;
+	}
+}
+
+/**
+*  @brief
+*    Returns the maximum absolute component error when quantizing the given floating point data
+*
+*  @param[in] nType
+*    Quantized vertex attribute type (Half2, Half4, UByte4N or Short4N)
+*  @param[in] pfData
+*    Floating point data
+*  @param[in] nNumOfValues
+*    Number of floating point values
+*
+*  @return
+*    The maximum absolute component error, not a number or infinity if the data can't be represented at all
+*/
+static float GetQuantizationError(VertexBuffer::EType nType, const float *pfData, uint32 nNumOfValues)
+{
+	float fMaxError = 0.0f;
+	switch (nType) {
+		case VertexBuffer::Half2:
+		case VertexBuffer::Half4:
+		{
+			// Convert blocks back and forth at once
+			static const uint32 BlockSize = 1024;
+			uint16 nHalf[BlockSize];
+			float  fValue[BlockSize];
+			for (uint32 nValue=0; nValue<nNumOfValues; nValue+=BlockSize) {
+				const uint32 nNumOfBlockValues = (nNumOfValues - nValue < BlockSize) ? (nNumOfValues - nValue) : BlockSize;
+				Half::FromFloatArray(&pfData[nValue], nHalf, nNumOfBlockValues);
+				Half::ToFloatArray(nHalf, fValue, nNumOfBlockValues);
+				for (uint32 i=0; i<nNumOfBlockValues; i++) {
+					const float fError = Math::Abs(fValue[i] - pfData[nValue + i]);
+					if (!(fError <= fMaxError))
+						fMaxError = fError;	// Not a number or infinity is kept, too
+				}
+			}
+			break;
+		}
+
+		case VertexBuffer::UByte4N:
+			for (uint32 i=0; i<nNumOfValues; i++) {
+				const float fValue = static_cast<uint32>(Math::Min(Math::Max(pfData[i], 0.0f), 1.0f)*255.0f + 0.5f)/255.0f;
+				const float fError = Math::Abs(fValue - pfData[i]);
+				if (!(fError <= fMaxError))
+					fMaxError = fError;
+			}
+			break;
+
+		case VertexBuffer::Short4N:
+			for (uint32 i=0; i<nNumOfValues; i++) {
+				const float fScaled = Math::Min(Math::Max(pfData[i], -1.0f), 1.0f)*32767.0f;
+				const float fValue  = static_cast<int32>((fScaled < 0.0f) ? fScaled - 0.5f : fScaled + 0.5f)/32767.0f;
+				const float fError  = Math::Abs(fValue - pfData[i]);
+				if (!(fError <= fMaxError))
+					fMaxError = fError;
+			}
+			break;
+
+		default:
+			break;
+	}
+	return fMaxError;
+}
+
+
+//[-------------------------------------------------------]
+//[ Public functions                                      ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Constructor
+*/
+MeshQuantizer::MeshQuantizer() :
+	m_bQuantizePositions(false)
+{
+	SetMaxErrors();
+}
+
+/**
+*  @brief
+*    Destructor
+*/
+MeshQuantizer::~MeshQuantizer()
+{
+}
+
+/**
+*  @brief
+*    Returns whether or not positions are quantized
+*/
+bool MeshQuantizer::GetQuantizePositions() const
+{
+	return m_bQuantizePositions;
+}
+
+/**
+*  @brief
+*    Sets whether or not positions are quantized
+*/
+void MeshQuantizer::SetQuantizePositions(bool bQuantize)
+{
+	m_bQuantizePositions = bQuantize;
+}
+
+/**
+*  @brief
+*    Returns the error bounds
+*/
+void MeshQuantizer::GetMaxErrors(float &fPosition, float &fVector, float &fTexCoord, float &fColor) const
+{
+	fPosition = m_fMaxPositionError;
+	fVector   = m_fMaxVectorError;
+	fTexCoord = m_fMaxTexCoordError;
+	fColor    = m_fMaxColorError;
+}
+
+/**
+*  @brief
+*    Sets the error bounds
+*/
+void MeshQuantizer::SetMaxErrors(float fPosition, float fVector, float fTexCoord, float fColor)
+{
+	m_fMaxPositionError = fPosition;
+	m_fMaxVectorError   = fVector;
+	m_fMaxTexCoordError = fTexCoord;
+	m_fMaxColorError    = fColor;
+}
+
+/**
+*  @brief
+*    Quantizes all vertex buffers of a mesh
+*/
+bool MeshQuantizer::Quantize(Mesh &cMesh, Result *pResult) const
+{
+	Result sResult;
+	MemoryManager::Set(&sResult, 0, sizeof(Result));
+
+	// The software mesh animation works with floating point positions, normals, tangents and binormals
+	const bool bVectors = (!cMesh.GetWeights().GetNumOfElements() && !cMesh.GetVertexWeights().GetNumOfElements() && cMesh.GetNumOfMorphTargets() <= 1);
+
+	// Quantize the vertex buffers of all morph targets
+	bool bResult = true; // No error by default
+	for (uint32 i=0; i<cMesh.GetNumOfMorphTargets(); i++) {
+		VertexBuffer *pVertexBuffer = cMesh.GetMorphTarget(i)->GetVertexBuffer();
+		if (pVertexBuffer && !QuantizeVertexBuffer(*pVertexBuffer, bVectors, sResult))
+			bResult = false; // Error!
+	}
+
+	// Report the saved memory
+	if (sResult.nSizeBefore) {
+		const uint32 nSaved = sResult.nSizeBefore - sResult.nSizeAfter;
+		PL_LOG(Info, "Quantized mesh '" + cMesh.GetName() + "': vertex data " + sResult.nSizeBefore + " -> " + sResult.nSizeAfter + " bytes, saved " +
+					 nSaved + " bytes (" + static_cast<uint32>(static_cast<uint64>(nSaved)*100/sResult.nSizeBefore) + "%), " +
+					 sResult.nNumOfQuantized + " attributes quantized, " + sResult.nNumOfRejected + " kept due to the error bounds")
+	}
+
+	// Done
+	if (pResult)
+		*pResult = sResult;
+	return bResult;
+}
+
+/**
+*  @brief
+*    Quantizes a vertex buffer
+*/
+bool MeshQuantizer::Quantize(VertexBuffer &cVertexBuffer, Result *pResult) const
+{
+	Result sResult;
+	MemoryManager::Set(&sResult, 0, sizeof(Result));
+	const bool bResult = QuantizeVertexBuffer(cVertexBuffer, true, sResult);
+	if (pResult)
+		*pResult = sResult;
+	return bResult;
+}
+
+
+//[-------------------------------------------------------]
+//[ Private functions                                     ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Quantizes a vertex buffer
+*/
+bool MeshQuantizer::QuantizeVertexBuffer(VertexBuffer &cVertexBuffer, bool bVectors, Result &sResult) const
+{
+	// Anything to do?
+	const uint32 nNumOfVertices   = cVertexBuffer.GetNumOfElements();
+	const uint32 nNumOfAttributes = cVertexBuffer.GetNumOfVertexAttributes();
+	sResult.nNumOfVertexBuffers++;
+	sResult.nSizeBefore += cVertexBuffer.GetSize();
+	if (!nNumOfVertices || !nNumOfAttributes) {
+		sResult.nSizeAfter += cVertexBuffer.GetSize();
+		return true; // Done, nothing to do
+	}
+
+	// Vertex attribute data
+	struct AttributeData {
+		VertexBuffer::ESemantic  nSemantic;			/**< Vertex attribute semantic */
+		uint32					 nChannel;			/**< Pipeline channel */
+		VertexBuffer::EType		 nType;				/**< Type the vertex attribute is going to have */
+		uint32					 nNumOfComponents;	/**< Number of floating point components per vertex within "pfData" */
+		float					*pfData;			/**< Floating point data of all vertices */
+	};
+	AttributeData *pAttributes = new AttributeData[nNumOfAttributes];
+	MemoryManager::Set(pAttributes, 0, sizeof(AttributeData)*nNumOfAttributes);
+
+	// Read all vertex attributes as floating point data
+	bool bResult = false; // Error by default
+	if (cVertexBuffer.Lock(Lock::ReadOnly)) {
+		bResult = true;
+		for (uint32 i=0; i<nNumOfAttributes && bResult; i++) {
+			const VertexBuffer::Attribute &cAttribute = *cVertexBuffer.GetVertexAttribute(i);
+			AttributeData &sAttribute = pAttributes[i];
+			sAttribute.nSemantic		= cAttribute.nSemantic;
+			sAttribute.nChannel			= cAttribute.nChannel;
+			sAttribute.nType			= cAttribute.nType;
+			sAttribute.nNumOfComponents	= GetNumOfFloatComponents(cAttribute.nType);
+			sAttribute.pfData			= new float[nNumOfVertices*sAttribute.nNumOfComponents];
+			bResult = cVertexBuffer.GetFloatArray(cAttribute.nSemantic, cAttribute.nChannel, 0, nNumOfVertices, sAttribute.pfData);
+		}
+		cVertexBuffer.Unlock();
+	}
+
+	// Cg assembly profiles can't pass the normalization flag of the normalized integer types to OpenGL, so don't use them when Cg is the default shader language
+	const bool bNormalizedTypes = (cVertexBuffer.GetRenderer().GetDefaultShaderLanguage() != "Cg");
+
+	// Choose the quantized types, use a scratch vertex buffer to check whether or not the renderer supports them
+	VertexBuffer *pScratchVertexBuffer = bResult ? cVertexBuffer.GetRenderer().CreateVertexBuffer() : nullptr;
+	bool bChanged = false;
+	if (pScratchVertexBuffer) {
+		for (uint32 i=0; i<nNumOfAttributes; i++) {
+			AttributeData &sAttribute = pAttributes[i];
+
+			// Get the quantized type and the error bound
+			VertexBuffer::EType nType = sAttribute.nType;
+			float fMaxError = 0.0f;
+			float *pfResultError = nullptr;
+			switch (sAttribute.nSemantic) {
+				case VertexBuffer::Position:
+					if (bVectors && m_bQuantizePositions && (nType == VertexBuffer::Float3 || nType == VertexBuffer::Float4)) {
+						nType		  = VertexBuffer::Half4;	// "Half3" would break the 4 byte alignment
+						fMaxError	  = m_fMaxPositionError;
+						pfResultError = &sResult.fMaxPositionError;
+					}
+					break;
+
+				case VertexBuffer::Normal:
+				case VertexBuffer::Tangent:
+				case VertexBuffer::Binormal:
+					if (bVectors && bNormalizedTypes && nType == VertexBuffer::Float3) {
+						nType		  = VertexBuffer::Short4N;
+						fMaxError	  = m_fMaxVectorError;
+						pfResultError = &sResult.fMaxVectorError;
+					}
+					break;
+
+				case VertexBuffer::TexCoord:
+					if (nType == VertexBuffer::Float2 || nType == VertexBuffer::Float3 || nType == VertexBuffer::Float4) {
+						nType		  = (nType == VertexBuffer::Float2) ? VertexBuffer::Half2 : VertexBuffer::Half4;
+						fMaxError	  = m_fMaxTexCoordError;
+						pfResultError = &sResult.fMaxTexCoordError;
+					}
+					break;
+
+				case VertexBuffer::Color:
+				case VertexBuffer::BlendWeight:
+					// "RGBA" is already as small as "UByte4N", keep it
+					if (bNormalizedTypes && (nType == VertexBuffer::Float1 || nType == VertexBuffer::Float2 || nType == VertexBuffer::Float3 || nType == VertexBuffer::Float4)) {
+						nType		  = VertexBuffer::UByte4N;
+						fMaxError	  = m_fMaxColorError;
+						pfResultError = &sResult.fMaxColorError;
+					}
+					break;
+
+				case VertexBuffer::FogCoord:
+				case VertexBuffer::PointSize:
+				case VertexBuffer::BlendIndices:
+				default:
+					// Keep the type
+					break;
+			}
+
+			// Is the error within the bound and does the renderer support the type?
+			if (nType != sAttribute.nType) {
+				const float fError = GetQuantizationError(nType, sAttribute.pfData, nNumOfVertices*sAttribute.nNumOfComponents);
+				pScratchVertexBuffer->ClearVertexAttributes();
+				if (fError <= fMaxError && pScratchVertexBuffer->AddVertexAttribute(sAttribute.nSemantic, sAttribute.nChannel, nType)) {
+					// Expand the data to the number of components of the quantized type, positions get w=1
+					const uint32 nNumOfComponents = GetNumOfFloatComponents(nType);
+					if (nNumOfComponents != sAttribute.nNumOfComponents) {
+						float *pfData = new float[nNumOfVertices*nNumOfComponents];
+						const float fW = (sAttribute.nSemantic == VertexBuffer::Position) ? 1.0f : 0.0f;
+						for (uint32 nVertex=0; nVertex<nNumOfVertices; nVertex++) {
+							for (uint32 nComponent=0; nComponent<nNumOfComponents; nComponent++)
+								pfData[nVertex*nNumOfComponents + nComponent] = (nComponent < sAttribute.nNumOfComponents) ? sAttribute.pfData[nVertex*sAttribute.nNumOfComponents + nComponent] : ((nComponent == 3) ? fW : 0.0f);
+						}
+						delete [] sAttribute.pfData;
+						sAttribute.pfData			= pfData;
+						sAttribute.nNumOfComponents	= nNumOfComponents;
+					}
+					sAttribute.nType = nType;
+					if (*pfResultError < fError)
+						*pfResultError = fError;
+					sResult.nNumOfQuantized++;
+					bChanged = true;
+				} else {
+					sResult.nNumOfRejected++;
+				}
+			}
+		}
+		delete pScratchVertexBuffer;
+	}
+
+	// Rebuild the vertex buffer using the new vertex attribute types
+	if (bResult && bChanged) {
+		const Usage::Enum nUsage   = cVertexBuffer.GetUsage();
+		const bool		  bManaged = cVertexBuffer.IsManaged();
+		cVertexBuffer.Clear();
+		cVertexBuffer.ClearVertexAttributes();
+		for (uint32 i=0; i<nNumOfAttributes; i++)
+			cVertexBuffer.AddVertexAttribute(pAttributes[i].nSemantic, pAttributes[i].nChannel, pAttributes[i].nType);
+		bResult = (cVertexBuffer.Allocate(nNumOfVertices, nUsage, bManaged) && cVertexBuffer.Lock(Lock::WriteOnly));
+		if (bResult) {
+			for (uint32 i=0; i<nNumOfAttributes; i++) {
+				if (!cVertexBuffer.SetFloatArray(pAttributes[i].nSemantic, pAttributes[i].nChannel, 0, nNumOfVertices, pAttributes[i].pfData))
+					bResult = false; // Error!
+			}
+			cVertexBuffer.Unlock();
+		}
+	}
+	sResult.nSizeAfter += cVertexBuffer.GetSize();
+
+	// Cleanup
+	for (uint32 i=0; i<nNumOfAttributes; i++) {
+		if (pAttributes[i].pfData)
+			delete [] pAttributes[i].pfData;
+	}
+	delete [] pAttributes;
+
+	// Done
+	return bResult;
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // PLMesh
@@ -194,6 +194,23 @@ String Skeleton::GetSourceName() const
 }
 
 
+//[-------------------------------------------------------]
+//[ Public virtual PLCore::Resource functions             ]
+//[-------------------------------------------------------]
+uint64 Skeleton::GetCPUMemoryUsage() const
+{
+	// Joints and their animation information
+	uint64 nNumOfBytes = ElementManager<Joint>::GetNumOfElements()*(sizeof(Joint) + sizeof(AniJoint)) + m_lstRootJoints.GetNumOfElements()*sizeof(uint32);
+
+	// Frame keys
+	for (uint32 i=0; i<m_lstFrameKeys.GetNumOfElements(); i++)
+		nNumOfBytes += sizeof(FrameKeys) + m_lstFrameKeys[i].lstFrameKeys.GetNumOfElements()*sizeof(float);
+
+	// Done
+	return nNumOfBytes;
+}
+
+
 //[-------------------------------------------------------]
 //[ Public virtual PLCore::Loadable functions             ]
 //[-------------------------------------------------------]
@@ -624,6 +624,7 @@ class SNRagdoll : public PLScene::SNMesh, public PLCore::Loadable {
 		PLPHYSICS_API virtual void InitFunction() override;
 		PLPHYSICS_API virtual void DeInitFunction() override;
 		PLPHYSICS_API virtual void OnActivate(bool bActivate) override;
+		PLPHYSICS_API virtual bool ResetFunction() override;
 
 
 	//[-------------------------------------------------------]
@@ -1179,6 +1179,12 @@ void SNRagdoll::OnActivate(bool bActivate)
 	}
 }
 
+bool SNRagdoll::ResetFunction()
+{
+	// The bodies, joints and controller state of a ragdoll are not described by attributes, so don't pool it
+	return false;
+}
+
 
 //[-------------------------------------------------------]
 //[ Public virtual PLCore::Loadable functions             ]
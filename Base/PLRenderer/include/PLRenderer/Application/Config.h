@@ -142,6 +142,7 @@ class Config : public ConfigGroup {
 		pl_attribute_directvalue(TextureQuality,					float,				1.0f,								ReadWrite)
 		pl_attribute_directvalue(TextureMipmaps,					bool,				true,								ReadWrite)
 		pl_attribute_directvalue(TextureCompression,				bool,				true,								ReadWrite)
+		pl_attribute_directvalue(ProgramCache,						bool,				true,								ReadWrite)
 	pl_class_def_end
 
 
@@ -33,6 +33,7 @@
 #include "PLRenderer/Renderer/SamplerStates.h"
 #include "PLRenderer/Renderer/FixedFunctionsTextureStageStates.h"
 #include "PLRenderer/Texture/Texture.h"
+#include "PLRenderer/Material/ParameterID.h"
 
 
 //[-------------------------------------------------------]
@@ -187,6 +188,7 @@ class EffectPassLayer {
 	private:
 		EffectPass						 *m_pFXPass;							/**< Layer owner (NEVER a null pointer!) */
 		PLCore::String					  m_sTexture;							/**< The name of the used texture parameter */
+		ParameterID						  m_cTextureID;							/**< The interned name of the used texture parameter */
 		SamplerStates					  m_cSamplerStates;						/**< Sampler states */
 		FixedFunctionsTextureStageStates  m_cFixedFunctionsTextureStageStates;	/**< Fixed functions texture stage states */
 
@@ -55,7 +55,8 @@ inline PLCore::String EffectPassLayer::GetTexture() const
 */
 inline void EffectPassLayer::SetTexture(const PLCore::String &sTexture)
 {
-	m_sTexture = sTexture;
+	m_sTexture   = sTexture;
+	m_cTextureID = ParameterID(sTexture);
 }
 
 /**
@@ -93,7 +94,8 @@ inline const FixedFunctionsTextureStageStates &EffectPassLayer::GetFixedFunction
 inline EffectPassLayer &EffectPassLayer::operator =(const EffectPassLayer &cSource)
 {
 	// Texture
-	m_sTexture = cSource.m_sTexture;
+	m_sTexture   = cSource.m_sTexture;
+	m_cTextureID = cSource.m_cTextureID;
 
 	// Copy states
 	m_cSamplerStates				    = cSource.m_cSamplerStates;
@@ -47,6 +47,7 @@ namespace PLRenderer {
 //[-------------------------------------------------------]
 class Effect;
 class Parameter;
+class ParameterID;
 class TextureBuffer;
 class EffectHandler;
 class MaterialHandler;
@@ -157,6 +158,21 @@ class Material : public PLCore::Resource<Material> {
 		*/
 		PLRENDERER_API Parameter *GetParameter(const PLCore::String &sName) const;
 
+		/**
+		*  @brief
+		*    Gets a material/effect parameter by interned name
+		*
+		*  @param[in] cID
+		*    Interned parameter name
+		*
+		*  @return
+		*    The requested parameter, a null pointer on error
+		*
+		*  @see
+		*    - GetParameter() taking a string
+		*/
+		PLRENDERER_API Parameter *GetParameter(const ParameterID &cID) const;
+
 		/**
 		*  @brief
 		*    Gets a texture buffer
@@ -172,6 +188,21 @@ class Material : public PLCore::Resource<Material> {
 		*/
 		PLRENDERER_API TextureBuffer *GetParameterTextureBuffer(const PLCore::String &sName) const;
 
+		/**
+		*  @brief
+		*    Gets a texture buffer by interned name
+		*
+		*  @param[in] cID
+		*    Interned parameter name
+		*
+		*  @return
+		*    The requested texture buffer, a null pointer on error
+		*
+		*  @see
+		*    - GetParameter()
+		*/
+		PLRENDERER_API TextureBuffer *GetParameterTextureBuffer(const ParameterID &cID) const;
+
 		/**
 		*  @brief
 		*    Returns the parameter manager of the material
@@ -190,6 +221,18 @@ class Material : public PLCore::Resource<Material> {
 		*/
 		PLRENDERER_API bool ReloadTextures();
 
+		/**
+		*  @brief
+		*    Reports the usage of all textures used direct or indirect by the material within the current frame
+		*
+		*  @param[in] fScreenSize
+		*    Approximated size in pixel the material covers on the screen
+		*
+		*  @see
+		*    - Texture::ReportUsage()
+		*/
+		PLRENDERER_API void ReportTextureUsage(float fScreenSize) const;
+
 		//[-------------------------------------------------------]
 		//[ Materials                                             ]
 		//[-------------------------------------------------------]
@@ -345,6 +388,13 @@ class Material : public PLCore::Resource<Material> {
 		EffectHandler				    *m_pFXHandler;			/**< Effect handler, can be a null pointer */
 
 
+	//[-------------------------------------------------------]
+	//[ Public virtual PLCore::Resource functions             ]
+	//[-------------------------------------------------------]
+	public:
+		PLRENDERER_API virtual PLCore::uint64 GetCPUMemoryUsage() const override;
+
+
 	//[-------------------------------------------------------]
 	//[ Public virtual PLCore::Loadable functions             ]
 	//[-------------------------------------------------------]
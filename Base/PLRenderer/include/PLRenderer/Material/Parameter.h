@@ -31,6 +31,7 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include "PLRenderer/Renderer/Parameters.h"
+#include "PLRenderer/Material/ParameterID.h"
 
 
 //[-------------------------------------------------------]
@@ -126,6 +127,15 @@ class Parameter {
 		*/
 		inline PLCore::String GetName() const;
 
+		/**
+		*  @brief
+		*    Get the interned parameter name
+		*
+		*  @return
+		*    Interned parameter name, use this for fast parameter lookups
+		*/
+		inline const ParameterID &GetID() const;
+
 		/**
 		*  @brief
 		*    Set the parameter name
@@ -290,10 +300,12 @@ class Parameter {
 	//[ Private data                                          ]
 	//[-------------------------------------------------------]
 	private:
-		ParameterManager	  *m_pManager;	/**< The parameter manager this parameter is in (NEVER a null pointer!) */
-		Parameters::EDataType  m_nType;		/**< Parameter type */
-		PLCore::String		   m_sName;		/**< Parameter name */
-		void				  *m_pValue;	/**< Parameter value, can be a null pointer */
+		ParameterManager	  *m_pManager;				/**< The parameter manager this parameter is in (NEVER a null pointer!) */
+		Parameters::EDataType  m_nType;					/**< Parameter type */
+		PLCore::String		   m_sName;					/**< Parameter name */
+		ParameterID			   m_cID;					/**< Interned parameter name */
+		void				  *m_pValue;				/**< Parameter value, can be a null pointer */
+		int					   m_nParameterBlockOffset;	/**< Offset of the value within the parameter block of the manager, <0 if the value is not within the block */
 
 
 };
@@ -58,6 +58,15 @@ inline PLCore::String Parameter::GetName() const
 	return m_sName;
 }
 
+/**
+*  @brief
+*    Get the interned parameter name
+*/
+inline const ParameterID &Parameter::GetID() const
+{
+	return m_cID;
+}
+
 
 //[-------------------------------------------------------]
 //[ Get/set value                                         ]
@@ -0,0 +1,233 @@
+/*********************************************************\
+ *  File: ParameterID.h                                  *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+
+
+#ifndef __PLRENDERER_MATERIAL_PARAMETERID_H__
+#define __PLRENDERER_MATERIAL_PARAMETERID_H__
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <PLCore/String/String.h>
+#include "PLRenderer/PLRenderer.h"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace PLRenderer {
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Interned parameter name
+*
+*  @remarks
+*    Every parameter name is registered once within a global name table and gets a unique
+*    integer ID. Comparing two IDs is just an integer compare, so looking up a parameter by
+*    ID doesn't require hashing and comparing strings. The ID of a name never changes during
+*    runtime, so an ID should be created once (e.g. as static variable) and then be reused.
+*
+*  @note
+*    - The global name table is thread safe
+*    - An empty name results in an invalid ID
+*/
+class ParameterID {
+
+
+	//[-------------------------------------------------------]
+	//[ Public definitions                                    ]
+	//[-------------------------------------------------------]
+	public:
+		static const PLCore::uint32 Invalid = 0;	/**< Invalid parameter ID */
+
+
+	//[-------------------------------------------------------]
+	//[ Public static functions                               ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Returns the ID of a parameter name, the name is registered if required
+		*
+		*  @param[in] sName
+		*    Parameter name
+		*
+		*  @return
+		*    The ID of the parameter name, "Invalid" if the given name is empty
+		*/
+		static PLRENDERER_API PLCore::uint32 Intern(const PLCore::String &sName);
+
+		/**
+		*  @brief
+		*    Returns the parameter name of an ID
+		*
+		*  @param[in] nID
+		*    Parameter ID
+		*
+		*  @return
+		*    The parameter name, empty string on error
+		*/
+		static PLRENDERER_API PLCore::String GetNameOfID(PLCore::uint32 nID);
+
+		/**
+		*  @brief
+		*    Returns the number of registered parameter names
+		*
+		*  @return
+		*    The number of registered parameter names
+		*/
+		static PLRENDERER_API PLCore::uint32 GetNumOfNames();
+
+
+	//[-------------------------------------------------------]
+	//[ Public functions                                      ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Default constructor, creates an invalid ID
+		*/
+		inline ParameterID();
+
+		/**
+		*  @brief
+		*    Constructor
+		*
+		*  @param[in] sName
+		*    Parameter name
+		*/
+		inline explicit ParameterID(const PLCore::String &sName);
+
+		/**
+		*  @brief
+		*    Copy constructor
+		*
+		*  @param[in] cSource
+		*    Source to copy from
+		*/
+		inline ParameterID(const ParameterID &cSource);
+
+		/**
+		*  @brief
+		*    Destructor
+		*/
+		inline ~ParameterID();
+
+		/**
+		*  @brief
+		*    Copy operator
+		*
+		*  @param[in] cSource
+		*    Source to copy from
+		*
+		*  @return
+		*    Reference to this instance
+		*/
+		inline ParameterID &operator =(const ParameterID &cSource);
+
+		/**
+		*  @brief
+		*    Compare operator
+		*
+		*  @param[in] cOther
+		*    ID to compare with
+		*
+		*  @return
+		*    'true' if both IDs are equal, else 'false'
+		*/
+		inline bool operator ==(const ParameterID &cOther) const;
+
+		/**
+		*  @brief
+		*    Compare operator
+		*
+		*  @param[in] cOther
+		*    ID to compare with
+		*
+		*  @return
+		*    'true' if both IDs are not equal, else 'false'
+		*/
+		inline bool operator !=(const ParameterID &cOther) const;
+
+		/**
+		*  @brief
+		*    Returns the integer ID
+		*
+		*  @return
+		*    The integer ID, "Invalid" if this ID is invalid
+		*/
+		inline PLCore::uint32 GetID() const;
+
+		/**
+		*  @brief
+		*    Returns whether or not this ID is valid
+		*
+		*  @return
+		*    'true' if this ID is valid, else 'false'
+		*/
+		inline bool IsValid() const;
+
+		/**
+		*  @brief
+		*    Returns the parameter name of this ID
+		*
+		*  @return
+		*    The parameter name, empty string if this ID is invalid
+		*
+		*  @note
+		*    - Requires a look into the global name table, don't use this function within performance critical code
+		*/
+		inline PLCore::String GetName() const;
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		PLCore::uint32 m_nID;	/**< Integer ID, "Invalid" if this ID is invalid */
+
+
+};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // PLRenderer
+
+
+//[-------------------------------------------------------]
+//[ Implementation                                        ]
+//[-------------------------------------------------------]
+#include "PLRenderer/Material/ParameterID.inl"
+
+
+#endif // __PLRENDERER_MATERIAL_PARAMETERID_H__
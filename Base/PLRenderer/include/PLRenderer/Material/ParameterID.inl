@@ -0,0 +1,130 @@
+/*********************************************************\
+ *  File: ParameterID.inl                                *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace PLRenderer {
+
+
+//[-------------------------------------------------------]
+//[ Public functions                                      ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Default constructor, creates an invalid ID
+*/
+inline ParameterID::ParameterID() :
+	m_nID(Invalid)
+{
+}
+
+/**
+*  @brief
+*    Constructor
+*/
+inline ParameterID::ParameterID(const PLCore::String &sName) :
+	m_nID(Intern(sName))
+{
+}
+
+/**
+*  @brief
+*    Copy constructor
+*/
+inline ParameterID::ParameterID(const ParameterID &cSource) :
+	m_nID(cSource.m_nID)
+{
+}
+
+/**
+*  @brief
+*    Destructor
+*/
+inline ParameterID::~ParameterID()
+{
+}
+
+/**
+*  @brief
+*    Copy operator
+*/
+inline ParameterID &ParameterID::operator =(const ParameterID &cSource)
+{
+	m_nID = cSource.m_nID;
+	return *this;
+}
+
+/**
+*  @brief
+*    Compare operator
+*/
+inline bool ParameterID::operator ==(const ParameterID &cOther) const
+{
+	return (m_nID == cOther.m_nID);
+}
+
+/**
+*  @brief
+*    Compare operator
+*/
+inline bool ParameterID::operator !=(const ParameterID &cOther) const
+{
+	return (m_nID != cOther.m_nID);
+}
+
+/**
+*  @brief
+*    Returns the integer ID
+*/
+inline PLCore::uint32 ParameterID::GetID() const
+{
+	return m_nID;
+}
+
+/**
+*  @brief
+*    Returns whether or not this ID is valid
+*/
+inline bool ParameterID::IsValid() const
+{
+	return (m_nID != Invalid);
+}
+
+/**
+*  @brief
+*    Returns the parameter name of this ID
+*/
+inline PLCore::String ParameterID::GetName() const
+{
+	return GetNameOfID(m_nID);
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // PLRenderer
@@ -32,6 +32,7 @@
 //[-------------------------------------------------------]
 #include <PLCore/Base/Event/Event.h>
 #include "PLRenderer/Renderer/Parameters.h"
+#include "PLRenderer/Material/ParameterID.h"
 
 
 //[-------------------------------------------------------]
@@ -62,6 +63,10 @@ namespace PLRenderer {
 *  @remarks
 *    The implementation of the 'SetParameter()' functions automatically create 'missing' parameters,
 *    if you don't want this, use for example 'IsParameter()' before calling 'SetParameter()'.
+*
+*    Within performance critical code, use the 'ParameterID' versions of the functions instead of
+*    the string versions. The numeric parameter values are additionally kept within a flat parameter
+*    block which can be e.g. uploaded into an uniform buffer as a whole.
 */
 class ParameterManager : public Parameters {
 
@@ -142,6 +147,74 @@ class ParameterManager : public Parameters {
 		*/
 		inline Parameter *GetParameter(const PLCore::String &sName) const;
 
+		/**
+		*  @brief
+		*    Gets a parameter by interned name
+		*
+		*  @param[in] cID
+		*    Interned parameter name
+		*
+		*  @return
+		*    The requested parameter, a null pointer on error
+		*
+		*  @note
+		*    - Faster than the string version because no string has to be hashed and compared
+		*/
+		inline Parameter *GetParameter(const ParameterID &cID) const;
+
+		/**
+		*  @brief
+		*    Returns whether or not there's a parameter with the given interned name
+		*
+		*  @param[in] cID
+		*    Interned parameter name
+		*
+		*  @return
+		*    'true' if there's such a parameter, else 'false'
+		*/
+		inline bool IsParameter(const ParameterID &cID) const;
+
+		/**
+		*  @brief
+		*    Returns the parameter block
+		*
+		*  @return
+		*    The parameter block, a null pointer if there are no numeric parameters
+		*
+		*  @remarks
+		*    The parameter block contains the values of all numeric parameters (no strings and texture buffers) in
+		*    one continuous memory block. Each value starts at a 16 byte boundary and is stored tightly packed, just
+		*    like within the parameter. The layout is only updated when parameters are added or removed, value changes
+		*    are written directly into the block.
+		*
+		*  @see
+		*    - GetParameterBlockSize()
+		*    - GetParameterBlockOffset()
+		*/
+		PLRENDERER_API const PLCore::uint8 *GetParameterBlock() const;
+
+		/**
+		*  @brief
+		*    Returns the size of the parameter block
+		*
+		*  @return
+		*    The size of the parameter block in bytes, multiple of 16
+		*/
+		PLRENDERER_API PLCore::uint32 GetParameterBlockSize() const;
+
+		/**
+		*  @brief
+		*    Returns the offset of a parameter value within the parameter block
+		*
+		*  @param[in] cID
+		*    Interned parameter name
+		*
+		*  @return
+		*    The offset of the parameter value within the parameter block in bytes, <0 on error
+		*    (unknown parameter or the parameter is no numeric parameter)
+		*/
+		PLRENDERER_API int GetParameterBlockOffset(const ParameterID &cID) const;
+
 		/**
 		*  @brief
 		*    Add all parameters to a given XML element
@@ -248,14 +321,25 @@ class ParameterManager : public Parameters {
 		*/
 		virtual ~ParameterManager();
 
+		/**
+		*  @brief
+		*    Updates the layout of the parameter block
+		*/
+		void UpdateParameterBlockLayout() const;
+
 
 	//[-------------------------------------------------------]
 	//[ Private data                                          ]
 	//[-------------------------------------------------------]
 	private:
-		RendererContext							    *m_pRendererContext;	/**< Renderer context to use, always valid! */
+		RendererContext							    *m_pRendererContext;			/**< Renderer context to use, always valid! */
 		PLCore::Array<Parameter*>				     m_lstParameters;
+		PLCore::Array<PLCore::uint32>				 m_lstParameterIDs;				/**< Interned parameter names, same order as "m_lstParameters" */
 		PLCore::HashMap<PLCore::String, Parameter*>  m_mapParameters;
+		mutable PLCore::uint8						*m_pParameterBlock;				/**< Parameter block, can be a null pointer */
+		mutable PLCore::uint32						 m_nParameterBlockSize;			/**< Used size of the parameter block in bytes */
+		mutable PLCore::uint32						 m_nParameterBlockCapacity;		/**< Allocated size of the parameter block in bytes */
+		mutable bool								 m_bParameterBlockLayoutDirty;	/**< Has the layout of the parameter block to be updated? */
 
 
 	//[-------------------------------------------------------]
@@ -67,6 +67,34 @@ inline Parameter *ParameterManager::GetParameter(const PLCore::String &sName) co
 	return m_mapParameters.Get(sName);
 }
 
+/**
+*  @brief
+*    Gets a parameter by interned name
+*/
+inline Parameter *ParameterManager::GetParameter(const ParameterID &cID) const
+{
+	// There are usually just a few parameters, a linear search through the flat ID list is faster than any hash map
+	const PLCore::uint32  nID              = cID.GetID();
+	const PLCore::uint32  nNumOfParameters = m_lstParameterIDs.GetNumOfElements();
+	const PLCore::uint32 *pnIDs            = m_lstParameterIDs.GetData();
+	for (PLCore::uint32 i=0; i<nNumOfParameters; i++) {
+		if (pnIDs[i] == nID)
+			return m_lstParameters[i];
+	}
+
+	// Error!
+	return nullptr;
+}
+
+/**
+*  @brief
+*    Returns whether or not there's a parameter with the given interned name
+*/
+inline bool ParameterManager::IsParameter(const ParameterID &cID) const
+{
+	return (GetParameter(cID) != nullptr);
+}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
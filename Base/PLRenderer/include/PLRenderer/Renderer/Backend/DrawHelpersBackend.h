@@ -30,6 +30,10 @@
 //[-------------------------------------------------------]
 //[ Includes                                              ]
 //[-------------------------------------------------------]
+#include <PLCore/Container/Array.h>
+#include <PLMath/Rectangle.h>
+#include "PLRenderer/Renderer/Types.h"
+#include "PLRenderer/Renderer/Font.h"
 #include "PLRenderer/Renderer/DrawHelpers.h"
 
 
@@ -44,6 +48,7 @@ namespace PLRenderer {
 //[-------------------------------------------------------]
 class Renderer;
 class VertexBuffer;
+class TextureBuffer;
 
 
 //[-------------------------------------------------------]
@@ -76,6 +81,10 @@ class DrawHelpersBackend : public DrawHelpers {
 		PLRENDERER_API virtual float Get2DZValue() const override;
 		PLRENDERER_API virtual void Set2DZValue(float fZValue = 0.0f) override;
 		PLRENDERER_API virtual const PLMath::Matrix4x4 &GetObjectSpaceToClipSpaceMatrix() const override;
+		PLRENDERER_API virtual void BeginBatch() override;
+		PLRENDERER_API virtual void EndBatch() override;
+		PLRENDERER_API virtual bool IsBatching() const override;
+		PLRENDERER_API virtual void Flush() override;
 		PLRENDERER_API virtual void DrawText(Font &cFont, const PLCore::String &sText, const PLGraphics::Color4 &cColor, const PLMath::Vector2 &vPosition, PLCore::uint32 nFlags = 0, const PLMath::Vector2 &vScale = PLMath::Vector2::One, const PLMath::Vector2 &vBias = PLMath::Vector2::Zero) override;
 		PLRENDERER_API virtual void DrawText(Font &cFont, const PLCore::String &sText, const PLGraphics::Color4 &cColor, const PLMath::Vector3 &vPosition, const PLMath::Matrix4x4 &mObjectSpaceToClipSpace, PLCore::uint32 nFlags = 0, const PLMath::Vector2 &vScale = PLMath::Vector2::One, const PLMath::Vector2 &vBias = PLMath::Vector2::Zero) override;
 		PLRENDERER_API virtual float GetTextWidth(Font &cFont, const PLCore::String &sText) const override;
@@ -84,6 +93,69 @@ class DrawHelpersBackend : public DrawHelpers {
 		PLRENDERER_API virtual void DrawPlane(const PLGraphics::Color4 &cColor, const PLMath::Vector3 &vN, float fD, const PLMath::Matrix4x4 &mObjectSpaceToClipSpace, float fSize = 10000.0f, float fLineWidth = 1.0f) override;
 
 
+	//[-------------------------------------------------------]
+	//[ Protected definitions                                 ]
+	//[-------------------------------------------------------]
+	protected:
+		/**
+		*  @brief
+		*    Batch vertex, the layout is identical to "Font::GlyphVertex" so that texts and primitives share the batches
+		*/
+		typedef Font::GlyphVertex BatchVertex;
+
+		/**
+		*  @brief
+		*    Everything which must be identical for primitives to end up in the same batch
+		*/
+		struct BatchKey {
+			Font			*pFont;								/**< Font of a text batch, a null pointer for a primitive batch */
+			Primitive::Enum  nPrimitive;						/**< Primitive type (point, line or triangle list) */
+			float			 fSize;								/**< Point size or line width, 0 for triangles */
+			TextureBuffer	*pTextureBuffer;					/**< Texture buffer, can be a null pointer */
+			PLCore::uint32	 nSamplerState[Sampler::Number];	/**< Sampler states, only used if there's a texture buffer */
+			float			 fAlphaReference;					/**< Alpha test reference value, only used if there's a texture buffer */
+			PLCore::uint32	 nStates;							/**< Index of the recorded renderer states the batch is drawn with */
+
+			bool operator ==(const BatchKey &sOther) const;
+		};
+
+		/**
+		*  @brief
+		*    Batch of primitives which is drawn by using a single draw call
+		*/
+		struct Batch {
+			BatchKey					sKey;			/**< Batch key */
+			float						fBounds[4];		/**< Normalized device coordinates bounds (min x, min y, max x, max y) */
+			PLCore::Array<BatchVertex>	lstVertices;	/**< Clip space vertices, primitive lists only */
+		};
+
+
+	//[-------------------------------------------------------]
+	//[ Protected virtual DrawHelpersBackend functions        ]
+	//[-------------------------------------------------------]
+	protected:
+		/**
+		*  @brief
+		*    Draws a primitive batch
+		*
+		*  @param[in] sBatch
+		*    Primitive batch to draw, the batch vertices are already in clip space
+		*  @param[in] cVertexBuffer
+		*    Vertex buffer holding the batch vertices, the layout is identical to "BatchVertex"
+		*  @param[in] nStartVertex
+		*    Index of the first batch vertex inside the vertex buffer
+		*
+		*  @return
+		*    'true' if all went fine, else 'false'
+		*
+		*  @note
+		*    - The renderer states the batch was recorded with are already set
+		*    - The default implementation does nothing and returns 'false', backends which add primitives
+		*      by using AddToBatch() must implement this method
+		*/
+		PLRENDERER_API virtual bool DrawPrimitiveBatch(const Batch &sBatch, VertexBuffer &cVertexBuffer, PLCore::uint32 nStartVertex);
+
+
 	//[-------------------------------------------------------]
 	//[ Protected functions                                   ]
 	//[-------------------------------------------------------]
@@ -106,6 +178,117 @@ class DrawHelpersBackend : public DrawHelpers {
 		*/
 		PLRENDERER_API bool CreateTempBuffes();
 
+		/**
+		*  @brief
+		*    Adds a primitive to the batches if primitives are currently batched
+		*
+		*  @param[in] nPrimitive
+		*    Primitive type, point list, line list, triangle list or triangle strip (converted into a triangle list)
+		*  @param[in] pvPositions
+		*    Object space vertex positions, must be valid and must have at least "nNumOfVertices" elements
+		*  @param[in] nNumOfVertices
+		*    Number of vertices
+		*  @param[in] mObjectSpaceToClipSpace
+		*    Object space to clip space matrix
+		*  @param[in] cColor
+		*    Color of all vertices, ignored if "pcVertexColors" is given
+		*  @param[in] pcVertexColors
+		*    Per vertex colors, if not a null pointer it must have at least "nNumOfVertices" elements
+		*  @param[in] fSize
+		*    Point size or line width
+		*  @param[in] pTextureBuffer
+		*    Texture buffer to use, can be a null pointer
+		*  @param[in] pSamplerStates
+		*    Sampler states, only used if there's a texture buffer, in this case it must be valid
+		*  @param[in] fAlphaReference
+		*    Alpha test reference value (0-1), if >= 1, no alpha test will be performed
+		*  @param[in] pvTexCoords
+		*    Final texture coordinates, only used if there's a texture buffer, in this case it must have at
+		*    least "nNumOfVertices" elements
+		*
+		*  @return
+		*    'true' if the primitive was batched, 'false' if it's not batched and must be drawn at once
+		*/
+		PLRENDERER_API bool AddToBatch(Primitive::Enum nPrimitive, const PLMath::Vector3 *pvPositions, PLCore::uint32 nNumOfVertices, const PLMath::Matrix4x4 &mObjectSpaceToClipSpace,
+									   const PLGraphics::Color4 &cColor, const PLGraphics::Color4 *pcVertexColors = nullptr, float fSize = 0.0f, TextureBuffer *pTextureBuffer = nullptr,
+									   const SamplerStates *pSamplerStates = nullptr, float fAlphaReference = 1.0f, const PLMath::Vector2 *pvTexCoords = nullptr);
+
+
+	//[-------------------------------------------------------]
+	//[ Private definitions                                   ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Renderer states recorded together with batched primitives
+		*/
+		struct BatchStates {
+			PLCore::uint32    nRenderState[RenderState::Number];	/**< Render states (see RenderState) */
+			PLMath::Rectangle cViewport;							/**< Viewport */
+			float			  fViewportMinZ;						/**< Viewport minimum z value */
+			float			  fViewportMaxZ;						/**< Viewport maximum z value */
+			PLMath::Rectangle cScissorRect;							/**< Scissor rectangle */
+
+			bool operator ==(const BatchStates &sOther) const;
+		};
+
+
+	//[-------------------------------------------------------]
+	//[ Private functions                                     ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Adds vertices to the batches
+		*
+		*  @param[in] sKey
+		*    Batch key, "nStates" is set by this method
+		*  @param[in] pVertices
+		*    Clip space vertices to add, must be valid and must have at least "nNumOfVertices" elements
+		*  @param[in] nNumOfVertices
+		*    Number of vertices to add
+		*/
+		void AddVerticesToBatch(BatchKey sKey, const BatchVertex *pVertices, PLCore::uint32 nNumOfVertices);
+
+		/**
+		*  @brief
+		*    Returns the index of the recorded renderer states matching the current ones
+		*
+		*  @return
+		*    Index of the recorded renderer states
+		*/
+		PLCore::uint32 GetBatchStates();
+
+		/**
+		*  @brief
+		*    Reads the current renderer states
+		*
+		*  @param[out] sStates
+		*    Receives the current renderer states
+		*/
+		void ReadBatchStates(BatchStates &sStates) const;
+
+		/**
+		*  @brief
+		*    Sets renderer states, only changed states are passed to the renderer
+		*
+		*  @param[in] sStates
+		*    Renderer states to set
+		*/
+		void WriteBatchStates(const BatchStates &sStates);
+
+		/**
+		*  @brief
+		*    Returns the next vertex buffer of the batch vertex buffer ring
+		*
+		*  @param[in] nNumOfVertices
+		*    Minimum number of vertices the vertex buffer must be able to hold
+		*
+		*  @return
+		*    The vertex buffer, a null pointer on error
+		*/
+		VertexBuffer *GetBatchVertexBuffer(PLCore::uint32 nNumOfVertices);
+
 
 	//[-------------------------------------------------------]
 	//[ Protected data                                        ]
@@ -118,6 +301,23 @@ class DrawHelpersBackend : public DrawHelpers {
 		float			  m_fVirtualScreen[4];			/**< The virtual screen size */
 		float			  m_fZValue2D;					/**< Z-value for 2D mode */
 		PLMath::Matrix4x4 m_mObjectSpaceToClipSpace;	/**< 2D mode object space to clip space matrix */
+		// Batch variables
+		PLCore::uint32 m_nBatchLevel;	/**< BeginBatch() nesting level */
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		static const PLCore::uint32 NumOfBatchVertexBuffers = 3;	/**< Number of vertex buffers inside the batch vertex buffer ring */
+		static const PLCore::uint32 MaxBatchSearchDepth     = 16;	/**< Maximum number of batches to look back at for a batch the primitive can be added to */
+
+		PLCore::Array<Batch*>		m_lstBatches;										/**< Pool of batches, the first "m_nNumOfBatches" are in use, the batches are destroyed by the destructor */
+		PLCore::uint32				m_nNumOfBatches;									/**< Number of batches in use */
+		PLCore::Array<BatchStates>	m_lstBatchStates;									/**< Recorded renderer states of the batches */
+		PLCore::Array<BatchVertex>	m_lstTempVertices;									/**< Temp batch vertices */
+		VertexBuffer			   *m_pBatchVertexBuffers[NumOfBatchVertexBuffers];	/**< Batch vertex buffer ring, elements can be null pointers */
+		PLCore::uint32				m_nBatchVertexBuffer;								/**< Index of the last used batch vertex buffer */
 
 
 };
@@ -102,6 +102,13 @@ class DrawHelpersBackendShaders : public DrawHelpersBackend {
 		PLRENDERER_API virtual void DrawGradientQuad(const PLGraphics::Color4 &cColor1, const PLGraphics::Color4 &cColor2, float fAngle, const PLMath::Vector3 &vV1, const PLMath::Vector3 &vV2, const PLMath::Vector3 &vV3, const PLMath::Vector3 &vV4, const PLMath::Matrix4x4 &mObjectSpaceToClipSpace) override;
 
 
+	//[-------------------------------------------------------]
+	//[ Protected virtual DrawHelpersBackend functions        ]
+	//[-------------------------------------------------------]
+	protected:
+		PLRENDERER_API virtual bool DrawPrimitiveBatch(const Batch &sBatch, VertexBuffer &cVertexBuffer, PLCore::uint32 nStartVertex) override;
+
+
 	//[-------------------------------------------------------]
 	//[ Private functions                                     ]
 	//[-------------------------------------------------------]
@@ -127,6 +134,85 @@ class DrawHelpersBackendShaders : public DrawHelpersBackend {
 		*/
 		ProgramGenerator::GeneratedProgram *GetAndSetGeneratedProgram();
 
+		/**
+		*  @brief
+		*    Returns the image size and the texture coordinate scale
+		*
+		*  @param[in]  cTextureBuffer
+		*    Texture buffer holding the image
+		*  @param[in]  vSize
+		*    Requested image size, if null, the texture buffer size is used
+		*  @param[out] vImageSize
+		*    Receives the image size
+		*  @param[out] vTextureCoordinateScale
+		*    Receives the texture coordinate scale, rectangle textures use non-normalized texture coordinates
+		*
+		*  @return
+		*    'true' if all went fine, else 'false' (texture buffer type not supported)
+		*/
+		bool GetImageSize(TextureBuffer &cTextureBuffer, const PLMath::Vector2 &vSize, PLMath::Vector2 &vImageSize, PLMath::Vector2 &vTextureCoordinateScale) const;
+
+		/**
+		*  @brief
+		*    Returns the vertex colors of a gradient quad
+		*
+		*  @param[in]  cColor1
+		*    First color
+		*  @param[in]  cColor2
+		*    Second color
+		*  @param[in]  fAngle
+		*    Gradient angle in radians
+		*  @param[out] cColors
+		*    Receives the colors of the four quad vertices
+		*/
+		void GetGradientColors(const PLGraphics::Color4 &cColor1, const PLGraphics::Color4 &cColor2, float fAngle, PLGraphics::Color4 cColors[4]) const;
+
+		/**
+		*  @brief
+		*    Draws or batches a textured quad
+		*
+		*  @param[in] cTextureBuffer
+		*    Texture buffer holding the image to draw
+		*  @param[in] cSamplerStates
+		*    Sampler states
+		*  @param[in] pvPositions
+		*    The four object space vertex positions of the triangle strip, must be valid
+		*  @param[in] pvTexCoords
+		*    The four texture coordinates, must be valid
+		*  @param[in] mObjectSpaceToClipSpace
+		*    Object space to clip space matrix
+		*  @param[in] cColor
+		*    Color to use
+		*  @param[in] fAlphaReference
+		*    Alpha test reference value (0-1), all texels below the value will be discarded, if >= 1, no alpha test will be performed
+		*  @param[in] mTexture
+		*    Texture matrix
+		*/
+		void DrawImageQuad(TextureBuffer &cTextureBuffer, SamplerStates &cSamplerStates, const PLMath::Vector3 *pvPositions, const PLMath::Vector2 *pvTexCoords, const PLMath::Matrix4x4 &mObjectSpaceToClipSpace,
+						   const PLGraphics::Color4 &cColor, float fAlphaReference, const PLMath::Matrix4x4 &mTexture);
+
+		/**
+		*  @brief
+		*    Draws or batches a primitive
+		*
+		*  @param[in] nPrimitive
+		*    Primitive type, point list, line list, triangle list or triangle strip
+		*  @param[in] pvPositions
+		*    Object space vertex positions, must be valid and must have at least "nNumOfVertices" elements
+		*  @param[in] nNumOfVertices
+		*    Number of vertices, triangle strips must not have more than four vertices
+		*  @param[in] mObjectSpaceToClipSpace
+		*    Object space to clip space matrix
+		*  @param[in] cColor
+		*    Color to use, ignored if "pcVertexColors" is given
+		*  @param[in] pcVertexColors
+		*    Per vertex colors, if not a null pointer it must have at least "nNumOfVertices" elements
+		*  @param[in] fSize
+		*    Point size or line width
+		*/
+		void DrawPrimitive(Primitive::Enum nPrimitive, const PLMath::Vector3 *pvPositions, PLCore::uint32 nNumOfVertices, const PLMath::Matrix4x4 &mObjectSpaceToClipSpace,
+						   const PLGraphics::Color4 &cColor, const PLGraphics::Color4 *pcVertexColors = nullptr, float fSize = 0.0f);
+
 		/**
 		*  @brief
 		*    Uses the image GPU program
@@ -244,6 +244,79 @@ class RendererBackend : public Renderer {
 		*/
 		PLRENDERER_API bool CheckTextureBufferCube(PLGraphics::Image &cImage, TextureBuffer::EPixelFormat nInternalFormat = TextureBuffer::Unknown) const;
 
+		/**
+		*  @brief
+		*    Sets the current viewport and updates the viewport shadow state
+		*
+		*  @param[in] pRectangle
+		*    Viewport rectangle, if a null pointer, the current render target is used as viewport
+		*  @param[in] fMinZ
+		*    Minimum z value
+		*  @param[in] fMaxZ
+		*    Maximum z value
+		*
+		*  @return
+		*    'true' if the viewport was changed and must be passed to the API, 'false' if the change is redundant
+		*
+		*  @remarks
+		*    API viewports are usually relative to the render target, so a change of the render target or
+		*    it's size since the last passed viewport is handled as change as well. The statistics are updated.
+		*/
+		PLRENDERER_API bool UpdateViewport(const PLMath::Rectangle *pRectangle, float fMinZ, float fMaxZ);
+
+		/**
+		*  @brief
+		*    Sets the current scissor rectangle and updates the scissor rectangle shadow state
+		*
+		*  @param[in] pRectangle
+		*    Scissor rectangle, if a null pointer, the current viewport is used as scissor rectangle
+		*
+		*  @return
+		*    'true' if the scissor rectangle was changed and must be passed to the API, 'false' if the change is redundant
+		*
+		*  @see
+		*    - UpdateViewport()
+		*/
+		PLRENDERER_API bool UpdateScissorRect(const PLMath::Rectangle *pRectangle);
+
+		/**
+		*  @brief
+		*    Sets the current color mask and updates the color mask shadow state
+		*
+		*  @param[in] bRed
+		*    Write red
+		*  @param[in] bGreen
+		*    Write green
+		*  @param[in] bBlue
+		*    Write blue
+		*  @param[in] bAlpha
+		*    Write alpha
+		*
+		*  @return
+		*    'true' if the color mask was changed and must be passed to the API, 'false' if the change is redundant
+		*/
+		PLRENDERER_API bool UpdateColorMask(bool bRed, bool bGreen, bool bBlue, bool bAlpha);
+
+		/**
+		*  @brief
+		*    Invalidates the viewport, scissor rectangle and color mask shadow states
+		*
+		*  @remarks
+		*    The next change of each of this states is passed to the API, call this function if the API
+		*    state was changed without using the renderer, for example after the API context was recreated.
+		*/
+		PLRENDERER_API void InvalidateShadowStates();
+
+		/**
+		*  @brief
+		*    Draws the primitives batched by the draw helpers
+		*
+		*  @note
+		*    - Call this function before the render target is changed, so the batched primitives
+		*      are drawn into the render target they were recorded for
+		*/
+		PLRENDERER_API void FlushDrawHelpers();
+
 
 	//[-------------------------------------------------------]
 	//[ Protected data                                        ]
@@ -285,6 +358,15 @@ class RendererBackend : public Renderer {
 		bool				m_bColorMask[4];	/**< Color mask (RGBA) */
 		PLCore::uint8	  **m_ppDataBackup;		/**< Data backup, used inside BackupDeviceObjects()/RestoreDeviceObjects() */
 
+		// Shadow states (see UpdateViewport(), UpdateScissorRect() and UpdateColorMask())
+		bool			m_bViewportShadowValid;		/**< Was the current viewport passed to the API? */
+		const Surface  *m_pViewportShadowSurface;	/**< Render target the viewport was passed to the API for, can be a null pointer */
+		int				m_nViewportShadowHeight;	/**< Height of the render target the viewport was passed to the API for */
+		bool			m_bScissorShadowValid;		/**< Was the current scissor rectangle passed to the API? */
+		const Surface  *m_pScissorShadowSurface;	/**< Render target the scissor rectangle was passed to the API for, can be a null pointer */
+		int				m_nScissorShadowHeight;		/**< Height of the render target the scissor rectangle was passed to the API for */
+		bool			m_bColorMaskShadowValid;	/**< Was the current color mask passed to the API? */
+
 		// States
 		PLCore::uint32   m_nRenderState[RenderState::Number];			/**< List of render states (see RenderState) */
 		PLCore::uint32 **m_ppnSamplerState;								/**< List of sampler states for each stage (see Sampler) */
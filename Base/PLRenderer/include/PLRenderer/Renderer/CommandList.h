@@ -0,0 +1,372 @@
+/*********************************************************\
+ *  File: CommandList.h                                  *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+
+
+#ifndef __PLRENDERER_COMMANDLIST_H__
+#define __PLRENDERER_COMMANDLIST_H__
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <PLGraphics/Color/Color4.h>
+#include "PLRenderer/Renderer/VertexBuffer.h"
+
+
+//[-------------------------------------------------------]
+//[ Forward declarations                                  ]
+//[-------------------------------------------------------]
+namespace PLMath {
+	class Vector2;
+	class Vector3;
+	class Vector4;
+	class Rectangle;
+	class Matrix3x3;
+	class Matrix4x4;
+}
+namespace PLRenderer {
+	class Surface;
+	class Program;
+	class Renderer;
+	class IndexBuffer;
+	class TextureBuffer;
+	class ProgramUniform;
+	class ProgramAttribute;
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace PLRenderer {
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Recorded sequence of renderer calls
+*
+*  @remarks
+*    The renderer interface is immediate-mode and can only be used by the thread owning the renderer. A command list
+*    records renderer calls into a compact linear buffer instead, without touching the renderer at all, so command lists
+*    can be filled by any thread. "Renderer::Execute()" replays a command list on the thread owning the renderer, the
+*    result is exactly the same as calling the recorded functions of the renderer directly in the recorded order.
+*
+*    Usage example:
+*    @code
+*    // Worker thread
+*    cCommandList.SetRenderState(RenderState::BlendEnable, false);
+*    cCommandList.SetProgram(pProgram);
+*    cCommandList.SetProgramUniform(*pProgram->GetUniform("ObjectSpaceToClipSpaceMatrix"), mWorldViewProjection);
+*    cCommandList.SetIndexBuffer(pIndexBuffer);
+*    cCommandList.DrawIndexedPrimitives(Primitive::TriangleList, 0, nMaxIndex, 0, nNumOfIndices);
+*
+*    // Thread owning the renderer
+*    cRenderer.Execute(cCommandList);
+*    @endcode
+*
+*  @note
+*    - A command list is not thread safe itself, each thread has to record into its own command list
+*    - Only pointers to the used resources are recorded, they must stay valid until the command list was executed
+*    - Values (states, uniform values, matrices...) are copied, so the given variables don't need to stay valid
+*    - "Reset()" keeps the allocated memory so a command list can be reused each frame without memory allocations
+*/
+class CommandList {
+
+
+	//[-------------------------------------------------------]
+	//[ Friends                                               ]
+	//[-------------------------------------------------------]
+	friend class Renderer;
+
+
+	//[-------------------------------------------------------]
+	//[ Public functions                                      ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Constructor
+		*/
+		PLRENDERER_API CommandList();
+
+		/**
+		*  @brief
+		*    Destructor
+		*/
+		PLRENDERER_API ~CommandList();
+
+		/**
+		*  @brief
+		*    Returns the number of recorded commands
+		*
+		*  @return
+		*    The number of recorded commands
+		*/
+		inline PLCore::uint32 GetNumOfCommands() const;
+
+		/**
+		*  @brief
+		*    Returns the size of the recorded commands
+		*
+		*  @return
+		*    The size of the recorded commands in bytes
+		*/
+		inline PLCore::uint32 GetSize() const;
+
+		/**
+		*  @brief
+		*    Removes all recorded commands
+		*
+		*  @note
+		*    - The allocated memory is kept, it's freed by the destructor
+		*/
+		inline void Reset();
+
+		//[-------------------------------------------------------]
+		//[ States                                                ]
+		//[-------------------------------------------------------]
+		/**
+		*  @brief
+		*    Records "Renderer::SetRenderState()"
+		*/
+		PLRENDERER_API void SetRenderState(RenderState::Enum nState, PLCore::uint32 nValue);
+
+		/**
+		*  @brief
+		*    Records "Renderer::SetSamplerState()"
+		*/
+		PLRENDERER_API void SetSamplerState(PLCore::uint32 nStage, Sampler::Enum nState, PLCore::uint32 nValue);
+
+		/**
+		*  @brief
+		*    Records "Renderer::SetViewport()"
+		*/
+		PLRENDERER_API void SetViewport(const PLMath::Rectangle *pRectangle = nullptr, float fMinZ = 0.0f, float fMaxZ = 1.0f);
+
+		/**
+		*  @brief
+		*    Records "Renderer::SetScissorRect()"
+		*/
+		PLRENDERER_API void SetScissorRect(const PLMath::Rectangle *pRectangle = nullptr);
+
+		/**
+		*  @brief
+		*    Records "Renderer::SetColorMask()"
+		*/
+		PLRENDERER_API void SetColorMask(bool bRed = true, bool bGreen = true, bool bBlue = true, bool bAlpha = true);
+
+		/**
+		*  @brief
+		*    Records "Renderer::Clear()"
+		*/
+		PLRENDERER_API void Clear(PLCore::uint32 nFlags, const PLGraphics::Color4 &cColor = PLGraphics::Color4::Black, float fZ = 1.0f, PLCore::uint32 nStencil = 0);
+
+		//[-------------------------------------------------------]
+		//[ Set current resources                                 ]
+		//[-------------------------------------------------------]
+		/**
+		*  @brief
+		*    Records "Renderer::SetRenderTarget()"
+		*/
+		PLRENDERER_API void SetRenderTarget(Surface *pSurface, PLCore::uint8 nFace = 0);
+
+		/**
+		*  @brief
+		*    Records "Renderer::SetTextureBuffer()"
+		*/
+		PLRENDERER_API void SetTextureBuffer(int nStage = -1, TextureBuffer *pTextureBuffer = nullptr);
+
+		/**
+		*  @brief
+		*    Records "Renderer::SetIndexBuffer()"
+		*/
+		PLRENDERER_API void SetIndexBuffer(IndexBuffer *pIndexBuffer = nullptr);
+
+		/**
+		*  @brief
+		*    Records "Renderer::SetProgram()"
+		*/
+		PLRENDERER_API void SetProgram(Program *pProgram = nullptr);
+
+		//[-------------------------------------------------------]
+		//[ Program attributes and uniforms                       ]
+		//[-------------------------------------------------------]
+		/**
+		*  @brief
+		*    Records "ProgramAttribute::Set()"
+		*/
+		PLRENDERER_API void SetProgramAttribute(ProgramAttribute &cAttribute, VertexBuffer *pVertexBuffer, VertexBuffer::ESemantic nSemantic, PLCore::uint32 nChannel = 0);
+
+		/**
+		*  @brief
+		*    Records "ProgramUniform::Set()"
+		*/
+		PLRENDERER_API void SetProgramUniform(ProgramUniform &cUniform, int nX);
+		PLRENDERER_API void SetProgramUniform(ProgramUniform &cUniform, float fX);
+		PLRENDERER_API void SetProgramUniform(ProgramUniform &cUniform, const PLMath::Vector2 &vVector);
+		PLRENDERER_API void SetProgramUniform(ProgramUniform &cUniform, const PLMath::Vector3 &vVector);
+		PLRENDERER_API void SetProgramUniform(ProgramUniform &cUniform, const PLMath::Vector4 &vVector);
+		PLRENDERER_API void SetProgramUniform(ProgramUniform &cUniform, const PLGraphics::Color4 &cColor);
+		PLRENDERER_API void SetProgramUniform(ProgramUniform &cUniform, const PLMath::Matrix3x3 &mMatrix, bool bTranspose = false);
+		PLRENDERER_API void SetProgramUniform(ProgramUniform &cUniform, const PLMath::Matrix4x4 &mMatrix, bool bTranspose = false);
+		PLRENDERER_API void SetProgramUniform(ProgramUniform &cUniform, TextureBuffer *pTextureBuffer);
+
+		//[-------------------------------------------------------]
+		//[ Draw call                                             ]
+		//[-------------------------------------------------------]
+		/**
+		*  @brief
+		*    Records "Renderer::DrawPrimitives()"
+		*/
+		PLRENDERER_API void DrawPrimitives(Primitive::Enum nType, PLCore::uint32 nStartIndex, PLCore::uint32 nNumVertices);
+
+		/**
+		*  @brief
+		*    Records "Renderer::DrawIndexedPrimitives()"
+		*/
+		PLRENDERER_API void DrawIndexedPrimitives(Primitive::Enum nType, PLCore::uint32 nMinIndex, PLCore::uint32 nMaxIndex, PLCore::uint32 nStartIndex, PLCore::uint32 nNumVertices);
+
+		/**
+		*  @brief
+		*    Records "Renderer::DrawPatches()"
+		*/
+		PLRENDERER_API void DrawPatches(PLCore::uint32 nVerticesPerPatch, PLCore::uint32 nStartIndex, PLCore::uint32 nNumVertices);
+
+		/**
+		*  @brief
+		*    Records "Renderer::DrawIndexedPatches()"
+		*/
+		PLRENDERER_API void DrawIndexedPatches(PLCore::uint32 nVerticesPerPatch, PLCore::uint32 nMinIndex, PLCore::uint32 nMaxIndex, PLCore::uint32 nStartIndex, PLCore::uint32 nNumVertices);
+
+		/**
+		*  @brief
+		*    Records "Renderer::DrawPrimitivesInstanced()"
+		*/
+		PLRENDERER_API void DrawPrimitivesInstanced(Primitive::Enum nType, PLCore::uint32 nStartIndex, PLCore::uint32 nNumVertices, PLCore::uint32 nNumOfInstances);
+
+		/**
+		*  @brief
+		*    Records "Renderer::DrawIndexedPrimitivesInstanced()"
+		*/
+		PLRENDERER_API void DrawIndexedPrimitivesInstanced(Primitive::Enum nType, PLCore::uint32 nMinIndex, PLCore::uint32 nMaxIndex, PLCore::uint32 nStartIndex, PLCore::uint32 nNumVertices, PLCore::uint32 nNumOfInstances);
+
+		/**
+		*  @brief
+		*    Records "Renderer::DrawPatchesInstanced()"
+		*/
+		PLRENDERER_API void DrawPatchesInstanced(PLCore::uint32 nVerticesPerPatch, PLCore::uint32 nStartIndex, PLCore::uint32 nNumVertices, PLCore::uint32 nNumOfInstances);
+
+		/**
+		*  @brief
+		*    Records "Renderer::DrawIndexedPatchesInstanced()"
+		*/
+		PLRENDERER_API void DrawIndexedPatchesInstanced(PLCore::uint32 nVerticesPerPatch, PLCore::uint32 nMinIndex, PLCore::uint32 nMaxIndex, PLCore::uint32 nStartIndex, PLCore::uint32 nNumVertices, PLCore::uint32 nNumOfInstances);
+
+
+	//[-------------------------------------------------------]
+	//[ Private functions                                     ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Copy constructor
+		*
+		*  @param[in] cSource
+		*    Source to copy from
+		*/
+		CommandList(const CommandList &cSource);
+
+		/**
+		*  @brief
+		*    Copy operator
+		*
+		*  @param[in] cSource
+		*    Source to copy from
+		*
+		*  @return
+		*    Reference to this instance
+		*/
+		CommandList &operator =(const CommandList &cSource);
+
+		/**
+		*  @brief
+		*    Adds a command
+		*
+		*  @param[in] nType
+		*    Command type
+		*  @param[in] nSize
+		*    Size of the command data in bytes
+		*
+		*  @return
+		*    The command data the caller has to fill, always valid
+		*/
+		void *AddCommand(PLCore::uint32 nType, PLCore::uint32 nSize);
+
+		/**
+		*  @brief
+		*    Replays the recorded commands
+		*
+		*  @param[in] cRenderer
+		*    Renderer to use
+		*
+		*  @return
+		*    'true' if all went fine, else 'false' (at least one renderer call failed)
+		*
+		*  @see
+		*    - Renderer::Execute()
+		*/
+		bool Replay(Renderer &cRenderer) const;
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		PLCore::uint8  *m_pnBuffer;			/**< Recorded commands, can be a null pointer */
+		PLCore::uint32  m_nBufferSize;		/**< Size of the recorded commands in bytes */
+		PLCore::uint32  m_nMaxBufferSize;	/**< Size of the allocated buffer in bytes */
+		PLCore::uint32  m_nNumOfCommands;	/**< Number of recorded commands */
+
+
+};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // PLRenderer
+
+
+//[-------------------------------------------------------]
+//[ Implementation                                        ]
+//[-------------------------------------------------------]
+#include "PLRenderer/Renderer/CommandList.inl"
+
+
+#endif // __PLRENDERER_COMMANDLIST_H__
@@ -173,6 +173,63 @@ class DrawHelpers {
 		*/
 		virtual const PLMath::Matrix4x4 &GetObjectSpaceToClipSpaceMatrix() const = 0;
 
+		//[-------------------------------------------------------]
+		//[ Batching                                              ]
+		//[-------------------------------------------------------]
+		/**
+		*  @brief
+		*    Begins a batch
+		*
+		*  @remarks
+		*    Within the 2D mode or between BeginBatch() and EndBatch(), texts, images, points, lines, triangles
+		*    and quads are not drawn at once. They are transformed into clip space and collected into batches
+		*    which are drawn by using as few draw calls as possible when the outermost batch or the 2D mode is
+		*    left, or when Flush() is called. Primitives using the same font, texture, sampler states, size and
+		*    renderer states end up in the same batch. A primitive is only moved in front of primitives drawn
+		*    before it if it doesn't overlap them on screen, so the visible draw order is kept.
+		*
+		*  @note
+		*    - Batches can be nested, only the outermost EndBatch() draws the batched primitives
+		*    - The renderer states, the viewport and the scissor rectangle are recorded together with each
+		*      primitive and are set while drawing the batches, afterwards the current ones are restored
+		*    - A change of the render target draws the batched primitives automatically
+		*    - Fonts and texture buffers used by batched primitives must stay alive until the batches are drawn
+		*/
+		virtual void BeginBatch() = 0;
+
+		/**
+		*  @brief
+		*    Ends a batch
+		*
+		*  @see
+		*    - BeginBatch()
+		*/
+		virtual void EndBatch() = 0;
+
+		/**
+		*  @brief
+		*    Returns whether or not primitives are currently batched
+		*
+		*  @return
+		*    'true' if primitives are currently batched (2D mode or BeginBatch()), else 'false'
+		*/
+		virtual bool IsBatching() const = 0;
+
+		/**
+		*  @brief
+		*    Draws everything which was batched and not drawn yet
+		*
+		*  @remarks
+		*    Batched primitives are drawn automatically as soon as the outermost batch or the 2D mode is left,
+		*    when a primitive the backend can't batch is drawn or when the render target changes. Call this
+		*    method before destroying a font or texture buffer used by batched primitives, or when something
+		*    else than renderer states (for instance the color mask) must affect the batched primitives.
+		*
+		*  @see
+		*    - BeginBatch()
+		*/
+		virtual void Flush() = 0;
+
 		//[-------------------------------------------------------]
 		//[ Text                                                  ]
 		//[-------------------------------------------------------]
@@ -102,6 +102,26 @@ class Font : public Resource {
 			Mipmapping    = 1<<3	/**< Use mipmapping (may blur the font in an ugly way) */
 		};
 
+		/**
+		*  @brief
+		*    Glyph vertex used for batched text rendering, six vertices (two triangles) per glyph quad
+		*
+		*  @see
+		*    - AddGlyphVertices()
+		*/
+		struct GlyphVertex {
+			float fPosition[4];	/**< Clip space vertex position (x, y, z, w) */
+			float fTexCoord[2];	/**< Normalized texture coordinate inside the glyph texture atlas */
+			float fColor[4];	/**< Vertex color (r, g, b, a) */
+
+			bool operator ==(const GlyphVertex &sOther) const
+			{
+				return (fPosition[0] == sOther.fPosition[0] && fPosition[1] == sOther.fPosition[1] && fPosition[2] == sOther.fPosition[2] && fPosition[3] == sOther.fPosition[3] &&
+						fTexCoord[0] == sOther.fTexCoord[0] && fTexCoord[1] == sOther.fTexCoord[1] &&
+						fColor[0] == sOther.fColor[0] && fColor[1] == sOther.fColor[1] && fColor[2] == sOther.fColor[2] && fColor[3] == sOther.fColor[3]);
+			}
+		};
+
 
 	//[-------------------------------------------------------]
 	//[ Public functions                                      ]
@@ -269,6 +289,54 @@ class Font : public Resource {
 		*/
 		virtual void Draw(const PLCore::String &sText, const PLGraphics::Color4 &cColor, const PLMath::Matrix4x4 &mObjectSpaceToClipSpace, const PLMath::Vector2 &vScale = PLMath::Vector2::One, const PLMath::Vector2 &vBias = PLMath::Vector2::Zero, PLCore::uint32 nFlags = 0) = 0;
 
+		/**
+		*  @brief
+		*    Appends the glyph quads of a text to a list of glyph vertices
+		*
+		*  @param[out] lstVertices
+		*    List the glyph vertices are appended to (six vertices per glyph, triangle list)
+		*  @param[in]  sText
+		*    Text to append
+		*  @param[in]  cColor
+		*    Text color
+		*  @param[in]  mObjectSpaceToClipSpace
+		*    Object space to clip space matrix, the vertex positions are transformed into clip space by using this matrix
+		*  @param[in]  vScale
+		*    Font scale, see Draw()
+		*  @param[in]  vBias
+		*    Font bias (position offset), see Draw()
+		*  @param[in]  nFlags
+		*    Draw flags, see EDrawFlags (only "CenterText" is taken into account)
+		*
+		*  @return
+		*    'true' if all went fine, 'false' if this font doesn't support batched text rendering (use Draw() instead)
+		*
+		*  @remarks
+		*    All glyph vertices appended to one list can be drawn at once by using DrawGlyphVertices(), no matter
+		*    with which colors and transforms they were created. This way, many texts drawn with the same font
+		*    only cost a single draw call.
+		*
+		*  @note
+		*    - The default implementation returns 'false'
+		*/
+		PLRENDERER_API virtual bool AddGlyphVertices(PLCore::Array<GlyphVertex> &lstVertices, const PLCore::String &sText, const PLGraphics::Color4 &cColor, const PLMath::Matrix4x4 &mObjectSpaceToClipSpace, const PLMath::Vector2 &vScale = PLMath::Vector2::One, const PLMath::Vector2 &vBias = PLMath::Vector2::Zero, PLCore::uint32 nFlags = 0);
+
+		/**
+		*  @brief
+		*    Draws glyph vertices created by using AddGlyphVertices()
+		*
+		*  @param[in] lstVertices
+		*    Glyph vertices to draw, must have been created by this font
+		*  @param[in] nFlags
+		*    Draw flags, see EDrawFlags (only "Mipmapping" is taken into account)
+		*
+		*  @note
+		*    - The default implementation does nothing
+		*    - Texture fonts ignore "Mipmapping" because the glyph atlas pages have no mipmaps
+		*    - Unlike Draw(), this method doesn't change any render state, the caller has to enable blending
+		*/
+		PLRENDERER_API virtual void DrawGlyphVertices(const PLCore::Array<GlyphVertex> &lstVertices, PLCore::uint32 nFlags = 0);
+
 
 	//[-------------------------------------------------------]
 	//[ Protected functions                                   ]
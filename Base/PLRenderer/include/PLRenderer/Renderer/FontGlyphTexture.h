@@ -59,6 +59,24 @@ class FontGlyphTexture : public FontGlyph {
 		*/
 		PLRENDERER_API virtual ~FontGlyphTexture();
 
+		/**
+		*  @brief
+		*    Returns the normalized minimum glyph texture coordinate inside the glyph texture atlas
+		*
+		*  @return
+		*    The normalized minimum glyph texture coordinate inside the glyph texture atlas
+		*/
+		inline const PLMath::Vector2 &GetTexCoordMin() const;
+
+		/**
+		*  @brief
+		*    Returns the normalized maximum glyph texture coordinate inside the glyph texture atlas
+		*
+		*  @return
+		*    The normalized maximum glyph texture coordinate inside the glyph texture atlas
+		*/
+		inline const PLMath::Vector2 &GetTexCoordMax() const;
+
 
 	//[-------------------------------------------------------]
 	//[ Protected functions                                   ]
@@ -71,6 +89,14 @@ class FontGlyphTexture : public FontGlyph {
 		PLRENDERER_API FontGlyphTexture();
 
 
+	//[-------------------------------------------------------]
+	//[ Protected data                                        ]
+	//[-------------------------------------------------------]
+	protected:
+		PLMath::Vector2 m_vTexCoordMin;	/**< Normalized minimum glyph texture coordinate inside the glyph texture atlas */
+		PLMath::Vector2 m_vTexCoordMax;	/**< Normalized maximum glyph texture coordinate inside the glyph texture atlas */
+
+
 	//[-------------------------------------------------------]
 	//[ Private functions                                     ]
 	//[-------------------------------------------------------]
@@ -106,4 +132,10 @@ class FontGlyphTexture : public FontGlyph {
 } // PLRenderer
 
 
+//[-------------------------------------------------------]
+//[ Implementation                                        ]
+//[-------------------------------------------------------]
+#include "PLRenderer/Renderer/FontGlyphTexture.inl"
+
+
 #endif // __PLRENDERER_FONTGLYPHTEXTURE_H__
@@ -44,6 +44,7 @@ namespace PLCore {
 namespace PLRenderer {
 	class Font;
 	class Renderer;
+	class GlyphAtlas;
 	class FontTexture;
 	class ResourceHandler;
 }
@@ -84,6 +85,15 @@ class FontManager {
 		*/
 		inline Renderer &GetRenderer() const;
 
+		/**
+		*  @brief
+		*    Returns the glyph atlas shared by all texture fonts of this manager
+		*
+		*  @return
+		*    The glyph atlas
+		*/
+		inline GlyphAtlas &GetGlyphAtlas() const;
+
 		//[-------------------------------------------------------]
 		//[ Texture font                                          ]
 		//[-------------------------------------------------------]
@@ -211,6 +221,7 @@ class FontManager {
 		ResourceHandler				*m_pDefaultFontTextureHandler;	/**< Default texture font, always valid! */
 		bool						 m_bDefaultFontTextureSet;		/**< Default font texture already set? */
 		PLCore::Array<FontTexture*>  m_lstFontTexture;				/**< Texture fonts */
+		GlyphAtlas					*m_pGlyphAtlas;					/**< Glyph atlas shared by all texture fonts, always valid! */
 
 
 	//[-------------------------------------------------------]
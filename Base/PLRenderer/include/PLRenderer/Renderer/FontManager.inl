@@ -40,6 +40,15 @@ inline Renderer &FontManager::GetRenderer() const
 	return *m_pRenderer;
 }
 
+/**
+*  @brief
+*    Returns the glyph atlas shared by all texture fonts of this manager
+*/
+inline GlyphAtlas &FontManager::GetGlyphAtlas() const
+{
+	return *m_pGlyphAtlas;
+}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
@@ -30,7 +30,9 @@
 //[-------------------------------------------------------]
 //[ Includes                                              ]
 //[-------------------------------------------------------]
+#include <PLCore/Container/HashMap.h>
 #include "PLRenderer/Renderer/Font.h"
+#include "PLRenderer/Renderer/GlyphAtlas.h"
 
 
 //[-------------------------------------------------------]
@@ -45,10 +47,20 @@ namespace PLRenderer {
 /**
 *  @brief
 *    Abstract renderer font texture
+*
+*  @remarks
+*    The glyphs are rasterized on first use into the glyph atlas shared by all texture fonts of the font manager,
+*    see "GlyphAtlas". Text is therefore not restricted to a fixed character range, Unicode strings are supported.
 */
 class FontTexture : public Font {
 
 
+	//[-------------------------------------------------------]
+	//[ Friends                                               ]
+	//[-------------------------------------------------------]
+	friend class GlyphAtlas;
+
+
 	//[-------------------------------------------------------]
 	//[ Public functions                                      ]
 	//[-------------------------------------------------------]
@@ -59,6 +71,23 @@ class FontTexture : public Font {
 		*/
 		PLRENDERER_API virtual ~FontTexture();
 
+		/**
+		*  @brief
+		*    Returns the number of currently cached shaped texts
+		*
+		*  @return
+		*    The number of currently cached shaped texts
+		*/
+		inline PLCore::uint32 GetNumOfShapedTexts() const;
+
+
+	//[-------------------------------------------------------]
+	//[ Public virtual Font functions                         ]
+	//[-------------------------------------------------------]
+	public:
+		PLRENDERER_API virtual float GetTextWidth(const PLCore::String &sText) override;
+		PLRENDERER_API virtual bool AddGlyphVertices(PLCore::Array<GlyphVertex> &lstVertices, const PLCore::String &sText, const PLGraphics::Color4 &cColor, const PLMath::Matrix4x4 &mObjectSpaceToClipSpace, const PLMath::Vector2 &vScale = PLMath::Vector2::One, const PLMath::Vector2 &vBias = PLMath::Vector2::Zero, PLCore::uint32 nFlags = 0) override;
+
 
 	//[-------------------------------------------------------]
 	//[ Protected functions                                   ]
@@ -75,6 +104,105 @@ class FontTexture : public Font {
 		*/
 		PLRENDERER_API FontTexture(FontManager &cFontManager, const PLCore::String &sFilename);
 
+		/**
+		*  @brief
+		*    Destroys all cached shaped texts
+		*
+		*  @note
+		*    - Shaped texts are automatically destroyed when the font size or resolution changes, call this
+		*      method when the glyphs were recreated in another way
+		*/
+		PLRENDERER_API void ClearShapedTexts();
+
+		/**
+		*  @brief
+		*    Removes the glyphs of this font from the glyph atlas
+		*
+		*  @note
+		*    - Waits until the background rasterization no longer uses this font, derived classes must call this
+		*      method within their destructor before destroying anything "RasterizeGlyph()" depends on
+		*/
+		PLRENDERER_API void RemoveGlyphsFromAtlas();
+
+		/**
+		*  @brief
+		*    Returns the number of glyph vertices at the given position which use the same glyph atlas page
+		*
+		*  @param[in]  lstVertices
+		*    Glyph vertices created by using AddGlyphVertices()
+		*  @param[in]  nFirstVertex
+		*    Index of the first vertex, must be the first vertex of a glyph quad
+		*  @param[out] nPage
+		*    Receives the glyph atlas page index
+		*
+		*  @return
+		*    The number of glyph vertices (multiple of six), 0 if there are no vertices at the given position
+		*
+		*  @remarks
+		*    The integer part of the x texture coordinate is the page index, see "GlyphAtlas". Draw each run by using
+		*    the texture buffer of its page, sampled with repeat wrap mode so that the page index is ignored.
+		*/
+		static PLRENDERER_API PLCore::uint32 GetGlyphPageRun(const PLCore::Array<GlyphVertex> &lstVertices, PLCore::uint32 nFirstVertex, PLCore::uint32 &nPage);
+
+
+	//[-------------------------------------------------------]
+	//[ Protected virtual FontTexture functions               ]
+	//[-------------------------------------------------------]
+	protected:
+		/**
+		*  @brief
+		*    Rasterizes a glyph for the glyph atlas
+		*
+		*  @param[in]  nSize
+		*    Nominal font size in points
+		*  @param[in]  nResolution
+		*    The horizontal and vertical resolution in DPI
+		*  @param[in]  nCharacterCode
+		*    Unicode character code
+		*  @param[out] sBitmap
+		*    Receives the glyph bitmap and metrics, the bitmap data must be created with "new []"
+		*
+		*  @return
+		*    'true' if all went fine, else 'false' (e.g. the font has no glyph for the character)
+		*
+		*  @note
+		*    - Usually called by the background thread of the glyph atlas, so the implementation must not use anything
+		*      the main thread uses as well (e.g. the FreeType face used for the font metrics), calls are never concurrent
+		*    - The default implementation returns 'false'
+		*/
+		PLRENDERER_API virtual bool RasterizeGlyph(PLCore::uint32 nSize, PLCore::uint32 nResolution, PLCore::uint32 nCharacterCode, GlyphAtlas::Bitmap &sBitmap);
+
+
+	//[-------------------------------------------------------]
+	//[ Private definitions                                   ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Shaped glyph quad
+		*/
+		struct ShapedGlyph {
+			const GlyphAtlas::Glyph *pGlyph;	/**< Glyph inside the glyph atlas, always valid! */
+			PLMath::Vector2 vMin;			/**< Minimum (lower/left) position in pixel, relative to the pen start position */
+			PLMath::Vector2 vMax;			/**< Maximum (upper/right) position in pixel, relative to the pen start position */
+			PLMath::Vector2 vTexCoordMin;	/**< Normalized minimum glyph texture coordinate inside the glyph atlas, the page index is added to x */
+			PLMath::Vector2 vTexCoordMax;	/**< Normalized maximum glyph texture coordinate inside the glyph atlas, the page index is added to x */
+
+			bool operator ==(const ShapedGlyph &sOther) const
+			{
+				return (pGlyph == sOther.pGlyph && vMin == sOther.vMin && vMax == sOther.vMax && vTexCoordMin == sOther.vTexCoordMin && vTexCoordMax == sOther.vTexCoordMax);
+			}
+		};
+
+		/**
+		*  @brief
+		*    Shaped text
+		*/
+		struct ShapedText {
+			PLCore::Array<ShapedGlyph> lstGlyphs;	/**< Glyph quads of the text, glyphs without size are not included */
+			float					   fWidth;		/**< Width of the text in pixel */
+		};
+
 
 	//[-------------------------------------------------------]
 	//[ Private functions                                     ]
@@ -101,6 +229,50 @@ class FontTexture : public Font {
 		*/
 		FontTexture &operator =(const FontTexture &cSource);
 
+		/**
+		*  @brief
+		*    Returns the shaped version of a text
+		*
+		*  @param[in] sText
+		*    Text to shape
+		*
+		*  @return
+		*    The shaped text, a null pointer if there are no glyphs, do not destroy the returned instance
+		*
+		*  @remarks
+		*    Shaping means looking up the glyph of each character and letting the pen advance, the result only depends on
+		*    the text, on the font size and resolution and on the glyph atlas generation. Shaped texts are therefore cached so
+		*    that texts which are drawn frame after frame without any change (HUD, debug output) don't have to be shaped again
+		*    and again. Glyphs which are still rasterized in the background are placeholders without glyph quad.
+		*/
+		const ShapedText *ShapeText(const PLCore::String &sText);
+
+		/**
+		*  @brief
+		*    Adds a character to a shaped text
+		*
+		*  @param[in] cShapedText
+		*    Shaped text to add the character to
+		*  @param[in] cGlyphAtlas
+		*    Glyph atlas to get the glyph from
+		*  @param[in] nCharacterCode
+		*    Unicode character code
+		*  @param[in] fPlaceholderAdvance
+		*    Pen advance of a placeholder for a glyph which is not ready yet
+		*/
+		void ShapeCharacter(ShapedText &cShapedText, GlyphAtlas &cGlyphAtlas, PLCore::uint32 nCharacterCode, float fPlaceholderAdvance);
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		PLCore::HashMap<PLCore::String, ShapedText*> m_mapShapedTexts;			/**< Cached shaped texts ("text -> shaped text"), the shaped texts are owned by this map */
+		PLCore::uint32								 m_nShapedTextsSize;		/**< Font size the cached shaped texts were created with */
+		PLCore::uint32								 m_nShapedTextsResolution;	/**< Font resolution the cached shaped texts were created with */
+		PLCore::uint32								 m_nShapedTextsGeneration;	/**< Glyph atlas generation the cached shaped texts were created with */
+		PLCore::uint32								 m_nGlyphAtlasFontID;		/**< ID of this font within the glyph atlas, 0 if there's none yet, managed by the glyph atlas */
+
 
 };
 
@@ -111,4 +283,10 @@ class FontTexture : public Font {
 } // PLRenderer
 
 
+//[-------------------------------------------------------]
+//[ Implementation                                        ]
+//[-------------------------------------------------------]
+#include "PLRenderer/Renderer/FontTexture.inl"
+
+
 #endif // __PLRENDERER_FONTTEXTURE_H__
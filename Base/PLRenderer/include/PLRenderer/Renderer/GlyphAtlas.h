@@ -0,0 +1,662 @@
+/*********************************************************\
+ *  File: GlyphAtlas.h                                   *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+
+
+#ifndef __PLRENDERER_GLYPHATLAS_H__
+#define __PLRENDERER_GLYPHATLAS_H__
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <PLCore/Container/Array.h>
+#include <PLCore/Container/HashMap.h>
+#include <PLMath/Vector2.h>
+#include <PLMath/Vector2i.h>
+#include "PLRenderer/PLRenderer.h"
+
+
+//[-------------------------------------------------------]
+//[ Forward declarations                                  ]
+//[-------------------------------------------------------]
+namespace PLCore {
+	class Mutex;
+	class Thread;
+	class Semaphore;
+}
+namespace PLRenderer {
+	class Renderer;
+	class FontTexture;
+	class TextureBuffer2D;
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace PLRenderer {
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Dynamic glyph texture atlas shared by all texture fonts of a font manager
+*
+*  @remarks
+*    Glyphs are rasterized on first use and packed into fixed size alpha texture pages by using a skyline packer,
+*    glyphs of all fonts and font sizes share the same pages. When all pages are full, the least recently used
+*    glyphs which were not used within the current frame are evicted and their space is reused.
+*
+*    By default, glyphs are rasterized by a background thread. Until a glyph is ready, it's a placeholder
+*    without bitmap. Whenever glyphs become ready or are evicted, the generation of the atlas changes so that
+*    fonts know that their cached texts must be shaped again.
+*
+*    The texture coordinates of a glyph are normalized inside its page, the page index is added to the
+*    x component. So, the integer part of the x texture coordinate is the page index.
+*
+*  @note
+*    - Must only be used by the thread owning the renderer, the background thread only calls "FontTexture::RasterizeGlyph()"
+*    - "Update()" must be called once per frame, this is done by "RendererContext::Update()"
+*/
+class GlyphAtlas {
+
+
+	//[-------------------------------------------------------]
+	//[ Friends                                               ]
+	//[-------------------------------------------------------]
+	friend class FontManager;
+
+
+	//[-------------------------------------------------------]
+	//[ Public definitions                                    ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Glyph state
+		*/
+		enum EGlyphState {
+			Pending = 0,	/**< The glyph is rasterized right now, it's a placeholder without bitmap */
+			Ready   = 1,	/**< The glyph is ready to be used */
+			Missing = 2		/**< The glyph can't be rasterized or doesn't fit into the atlas */
+		};
+
+		/**
+		*  @brief
+		*    Rasterized glyph bitmap
+		*/
+		struct Bitmap {
+			PLMath::Vector2i  vSize;		/**< Size of the glyph bitmap in pixel, zero for glyphs without bitmap (e.g. space) */
+			PLMath::Vector2   vCorner;		/**< Distance (in pixel) from the current pen position to the glyph bitmap */
+			PLMath::Vector2   vPenAdvance;	/**< Object space distance (in pixel) to the next glyph */
+			PLCore::uint8    *pnData;		/**< Alpha values of the glyph bitmap, row by row beginning with the top row, created with "new []", can be a null pointer */
+		};
+
+		/**
+		*  @brief
+		*    Glyph inside the atlas
+		*/
+		struct Glyph {
+			// Public data
+			EGlyphState		  nState;			/**< Glyph state */
+			PLMath::Vector2i  vSize;			/**< Size of the glyph bitmap in pixel, zero for glyphs without bitmap (e.g. space) */
+			PLMath::Vector2   vCorner;			/**< Distance (in pixel) from the current pen position to the glyph bitmap */
+			PLMath::Vector2   vPenAdvance;		/**< Object space distance (in pixel) to the next glyph */
+			PLMath::Vector2   vTexCoordMin;		/**< Normalized minimum texture coordinate inside the page, the page index is added to x */
+			PLMath::Vector2   vTexCoordMax;		/**< Normalized maximum texture coordinate inside the page, the page index is added to x */
+			// Internal data
+			PLCore::uint64	  nKey;				/**< Glyph key, see GetGlyphKey() */
+			PLCore::uint32	  nPage;			/**< Index of the page the glyph is packed into, only valid if the glyph has a bitmap */
+			PLCore::uint16	  nX, nY;			/**< Position of the allocated rectangle inside the page in pixel */
+			PLCore::uint16	  nWidth, nHeight;	/**< Size of the allocated rectangle inside the page in pixel, including the padding */
+			PLCore::uint32	  nLastUsedFrame;	/**< Frame the glyph was used the last time */
+			Glyph			 *pPrevious;		/**< Previous (more recently used) glyph inside the LRU list, can be a null pointer */
+			Glyph			 *pNext;			/**< Next (less recently used) glyph inside the LRU list, can be a null pointer */
+		};
+
+
+	//[-------------------------------------------------------]
+	//[ Public functions                                      ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Returns the owner renderer
+		*
+		*  @return
+		*    The owner renderer
+		*/
+		inline Renderer &GetRenderer() const;
+
+		/**
+		*  @brief
+		*    Returns the size of the pages
+		*
+		*  @return
+		*    Width and height of the square pages in pixel
+		*/
+		inline PLCore::uint32 GetPageSize() const;
+
+		/**
+		*  @brief
+		*    Sets the size of the pages
+		*
+		*  @param[in] nSize
+		*    Width and height of the square pages in pixel, is rounded up to the nearest power of two, default is 512
+		*
+		*  @note
+		*    - Clears the atlas if the size changes
+		*/
+		PLRENDERER_API void SetPageSize(PLCore::uint32 nSize = 512);
+
+		/**
+		*  @brief
+		*    Returns the maximum number of pages
+		*
+		*  @return
+		*    The maximum number of pages
+		*/
+		inline PLCore::uint32 GetMaxNumOfPages() const;
+
+		/**
+		*  @brief
+		*    Sets the maximum number of pages
+		*
+		*  @param[in] nMaxNumOfPages
+		*    The maximum number of pages (at least 1), default is 4, glyphs are evicted when all pages are full
+		*
+		*  @note
+		*    - Already created pages are not destroyed
+		*/
+		PLRENDERER_API void SetMaxNumOfPages(PLCore::uint32 nMaxNumOfPages = 4);
+
+		/**
+		*  @brief
+		*    Returns whether or not glyphs are rasterized by a background thread
+		*
+		*  @return
+		*    'true' if glyphs are rasterized by a background thread, else 'false'
+		*/
+		inline bool GetBackgroundRasterization() const;
+
+		/**
+		*  @brief
+		*    Sets whether or not glyphs are rasterized by a background thread
+		*
+		*  @param[in] bBackgroundRasterization
+		*    'true' to rasterize glyphs by a background thread, 'false' to rasterize them on first use on the calling thread
+		*/
+		PLRENDERER_API void SetBackgroundRasterization(bool bBackgroundRasterization = true);
+
+		/**
+		*  @brief
+		*    Returns the glyph of a character
+		*
+		*  @param[in] cFont
+		*    Font the glyph is requested from
+		*  @param[in] nCharacterCode
+		*    Unicode character code
+		*
+		*  @return
+		*    The glyph, a null pointer on error, do not destroy the returned instance
+		*
+		*  @remarks
+		*    If the glyph is not within the atlas, it's rasterized by using "FontTexture::RasterizeGlyph()" with the
+		*    current size and resolution of the font. When background rasterization is enabled, the returned glyph
+		*    is a placeholder with the state "Pending" until "Update()" took over the rasterized bitmap.
+		*    The glyph is marked as used within the current frame, so it's not evicted before the next frame.
+		*
+		*  @note
+		*    - The returned glyph stays valid as long as the generation of the atlas doesn't change
+		*/
+		PLRENDERER_API const Glyph *GetGlyph(FontTexture &cFont, PLCore::uint32 nCharacterCode);
+
+		/**
+		*  @brief
+		*    Marks a glyph as used within the current frame
+		*
+		*  @param[in] sGlyph
+		*    Glyph to mark, must have been returned by GetGlyph() within the current generation
+		*/
+		PLRENDERER_API void UseGlyph(const Glyph &sGlyph);
+
+		/**
+		*  @brief
+		*    Returns the texture buffer of a page
+		*
+		*  @param[in] nPage
+		*    Page index
+		*
+		*  @return
+		*    The texture buffer of the page (alpha, no mipmaps), a null pointer on error
+		*
+		*  @note
+		*    - Modified pages are uploaded within this method, so call it right before the page is used for rendering
+		*/
+		PLRENDERER_API TextureBuffer2D *GetPageTextureBuffer(PLCore::uint32 nPage);
+
+		/**
+		*  @brief
+		*    Updates the atlas
+		*
+		*  @remarks
+		*    Starts a new frame and takes over the glyphs rasterized by the background thread.
+		*
+		*  @note
+		*    - Should be called once per frame
+		*/
+		PLRENDERER_API void Update();
+
+		/**
+		*  @brief
+		*    Waits until all pending glyphs are rasterized and takes them over
+		*
+		*  @note
+		*    - Useful after loading screens or to get reproducible results, there's no need to call Update() afterwards
+		*/
+		PLRENDERER_API void WaitForRasterization();
+
+		/**
+		*  @brief
+		*    Removes all glyphs and pages
+		*/
+		PLRENDERER_API void Clear();
+
+		/**
+		*  @brief
+		*    Removes all glyphs of a font
+		*
+		*  @param[in] cFont
+		*    Font to remove the glyphs of
+		*
+		*  @note
+		*    - Waits until the background thread no longer uses the font
+		*    - Called by the font destructor
+		*/
+		PLRENDERER_API void RemoveFont(FontTexture &cFont);
+
+		/**
+		*  @brief
+		*    Returns the current generation of the atlas
+		*
+		*  @return
+		*    The current generation, changes whenever glyphs become ready or are removed
+		*/
+		inline PLCore::uint32 GetGeneration() const;
+
+		//[-------------------------------------------------------]
+		//[ Statistics                                            ]
+		//[-------------------------------------------------------]
+		/**
+		*  @brief
+		*    Returns the number of pages
+		*
+		*  @return
+		*    The number of currently existing pages
+		*/
+		inline PLCore::uint32 GetNumOfPages() const;
+
+		/**
+		*  @brief
+		*    Returns the number of glyphs
+		*
+		*  @return
+		*    The number of glyphs within the atlas, including pending and missing ones
+		*/
+		inline PLCore::uint32 GetNumOfGlyphs() const;
+
+		/**
+		*  @brief
+		*    Returns the number of pending glyphs
+		*
+		*  @return
+		*    The number of glyphs waiting for the background thread
+		*/
+		inline PLCore::uint32 GetNumOfPendingGlyphs() const;
+
+		/**
+		*  @brief
+		*    Returns the number of evicted glyphs
+		*
+		*  @return
+		*    The number of glyphs evicted since the atlas was created
+		*/
+		inline PLCore::uint32 GetNumOfEvictions() const;
+
+		/**
+		*  @brief
+		*    Returns the packing efficiency
+		*
+		*  @return
+		*    Number of glyph bitmap pixels divided by the number of page pixels, 0 if there are no pages
+		*/
+		PLRENDERER_API float GetPackingEfficiency() const;
+
+
+	//[-------------------------------------------------------]
+	//[ Private definitions                                   ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Skyline segment
+		*/
+		struct SkylineNode {
+			PLCore::uint32 nX;		/**< Left position in pixel */
+			PLCore::uint32 nY;		/**< Height of the skyline in pixel */
+			PLCore::uint32 nWidth;	/**< Width in pixel */
+
+			bool operator ==(const SkylineNode &sOther) const
+			{
+				return (nX == sOther.nX && nY == sOther.nY && nWidth == sOther.nWidth);
+			}
+		};
+
+		/**
+		*  @brief
+		*    Free rectangle left by an evicted glyph
+		*/
+		struct FreeRectangle {
+			PLCore::uint32 nX, nY;			/**< Position in pixel */
+			PLCore::uint32 nWidth, nHeight;	/**< Size in pixel */
+
+			bool operator ==(const FreeRectangle &sOther) const
+			{
+				return (nX == sOther.nX && nY == sOther.nY && nWidth == sOther.nWidth && nHeight == sOther.nHeight);
+			}
+		};
+
+		/**
+		*  @brief
+		*    Atlas page
+		*/
+		struct Page {
+			PLCore::uint8				 *pnData;			/**< Alpha values of the page (always valid!) */
+			TextureBuffer2D				 *pTextureBuffer;	/**< Texture buffer of the page, can be a null pointer */
+			bool						  bDirty;			/**< Must the texture buffer be updated? */
+			PLCore::Array<SkylineNode>	  lstSkyline;		/**< Skyline of the page, sorted from left to right */
+			PLCore::Array<FreeRectangle>  lstFree;			/**< Free rectangles below the skyline */
+			PLCore::uint32				  nNumOfGlyphs;		/**< Number of glyphs inside the page */
+			PLCore::uint32				  nNumOfPixels;		/**< Number of glyph bitmap pixels inside the page */
+		};
+
+		/**
+		*  @brief
+		*    Background rasterization job
+		*/
+		struct Job {
+			FontTexture		*pFont;				/**< Font to rasterize with, always valid! */
+			PLCore::uint64	 nKey;				/**< Glyph key */
+			PLCore::uint32	 nSize;				/**< Font size */
+			PLCore::uint32	 nResolution;		/**< Font resolution */
+			PLCore::uint32	 nCharacterCode;	/**< Unicode character code */
+			Bitmap			 sBitmap;			/**< Rasterized bitmap */
+			bool			 bRasterized;		/**< Was the glyph rasterized successfully? */
+		};
+
+
+	//[-------------------------------------------------------]
+	//[ Private static functions                              ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Background thread function rasterizing the queued glyphs
+		*
+		*  @param[in] pData
+		*    Glyph atlas instance, always valid!
+		*
+		*  @return
+		*    Thread exit code
+		*/
+		static int RasterizeThreadFunction(void *pData);
+
+
+	//[-------------------------------------------------------]
+	//[ Private functions                                     ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Constructor
+		*
+		*  @param[in] cRenderer
+		*    Owner renderer
+		*/
+		GlyphAtlas(Renderer &cRenderer);
+
+		/**
+		*  @brief
+		*    Destructor
+		*/
+		~GlyphAtlas();
+
+		/**
+		*  @brief
+		*    Copy constructor
+		*
+		*  @param[in] cSource
+		*    Source to copy from
+		*/
+		GlyphAtlas(const GlyphAtlas &cSource);
+
+		/**
+		*  @brief
+		*    Copy operator
+		*
+		*  @param[in] cSource
+		*    Source to copy from
+		*
+		*  @return
+		*    Reference to this instance
+		*/
+		GlyphAtlas &operator =(const GlyphAtlas &cSource);
+
+		/**
+		*  @brief
+		*    Returns the key of a glyph
+		*
+		*  @param[in] cFont
+		*    Font the glyph belongs to
+		*  @param[in] nCharacterCode
+		*    Unicode character code
+		*
+		*  @return
+		*    The glyph key, composed of font ID, font size, font resolution and character code
+		*/
+		PLCore::uint64 GetGlyphKey(FontTexture &cFont, PLCore::uint32 nCharacterCode);
+
+		/**
+		*  @brief
+		*    Takes over a rasterized glyph bitmap
+		*
+		*  @param[in] sGlyph
+		*    Glyph to set the bitmap of
+		*  @param[in] sBitmap
+		*    Rasterized bitmap
+		*/
+		void SetGlyphBitmap(Glyph &sGlyph, const Bitmap &sBitmap);
+
+		/**
+		*  @brief
+		*    Allocates a rectangle inside the pages
+		*
+		*  @param[in]  nWidth
+		*    Width of the rectangle in pixel
+		*  @param[in]  nHeight
+		*    Height of the rectangle in pixel
+		*  @param[out] nPage
+		*    Receives the page index
+		*  @param[out] nX
+		*    Receives the x position inside the page
+		*  @param[out] nY
+		*    Receives the y position inside the page
+		*
+		*  @return
+		*    'true' if all went fine, else 'false' (all pages are full with glyphs used within the current frame)
+		*/
+		bool Allocate(PLCore::uint32 nWidth, PLCore::uint32 nHeight, PLCore::uint32 &nPage, PLCore::uint32 &nX, PLCore::uint32 &nY);
+
+		/**
+		*  @brief
+		*    Allocates a rectangle inside the free rectangles of a page
+		*
+		*  @param[in]  cPage
+		*    Page to allocate in
+		*  @param[in]  nWidth
+		*    Width of the rectangle in pixel
+		*  @param[in]  nHeight
+		*    Height of the rectangle in pixel
+		*  @param[out] nX
+		*    Receives the x position inside the page
+		*  @param[out] nY
+		*    Receives the y position inside the page
+		*
+		*  @return
+		*    'true' if all went fine, else 'false'
+		*/
+		bool AllocateFree(Page &cPage, PLCore::uint32 nWidth, PLCore::uint32 nHeight, PLCore::uint32 &nX, PLCore::uint32 &nY);
+
+		/**
+		*  @brief
+		*    Allocates a rectangle on top of the skyline of a page
+		*
+		*  @param[in]  cPage
+		*    Page to allocate in
+		*  @param[in]  nWidth
+		*    Width of the rectangle in pixel
+		*  @param[in]  nHeight
+		*    Height of the rectangle in pixel
+		*  @param[out] nX
+		*    Receives the x position inside the page
+		*  @param[out] nY
+		*    Receives the y position inside the page
+		*
+		*  @return
+		*    'true' if all went fine, else 'false'
+		*/
+		bool AllocateSkyline(Page &cPage, PLCore::uint32 nWidth, PLCore::uint32 nHeight, PLCore::uint32 &nX, PLCore::uint32 &nY);
+
+		/**
+		*  @brief
+		*    Resets a page to an empty page
+		*
+		*  @param[in] cPage
+		*    Page to reset
+		*/
+		void ResetPage(Page &cPage);
+
+		/**
+		*  @brief
+		*    Adds a glyph at the front of the LRU list
+		*
+		*  @param[in] sGlyph
+		*    Glyph to add, must not be within the LRU list
+		*/
+		void LinkGlyph(Glyph &sGlyph);
+
+		/**
+		*  @brief
+		*    Removes a glyph from the LRU list
+		*
+		*  @param[in] sGlyph
+		*    Glyph to remove, must be within the LRU list
+		*/
+		void UnlinkGlyph(Glyph &sGlyph);
+
+		/**
+		*  @brief
+		*    Removes a glyph and gives its space back to the page
+		*
+		*  @param[in] pGlyph
+		*    Glyph to remove, always valid, the instance is destroyed
+		*/
+		void RemoveGlyph(Glyph *pGlyph);
+
+		/**
+		*  @brief
+		*    Takes over the glyphs rasterized by the background thread
+		*/
+		void TakeOverRasterizedGlyphs();
+
+		/**
+		*  @brief
+		*    Starts the background thread
+		*/
+		void StartThread();
+
+		/**
+		*  @brief
+		*    Stops the background thread, the queued jobs are rasterized on the calling thread
+		*/
+		void StopThread();
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		Renderer							*m_pRenderer;					/**< Owner renderer, always valid! */
+		PLCore::uint32						 m_nPageSize;					/**< Width and height of the pages in pixel */
+		PLCore::uint32						 m_nMaxNumOfPages;				/**< Maximum number of pages */
+		bool								 m_bBackgroundRasterization;	/**< Rasterize glyphs by a background thread? */
+		PLCore::Array<Page*>				 m_lstPages;					/**< Pages */
+		PLCore::HashMap<PLCore::uint64, Glyph*> m_mapGlyphs;				/**< Glyphs ("glyph key -> glyph"), the glyphs are owned by this map */
+		Glyph								*m_pMostRecentlyUsed;			/**< Head of the LRU list of glyphs occupying page space, can be a null pointer */
+		Glyph								*m_pLeastRecentlyUsed;			/**< Tail of the LRU list of glyphs occupying page space, can be a null pointer */
+		PLCore::Array<FontTexture*>			 m_lstFonts;					/**< Fonts with glyphs inside the atlas, the font ID is the index + 1, a null pointer marks a free ID */
+		PLCore::uint32						 m_nFrame;						/**< Current frame */
+		PLCore::uint32						 m_nGeneration;					/**< Current generation */
+		PLCore::uint32						 m_nNumOfPendingGlyphs;			/**< Number of pending glyphs */
+		PLCore::uint32						 m_nNumOfEvictions;				/**< Number of evicted glyphs */
+		// Background rasterization
+		PLCore::Thread						*m_pThread;						/**< Background thread, can be a null pointer */
+		PLCore::Mutex						*m_pMutex;						/**< Mutex guarding the data shared with the background thread (always valid!) */
+		PLCore::Mutex						*m_pRasterizeMutex;				/**< Mutex held by the background thread while rasterizing, always locked before "m_pMutex" (always valid!) */
+		PLCore::Semaphore					*m_pSemaphore;					/**< Semaphore counting the jobs for the background thread (always valid!) */
+		PLCore::Array<Job*>					 m_lstQueue;					/**< Jobs waiting to be rasterized */
+		PLCore::Array<Job*>					 m_lstRasterized;				/**< Jobs which have been rasterized */
+		bool								 m_bShutdown;					/**< Shall the background thread stop? */
+
+
+};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // PLRenderer
+
+
+//[-------------------------------------------------------]
+//[ Implementation                                        ]
+//[-------------------------------------------------------]
+#include "PLRenderer/Renderer/GlyphAtlas.inl"
+
+
+#endif // __PLRENDERER_GLYPHATLAS_H__
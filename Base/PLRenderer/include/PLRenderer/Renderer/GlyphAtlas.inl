@@ -0,0 +1,121 @@
+/*********************************************************\
+ *  File: GlyphAtlas.inl                                 *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace PLRenderer {
+
+
+//[-------------------------------------------------------]
+//[ Public functions                                      ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Returns the owner renderer
+*/
+inline Renderer &GlyphAtlas::GetRenderer() const
+{
+	return *m_pRenderer;
+}
+
+/**
+*  @brief
+*    Returns the size of the pages
+*/
+inline PLCore::uint32 GlyphAtlas::GetPageSize() const
+{
+	return m_nPageSize;
+}
+
+/**
+*  @brief
+*    Returns the maximum number of pages
+*/
+inline PLCore::uint32 GlyphAtlas::GetMaxNumOfPages() const
+{
+	return m_nMaxNumOfPages;
+}
+
+/**
+*  @brief
+*    Returns whether or not glyphs are rasterized by a background thread
+*/
+inline bool GlyphAtlas::GetBackgroundRasterization() const
+{
+	return m_bBackgroundRasterization;
+}
+
+/**
+*  @brief
+*    Returns the current generation of the atlas
+*/
+inline PLCore::uint32 GlyphAtlas::GetGeneration() const
+{
+	return m_nGeneration;
+}
+
+/**
+*  @brief
+*    Returns the number of pages
+*/
+inline PLCore::uint32 GlyphAtlas::GetNumOfPages() const
+{
+	return m_lstPages.GetNumOfElements();
+}
+
+/**
+*  @brief
+*    Returns the number of glyphs
+*/
+inline PLCore::uint32 GlyphAtlas::GetNumOfGlyphs() const
+{
+	return m_mapGlyphs.GetNumOfElements();
+}
+
+/**
+*  @brief
+*    Returns the number of pending glyphs
+*/
+inline PLCore::uint32 GlyphAtlas::GetNumOfPendingGlyphs() const
+{
+	return m_nNumOfPendingGlyphs;
+}
+
+/**
+*  @brief
+*    Returns the number of evicted glyphs
+*/
+inline PLCore::uint32 GlyphAtlas::GetNumOfEvictions() const
+{
+	return m_nNumOfEvictions;
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // PLRenderer
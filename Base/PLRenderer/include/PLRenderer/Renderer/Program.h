@@ -264,6 +264,45 @@ class Program : public Resource {
 		*/
 		virtual PLCore::String GetCompiledProgram() = 0;
 
+		/**
+		*  @brief
+		*    Returns the binary of the linked program
+		*
+		*  @param[out] nFormat
+		*    Receives the implementation dependent binary format
+		*  @param[out] lstBinary
+		*    Receives the program binary
+		*
+		*  @return
+		*    'true' if all went fine, else 'false' (program not valid or program binaries not supported)
+		*
+		*  @note
+		*    - Program binaries are only valid for the renderer implementation and driver version they were created with,
+		*      so they can be used as cache only and the source code must be kept as fallback
+		*    - The default implementation doesn't support program binaries
+		*/
+		PLRENDERER_API virtual bool GetProgramBinary(PLCore::uint32 &nFormat, PLCore::Array<PLCore::uint8> &lstBinary);
+
+		/**
+		*  @brief
+		*    Links the program by using a program binary
+		*
+		*  @param[in] nFormat
+		*    Implementation dependent binary format, usually received by "GetProgramBinary()"
+		*  @param[in] pnBinary
+		*    Program binary, must be valid
+		*  @param[in] nNumOfBytes
+		*    Number of bytes of the program binary
+		*
+		*  @return
+		*    'true' if all went fine and the program is now linked, else 'false' (for example the driver rejected the binary)
+		*
+		*  @note
+		*    - On failure, the program is linked by using the shader source codes as usual
+		*    - The default implementation doesn't support program binaries
+		*/
+		PLRENDERER_API virtual bool SetProgramBinary(PLCore::uint32 nFormat, const PLCore::uint8 *pnBinary, PLCore::uint32 nNumOfBytes);
+
 		/**
 		*  @brief
 		*    Get attributes
@@ -89,6 +89,12 @@ class FragmentShader;
 *    The program generator takes as input vertex shader and fragment shader source codes within a defined shader language and
 *    returns dynamically composed program instances using given program flags. The generated programs are internally cached so
 *    during runtime, they need to be dynamically compiled only once.
+*
+*    Each requested program flags combination is recorded together with the generated shader source codes. The recorded program
+*    permutations can be written into a cache file, on the next start the cache file can be loaded and the program permutations
+*    can be generated ahead of time, for example behind a loading screen, instead of producing hitches when they are requested
+*    the first time during rendering. Where supported by the renderer implementation, program binaries are cached as well.
+*    If the renderer context has a program cache directory, this is done automatically during construction and destruction.
 */
 class ProgramGenerator {
 
@@ -204,6 +210,11 @@ class ProgramGenerator {
 		*    Fragment shader profile to use (for example "arbfp1" or "glslf" when using Cg, e.g. "130" when using GLSL), if empty string, a default profile will be used which usually
 		*    tries to use the best available profile that runs on most hardware
 		*
+		*  @remarks
+		*    If the renderer context has a program cache directory (see "RendererContext::SetProgramCacheDirectory()"), the program
+		*    permutations recorded during previous runs with identical shader source codes are loaded and generated at once. The
+		*    destructor saves the recorded program permutations into the program cache directory.
+		*
 		*  @note
 		*    - When using GLSL, the profile is the GLSL version to use
 		*/
@@ -276,6 +287,119 @@ class ProgramGenerator {
 		*/
 		PLRENDERER_API void ClearCache();
 
+		/**
+		*  @brief
+		*    Returns the number of recorded program permutations
+		*
+		*  @return
+		*    The number of recorded program permutations
+		*
+		*  @remarks
+		*    Each program flags combination requested by "GetProgram()" or loaded by "LoadCache()" is recorded, "ClearCache()"
+		*    doesn't remove recorded program permutations.
+		*/
+		PLRENDERER_API PLCore::uint32 GetNumOfRecordedPrograms() const;
+
+		/**
+		*  @brief
+		*    Returns the generated shader source codes of a recorded program permutation
+		*
+		*  @param[in]  nVertexShaderFlags
+		*    Vertex shader flags of the program permutation
+		*  @param[in]  nFragmentShaderFlags
+		*    Fragment shader flags of the program permutation
+		*  @param[out] sVertexShaderSourceCode
+		*    Receives the generated vertex shader source code
+		*  @param[out] sFragmentShaderSourceCode
+		*    Receives the generated fragment shader source code
+		*
+		*  @return
+		*    'true' if the program permutation was recorded, else 'false'
+		*/
+		PLRENDERER_API bool GetRecordedProgram(PLCore::uint32 nVertexShaderFlags, PLCore::uint32 nFragmentShaderFlags, PLCore::String &sVertexShaderSourceCode, PLCore::String &sFragmentShaderSourceCode) const;
+
+		/**
+		*  @brief
+		*    Returns the number of program permutations loaded by "LoadCache()" which were not generated, yet
+		*
+		*  @return
+		*    The number of pending program permutations
+		*/
+		PLRENDERER_API PLCore::uint32 GetNumOfPendingPrograms() const;
+
+		/**
+		*  @brief
+		*    Loads recorded program permutations from a cache file
+		*
+		*  @param[in] sFilename
+		*    Name of the cache file to load
+		*
+		*  @return
+		*    'true' if all went fine, else 'false' (file not found, invalid or written for other shader source codes)
+		*
+		*  @remarks
+		*    The loaded program permutations are pending until they are requested by "GetProgram()" or generated by "WarmUp()".
+		*    The cache file is only accepted if it was written by a program generator with identical shader language, shader
+		*    source codes and profiles. The mapping of program flags to flag definitions is only known when a program is requested,
+		*    so the first "GetProgram()" call for a loaded program permutation verifies the generated shader source codes. If they
+		*    differ, the flag definitions were changed since the cache file was written and all loaded program permutations which
+		*    were not verified, yet, are discarded.
+		*/
+		PLRENDERER_API bool LoadCache(const PLCore::String &sFilename);
+
+		/**
+		*  @brief
+		*    Saves the recorded program permutations into a cache file
+		*
+		*  @param[in] sFilename
+		*    Name of the cache file to save
+		*
+		*  @return
+		*    'true' if all went fine, else 'false'
+		*
+		*  @note
+		*    - The binaries of the generated programs are requested from the renderer, so this method should be called while
+		*      the renderer is still able to render
+		*/
+		PLRENDERER_API bool SaveCache(const PLCore::String &sFilename) const;
+
+		/**
+		*  @brief
+		*    Generates pending program permutations
+		*
+		*  @param[in] nMaxNumOfPrograms
+		*    Maximum number of program permutations to generate, 0 for all pending program permutations
+		*
+		*  @return
+		*    The number of still pending program permutations
+		*
+		*  @remarks
+		*    The shaders are compiled and the programs linked at once, so this should be done behind a loading screen. In order
+		*    to spread the work over multiple frames, call this method once per frame with a small maximum number of programs
+		*    until it returns 0. Must be called by the thread owning the renderer.
+		*/
+		PLRENDERER_API PLCore::uint32 WarmUp(PLCore::uint32 nMaxNumOfPrograms = 0);
+
+
+	//[-------------------------------------------------------]
+	//[ Private structures                                    ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Recorded program permutation
+		*/
+		struct Permutation {
+			PLCore::uint64				 nProgramID;				/**< Combined vertex shader and fragment shader flags */
+			PLCore::String				 sVertexShaderSourceCode;	/**< Generated vertex shader source code */
+			PLCore::String				 sFragmentShaderSourceCode;	/**< Generated fragment shader source code */
+			PLCore::uint32				 nBinaryFormat;				/**< Implementation dependent format of the program binary */
+			PLCore::Array<PLCore::uint8> lstBinary;					/**< Program binary loaded from a cache file, released as soon as the program was generated */
+			GeneratedProgram			*pGeneratedProgram;			/**< Generated program, can be a null pointer */
+			bool						 bPending;					/**< Loaded from a cache file and not generated, yet? */
+			bool						 bVerified;					/**< Were the generated shader source codes confirmed by the flag definitions of a "GetProgram()" call? */
+		};
+
 
 	//[-------------------------------------------------------]
 	//[ Private functions                                     ]
@@ -311,6 +435,82 @@ class ProgramGenerator {
 		*/
 		void OnDirty(Program *pProgram);
 
+		/**
+		*  @brief
+		*    Returns the checksum identifying the shader language, shader source codes and profiles
+		*
+		*  @return
+		*    The checksum, written into cache files
+		*/
+		PLCore::uint32 GetSourceChecksum() const;
+
+		/**
+		*  @brief
+		*    Generates shader source code
+		*
+		*  @param[in] sProfile
+		*    Shader profile
+		*  @param[in] lstDefinitions
+		*    Flag definitions to add in front of the shader source code
+		*  @param[in] sSourceCode
+		*    Shader ("ber-Shader") source code
+		*
+		*  @return
+		*    The generated shader source code
+		*/
+		PLCore::String GenerateSourceCode(const PLCore::String &sProfile, const PLCore::Array<const char *> &lstDefinitions, const PLCore::String &sSourceCode) const;
+
+		/**
+		*  @brief
+		*    Returns a recorded program permutation
+		*
+		*  @param[in] nProgramID
+		*    Combined vertex shader and fragment shader flags
+		*
+		*  @return
+		*    The recorded program permutation, a null pointer if there's no such program permutation
+		*/
+		Permutation *GetPermutation(PLCore::uint64 nProgramID) const;
+
+		/**
+		*  @brief
+		*    Records a new program permutation
+		*
+		*  @param[in] nProgramID
+		*    Combined vertex shader and fragment shader flags, must not be recorded, yet
+		*
+		*  @return
+		*    The new recorded program permutation, always valid
+		*/
+		Permutation &AddPermutation(PLCore::uint64 nProgramID);
+
+		/**
+		*  @brief
+		*    Verifies a loaded program permutation against the flag definitions it's requested with
+		*
+		*  @param[in] sPermutation
+		*    Loaded program permutation to verify
+		*  @param[in] cFlags
+		*    Program flags the program permutation is requested with
+		*
+		*  @return
+		*    'true' if the generated shader source codes match, else 'false' (all loaded program permutations which were
+		*    not verified, yet, were discarded, "sPermutation" is no longer valid)
+		*/
+		bool VerifyPermutation(Permutation &sPermutation, const Flags &cFlags);
+
+		/**
+		*  @brief
+		*    Generates the program of a recorded program permutation
+		*
+		*  @param[in] sPermutation
+		*    Recorded program permutation to generate the program for
+		*
+		*  @return
+		*    Generated program, can be a null pointer
+		*/
+		GeneratedProgram *GenerateProgram(Permutation &sPermutation);
+
 
 	//[-------------------------------------------------------]
 	//[ Private event handlers                                ]
@@ -338,7 +538,13 @@ class ProgramGenerator {
 		PLCore::Array<FragmentShader*>					   m_lstFragmentShaders;	/**< List of generated fragment shader instances */
 		PLCore::HashMap<PLCore::uint32, FragmentShader*>   m_mapFragmentShaders;	/**< Program flags -> fragment shader instance */
 		PLCore::Array<GeneratedProgram*>				   m_lstPrograms;			/**< List of generated program instances */
-		PLCore::HashMap<PLCore::uint64, GeneratedProgram*> m_mapPrograms;			/**< Program flags -> program instance */
+		// Recorded program permutations
+		PLCore::Array<Permutation*>						   m_lstPermutations;		/**< List of recorded program permutations, in the order they were recorded */
+		PLCore::uint32									  *m_pnPermutationSlots;	/**< Flat hash table with open addressing, program flags -> recorded program permutation index + 1 (0 = empty slot), can be a null pointer */
+		PLCore::uint32									   m_nNumOfPermutationSlots;	/**< Number of slots within the flat hash table, always a power of two or 0 */
+		PLCore::uint32									   m_nNumOfPendingPrograms;	/**< Number of loaded program permutations which were not generated, yet */
+		PLCore::uint32									   m_nNextPendingProgram;	/**< Index of the recorded program permutation to look for pending program permutations next */
+		PLCore::String									   m_sCacheFilename;		/**< Cache file within the program cache directory of the renderer context, empty if there's no program cache directory */
 
 
 };
@@ -221,6 +221,31 @@ class ProgramUniform {
 		*/
 		PLRENDERER_API virtual ~ProgramUniform();
 
+		/**
+		*  @brief
+		*    Updates the cached uniform value
+		*
+		*  @param[in] pData
+		*    Uniform value, must be valid
+		*  @param[in] nSize
+		*    Size of the uniform value in bytes
+		*
+		*  @return
+		*    'true' if the value was changed and must be passed to the API, 'false' if the change is redundant
+		*
+		*  @note
+		*    - Values larger than a 4x4 matrix are not cached and always passed to the API
+		*    - The API implementation must call "InvalidateCache()" if the uniform value is changed in another way,
+		*      for example by linking the program again
+		*/
+		PLRENDERER_API bool UpdateCache(const void *pData, PLCore::uint32 nSize);
+
+		/**
+		*  @brief
+		*    Invalidates the cached uniform value, the next value is passed to the API
+		*/
+		PLRENDERER_API void InvalidateCache();
+
 
 	//[-------------------------------------------------------]
 	//[ Private functions                                     ]
@@ -248,6 +273,14 @@ class ProgramUniform {
 		ProgramUniform &operator =(const ProgramUniform &cSource);
 
 
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		PLCore::uint8  m_nCache[64];	/**< Cached uniform value, large enough for a 4x4 matrix */
+		PLCore::uint32 m_nCacheSize;	/**< Size of the cached uniform value in bytes, 0 if there's no cached value */
+
+
 };
 
 
@@ -65,6 +65,7 @@ namespace PLRenderer {
 	class Program;
 	class FontManager;
 	class ShaderLanguage;
+	class CommandList;
 }
 
 
@@ -117,6 +118,29 @@ class Renderer : public PLCore::Object {
 	pl_class_def_end
 
 
+	//[-------------------------------------------------------]
+	//[ Public functions                                      ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Executes a command list
+		*
+		*  @param[in] cCommandList
+		*    Command list to execute, can be executed multiple times
+		*
+		*  @return
+		*    'true' if all went fine, else 'false' (at least one of the recorded calls failed, the
+		*    remaining calls are executed nevertheless)
+		*
+		*  @remarks
+		*    Calls the recorded functions in the recorded order, the result is exactly the same as
+		*    calling the functions directly. Command lists can be recorded by any thread, but this
+		*    function must be called by the thread owning the renderer.
+		*/
+		PLRENDERER_API bool Execute(const CommandList &cCommandList);
+
+
 	//[-------------------------------------------------------]
 	//[ Public virtual Renderer functions                     ]
 	//[-------------------------------------------------------]
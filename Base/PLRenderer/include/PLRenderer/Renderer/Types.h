@@ -490,6 +490,14 @@ struct Capabilities {
 struct Statistics {
 	PLCore::uint32 nRenderStateChanges;			/**< Number of render (internal API) state changes */
 	PLCore::uint32 nSamplerStateChanges;		/**< Number of sampler (internal API) state changes */
+	PLCore::uint32 nRenderStateFiltered;		/**< Number of redundant render state changes which were not passed to the API */
+	PLCore::uint32 nSamplerStateFiltered;		/**< Number of redundant sampler state changes which were not passed to the API */
+	PLCore::uint32 nViewportChanges;			/**< Number of viewport (internal API) changes */
+	PLCore::uint32 nViewportFiltered;			/**< Number of redundant viewport changes which were not passed to the API */
+	PLCore::uint32 nScissorRectChanges;			/**< Number of scissor rectangle (internal API) changes */
+	PLCore::uint32 nScissorRectFiltered;		/**< Number of redundant scissor rectangle changes which were not passed to the API */
+	PLCore::uint32 nColorMaskChanges;			/**< Number of color mask (internal API) changes */
+	PLCore::uint32 nColorMaskFiltered;			/**< Number of redundant color mask changes which were not passed to the API */
 	PLCore::uint32 nDrawPrimitivCalls;			/**< Number of draw primitive calls */
 	PLCore::uint32 nVertices;					/**< Number of rendered vertices */
 	PLCore::uint32 nTriangles;					/**< Number of rendered triangles */
@@ -498,6 +506,7 @@ struct Statistics {
 	PLCore::uint32 nTextureBuffersNum;			/**< Number of texture buffers */
 	PLCore::uint64 nTextureBuffersMem;			/**< Memory in bytes the texture buffers require */
 	PLCore::uint32 nTextureBufferBinds;			/**< Number of texture buffer bindings */
+	PLCore::uint32 nTextureBufferFiltered;		/**< Number of redundant texture buffer bindings which were not passed to the API */
 	// Vertex buffers
 	PLCore::uint32 nVertexBufferNum;			/**< Number of vertex buffers */
 	PLCore::uint64 nVertexBufferMem;			/**< Memory in bytes the vertex buffers require */
@@ -508,11 +517,22 @@ struct Statistics {
 	PLCore::uint64 nIndexBufferMem;				/**< Memory in bytes the index buffers require */
 	PLCore::uint64 nIndexBuffersSetupTime;		/**< Index buffers setup time (microseconds) */
 	PLCore::uint32 nIndexBufferLocks;			/**< Number of index buffer locks */
+	PLCore::uint32 nIndexBufferBinds;			/**< Number of index buffer bindings */
+	PLCore::uint32 nIndexBufferFiltered;		/**< Number of redundant index buffer bindings which were not passed to the API */
+	// Programs (the Direct3D and null backends have no programs, only GLSL uniforms are filtered)
+	PLCore::uint32 nProgramBinds;				/**< Number of program bindings */
+	PLCore::uint32 nProgramFiltered;			/**< Number of redundant program bindings which were not passed to the API */
+	PLCore::uint32 nUniformChanges;				/**< Number of program uniform (internal API) changes */
+	PLCore::uint32 nUniformFiltered;			/**< Number of redundant program uniform changes which were not passed to the API */
 	// Uniform buffers
 	PLCore::uint32 nUniformBufferNum;			/**< Number of uniform buffers */
 	PLCore::uint64 nUniformBufferMem;			/**< Memory in bytes the uniform buffers require */
 	PLCore::uint64 nUniformBuffersSetupTime;	/**< Uniform buffers setup time (microseconds) */
 	PLCore::uint32 nUniformBufferLocks;			/**< Number of uniform buffer locks */
+	// Draw helpers
+	PLCore::uint32 nDrawHelpersPrimitives;		/**< Number of primitives and texts added to draw helper batches */
+	PLCore::uint32 nDrawHelpersBatches;			/**< Number of draw helper batches drawn (draw calls) */
+	PLCore::uint32 nDrawHelpersFlushes;			/**< Number of draw helper batch flushes */
 };
 
 
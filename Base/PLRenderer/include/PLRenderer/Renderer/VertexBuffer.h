@@ -80,14 +80,14 @@ class VertexBuffer : public Buffer {
 		enum ESemantic {
 			Position     =  0,	/**< Position data (1 channel) */
 			BlendWeight  =  1,	/**< Blend weight data (1 channel) */
-			Normal       =  2,	/**< Normal data (1 channel, only Float3/Half3 allowed due to restrictions of legacy APIs!) */
-			Color        =  3,	/**< Color data (2 channels, only RGBA allowed, second channel requires Capabilities::bVertexBufferSecondaryColor) */
+			Normal       =  2,	/**< Normal data (1 channel, only Float3/Half3/Short4N allowed due to restrictions of legacy APIs!) */
+			Color        =  3,	/**< Color data (2 channels, only RGBA/UByte4N allowed, second channel requires Capabilities::bVertexBufferSecondaryColor) */
 			FogCoord     =  4,	/**< Fog coordinate data (1 channel, only Float1 allowed, requires FixedFunctions::Capabilities::bVertexBufferFogCoord) */
 			PointSize    =  5,	/**< Point sprite size data (1 channel, only Float1 allowed! Known as "PSize", but this name may conflict with OS definitions) */
 			BlendIndices =  6,	/**< Blend indices data (1 channel) */
 			TexCoord     =  7,	/**< Texture coordinate data (n channels) */
-			Tangent      =  8,	/**< Tangent data (1 channel, only Float3/Half3 allowed due to restrictions of legacy APIs!) */
-			Binormal     =  9	/**< Binormal (also referred to as bitangent) data (1 channel, only Float3/Half3 allowed due to restrictions of legacy APIs!) */
+			Tangent      =  8,	/**< Tangent data (1 channel, only Float3/Half3/Short4N allowed due to restrictions of legacy APIs!) */
+			Binormal     =  9	/**< Binormal (also referred to as bitangent) data (1 channel, only Float3/Half3/Short4N allowed due to restrictions of legacy APIs!) */
 		};
 		static const PLCore::uint8 NumOfSemantics      = 10;	/**< Number of vertex attribute semantics */
 		static const PLCore::uint8 MaxPipelineChannels = 16;	/**< Maximum possible number of channels */
@@ -107,7 +107,10 @@ class VertexBuffer : public Buffer {
 			Half1  = 7,	/**< Half 1 (one component per element, 16 bit floating point per component, may not be supported by each API, be careful with this data type because not every GPU driver is optimized for it) */
 			Half2  = 8,	/**< Half 2 (two components per element, 16 bit floating point per component, may not be supported by each API, be careful with this data type because not every GPU driver is optimized for it) */
 			Half3  = 9,	/**< Half 3 (three components per element, 16 bit floating point per component, may not be supported by each API, be careful with this data type because not every GPU driver is optimized for it) */
-			Half4  = 10	/**< Half 4 (four components per element, 16 bit floating point per component, may not be supported by each API, be careful with this data type because not every GPU driver is optimized for it) */
+			Half4  = 10,	/**< Half 4 (four components per element, 16 bit floating point per component, may not be supported by each API, be careful with this data type because not every GPU driver is optimized for it) */
+			UByte4N = 11,	/**< Unsigned byte 4 normalized (four components per element, 8 bit unsigned integer per component mapped to [0, 1], for colors and blend weights, may not be supported by each API) */
+			Short2N = 12,	/**< Short 2 normalized (two components per element, 16 bit signed integer per component mapped to [-1, 1], may not be supported by each API) */
+			Short4N = 13	/**< Short 4 normalized (four components per element, 16 bit signed integer per component mapped to [-1, 1], for normals, tangents and binormals, may not be supported by each API) */
 		};
 
 
@@ -128,6 +131,7 @@ class VertexBuffer : public Buffer {
 			PLCore::uint32 nSizeAPI;		/**< Size (in bytes) of the vertex attribute */
 			PLCore::uint32 nTypeAPI;		/**< API dependent vertex type */
 			PLCore::uint32 nComponentsAPI;	/**< Number of vertex type components */
+			bool		   bNormalizedAPI;	/**< Are the integer components mapped to [0, 1] respectively [-1, 1] when the API reads them? */
 		};
 
 
@@ -327,6 +331,58 @@ class VertexBuffer : public Buffer {
 		*/
 		PLRENDERER_API bool SetFloat(PLCore::uint32 nIndex, PLCore::uint32 nSemantic, PLCore::uint32 nChannel, float fX, float fY = 0.0f, float fZ = 0.0f, float fW = 0.0f);
 
+		/**
+		*  @brief
+		*    Fills the data of a vertex buffer attribute of a range of vertices into a given floating point array
+		*
+		*  @param[in]  nSemantic
+		*    Any member of the vertex attribute semantic enumeration type
+		*  @param[in]  nChannel
+		*    Pipeline channel (see ESemantic)
+		*  @param[in]  nFirstVertex
+		*    Index of the first vertex
+		*  @param[in]  nNumOfVertices
+		*    Number of vertices, "nFirstVertex+nNumOfVertices" must not be greater than the number of vertices
+		*  @param[out] pfDestination
+		*    Receives the components of the vertices one after another, must be valid and must have at least
+		*    "nNumOfVertices*<number of components of the attribute type>" elements (RGBA has 4 components)
+		*
+		*  @return
+		*    'true' if all went fine, else 'false'
+		*
+		*  @note
+		*    - The vertex buffer must be locked
+		*    - Unlike GetFloat() this method is intended for processing many vertices, half data is converted
+		*      at once by using "PLMath::Half::ToFloatArray()"
+		*/
+		PLRENDERER_API bool GetFloatArray(PLCore::uint32 nSemantic, PLCore::uint32 nChannel, PLCore::uint32 nFirstVertex, PLCore::uint32 nNumOfVertices, float *pfDestination);
+
+		/**
+		*  @brief
+		*    Sets the data of a vertex buffer attribute of a range of vertices by using a given floating point array
+		*
+		*  @param[in] nSemantic
+		*    Any member of the vertex attribute semantic enumeration type
+		*  @param[in] nChannel
+		*    Pipeline channel (see ESemantic)
+		*  @param[in] nFirstVertex
+		*    Index of the first vertex
+		*  @param[in] nNumOfVertices
+		*    Number of vertices, "nFirstVertex+nNumOfVertices" must not be greater than the number of vertices
+		*  @param[in] pfSource
+		*    The components of the vertices one after another, must be valid and must have at least
+		*    "nNumOfVertices*<number of components of the attribute type>" elements (RGBA has 4 components)
+		*
+		*  @return
+		*    'true' if all went fine, else 'false'
+		*
+		*  @note
+		*    - The vertex buffer must be locked
+		*    - Unlike SetFloat() this method is intended for processing many vertices, half data is converted
+		*      at once by using "PLMath::Half::FromFloatArray()"
+		*/
+		PLRENDERER_API bool SetFloatArray(PLCore::uint32 nSemantic, PLCore::uint32 nChannel, PLCore::uint32 nFirstVertex, PLCore::uint32 nNumOfVertices, const float *pfSource);
+
 		/**
 		*  @brief
 		*    Returns the vertex buffer bounding box
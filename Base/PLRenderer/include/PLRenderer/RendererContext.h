@@ -30,6 +30,7 @@
 //[-------------------------------------------------------]
 //[ Includes                                              ]
 //[-------------------------------------------------------]
+#include <PLCore/String/String.h>
 #include <PLCore/Base/Event/Event.h>
 #include <PLCore/Core/AbstractContext.h>
 #include "PLRenderer/Renderer/Renderer.h"
@@ -38,9 +39,6 @@
 //[-------------------------------------------------------]
 //[ Forward declarations                                  ]
 //[-------------------------------------------------------]
-namespace PLCore {
-	class String;
-}
 namespace PLRenderer {
 	class TextureManager;
 	class EffectManager;
@@ -174,6 +172,29 @@ class RendererContext : public PLCore::AbstractContext {
 		*/
 		PLRENDERER_API MaterialManager &GetMaterialManager();
 
+		/**
+		*  @brief
+		*    Returns the directory the program generators cache their recorded program permutations in
+		*
+		*  @return
+		*    The program cache directory, empty string if the program permutations are not cached across runs
+		*/
+		inline PLCore::String GetProgramCacheDirectory() const;
+
+		/**
+		*  @brief
+		*    Sets the directory the program generators cache their recorded program permutations in
+		*
+		*  @param[in] sDirectory
+		*    The program cache directory, empty string if the program permutations should not be cached across runs (default)
+		*
+		*  @remarks
+		*    Program generators created after this call load their program permutations recorded during previous runs from this
+		*    directory and generate them at once, on destruction they save them into this directory (see "ProgramGenerator").
+		*    The directory is created automatically if it doesn't exist, yet.
+		*/
+		inline void SetProgramCacheDirectory(const PLCore::String &sDirectory);
+
 		/**
 		*  @brief
 		*    Updates the render context
@@ -183,6 +204,9 @@ class RendererContext : public PLCore::AbstractContext {
 		*    - Updates the effect manager
 		*    - Emits the update event
 		*    - Updates the renderer ("redraw")
+		*    - Updates the glyph atlas of the font manager
+		*    - Updates the texture streaming
+		*    - Updates the global resource budget (see "PLCore::ResourceBudget")
 		*    - Collects renderer context profiling information
 		*/
 		PLRENDERER_API void Update();
@@ -222,6 +246,7 @@ class RendererContext : public PLCore::AbstractContext {
 		TextureManager  *m_pTextureManager;		/**< The texture manager of this renderer context, a null pointer if not yet initialized */
 		EffectManager   *m_pEffectManager;		/**< The effect manager of this renderer context, a null pointer if not yet initialized */
 		MaterialManager *m_pMaterialManager;	/**< The material manager of this renderer context, a null pointer if not yet initialized */
+		PLCore::String	 m_sProgramCacheDirectory;	/**< The directory the program generators cache their recorded program permutations in, can be empty */
 
 
 };
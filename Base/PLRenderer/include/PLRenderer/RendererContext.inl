@@ -40,6 +40,24 @@ inline Renderer &RendererContext::GetRenderer() const
 	return *m_pRenderer;
 }
 
+/**
+*  @brief
+*    Returns the directory the program generators cache their recorded program permutations in
+*/
+inline PLCore::String RendererContext::GetProgramCacheDirectory() const
+{
+	return m_sProgramCacheDirectory;
+}
+
+/**
+*  @brief
+*    Sets the directory the program generators cache their recorded program permutations in
+*/
+inline void RendererContext::SetProgramCacheDirectory(const PLCore::String &sDirectory)
+{
+	m_sProgramCacheDirectory = sDirectory;
+}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
@@ -192,6 +192,47 @@ class Texture : public PLCore::Resource<Texture> {
 		*/
 		inline const PLMath::Vector3i &GetOriginalSize() const;
 
+		/**
+		*  @brief
+		*    Returns whether or not the high resolution mipmaps of this texture are streamed
+		*
+		*  @return
+		*    'true' if the texture manager streams the high resolution mipmaps of this texture, else 'false'
+		*
+		*  @remarks
+		*    Plain 2D textures loaded while a texture manager streaming budget is set are streamed. Such textures
+		*    are created with just their small low resolution mipmaps, the higher resolution ones are loaded
+		*    in the background as soon as the usage reported by ReportUsage() requires them.
+		*
+		*  @see
+		*    - TextureManager::SetStreamingBudget()
+		*/
+		inline bool IsStreamed() const;
+
+		/**
+		*  @brief
+		*    Returns the highest resolution resident mipmap of a streamed texture
+		*
+		*  @return
+		*    The highest resolution resident mipmap, 0 is the full resolution (always 0 if the texture is not streamed)
+		*/
+		inline PLCore::uint32 GetStreamingResidentMipmap() const;
+
+		/**
+		*  @brief
+		*    Reports the usage of this texture within the current frame
+		*
+		*  @param[in] fScreenSize
+		*    Approximated size in pixel the texture covers on the screen
+		*
+		*  @remarks
+		*    Used by the scene renderer to tell the texture manager which mipmap of a streamed texture
+		*    is required. The mipmap is chosen so that one texel is roughly covering one pixel, when
+		*    a texture is reported multiple times within one frame the highest resolution one wins.
+		*    Does nothing if the texture is not streamed.
+		*/
+		PLRENDERER_API void ReportUsage(float fScreenSize);
+
 		/**
 		*  @brief
 		*    Makes the texture to the current renderer texture
@@ -262,6 +303,26 @@ class Texture : public PLCore::Resource<Texture> {
 		*/
 		void DestroyTextureBuffer();
 
+		/**
+		*  @brief
+		*    Sets the high resolution texture buffer of a streamed texture
+		*
+		*  @param[in] pTextureBuffer
+		*    High resolution texture buffer to use, a null pointer to fall back to the low resolution mipmaps
+		*  @param[in] nMipmap
+		*    Mipmap of the streamed texture the given texture buffer starts with
+		*
+		*  @note
+		*    - A previously used high resolution texture buffer is destroyed
+		*/
+		void SetStreamingTextureBuffer(TextureBuffer *pTextureBuffer, PLCore::uint32 nMipmap);
+
+		/**
+		*  @brief
+		*    Stops the streaming of this texture and destroys the low resolution texture buffer
+		*/
+		void StopStreaming();
+
 
 	//[-------------------------------------------------------]
 	//[ Private data                                          ]
@@ -271,6 +332,25 @@ class Texture : public PLCore::Resource<Texture> {
 		bool				m_bShareTextureBuffer;		/**< If 'true', do not delete the texture buffer by yourself! */
 		ECompressionFormat  m_nCompressionHint;			/**< Compression hint */
 		PLMath::Vector3i    m_vOriginalSize;			/**< Original texture size */
+		// Mip streaming
+		ResourceHandler	   *m_pStreamingTailHandler;	/**< Renderer texture buffer resource handler of the always resident low resolution mipmaps (NEVER a null pointer!) */
+		bool				m_bStreamed;				/**< Are the high resolution mipmaps streamed by the texture manager? */
+		PLMath::Vector3i	m_vStreamingSize;			/**< Size of mipmap 0 of the streamed texture */
+		PLCore::uint32		m_nStreamingFormat;			/**< Internal texture buffer format (TextureBuffer::EPixelFormat) */
+		PLCore::uint32		m_nStreamingFlags;			/**< Texture buffer flags */
+		PLCore::uint32		m_nStreamingTailMipmap;		/**< Mipmap the always resident low resolution texture buffer starts with */
+		PLCore::uint32		m_nStreamingResidentMipmap;	/**< Highest resolution resident mipmap */
+		PLCore::uint32		m_nStreamingRequestedMipmap;	/**< Mipmap of the pending load request, same as the resident mipmap if there's no such request */
+		PLCore::uint32		m_nStreamingWantedMipmap;	/**< Mipmap wanted by the usage within the last used frame */
+		PLCore::uint32		m_nStreamingLastUsedFrame;	/**< Texture manager streaming frame this texture was last used within, 0 if never used */
+		PLCore::uint32		m_nStreamingResidentBytes;	/**< Number of bytes of the resident texture buffers (low and high resolution) */
+
+
+	//[-------------------------------------------------------]
+	//[ Public virtual PLCore::Resource functions             ]
+	//[-------------------------------------------------------]
+	public:
+		PLRENDERER_API virtual PLCore::uint64 GetGPUMemoryUsage() const override;
 
 
 	//[-------------------------------------------------------]
@@ -68,6 +68,24 @@ inline const PLMath::Vector3i &Texture::GetOriginalSize() const
 	return m_vOriginalSize;
 }
 
+/**
+*  @brief
+*    Returns whether or not the high resolution mipmaps of this texture are streamed
+*/
+inline bool Texture::IsStreamed() const
+{
+	return m_bStreamed;
+}
+
+/**
+*  @brief
+*    Returns the highest resolution resident mipmap of a streamed texture
+*/
+inline PLCore::uint32 Texture::GetStreamingResidentMipmap() const
+{
+	return m_nStreamingResidentMipmap;
+}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
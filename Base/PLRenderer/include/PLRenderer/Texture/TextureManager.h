@@ -31,10 +31,21 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include <PLCore/Container/ResourceManager.h>
+#include <PLGraphics/PLGraphics.h>
 #include "PLRenderer/Texture/Texture.h"
 #include "PLRenderer/Texture/TextureHandler.h"
 
 
+//[-------------------------------------------------------]
+//[ Forward declarations                                  ]
+//[-------------------------------------------------------]
+namespace PLCore {
+	class Mutex;
+	class Thread;
+	class Semaphore;
+}
+
+
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
 //[-------------------------------------------------------]
@@ -54,6 +65,13 @@ class RendererContext;
 *  @brief
 *    This is a manager for the texture resource
 *
+*  @remarks
+*    When a streaming budget is set, the high resolution mipmaps of plain 2D textures are streamed: Such textures
+*    are loaded with just their low resolution mipmaps, the scene renderer reports the screen space usage of
+*    the textures via 'Texture::ReportUsage()' and once per frame 'UpdateStreaming()' loads the missing higher
+*    resolution mipmaps within a background thread. If the budget would be exceeded, the high resolution
+*    mipmaps of the least recently used textures are evicted first.
+*
 *  @note
 *    - Unloads unused resources automatically by default
 */
@@ -63,6 +81,7 @@ class TextureManager : public PLCore::ResourceManager<Texture> {
 	//[-------------------------------------------------------]
 	//[ Friends                                               ]
 	//[-------------------------------------------------------]
+	friend class Texture;
 	friend class TextureHandler;
 	friend class RendererContext;
 
@@ -72,6 +91,7 @@ class TextureManager : public PLCore::ResourceManager<Texture> {
 	//[-------------------------------------------------------]
 	public:
 		static PLRENDERER_API const PLCore::String Default;	/**< Default texture */
+		static PLRENDERER_API const PLCore::uint32 StreamingTailSize;	/**< Maximum width and height of the always resident low resolution mipmaps of streamed textures (64) */
 
 
 	//[-------------------------------------------------------]
@@ -193,6 +213,58 @@ class TextureManager : public PLCore::ResourceManager<Texture> {
 		*/
 		inline void SetTextureCompressionAllowed(bool bAllowed);
 
+		/**
+		*  @brief
+		*    Returns whether or not uncompressed images are compressed on load
+		*
+		*  @return
+		*    'true' if uncompressed images are compressed on load, else 'false'
+		*
+		*  @see
+		*    - SetTextureCompressionOnLoad()
+		*/
+		inline bool IsTextureCompressionOnLoad() const;
+
+		/**
+		*  @brief
+		*    Sets whether or not uncompressed images are compressed on load
+		*
+		*  @param[in] bOnLoad
+		*    'true' if uncompressed images are compressed on load, else 'false', default is 'false'
+		*
+		*  @remarks
+		*    If texture compression is allowed and a texture is using a DXT or LATC compression hint, an uncompressed
+		*    byte image is compressed (including its mipmaps) by using "PLGraphics::BlockCompressor" before the texture
+		*    buffer is created. The renderer backend then uploads the compressed data instead of letting the driver
+		*    compress the image, which is slow and often of poor quality, and the image data the texture manager
+		*    keeps in memory shrinks as well.
+		*
+		*  @note
+		*    - Only has an influence on newly loaded textures, not already loaded ones
+		*/
+		inline void SetTextureCompressionOnLoad(bool bOnLoad);
+
+		/**
+		*  @brief
+		*    Returns the quality used when compressing images on load
+		*
+		*  @return
+		*    The quality used when compressing images on load
+		*/
+		inline PLGraphics::ECompressionQuality GetTextureCompressionQuality() const;
+
+		/**
+		*  @brief
+		*    Sets the quality used when compressing images on load
+		*
+		*  @param[in] nQuality
+		*    The quality used when compressing images on load, default is "PLGraphics::CompressionQualityFast"
+		*
+		*  @see
+		*    - SetTextureCompressionOnLoad()
+		*/
+		inline void SetTextureCompressionQuality(PLGraphics::ECompressionQuality nQuality);
+
 		/**
 		*  @brief
 		*    Reloads all textures
@@ -238,6 +310,69 @@ class TextureManager : public PLCore::ResourceManager<Texture> {
 		*/
 		PLRENDERER_API Texture *CreateTexture(const PLCore::String &sName, const PLCore::String &sParameters);
 
+		/**
+		*  @brief
+		*    Returns the texture streaming budget
+		*
+		*  @return
+		*    Maximum number of bytes the texture buffers of streamed textures may use, 0 if streaming is disabled
+		*
+		*  @see
+		*    - SetStreamingBudget()
+		*/
+		inline PLCore::uint64 GetStreamingBudget() const;
+
+		/**
+		*  @brief
+		*    Sets the texture streaming budget
+		*
+		*  @param[in] nBudget
+		*    Maximum number of bytes the texture buffers of streamed textures may use, 0 to disable streaming (default)
+		*
+		*  @note
+		*    - Only newly loaded textures are streamed, already loaded ones stay as they are
+		*    - If the new budget is lower, the high resolution mipmaps of unused textures are evicted at once
+		*    - The low resolution mipmaps of streamed textures are always resident and count into the budget
+		*/
+		PLRENDERER_API void SetStreamingBudget(PLCore::uint64 nBudget);
+
+		/**
+		*  @brief
+		*    Returns the number of bytes the texture buffers of streamed textures are currently using
+		*
+		*  @return
+		*    Number of bytes the texture buffers of streamed textures are currently using
+		*/
+		inline PLCore::uint64 GetStreamingMemoryUsage() const;
+
+		/**
+		*  @brief
+		*    Returns the current streaming frame
+		*
+		*  @return
+		*    The current streaming frame, incremented by each 'UpdateStreaming()'-call
+		*/
+		inline PLCore::uint32 GetStreamingFrame() const;
+
+		/**
+		*  @brief
+		*    Returns the number of pending streaming requests
+		*
+		*  @return
+		*    The number of mipmap load requests which are queued or currently loaded
+		*/
+		inline PLCore::uint32 GetNumOfStreamingRequests() const;
+
+		/**
+		*  @brief
+		*    Updates the texture streaming
+		*
+		*  @remarks
+		*    Takes over the mipmaps loaded by the background thread and issues new load requests by using the
+		*    texture usage reported since the previous call. Called once per frame by 'RendererContext::Update()'.
+		*/
+		PLRENDERER_API void UpdateStreaming();
+
 
 	//[-------------------------------------------------------]
 	//[ Private functions                                     ]
@@ -258,6 +393,102 @@ class TextureManager : public PLCore::ResourceManager<Texture> {
 		*/
 		virtual ~TextureManager();
 
+		/**
+		*  @brief
+		*    Adds a streamed texture
+		*
+		*  @param[in] cTexture
+		*    Texture which has just been loaded with its low resolution mipmaps
+		*/
+		void AddStreamedTexture(Texture &cTexture);
+
+		/**
+		*  @brief
+		*    Removes a streamed texture and cancels its pending requests
+		*
+		*  @param[in] cTexture
+		*    Streamed texture to remove
+		*/
+		void RemoveStreamedTexture(Texture &cTexture);
+
+		/**
+		*  @brief
+		*    Requests the loading of a mipmap of a streamed texture
+		*
+		*  @param[in] cTexture
+		*    Streamed texture without a pending request
+		*  @param[in] nMipmap
+		*    Mipmap the high resolution texture buffer should start with
+		*  @param[in] nGrowth
+		*    Estimated number of bytes the resident bytes will grow by
+		*/
+		void RequestStreamingMipmap(Texture &cTexture, PLCore::uint32 nMipmap, PLCore::uint64 nGrowth);
+
+		/**
+		*  @brief
+		*    Cancels the pending requests of a streamed texture
+		*
+		*  @param[in] cTexture
+		*    Streamed texture to cancel the requests of
+		*/
+		void CancelStreamingRequests(Texture &cTexture);
+
+		/**
+		*  @brief
+		*    Evicts the high resolution mipmaps of the least recently used textures until the given number of bytes fits into the budget
+		*
+		*  @param[in] nBytes
+		*    Number of bytes which should fit into the budget in addition to the currently resident bytes
+		*  @param[in] pExclude
+		*    Texture which must not be evicted, can be a null pointer
+		*
+		*  @return
+		*    'true' if the given number of bytes fits into the budget, else 'false'
+		*
+		*  @note
+		*    - Only textures which were not used within the current frame are evicted
+		*/
+		bool EvictStreamedTextures(PLCore::uint64 nBytes, const Texture *pExclude);
+
+		/**
+		*  @brief
+		*    Starts the streaming background thread
+		*/
+		void StartStreamingThread();
+
+		/**
+		*  @brief
+		*    Stops the streaming background thread
+		*
+		*  @note
+		*    - Blocks until the currently loaded mipmap is loaded
+		*/
+		void StopStreamingThread();
+
+
+	//[-------------------------------------------------------]
+	//[ Private static functions                              ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Background thread function loading the requested mipmaps
+		*
+		*  @param[in] pData
+		*    Texture manager instance, must be valid
+		*
+		*  @return
+		*    Thread exit code, always 0
+		*/
+		static int StreamingThreadFunction(void *pData);
+
+
+	//[-------------------------------------------------------]
+	//[ Private structures                                    ]
+	//[-------------------------------------------------------]
+	private:
+		struct StreamingRequest;
+
 
 	//[-------------------------------------------------------]
 	//[ Private data                                          ]
@@ -268,6 +499,22 @@ class TextureManager : public PLCore::ResourceManager<Texture> {
 		bool			 m_bTextureFitLower;			/**< Take the next lower valid texture size? */
 		bool			 m_bTextureMipmapsAllowed;		/**< Are texture mipmaps allowed? Default is 'true'. */
 		bool			 m_bTextureCompressionAllowed;	/**< Is texture compression allowed? Default is 'true'. */
+		bool			 m_bTextureCompressionOnLoad;	/**< Are uncompressed images compressed on load? Default is 'false'. */
+		PLGraphics::ECompressionQuality m_nTextureCompressionQuality;	/**< Quality used when compressing images on load, default is 'PLGraphics::CompressionQualityFast' */
+		// Mip streaming
+		PLCore::uint64						m_nStreamingBudget;			/**< Maximum number of bytes the texture buffers of streamed textures may use, 0 if streaming is disabled */
+		PLCore::uint64						m_nStreamingMemoryUsage;	/**< Number of bytes the texture buffers of streamed textures are using */
+		PLCore::uint64						m_nStreamingPendingBytes;	/**< Estimated number of bytes the pending requests will add */
+		PLCore::uint32						m_nStreamingFrame;			/**< Current streaming frame */
+		PLCore::Array<Texture*>				m_lstStreamedTextures;		/**< Streamed textures */
+		PLCore::Array<StreamingRequest*>	m_lstStreamingRequests;		/**< Pending requests, only accessed by the main thread */
+		PLCore::Thread					   *m_pStreamingThread;			/**< Background thread, can be a null pointer */
+		PLCore::Mutex					   *m_pStreamingMutex;			/**< Mutex guarding the data shared with the background thread (always valid!) */
+		PLCore::Semaphore				   *m_pStreamingSemaphore;		/**< Semaphore counting the requests for the background thread (always valid!) */
+		// Shared with the background thread
+		PLCore::Array<StreamingRequest*>	m_lstStreamingQueue;		/**< Requests waiting to be loaded */
+		PLCore::Array<StreamingRequest*>	m_lstStreamingLoaded;		/**< Requests which have been loaded */
+		bool								m_bStreamingShutdown;		/**< Shall the background thread stop? */
 
 
 	//[-------------------------------------------------------]
@@ -103,6 +103,78 @@ inline void TextureManager::SetTextureCompressionAllowed(bool bAllowed)
 	m_bTextureCompressionAllowed = bAllowed;
 }
 
+/**
+*  @brief
+*    Returns whether or not uncompressed images are compressed on load
+*/
+inline bool TextureManager::IsTextureCompressionOnLoad() const
+{
+	return m_bTextureCompressionOnLoad;
+}
+
+/**
+*  @brief
+*    Sets whether or not uncompressed images are compressed on load
+*/
+inline void TextureManager::SetTextureCompressionOnLoad(bool bOnLoad)
+{
+	m_bTextureCompressionOnLoad = bOnLoad;
+}
+
+/**
+*  @brief
+*    Returns the quality used when compressing images on load
+*/
+inline PLGraphics::ECompressionQuality TextureManager::GetTextureCompressionQuality() const
+{
+	return m_nTextureCompressionQuality;
+}
+
+/**
+*  @brief
+*    Sets the quality used when compressing images on load
+*/
+inline void TextureManager::SetTextureCompressionQuality(PLGraphics::ECompressionQuality nQuality)
+{
+	m_nTextureCompressionQuality = nQuality;
+}
+
+/**
+*  @brief
+*    Returns the texture streaming budget
+*/
+inline PLCore::uint64 TextureManager::GetStreamingBudget() const
+{
+	return m_nStreamingBudget;
+}
+
+/**
+*  @brief
+*    Returns the number of bytes the texture buffers of streamed textures are currently using
+*/
+inline PLCore::uint64 TextureManager::GetStreamingMemoryUsage() const
+{
+	return m_nStreamingMemoryUsage;
+}
+
+/**
+*  @brief
+*    Returns the current streaming frame
+*/
+inline PLCore::uint32 TextureManager::GetStreamingFrame() const
+{
+	return m_nStreamingFrame;
+}
+
+/**
+*  @brief
+*    Returns the number of pending streaming requests
+*/
+inline PLCore::uint32 TextureManager::GetNumOfStreamingRequests() const
+{
+	return m_lstStreamingRequests.GetNumOfElements();
+}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
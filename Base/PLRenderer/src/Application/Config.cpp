@@ -65,6 +65,7 @@ pl_class_metadata(Config, "PLRenderer", PLRenderer::ConfigGroup, "Renderer confi
 	pl_attribute_metadata(TextureQuality,					float,								1.0f,								ReadWrite,	"Texture quality",																																															"Min='0.0' Max='1.0'")
 	pl_attribute_metadata(TextureMipmaps,					bool,								true,								ReadWrite,	"Use texture mipmaps by default?",																																											"")
 	pl_attribute_metadata(TextureCompression,				bool,								true,								ReadWrite,	"Use texture compression by default?",																																										"")
+	pl_attribute_metadata(ProgramCache,						bool,								true,								ReadWrite,	"Cache the generated shader programs across application runs? (requires an application data subdirectory)",																									"")
 pl_class_metadata_end(Config)
 
 
@@ -139,7 +140,8 @@ Config::Config() :
 	UseExtensions(this),
 	TextureQuality(this),
 	TextureMipmaps(this),
-	TextureCompression(this)
+	TextureCompression(this),
+	ProgramCache(this)
 {
 }
 
@@ -178,7 +180,8 @@ Config::Config(const Config &cSource) :
 	UseExtensions(this),
 	TextureQuality(this),
 	TextureMipmaps(this),
-	TextureCompression(this)
+	TextureCompression(this),
+	ProgramCache(this)
 {
 	// No implementation because the copy constructor is never used
 }
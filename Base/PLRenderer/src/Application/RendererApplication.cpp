@@ -27,6 +27,7 @@
 //[-------------------------------------------------------]
 #include <PLCore/Log/Log.h>
 #include <PLCore/Config/Config.h>
+#include <PLCore/System/System.h>
 #include "PLRenderer/RendererContext.h"
 #include "PLRenderer/Renderer/Surface.h"
 #include "PLRenderer/Renderer/FontManager.h"
@@ -280,6 +281,10 @@ void RendererApplication::OnCreateRendererContext()
 		cTextureManager.SetTextureQuality			(GetConfig().GetVar("PLRenderer::Config", "TextureQuality").GetFloat());
 		cTextureManager.SetTextureMipmapsAllowed	(GetConfig().GetVar("PLRenderer::Config", "TextureMipmaps").GetBool());
 		cTextureManager.SetTextureCompressionAllowed(GetConfig().GetVar("PLRenderer::Config", "TextureCompression").GetBool());
+
+		// Cache the generated shader programs within the user data directory, so they're generated at once on the next run instead of during rendering
+		if (GetConfig().GetVar("PLRenderer::Config", "ProgramCache").GetBool() && GetAppDataSubdir().GetLength())
+			m_pRendererContext->SetProgramCacheDirectory(System::GetInstance()->GetUserDataDir() + '/' + GetAppDataSubdir() + "/ProgramCache");
 	}
 }
 
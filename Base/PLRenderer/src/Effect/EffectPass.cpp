@@ -102,9 +102,8 @@ bool EffectPass::Bind(ParameterManager *pParameterManager)
 					const Parameter *pParameter = GetTechnique().GetEffect().GetParameterManager().GetParameter(i);
 					if (pParameter && pParameter->GetType() != Parameters::TextureBuffer) {
 						// Already set by the given parameter manager?
-						const String sName = pParameter->GetName();
-						if (!pParameterManager->IsParameter(sName))
-							pParameter->SetManagerParameterValue(*pProgram, sName);
+						if (!pParameterManager->IsParameter(pParameter->GetID()))
+							pParameter->SetManagerParameterValue(*pProgram, pParameter->GetName());
 					}
 				}
 			} else {
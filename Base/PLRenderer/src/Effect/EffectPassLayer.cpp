@@ -63,8 +63,8 @@ bool EffectPassLayer::Bind(uint32 nStage, ParameterManager *pParameterManager) c
 	Renderer &cRenderer = cEffect.GetEffectManager().GetRendererContext().GetRenderer();
 
 	// Bind texture
-	if (!pParameterManager || !BindTexture(pParameterManager->GetParameter(m_sTexture), nStage))
-		BindTexture(cEffect.GetParameterManager().GetParameter(m_sTexture), nStage);
+	if (!pParameterManager || !BindTexture(pParameterManager->GetParameter(m_cTextureID), nStage))
+		BindTexture(cEffect.GetParameterManager().GetParameter(m_cTextureID), nStage);
 
 	// Set sampler states
 	for (uint32 i=0; i<Sampler::Number; i++)
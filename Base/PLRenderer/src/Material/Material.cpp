@@ -128,6 +128,32 @@ Parameter *Material::GetParameter(const String &sName) const
 	}
 }
 
+/**
+*  @brief
+*    Gets a material/effect parameter by interned name
+*/
+Parameter *Material::GetParameter(const ParameterID &cID) const
+{
+	// Get the parameter
+	Parameter *pParameter = m_pParameterManager->GetParameter(cID);
+	if (pParameter)
+		return pParameter;
+	else {
+		// Check materials
+		for (uint32 i=0; i<m_lstMaterials.GetNumOfElements(); i++) {
+			const Material *pMaterial = m_lstMaterials.Get(i)->GetResource();
+			if (pMaterial) {
+				pParameter = pMaterial->GetParameter(cID);
+				if (pParameter)
+					return pParameter;
+			}
+		}
+
+		// Check effect
+		return GetEffect() ? GetEffect()->GetParameterManager().GetParameter(cID) : nullptr;
+	}
+}
+
 /**
 *  @brief
 *    Gets a texture buffer
@@ -147,6 +173,25 @@ TextureBuffer *Material::GetParameterTextureBuffer(const String &sName) const
 	return nullptr;
 }
 
+/**
+*  @brief
+*    Gets a texture buffer by interned name
+*/
+TextureBuffer *Material::GetParameterTextureBuffer(const ParameterID &cID) const
+{
+	// Get the parameter
+	const Parameter *pParameter = GetParameter(cID);
+	if (pParameter) {
+		// Get the texture
+		const Texture *pTexture = pParameter->GetValueTexture();
+		if (pTexture)
+			return pTexture->GetTextureBuffer();
+	}
+
+	// Error!
+	return nullptr;
+}
+
 /**
 *  @brief
 *    Reloads all textures used direct or indirect by the material
@@ -210,6 +255,43 @@ bool Material::ReloadTextures()
 	return bResult;
 }
 
+/**
+*  @brief
+*    Reports the usage of all textures used direct or indirect by the material within the current frame
+*/
+void Material::ReportTextureUsage(float fScreenSize) const
+{
+	// Loop through all parameters
+	for (uint32 i=0; i<m_pParameterManager->GetNumOfParameters(); i++) {
+		const Parameter *pParameter = m_pParameterManager->GetParameter(i);
+		if (pParameter->GetType() == ParameterManager::TextureBuffer) {
+			Texture *pTexture = pParameter->GetValueTexture();
+			if (pTexture)
+				pTexture->ReportUsage(fScreenSize);
+		}
+	}
+
+	// Loop through all parameters of the used effect
+	const Effect *pFX = GetEffect();
+	if (pFX) {
+		for (uint32 i=0; i<pFX->GetParameterManager().GetNumOfParameters(); i++) {
+			const Parameter *pParameter = pFX->GetParameterManager().GetParameter(i);
+			if (pParameter->GetType() == ParameterManager::TextureBuffer) {
+				Texture *pTexture = pParameter->GetValueTexture();
+				if (pTexture)
+					pTexture->ReportUsage(fScreenSize);
+			}
+		}
+	}
+
+	// Loop through all sub-materials
+	for (uint32 i=0; i<m_lstMaterials.GetNumOfElements(); i++) {
+		const Material *pMaterial = m_lstMaterials[i]->GetResource();
+		if (pMaterial)
+			pMaterial->ReportTextureUsage(fScreenSize);
+	}
+}
+
 /**
 *  @brief
 *    Adds a material
@@ -394,6 +476,16 @@ void Material::OnParameterChanged(Parameter &cParameter)
 }
 
 
+//[-------------------------------------------------------]
+//[ Public virtual PLCore::Resource functions             ]
+//[-------------------------------------------------------]
+uint64 Material::GetCPUMemoryUsage() const
+{
+	// Parameters and sub-materials, used textures and effects are resources on their own
+	return sizeof(Material) + m_pParameterManager->GetNumOfParameters()*sizeof(Parameter) + m_lstMaterials.GetNumOfElements()*sizeof(MaterialHandler);
+}
+
+
 //[-------------------------------------------------------]
 //[ Public virtual PLCore::Loadable functions             ]
 //[-------------------------------------------------------]
@@ -249,8 +249,12 @@ bool Parameter::SetName(const PLCore::String &sName)
 
 		// Is there already a parameter with the given name inside the parameter manager this parameter is in?
 		if (!m_pManager->GetParameter(sName)) {
-			// Set the new name
+			// Set the new name and update the parameter lookup of the parameter manager
+			m_pManager->m_mapParameters.Remove(m_sName);
 			m_sName = sName;
+			m_cID   = ParameterID(sName);
+			m_pManager->m_mapParameters.Add(m_sName, this);
+			m_pManager->m_lstParameterIDs[m_pManager->m_lstParameters.GetIndex(this)] = m_cID.GetID();
 
 			// Inform the parameter manager about the change
 			m_pManager->OnParameterChange(*this);
@@ -902,7 +906,9 @@ bool Parameter::SetValueTexture(const PLCore::String &sFilename)
 Parameter::Parameter(ParameterManager &cManager, Parameters::EDataType nType, const PLCore::String &sName) :
 	m_pManager(&cManager),
 	m_nType(nType),
-	m_sName(sName)
+	m_sName(sName),
+	m_cID(sName),
+	m_nParameterBlockOffset(-1)
 {
 	switch (m_nType) {
 		case Parameters::String:
@@ -924,7 +930,7 @@ Parameter::Parameter(ParameterManager &cManager, Parameters::EDataType nType, co
 			m_pValue = new int[3];
 			static_cast<int*>(m_pValue)[0] = 0;
 			static_cast<int*>(m_pValue)[1] = 0;
-			static_cast<int*>(m_pValue)[3] = 0;
+			static_cast<int*>(m_pValue)[2] = 0;
 			break;
 
 		case Parameters::Integer4:
@@ -0,0 +1,139 @@
+/*********************************************************\
+ *  File: ParameterID.cpp                                *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <PLCore/Container/Array.h>
+#include <PLCore/Container/HashMap.h>
+#include <PLCore/System/CriticalSection.h>
+#include "PLRenderer/Material/ParameterID.h"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+using namespace PLCore;
+namespace PLRenderer {
+
+
+//[-------------------------------------------------------]
+//[ Global helper functions                               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Global parameter name table
+*/
+struct ParameterNameTable {
+	CriticalSection			cCriticalSection;	/**< Critical section guarding the table */
+	HashMap<String, uint32>	mapIDs;				/**< Parameter name -> ID, IDs are never "ParameterID::Invalid" */
+	Array<String>			lstNames;			/**< Parameter names, the ID is the index */
+};
+
+/**
+*  @brief
+*    Returns the global parameter name table
+*
+*  @return
+*    The global parameter name table
+*
+*  @note
+*    - The table is created on first use so that parameter IDs can be created during the
+*      initialization of static variables
+*/
+static ParameterNameTable &GetParameterNameTable()
+{
+	static ParameterNameTable cTable;
+	return cTable;
+}
+
+
+//[-------------------------------------------------------]
+//[ Public static functions                               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Returns the ID of a parameter name, the name is registered if required
+*/
+uint32 ParameterID::Intern(const String &sName)
+{
+	// Check parameter
+	if (!sName.GetLength())
+		return Invalid; // Error!
+
+	// Get the ID, register the name if it's not yet known
+	ParameterNameTable &cTable = GetParameterNameTable();
+	cTable.cCriticalSection.Lock();
+	uint32 nID = cTable.mapIDs.Get(sName);
+	if (nID == Invalid) {
+		// The first ID is "Invalid" and stands for the empty name
+		if (!cTable.lstNames.GetNumOfElements())
+			cTable.lstNames.Add("");
+
+		// Register the new name
+		nID = cTable.lstNames.GetNumOfElements();
+		cTable.lstNames.Add(sName);
+		cTable.mapIDs.Add(sName, nID);
+	}
+	cTable.cCriticalSection.Unlock();
+
+	// Done
+	return nID;
+}
+
+/**
+*  @brief
+*    Returns the parameter name of an ID
+*/
+String ParameterID::GetNameOfID(uint32 nID)
+{
+	ParameterNameTable &cTable = GetParameterNameTable();
+	cTable.cCriticalSection.Lock();
+	const String sName = cTable.lstNames[nID];	// Out of bounds returns an empty string
+	cTable.cCriticalSection.Unlock();
+	return sName;
+}
+
+/**
+*  @brief
+*    Returns the number of registered parameter names
+*/
+uint32 ParameterID::GetNumOfNames()
+{
+	ParameterNameTable &cTable = GetParameterNameTable();
+	cTable.cCriticalSection.Lock();
+	const uint32 nNumOfNames = cTable.lstNames.GetNumOfElements();
+	cTable.cCriticalSection.Unlock();
+
+	// Don't count the empty name of the invalid ID
+	return nNumOfNames ? nNumOfNames - 1 : 0;
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // PLRenderer
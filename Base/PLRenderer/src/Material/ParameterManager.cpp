@@ -41,6 +41,48 @@ using namespace PLCore;
 namespace PLRenderer {
 
 
+//[-------------------------------------------------------]
+//[ Global helper functions                               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Returns the size of a parameter value within the parameter block
+*
+*  @param[in] nType
+*    Parameter type
+*
+*  @return
+*    The size of the parameter value in bytes, 0 if the value is not within the parameter block
+*/
+static uint32 GetParameterBlockValueSize(Parameters::EDataType nType)
+{
+	switch (nType) {
+		case Parameters::Integer:	return sizeof(int);
+		case Parameters::Integer2:	return sizeof(int)*2;
+		case Parameters::Integer3:	return sizeof(int)*3;
+		case Parameters::Integer4:	return sizeof(int)*4;
+		case Parameters::Float:		return sizeof(float);
+		case Parameters::Float2:	return sizeof(float)*2;
+		case Parameters::Float3:	return sizeof(float)*3;
+		case Parameters::Float4:	return sizeof(float)*4;
+		case Parameters::Double:	return sizeof(double);
+		case Parameters::Double2:	return sizeof(double)*2;
+		case Parameters::Double3:	return sizeof(double)*3;
+		case Parameters::Double4:	return sizeof(double)*4;
+		case Parameters::Float3x3:	return sizeof(float)*3*3;
+		case Parameters::Float3x4:	return sizeof(float)*3*4;
+		case Parameters::Float4x4:	return sizeof(float)*4*4;
+		case Parameters::Double4x4:	return sizeof(double)*4*4;
+
+		case Parameters::String:
+		case Parameters::TextureBuffer:
+		case Parameters::UnknownDataType:
+		default:
+			return 0;
+	}
+}
+
+
 //[-------------------------------------------------------]
 //[ Public functions                                      ]
 //[-------------------------------------------------------]
@@ -62,8 +104,12 @@ Parameter *ParameterManager::CreateParameter(EDataType nType, const PLCore::Stri
 	// Create the new parameter
 	pParameter = new Parameter(*this, nType, sName);
 	m_lstParameters.Add(pParameter);
+	m_lstParameterIDs.Add(pParameter->m_cID.GetID());
 	m_mapParameters.Add(sName, pParameter);
 
+	// The new parameter needs room within the parameter block
+	m_bParameterBlockLayoutDirty = true;
+
 	// Return the created parameter
 	return pParameter;
 }
@@ -151,9 +197,11 @@ bool ParameterManager::RemoveParameter(uint32 nIndex)
 		return false; // Error!
 
 	// Remove
-	m_lstParameters.Remove(pParameter);
+	m_lstParameters.RemoveAtIndex(nIndex);
+	m_lstParameterIDs.RemoveAtIndex(nIndex);
 	m_mapParameters.Remove(pParameter->m_sName);
 	delete pParameter;
+	m_bParameterBlockLayoutDirty = true;
 
 	// Done
 	return true;
@@ -171,9 +219,12 @@ bool ParameterManager::RemoveParameter(const PLCore::String &sName)
 		return false; // Error!
 
 	// Remove
-	m_lstParameters.Remove(pParameter);
+	const int nIndex = m_lstParameters.GetIndex(pParameter);
+	m_lstParameters.RemoveAtIndex(nIndex);
+	m_lstParameterIDs.RemoveAtIndex(nIndex);
 	delete pParameter;
 	m_mapParameters.Remove(sName);
+	m_bParameterBlockLayoutDirty = true;
 
 	// Done
 	return true;
@@ -188,7 +239,56 @@ void ParameterManager::RemoveAllParameters()
 	for (uint32 i=0; i<m_lstParameters.GetNumOfElements(); i++)
 		delete m_lstParameters[i];
 	m_lstParameters.Clear();
+	m_lstParameterIDs.Clear();
 	m_mapParameters.Clear();
+	m_bParameterBlockLayoutDirty = true;
+}
+
+/**
+*  @brief
+*    Returns the parameter block
+*/
+const uint8 *ParameterManager::GetParameterBlock() const
+{
+	// Update the layout of the parameter block, if required
+	if (m_bParameterBlockLayoutDirty)
+		UpdateParameterBlockLayout();
+
+	// Return the parameter block
+	return m_nParameterBlockSize ? m_pParameterBlock : nullptr;
+}
+
+/**
+*  @brief
+*    Returns the size of the parameter block
+*/
+uint32 ParameterManager::GetParameterBlockSize() const
+{
+	// Update the layout of the parameter block, if required
+	if (m_bParameterBlockLayoutDirty)
+		UpdateParameterBlockLayout();
+
+	// Return the size of the parameter block
+	return m_nParameterBlockSize;
+}
+
+/**
+*  @brief
+*    Returns the offset of a parameter value within the parameter block
+*/
+int ParameterManager::GetParameterBlockOffset(const ParameterID &cID) const
+{
+	// Get the parameter
+	const Parameter *pParameter = GetParameter(cID);
+	if (!pParameter)
+		return -1; // Error!
+
+	// Update the layout of the parameter block, if required
+	if (m_bParameterBlockLayoutDirty)
+		UpdateParameterBlockLayout();
+
+	// Return the offset of the parameter value
+	return pParameter->m_nParameterBlockOffset;
 }
 
 
@@ -200,7 +300,11 @@ void ParameterManager::RemoveAllParameters()
 *    Constructor
 */
 ParameterManager::ParameterManager(RendererContext &cRendererContext) :
-	m_pRendererContext(&cRendererContext)
+	m_pRendererContext(&cRendererContext),
+	m_pParameterBlock(nullptr),
+	m_nParameterBlockSize(0),
+	m_nParameterBlockCapacity(0),
+	m_bParameterBlockLayoutDirty(false)
 {
 }
 
@@ -211,6 +315,51 @@ ParameterManager::ParameterManager(RendererContext &cRendererContext) :
 ParameterManager::~ParameterManager()
 {
 	RemoveAllParameters();
+	if (m_pParameterBlock)
+		delete [] m_pParameterBlock;
+}
+
+/**
+*  @brief
+*    Updates the layout of the parameter block
+*/
+void ParameterManager::UpdateParameterBlockLayout() const
+{
+	// Assign an offset to each numeric parameter, each value starts at a 16 byte boundary
+	const uint32 nNumOfParameters = m_lstParameters.GetNumOfElements();
+	uint32 nSize = 0;
+	for (uint32 i=0; i<nNumOfParameters; i++) {
+		Parameter *pParameter = m_lstParameters[i];
+		const uint32 nValueSize = GetParameterBlockValueSize(pParameter->m_nType);
+		if (nValueSize) {
+			pParameter->m_nParameterBlockOffset = nSize;
+			nSize += (nValueSize + 15) & ~15;
+		} else {
+			pParameter->m_nParameterBlockOffset = -1;
+		}
+	}
+
+	// Enlarge the parameter block, if required
+	if (m_nParameterBlockCapacity < nSize) {
+		if (m_pParameterBlock)
+			delete [] m_pParameterBlock;
+		m_pParameterBlock		  = new uint8[nSize];
+		m_nParameterBlockCapacity = nSize;
+	}
+	m_nParameterBlockSize = nSize;
+
+	// Copy the current parameter values into the parameter block
+	if (nSize) {
+		MemoryManager::Set(m_pParameterBlock, 0, nSize);
+		for (uint32 i=0; i<nNumOfParameters; i++) {
+			const Parameter *pParameter = m_lstParameters[i];
+			if (pParameter->m_nParameterBlockOffset >= 0)
+				MemoryManager::Copy(&m_pParameterBlock[pParameter->m_nParameterBlockOffset], pParameter->m_pValue, GetParameterBlockValueSize(pParameter->m_nType));
+		}
+	}
+
+	// The layout is now up-to-date
+	m_bParameterBlockLayoutDirty = false;
 }
 
 
@@ -265,6 +414,17 @@ bool ParameterManager::ReloadTextures() const
 */
 void ParameterManager::OnParameterChange(Parameter &cParameter) const
 {
+	// Keep the parameter block up-to-date
+	if (!m_bParameterBlockLayoutDirty) {
+		if (cParameter.m_nParameterBlockOffset >= 0) {
+			// Write the new value directly into the parameter block
+			MemoryManager::Copy(&m_pParameterBlock[cParameter.m_nParameterBlockOffset], cParameter.m_pValue, GetParameterBlockValueSize(cParameter.m_nType));
+		} else if (GetParameterBlockValueSize(cParameter.m_nType)) {
+			// New numeric parameter, the layout has to be updated
+			m_bParameterBlockLayoutDirty = true;
+		}
+	}
+
 	// Emit event
 	EventParameterChanged(cParameter);
 }
@@ -25,11 +25,14 @@
 //[-------------------------------------------------------]
 //[ Includes                                              ]
 //[-------------------------------------------------------]
-#include <PLMath/Rectangle.h>
+#include <PLCore/Core/MemoryManager.h>
+#include <PLMath/Math.h>
+#include <PLMath/Vector4.h>
 #include <PLMath/Matrix4x4.h>
 #include "PLRenderer/Renderer/Font.h"
-#include "PLRenderer/Renderer/Renderer.h"
 #include "PLRenderer/Renderer/VertexBuffer.h"
+#include "PLRenderer/Renderer/SamplerStates.h"
+#include "PLRenderer/Renderer/Backend/RendererBackend.h"
 #include "PLRenderer/Renderer/Backend/DrawHelpersBackend.h"
 
 
@@ -54,6 +57,16 @@ DrawHelpersBackend::~DrawHelpersBackend()
 	// Destroy the internal temp vertex buffer
 	if (m_pTempVertexBuffer)
 		delete m_pTempVertexBuffer;
+
+	// Destroy the batch vertex buffer ring
+	for (uint32 i=0; i<NumOfBatchVertexBuffers; i++) {
+		if (m_pBatchVertexBuffers[i])
+			delete m_pBatchVertexBuffers[i];
+	}
+
+	// Destroy the batches, batched primitives which were not drawn yet are discarded
+	for (uint32 i=0; i<m_lstBatches.GetNumOfElements(); i++)
+		delete m_lstBatches[i];
 }
 
 
@@ -95,6 +108,97 @@ const Matrix4x4 &DrawHelpersBackend::GetObjectSpaceToClipSpaceMatrix() const
 	return m_mObjectSpaceToClipSpace;
 }
 
+void DrawHelpersBackend::BeginBatch()
+{
+	m_nBatchLevel++;
+}
+
+void DrawHelpersBackend::EndBatch()
+{
+	if (m_nBatchLevel) {
+		m_nBatchLevel--;
+
+		// Draw the batched primitives when leaving the outermost batch
+		if (!IsBatching())
+			Flush();
+	}
+}
+
+bool DrawHelpersBackend::IsBatching() const
+{
+	return (m_b2DMode || m_nBatchLevel);
+}
+
+void DrawHelpersBackend::Flush()
+{
+	// Anything to draw?
+	const uint32 nNumOfBatches = m_nNumOfBatches;
+	if (nNumOfBatches) {
+		// Mark the batches as drawn right now, drawing them must never add new ones
+		m_nNumOfBatches = 0;
+
+		// Backup the current renderer states
+		BatchStates sCurrentStates;
+		ReadBatchStates(sCurrentStates);
+
+		// Copy the vertices of all primitive batches into the next vertex buffer of the ring by using a single lock
+		uint32 nNumOfVertices = 0;
+		for (uint32 i=0; i<nNumOfBatches; i++) {
+			const Batch &sBatch = *m_lstBatches[i];
+			if (!sBatch.sKey.pFont)
+				nNumOfVertices += sBatch.lstVertices.GetNumOfElements();
+		}
+		VertexBuffer *pVertexBuffer = nNumOfVertices ? GetBatchVertexBuffer(nNumOfVertices) : nullptr;
+		if (pVertexBuffer) {
+			if (pVertexBuffer->Lock(Lock::WriteOnly)) {
+				BatchVertex *pVertex = static_cast<BatchVertex*>(pVertexBuffer->GetData());
+				for (uint32 i=0; i<nNumOfBatches; i++) {
+					const Batch &sBatch = *m_lstBatches[i];
+					if (!sBatch.sKey.pFont) {
+						MemoryManager::Copy(pVertex, sBatch.lstVertices.GetData(), sBatch.lstVertices.GetNumOfElements()*sizeof(BatchVertex));
+						pVertex += sBatch.lstVertices.GetNumOfElements();
+					}
+				}
+				pVertexBuffer->Unlock();
+			} else {
+				pVertexBuffer = nullptr;
+			}
+		}
+
+		// Draw the batches in order
+		uint32 nNumOfDrawnBatches = 0;
+		uint32 nStartVertex = 0;
+		for (uint32 i=0; i<nNumOfBatches; i++) {
+			Batch &sBatch = *m_lstBatches[i];
+
+			// Set the renderer states the primitives were recorded with
+			WriteBatchStates(m_lstBatchStates[sBatch.sKey.nStates]);
+
+			// Draw the batch
+			if (sBatch.sKey.pFont) {
+				sBatch.sKey.pFont->DrawGlyphVertices(sBatch.lstVertices);
+				nNumOfDrawnBatches++;
+			} else {
+				if (pVertexBuffer && DrawPrimitiveBatch(sBatch, *pVertexBuffer, nStartVertex))
+					nNumOfDrawnBatches++;
+				nStartVertex += sBatch.lstVertices.GetNumOfElements();
+			}
+
+			// Keep the memory, the next batches are going to need it, too
+			sBatch.lstVertices.Reset();
+		}
+		m_lstBatchStates.Reset();
+
+		// Restore the renderer states
+		WriteBatchStates(sCurrentStates);
+
+		// Update the statistics
+		Statistics &sStatistics = static_cast<RendererBackend*>(m_pRenderer)->GetWritableStatistics();
+		sStatistics.nDrawHelpersBatches += nNumOfDrawnBatches;
+		sStatistics.nDrawHelpersFlushes++;
+	}
+}
+
 void DrawHelpersBackend::DrawText(Font &cFont, const String &sText, const Color4 &cColor, const Vector2 &vPosition, uint32 nFlags, const Vector2 &vScale, const Vector2 &vBias)
 {
 	// Is there any text to draw?
@@ -179,8 +283,30 @@ void DrawHelpersBackend::DrawText(Font &cFont, const String &sText, const Color4
 		if (nFlags & Font::CenterText)
 			vFontBias.x -= cFont.GetTextWidth(sText)/2;
 
-		// Draw the text
-		cFont.Draw(sText, cColor, mTransform, Vector2(fClipSpaceFontWidth/nFontHeightInPixels, fClipSpaceFontHeight/nFontHeightInPixels)*vScale, vFontBias);
+		const Vector2 vFontScale = Vector2(fClipSpaceFontWidth/nFontHeightInPixels, fClipSpaceFontHeight/nFontHeightInPixels)*vScale;
+
+		// Get the glyph quads of the text, if the font doesn't support this, draw the text right now
+		m_lstTempVertices.Reset();
+		if (cFont.AddGlyphVertices(m_lstTempVertices, sText, cColor, mTransform, vFontScale, vFontBias)) {
+			// Glyphs are drawn with blending, when batching this becomes part of the recorded renderer states
+			m_pRenderer->SetRenderState(RenderState::BlendEnable, true);
+
+			if (IsBatching()) {
+				// Add the glyph quads to the batches
+				BatchKey sKey;
+				MemoryManager::Set(&sKey, 0, sizeof(BatchKey));
+				sKey.pFont		= &cFont;
+				sKey.nPrimitive	= Primitive::TriangleList;
+				AddVerticesToBatch(sKey, m_lstTempVertices.GetData(), m_lstTempVertices.GetNumOfElements());
+			} else {
+				// Draw at once
+				cFont.DrawGlyphVertices(m_lstTempVertices);
+			}
+		} else {
+			// Draw the batched primitives first to keep the draw order
+			Flush();
+			cFont.Draw(sText, cColor, mTransform, vFontScale, vFontBias);
+		}
 	}
 }
 
@@ -344,9 +470,14 @@ DrawHelpersBackend::DrawHelpersBackend(Renderer &cRenderer) :
 	m_pRenderer(&cRenderer),
 	m_pTempVertexBuffer(nullptr),
 	m_b2DMode(false),
-	m_fZValue2D(0.0f)
+	m_fZValue2D(0.0f),
+	m_nBatchLevel(0),
+	m_nNumOfBatches(0),
+	m_nBatchVertexBuffer(0)
 {
 	m_fVirtualScreen[0] = m_fVirtualScreen[1] = m_fVirtualScreen[2] = m_fVirtualScreen[3] = 0.0f;
+	for (uint32 i=0; i<NumOfBatchVertexBuffers; i++)
+		m_pBatchVertexBuffers[i] = nullptr;
 }
 
 /**
@@ -372,6 +503,295 @@ bool DrawHelpersBackend::CreateTempBuffes()
 	return true;
 }
 
+/**
+*  @brief
+*    Adds a primitive to the batches if primitives are currently batched
+*/
+bool DrawHelpersBackend::AddToBatch(Primitive::Enum nPrimitive, const Vector3 *pvPositions, uint32 nNumOfVertices, const Matrix4x4 &mObjectSpaceToClipSpace,
+									const Color4 &cColor, const Color4 *pcVertexColors, float fSize, TextureBuffer *pTextureBuffer,
+									const SamplerStates *pSamplerStates, float fAlphaReference, const Vector2 *pvTexCoords)
+{
+	// Are primitives currently batched?
+	if (!IsBatching())
+		return false;
+
+	// Setup the batch key, strips are converted into lists so that they can be batched
+	BatchKey sKey;
+	MemoryManager::Set(&sKey, 0, sizeof(BatchKey));
+	switch (nPrimitive) {
+		case Primitive::PointList:
+		case Primitive::LineList:
+			sKey.nPrimitive = nPrimitive;
+			sKey.fSize		= fSize;
+			break;
+
+		case Primitive::TriangleList:
+		case Primitive::TriangleStrip:
+			sKey.nPrimitive = Primitive::TriangleList;
+			break;
+
+		case Primitive::LineStrip:
+		case Primitive::TriangleFan:
+		case Primitive::Number:
+		case Primitive::Unknown:
+		default:
+			return false; // Error, not supported!
+	}
+	if (pTextureBuffer) {
+		sKey.pTextureBuffer = pTextureBuffer;
+		for (uint32 nState=0; nState<Sampler::Number; nState++)
+			sKey.nSamplerState[nState] = pSamplerStates->Get(static_cast<Sampler::Enum>(nState));
+		sKey.fAlphaReference = fAlphaReference;
+	}
+
+	// Transform the vertices into clip space, triangle strips are converted into triangle lists
+	const bool   bStrip				 = (nPrimitive == Primitive::TriangleStrip);
+	const uint32 nNumOfBatchVertices = bStrip ? ((nNumOfVertices > 2) ? (nNumOfVertices - 2)*3 : 0) : nNumOfVertices;
+	m_lstTempVertices.Reset();
+	for (uint32 i=0; i<nNumOfBatchVertices; i++) {
+		uint32 nVertex = i;
+		if (bStrip) {
+			// Every second triangle of a strip has a flipped winding order
+			const uint32 nTriangle = i/3;
+			const uint32 nCorner   = i%3;
+			nVertex = nTriangle + (((nTriangle & 1) && nCorner < 2) ? 1 - nCorner : nCorner);
+		}
+		BatchVertex &sVertex = m_lstTempVertices.Add();
+		const Vector4 vPosition = mObjectSpaceToClipSpace*Vector4(pvPositions[nVertex].x, pvPositions[nVertex].y, pvPositions[nVertex].z, 1.0f);
+		sVertex.fPosition[0] = vPosition.x;
+		sVertex.fPosition[1] = vPosition.y;
+		sVertex.fPosition[2] = vPosition.z;
+		sVertex.fPosition[3] = vPosition.w;
+		if (pTextureBuffer) {
+			sVertex.fTexCoord[0] = pvTexCoords[nVertex].x;
+			sVertex.fTexCoord[1] = pvTexCoords[nVertex].y;
+		} else {
+			sVertex.fTexCoord[0] = sVertex.fTexCoord[1] = 0.0f;
+		}
+		const Color4 &cVertexColor = pcVertexColors ? pcVertexColors[nVertex] : cColor;
+		sVertex.fColor[0] = cVertexColor.r;
+		sVertex.fColor[1] = cVertexColor.g;
+		sVertex.fColor[2] = cVertexColor.b;
+		sVertex.fColor[3] = cVertexColor.a;
+	}
+
+	// Add the vertices to the batches
+	if (nNumOfBatchVertices)
+		AddVerticesToBatch(sKey, m_lstTempVertices.GetData(), nNumOfBatchVertices);
+
+	// Done
+	return true;
+}
+
+
+//[-------------------------------------------------------]
+//[ Protected virtual DrawHelpersBackend functions        ]
+//[-------------------------------------------------------]
+bool DrawHelpersBackend::DrawPrimitiveBatch(const Batch &sBatch, VertexBuffer &cVertexBuffer, uint32 nStartVertex)
+{
+	// No default implementation
+	return false;
+}
+
+
+//[-------------------------------------------------------]
+//[ Protected DrawHelpersBackend::BatchKey functions      ]
+//[-------------------------------------------------------]
+bool DrawHelpersBackend::BatchKey::operator ==(const BatchKey &sOther) const
+{
+	return (pFont == sOther.pFont && nPrimitive == sOther.nPrimitive && fSize == sOther.fSize && pTextureBuffer == sOther.pTextureBuffer &&
+			MemoryManager::Compare(nSamplerState, sOther.nSamplerState, sizeof(nSamplerState)) == 0 && fAlphaReference == sOther.fAlphaReference &&
+			nStates == sOther.nStates);
+}
+
+
+//[-------------------------------------------------------]
+//[ Private DrawHelpersBackend::BatchStates functions     ]
+//[-------------------------------------------------------]
+bool DrawHelpersBackend::BatchStates::operator ==(const BatchStates &sOther) const
+{
+	return (MemoryManager::Compare(nRenderState, sOther.nRenderState, sizeof(nRenderState)) == 0 &&
+			cViewport.vMin == sOther.cViewport.vMin && cViewport.vMax == sOther.cViewport.vMax &&
+			fViewportMinZ == sOther.fViewportMinZ && fViewportMaxZ == sOther.fViewportMaxZ &&
+			cScissorRect.vMin == sOther.cScissorRect.vMin && cScissorRect.vMax == sOther.cScissorRect.vMax);
+}
+
+
+//[-------------------------------------------------------]
+//[ Private functions                                     ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Adds vertices to the batches
+*/
+void DrawHelpersBackend::AddVerticesToBatch(BatchKey sKey, const BatchVertex *pVertices, uint32 nNumOfVertices)
+{
+	// Record the renderer states
+	sKey.nStates = GetBatchStates();
+
+	// Get the normalized device coordinates bounds, vertices behind the viewer may cover everything
+	float fBounds[4] = { 1.0f, 1.0f, -1.0f, -1.0f };
+	for (uint32 i=0; i<nNumOfVertices; i++) {
+		const float *pfPosition = pVertices[i].fPosition;
+		if (pfPosition[3] > 0.0f) {
+			const float fX = pfPosition[0]/pfPosition[3];
+			const float fY = pfPosition[1]/pfPosition[3];
+			fBounds[0] = Math::Min(fBounds[0], fX);
+			fBounds[1] = Math::Min(fBounds[1], fY);
+			fBounds[2] = Math::Max(fBounds[2], fX);
+			fBounds[3] = Math::Max(fBounds[3], fY);
+		} else {
+			fBounds[0] = fBounds[1] = -1.0f;
+			fBounds[2] = fBounds[3] =  1.0f;
+			break;
+		}
+	}
+
+	// Points and lines have a size in pixels, one pixel is "2/<viewport size>" in normalized device coordinates
+	if (sKey.fSize > 0.0f) {
+		const Rectangle &cViewport = m_pRenderer->GetViewport();
+		const float fWidth  = cViewport.GetWidth();
+		const float fHeight = cViewport.GetHeight();
+		const float fExtentX = (fWidth  > 0.0f) ? sKey.fSize/fWidth  : 2.0f;
+		const float fExtentY = (fHeight > 0.0f) ? sKey.fSize/fHeight : 2.0f;
+		fBounds[0] -= fExtentX;
+		fBounds[1] -= fExtentY;
+		fBounds[2] += fExtentX;
+		fBounds[3] += fExtentY;
+	}
+
+	// Only the visible area matters
+	fBounds[0] = Math::Max(fBounds[0], -1.0f);
+	fBounds[1] = Math::Max(fBounds[1], -1.0f);
+	fBounds[2] = Math::Min(fBounds[2],  1.0f);
+	fBounds[3] = Math::Min(fBounds[3],  1.0f);
+
+	// Look back for a batch the vertices can be added to, a batch can't be used if a later batch overlaps
+	// the vertices because drawing them earlier than the later batch would change the visible result
+	Batch *pBatch = nullptr;
+	const uint32 nMinBatch = (m_nNumOfBatches > MaxBatchSearchDepth) ? m_nNumOfBatches - MaxBatchSearchDepth : 0;
+	for (uint32 i=m_nNumOfBatches; i>nMinBatch && !pBatch; i--) {
+		Batch &sBatch = *m_lstBatches[i - 1];
+		if (sBatch.sKey == sKey)
+			pBatch = &sBatch;
+		else if (fBounds[0] <= sBatch.fBounds[2] && fBounds[2] >= sBatch.fBounds[0] && fBounds[1] <= sBatch.fBounds[3] && fBounds[3] >= sBatch.fBounds[1])
+			break;
+	}
+
+	// Start a new batch if there's no batch the vertices can be added to
+	if (pBatch) {
+		pBatch->fBounds[0] = Math::Min(pBatch->fBounds[0], fBounds[0]);
+		pBatch->fBounds[1] = Math::Min(pBatch->fBounds[1], fBounds[1]);
+		pBatch->fBounds[2] = Math::Max(pBatch->fBounds[2], fBounds[2]);
+		pBatch->fBounds[3] = Math::Max(pBatch->fBounds[3], fBounds[3]);
+	} else {
+		if (m_nNumOfBatches == m_lstBatches.GetNumOfElements())
+			m_lstBatches.Add(new Batch);
+		pBatch = m_lstBatches[m_nNumOfBatches++];
+		pBatch->sKey = sKey;
+		MemoryManager::Copy(pBatch->fBounds, fBounds, sizeof(fBounds));
+	}
+
+	// Add the vertices
+	pBatch->lstVertices.Add(pVertices, nNumOfVertices);
+
+	// Update the statistics
+	static_cast<RendererBackend*>(m_pRenderer)->GetWritableStatistics().nDrawHelpersPrimitives++;
+}
+
+/**
+*  @brief
+*    Returns the index of the recorded renderer states matching the current ones
+*/
+uint32 DrawHelpersBackend::GetBatchStates()
+{
+	// Read the current renderer states
+	BatchStates sStates;
+	ReadBatchStates(sStates);
+
+	// The states usually only toggle between a few variants, so, search the recorded ones
+	for (uint32 i=m_lstBatchStates.GetNumOfElements(); i>0; i--) {
+		if (m_lstBatchStates[i - 1] == sStates)
+			return i - 1;
+	}
+
+	// Record the renderer states
+	m_lstBatchStates.Add(sStates);
+	return m_lstBatchStates.GetNumOfElements() - 1;
+}
+
+/**
+*  @brief
+*    Reads the current renderer states
+*/
+void DrawHelpersBackend::ReadBatchStates(BatchStates &sStates) const
+{
+	for (uint32 nState=0; nState<RenderState::Number; nState++)
+		sStates.nRenderState[nState] = m_pRenderer->GetRenderState(static_cast<RenderState::Enum>(nState));
+	sStates.cViewport    = m_pRenderer->GetViewport(&sStates.fViewportMinZ, &sStates.fViewportMaxZ);
+	sStates.cScissorRect = m_pRenderer->GetScissorRect();
+}
+
+/**
+*  @brief
+*    Sets renderer states, only changed states are passed to the renderer
+*/
+void DrawHelpersBackend::WriteBatchStates(const BatchStates &sStates)
+{
+	// Render states
+	for (uint32 nState=0; nState<RenderState::Number; nState++) {
+		const RenderState::Enum nRenderState = static_cast<RenderState::Enum>(nState);
+		if (static_cast<uint32>(m_pRenderer->GetRenderState(nRenderState)) != sStates.nRenderState[nState])
+			m_pRenderer->SetRenderState(nRenderState, sStates.nRenderState[nState]);
+	}
+
+	// Viewport
+	float fMinZ = 0.0f, fMaxZ = 1.0f;
+	const Rectangle &cViewport = m_pRenderer->GetViewport(&fMinZ, &fMaxZ);
+	if (cViewport.vMin != sStates.cViewport.vMin || cViewport.vMax != sStates.cViewport.vMax || fMinZ != sStates.fViewportMinZ || fMaxZ != sStates.fViewportMaxZ)
+		m_pRenderer->SetViewport(&sStates.cViewport, sStates.fViewportMinZ, sStates.fViewportMaxZ);
+
+	// Scissor rectangle
+	const Rectangle &cScissorRect = m_pRenderer->GetScissorRect();
+	if (cScissorRect.vMin != sStates.cScissorRect.vMin || cScissorRect.vMax != sStates.cScissorRect.vMax)
+		m_pRenderer->SetScissorRect(&sStates.cScissorRect);
+}
+
+/**
+*  @brief
+*    Returns the next vertex buffer of the batch vertex buffer ring
+*/
+VertexBuffer *DrawHelpersBackend::GetBatchVertexBuffer(uint32 nNumOfVertices)
+{
+	// Use the next vertex buffer of the ring so that the GPU can still read the previous ones while we're writing
+	m_nBatchVertexBuffer = (m_nBatchVertexBuffer + 1) % NumOfBatchVertexBuffers;
+	VertexBuffer *pVertexBuffer = m_pBatchVertexBuffers[m_nBatchVertexBuffer];
+	if (!pVertexBuffer) {
+		// Create the vertex buffer
+		pVertexBuffer = m_pRenderer->CreateVertexBuffer();
+		if (!pVertexBuffer)
+			return nullptr; // Error!
+		m_pBatchVertexBuffers[m_nBatchVertexBuffer] = pVertexBuffer;
+
+		// Add the vertex attributes, the layout is identical to "BatchVertex"
+		pVertexBuffer->AddVertexAttribute(VertexBuffer::Position, 0, VertexBuffer::Float4);
+		pVertexBuffer->AddVertexAttribute(VertexBuffer::TexCoord, 0, VertexBuffer::Float2);
+		pVertexBuffer->AddVertexAttribute(VertexBuffer::TexCoord, 1, VertexBuffer::Float4);	// The color semantic only supports the API dependent RGBA type
+	}
+
+	// Is the vertex buffer large enough? If not, reallocate it and give it some room to grow.
+	if (pVertexBuffer->GetNumOfElements() < nNumOfVertices) {
+		uint32 nNumOfElements = pVertexBuffer->GetNumOfElements() ? pVertexBuffer->GetNumOfElements() : 1024;
+		while (nNumOfElements < nNumOfVertices)
+			nNumOfElements *= 2;
+		if (!pVertexBuffer->Allocate(nNumOfElements, Usage::WriteOnly, false))
+			return nullptr; // Error!
+	}
+
+	// Return the vertex buffer, but only if the layout is the expected one
+	return (pVertexBuffer->GetVertexSize() == sizeof(BatchVertex)) ? pVertexBuffer : nullptr;
+}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
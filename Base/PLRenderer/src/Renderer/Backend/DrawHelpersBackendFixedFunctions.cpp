@@ -112,6 +112,10 @@ void DrawHelpersBackendFixedFunctions::End2DMode()
 {
 	// Is the 2D mode set?
 	if (m_b2DMode) {
+		// Draw the batched texts while the 2D mode is still active, unless there's still an outer batch
+		if (!m_nBatchLevel)
+			Flush();
+
 		// Fixed functions
 		FixedFunctions *pFixedFunctions = m_pRenderer->GetFixedFunctions();
 		if (pFixedFunctions) {
@@ -128,6 +132,9 @@ void DrawHelpersBackendFixedFunctions::End2DMode()
 void DrawHelpersBackendFixedFunctions::DrawImage(TextureBuffer &cTextureBuffer, SamplerStates &cSamplerStates, const Vector2 &vPos, const Vector2 &vSize, const Color4 &cColor, float fAlphaReference,
 												 const Vector2 &vTextureCoordinate, const Vector2 &vTextureCoordinateSize, const Matrix4x4 &mTexture)
 {
+	// Draw the batched texts first to keep the draw order
+	Flush();
+
 	// Create vertex buffer
 	if (CreateTempBuffes()) {
 		// Get the image size
@@ -256,6 +263,9 @@ void DrawHelpersBackendFixedFunctions::DrawImage(TextureBuffer &cTextureBuffer,
 void DrawHelpersBackendFixedFunctions::DrawImage(TextureBuffer &cTextureBuffer, SamplerStates &cSamplerStates, const Vector3 &vPos, const Matrix4x4 &mObjectSpaceToClipSpace, const Vector2 &vSize,
 												 const Color4 &cColor, float fAlphaReference, const Vector2 &vTextureCoordinate, const Vector2 &vTextureCoordinateSize, const Matrix4x4 &mTexture)
 {
+	// Draw the batched texts first to keep the draw order
+	Flush();
+
 	// Create vertex buffer
 	if (CreateTempBuffes()) {
 		// Get the image size
@@ -389,6 +399,9 @@ void DrawHelpersBackendFixedFunctions::DrawImage(TextureBuffer &cTextureBuffer,
 
 void DrawHelpersBackendFixedFunctions::DrawPoint(const Color4 &cColor, const Vector2 &vPosition, float fSize)
 {
+	// Draw the batched texts first to keep the draw order
+	Flush();
+
 	// Create vertex buffer
 	if (CreateTempBuffes()) {
 		// Setup the vertex buffer
@@ -430,6 +443,9 @@ void DrawHelpersBackendFixedFunctions::DrawPoint(const Color4 &cColor, const Vec
 
 void DrawHelpersBackendFixedFunctions::DrawPoint(const Color4 &cColor, const Vector3 &vPosition, const Matrix4x4 &mObjectSpaceToClipSpace, float fSize)
 {
+	// Draw the batched texts first to keep the draw order
+	Flush();
+
 	// Create vertex buffer
 	if (CreateTempBuffes()) {
 		// Setup the vertex buffer
@@ -477,6 +493,9 @@ void DrawHelpersBackendFixedFunctions::DrawPoint(const Color4 &cColor, const Vec
 
 void DrawHelpersBackendFixedFunctions::DrawLine(const Color4 &cColor, const Vector2 &vStartPosition, const Vector2 &vEndPosition, float fWidth)
 {
+	// Draw the batched texts first to keep the draw order
+	Flush();
+
 	// Create vertex buffer
 	if (CreateTempBuffes()) {
 		// Setup the vertex buffer
@@ -525,6 +544,9 @@ void DrawHelpersBackendFixedFunctions::DrawLine(const Color4 &cColor, const Vect
 
 void DrawHelpersBackendFixedFunctions::DrawLine(const Color4 &cColor, const Vector3 &vStartPosition, const Vector3 &vEndPosition, const Matrix4x4 &mObjectSpaceToClipSpace, float fWidth)
 {
+	// Draw the batched texts first to keep the draw order
+	Flush();
+
 	// Create vertex buffer
 	if (CreateTempBuffes()) {
 		// Setup the vertex buffer
@@ -579,6 +601,9 @@ void DrawHelpersBackendFixedFunctions::DrawLine(const Color4 &cColor, const Vect
 
 void DrawHelpersBackendFixedFunctions::DrawTriangle(const Color4 &cColor, const Vector3 &vV1, const Vector3 &vV2, const Vector3 &vV3, const Matrix4x4 &mObjectSpaceToClipSpace, float fWidth)
 {
+	// Draw the batched texts first to keep the draw order
+	Flush();
+
 	// Create vertex buffer
 	if (CreateTempBuffes()) {
 		// Setup the vertex buffer
@@ -641,6 +666,9 @@ void DrawHelpersBackendFixedFunctions::DrawTriangle(const Color4 &cColor, const
 
 void DrawHelpersBackendFixedFunctions::DrawQuad(const Color4 &cColor, const Vector2 &vPos, const Vector2 &vSize, float fWidth)
 {
+	// Draw the batched texts first to keep the draw order
+	Flush();
+
 	// Draw lines?
 	if (fWidth) {
 		// Set the line width
@@ -716,6 +744,9 @@ void DrawHelpersBackendFixedFunctions::DrawQuad(const Color4 &cColor, const Vect
 
 void DrawHelpersBackendFixedFunctions::DrawQuad(const Color4 &cColor, const Vector3 &vV1, const Vector3 &vV2, const Vector3 &vV3, const Vector3 &vV4, const Matrix4x4 &mObjectSpaceToClipSpace, float fWidth)
 {
+	// Draw the batched texts first to keep the draw order
+	Flush();
+
 	// Draw lines?
 	if (fWidth) {
 		// Set the line width
@@ -797,6 +828,9 @@ void DrawHelpersBackendFixedFunctions::DrawQuad(const Color4 &cColor, const Vect
 
 void DrawHelpersBackendFixedFunctions::DrawGradientQuad(const Color4 &cColor1, const Color4 &cColor2, float fAngle, const Vector2 &vPos, const Vector2 &vSize)
 {
+	// Draw the batched texts first to keep the draw order
+	Flush();
+
 	// Create vertex buffer
 	if (CreateTempBuffes()) {
 		// Setup the vertex buffer
@@ -918,6 +952,9 @@ void DrawHelpersBackendFixedFunctions::DrawGradientQuad(const Color4 &cColor1, c
 
 void DrawHelpersBackendFixedFunctions::DrawGradientQuad(const Color4 &cColor1, const Color4 &cColor2, float fAngle, const Vector3 &vV1, const Vector3 &vV2, const Vector3 &vV3, const Vector3 &vV4, const Matrix4x4 &mObjectSpaceToClipSpace)
 {
+	// Draw the batched texts first to keep the draw order
+	Flush();
+
 	// Create vertex buffer
 	if (CreateTempBuffes()) {
 		// Setup the vertex buffer
@@ -26,6 +26,7 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include <PLCore/Tools/Tools.h>
+#include <PLMath/Vector4.h>
 #include <PLMath/Rectangle.h>
 #include "PLRenderer/Renderer/Program.h"
 #include "PLRenderer/Renderer/Renderer.h"
@@ -121,6 +122,10 @@ void DrawHelpersBackendShaders::End2DMode()
 {
 	// Is the 2D mode set?
 	if (m_b2DMode) {
+		// Draw the batched primitives while the 2D mode is still active, unless there's still an outer batch
+		if (!m_nBatchLevel)
+			Flush();
+
 		// Fixed functions - just so fixed function stuff using Begin2DMode() & End2DMode() to setup the projection matrix still works
 		FixedFunctions *pFixedFunctions = m_pRenderer->GetFixedFunctions();
 		if (pFixedFunctions) {
@@ -137,354 +142,88 @@ void DrawHelpersBackendShaders::End2DMode()
 void DrawHelpersBackendShaders::DrawImage(TextureBuffer &cTextureBuffer, SamplerStates &cSamplerStates, const Vector2 &vPos, const Vector2 &vSize, const Color4 &cColor,
 										  float fAlphaReference, const Vector2 &vTextureCoordinate, const Vector2 &vTextureCoordinateSize, const Matrix4x4 &mTexture)
 {
-	// Create vertex buffer
-	if (CreateTempBuffes()) {
-		// Get the image size
-		Vector2 vImageSize = vSize;
-		if (vImageSize.IsNull()) {
-			switch (cTextureBuffer.GetType()) {
-				case Resource::TypeTextureBuffer2D:
-					vImageSize.x = static_cast<float>(static_cast<TextureBuffer2D&>(cTextureBuffer).GetSize().x);
-					vImageSize.y = static_cast<float>(static_cast<TextureBuffer2D&>(cTextureBuffer).GetSize().y);
-					break;
-
-				case Resource::TypeTextureBufferRectangle:
-					vImageSize.x = static_cast<float>(static_cast<TextureBufferRectangle&>(cTextureBuffer).GetSize().x);
-					vImageSize.y = static_cast<float>(static_cast<TextureBufferRectangle&>(cTextureBuffer).GetSize().y);
-					break;
-
-				case Resource::TypeIndexBuffer:
-				case Resource::TypeVertexBuffer:
-				case Resource::TypeUniformBuffer:
-				case Resource::TypeTextureBuffer1D:
-				case Resource::TypeTextureBuffer2DArray:
-				case Resource::TypeTextureBuffer3D:
-				case Resource::TypeTextureBufferCube:
-				case Resource::TypeOcclusionQuery:
-				case Resource::TypeVertexShader:
-				case Resource::TypeTessellationControlShader:
-				case Resource::TypeTessellationEvaluationShader:
-				case Resource::TypeGeometryShader:
-				case Resource::TypeFragmentShader:
-				case Resource::TypeProgram:
-				case Resource::TypeFont:
-				default:
-					return;	// Error, must be 2D or rectangle!
-			}
-		}
-
-		// Get texture scale - rectangle textures use non-normalized texture coordinates
-		float fTextureCoordinateScaleX = 1.0f;
-		float fTextureCoordinateScaleY = 1.0f;
-		if (cTextureBuffer.GetType() == Resource::TypeTextureBufferRectangle) {
-			fTextureCoordinateScaleX = static_cast<float>(static_cast<TextureBufferRectangle&>(cTextureBuffer).GetSize().x);
-			fTextureCoordinateScaleY = static_cast<float>(static_cast<TextureBufferRectangle&>(cTextureBuffer).GetSize().y);
-		}
-
-		// Setup the vertex buffer
-		if (m_pTempVertexBuffer->Lock(Lock::WriteOnly)) {
-			// Vertex 0
-			float *pfVertex = static_cast<float*>(m_pTempVertexBuffer->GetData(0, VertexBuffer::Position));
-			pfVertex[0] = vPos.x;
-			pfVertex[1] = vPos.y + vImageSize.y;
-			pfVertex[2] = m_fZValue2D;
-			pfVertex	= static_cast<float*>(m_pTempVertexBuffer->GetData(0, VertexBuffer::TexCoord));
-			pfVertex[0] = vTextureCoordinate.x*fTextureCoordinateScaleX;
-			pfVertex[1] = (vTextureCoordinate.y + vTextureCoordinateSize.y)*fTextureCoordinateScaleY;
-
-			// Vertex 1
-			pfVertex	= static_cast<float*>(m_pTempVertexBuffer->GetData(1, VertexBuffer::Position));
-			pfVertex[0] = vPos.x + vImageSize.x;
-			pfVertex[1] = vPos.y + vImageSize.y;
-			pfVertex[2] = m_fZValue2D;
-			pfVertex	= static_cast<float*>(m_pTempVertexBuffer->GetData(1, VertexBuffer::TexCoord));
-			pfVertex[0] = (vTextureCoordinate.x + vTextureCoordinateSize.x)*fTextureCoordinateScaleX;
-			pfVertex[1] = (vTextureCoordinate.y + vTextureCoordinateSize.y)*fTextureCoordinateScaleY;
-
-			// Vertex 2
-			pfVertex	= static_cast<float*>(m_pTempVertexBuffer->GetData(2, VertexBuffer::Position));
-			pfVertex[0] = vPos.x;
-			pfVertex[1] = vPos.y;
-			pfVertex[2] = m_fZValue2D;
-			pfVertex	= static_cast<float*>(m_pTempVertexBuffer->GetData(2, VertexBuffer::TexCoord));
-			pfVertex[0] = vTextureCoordinate.x*fTextureCoordinateScaleX;
-			pfVertex[1] = vTextureCoordinate.y*fTextureCoordinateScaleY;
-
-			// Vertex 3
-			pfVertex	= static_cast<float*>(m_pTempVertexBuffer->GetData(3, VertexBuffer::Position));
-			pfVertex[0] = vPos.x + vImageSize.x;
-			pfVertex[1] = vPos.y;
-			pfVertex[2] = m_fZValue2D;
-			pfVertex	= static_cast<float*>(m_pTempVertexBuffer->GetData(3, VertexBuffer::TexCoord));
-			pfVertex[0] = (vTextureCoordinate.x + vTextureCoordinateSize.x)*fTextureCoordinateScaleX;
-			pfVertex[1] = vTextureCoordinate.y*fTextureCoordinateScaleY;
-
-			// Unlock the vertex buffer
-			m_pTempVertexBuffer->Unlock();
-		}
-
-		// Use the image GPU program
-		if (UseImageProgram(*m_pTempVertexBuffer, cColor, m_mObjectSpaceToClipSpace, cTextureBuffer, cSamplerStates, fAlphaReference, mTexture)) {
-			// Draw image
-			m_pRenderer->DrawPrimitives(Primitive::TriangleStrip, 0, 4);
-		}
+	// Get the image size and the texture coordinate scale
+	Vector2 vImageSize, vScale;
+	if (GetImageSize(cTextureBuffer, vSize, vImageSize, vScale)) {
+		// Image vertices
+		const Vector3 vPositions[4] = {
+			Vector3(vPos.x,				   vPos.y + vImageSize.y, m_fZValue2D),
+			Vector3(vPos.x + vImageSize.x, vPos.y + vImageSize.y, m_fZValue2D),
+			Vector3(vPos.x,				   vPos.y,				  m_fZValue2D),
+			Vector3(vPos.x + vImageSize.x, vPos.y,				  m_fZValue2D)
+		};
+		const Vector2 vTexCoords[4] = {
+			Vector2(vTextureCoordinate.x*vScale.x,								(vTextureCoordinate.y + vTextureCoordinateSize.y)*vScale.y),
+			Vector2((vTextureCoordinate.x + vTextureCoordinateSize.x)*vScale.x, (vTextureCoordinate.y + vTextureCoordinateSize.y)*vScale.y),
+			Vector2(vTextureCoordinate.x*vScale.x,								vTextureCoordinate.y*vScale.y),
+			Vector2((vTextureCoordinate.x + vTextureCoordinateSize.x)*vScale.x, vTextureCoordinate.y*vScale.y)
+		};
+
+		// Draw image
+		DrawImageQuad(cTextureBuffer, cSamplerStates, vPositions, vTexCoords, m_mObjectSpaceToClipSpace, cColor, fAlphaReference, mTexture);
 	}
 }
 
 void DrawHelpersBackendShaders::DrawImage(TextureBuffer &cTextureBuffer, SamplerStates &cSamplerStates, const Vector3 &vPos, const Matrix4x4 &mObjectSpaceToClipSpace, const Vector2 &vSize,
 										  const Color4 &cColor, float fAlphaReference, const Vector2 &vTextureCoordinate, const Vector2 &vTextureCoordinateSize, const Matrix4x4 &mTexture)
 {
-	// Create vertex buffer
-	if (CreateTempBuffes()) {
-		// Get the image size
-		Vector2 vImageSize = vSize;
-		if (vImageSize.IsNull()) {
-			switch (cTextureBuffer.GetType()) {
-				case Resource::TypeTextureBuffer2D:
-					vImageSize.x = static_cast<float>(static_cast<TextureBuffer2D&>(cTextureBuffer).GetSize().x);
-					vImageSize.y = static_cast<float>(static_cast<TextureBuffer2D&>(cTextureBuffer).GetSize().y);
-					break;
-
-				case Resource::TypeTextureBufferRectangle:
-					vImageSize.x = static_cast<float>(static_cast<TextureBufferRectangle&>(cTextureBuffer).GetSize().x);
-					vImageSize.y = static_cast<float>(static_cast<TextureBufferRectangle&>(cTextureBuffer).GetSize().y);
-					break;
-
-				case Resource::TypeIndexBuffer:
-				case Resource::TypeVertexBuffer:
-				case Resource::TypeUniformBuffer:
-				case Resource::TypeTextureBuffer1D:
-				case Resource::TypeTextureBuffer2DArray:
-				case Resource::TypeTextureBuffer3D:
-				case Resource::TypeTextureBufferCube:
-				case Resource::TypeOcclusionQuery:
-				case Resource::TypeVertexShader:
-				case Resource::TypeTessellationControlShader:
-				case Resource::TypeTessellationEvaluationShader:
-				case Resource::TypeGeometryShader:
-				case Resource::TypeFragmentShader:
-				case Resource::TypeProgram:
-				case Resource::TypeFont:
-				default:
-					return;	// Error, must be 2D or rectangle!
-			}
-		}
-
-		// Get texture scale - rectangle textures use non-normalized texture coordinates
-		float fTextureCoordinateScaleX = 1.0f;
-		float fTextureCoordinateScaleY = 1.0f;
-		if (cTextureBuffer.GetType() == Resource::TypeTextureBufferRectangle) {
-			fTextureCoordinateScaleX = static_cast<float>(static_cast<TextureBufferRectangle&>(cTextureBuffer).GetSize().x);
-			fTextureCoordinateScaleY = static_cast<float>(static_cast<TextureBufferRectangle&>(cTextureBuffer).GetSize().y);
-		}
-
-		// Setup the vertex buffer
-		if (m_pTempVertexBuffer->Lock(Lock::WriteOnly)) {
-			// Vertex 0
-			float *pfVertex = static_cast<float*>(m_pTempVertexBuffer->GetData(0, VertexBuffer::Position));
-			pfVertex[0] = vPos.x + vImageSize.x;
-			pfVertex[1] = vPos.y + vImageSize.y;
-			pfVertex[2] = vPos.z;
-			pfVertex	= static_cast<float*>(m_pTempVertexBuffer->GetData(0, VertexBuffer::TexCoord));
-			pfVertex[0] = (vTextureCoordinate.x + vTextureCoordinateSize.x)*fTextureCoordinateScaleX;
-			pfVertex[1] = vTextureCoordinate.y*fTextureCoordinateScaleY;
-
-			// Vertex 1
-			pfVertex	= static_cast<float*>(m_pTempVertexBuffer->GetData(1, VertexBuffer::Position));
-			pfVertex[0] = vPos.x;
-			pfVertex[1] = vPos.y + vImageSize.y;
-			pfVertex[2] = vPos.z;
-			pfVertex	= static_cast<float*>(m_pTempVertexBuffer->GetData(1, VertexBuffer::TexCoord));
-			pfVertex[0] = vTextureCoordinate.x*fTextureCoordinateScaleX;
-			pfVertex[1] = vTextureCoordinate.y*fTextureCoordinateScaleY;
-
-			// Vertex 2
-			pfVertex	= static_cast<float*>(m_pTempVertexBuffer->GetData(2, VertexBuffer::Position));
-			pfVertex[0] = vPos.x + vImageSize.x;
-			pfVertex[1] = vPos.y;
-			pfVertex[2] = vPos.z;
-			pfVertex	= static_cast<float*>(m_pTempVertexBuffer->GetData(2, VertexBuffer::TexCoord));
-			pfVertex[0] = (vTextureCoordinate.x + vTextureCoordinateSize.x)*fTextureCoordinateScaleX;
-			pfVertex[1] = (vTextureCoordinate.y + vTextureCoordinateSize.y)*fTextureCoordinateScaleY;
-
-			// Vertex 3
-			pfVertex	= static_cast<float*>(m_pTempVertexBuffer->GetData(3, VertexBuffer::Position));
-			pfVertex[0] = vPos.x;
-			pfVertex[1] = vPos.y;
-			pfVertex[2] = vPos.z;
-			pfVertex	= static_cast<float*>(m_pTempVertexBuffer->GetData(3, VertexBuffer::TexCoord));
-			pfVertex[0] = vTextureCoordinate.x*fTextureCoordinateScaleX;
-			pfVertex[1] = (vTextureCoordinate.y + vTextureCoordinateSize.y)*fTextureCoordinateScaleY;
-
-			// Unlock the vertex buffer
-			m_pTempVertexBuffer->Unlock();
-		}
-
-		// Use the image GPU program
-		if (UseImageProgram(*m_pTempVertexBuffer, cColor, mObjectSpaceToClipSpace, cTextureBuffer, cSamplerStates, fAlphaReference, mTexture)) {
-			// Draw image
-			m_pRenderer->DrawPrimitives(Primitive::TriangleStrip, 0, 4);
-		}
+	// Get the image size and the texture coordinate scale
+	Vector2 vImageSize, vScale;
+	if (GetImageSize(cTextureBuffer, vSize, vImageSize, vScale)) {
+		// Image vertices
+		const Vector3 vPositions[4] = {
+			Vector3(vPos.x + vImageSize.x, vPos.y + vImageSize.y, vPos.z),
+			Vector3(vPos.x,				   vPos.y + vImageSize.y, vPos.z),
+			Vector3(vPos.x + vImageSize.x, vPos.y,				  vPos.z),
+			Vector3(vPos.x,				   vPos.y,				  vPos.z)
+		};
+		const Vector2 vTexCoords[4] = {
+			Vector2((vTextureCoordinate.x + vTextureCoordinateSize.x)*vScale.x, vTextureCoordinate.y*vScale.y),
+			Vector2(vTextureCoordinate.x*vScale.x,								vTextureCoordinate.y*vScale.y),
+			Vector2((vTextureCoordinate.x + vTextureCoordinateSize.x)*vScale.x, (vTextureCoordinate.y + vTextureCoordinateSize.y)*vScale.y),
+			Vector2(vTextureCoordinate.x*vScale.x,								(vTextureCoordinate.y + vTextureCoordinateSize.y)*vScale.y)
+		};
+
+		// Draw image
+		DrawImageQuad(cTextureBuffer, cSamplerStates, vPositions, vTexCoords, mObjectSpaceToClipSpace, cColor, fAlphaReference, mTexture);
 	}
 }
 
 void DrawHelpersBackendShaders::DrawPoint(const Color4 &cColor, const Vector2 &vPosition, float fSize)
 {
-	// Create vertex buffer
-	if (CreateTempBuffes()) {
-		// Setup the vertex buffer
-		if (m_pTempVertexBuffer->Lock(Lock::WriteOnly)) {
-			// Vertex 0
-			float *pfVertex = static_cast<float*>(m_pTempVertexBuffer->GetData(0, VertexBuffer::Position));
-			pfVertex[0] = vPosition.x;
-			pfVertex[1] = vPosition.y;
-			pfVertex[2] = m_fZValue2D;
-
-			// Unlock the vertex buffer
-			m_pTempVertexBuffer->Unlock();
-		}
-
-		// Use the primitive GPU program
-		if (UsePrimitiveProgram(*m_pTempVertexBuffer, cColor, m_mObjectSpaceToClipSpace, fSize)) {
-			// Set the point size - used for Cg and OpenGL GLSL, for OpenGL ES 2.0, gl_PointSize is used within the vertex shader
-			m_pRenderer->SetRenderState(RenderState::PointSize, Tools::FloatToUInt32(fSize));
-
-			// Draw point
-			m_pRenderer->DrawPrimitives(Primitive::PointList, 0, 1);
-		}
-	}
+	const Vector3 vVertex(vPosition.x, vPosition.y, m_fZValue2D);
+	DrawPrimitive(Primitive::PointList, &vVertex, 1, m_mObjectSpaceToClipSpace, cColor, nullptr, fSize);
 }
 
 void DrawHelpersBackendShaders::DrawPoint(const Color4 &cColor, const Vector3 &vPosition, const Matrix4x4 &mObjectSpaceToClipSpace, float fSize)
 {
-	// Create vertex buffer
-	if (CreateTempBuffes()) {
-		// Setup the vertex buffer
-		if (m_pTempVertexBuffer->Lock(Lock::WriteOnly)) {
-			// Vertex 0
-			float *pfVertex = static_cast<float*>(m_pTempVertexBuffer->GetData(0, VertexBuffer::Position));
-			pfVertex[0] = vPosition.x;
-			pfVertex[1] = vPosition.y;
-			pfVertex[2] = vPosition.z;
-
-			// Unlock the vertex buffer
-			m_pTempVertexBuffer->Unlock();
-		}
-
-		// Use the primitive GPU program
-		if (UsePrimitiveProgram(*m_pTempVertexBuffer, cColor, mObjectSpaceToClipSpace, fSize)) {
-			// Set the point size - used for Cg and OpenGL GLSL, for OpenGL ES 2.0, gl_PointSize is used within the vertex shader
-			m_pRenderer->SetRenderState(RenderState::PointSize, Tools::FloatToUInt32(fSize));
-
-			// Draw point
-			m_pRenderer->DrawPrimitives(Primitive::PointList, 0, 1);
-		}
-	}
+	DrawPrimitive(Primitive::PointList, &vPosition, 1, mObjectSpaceToClipSpace, cColor, nullptr, fSize);
 }
 
 void DrawHelpersBackendShaders::DrawLine(const Color4 &cColor, const Vector2 &vStartPosition, const Vector2 &vEndPosition, float fWidth)
 {
-	// Create vertex buffer
-	if (CreateTempBuffes()) {
-		// Setup the vertex buffer
-		if (m_pTempVertexBuffer->Lock(Lock::WriteOnly)) {
-			// Vertex 0
-			float *pfVertex = static_cast<float*>(m_pTempVertexBuffer->GetData(0, VertexBuffer::Position));
-			pfVertex[0] = vStartPosition.x;
-			pfVertex[1] = vStartPosition.y;
-			pfVertex[2] = m_fZValue2D;
-
-			// Vertex 1
-			pfVertex	= static_cast<float*>(m_pTempVertexBuffer->GetData(1, VertexBuffer::Position));
-			pfVertex[0] = vEndPosition.x;
-			pfVertex[1] = vEndPosition.y;
-			pfVertex[2] = m_fZValue2D;
-
-			// Unlock the vertex buffer
-			m_pTempVertexBuffer->Unlock();
-		}
-
-		// Use the primitive GPU program
-		if (UsePrimitiveProgram(*m_pTempVertexBuffer, cColor, m_mObjectSpaceToClipSpace)) {
-			// Set the line width
-			m_pRenderer->SetRenderState(RenderState::LineWidth, Tools::FloatToUInt32(fWidth));
-
-			// Draw line
-			m_pRenderer->DrawPrimitives(Primitive::LineList, 0, 2);
-		}
-	}
+	const Vector3 vVertices[2] = {
+		Vector3(vStartPosition.x, vStartPosition.y, m_fZValue2D),
+		Vector3(vEndPosition.x,   vEndPosition.y,   m_fZValue2D)
+	};
+	DrawPrimitive(Primitive::LineList, vVertices, 2, m_mObjectSpaceToClipSpace, cColor, nullptr, fWidth);
 }
 
 void DrawHelpersBackendShaders::DrawLine(const Color4 &cColor, const Vector3 &vStartPosition, const Vector3 &vEndPosition, const Matrix4x4 &mObjectSpaceToClipSpace, float fWidth)
 {
-	// Create vertex buffer
-	if (CreateTempBuffes()) {
-		// Setup the vertex buffer
-		if (m_pTempVertexBuffer->Lock(Lock::WriteOnly)) {
-			// Vertex 0
-			float *pfVertex = static_cast<float*>(m_pTempVertexBuffer->GetData(0, VertexBuffer::Position));
-			pfVertex[0] = vStartPosition.x;
-			pfVertex[1] = vStartPosition.y;
-			pfVertex[2] = vStartPosition.z;
-
-			// Vertex 1
-			pfVertex	= static_cast<float*>(m_pTempVertexBuffer->GetData(1, VertexBuffer::Position));
-			pfVertex[0] = vEndPosition.x;
-			pfVertex[1] = vEndPosition.y;
-			pfVertex[2] = vEndPosition.z;
-
-			// Unlock the vertex buffer
-			m_pTempVertexBuffer->Unlock();
-		}
-
-		// Use the primitive GPU program
-		if (UsePrimitiveProgram(*m_pTempVertexBuffer, cColor, mObjectSpaceToClipSpace)) {
-			// Set the line width
-			m_pRenderer->SetRenderState(RenderState::LineWidth, Tools::FloatToUInt32(fWidth));
-
-			// Draw line
-			m_pRenderer->DrawPrimitives(Primitive::LineList, 0, 2);
-		}
-	}
+	const Vector3 vVertices[2] = { vStartPosition, vEndPosition };
+	DrawPrimitive(Primitive::LineList, vVertices, 2, mObjectSpaceToClipSpace, cColor, nullptr, fWidth);
 }
 
 void DrawHelpersBackendShaders::DrawTriangle(const Color4 &cColor, const Vector3 &vV1, const Vector3 &vV2, const Vector3 &vV3, const Matrix4x4 &mObjectSpaceToClipSpace, float fWidth)
 {
-	// Create vertex buffer
-	if (CreateTempBuffes()) {
-		// Setup the vertex buffer
-		if (m_pTempVertexBuffer->Lock(Lock::WriteOnly)) {
-			// Vertex 0
-			float *pfVertex = static_cast<float*>(m_pTempVertexBuffer->GetData(0, VertexBuffer::Position));
-			pfVertex[0] = vV1.x;
-			pfVertex[1] = vV1.y;
-			pfVertex[2] = vV1.z;
-
-			// Vertex 1
-			pfVertex	= static_cast<float*>(m_pTempVertexBuffer->GetData(1, VertexBuffer::Position));
-			pfVertex[0] = vV2.x;
-			pfVertex[1] = vV2.y;
-			pfVertex[2] = vV2.z;
-
-			// Vertex 2
-			pfVertex	= static_cast<float*>(m_pTempVertexBuffer->GetData(2, VertexBuffer::Position));
-			pfVertex[0] = vV3.x;
-			pfVertex[1] = vV3.y;
-			pfVertex[2] = vV3.z;
-
-			// Unlock the vertex buffer
-			m_pTempVertexBuffer->Unlock();
-		}
-
-		// Use the primitive GPU program
-		if (UsePrimitiveProgram(*m_pTempVertexBuffer, cColor, mObjectSpaceToClipSpace)) {
-			// Set the line width
-			if (fWidth)
-				m_pRenderer->SetRenderState(RenderState::LineWidth, Tools::FloatToUInt32(fWidth));
-
-			// Draw triangle
-			m_pRenderer->DrawPrimitives(fWidth ? Primitive::LineList : Primitive::TriangleList, 0, 3);
-		}
+	// Draw lines?
+	if (fWidth) {
+		const Vector3 vVertices[6] = { vV1, vV2, vV2, vV3, vV3, vV1 };
+		DrawPrimitive(Primitive::LineList, vVertices, 6, mObjectSpaceToClipSpace, cColor, nullptr, fWidth);
+	} else {
+		const Vector3 vVertices[3] = { vV1, vV2, vV3 };
+		DrawPrimitive(Primitive::TriangleList, vVertices, 3, mObjectSpaceToClipSpace, cColor);
 	}
 }
 
@@ -492,57 +231,20 @@ void DrawHelpersBackendShaders::DrawQuad(const Color4 &cColor, const Vector2 &vP
 {
 	// Draw lines?
 	if (fWidth) {
-		// Set the line width
-		m_pRenderer->SetRenderState(RenderState::LineWidth, Tools::FloatToUInt32(fWidth));
-
-		// Draw single lines
-		const Vector3 &vV1 = vPos;
-		const Vector3 vV2(vPos.x + vSize.x, vPos.y);
-		const Vector3 vV3(vPos.x + vSize.x, vPos.y + vSize.y);
-		const Vector3 vV4(vPos.x, vPos.y + vSize.y);
-		DrawLine(cColor, vV1, vV2, fWidth);
-		DrawLine(cColor, vV2, vV3, fWidth);
-		DrawLine(cColor, vV3, vV4, fWidth);
-		DrawLine(cColor, vV4, vV1, fWidth);
+		const Vector3 vV1(vPos.x,			vPos.y,			  m_fZValue2D);
+		const Vector3 vV2(vPos.x + vSize.x, vPos.y,			  m_fZValue2D);
+		const Vector3 vV3(vPos.x + vSize.x, vPos.y + vSize.y, m_fZValue2D);
+		const Vector3 vV4(vPos.x,			vPos.y + vSize.y, m_fZValue2D);
+		const Vector3 vVertices[8] = { vV1, vV2, vV2, vV3, vV3, vV4, vV4, vV1 };
+		DrawPrimitive(Primitive::LineList, vVertices, 8, m_mObjectSpaceToClipSpace, cColor, nullptr, fWidth);
 	} else {
-		// Create vertex buffer
-		if (CreateTempBuffes()) {
-			// Setup the vertex buffer
-			if (m_pTempVertexBuffer->Lock(Lock::WriteOnly)) {
-				// Vertex 0
-				float *pfVertex = static_cast<float*>(m_pTempVertexBuffer->GetData(0, VertexBuffer::Position));
-				pfVertex[0] = vPos.x;
-				pfVertex[1] = vPos.y + vSize.y;
-				pfVertex[2] = m_fZValue2D;
-
-				// Vertex 1
-				pfVertex	= static_cast<float*>(m_pTempVertexBuffer->GetData(1, VertexBuffer::Position));
-				pfVertex[0] = vPos.x + vSize.x;
-				pfVertex[1] = vPos.y + vSize.y;
-				pfVertex[2] = m_fZValue2D;
-
-				// Vertex 2
-				pfVertex	= static_cast<float*>(m_pTempVertexBuffer->GetData(2, VertexBuffer::Position));
-				pfVertex[0] = vPos.x;
-				pfVertex[1] = vPos.y;
-				pfVertex[2] = m_fZValue2D;
-
-				// Vertex 3
-				pfVertex	= static_cast<float*>(m_pTempVertexBuffer->GetData(3, VertexBuffer::Position));
-				pfVertex[0] = vPos.x + vSize.x;
-				pfVertex[1] = vPos.y;
-				pfVertex[2] = m_fZValue2D;
-
-				// Unlock the vertex buffer
-				m_pTempVertexBuffer->Unlock();
-			}
-
-			// Use the primitive GPU program
-			if (UsePrimitiveProgram(*m_pTempVertexBuffer, cColor, m_mObjectSpaceToClipSpace)) {
-				// Draw quad
-				m_pRenderer->DrawPrimitives(Primitive::TriangleStrip, 0, 4);
-			}
-		}
+		const Vector3 vVertices[4] = {
+			Vector3(vPos.x,			  vPos.y + vSize.y, m_fZValue2D),
+			Vector3(vPos.x + vSize.x, vPos.y + vSize.y, m_fZValue2D),
+			Vector3(vPos.x,			  vPos.y,			m_fZValue2D),
+			Vector3(vPos.x + vSize.x, vPos.y,			m_fZValue2D)
+		};
+		DrawPrimitive(Primitive::TriangleStrip, vVertices, 4, m_mObjectSpaceToClipSpace, cColor);
 	}
 }
 
@@ -550,270 +252,101 @@ void DrawHelpersBackendShaders::DrawQuad(const Color4 &cColor, const Vector3 &vV
 {
 	// Draw lines?
 	if (fWidth) {
-		// Set the line width
-		m_pRenderer->SetRenderState(RenderState::LineWidth, Tools::FloatToUInt32(fWidth));
-
-		// Draw single lines
-		DrawLine(cColor, vV1, vV2, fWidth);
-		DrawLine(cColor, vV2, vV3, fWidth);
-		DrawLine(cColor, vV3, vV4, fWidth);
-		DrawLine(cColor, vV4, vV1, fWidth);
+		const Vector3 vVertices[8] = { vV1, vV2, vV2, vV3, vV3, vV4, vV4, vV1 };
+		DrawPrimitive(Primitive::LineList, vVertices, 8, mObjectSpaceToClipSpace, cColor, nullptr, fWidth);
 	} else {
-		// Create vertex buffer
-		if (CreateTempBuffes()) {
-			// Setup the vertex buffer
-			if (m_pTempVertexBuffer->Lock(Lock::WriteOnly)) {
-				// Vertex 0
-				float *pfVertex = static_cast<float*>(m_pTempVertexBuffer->GetData(0, VertexBuffer::Position));
-				pfVertex[0] = vV1.x;
-				pfVertex[1] = vV1.y;
-				pfVertex[2] = vV1.z;
-
-				// Vertex 1
-				pfVertex	= static_cast<float*>(m_pTempVertexBuffer->GetData(1, VertexBuffer::Position));
-				pfVertex[0] = vV2.x;
-				pfVertex[1] = vV2.y;
-				pfVertex[2] = vV2.z;
-
-				// Vertex 2
-				pfVertex	= static_cast<float*>(m_pTempVertexBuffer->GetData(2, VertexBuffer::Position));
-				pfVertex[0] = vV3.x;
-				pfVertex[1] = vV3.y;
-				pfVertex[2] = vV3.z;
-
-				// Vertex 3
-				pfVertex	= static_cast<float*>(m_pTempVertexBuffer->GetData(3, VertexBuffer::Position));
-				pfVertex[0] = vV4.x;
-				pfVertex[1] = vV4.y;
-				pfVertex[2] = vV4.z;
-
-				// Unlock the vertex buffer
-				m_pTempVertexBuffer->Unlock();
-			}
-
-			// Use the primitive GPU program
-			if (UsePrimitiveProgram(*m_pTempVertexBuffer, cColor, mObjectSpaceToClipSpace)) {
-				// Draw quad
-				m_pRenderer->DrawPrimitives(Primitive::TriangleStrip, 0, 4);
-			}
-		}
+		const Vector3 vVertices[4] = { vV1, vV2, vV3, vV4 };
+		DrawPrimitive(Primitive::TriangleStrip, vVertices, 4, mObjectSpaceToClipSpace, cColor);
 	}
 }
 
 void DrawHelpersBackendShaders::DrawGradientQuad(const Color4 &cColor1, const Color4 &cColor2, float fAngle, const Vector2 &vPos, const Vector2 &vSize)
 {
-	// Create vertex buffer
-	if (CreateTempBuffes()) {
-		// Setup the vertex buffer
-		if (m_pTempVertexBuffer->Lock(Lock::WriteOnly)) {
-			// For color calculation
-			Color4 cColor;
-			const float fSin     = Math::Sin(fAngle);
-			const float fCos     = Math::Cos(fAngle);
-			const float fScale   = 1.0f/(Math::Abs(fSin)+Math::Abs(fCos));
-
-			// Vertex 0
-			float *pfVertex = static_cast<float*>(m_pTempVertexBuffer->GetData(0, VertexBuffer::Position));
-			pfVertex[0] = vPos.x;
-			pfVertex[1] = vPos.y + vSize.y;
-			pfVertex[2] = m_fZValue2D;
-			{ // Calculate color
-				cColor = 0.0f;
-				// Horizontal color influence
-				if (fCos > 0.0f)
-					cColor += cColor1* fCos;
-				if (fCos < 0.0f)
-					cColor += cColor2*-fCos;
-				// Vertical color influence
-				if (fSin > 0.0f)
-					cColor = (cColor2* fSin + cColor)*fScale;
-				if (fSin < 0.0f)
-					cColor = (cColor1*-fSin + cColor)*fScale;
-				cColor.Saturate();
-			}
-			m_pTempVertexBuffer->SetColor(0, cColor);
-
-			// Vertex 1
-			pfVertex	= static_cast<float*>(m_pTempVertexBuffer->GetData(1, VertexBuffer::Position));
-			pfVertex[0] = vPos.x + vSize.x;
-			pfVertex[1] = vPos.y + vSize.y;
-			pfVertex[2] = m_fZValue2D;
-			{ // Calculate color
-				cColor = 0.0f;
-				// Horizontal color influence
-				if (fCos > 0.0f)
-					cColor += cColor2* fCos;
-				if (fCos < 0.0f)
-					cColor += cColor1*-fCos;
-				// Vertical color influence
-				if (fSin > 0.0f)
-					cColor = (cColor2* fSin + cColor)*fScale;
-				if (fSin < 0.0f)
-					cColor = (cColor1*-fSin + cColor)*fScale;
-				cColor.Saturate();
-			}
-			m_pTempVertexBuffer->SetColor(1, cColor);
-
-			// Vertex 2
-			pfVertex	= static_cast<float*>(m_pTempVertexBuffer->GetData(2, VertexBuffer::Position));
-			pfVertex[0] = vPos.x;
-			pfVertex[1] = vPos.y;
-			pfVertex[2] = m_fZValue2D;
-			{ // Calculate color
-				cColor = 0.0f;
-				// Horizontal color influence
-				if (fCos > 0.0f)
-					cColor += cColor1* fCos;
-				if (fCos < 0.0f)
-					cColor += cColor2*-fCos;
-				// Vertical color influence
-				if (fSin > 0.0f)
-					cColor = (cColor1* fSin + cColor)*fScale;
-				if (fSin < 0.0f)
-					cColor = (cColor2*-fSin + cColor)*fScale;
-				cColor.Saturate();
-			}
-			m_pTempVertexBuffer->SetColor(2, cColor);
-
-			// Vertex 3
-			pfVertex	= static_cast<float*>(m_pTempVertexBuffer->GetData(3, VertexBuffer::Position));
-			pfVertex[0] = vPos.x + vSize.x;
-			pfVertex[1] = vPos.y;
-			pfVertex[2] = m_fZValue2D;
-			{ // Calculate color
-				cColor = 0.0f;
-				// Horizontal color influence
-				if (fCos > 0.0f)
-					cColor += cColor2* fCos;
-				if (fCos < 0.0f)
-					cColor += cColor1*-fCos;
-				// Vertical color influence
-				if (fSin > 0.0f)
-					cColor = (cColor1* fSin + cColor)*fScale;
-				if (fSin < 0.0f)
-					cColor = (cColor2*-fSin + cColor)*fScale;
-				cColor.Saturate();
-			}
-			m_pTempVertexBuffer->SetColor(3, cColor);
-
-			// Unlock the vertex buffer
-			m_pTempVertexBuffer->Unlock();
-		}
-
-		// Use the primitive GPU program
-		if (UsePrimitiveProgram(*m_pTempVertexBuffer, Color4::Null, m_mObjectSpaceToClipSpace)) {
-			// Draw quad
-			m_pRenderer->DrawPrimitives(Primitive::TriangleStrip, 0, 4);
-		}
-	}
+	const Vector3 vVertices[4] = {
+		Vector3(vPos.x,			  vPos.y + vSize.y, m_fZValue2D),
+		Vector3(vPos.x + vSize.x, vPos.y + vSize.y, m_fZValue2D),
+		Vector3(vPos.x,			  vPos.y,			m_fZValue2D),
+		Vector3(vPos.x + vSize.x, vPos.y,			m_fZValue2D)
+	};
+	Color4 cColors[4];
+	GetGradientColors(cColor1, cColor2, fAngle, cColors);
+	DrawPrimitive(Primitive::TriangleStrip, vVertices, 4, m_mObjectSpaceToClipSpace, Color4::Null, cColors);
 }
 
 void DrawHelpersBackendShaders::DrawGradientQuad(const Color4 &cColor1, const Color4 &cColor2, float fAngle, const Vector3 &vV1, const Vector3 &vV2, const Vector3 &vV3, const Vector3 &vV4, const Matrix4x4 &mObjectSpaceToClipSpace)
 {
-	// Create vertex buffer
-	if (CreateTempBuffes()) {
-		// Setup the vertex buffer
-		if (m_pTempVertexBuffer->Lock(Lock::WriteOnly)) {
-			// For color calculation
-			Color4 cColor;
-			const float fSin     = Math::Sin(fAngle);
-			const float fCos     = Math::Cos(fAngle);
-			const float fScale   = 1.0f/(Math::Abs(fSin)+Math::Abs(fCos));
-
-			// Vertex 0
-			float *pfVertex = static_cast<float*>(m_pTempVertexBuffer->GetData(0, VertexBuffer::Position));
-			pfVertex[0] = vV1.x;
-			pfVertex[1] = vV1.y;
-			pfVertex[2] = vV1.z;
-			{ // Calculate color
-				cColor = 0.0f;
-				// Horizontal color influence
-				if (fCos > 0.0f)
-					cColor += cColor1* fCos;
-				if (fCos < 0.0f)
-					cColor += cColor2*-fCos;
-				// Vertical color influence
-				if (fSin > 0.0f)
-					cColor = (cColor2* fSin + cColor)*fScale;
-				if (fSin < 0.0f)
-					cColor = (cColor1*-fSin + cColor)*fScale;
-				cColor.Saturate();
-			}
-			m_pTempVertexBuffer->SetColor(0, cColor);
-
-			// Vertex 1
-			pfVertex	= static_cast<float*>(m_pTempVertexBuffer->GetData(1, VertexBuffer::Position));
-			pfVertex[0] = vV2.x;
-			pfVertex[1] = vV2.y;
-			pfVertex[2] = vV2.z;
-			{ // Calculate color
-				cColor = 0.0f;
-				// Horizontal color influence
-				if (fCos > 0.0f)
-					cColor += cColor2* fCos;
-				if (fCos < 0.0f)
-					cColor += cColor1*-fCos;
-				// Vertical color influence
-				if (fSin > 0.0f)
-					cColor = (cColor2* fSin + cColor)*fScale;
-				if (fSin < 0.0f)
-					cColor = (cColor1*-fSin + cColor)*fScale;
-				cColor.Saturate();
-			}
-			m_pTempVertexBuffer->SetColor(1, cColor);
-
-			// Vertex 2
-			pfVertex	= static_cast<float*>(m_pTempVertexBuffer->GetData(2, VertexBuffer::Position));
-			pfVertex[0] = vV3.x;
-			pfVertex[1] = vV3.y;
-			pfVertex[2] = vV3.z;
-			{ // Calculate color
-				cColor = 0.0f;
-				// Horizontal color influence
-				if (fCos > 0.0f)
-					cColor += cColor1* fCos;
-				if (fCos < 0.0f)
-					cColor += cColor2*-fCos;
-				// Vertical color influence
-				if (fSin > 0.0f)
-					cColor = (cColor1* fSin + cColor)*fScale;
-				if (fSin < 0.0f)
-					cColor = (cColor2*-fSin + cColor)*fScale;
-				cColor.Saturate();
-			}
-			m_pTempVertexBuffer->SetColor(2, cColor);
-
-			// Vertex 3
-			pfVertex	= static_cast<float*>(m_pTempVertexBuffer->GetData(3, VertexBuffer::Position));
-			pfVertex[0] = vV4.x;
-			pfVertex[1] = vV4.y;
-			pfVertex[2] = vV4.z;
-			{ // Calculate color
-				cColor = 0.0f;
-				// Horizontal color influence
-				if (fCos > 0.0f)
-					cColor += cColor2* fCos;
-				if (fCos < 0.0f)
-					cColor += cColor1*-fCos;
-				// Vertical color influence
-				if (fSin > 0.0f)
-					cColor = (cColor1* fSin + cColor)*fScale;
-				if (fSin < 0.0f)
-					cColor = (cColor2*-fSin + cColor)*fScale;
-				cColor.Saturate();
-			}
-			m_pTempVertexBuffer->SetColor(3, cColor);
+	const Vector3 vVertices[4] = { vV1, vV2, vV3, vV4 };
+	Color4 cColors[4];
+	GetGradientColors(cColor1, cColor2, fAngle, cColors);
+	DrawPrimitive(Primitive::TriangleStrip, vVertices, 4, mObjectSpaceToClipSpace, Color4::Null, cColors);
+}
 
-			// Unlock the vertex buffer
-			m_pTempVertexBuffer->Unlock();
-		}
 
-		// Use the primitive GPU program
-		if (UsePrimitiveProgram(*m_pTempVertexBuffer, Color4::Null, mObjectSpaceToClipSpace)) {
-			// Draw quad
-			m_pRenderer->DrawPrimitives(Primitive::TriangleStrip, 0, 4);
+//[-------------------------------------------------------]
+//[ Protected virtual DrawHelpersBackend functions        ]
+//[-------------------------------------------------------]
+bool DrawHelpersBackendShaders::DrawPrimitiveBatch(const Batch &sBatch, VertexBuffer &cVertexBuffer, uint32 nStartVertex)
+{
+	const BatchKey &sKey = sBatch.sKey;
+
+	// Set the program flags, batches always use vertex colors
+	m_cProgramFlags.Reset();
+	PL_ADD_VS_FLAG(m_cProgramFlags, VS_VERTEXCOLOR)
+	PL_ADD_FS_FLAG(m_cProgramFlags, FS_VERTEXCOLOR)
+	if (sKey.pTextureBuffer) {
+		PL_ADD_VS_FLAG(m_cProgramFlags, VS_TEXCOORD0)
+		PL_ADD_FS_FLAG(m_cProgramFlags, FS_DIFFUSEMAP)
+		if (sKey.pTextureBuffer->GetType() == Resource::TypeTextureBuffer2D)
+			PL_ADD_FS_FLAG(m_cProgramFlags, FS_DIFFUSEMAP2D)
+		if (sKey.fAlphaReference < 1.0f)
+			PL_ADD_FS_FLAG(m_cProgramFlags, FS_ALPHATEST)
+	}
+	if (sKey.nPrimitive == Primitive::PointList && sKey.fSize)
+		PL_ADD_VS_FLAG(m_cProgramFlags, VS_POINTSIZE)
+
+	// Get the generated program using the current flags
+	ProgramGenerator::GeneratedProgram *pGeneratedProgram = GetAndSetGeneratedProgram();
+	if (pGeneratedProgram && pGeneratedProgram->pUserData) {
+		GeneratedProgramUserData *pGeneratedProgramUserData = static_cast<GeneratedProgramUserData*>(pGeneratedProgram->pUserData);
+
+		// Set program vertex attributes, this creates a connection between "Vertex Buffer Attribute" and "Vertex Shader Attribute"
+		if (pGeneratedProgramUserData->pVertexPosition)
+			pGeneratedProgramUserData->pVertexPosition->Set(&cVertexBuffer, PLRenderer::VertexBuffer::Position);
+		if (pGeneratedProgramUserData->pVertexColor)
+			pGeneratedProgramUserData->pVertexColor->Set(&cVertexBuffer, PLRenderer::VertexBuffer::TexCoord, 1);
+		if (pGeneratedProgramUserData->pVertexTextureCoordinate)
+			pGeneratedProgramUserData->pVertexTextureCoordinate->Set(&cVertexBuffer, PLRenderer::VertexBuffer::TexCoord);
+
+		// Set program uniforms, the batch vertices are already in clip space and have their final texture coordinates
+		if (pGeneratedProgramUserData->pObjectSpaceToClipSpaceMatrix)
+			pGeneratedProgramUserData->pObjectSpaceToClipSpaceMatrix->Set(Matrix4x4::Identity);
+		if (pGeneratedProgramUserData->pTextureMatrix)
+			pGeneratedProgramUserData->pTextureMatrix->Set(Matrix4x4::Identity);
+		if (pGeneratedProgramUserData->pPointSize)
+			pGeneratedProgramUserData->pPointSize->Set(sKey.fSize);
+		if (pGeneratedProgramUserData->pDiffuseMap && sKey.pTextureBuffer) {
+			const int nTextureUnit = pGeneratedProgramUserData->pDiffuseMap->Set(sKey.pTextureBuffer);
+			if (nTextureUnit >= 0) {
+				// Set sampler states
+				for (uint32 nState=0; nState<Sampler::Number; nState++)
+					m_pRenderer->SetSamplerState(nTextureUnit, static_cast<Sampler::Enum>(nState), sKey.nSamplerState[nState]);
+			}
+			if (pGeneratedProgramUserData->pAlphaReference)
+				pGeneratedProgramUserData->pAlphaReference->Set(sKey.fAlphaReference);
 		}
+
+		// Set the point size or line width - the point size is used for Cg and OpenGL GLSL, for OpenGL ES 2.0, gl_PointSize is used within the vertex shader
+		if (sKey.nPrimitive == Primitive::PointList)
+			m_pRenderer->SetRenderState(RenderState::PointSize, Tools::FloatToUInt32(sKey.fSize));
+		else if (sKey.nPrimitive == Primitive::LineList)
+			m_pRenderer->SetRenderState(RenderState::LineWidth, Tools::FloatToUInt32(sKey.fSize));
+
+		// Draw the batch
+		return m_pRenderer->DrawPrimitives(sKey.nPrimitive, nStartVertex, sBatch.lstVertices.GetNumOfElements());
 	}
+
+	// Error!
+	return false;
 }
 
 
@@ -913,6 +446,190 @@ ProgramGenerator::GeneratedProgram *DrawHelpersBackendShaders::GetAndSetGenerate
 	return nullptr;
 }
 
+/**
+*  @brief
+*    Returns the image size and the texture coordinate scale
+*/
+bool DrawHelpersBackendShaders::GetImageSize(TextureBuffer &cTextureBuffer, const Vector2 &vSize, Vector2 &vImageSize, Vector2 &vTextureCoordinateScale) const
+{
+	// Get the image size
+	vImageSize = vSize;
+	if (vImageSize.IsNull()) {
+		switch (cTextureBuffer.GetType()) {
+			case Resource::TypeTextureBuffer2D:
+				vImageSize.x = static_cast<float>(static_cast<TextureBuffer2D&>(cTextureBuffer).GetSize().x);
+				vImageSize.y = static_cast<float>(static_cast<TextureBuffer2D&>(cTextureBuffer).GetSize().y);
+				break;
+
+			case Resource::TypeTextureBufferRectangle:
+				vImageSize.x = static_cast<float>(static_cast<TextureBufferRectangle&>(cTextureBuffer).GetSize().x);
+				vImageSize.y = static_cast<float>(static_cast<TextureBufferRectangle&>(cTextureBuffer).GetSize().y);
+				break;
+
+			case Resource::TypeIndexBuffer:
+			case Resource::TypeVertexBuffer:
+			case Resource::TypeUniformBuffer:
+			case Resource::TypeTextureBuffer1D:
+			case Resource::TypeTextureBuffer2DArray:
+			case Resource::TypeTextureBuffer3D:
+			case Resource::TypeTextureBufferCube:
+			case Resource::TypeOcclusionQuery:
+			case Resource::TypeVertexShader:
+			case Resource::TypeTessellationControlShader:
+			case Resource::TypeTessellationEvaluationShader:
+			case Resource::TypeGeometryShader:
+			case Resource::TypeFragmentShader:
+			case Resource::TypeProgram:
+			case Resource::TypeFont:
+			default:
+				return false;	// Error, must be 2D or rectangle!
+		}
+	}
+
+	// Get texture scale - rectangle textures use non-normalized texture coordinates
+	if (cTextureBuffer.GetType() == Resource::TypeTextureBufferRectangle) {
+		vTextureCoordinateScale.x = static_cast<float>(static_cast<TextureBufferRectangle&>(cTextureBuffer).GetSize().x);
+		vTextureCoordinateScale.y = static_cast<float>(static_cast<TextureBufferRectangle&>(cTextureBuffer).GetSize().y);
+	} else {
+		vTextureCoordinateScale = Vector2::One;
+	}
+
+	// Done
+	return true;
+}
+
+/**
+*  @brief
+*    Returns the vertex colors of a gradient quad
+*/
+void DrawHelpersBackendShaders::GetGradientColors(const Color4 &cColor1, const Color4 &cColor2, float fAngle, Color4 cColors[4]) const
+{
+	const float fSin   = Math::Sin(fAngle);
+	const float fCos   = Math::Cos(fAngle);
+	const float fScale = 1.0f/(Math::Abs(fSin)+Math::Abs(fCos));
+	for (uint32 i=0; i<4; i++) {
+		// The vertices 0 and 1 share the first edge, the vertices 1 and 3 share the second edge (see DrawGradientQuad())
+		const bool bTop   = (i < 2);
+		const bool bRight = (i & 1) != 0;
+
+		// Calculate color
+		Color4 &cColor = cColors[i];
+		cColor = 0.0f;
+		// Horizontal color influence
+		if (fCos > 0.0f)
+			cColor += (bRight ? cColor2 : cColor1)* fCos;
+		if (fCos < 0.0f)
+			cColor += (bRight ? cColor1 : cColor2)*-fCos;
+		// Vertical color influence
+		if (fSin > 0.0f)
+			cColor = ((bTop ? cColor2 : cColor1)* fSin + cColor)*fScale;
+		if (fSin < 0.0f)
+			cColor = ((bTop ? cColor1 : cColor2)*-fSin + cColor)*fScale;
+		cColor.Saturate();
+	}
+}
+
+/**
+*  @brief
+*    Draws or batches a textured quad
+*/
+void DrawHelpersBackendShaders::DrawImageQuad(TextureBuffer &cTextureBuffer, SamplerStates &cSamplerStates, const Vector3 *pvPositions, const Vector2 *pvTexCoords, const Matrix4x4 &mObjectSpaceToClipSpace,
+											  const Color4 &cColor, float fAlphaReference, const Matrix4x4 &mTexture)
+{
+	// Add the image to the batches when batching, the texture matrix is applied right now
+	if (IsBatching()) {
+		Vector2 vTexCoords[4];
+		for (uint32 i=0; i<4; i++) {
+			const Vector4 vTexCoord = mTexture*Vector4(pvTexCoords[i].x, pvTexCoords[i].y, 1.0f, 1.0f);
+			vTexCoords[i].x = vTexCoord.x;
+			vTexCoords[i].y = vTexCoord.y;
+		}
+		if (AddToBatch(Primitive::TriangleStrip, pvPositions, 4, mObjectSpaceToClipSpace, cColor, nullptr, 0.0f, &cTextureBuffer, &cSamplerStates, fAlphaReference, vTexCoords))
+			return;
+	}
+
+	// Draw the batched primitives first to keep the draw order
+	Flush();
+
+	// Create vertex buffer
+	if (CreateTempBuffes()) {
+		// Setup the vertex buffer
+		if (m_pTempVertexBuffer->Lock(Lock::WriteOnly)) {
+			for (uint32 i=0; i<4; i++) {
+				float *pfVertex = static_cast<float*>(m_pTempVertexBuffer->GetData(i, VertexBuffer::Position));
+				pfVertex[0] = pvPositions[i].x;
+				pfVertex[1] = pvPositions[i].y;
+				pfVertex[2] = pvPositions[i].z;
+				pfVertex	= static_cast<float*>(m_pTempVertexBuffer->GetData(i, VertexBuffer::TexCoord));
+				pfVertex[0] = pvTexCoords[i].x;
+				pfVertex[1] = pvTexCoords[i].y;
+			}
+
+			// Unlock the vertex buffer
+			m_pTempVertexBuffer->Unlock();
+		}
+
+		// Use the image GPU program
+		if (UseImageProgram(*m_pTempVertexBuffer, cColor, mObjectSpaceToClipSpace, cTextureBuffer, cSamplerStates, fAlphaReference, mTexture)) {
+			// Draw image
+			m_pRenderer->DrawPrimitives(Primitive::TriangleStrip, 0, 4);
+		}
+	}
+}
+
+/**
+*  @brief
+*    Draws or batches a primitive
+*/
+void DrawHelpersBackendShaders::DrawPrimitive(Primitive::Enum nPrimitive, const Vector3 *pvPositions, uint32 nNumOfVertices, const Matrix4x4 &mObjectSpaceToClipSpace,
+											  const Color4 &cColor, const Color4 *pcVertexColors, float fSize)
+{
+	// Add the primitive to the batches when batching
+	if (AddToBatch(nPrimitive, pvPositions, nNumOfVertices, mObjectSpaceToClipSpace, cColor, pcVertexColors, fSize))
+		return;
+
+	// Draw the batched primitives first to keep the draw order
+	Flush();
+
+	// Create vertex buffer
+	if (CreateTempBuffes()) {
+		// The temp vertex buffer holds four vertices, larger point and line lists are drawn in pieces
+		for (uint32 nFirstVertex=0; nFirstVertex<nNumOfVertices; nFirstVertex+=4) {
+			const uint32 nNumOfPieceVertices = Math::Min(nNumOfVertices - nFirstVertex, static_cast<uint32>(4));
+
+			// Setup the vertex buffer
+			if (m_pTempVertexBuffer->Lock(Lock::WriteOnly)) {
+				for (uint32 i=0; i<nNumOfPieceVertices; i++) {
+					const Vector3 &vPosition = pvPositions[nFirstVertex + i];
+					float *pfVertex = static_cast<float*>(m_pTempVertexBuffer->GetData(i, VertexBuffer::Position));
+					pfVertex[0] = vPosition.x;
+					pfVertex[1] = vPosition.y;
+					pfVertex[2] = vPosition.z;
+					if (pcVertexColors)
+						m_pTempVertexBuffer->SetColor(i, pcVertexColors[nFirstVertex + i]);
+				}
+
+				// Unlock the vertex buffer
+				m_pTempVertexBuffer->Unlock();
+			}
+
+			// Use the primitive GPU program
+			if (UsePrimitiveProgram(*m_pTempVertexBuffer, pcVertexColors ? Color4::Null : cColor, mObjectSpaceToClipSpace, (nPrimitive == Primitive::PointList) ? fSize : 0.0f)) {
+				// Set the point size - used for Cg and OpenGL GLSL, for OpenGL ES 2.0, gl_PointSize is used within the vertex shader
+				if (nPrimitive == Primitive::PointList)
+					m_pRenderer->SetRenderState(RenderState::PointSize, Tools::FloatToUInt32(fSize));
+
+				// Set the line width
+				else if (nPrimitive == Primitive::LineList)
+					m_pRenderer->SetRenderState(RenderState::LineWidth, Tools::FloatToUInt32(fSize));
+
+				// Draw primitive
+				m_pRenderer->DrawPrimitives(nPrimitive, 0, nNumOfPieceVertices);
+			}
+		}
+	}
+}
+
 /**
 *  @brief
 *    Uses the image GPU program
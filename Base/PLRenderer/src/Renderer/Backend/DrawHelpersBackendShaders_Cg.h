@@ -36,7 +36,7 @@ struct VS_OUTPUT {\n\
 };\n\
 \n\
 // Programs\n\
-VS_OUTPUT main(float3 VertexPosition : POSITION			// Object space vertex position input\n\
+VS_OUTPUT main(float4 VertexPosition : POSITION			// Object space vertex position input (batched vertices are already in clip space)\n\
 	#ifdef VS_TEXCOORD0\n\
 		, float2 VertexTextureCoordinate : TEXCOORD0	// Vertex texture coordinate input\n\
 		, uniform float4x4 TextureMatrix				// Texture matrix\n\
@@ -50,7 +50,7 @@ VS_OUTPUT main(float3 VertexPosition : POSITION			// Object space vertex positio
 	VS_OUTPUT Out;\n\
 \n\
 	// Calculate the clip space vertex position\n\
-	Out.Position = mul(ObjectSpaceToClipSpaceMatrix, float4(VertexPosition, 1));\n\
+	Out.Position = mul(ObjectSpaceToClipSpaceMatrix, VertexPosition);\n\
 \n\
 #ifdef VS_TEXCOORD0\n\
 	// Pass through the texture coordinate\n\
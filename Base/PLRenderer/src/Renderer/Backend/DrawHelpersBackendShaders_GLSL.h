@@ -25,7 +25,7 @@
 // GLSL (OpenGL 2.0 ("#version 110") and OpenGL ES 2.0 ("#version 100")) vertex shader source code, "#version" is added by "PLRenderer::ProgramGenerator"
 static const PLCore::String sVertexShaderSourceCodeGLSL = "\
 // Attributes\n\
-attribute mediump vec3 VertexPosition;					// Object space vertex position input\n\
+attribute mediump vec4 VertexPosition;					// Object space vertex position input (batched vertices are already in clip space)\n\
 #ifdef VS_TEXCOORD0\n\
 	attribute mediump vec2 VertexTextureCoordinate;		// Vertex texture coordinate input\n\
 	varying   mediump vec2 VertexTextureCoordinateVS;	// Vertex texture coordinate output\n\
@@ -48,7 +48,7 @@ uniform mediump mat4 ObjectSpaceToClipSpaceMatrix;	// Object space to clip space
 void main()\n\
 {\n\
 	// Calculate the clip space vertex position, lower/left is (-1,-1) and upper/right is (1,1)\n\
-	gl_Position = ObjectSpaceToClipSpaceMatrix*vec4(VertexPosition, 1);\n\
+	gl_Position = ObjectSpaceToClipSpaceMatrix*VertexPosition;\n\
 \n\
 	#ifdef VS_TEXCOORD0\n\
 		// Pass through the texture coordinate\n\
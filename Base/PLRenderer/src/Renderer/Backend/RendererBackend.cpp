@@ -217,6 +217,9 @@ RendererBackend::RendererBackend(EMode nMode) :
 	m_ppCurrentTextureBuffer	= nullptr;
 	m_pCurrentIndexBuffer		= nullptr;
 
+	// Nothing was passed to the API, yet
+	InvalidateShadowStates();
+
 	// The rest is done by the API backends!
 }
 
@@ -358,6 +361,188 @@ bool RendererBackend::CheckTextureBufferCube(Image &cImage, TextureBuffer::EPixe
 	return (pImageBuffer && pImageBuffer->GetSize().x == pImageBuffer->GetSize().y && IsValidTextureBufferCubeSize(pImageBuffer->GetSize().x));
 }
 
+/**
+*  @brief
+*    Sets the current viewport and updates the viewport shadow state
+*/
+bool RendererBackend::UpdateViewport(const Rectangle *pRectangle, float fMinZ, float fMaxZ)
+{
+	// Backup the current viewport
+	const Rectangle cPreviousRect = m_cViewportRect;
+	const float fPreviousMinZ = m_fViewPortMinZ;
+	const float fPreviousMaxZ = m_fViewPortMaxZ;
+
+	// Set data
+	if (pRectangle) {
+		if (pRectangle->vMin.x > 0.0f)
+			m_cViewportRect.vMin.x = pRectangle->vMin.x;
+		else
+			m_cViewportRect.vMin.x = 0.0f;
+		if (pRectangle->vMin.y > 0.0f)
+			m_cViewportRect.vMin.y = pRectangle->vMin.y;
+		else
+			m_cViewportRect.vMin.y = 0.0f;
+		Surface *pSurface = m_cCurrentSurface.GetSurface();
+		if (pSurface) {
+			if (pRectangle->vMax.x > 0.0f)
+				m_cViewportRect.vMax.x = pRectangle->vMax.x;
+			else
+				m_cViewportRect.vMax.x = m_cViewportRect.vMin.x+pSurface->GetSize().x;
+			if (pRectangle->vMax.y > 0.0f)
+				m_cViewportRect.vMax.y = pRectangle->vMax.y;
+			else
+				m_cViewportRect.vMax.y = m_cViewportRect.vMin.y+pSurface->GetSize().y;
+		} else {
+			if (pRectangle->vMax.x > 0.0f)
+				m_cViewportRect.vMax.x = pRectangle->vMax.x;
+			else
+				m_cViewportRect.vMax.x = m_cViewportRect.vMin.x;
+			if (pRectangle->vMax.y > 0.0f)
+				m_cViewportRect.vMax.y = pRectangle->vMax.y;
+			else
+				m_cViewportRect.vMax.y = m_cViewportRect.vMin.y;
+		}
+	} else {
+		m_cViewportRect.vMin.x = 0;
+		m_cViewportRect.vMin.y = 0;
+		Surface *pSurface = m_cCurrentSurface.GetSurface();
+		if (pSurface) {
+			m_cViewportRect.vMax.x = static_cast<float>(pSurface->GetSize().x);
+			m_cViewportRect.vMax.y = static_cast<float>(pSurface->GetSize().y);
+		} else {
+			m_cViewportRect.vMax.x = 0;
+			m_cViewportRect.vMax.y = 0;
+		}
+	}
+	m_fViewPortMinZ = fMinZ;
+	m_fViewPortMaxZ = fMaxZ;
+
+	// Is the change redundant? API viewports are usually relative to the render target, so check the render target as well.
+	const Surface *pSurface = m_cCurrentSurface.GetSurface();
+	const int nHeight = pSurface ? pSurface->GetSize().y : 0;
+	if (m_bViewportShadowValid && m_pViewportShadowSurface == pSurface && m_nViewportShadowHeight == nHeight &&
+		m_cViewportRect.vMin == cPreviousRect.vMin && m_cViewportRect.vMax == cPreviousRect.vMax && m_fViewPortMinZ == fPreviousMinZ && m_fViewPortMaxZ == fPreviousMaxZ) {
+		m_sStatistics.nViewportFiltered++;
+
+		// Done, the API is already up-to-date
+		return false;
+	}
+
+	// The viewport must be passed to the API
+	m_bViewportShadowValid   = true;
+	m_pViewportShadowSurface = pSurface;
+	m_nViewportShadowHeight  = nHeight;
+	m_sStatistics.nViewportChanges++;
+
+	// Done
+	return true;
+}
+
+/**
+*  @brief
+*    Sets the current scissor rectangle and updates the scissor rectangle shadow state
+*/
+bool RendererBackend::UpdateScissorRect(const Rectangle *pRectangle)
+{
+	// Backup the current scissor rectangle
+	const Rectangle cPreviousRect = m_cScissorRect;
+
+	// Set data
+	if (pRectangle) {
+		if (pRectangle->vMin.x > 0.0f)
+			m_cScissorRect.vMin.x = pRectangle->vMin.x;
+		else
+			m_cScissorRect.vMin.x = m_cViewportRect.vMin.x;
+		if (pRectangle->vMin.y > 0.0f)
+			m_cScissorRect.vMin.y = pRectangle->vMin.y;
+		else
+			m_cScissorRect.vMin.y = m_cViewportRect.vMin.y;
+		if (pRectangle->vMax.x > 0.0f)
+			m_cScissorRect.vMax.x = pRectangle->vMax.x;
+		else
+			m_cScissorRect.vMax.x = m_cViewportRect.vMax.x;
+		if (pRectangle->vMax.y > 0.0f)
+			m_cScissorRect.vMax.y = pRectangle->vMax.y;
+		else
+			m_cScissorRect.vMax.y = m_cViewportRect.vMax.y;
+	} else {
+		m_cScissorRect = m_cViewportRect;
+	}
+
+	// Is the change redundant?
+	const Surface *pSurface = m_cCurrentSurface.GetSurface();
+	const int nHeight = pSurface ? pSurface->GetSize().y : 0;
+	if (m_bScissorShadowValid && m_pScissorShadowSurface == pSurface && m_nScissorShadowHeight == nHeight &&
+		m_cScissorRect.vMin == cPreviousRect.vMin && m_cScissorRect.vMax == cPreviousRect.vMax) {
+		m_sStatistics.nScissorRectFiltered++;
+
+		// Done, the API is already up-to-date
+		return false;
+	}
+
+	// The scissor rectangle must be passed to the API
+	m_bScissorShadowValid   = true;
+	m_pScissorShadowSurface = pSurface;
+	m_nScissorShadowHeight  = nHeight;
+	m_sStatistics.nScissorRectChanges++;
+
+	// Done
+	return true;
+}
+
+/**
+*  @brief
+*    Sets the current color mask and updates the color mask shadow state
+*/
+bool RendererBackend::UpdateColorMask(bool bRed, bool bGreen, bool bBlue, bool bAlpha)
+{
+	// Is the change redundant?
+	if (m_bColorMaskShadowValid && m_bColorMask[0] == bRed && m_bColorMask[1] == bGreen && m_bColorMask[2] == bBlue && m_bColorMask[3] == bAlpha) {
+		m_sStatistics.nColorMaskFiltered++;
+
+		// Done, the API is already up-to-date
+		return false;
+	}
+
+	// Set data
+	m_bColorMask[0] = bRed;
+	m_bColorMask[1] = bGreen;
+	m_bColorMask[2] = bBlue;
+	m_bColorMask[3] = bAlpha;
+
+	// The color mask must be passed to the API
+	m_bColorMaskShadowValid = true;
+	m_sStatistics.nColorMaskChanges++;
+
+	// Done
+	return true;
+}
+
+/**
+*  @brief
+*    Invalidates the viewport, scissor rectangle and color mask shadow states
+*/
+void RendererBackend::InvalidateShadowStates()
+{
+	m_bViewportShadowValid   = false;
+	m_pViewportShadowSurface = nullptr;
+	m_nViewportShadowHeight  = 0;
+	m_bScissorShadowValid    = false;
+	m_pScissorShadowSurface  = nullptr;
+	m_nScissorShadowHeight   = 0;
+	m_bColorMaskShadowValid  = false;
+}
+
+/**
+*  @brief
+*    Draws the primitives batched by the draw helpers
+*/
+void RendererBackend::FlushDrawHelpers()
+{
+	if (m_pDrawHelpers)
+		m_pDrawHelpers->Flush();
+}
+
 
 //[-------------------------------------------------------]
 //[ Public virtual Renderer functions                     ]
@@ -474,6 +659,10 @@ void RendererBackend::Update()
 		pProfiling->Set(sAPI, "Number of resources",			GetNumOfResources());
 		pProfiling->Set(sAPI, "Render state changes",			sS.nRenderStateChanges);
 		pProfiling->Set(sAPI, "Sampler state changes",			sS.nSamplerStateChanges);
+		pProfiling->Set(sAPI, "Filtered state changes",			String::Format("%d render, %d sampler",	sS.nRenderStateFiltered, sS.nSamplerStateFiltered));
+		pProfiling->Set(sAPI, "Viewport changes",				String::Format("%d (%d filtered)",		sS.nViewportChanges, sS.nViewportFiltered));
+		pProfiling->Set(sAPI, "Scissor rectangle changes",		String::Format("%d (%d filtered)",		sS.nScissorRectChanges, sS.nScissorRectFiltered));
+		pProfiling->Set(sAPI, "Color mask changes",				String::Format("%d (%d filtered)",		sS.nColorMaskChanges, sS.nColorMaskFiltered));
 		pProfiling->Set(sAPI, "Draw primitive calls",			sS.nDrawPrimitivCalls);
 		pProfiling->Set(sAPI, "Current triangles",				sS.nTriangles);
 		pProfiling->Set(sAPI, "Current vertices",				sS.nVertices);
@@ -482,7 +671,7 @@ void RendererBackend::Update()
 		pProfiling->Set(sAPI, "Number of texture buffers",		sS.nTextureBuffersNum);
 		const float fTextureBuffersMemKB = static_cast<float>(sS.nTextureBuffersMem)/1024.0f;
 		pProfiling->Set(sAPI, "Texture buffers memory",			String::Format("%g KB (%g MB)",			fTextureBuffersMemKB, fTextureBuffersMemKB/1024.0f));
-		pProfiling->Set(sAPI, "Texture buffer binds",			sS.nTextureBufferBinds);
+		pProfiling->Set(sAPI, "Texture buffer binds",			String::Format("%d (%d filtered)",		sS.nTextureBufferBinds, sS.nTextureBufferFiltered));
 		// Vertex buffers
 		pProfiling->Set(sAPI, "Number of vertex buffers",		sS.nVertexBufferNum);
 		const float fVertexBufferMemKB = static_cast<float>(sS.nVertexBufferMem)/1024.0f;
@@ -493,25 +682,49 @@ void RendererBackend::Update()
 		const float fIndexBufferMemKB = static_cast<float>(sS.nIndexBufferMem)/1024.0f;
 		pProfiling->Set(sAPI, "Index buffers memory",			String::Format("%g KB (%g MB)",			fIndexBufferMemKB, fIndexBufferMemKB/1024.0f));
 		pProfiling->Set(sAPI, "Index buffers update time",		String::Format("%.3f ms (%d locks)",	sS.nIndexBuffersSetupTime/1000.0f, sS.nIndexBufferLocks));
+		pProfiling->Set(sAPI, "Index buffer binds",				String::Format("%d (%d filtered)",		sS.nIndexBufferBinds, sS.nIndexBufferFiltered));
+		// Programs
+		pProfiling->Set(sAPI, "Program binds",					String::Format("%d (%d filtered)",		sS.nProgramBinds, sS.nProgramFiltered));
+		pProfiling->Set(sAPI, "Uniform changes",				String::Format("%d (%d filtered)",		sS.nUniformChanges, sS.nUniformFiltered));
 		// Uniform buffers
 		pProfiling->Set(sAPI, "Number of uniform buffers",		sS.nUniformBufferNum);
 		const float fUniformBufferMemKB = static_cast<float>(sS.nUniformBufferMem)/1024.0f;
 		pProfiling->Set(sAPI, "Uniform buffers memory",			String::Format("%g KB (%g MB)",			fUniformBufferMemKB, fUniformBufferMemKB/1024.0f));
 		pProfiling->Set(sAPI, "Uniform buffers update time",	String::Format("%.3f ms (%d locks)",	sS.nUniformBuffersSetupTime/1000.0f, sS.nUniformBufferLocks));
+		// Draw helpers
+		pProfiling->Set(sAPI, "Draw helper batches",			String::Format("%d (%d primitives, %d flushes)", sS.nDrawHelpersBatches, sS.nDrawHelpersPrimitives, sS.nDrawHelpersFlushes));
 	}
 
 	// Reset some statistics
 	m_sStatistics.nRenderStateChanges		= 0;
 	m_sStatistics.nSamplerStateChanges		= 0;
+	m_sStatistics.nRenderStateFiltered		= 0;
+	m_sStatistics.nSamplerStateFiltered		= 0;
+	m_sStatistics.nViewportChanges			= 0;
+	m_sStatistics.nViewportFiltered			= 0;
+	m_sStatistics.nScissorRectChanges		= 0;
+	m_sStatistics.nScissorRectFiltered		= 0;
+	m_sStatistics.nColorMaskChanges			= 0;
+	m_sStatistics.nColorMaskFiltered		= 0;
 	m_sStatistics.nDrawPrimitivCalls		= 0;
 	m_sStatistics.nVertices					= 0;
 	m_sStatistics.nTriangles				= 0;
 	m_sStatistics.fRenderingTime			= 0.0f;
 	m_sStatistics.nTextureBufferBinds		= 0;
+	m_sStatistics.nTextureBufferFiltered	= 0;
 	m_sStatistics.nVertexBuffersSetupTime	= 0;
 	m_sStatistics.nVertexBufferLocks		= 0;
 	m_sStatistics.nIndexBuffersSetupTime	= 0;
 	m_sStatistics.nIndexBufferLocks			= 0;
+	m_sStatistics.nIndexBufferBinds			= 0;
+	m_sStatistics.nIndexBufferFiltered		= 0;
+	m_sStatistics.nProgramBinds				= 0;
+	m_sStatistics.nProgramFiltered			= 0;
+	m_sStatistics.nUniformChanges			= 0;
+	m_sStatistics.nUniformFiltered			= 0;
+	m_sStatistics.nDrawHelpersPrimitives	= 0;
+	m_sStatistics.nDrawHelpersBatches		= 0;
+	m_sStatistics.nDrawHelpersFlushes		= 0;
 }
 
 void RendererBackend::Reset()
@@ -672,50 +885,8 @@ const Rectangle &RendererBackend::GetViewport(float *pfMinZ, float *pfMaxZ) cons
 
 bool RendererBackend::SetViewport(const Rectangle *pRectangle, float fMinZ, float fMaxZ)
 {
-	// Set data
-	if (pRectangle) {
-		if (pRectangle->vMin.x > 0.0f)
-			m_cViewportRect.vMin.x = pRectangle->vMin.x;
-		else
-			m_cViewportRect.vMin.x = 0.0f;
-		if (pRectangle->vMin.y > 0.0f)
-			m_cViewportRect.vMin.y = pRectangle->vMin.y;
-		else
-			m_cViewportRect.vMin.y = 0.0f;
-		Surface *pSurface = m_cCurrentSurface.GetSurface();
-		if (pSurface) {
-			if (pRectangle->vMax.x > 0.0f)
-				m_cViewportRect.vMax.x = pRectangle->vMax.x;
-			else
-				m_cViewportRect.vMax.x = m_cViewportRect.vMin.x+pSurface->GetSize().x;
-			if (pRectangle->vMax.y > 0.0f)
-				m_cViewportRect.vMax.y = pRectangle->vMax.y;
-			else
-				m_cViewportRect.vMax.y = m_cViewportRect.vMin.y+pSurface->GetSize().y;
-		} else {
-			if (pRectangle->vMax.x > 0.0f)
-				m_cViewportRect.vMax.x = pRectangle->vMax.x;
-			else
-				m_cViewportRect.vMax.x = m_cViewportRect.vMin.x;
-			if (pRectangle->vMax.y > 0.0f)
-				m_cViewportRect.vMax.y = pRectangle->vMax.y;
-			else
-				m_cViewportRect.vMax.y = m_cViewportRect.vMin.y;
-		}
-	} else {
-		m_cViewportRect.vMin.x = 0;
-		m_cViewportRect.vMin.y = 0;
-		Surface *pSurface = m_cCurrentSurface.GetSurface();
-		if (pSurface) {
-			m_cViewportRect.vMax.x = static_cast<float>(pSurface->GetSize().x);
-			m_cViewportRect.vMax.y = static_cast<float>(pSurface->GetSize().y);
-		} else {
-			m_cViewportRect.vMax.x = 0;
-			m_cViewportRect.vMax.y = 0;
-		}
-	}
-	m_fViewPortMinZ = fMinZ;
-	m_fViewPortMaxZ = fMaxZ;
+	// Update the shadow state, there's no API to pass the viewport to
+	UpdateViewport(pRectangle, fMinZ, fMaxZ);
 
 	// Done
 	return true;
@@ -728,33 +899,13 @@ const Rectangle &RendererBackend::GetScissorRect() const
 
 bool RendererBackend::SetScissorRect(const Rectangle *pRectangle)
 {
-	// Set data
-	if (pRectangle) {
-		if (pRectangle->vMin.x > 0.0f)
-			m_cScissorRect.vMin.x = pRectangle->vMin.x;
-		else
-			m_cScissorRect.vMin.x = m_cViewportRect.vMin.x;
-		if (pRectangle->vMin.y > 0.0f)
-			m_cScissorRect.vMin.y = pRectangle->vMin.y;
-		else
-			m_cScissorRect.vMin.y = m_cViewportRect.vMin.y;
-		if (pRectangle->vMax.x > 0.0f)
-			m_cScissorRect.vMax.x = pRectangle->vMax.x;
-		else
-			m_cScissorRect.vMax.x = m_cViewportRect.vMax.x;
-		if (pRectangle->vMax.y > 0.0f)
-			m_cScissorRect.vMax.y = pRectangle->vMax.y;
-		else
-			m_cScissorRect.vMax.y = m_cViewportRect.vMax.y;
-	} else {
-		m_cScissorRect = m_cViewportRect;
-	}
+	// Update the shadow state, there's no API to pass the scissor rectangle to
+	UpdateScissorRect(pRectangle);
 
 	// Done
 	return true;
 }
 
-
 //[-------------------------------------------------------]
 //[ Get/set current resources                             ]
 //[-------------------------------------------------------]
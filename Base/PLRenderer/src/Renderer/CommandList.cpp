@@ -0,0 +1,717 @@
+/*********************************************************\
+ *  File: CommandList.cpp                                *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <PLCore/Core/MemoryManager.h>
+#include <PLMath/Vector2.h>
+#include <PLMath/Vector4.h>
+#include <PLMath/Rectangle.h>
+#include <PLMath/Matrix3x3.h>
+#include <PLMath/Matrix4x4.h>
+#include "PLRenderer/Renderer/Renderer.h"
+#include "PLRenderer/Renderer/ProgramUniform.h"
+#include "PLRenderer/Renderer/ProgramAttribute.h"
+#include "PLRenderer/Renderer/CommandList.h"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+using namespace PLCore;
+using namespace PLMath;
+using namespace PLGraphics;
+namespace PLRenderer {
+
+
+//[-------------------------------------------------------]
+//[ Local definitions                                     ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Command types
+*/
+enum ECommand {
+	// States
+	CommandSetRenderState,
+	CommandSetSamplerState,
+	CommandSetViewport,
+	CommandSetScissorRect,
+	CommandSetColorMask,
+	CommandClear,
+	// Set current resources
+	CommandSetRenderTarget,
+	CommandSetTextureBuffer,
+	CommandSetIndexBuffer,
+	CommandSetProgram,
+	// Program attributes and uniforms
+	CommandSetProgramAttribute,
+	CommandSetProgramUniformInt,
+	CommandSetProgramUniformFloat,
+	CommandSetProgramUniformMatrix3x3,
+	CommandSetProgramUniformMatrix4x4,
+	CommandSetProgramUniformTextureBuffer,
+	// Draw call
+	CommandDrawPrimitives,
+	CommandDrawIndexedPrimitives,
+	CommandDrawPatches,
+	CommandDrawIndexedPatches
+};
+
+/**
+*  @brief
+*    Command header, each command starts with this header followed by the command data
+*/
+struct CommandHeader {
+	uint32 nType;	/**< Command type (see ECommand) */
+	uint32 nSize;	/**< Size of the command including this header in bytes, multiple of the command alignment */
+};
+static const uint32 CommandAlignment = 8;	/**< Alignment of the commands in bytes, all command data is aligned to pointer size */
+
+/**
+*  @brief
+*    Command data
+*/
+struct CommandStateData {
+	uint32 nStage;	/**< Sampler stage, unused for render states */
+	uint32 nState;
+	uint32 nValue;
+};
+struct CommandRectangleData {
+	bool  bRectangle;	/**< Is there a rectangle? If not, the default rectangle is used */
+	float fRectangle[4];
+	float fMinZ;
+	float fMaxZ;
+};
+struct CommandColorMaskData {
+	bool bRed, bGreen, bBlue, bAlpha;
+};
+struct CommandClearData {
+	uint32 nFlags;
+	float  fColor[4];
+	float  fZ;
+	uint32 nStencil;
+};
+struct CommandResourceData {
+	void  *pResource;
+	int    nIndex;	/**< Face or stage */
+};
+struct CommandProgramAttributeData {
+	ProgramAttribute *pAttribute;
+	VertexBuffer	 *pVertexBuffer;
+	uint32			  nSemantic;
+	uint32			  nChannel;
+};
+struct CommandProgramUniformData {
+	ProgramUniform *pUniform;
+	uint32			nNumOfComponents;	/**< Number of components following this command data (float or int) */
+	bool			bTranspose;			/**< Transpose matrix? */
+};
+struct CommandDrawData {
+	uint32 nType;				/**< Primitive type, vertices per patch for patches */
+	uint32 nMinIndex;
+	uint32 nMaxIndex;
+	uint32 nStartIndex;
+	uint32 nNumVertices;
+	uint32 nNumOfInstances;		/**< 0 if not instanced */
+};
+
+
+//[-------------------------------------------------------]
+//[ Public functions                                      ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Constructor
+*/
+CommandList::CommandList() :
+	m_pnBuffer(nullptr),
+	m_nBufferSize(0),
+	m_nMaxBufferSize(0),
+	m_nNumOfCommands(0)
+{
+}
+
+/**
+*  @brief
+*    Destructor
+*/
+CommandList::~CommandList()
+{
+	if (m_pnBuffer)
+		delete [] m_pnBuffer;
+}
+
+
+//[-------------------------------------------------------]
+//[ States                                                ]
+//[-------------------------------------------------------]
+void CommandList::SetRenderState(RenderState::Enum nState, uint32 nValue)
+{
+	CommandStateData *pCommand = static_cast<CommandStateData*>(AddCommand(CommandSetRenderState, sizeof(CommandStateData)));
+	pCommand->nStage = 0;
+	pCommand->nState = nState;
+	pCommand->nValue = nValue;
+}
+
+void CommandList::SetSamplerState(uint32 nStage, Sampler::Enum nState, uint32 nValue)
+{
+	CommandStateData *pCommand = static_cast<CommandStateData*>(AddCommand(CommandSetSamplerState, sizeof(CommandStateData)));
+	pCommand->nStage = nStage;
+	pCommand->nState = nState;
+	pCommand->nValue = nValue;
+}
+
+void CommandList::SetViewport(const Rectangle *pRectangle, float fMinZ, float fMaxZ)
+{
+	CommandRectangleData *pCommand = static_cast<CommandRectangleData*>(AddCommand(CommandSetViewport, sizeof(CommandRectangleData)));
+	pCommand->bRectangle = (pRectangle != nullptr);
+	if (pRectangle) {
+		pCommand->fRectangle[0] = pRectangle->vMin.x;
+		pCommand->fRectangle[1] = pRectangle->vMin.y;
+		pCommand->fRectangle[2] = pRectangle->vMax.x;
+		pCommand->fRectangle[3] = pRectangle->vMax.y;
+	}
+	pCommand->fMinZ = fMinZ;
+	pCommand->fMaxZ = fMaxZ;
+}
+
+void CommandList::SetScissorRect(const Rectangle *pRectangle)
+{
+	CommandRectangleData *pCommand = static_cast<CommandRectangleData*>(AddCommand(CommandSetScissorRect, sizeof(CommandRectangleData)));
+	pCommand->bRectangle = (pRectangle != nullptr);
+	if (pRectangle) {
+		pCommand->fRectangle[0] = pRectangle->vMin.x;
+		pCommand->fRectangle[1] = pRectangle->vMin.y;
+		pCommand->fRectangle[2] = pRectangle->vMax.x;
+		pCommand->fRectangle[3] = pRectangle->vMax.y;
+	}
+}
+
+void CommandList::SetColorMask(bool bRed, bool bGreen, bool bBlue, bool bAlpha)
+{
+	CommandColorMaskData *pCommand = static_cast<CommandColorMaskData*>(AddCommand(CommandSetColorMask, sizeof(CommandColorMaskData)));
+	pCommand->bRed   = bRed;
+	pCommand->bGreen = bGreen;
+	pCommand->bBlue  = bBlue;
+	pCommand->bAlpha = bAlpha;
+}
+
+void CommandList::Clear(uint32 nFlags, const Color4 &cColor, float fZ, uint32 nStencil)
+{
+	CommandClearData *pCommand = static_cast<CommandClearData*>(AddCommand(CommandClear, sizeof(CommandClearData)));
+	pCommand->nFlags = nFlags;
+	MemoryManager::Copy(pCommand->fColor, static_cast<const float*>(cColor), sizeof(float)*4);
+	pCommand->fZ       = fZ;
+	pCommand->nStencil = nStencil;
+}
+
+
+//[-------------------------------------------------------]
+//[ Set current resources                                 ]
+//[-------------------------------------------------------]
+void CommandList::SetRenderTarget(Surface *pSurface, uint8 nFace)
+{
+	CommandResourceData *pCommand = static_cast<CommandResourceData*>(AddCommand(CommandSetRenderTarget, sizeof(CommandResourceData)));
+	pCommand->pResource = pSurface;
+	pCommand->nIndex    = nFace;
+}
+
+void CommandList::SetTextureBuffer(int nStage, TextureBuffer *pTextureBuffer)
+{
+	CommandResourceData *pCommand = static_cast<CommandResourceData*>(AddCommand(CommandSetTextureBuffer, sizeof(CommandResourceData)));
+	pCommand->pResource = pTextureBuffer;
+	pCommand->nIndex    = nStage;
+}
+
+void CommandList::SetIndexBuffer(IndexBuffer *pIndexBuffer)
+{
+	CommandResourceData *pCommand = static_cast<CommandResourceData*>(AddCommand(CommandSetIndexBuffer, sizeof(CommandResourceData)));
+	pCommand->pResource = pIndexBuffer;
+	pCommand->nIndex    = 0;
+}
+
+void CommandList::SetProgram(Program *pProgram)
+{
+	CommandResourceData *pCommand = static_cast<CommandResourceData*>(AddCommand(CommandSetProgram, sizeof(CommandResourceData)));
+	pCommand->pResource = pProgram;
+	pCommand->nIndex    = 0;
+}
+
+
+//[-------------------------------------------------------]
+//[ Program attributes and uniforms                       ]
+//[-------------------------------------------------------]
+void CommandList::SetProgramAttribute(ProgramAttribute &cAttribute, VertexBuffer *pVertexBuffer, VertexBuffer::ESemantic nSemantic, uint32 nChannel)
+{
+	CommandProgramAttributeData *pCommand = static_cast<CommandProgramAttributeData*>(AddCommand(CommandSetProgramAttribute, sizeof(CommandProgramAttributeData)));
+	pCommand->pAttribute    = &cAttribute;
+	pCommand->pVertexBuffer = pVertexBuffer;
+	pCommand->nSemantic     = nSemantic;
+	pCommand->nChannel      = nChannel;
+}
+
+void CommandList::SetProgramUniform(ProgramUniform &cUniform, int nX)
+{
+	CommandProgramUniformData *pCommand = static_cast<CommandProgramUniformData*>(AddCommand(CommandSetProgramUniformInt, sizeof(CommandProgramUniformData) + sizeof(int)));
+	pCommand->pUniform		   = &cUniform;
+	pCommand->nNumOfComponents = 1;
+	pCommand->bTranspose	   = false;
+	*reinterpret_cast<int*>(pCommand + 1) = nX;
+}
+
+void CommandList::SetProgramUniform(ProgramUniform &cUniform, float fX)
+{
+	CommandProgramUniformData *pCommand = static_cast<CommandProgramUniformData*>(AddCommand(CommandSetProgramUniformFloat, sizeof(CommandProgramUniformData) + sizeof(float)));
+	pCommand->pUniform		   = &cUniform;
+	pCommand->nNumOfComponents = 1;
+	pCommand->bTranspose	   = false;
+	*reinterpret_cast<float*>(pCommand + 1) = fX;
+}
+
+void CommandList::SetProgramUniform(ProgramUniform &cUniform, const Vector2 &vVector)
+{
+	CommandProgramUniformData *pCommand = static_cast<CommandProgramUniformData*>(AddCommand(CommandSetProgramUniformFloat, sizeof(CommandProgramUniformData) + sizeof(float)*2));
+	pCommand->pUniform		   = &cUniform;
+	pCommand->nNumOfComponents = 2;
+	pCommand->bTranspose	   = false;
+	MemoryManager::Copy(pCommand + 1, static_cast<const float*>(vVector), sizeof(float)*2);
+}
+
+void CommandList::SetProgramUniform(ProgramUniform &cUniform, const Vector3 &vVector)
+{
+	CommandProgramUniformData *pCommand = static_cast<CommandProgramUniformData*>(AddCommand(CommandSetProgramUniformFloat, sizeof(CommandProgramUniformData) + sizeof(float)*3));
+	pCommand->pUniform		   = &cUniform;
+	pCommand->nNumOfComponents = 3;
+	pCommand->bTranspose	   = false;
+	MemoryManager::Copy(pCommand + 1, static_cast<const float*>(vVector), sizeof(float)*3);
+}
+
+void CommandList::SetProgramUniform(ProgramUniform &cUniform, const Vector4 &vVector)
+{
+	CommandProgramUniformData *pCommand = static_cast<CommandProgramUniformData*>(AddCommand(CommandSetProgramUniformFloat, sizeof(CommandProgramUniformData) + sizeof(float)*4));
+	pCommand->pUniform		   = &cUniform;
+	pCommand->nNumOfComponents = 4;
+	pCommand->bTranspose	   = false;
+	MemoryManager::Copy(pCommand + 1, static_cast<const float*>(vVector), sizeof(float)*4);
+}
+
+void CommandList::SetProgramUniform(ProgramUniform &cUniform, const Color4 &cColor)
+{
+	CommandProgramUniformData *pCommand = static_cast<CommandProgramUniformData*>(AddCommand(CommandSetProgramUniformFloat, sizeof(CommandProgramUniformData) + sizeof(float)*4));
+	pCommand->pUniform		   = &cUniform;
+	pCommand->nNumOfComponents = 4;
+	pCommand->bTranspose	   = false;
+	MemoryManager::Copy(pCommand + 1, static_cast<const float*>(cColor), sizeof(float)*4);
+}
+
+void CommandList::SetProgramUniform(ProgramUniform &cUniform, const Matrix3x3 &mMatrix, bool bTranspose)
+{
+	CommandProgramUniformData *pCommand = static_cast<CommandProgramUniformData*>(AddCommand(CommandSetProgramUniformMatrix3x3, sizeof(CommandProgramUniformData) + sizeof(float)*9));
+	pCommand->pUniform		   = &cUniform;
+	pCommand->nNumOfComponents = 9;
+	pCommand->bTranspose	   = bTranspose;
+	MemoryManager::Copy(pCommand + 1, static_cast<const float*>(mMatrix), sizeof(float)*9);
+}
+
+void CommandList::SetProgramUniform(ProgramUniform &cUniform, const Matrix4x4 &mMatrix, bool bTranspose)
+{
+	CommandProgramUniformData *pCommand = static_cast<CommandProgramUniformData*>(AddCommand(CommandSetProgramUniformMatrix4x4, sizeof(CommandProgramUniformData) + sizeof(float)*16));
+	pCommand->pUniform		   = &cUniform;
+	pCommand->nNumOfComponents = 16;
+	pCommand->bTranspose	   = bTranspose;
+	MemoryManager::Copy(pCommand + 1, static_cast<const float*>(mMatrix), sizeof(float)*16);
+}
+
+void CommandList::SetProgramUniform(ProgramUniform &cUniform, TextureBuffer *pTextureBuffer)
+{
+	CommandProgramUniformData *pCommand = static_cast<CommandProgramUniformData*>(AddCommand(CommandSetProgramUniformTextureBuffer, sizeof(CommandProgramUniformData) + sizeof(TextureBuffer*)));
+	pCommand->pUniform		   = &cUniform;
+	pCommand->nNumOfComponents = 0;
+	pCommand->bTranspose	   = false;
+	*reinterpret_cast<TextureBuffer**>(pCommand + 1) = pTextureBuffer;
+}
+
+
+//[-------------------------------------------------------]
+//[ Draw call                                             ]
+//[-------------------------------------------------------]
+void CommandList::DrawPrimitives(Primitive::Enum nType, uint32 nStartIndex, uint32 nNumVertices)
+{
+	DrawPrimitivesInstanced(nType, nStartIndex, nNumVertices, 0);
+}
+
+void CommandList::DrawIndexedPrimitives(Primitive::Enum nType, uint32 nMinIndex, uint32 nMaxIndex, uint32 nStartIndex, uint32 nNumVertices)
+{
+	DrawIndexedPrimitivesInstanced(nType, nMinIndex, nMaxIndex, nStartIndex, nNumVertices, 0);
+}
+
+void CommandList::DrawPatches(uint32 nVerticesPerPatch, uint32 nStartIndex, uint32 nNumVertices)
+{
+	DrawPatchesInstanced(nVerticesPerPatch, nStartIndex, nNumVertices, 0);
+}
+
+void CommandList::DrawIndexedPatches(uint32 nVerticesPerPatch, uint32 nMinIndex, uint32 nMaxIndex, uint32 nStartIndex, uint32 nNumVertices)
+{
+	DrawIndexedPatchesInstanced(nVerticesPerPatch, nMinIndex, nMaxIndex, nStartIndex, nNumVertices, 0);
+}
+
+void CommandList::DrawPrimitivesInstanced(Primitive::Enum nType, uint32 nStartIndex, uint32 nNumVertices, uint32 nNumOfInstances)
+{
+	CommandDrawData *pCommand = static_cast<CommandDrawData*>(AddCommand(CommandDrawPrimitives, sizeof(CommandDrawData)));
+	pCommand->nType			  = nType;
+	pCommand->nMinIndex		  = 0;
+	pCommand->nMaxIndex		  = 0;
+	pCommand->nStartIndex	  = nStartIndex;
+	pCommand->nNumVertices	  = nNumVertices;
+	pCommand->nNumOfInstances = nNumOfInstances;
+}
+
+void CommandList::DrawIndexedPrimitivesInstanced(Primitive::Enum nType, uint32 nMinIndex, uint32 nMaxIndex, uint32 nStartIndex, uint32 nNumVertices, uint32 nNumOfInstances)
+{
+	CommandDrawData *pCommand = static_cast<CommandDrawData*>(AddCommand(CommandDrawIndexedPrimitives, sizeof(CommandDrawData)));
+	pCommand->nType			  = nType;
+	pCommand->nMinIndex		  = nMinIndex;
+	pCommand->nMaxIndex		  = nMaxIndex;
+	pCommand->nStartIndex	  = nStartIndex;
+	pCommand->nNumVertices	  = nNumVertices;
+	pCommand->nNumOfInstances = nNumOfInstances;
+}
+
+void CommandList::DrawPatchesInstanced(uint32 nVerticesPerPatch, uint32 nStartIndex, uint32 nNumVertices, uint32 nNumOfInstances)
+{
+	CommandDrawData *pCommand = static_cast<CommandDrawData*>(AddCommand(CommandDrawPatches, sizeof(CommandDrawData)));
+	pCommand->nType			  = nVerticesPerPatch;
+	pCommand->nMinIndex		  = 0;
+	pCommand->nMaxIndex		  = 0;
+	pCommand->nStartIndex	  = nStartIndex;
+	pCommand->nNumVertices	  = nNumVertices;
+	pCommand->nNumOfInstances = nNumOfInstances;
+}
+
+void CommandList::DrawIndexedPatchesInstanced(uint32 nVerticesPerPatch, uint32 nMinIndex, uint32 nMaxIndex, uint32 nStartIndex, uint32 nNumVertices, uint32 nNumOfInstances)
+{
+	CommandDrawData *pCommand = static_cast<CommandDrawData*>(AddCommand(CommandDrawIndexedPatches, sizeof(CommandDrawData)));
+	pCommand->nType			  = nVerticesPerPatch;
+	pCommand->nMinIndex		  = nMinIndex;
+	pCommand->nMaxIndex		  = nMaxIndex;
+	pCommand->nStartIndex	  = nStartIndex;
+	pCommand->nNumVertices	  = nNumVertices;
+	pCommand->nNumOfInstances = nNumOfInstances;
+}
+
+
+//[-------------------------------------------------------]
+//[ Private functions                                     ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Copy constructor
+*/
+CommandList::CommandList(const CommandList &cSource) :
+	m_pnBuffer(nullptr),
+	m_nBufferSize(0),
+	m_nMaxBufferSize(0),
+	m_nNumOfCommands(0)
+{
+	// No implementation because the copy constructor is never used
+}
+
+/**
+*  @brief
+*    Copy operator
+*/
+CommandList &CommandList::operator =(const CommandList &cSource)
+{
+	// No implementation because the copy operator is never used
+	return *this;
+}
+
+/**
+*  @brief
+*    Adds a command
+*/
+void *CommandList::AddCommand(uint32 nType, uint32 nSize)
+{
+	// Get the size of the command including the header, keep the next command aligned
+	const uint32 nCommandSize = (sizeof(CommandHeader) + nSize + CommandAlignment - 1) & ~(CommandAlignment - 1);
+
+	// Enlarge the buffer if required, the size is doubled to avoid frequent reallocations
+	if (m_nBufferSize + nCommandSize > m_nMaxBufferSize) {
+		uint32 nMaxBufferSize = m_nMaxBufferSize ? m_nMaxBufferSize*2 : 4096;
+		while (m_nBufferSize + nCommandSize > nMaxBufferSize)
+			nMaxBufferSize *= 2;
+		uint8 *pnBuffer = new uint8[nMaxBufferSize];
+		if (m_pnBuffer) {
+			MemoryManager::Copy(pnBuffer, m_pnBuffer, m_nBufferSize);
+			delete [] m_pnBuffer;
+		}
+		m_pnBuffer       = pnBuffer;
+		m_nMaxBufferSize = nMaxBufferSize;
+	}
+
+	// Add the command
+	CommandHeader *pHeader = reinterpret_cast<CommandHeader*>(m_pnBuffer + m_nBufferSize);
+	pHeader->nType = nType;
+	pHeader->nSize = nCommandSize;
+	m_nBufferSize += nCommandSize;
+	m_nNumOfCommands++;
+
+	// Return the command data
+	return pHeader + 1;
+}
+
+/**
+*  @brief
+*    Replays the recorded commands
+*/
+bool CommandList::Replay(Renderer &cRenderer) const
+{
+	bool bResult = true; // No error by default
+
+	// Loop through all recorded commands
+	const uint8 *pnCommand    = m_pnBuffer;
+	const uint8 *pnCommandEnd = m_pnBuffer + m_nBufferSize;
+	while (pnCommand < pnCommandEnd) {
+		const CommandHeader *pHeader = reinterpret_cast<const CommandHeader*>(pnCommand);
+		const void *pData = pHeader + 1;
+		switch (pHeader->nType) {
+		// States
+			case CommandSetRenderState:
+			{
+				const CommandStateData *pCommand = static_cast<const CommandStateData*>(pData);
+				if (!cRenderer.SetRenderState(static_cast<RenderState::Enum>(pCommand->nState), pCommand->nValue))
+					bResult = false; // Error!
+				break;
+			}
+
+			case CommandSetSamplerState:
+			{
+				const CommandStateData *pCommand = static_cast<const CommandStateData*>(pData);
+				if (!cRenderer.SetSamplerState(pCommand->nStage, static_cast<Sampler::Enum>(pCommand->nState), pCommand->nValue))
+					bResult = false; // Error!
+				break;
+			}
+
+			case CommandSetViewport:
+			{
+				const CommandRectangleData *pCommand = static_cast<const CommandRectangleData*>(pData);
+				if (pCommand->bRectangle) {
+					const Rectangle cRectangle(pCommand->fRectangle[0], pCommand->fRectangle[1], pCommand->fRectangle[2], pCommand->fRectangle[3]);
+					if (!cRenderer.SetViewport(&cRectangle, pCommand->fMinZ, pCommand->fMaxZ))
+						bResult = false; // Error!
+				} else {
+					if (!cRenderer.SetViewport(nullptr, pCommand->fMinZ, pCommand->fMaxZ))
+						bResult = false; // Error!
+				}
+				break;
+			}
+
+			case CommandSetScissorRect:
+			{
+				const CommandRectangleData *pCommand = static_cast<const CommandRectangleData*>(pData);
+				if (pCommand->bRectangle) {
+					const Rectangle cRectangle(pCommand->fRectangle[0], pCommand->fRectangle[1], pCommand->fRectangle[2], pCommand->fRectangle[3]);
+					if (!cRenderer.SetScissorRect(&cRectangle))
+						bResult = false; // Error!
+				} else {
+					if (!cRenderer.SetScissorRect(nullptr))
+						bResult = false; // Error!
+				}
+				break;
+			}
+
+			case CommandSetColorMask:
+			{
+				const CommandColorMaskData *pCommand = static_cast<const CommandColorMaskData*>(pData);
+				if (!cRenderer.SetColorMask(pCommand->bRed, pCommand->bGreen, pCommand->bBlue, pCommand->bAlpha))
+					bResult = false; // Error!
+				break;
+			}
+
+			case CommandClear:
+			{
+				const CommandClearData *pCommand = static_cast<const CommandClearData*>(pData);
+				if (!cRenderer.Clear(pCommand->nFlags, Color4(pCommand->fColor), pCommand->fZ, pCommand->nStencil))
+					bResult = false; // Error!
+				break;
+			}
+
+		// Set current resources
+			case CommandSetRenderTarget:
+			{
+				const CommandResourceData *pCommand = static_cast<const CommandResourceData*>(pData);
+				if (!cRenderer.SetRenderTarget(static_cast<Surface*>(pCommand->pResource), static_cast<uint8>(pCommand->nIndex)))
+					bResult = false; // Error!
+				break;
+			}
+
+			case CommandSetTextureBuffer:
+			{
+				const CommandResourceData *pCommand = static_cast<const CommandResourceData*>(pData);
+				if (!cRenderer.SetTextureBuffer(pCommand->nIndex, static_cast<TextureBuffer*>(pCommand->pResource)))
+					bResult = false; // Error!
+				break;
+			}
+
+			case CommandSetIndexBuffer:
+			{
+				const CommandResourceData *pCommand = static_cast<const CommandResourceData*>(pData);
+				if (!cRenderer.SetIndexBuffer(static_cast<IndexBuffer*>(pCommand->pResource)))
+					bResult = false; // Error!
+				break;
+			}
+
+			case CommandSetProgram:
+			{
+				const CommandResourceData *pCommand = static_cast<const CommandResourceData*>(pData);
+				if (!cRenderer.SetProgram(static_cast<Program*>(pCommand->pResource)))
+					bResult = false; // Error!
+				break;
+			}
+
+		// Program attributes and uniforms
+			case CommandSetProgramAttribute:
+			{
+				const CommandProgramAttributeData *pCommand = static_cast<const CommandProgramAttributeData*>(pData);
+				if (!pCommand->pAttribute->Set(pCommand->pVertexBuffer, static_cast<VertexBuffer::ESemantic>(pCommand->nSemantic), pCommand->nChannel))
+					bResult = false; // Error!
+				break;
+			}
+
+			case CommandSetProgramUniformInt:
+			{
+				const CommandProgramUniformData *pCommand = static_cast<const CommandProgramUniformData*>(pData);
+				pCommand->pUniform->Set(*reinterpret_cast<const int*>(pCommand + 1));
+				break;
+			}
+
+			case CommandSetProgramUniformFloat:
+			{
+				const CommandProgramUniformData *pCommand = static_cast<const CommandProgramUniformData*>(pData);
+				const float *pfComponents = reinterpret_cast<const float*>(pCommand + 1);
+				switch (pCommand->nNumOfComponents) {
+					case 1:
+						pCommand->pUniform->Set(pfComponents[0]);
+						break;
+
+					case 2:
+						pCommand->pUniform->Set2(pfComponents);
+						break;
+
+					case 3:
+						pCommand->pUniform->Set3(pfComponents);
+						break;
+
+					case 4:
+						pCommand->pUniform->Set4(pfComponents);
+						break;
+				}
+				break;
+			}
+
+			case CommandSetProgramUniformMatrix3x3:
+			{
+				const CommandProgramUniformData *pCommand = static_cast<const CommandProgramUniformData*>(pData);
+				pCommand->pUniform->Set(Matrix3x3(reinterpret_cast<const float*>(pCommand + 1)), pCommand->bTranspose);
+				break;
+			}
+
+			case CommandSetProgramUniformMatrix4x4:
+			{
+				const CommandProgramUniformData *pCommand = static_cast<const CommandProgramUniformData*>(pData);
+				pCommand->pUniform->Set(Matrix4x4(reinterpret_cast<const float*>(pCommand + 1)), pCommand->bTranspose);
+				break;
+			}
+
+			case CommandSetProgramUniformTextureBuffer:
+			{
+				const CommandProgramUniformData *pCommand = static_cast<const CommandProgramUniformData*>(pData);
+				if (pCommand->pUniform->Set(*reinterpret_cast<TextureBuffer*const*>(pCommand + 1)) < 0)
+					bResult = false; // Error!
+				break;
+			}
+
+		// Draw call
+			case CommandDrawPrimitives:
+			{
+				const CommandDrawData *pCommand = static_cast<const CommandDrawData*>(pData);
+				const bool bDrawn = pCommand->nNumOfInstances ?
+					cRenderer.DrawPrimitivesInstanced(static_cast<Primitive::Enum>(pCommand->nType), pCommand->nStartIndex, pCommand->nNumVertices, pCommand->nNumOfInstances) :
+					cRenderer.DrawPrimitives(static_cast<Primitive::Enum>(pCommand->nType), pCommand->nStartIndex, pCommand->nNumVertices);
+				if (!bDrawn)
+					bResult = false; // Error!
+				break;
+			}
+
+			case CommandDrawIndexedPrimitives:
+			{
+				const CommandDrawData *pCommand = static_cast<const CommandDrawData*>(pData);
+				const bool bDrawn = pCommand->nNumOfInstances ?
+					cRenderer.DrawIndexedPrimitivesInstanced(static_cast<Primitive::Enum>(pCommand->nType), pCommand->nMinIndex, pCommand->nMaxIndex, pCommand->nStartIndex, pCommand->nNumVertices, pCommand->nNumOfInstances) :
+					cRenderer.DrawIndexedPrimitives(static_cast<Primitive::Enum>(pCommand->nType), pCommand->nMinIndex, pCommand->nMaxIndex, pCommand->nStartIndex, pCommand->nNumVertices);
+				if (!bDrawn)
+					bResult = false; // Error!
+				break;
+			}
+
+			case CommandDrawPatches:
+			{
+				const CommandDrawData *pCommand = static_cast<const CommandDrawData*>(pData);
+				const bool bDrawn = pCommand->nNumOfInstances ?
+					cRenderer.DrawPatchesInstanced(pCommand->nType, pCommand->nStartIndex, pCommand->nNumVertices, pCommand->nNumOfInstances) :
+					cRenderer.DrawPatches(pCommand->nType, pCommand->nStartIndex, pCommand->nNumVertices);
+				if (!bDrawn)
+					bResult = false; // Error!
+				break;
+			}
+
+			case CommandDrawIndexedPatches:
+			{
+				const CommandDrawData *pCommand = static_cast<const CommandDrawData*>(pData);
+				const bool bDrawn = pCommand->nNumOfInstances ?
+					cRenderer.DrawIndexedPatchesInstanced(pCommand->nType, pCommand->nMinIndex, pCommand->nMaxIndex, pCommand->nStartIndex, pCommand->nNumVertices, pCommand->nNumOfInstances) :
+					cRenderer.DrawIndexedPatches(pCommand->nType, pCommand->nMinIndex, pCommand->nMaxIndex, pCommand->nStartIndex, pCommand->nNumVertices);
+				if (!bDrawn)
+					bResult = false; // Error!
+				break;
+			}
+		}
+
+		// Next command, please
+		pnCommand += pHeader->nSize;
+	}
+
+	// Done
+	return bResult;
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // PLRenderer
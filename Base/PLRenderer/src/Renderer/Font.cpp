@@ -34,6 +34,8 @@
 //[ Namespace                                             ]
 //[-------------------------------------------------------]
 using namespace PLCore;
+using namespace PLMath;
+using namespace PLGraphics;
 namespace PLRenderer {
 
 
@@ -98,6 +100,25 @@ float Font::GetTextWidth(const String &sText)
 	return fWidth;
 }
 
+/**
+*  @brief
+*    Appends the glyph quads of a text to a list of glyph vertices
+*/
+bool Font::AddGlyphVertices(Array<GlyphVertex> &lstVertices, const String &sText, const Color4 &cColor, const Matrix4x4 &mObjectSpaceToClipSpace, const Vector2 &vScale, const Vector2 &vBias, uint32 nFlags)
+{
+	// No batched text rendering support by default
+	return false;
+}
+
+/**
+*  @brief
+*    Draws glyph vertices created by using AddGlyphVertices()
+*/
+void Font::DrawGlyphVertices(const Array<GlyphVertex> &lstVertices, uint32 nFlags)
+{
+	// No batched text rendering support by default
+}
+
 
 //[-------------------------------------------------------]
 //[ Protected functions                                   ]
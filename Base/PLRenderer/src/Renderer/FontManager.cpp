@@ -28,6 +28,7 @@
 #include <PLCore/Log/Log.h>
 #include <PLCore/File/File.h>
 #include <PLCore/Tools/LoadableManager.h>
+#include "PLRenderer/Renderer/GlyphAtlas.h"
 #include "PLRenderer/Renderer/ResourceHandler.h"
 #include "PLRenderer/Renderer/FontTexture.h"
 #include "PLRenderer/Renderer/FontManager.h"
@@ -152,7 +153,8 @@ Font *FontManager::CreateFontTexture(const String &sFilename, uint32 nSize, uint
 FontManager::FontManager(Renderer &cRenderer) :
 	m_pRenderer(&cRenderer),
 	m_pDefaultFontTextureHandler(new ResourceHandler()),
-	m_bDefaultFontTextureSet(false)
+	m_bDefaultFontTextureSet(false),
+	m_pGlyphAtlas(new GlyphAtlas(cRenderer))
 {
 }
 
@@ -165,6 +167,7 @@ FontManager::~FontManager()
 	// Cleanup
 	delete m_pDefaultFontTextureHandler;
 	ClearFontTexture();
+	delete m_pGlyphAtlas;
 }
 
 
@@ -178,7 +181,8 @@ FontManager::~FontManager()
 FontManager::FontManager(const FontManager &cSource) :
 	m_pRenderer(nullptr),
 	m_pDefaultFontTextureHandler(nullptr),
-	m_bDefaultFontTextureSet(false)
+	m_bDefaultFontTextureSet(false),
+	m_pGlyphAtlas(nullptr)
 {
 	// No implementation because the copy constructor is never used
 }
@@ -25,6 +25,8 @@
 //[-------------------------------------------------------]
 //[ Includes                                              ]
 //[-------------------------------------------------------]
+#include <PLMath/Matrix4x4.h>
+#include <PLGraphics/Color/Color4.h>
 #include "PLRenderer/Renderer/FontManager.h"
 #include "PLRenderer/Renderer/FontTexture.h"
 
@@ -33,9 +35,17 @@
 //[ Namespace                                             ]
 //[-------------------------------------------------------]
 using namespace PLCore;
+using namespace PLMath;
+using namespace PLGraphics;
 namespace PLRenderer {
 
 
+//[-------------------------------------------------------]
+//[ Global definitions                                    ]
+//[-------------------------------------------------------]
+static const uint32 MaxNumOfShapedTexts = 512;	/**< Maximum number of cached shaped texts, when reached the cache is emptied */
+
+
 //[-------------------------------------------------------]
 //[ Public functions                                      ]
 //[-------------------------------------------------------]
@@ -45,11 +55,100 @@ namespace PLRenderer {
 */
 FontTexture::~FontTexture()
 {
+	// Destroy all cached shaped texts
+	ClearShapedTexts();
+
+	// Remove the glyphs of this font from the glyph atlas
+	RemoveGlyphsFromAtlas();
+
 	// Unregister from the font manager
 	m_pFontManager->m_lstFontTexture.Remove(this);
 }
 
 
+//[-------------------------------------------------------]
+//[ Public virtual Font functions                         ]
+//[-------------------------------------------------------]
+float FontTexture::GetTextWidth(const String &sText)
+{
+	// Use the shaped text, it's cached
+	const ShapedText *pShapedText = ShapeText(sText);
+	return pShapedText ? pShapedText->fWidth : 0.0f;
+}
+
+bool FontTexture::AddGlyphVertices(Array<GlyphVertex> &lstVertices, const String &sText, const Color4 &cColor, const Matrix4x4 &mObjectSpaceToClipSpace, const Vector2 &vScale, const Vector2 &vBias, uint32 nFlags)
+{
+	// Get the shaped text
+	const ShapedText *pShapedText = ShapeText(sText);
+	if (!pShapedText)
+		return false; // Error!
+
+	// Make sure there's enough space for six vertices per glyph, let the list grow in larger steps to keep reallocations rare
+	const uint32 nNumOfGlyphs = pShapedText->lstGlyphs.GetNumOfElements();
+	const uint32 nNumOfVertices = lstVertices.GetNumOfElements() + nNumOfGlyphs*6;
+	if (lstVertices.GetMaxNumOfElements() < nNumOfVertices)
+		lstVertices.Resize(nNumOfVertices*2, false, false);
+
+	// The current object space pen position
+	Vector2 vPenPosition = vBias;
+
+	// Center the text?
+	if (nFlags & CenterText)
+		vPenPosition.x -= pShapedText->fWidth/2;
+
+	// Get the glyph atlas, the glyphs of the text are used within the current frame and must not be evicted
+	GlyphAtlas &cGlyphAtlas = m_pFontManager->GetGlyphAtlas();
+
+	// Iterate through all glyph quads of the text
+	const ShapedGlyph *pShapedGlyph = pShapedText->lstGlyphs.GetData();
+	for (uint32 i=0; i<nNumOfGlyphs; i++, pShapedGlyph++) {
+		// Mark the glyph as used
+		cGlyphAtlas.UseGlyph(*pShapedGlyph->pGlyph);
+
+		// Get the object space glyph quad
+		const float fMinX = (vPenPosition.x + pShapedGlyph->vMin.x)*vScale.x;
+		const float fMinY = (vPenPosition.y + pShapedGlyph->vMin.y)*vScale.y;
+		const float fMaxX = (vPenPosition.x + pShapedGlyph->vMax.x)*vScale.x;
+		const float fMaxY = (vPenPosition.y + pShapedGlyph->vMax.y)*vScale.y;
+
+		// Setup the four corners of the glyph quad: lower/left, lower/right, upper/left and upper/right
+		const float fX[4] = { fMinX, fMaxX, fMinX, fMaxX };
+		const float fY[4] = { fMinY, fMinY, fMaxY, fMaxY };
+		const float fU[4] = { pShapedGlyph->vTexCoordMin.x, pShapedGlyph->vTexCoordMax.x, pShapedGlyph->vTexCoordMin.x, pShapedGlyph->vTexCoordMax.x };
+		const float fV[4] = { pShapedGlyph->vTexCoordMax.y, pShapedGlyph->vTexCoordMax.y, pShapedGlyph->vTexCoordMin.y, pShapedGlyph->vTexCoordMin.y };
+		GlyphVertex sCorners[4];
+		for (uint32 nCorner=0; nCorner<4; nCorner++) {
+			GlyphVertex &sVertex = sCorners[nCorner];
+
+			// Transform the object space position (z=0, w=1) into clip space
+			sVertex.fPosition[0] = mObjectSpaceToClipSpace.xx*fX[nCorner] + mObjectSpaceToClipSpace.xy*fY[nCorner] + mObjectSpaceToClipSpace.xw;
+			sVertex.fPosition[1] = mObjectSpaceToClipSpace.yx*fX[nCorner] + mObjectSpaceToClipSpace.yy*fY[nCorner] + mObjectSpaceToClipSpace.yw;
+			sVertex.fPosition[2] = mObjectSpaceToClipSpace.zx*fX[nCorner] + mObjectSpaceToClipSpace.zy*fY[nCorner] + mObjectSpaceToClipSpace.zw;
+			sVertex.fPosition[3] = mObjectSpaceToClipSpace.wx*fX[nCorner] + mObjectSpaceToClipSpace.wy*fY[nCorner] + mObjectSpaceToClipSpace.ww;
+
+			// Texture coordinate and color
+			sVertex.fTexCoord[0] = fU[nCorner];
+			sVertex.fTexCoord[1] = fV[nCorner];
+			sVertex.fColor[0]	 = cColor.r;
+			sVertex.fColor[1]	 = cColor.g;
+			sVertex.fColor[2]	 = cColor.b;
+			sVertex.fColor[3]	 = cColor.a;
+		}
+
+		// Add the two triangles of the glyph quad
+		lstVertices.Add(sCorners[0]);
+		lstVertices.Add(sCorners[1]);
+		lstVertices.Add(sCorners[2]);
+		lstVertices.Add(sCorners[2]);
+		lstVertices.Add(sCorners[1]);
+		lstVertices.Add(sCorners[3]);
+	}
+
+	// Done
+	return true;
+}
+
+
 //[-------------------------------------------------------]
 //[ Protected functions                                   ]
 //[-------------------------------------------------------]
@@ -57,8 +156,69 @@ FontTexture::~FontTexture()
 *  @brief
 *    Constructor
 */
-FontTexture::FontTexture(FontManager &cFontManager, const String &sFilename) : Font(cFontManager, sFilename)
+FontTexture::FontTexture(FontManager &cFontManager, const String &sFilename) : Font(cFontManager, sFilename),
+	m_nShapedTextsSize(0),
+	m_nShapedTextsResolution(0),
+	m_nShapedTextsGeneration(0),
+	m_nGlyphAtlasFontID(0)
+{
+}
+
+/**
+*  @brief
+*    Destroys all cached shaped texts
+*/
+void FontTexture::ClearShapedTexts()
 {
+	Iterator<ShapedText*> cIterator = m_mapShapedTexts.GetIterator();
+	while (cIterator.HasNext())
+		delete cIterator.Next();
+	m_mapShapedTexts.Clear();
+}
+
+/**
+*  @brief
+*    Removes the glyphs of this font from the glyph atlas
+*/
+void FontTexture::RemoveGlyphsFromAtlas()
+{
+	m_pFontManager->GetGlyphAtlas().RemoveFont(*this);
+}
+
+/**
+*  @brief
+*    Returns the number of glyph vertices at the given position which use the same glyph atlas page
+*/
+uint32 FontTexture::GetGlyphPageRun(const Array<GlyphVertex> &lstVertices, uint32 nFirstVertex, uint32 &nPage)
+{
+	// Check the given position
+	const uint32 nNumOfVertices = lstVertices.GetNumOfElements();
+	if (nFirstVertex >= nNumOfVertices)
+		return 0; // Error!
+
+	// The first vertex of a glyph quad is the lower/left corner, its x texture coordinate is the minimum one, so the
+	// integer part is the page index even if the glyph touches the right border of the page
+	nPage = static_cast<uint32>(lstVertices[nFirstVertex].fTexCoord[0]);
+
+	// Add the following glyph quads using the same page
+	uint32 nVertex = nFirstVertex + 6;
+	while (nVertex < nNumOfVertices && static_cast<uint32>(lstVertices[nVertex].fTexCoord[0]) == nPage)
+		nVertex += 6;
+	return ((nVertex < nNumOfVertices) ? nVertex : nNumOfVertices) - nFirstVertex;
+}
+
+
+//[-------------------------------------------------------]
+//[ Protected virtual FontTexture functions               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Rasterizes a glyph for the glyph atlas
+*/
+bool FontTexture::RasterizeGlyph(uint32 nSize, uint32 nResolution, uint32 nCharacterCode, GlyphAtlas::Bitmap &sBitmap)
+{
+	// No glyphs by default
+	return false;
 }
 
 
@@ -69,7 +229,11 @@ FontTexture::FontTexture(FontManager &cFontManager, const String &sFilename) : F
 *  @brief
 *    Copy constructor
 */
-FontTexture::FontTexture(const FontTexture &cSource) : Font(cSource)
+FontTexture::FontTexture(const FontTexture &cSource) : Font(cSource),
+	m_nShapedTextsSize(0),
+	m_nShapedTextsResolution(0),
+	m_nShapedTextsGeneration(0),
+	m_nGlyphAtlasFontID(0)
 {
 	// No implementation because the copy constructor is never used
 }
@@ -85,6 +249,113 @@ FontTexture &FontTexture::operator =(const FontTexture &cSource)
 }
 
 
+/**
+*  @brief
+*    Returns the shaped version of a text
+*/
+const FontTexture::ShapedText *FontTexture::ShapeText(const String &sText)
+{
+	// Is there a font at all?
+	if (!IsValid())
+		return nullptr; // Error!
+
+	// Get the glyph atlas shared by all texture fonts of the font manager
+	GlyphAtlas &cGlyphAtlas = m_pFontManager->GetGlyphAtlas();
+
+	// The cached shaped texts are only valid for the font size and resolution they were created with, and only
+	// as long as their glyphs within the glyph atlas are valid
+	if (m_nShapedTextsSize != m_nSize || m_nShapedTextsResolution != m_nResolution || m_nShapedTextsGeneration != cGlyphAtlas.GetGeneration()) {
+		ClearShapedTexts();
+		m_nShapedTextsSize       = m_nSize;
+		m_nShapedTextsResolution = m_nResolution;
+		m_nShapedTextsGeneration = cGlyphAtlas.GetGeneration();
+	}
+
+	// Is the shaped text already cached?
+	ShapedText *pShapedText = m_mapShapedTexts.Get(sText);
+	if (!pShapedText) {
+		// Keep the cache size under control, texts which are changing all the time (e.g. frame rate display) would let it grow endlessly
+		if (m_mapShapedTexts.GetNumOfElements() >= MaxNumOfShapedTexts)
+			ClearShapedTexts();
+
+		// Create the shaped text
+		pShapedText = new ShapedText;
+		pShapedText->fWidth = 0.0f;
+
+		// Placeholders for glyphs which are not ready yet get half of the font height as pen advance
+		const float fPlaceholderAdvance = static_cast<float>(GetHeightInPixels()/2);
+
+		// Iterate through all characters of the text to shape
+		const uint32 nLength = sText.GetLength();
+		if (sText.GetFormat() == String::Unicode) {
+			const wchar_t *pszText = sText.GetUnicode();
+			for (uint32 i=0; i<nLength; i++) {
+				// Get the character code, on systems with two byte wide characters (UTF-16) combine surrogate pairs
+				uint32 nCharacterCode = static_cast<uint32>(pszText[i]);
+				if (sizeof(wchar_t) == 2 && nCharacterCode >= 0xd800 && nCharacterCode < 0xdc00 && i + 1 < nLength) {
+					const uint32 nLowSurrogate = static_cast<uint32>(pszText[i + 1]);
+					if (nLowSurrogate >= 0xdc00 && nLowSurrogate < 0xe000) {
+						nCharacterCode = 0x10000 + ((nCharacterCode - 0xd800) << 10) + (nLowSurrogate - 0xdc00);
+						i++;
+					}
+				}
+				ShapeCharacter(*pShapedText, cGlyphAtlas, nCharacterCode, fPlaceholderAdvance);
+			}
+		} else {
+			const unsigned char *pszText = reinterpret_cast<const unsigned char*>(sText.GetASCII());
+			for (uint32 i=0; i<nLength; i++)
+				ShapeCharacter(*pShapedText, cGlyphAtlas, pszText[i], fPlaceholderAdvance);
+		}
+
+		// Cache the shaped text
+		m_mapShapedTexts.Add(sText, pShapedText);
+	}
+
+	// Done
+	return pShapedText;
+}
+
+/**
+*  @brief
+*    Adds a character to a shaped text
+*/
+void FontTexture::ShapeCharacter(ShapedText &cShapedText, GlyphAtlas &cGlyphAtlas, uint32 nCharacterCode, float fPlaceholderAdvance)
+{
+	// Get the glyph of the character to shape
+	const GlyphAtlas::Glyph *pGlyph = cGlyphAtlas.GetGlyph(*this, nCharacterCode);
+	if (pGlyph) {
+		switch (pGlyph->nState) {
+			case GlyphAtlas::Ready:
+				// Add a glyph quad, but only if the glyph is visible at all (e.g. space has no size)
+				if (pGlyph->vSize.x && pGlyph->vSize.y) {
+					ShapedGlyph &sShapedGlyph = cShapedText.lstGlyphs.Add();
+					sShapedGlyph.pGlyph		  = pGlyph;
+					sShapedGlyph.vMin.x		  = cShapedText.fWidth + pGlyph->vCorner.x;
+					sShapedGlyph.vMin.y		  = pGlyph->vCorner.y;
+					sShapedGlyph.vMax.x		  = sShapedGlyph.vMin.x + static_cast<float>(pGlyph->vSize.x);
+					sShapedGlyph.vMax.y		  = sShapedGlyph.vMin.y + static_cast<float>(pGlyph->vSize.y);
+					sShapedGlyph.vTexCoordMin = pGlyph->vTexCoordMin;
+					sShapedGlyph.vTexCoordMax = pGlyph->vTexCoordMax;
+				}
+
+				// Let the pen advance to the object space position of the next character
+				cShapedText.fWidth += pGlyph->vPenAdvance.x;
+				break;
+
+			case GlyphAtlas::Pending:
+				// Placeholder, the text is shaped again as soon as the glyph is ready
+				cShapedText.fWidth += fPlaceholderAdvance;
+				break;
+
+			case GlyphAtlas::Missing:
+				// A glyph which didn't fit into the glyph atlas still has its pen advance, else it's zero
+				cShapedText.fWidth += pGlyph->vPenAdvance.x;
+				break;
+		}
+	}
+}
+
+
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
 //[-------------------------------------------------------]
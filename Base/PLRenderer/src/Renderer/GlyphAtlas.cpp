@@ -0,0 +1,915 @@
+/*********************************************************\
+ *  File: GlyphAtlas.cpp                                 *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <PLCore/System/Mutex.h>
+#include <PLCore/System/Thread.h>
+#include <PLCore/System/Semaphore.h>
+#include <PLCore/Core/MemoryManager.h>
+#include <PLMath/Math.h>
+#include <PLMath/Vector3i.h>
+#include <PLGraphics/Image/Image.h>
+#include "PLRenderer/Renderer/Renderer.h"
+#include "PLRenderer/Renderer/FontTexture.h"
+#include "PLRenderer/Renderer/TextureBuffer2D.h"
+#include "PLRenderer/Renderer/GlyphAtlas.h"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+using namespace PLCore;
+using namespace PLMath;
+using namespace PLGraphics;
+namespace PLRenderer {
+
+
+//[-------------------------------------------------------]
+//[ Global definitions                                    ]
+//[-------------------------------------------------------]
+static const uint32 GlyphPadding = 1;	/**< Empty pixels on the left and top of each glyph bitmap, together with the glyph on the left and above this keeps bilinear filtering from bleeding */
+
+
+//[-------------------------------------------------------]
+//[ Public functions                                      ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Sets the size of the pages
+*/
+void GlyphAtlas::SetPageSize(uint32 nSize)
+{
+	// Power of two pages are supported everywhere
+	nSize = Math::GetNearestPowerOfTwo(nSize ? nSize : 1, false);
+	if (m_nPageSize != nSize) {
+		// The glyphs can't be moved into pages of another size
+		Clear();
+		m_nPageSize = nSize;
+	}
+}
+
+/**
+*  @brief
+*    Sets the maximum number of pages
+*/
+void GlyphAtlas::SetMaxNumOfPages(uint32 nMaxNumOfPages)
+{
+	m_nMaxNumOfPages = nMaxNumOfPages ? nMaxNumOfPages : 1;
+}
+
+/**
+*  @brief
+*    Sets whether or not glyphs are rasterized by a background thread
+*/
+void GlyphAtlas::SetBackgroundRasterization(bool bBackgroundRasterization)
+{
+	m_bBackgroundRasterization = bBackgroundRasterization;
+
+	// The background thread is started on demand, but must be stopped right now
+	if (!m_bBackgroundRasterization)
+		StopThread();
+}
+
+/**
+*  @brief
+*    Returns the glyph of a character
+*/
+const GlyphAtlas::Glyph *GlyphAtlas::GetGlyph(FontTexture &cFont, uint32 nCharacterCode)
+{
+	// Is the glyph already known?
+	const uint64 nKey = GetGlyphKey(cFont, nCharacterCode);
+	Glyph *pGlyph = m_mapGlyphs.Get(nKey);
+
+	// A glyph which didn't fit into the atlas gets another chance within the next frame
+	if (pGlyph && pGlyph->nState == Missing && pGlyph->vSize.x && pGlyph->nLastUsedFrame != m_nFrame) {
+		RemoveGlyph(pGlyph);
+		pGlyph = nullptr;
+	}
+
+	// Create the glyph
+	if (!pGlyph) {
+		pGlyph = new Glyph;
+		pGlyph->nState			= Pending;
+		pGlyph->vSize			= Vector2i::Zero;
+		pGlyph->vCorner			= Vector2::Zero;
+		pGlyph->vPenAdvance		= Vector2::Zero;
+		pGlyph->vTexCoordMin	= Vector2::Zero;
+		pGlyph->vTexCoordMax	= Vector2::Zero;
+		pGlyph->nKey			= nKey;
+		pGlyph->nPage			= 0;
+		pGlyph->nX				= 0;
+		pGlyph->nY				= 0;
+		pGlyph->nWidth			= 0;
+		pGlyph->nHeight			= 0;
+		pGlyph->nLastUsedFrame	= m_nFrame;
+		pGlyph->pPrevious		= nullptr;
+		pGlyph->pNext			= nullptr;
+		m_mapGlyphs.Add(nKey, pGlyph);
+
+		// Start the background thread on demand
+		if (m_bBackgroundRasterization && !m_pThread)
+			StartThread();
+
+		// Rasterize the glyph
+		if (m_pThread) {
+			// Let the background thread rasterize the glyph, until then the glyph is a placeholder
+			Job *pJob = new Job;
+			pJob->pFont			 = &cFont;
+			pJob->nKey			 = nKey;
+			pJob->nSize			 = cFont.GetSize();
+			pJob->nResolution	 = cFont.GetResolution();
+			pJob->nCharacterCode = nCharacterCode;
+			MemoryManager::Set(&pJob->sBitmap, 0, sizeof(Bitmap));
+			pJob->bRasterized	 = false;
+			m_nNumOfPendingGlyphs++;
+			m_pMutex->Lock();
+			m_lstQueue.Add(pJob);
+			m_pMutex->Unlock();
+			m_pSemaphore->Unlock();
+		} else {
+			// Rasterize the glyph right now
+			Bitmap sBitmap;
+			MemoryManager::Set(&sBitmap, 0, sizeof(Bitmap));
+			if (cFont.RasterizeGlyph(cFont.GetSize(), cFont.GetResolution(), nCharacterCode, sBitmap))
+				SetGlyphBitmap(*pGlyph, sBitmap);
+			else
+				pGlyph->nState = Missing;
+			if (sBitmap.pnData)
+				delete [] sBitmap.pnData;
+		}
+	}
+
+	// The glyph is used within the current frame
+	UseGlyph(*pGlyph);
+
+	// Done
+	return pGlyph;
+}
+
+/**
+*  @brief
+*    Marks a glyph as used within the current frame
+*/
+void GlyphAtlas::UseGlyph(const Glyph &sGlyph)
+{
+	// The order of glyphs used within the same frame doesn't matter, they are not evicted anyway
+	if (sGlyph.nLastUsedFrame != m_nFrame) {
+		Glyph &sWritableGlyph = const_cast<Glyph&>(sGlyph);
+		sWritableGlyph.nLastUsedFrame = m_nFrame;
+
+		// Move glyphs occupying page space to the front of the LRU list
+		if (sWritableGlyph.nWidth) {
+			UnlinkGlyph(sWritableGlyph);
+			LinkGlyph(sWritableGlyph);
+		}
+	}
+}
+
+/**
+*  @brief
+*    Returns the texture buffer of a page
+*/
+TextureBuffer2D *GlyphAtlas::GetPageTextureBuffer(uint32 nPage)
+{
+	// Check the given page index
+	if (nPage >= m_lstPages.GetNumOfElements())
+		return nullptr; // Error!
+	Page &cPage = *m_lstPages[nPage];
+
+	// Create the texture buffer on demand, it gets its content right below
+	if (!cPage.pTextureBuffer) {
+		Image cImage = Image::CreateImage(DataByte, ColorGrayscale, Vector3i(m_nPageSize, m_nPageSize, 1));
+		cPage.pTextureBuffer = m_pRenderer->CreateTextureBuffer2D(cImage, TextureBuffer::A8, 0);
+		cPage.bDirty = true;
+	}
+
+	// Upload the modified page
+	if (cPage.pTextureBuffer && cPage.bDirty) {
+		cPage.pTextureBuffer->CopyDataFrom(0, TextureBuffer::A8, cPage.pnData);
+		cPage.bDirty = false;
+	}
+
+	// Done
+	return cPage.pTextureBuffer;
+}
+
+/**
+*  @brief
+*    Updates the atlas
+*/
+void GlyphAtlas::Update()
+{
+	// Start a new frame, glyphs used within the previous frame can now be evicted
+	m_nFrame++;
+
+	// Take over the glyphs rasterized by the background thread
+	if (m_nNumOfPendingGlyphs)
+		TakeOverRasterizedGlyphs();
+}
+
+/**
+*  @brief
+*    Waits until all pending glyphs are rasterized and takes them over
+*/
+void GlyphAtlas::WaitForRasterization()
+{
+	if (m_nNumOfPendingGlyphs) {
+		// Wait until the background thread is done with its current job, then rasterize the queued jobs right here
+		m_pRasterizeMutex->Lock();
+		m_pMutex->Lock();
+		Array<Job*> lstJobs = m_lstQueue;
+		m_lstQueue.Reset();
+		m_pMutex->Unlock();
+		for (uint32 i=0; i<lstJobs.GetNumOfElements(); i++) {
+			Job &sJob = *lstJobs[i];
+			sJob.bRasterized = sJob.pFont->RasterizeGlyph(sJob.nSize, sJob.nResolution, sJob.nCharacterCode, sJob.sBitmap);
+		}
+		m_pMutex->Lock();
+		m_lstRasterized.Add(lstJobs);
+		m_pMutex->Unlock();
+		m_pRasterizeMutex->Unlock();
+
+		// Take over the rasterized glyphs
+		TakeOverRasterizedGlyphs();
+	}
+}
+
+/**
+*  @brief
+*    Removes all glyphs and pages
+*/
+void GlyphAtlas::Clear()
+{
+	// Destroy all jobs, wait until the background thread is done with its current job
+	m_pRasterizeMutex->Lock();
+	m_pMutex->Lock();
+	for (uint32 i=0; i<m_lstQueue.GetNumOfElements(); i++)
+		delete m_lstQueue[i];
+	m_lstQueue.Reset();
+	for (uint32 i=0; i<m_lstRasterized.GetNumOfElements(); i++) {
+		if (m_lstRasterized[i]->sBitmap.pnData)
+			delete [] m_lstRasterized[i]->sBitmap.pnData;
+		delete m_lstRasterized[i];
+	}
+	m_lstRasterized.Reset();
+	m_pMutex->Unlock();
+	m_pRasterizeMutex->Unlock();
+	m_nNumOfPendingGlyphs = 0;
+
+	// Destroy all glyphs
+	Iterator<Glyph*> cIterator = m_mapGlyphs.GetIterator();
+	while (cIterator.HasNext())
+		delete cIterator.Next();
+	m_mapGlyphs.Clear();
+	m_pMostRecentlyUsed  = nullptr;
+	m_pLeastRecentlyUsed = nullptr;
+
+	// Destroy all pages
+	for (uint32 i=0; i<m_lstPages.GetNumOfElements(); i++) {
+		Page *pPage = m_lstPages[i];
+		if (pPage->pTextureBuffer)
+			delete pPage->pTextureBuffer;
+		delete [] pPage->pnData;
+		delete pPage;
+	}
+	m_lstPages.Clear();
+
+	// All previously returned glyphs are now invalid
+	m_nGeneration++;
+}
+
+/**
+*  @brief
+*    Removes all glyphs of a font
+*/
+void GlyphAtlas::RemoveFont(FontTexture &cFont)
+{
+	// Has the font glyphs inside the atlas at all?
+	const uint32 nFontID = cFont.m_nGlyphAtlasFontID;
+	if (nFontID) {
+		// Destroy the jobs of the font, wait until the background thread is done with its current job
+		m_pRasterizeMutex->Lock();
+		m_pMutex->Lock();
+		for (uint32 i=m_lstQueue.GetNumOfElements(); i>0; ) {
+			i--;
+			if (m_lstQueue[i]->pFont == &cFont) {
+				delete m_lstQueue[i];
+				m_lstQueue.RemoveAtIndex(i);
+				m_nNumOfPendingGlyphs--;
+			}
+		}
+		for (uint32 i=m_lstRasterized.GetNumOfElements(); i>0; ) {
+			i--;
+			Job *pJob = m_lstRasterized[i];
+			if (pJob->pFont == &cFont) {
+				if (pJob->sBitmap.pnData)
+					delete [] pJob->sBitmap.pnData;
+				delete pJob;
+				m_lstRasterized.RemoveAtIndex(i);
+				m_nNumOfPendingGlyphs--;
+			}
+		}
+		m_pMutex->Unlock();
+		m_pRasterizeMutex->Unlock();
+
+		// Remove the glyphs of the font, the font ID is within the upper 16 bits of the glyph keys
+		Array<Glyph*> lstGlyphs;
+		Iterator<Glyph*> cIterator = m_mapGlyphs.GetIterator();
+		while (cIterator.HasNext()) {
+			Glyph *pGlyph = cIterator.Next();
+			if ((pGlyph->nKey >> 48) == nFontID)
+				lstGlyphs.Add(pGlyph);
+		}
+		for (uint32 i=0; i<lstGlyphs.GetNumOfElements(); i++)
+			RemoveGlyph(lstGlyphs[i]);
+
+		// Free the font ID
+		m_lstFonts[nFontID - 1] = nullptr;
+		cFont.m_nGlyphAtlasFontID = 0;
+	}
+}
+
+/**
+*  @brief
+*    Returns the packing efficiency
+*/
+float GlyphAtlas::GetPackingEfficiency() const
+{
+	// Any pages?
+	if (!m_lstPages.GetNumOfElements())
+		return 0.0f;
+
+	// Number of glyph bitmap pixels divided by the number of page pixels
+	uint32 nNumOfPixels = 0;
+	for (uint32 i=0; i<m_lstPages.GetNumOfElements(); i++)
+		nNumOfPixels += m_lstPages[i]->nNumOfPixels;
+	return static_cast<float>(nNumOfPixels)/(static_cast<float>(m_lstPages.GetNumOfElements())*m_nPageSize*m_nPageSize);
+}
+
+
+//[-------------------------------------------------------]
+//[ Private static functions                              ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Background thread function rasterizing the queued glyphs
+*/
+int GlyphAtlas::RasterizeThreadFunction(void *pData)
+{
+	GlyphAtlas &cThis = *static_cast<GlyphAtlas*>(pData);
+
+	// Wait for jobs
+	while (cThis.m_pSemaphore->Lock()) {
+		// Process all queued jobs, there may be more jobs than semaphore signals
+		for (;;) {
+			// Get the next queued job, the rasterize mutex is held until the job is handed back
+			cThis.m_pRasterizeMutex->Lock();
+			Job *pJob = nullptr;
+			cThis.m_pMutex->Lock();
+			const bool bShutdown = cThis.m_bShutdown;
+			if (!bShutdown && cThis.m_lstQueue.GetNumOfElements()) {
+				pJob = cThis.m_lstQueue[0];
+				cThis.m_lstQueue.RemoveAtIndex(0);
+			}
+			cThis.m_pMutex->Unlock();
+			if (!pJob) {
+				cThis.m_pRasterizeMutex->Unlock();
+				if (bShutdown)
+					return 0; // Done
+				break;
+			}
+
+			// Rasterize the glyph, this is the part which would stall the main thread
+			pJob->bRasterized = pJob->pFont->RasterizeGlyph(pJob->nSize, pJob->nResolution, pJob->nCharacterCode, pJob->sBitmap);
+
+			// Hand the job back to the main thread
+			cThis.m_pMutex->Lock();
+			cThis.m_lstRasterized.Add(pJob);
+			cThis.m_pMutex->Unlock();
+			cThis.m_pRasterizeMutex->Unlock();
+		}
+	}
+
+	// Done
+	return 0;
+}
+
+
+//[-------------------------------------------------------]
+//[ Private functions                                     ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Constructor
+*/
+GlyphAtlas::GlyphAtlas(Renderer &cRenderer) :
+	m_pRenderer(&cRenderer),
+	m_nPageSize(512),
+	m_nMaxNumOfPages(4),
+	m_bBackgroundRasterization(true),
+	m_pMostRecentlyUsed(nullptr),
+	m_pLeastRecentlyUsed(nullptr),
+	m_nFrame(0),
+	m_nGeneration(0),
+	m_nNumOfPendingGlyphs(0),
+	m_nNumOfEvictions(0),
+	m_pThread(nullptr),
+	m_pMutex(new Mutex()),
+	m_pRasterizeMutex(new Mutex()),
+	m_pSemaphore(new Semaphore(0, 0x7fffffff)),
+	m_bShutdown(false)
+{
+}
+
+/**
+*  @brief
+*    Destructor
+*/
+GlyphAtlas::~GlyphAtlas()
+{
+	// Stop the background thread and destroy everything
+	StopThread();
+	Clear();
+	delete m_pSemaphore;
+	delete m_pRasterizeMutex;
+	delete m_pMutex;
+}
+
+/**
+*  @brief
+*    Copy constructor
+*/
+GlyphAtlas::GlyphAtlas(const GlyphAtlas &cSource) :
+	m_pRenderer(nullptr),
+	m_nPageSize(0),
+	m_nMaxNumOfPages(0),
+	m_bBackgroundRasterization(false),
+	m_pMostRecentlyUsed(nullptr),
+	m_pLeastRecentlyUsed(nullptr),
+	m_nFrame(0),
+	m_nGeneration(0),
+	m_nNumOfPendingGlyphs(0),
+	m_nNumOfEvictions(0),
+	m_pThread(nullptr),
+	m_pMutex(nullptr),
+	m_pRasterizeMutex(nullptr),
+	m_pSemaphore(nullptr),
+	m_bShutdown(false)
+{
+	// No implementation because the copy constructor is never used
+}
+
+/**
+*  @brief
+*    Copy operator
+*/
+GlyphAtlas &GlyphAtlas::operator =(const GlyphAtlas &cSource)
+{
+	// No implementation because the copy operator is never used
+	return *this;
+}
+
+/**
+*  @brief
+*    Returns the key of a glyph
+*/
+uint64 GlyphAtlas::GetGlyphKey(FontTexture &cFont, uint32 nCharacterCode)
+{
+	// Give the font an ID, reuse the IDs of removed fonts
+	if (!cFont.m_nGlyphAtlasFontID) {
+		uint32 nIndex = m_lstFonts.GetNumOfElements();
+		for (uint32 i=0; i<m_lstFonts.GetNumOfElements(); i++) {
+			if (!m_lstFonts[i]) {
+				nIndex = i;
+				break;
+			}
+		}
+		if (nIndex == m_lstFonts.GetNumOfElements())
+			m_lstFonts.Add(&cFont);
+		else
+			m_lstFonts[nIndex] = &cFont;
+		cFont.m_nGlyphAtlasFontID = nIndex + 1;
+	}
+
+	// 16 bit font ID, 12 bit font size, 12 bit font resolution and 24 bit character code (Unicode only needs 21 bit)
+	return (static_cast<uint64>(cFont.m_nGlyphAtlasFontID & 0xffff) << 48) |
+		   (static_cast<uint64>(cFont.GetSize()			  & 0xfff)  << 36) |
+		   (static_cast<uint64>(cFont.GetResolution()		  & 0xfff)  << 24) |
+		   (nCharacterCode & 0xffffff);
+}
+
+/**
+*  @brief
+*    Takes over a rasterized glyph bitmap
+*/
+void GlyphAtlas::SetGlyphBitmap(Glyph &sGlyph, const Bitmap &sBitmap)
+{
+	// Set the glyph metrics
+	sGlyph.vSize	   = sBitmap.vSize;
+	sGlyph.vCorner	   = sBitmap.vCorner;
+	sGlyph.vPenAdvance = sBitmap.vPenAdvance;
+
+	// Glyphs without bitmap (e.g. space) don't need any page space
+	if (sBitmap.vSize.x <= 0 || sBitmap.vSize.y <= 0 || !sBitmap.pnData) {
+		sGlyph.vSize = Vector2i::Zero;
+		sGlyph.nState = Ready;
+		return;
+	}
+
+	// Allocate the glyph bitmap including the padding
+	const uint32 nWidth  = sBitmap.vSize.x + GlyphPadding;
+	const uint32 nHeight = sBitmap.vSize.y + GlyphPadding;
+	uint32 nPage = 0, nX = 0, nY = 0;
+	if (nWidth > m_nPageSize || nHeight > m_nPageSize || !Allocate(nWidth, nHeight, nPage, nX, nY)) {
+		// Error! The glyph keeps its size, so it gets another chance later on.
+		sGlyph.nState = Missing;
+		return;
+	}
+
+	// Copy the glyph bitmap into the page
+	Page &cPage = *m_lstPages[nPage];
+	for (int nRow=0; nRow<sBitmap.vSize.y; nRow++)
+		MemoryManager::Copy(&cPage.pnData[(nY + GlyphPadding + nRow)*m_nPageSize + nX + GlyphPadding], &sBitmap.pnData[nRow*sBitmap.vSize.x], sBitmap.vSize.x);
+	cPage.bDirty = true;
+	cPage.nNumOfGlyphs++;
+	cPage.nNumOfPixels += sBitmap.vSize.x*sBitmap.vSize.y;
+
+	// Set the glyph location
+	sGlyph.nPage   = nPage;
+	sGlyph.nX	   = static_cast<uint16>(nX);
+	sGlyph.nY	   = static_cast<uint16>(nY);
+	sGlyph.nWidth  = static_cast<uint16>(nWidth);
+	sGlyph.nHeight = static_cast<uint16>(nHeight);
+
+	// Calculate the normalized texture coordinates inside the page, the page index is added to x
+	const float fPageSize = static_cast<float>(m_nPageSize);
+	sGlyph.vTexCoordMin.x = static_cast<float>(nPage) + static_cast<float>(nX + GlyphPadding)/fPageSize;
+	sGlyph.vTexCoordMin.y = static_cast<float>(nY + GlyphPadding)/fPageSize;
+	sGlyph.vTexCoordMax.x = static_cast<float>(nPage) + static_cast<float>(nX + GlyphPadding + sBitmap.vSize.x)/fPageSize;
+	sGlyph.vTexCoordMax.y = static_cast<float>(nY + GlyphPadding + sBitmap.vSize.y)/fPageSize;
+
+	// The glyph is now ready and occupies page space
+	sGlyph.nState = Ready;
+	LinkGlyph(sGlyph);
+}
+
+/**
+*  @brief
+*    Allocates a rectangle inside the pages
+*/
+bool GlyphAtlas::Allocate(uint32 nWidth, uint32 nHeight, uint32 &nPage, uint32 &nX, uint32 &nY)
+{
+	// Reuse the space of evicted glyphs first, this doesn't make the skylines grow
+	for (uint32 i=0; i<m_lstPages.GetNumOfElements(); i++) {
+		if (AllocateFree(*m_lstPages[i], nWidth, nHeight, nX, nY)) {
+			nPage = i;
+			return true;
+		}
+	}
+
+	// Put the rectangle on top of a skyline
+	for (uint32 i=0; i<m_lstPages.GetNumOfElements(); i++) {
+		if (AllocateSkyline(*m_lstPages[i], nWidth, nHeight, nX, nY)) {
+			nPage = i;
+			return true;
+		}
+	}
+
+	// Create a new page
+	if (m_lstPages.GetNumOfElements() < m_nMaxNumOfPages) {
+		Page *pPage = new Page;
+		pPage->pnData = new uint8[m_nPageSize*m_nPageSize];
+		MemoryManager::Set(pPage->pnData, 0, m_nPageSize*m_nPageSize);
+		pPage->pTextureBuffer = nullptr;
+		pPage->bDirty = true;
+		ResetPage(*pPage);
+		m_lstPages.Add(pPage);
+		nPage = m_lstPages.GetNumOfElements() - 1;
+		return AllocateSkyline(*pPage, nWidth, nHeight, nX, nY);
+	}
+
+	// All pages are full, evict the least recently used glyphs until the rectangle fits into the space of an evicted
+	// glyph or a page gets empty - glyphs used within the current frame may be referenced by glyph vertices, keep them
+	while (m_pLeastRecentlyUsed && m_pLeastRecentlyUsed->nLastUsedFrame != m_nFrame) {
+		const uint32 nEvictedPage = m_pLeastRecentlyUsed->nPage;
+		RemoveGlyph(m_pLeastRecentlyUsed);
+		m_nNumOfEvictions++;
+		Page &cPage = *m_lstPages[nEvictedPage];
+		if (AllocateFree(cPage, nWidth, nHeight, nX, nY) || AllocateSkyline(cPage, nWidth, nHeight, nX, nY)) {
+			nPage = nEvictedPage;
+			return true;
+		}
+	}
+
+	// Error!
+	return false;
+}
+
+/**
+*  @brief
+*    Allocates a rectangle inside the free rectangles of a page
+*/
+bool GlyphAtlas::AllocateFree(Page &cPage, uint32 nWidth, uint32 nHeight, uint32 &nX, uint32 &nY)
+{
+	// Find the smallest free rectangle the rectangle fits into
+	uint32 nBest = cPage.lstFree.GetNumOfElements();
+	uint32 nBestArea = 0;
+	for (uint32 i=0; i<cPage.lstFree.GetNumOfElements(); i++) {
+		const FreeRectangle &sFree = cPage.lstFree[i];
+		if (sFree.nWidth >= nWidth && sFree.nHeight >= nHeight && (nBest == cPage.lstFree.GetNumOfElements() || sFree.nWidth*sFree.nHeight < nBestArea)) {
+			nBest	  = i;
+			nBestArea = sFree.nWidth*sFree.nHeight;
+		}
+	}
+	if (nBest == cPage.lstFree.GetNumOfElements())
+		return false; // Error!
+
+	// Take the upper/left corner of the free rectangle
+	const FreeRectangle sFree = cPage.lstFree[nBest];
+	cPage.lstFree.RemoveAtIndex(nBest);
+	nX = sFree.nX;
+	nY = sFree.nY;
+
+	// Give the rest back, split into the part right of the rectangle and the part below the rectangle
+	if (sFree.nWidth - nWidth > GlyphPadding) {
+		FreeRectangle &sRight = cPage.lstFree.Add();
+		sRight.nX	   = sFree.nX + nWidth;
+		sRight.nY	   = sFree.nY;
+		sRight.nWidth  = sFree.nWidth - nWidth;
+		sRight.nHeight = nHeight;
+	}
+	if (sFree.nHeight - nHeight > GlyphPadding) {
+		FreeRectangle &sBelow = cPage.lstFree.Add();
+		sBelow.nX	   = sFree.nX;
+		sBelow.nY	   = sFree.nY + nHeight;
+		sBelow.nWidth  = sFree.nWidth;
+		sBelow.nHeight = sFree.nHeight - nHeight;
+	}
+
+	// Done
+	return true;
+}
+
+/**
+*  @brief
+*    Allocates a rectangle on top of the skyline of a page
+*/
+bool GlyphAtlas::AllocateSkyline(Page &cPage, uint32 nWidth, uint32 nHeight, uint32 &nX, uint32 &nY)
+{
+	Array<SkylineNode> &lstSkyline = cPage.lstSkyline;
+	const uint32 nNumOfNodes = lstSkyline.GetNumOfElements();
+
+	// Find the skyline position with the lowest top, on equal tops prefer the narrower segment (bottom-left rule)
+	uint32 nBest = nNumOfNodes;
+	uint32 nBestY = 0;
+	uint32 nBestWidth = 0;
+	for (uint32 i=0; i<nNumOfNodes && lstSkyline[i].nX + nWidth <= m_nPageSize; i++) {
+		// The rectangle rests on the highest segment below it
+		uint32 nTop = lstSkyline[i].nY;
+		bool   bFits = true;
+		for (uint32 j=i, nWidthLeft=nWidth; nWidthLeft; j++) {
+			if (lstSkyline[j].nY > nTop)
+				nTop = lstSkyline[j].nY;
+			if (nTop + nHeight > m_nPageSize) {
+				bFits = false;
+				break;
+			}
+			nWidthLeft = (lstSkyline[j].nWidth >= nWidthLeft) ? 0 : nWidthLeft - lstSkyline[j].nWidth;
+		}
+		if (bFits && (nBest == nNumOfNodes || nTop < nBestY || (nTop == nBestY && lstSkyline[i].nWidth < nBestWidth))) {
+			nBest	   = i;
+			nBestY	   = nTop;
+			nBestWidth = lstSkyline[i].nWidth;
+		}
+	}
+	if (nBest == nNumOfNodes)
+		return false; // Error!
+	nX = lstSkyline[nBest].nX;
+	nY = nBestY;
+
+	// Insert the new skyline segment on top of the rectangle
+	SkylineNode sNode;
+	sNode.nX	 = nX;
+	sNode.nY	 = nY + nHeight;
+	sNode.nWidth = nWidth;
+	lstSkyline.AddAtIndex(sNode, nBest);
+
+	// Shrink or remove the segments covered by the new one
+	for (uint32 i=nBest+1; i<lstSkyline.GetNumOfElements(); ) {
+		SkylineNode &sCovered = lstSkyline[i];
+		const uint32 nRight = sNode.nX + sNode.nWidth;
+		if (sCovered.nX >= nRight)
+			break;
+		const uint32 nShrink = nRight - sCovered.nX;
+		if (sCovered.nWidth <= nShrink) {
+			lstSkyline.RemoveAtIndex(i);
+		} else {
+			sCovered.nX		+= nShrink;
+			sCovered.nWidth -= nShrink;
+			break;
+		}
+	}
+
+	// Merge neighbour segments of the same height
+	for (uint32 i=0; i+1<lstSkyline.GetNumOfElements(); ) {
+		if (lstSkyline[i].nY == lstSkyline[i + 1].nY) {
+			lstSkyline[i].nWidth += lstSkyline[i + 1].nWidth;
+			lstSkyline.RemoveAtIndex(i + 1);
+		} else {
+			i++;
+		}
+	}
+
+	// Done
+	return true;
+}
+
+/**
+*  @brief
+*    Resets a page to an empty page
+*/
+void GlyphAtlas::ResetPage(Page &cPage)
+{
+	cPage.lstSkyline.Reset();
+	SkylineNode &sNode = cPage.lstSkyline.Add();
+	sNode.nX	 = 0;
+	sNode.nY	 = 0;
+	sNode.nWidth = m_nPageSize;
+	cPage.lstFree.Reset();
+	cPage.nNumOfGlyphs = 0;
+	cPage.nNumOfPixels = 0;
+}
+
+/**
+*  @brief
+*    Adds a glyph at the front of the LRU list
+*/
+void GlyphAtlas::LinkGlyph(Glyph &sGlyph)
+{
+	sGlyph.pPrevious = nullptr;
+	sGlyph.pNext	 = m_pMostRecentlyUsed;
+	if (m_pMostRecentlyUsed)
+		m_pMostRecentlyUsed->pPrevious = &sGlyph;
+	else
+		m_pLeastRecentlyUsed = &sGlyph;
+	m_pMostRecentlyUsed = &sGlyph;
+}
+
+/**
+*  @brief
+*    Removes a glyph from the LRU list
+*/
+void GlyphAtlas::UnlinkGlyph(Glyph &sGlyph)
+{
+	if (sGlyph.pPrevious)
+		sGlyph.pPrevious->pNext = sGlyph.pNext;
+	else
+		m_pMostRecentlyUsed = sGlyph.pNext;
+	if (sGlyph.pNext)
+		sGlyph.pNext->pPrevious = sGlyph.pPrevious;
+	else
+		m_pLeastRecentlyUsed = sGlyph.pPrevious;
+	sGlyph.pPrevious = nullptr;
+	sGlyph.pNext	 = nullptr;
+}
+
+/**
+*  @brief
+*    Removes a glyph and gives its space back to the page
+*/
+void GlyphAtlas::RemoveGlyph(Glyph *pGlyph)
+{
+	// Does the glyph occupy page space?
+	if (pGlyph->nWidth) {
+		UnlinkGlyph(*pGlyph);
+
+		// Clear the glyph bitmap, else it could bleed into glyphs reusing parts of the space
+		Page &cPage = *m_lstPages[pGlyph->nPage];
+		for (int nRow=0; nRow<pGlyph->vSize.y; nRow++)
+			MemoryManager::Set(&cPage.pnData[(pGlyph->nY + GlyphPadding + nRow)*m_nPageSize + pGlyph->nX + GlyphPadding], 0, pGlyph->vSize.x);
+		cPage.bDirty = true;
+		cPage.nNumOfPixels -= pGlyph->vSize.x*pGlyph->vSize.y;
+
+		// Give the space back, an empty page is reset as a whole
+		cPage.nNumOfGlyphs--;
+		if (cPage.nNumOfGlyphs) {
+			FreeRectangle &sFree = cPage.lstFree.Add();
+			sFree.nX	  = pGlyph->nX;
+			sFree.nY	  = pGlyph->nY;
+			sFree.nWidth  = pGlyph->nWidth;
+			sFree.nHeight = pGlyph->nHeight;
+		} else {
+			ResetPage(cPage);
+		}
+	}
+
+	// Destroy the glyph
+	m_mapGlyphs.Remove(pGlyph->nKey);
+	delete pGlyph;
+
+	// Previously returned glyphs may now be invalid
+	m_nGeneration++;
+}
+
+/**
+*  @brief
+*    Takes over the glyphs rasterized by the background thread
+*/
+void GlyphAtlas::TakeOverRasterizedGlyphs()
+{
+	// Get the rasterized jobs
+	m_pMutex->Lock();
+	Array<Job*> lstJobs = m_lstRasterized;
+	m_lstRasterized.Reset();
+	m_pMutex->Unlock();
+
+	// Set the glyph bitmaps
+	for (uint32 i=0; i<lstJobs.GetNumOfElements(); i++) {
+		Job *pJob = lstJobs[i];
+		Glyph *pGlyph = m_mapGlyphs.Get(pJob->nKey);
+		if (pGlyph && pGlyph->nState == Pending) {
+			if (pJob->bRasterized)
+				SetGlyphBitmap(*pGlyph, pJob->sBitmap);
+			else
+				pGlyph->nState = Missing;
+		}
+		if (pJob->sBitmap.pnData)
+			delete [] pJob->sBitmap.pnData;
+		delete pJob;
+		m_nNumOfPendingGlyphs--;
+	}
+
+	// Texts using placeholders must be shaped again
+	if (lstJobs.GetNumOfElements())
+		m_nGeneration++;
+}
+
+/**
+*  @brief
+*    Starts the background thread
+*/
+void GlyphAtlas::StartThread()
+{
+	m_bShutdown = false;
+	m_pThread = new Thread(RasterizeThreadFunction, this);
+	m_pThread->SetName("Glyph rasterization");
+	if (!m_pThread->Start()) {
+		// Error! Without background thread, the glyphs are rasterized on the calling thread.
+		delete m_pThread;
+		m_pThread = nullptr;
+		m_bBackgroundRasterization = false;
+	}
+}
+
+/**
+*  @brief
+*    Stops the background thread, the queued jobs are rasterized on the calling thread
+*/
+void GlyphAtlas::StopThread()
+{
+	if (m_pThread) {
+		// Tell the background thread to stop and wait until it's done
+		m_pMutex->Lock();
+		m_bShutdown = true;
+		m_pMutex->Unlock();
+		m_pSemaphore->Unlock();
+		m_pThread->Join();
+		delete m_pThread;
+		m_pThread = nullptr;
+		m_bShutdown = false;
+
+		// The remaining jobs are no longer rasterized in the background
+		WaitForRasterization();
+	}
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // PLRenderer
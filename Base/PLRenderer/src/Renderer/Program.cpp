@@ -48,6 +48,30 @@ Program::~Program()
 }
 
 
+//[-------------------------------------------------------]
+//[ Public virtual Program functions                      ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Returns the binary of the linked program
+*/
+bool Program::GetProgramBinary(uint32 &nFormat, Array<uint8> &lstBinary)
+{
+	// Not supported by default
+	return false;
+}
+
+/**
+*  @brief
+*    Links the program by using a program binary
+*/
+bool Program::SetProgramBinary(uint32 nFormat, const uint8 *pnBinary, uint32 nNumOfBytes)
+{
+	// Not supported by default
+	return false;
+}
+
+
 //[-------------------------------------------------------]
 //[ Protected functions                                   ]
 //[-------------------------------------------------------]
@@ -25,11 +25,16 @@
 //[-------------------------------------------------------]
 //[ Includes                                              ]
 //[-------------------------------------------------------]
+#include <PLCore/Log/Log.h>
+#include <PLCore/File/File.h>
+#include <PLCore/File/Directory.h>
+#include <PLCore/Tools/ChecksumCRC32.h>
 #include "PLRenderer/Renderer/Renderer.h"
 #include "PLRenderer/Renderer/Program.h"
 #include "PLRenderer/Renderer/VertexShader.h"
 #include "PLRenderer/Renderer/FragmentShader.h"
 #include "PLRenderer/Renderer/ShaderLanguage.h"
+#include "PLRenderer/RendererContext.h"
 #include "PLRenderer/Renderer/ProgramGenerator.h"
 
 
@@ -40,6 +45,68 @@ using namespace PLCore;
 namespace PLRenderer {
 
 
+//[-------------------------------------------------------]
+//[ Global definitions                                    ]
+//[-------------------------------------------------------]
+static const uint32 CacheMagic	   = 0x43475050;	/**< Program generator cache file magic number ("PPGC") */
+static const uint32 CacheVersion   = 1;				/**< Program generator cache file format version */
+static const uint32 CacheMaxLength = 0x4000000;		/**< Maximum length of a source code or binary within a cache file (64 MiB), larger ones are considered to be invalid */
+
+
+//[-------------------------------------------------------]
+//[ Global helper functions                               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Returns the flat hash table hash of combined program flags
+*/
+static inline uint32 GetProgramIDHash(uint64 nProgramID)
+{
+	// Mix all bits, the flags usually only differ within a few low bits
+	nProgramID ^= nProgramID >> 33;
+	nProgramID *= 0xff51afd7ed558ccdULL;
+	nProgramID ^= nProgramID >> 33;
+	return static_cast<uint32>(nProgramID);
+}
+
+/**
+*  @brief
+*    Writes a string into a cache file
+*/
+static bool WriteCacheString(File &cFile, const String &sString)
+{
+	const uint32 nLength = sString.GetLength();
+	return (cFile.Write(&nLength, sizeof(uint32), 1) == 1 && (!nLength || cFile.Write(sString.GetASCII(), nLength, 1) == 1));
+}
+
+/**
+*  @brief
+*    Reads a string from a cache file
+*/
+static bool ReadCacheString(File &cFile, String &sString)
+{
+	uint32 nLength = 0;
+	if (cFile.Read(&nLength, sizeof(uint32), 1) != 1 || nLength > CacheMaxLength)
+		return false; // Error!
+	if (nLength) {
+		char *pszString = new char[nLength + 1];
+		if (cFile.Read(pszString, nLength, 1) != 1) {
+			delete [] pszString;
+			return false; // Error!
+		}
+		pszString[nLength] = '\0';
+
+		// The string class takes over the control of the string memory and also deletes it
+		sString = String(pszString, false, nLength);
+	} else {
+		sString = "";
+	}
+
+	// Done
+	return true;
+}
+
+
 //[-------------------------------------------------------]
 //[ Public functions                                      ]
 //[-------------------------------------------------------]
@@ -55,8 +122,21 @@ ProgramGenerator::ProgramGenerator(Renderer &cRenderer, const String &sShaderLan
 	m_sVertexShader(sVertexShader),
 	m_sVertexShaderProfile(sVertexShaderProfile),
 	m_sFragmentShader(sFragmentShader),
-	m_sFragmentShaderProfile(sFragmentShaderProfile)
+	m_sFragmentShaderProfile(sFragmentShaderProfile),
+	m_pnPermutationSlots(nullptr),
+	m_nNumOfPermutationSlots(0),
+	m_nNumOfPendingPrograms(0),
+	m_nNextPendingProgram(0)
 {
+	// Is there a program cache directory? (the cache file name contains the source checksum, so each program generator has its own cache file)
+	const String sCacheDirectory = cRenderer.GetRendererContext().GetProgramCacheDirectory();
+	if (sCacheDirectory.GetLength()) {
+		m_sCacheFilename = sCacheDirectory + '/' + String::Format("%08x", GetSourceChecksum()) + ".cache";
+
+		// Generate the program permutations recorded during previous runs right now instead of when they're requested during rendering
+		if (LoadCache(m_sCacheFilename))
+			WarmUp();
+	}
 }
 
 /**
@@ -65,8 +145,23 @@ ProgramGenerator::ProgramGenerator(Renderer &cRenderer, const String &sShaderLan
 */
 ProgramGenerator::~ProgramGenerator()
 {
+	// Save the recorded program permutations for the next run, this has to be done before the generated programs are destroyed
+	if (m_sCacheFilename.GetLength() && m_lstPermutations.GetNumOfElements()) {
+		Directory cDirectory(m_sCacheFilename.GetSubstring(0, m_sCacheFilename.LastIndexOf('/')));
+		if (!cDirectory.Exists())
+			cDirectory.CreateRecursive();
+		if (!SaveCache(m_sCacheFilename))
+			PL_LOG(Warning, "Failed to save the program generator cache '" + m_sCacheFilename + '\'')
+	}
+
 	// Clear the cache of the program generator
 	ClearCache();
+
+	// Destroy the recorded program permutations
+	for (uint32 i=0; i<m_lstPermutations.GetNumOfElements(); i++)
+		delete m_lstPermutations[i];
+	if (m_pnPermutationSlots)
+		delete [] m_pnPermutationSlots;
 }
 
 /**
@@ -75,129 +170,29 @@ ProgramGenerator::~ProgramGenerator()
 */
 ProgramGenerator::GeneratedProgram *ProgramGenerator::GetProgram(const Flags &cFlags)
 {
-	// Get the unique vertex shader and fragment shader ID's, we're taking the flags for this :D
-	const uint32 nVertexShaderID   = cFlags.GetVertexShaderFlags();
-	const uint32 nFragmentShaderID = cFlags.GetFragmentShaderFlags();
-
-	// Combine the two ID's into an unique 64 bit integer we can use to reference the linked program
-	const uint64 nProgramID = nVertexShaderID + static_cast<uint64>(static_cast<uint64>(nFragmentShaderID)<<32);
-
-	// Is there already a generated program with the requested flags?
-	GeneratedProgram *pGeneratedProgram = m_mapPrograms.Get(nProgramID);
-	if (!pGeneratedProgram) {
-		// Is there already a vertex shader with the requested flags?
-		VertexShader *pVertexShader = m_mapVertexShaders.Get(nVertexShaderID);
-		if (!pVertexShader) {
-			// Get the shader language to use
-			ShaderLanguage *pShaderLanguage = m_pRenderer->GetShaderLanguage(m_sShaderLanguage);
-			if (pShaderLanguage) {
-				// Create a new vertex shader instance
-				pVertexShader = pShaderLanguage->CreateVertexShader();
-				if (pVertexShader) {
-					String sSourceCode;
-
-					// When using GLSL, the profile is the GLSL version to use - #version must occur before any other statement in the program!
-					if (m_sShaderLanguage == "GLSL" && m_sVertexShaderProfile.GetLength())
-						sSourceCode += "#version " + m_sVertexShaderProfile + '\n';
-
-					// Add flag definitions to the shader source code
-					const Array<const char *> &lstVertexShaderDefinitions = cFlags.GetVertexShaderDefinitions();
-					const uint32 nNumOfVertexShaderDefinitions = lstVertexShaderDefinitions.GetNumOfElements();
-					for (uint32 i=0; i<nNumOfVertexShaderDefinitions; i++) {
-						// Get the flag definition
-						const char *pszDefinition = lstVertexShaderDefinitions[i];
-						if (pszDefinition) {
-							sSourceCode += "#define ";
-							sSourceCode += pszDefinition;
-							sSourceCode += '\n';
-						}
-					}
-
-					// Add the shader source code
-					sSourceCode += m_sVertexShader;
-
-					// Set the combined shader source code
-					pVertexShader->SetSourceCode(sSourceCode, m_sVertexShaderProfile);
-
-					// Add the created shader to the cache of the program generator
-					m_lstVertexShaders.Add(pVertexShader);
-					m_mapVertexShaders.Add(nVertexShaderID, pVertexShader);
-				}
-			}
-		}
-
-		// If we have no vertex shader, we don't need to continue constructing a program...
-		if (pVertexShader) {
-			// Is there already a fragment shader with the requested flags?
-			FragmentShader *pFragmentShader = m_mapFragmentShaders.Get(nFragmentShaderID);
-			if (!pFragmentShader) {
-				// Get the shader language to use
-				ShaderLanguage *pShaderLanguage = m_pRenderer->GetShaderLanguage(m_sShaderLanguage);
-				if (pShaderLanguage) {
-					// Create a new fragment shader instance
-					pFragmentShader = pShaderLanguage->CreateFragmentShader();
-					if (pFragmentShader) {
-						String sSourceCode;
-
-						// When using GLSL, the profile is the GLSL version to use - #version must occur before any other statement in the program!
-						if (m_sShaderLanguage == "GLSL" && m_sFragmentShaderProfile.GetLength())
-							sSourceCode += "#version " + m_sFragmentShaderProfile + '\n';
-
-						// Add flag definitions to the shader source code
-						const Array<const char *> &lstFragmentShaderDefinitions = cFlags.GetFragmentShaderDefinitions();
-						const uint32 nNumOfFragmentShaderDefinitions = lstFragmentShaderDefinitions.GetNumOfElements();
-						for (uint32 i=0; i<nNumOfFragmentShaderDefinitions; i++) {
-							// Get the flag definition
-							const char *pszDefinition = lstFragmentShaderDefinitions[i];
-							if (pszDefinition) {
-								sSourceCode += "#define ";
-								sSourceCode += pszDefinition;
-								sSourceCode += '\n';
-							}
-						}
-
-						// Add the shader source code
-						sSourceCode += m_sFragmentShader;
-
-						// Set the combined shader source code
-						pFragmentShader->SetSourceCode(sSourceCode, m_sFragmentShaderProfile);
-
-						// Add the created shader to the cache of the program generator
-						m_lstFragmentShaders.Add(pFragmentShader);
-						m_mapFragmentShaders.Add(nFragmentShaderID, pFragmentShader);
-					}
-				}
-			}
-
-			// If we have no fragment shader, we don't need to continue constructing a program...
-			if (pFragmentShader) {
-				// Get the shader language to use
-				ShaderLanguage *pShaderLanguage = m_pRenderer->GetShaderLanguage(m_sShaderLanguage);
-				if (pShaderLanguage) {
-					// Create a program instance and assign the created vertex and fragment shaders to it
-					Program *pProgram = pShaderLanguage->CreateProgram(pVertexShader, pFragmentShader);
-					if (pProgram) {
-						// Create a generated program contained
-						pGeneratedProgram = new GeneratedProgram;
-						pGeneratedProgram->pProgram			    = pProgram;
-						pGeneratedProgram->nVertexShaderFlags   = cFlags.GetVertexShaderFlags();
-						pGeneratedProgram->nFragmentShaderFlags = cFlags.GetFragmentShaderFlags();
-						pGeneratedProgram->pUserData			= nullptr;
-
-						// Add our nark which will inform us as soon as the program gets dirty
-						pProgram->EventDirty.Connect(EventHandlerDirty);
-
-						// Add the created program to the cache of the program generator
-						m_lstPrograms.Add(pGeneratedProgram);
-						m_mapPrograms.Add(nProgramID, pGeneratedProgram);
-					}
-				}
-			}
-		}
+	// Combine the vertex shader and fragment shader flags into an unique 64 bit integer we can use to reference the linked program
+	const uint64 nProgramID = cFlags.GetVertexShaderFlags() + static_cast<uint64>(static_cast<uint64>(cFlags.GetFragmentShaderFlags())<<32);
+
+	// Is there already a recorded program permutation with the requested flags?
+	Permutation *pPermutation = GetPermutation(nProgramID);
+
+	// A program permutation loaded from a cache file is verified when it's requested the first time
+	if (pPermutation && !pPermutation->bVerified && !VerifyPermutation(*pPermutation, cFlags))
+		pPermutation = nullptr; // The flag definitions were changed, all loaded program permutations were discarded
+	if (pPermutation) {
+		// Is there already a generated program? (this is the usual case during rendering)
+		if (pPermutation->pGeneratedProgram)
+			return pPermutation->pGeneratedProgram;
+	} else {
+		// Record the new program permutation, the flag definitions are only valid during this call so the shader source codes are generated right now
+		pPermutation = &AddPermutation(nProgramID);
+		pPermutation->sVertexShaderSourceCode   = GenerateSourceCode(m_sVertexShaderProfile,   cFlags.GetVertexShaderDefinitions(),   m_sVertexShader);
+		pPermutation->sFragmentShaderSourceCode = GenerateSourceCode(m_sFragmentShaderProfile, cFlags.GetFragmentShaderDefinitions(), m_sFragmentShader);
+		pPermutation->bVerified                 = true;
 	}
 
-	// Return the program
-	return pGeneratedProgram;
+	// Generate the program
+	return GenerateProgram(*pPermutation);
 }
 
 /**
@@ -215,7 +210,10 @@ void ProgramGenerator::ClearCache()
 		delete pGeneratedProgram;
 	}
 	m_lstPrograms.Clear();
-	m_mapPrograms.Clear();
+
+	// The recorded program permutations are kept, but they no longer have a generated program
+	for (uint32 i=0; i<m_lstPermutations.GetNumOfElements(); i++)
+		m_lstPermutations[i]->pGeneratedProgram = nullptr;
 
 	// Destroy all generated fragment shader instances
 	for (uint32 i=0; i<m_lstFragmentShaders.GetNumOfElements(); i++)
@@ -230,6 +228,168 @@ void ProgramGenerator::ClearCache()
 	m_mapVertexShaders.Clear();
 }
 
+/**
+*  @brief
+*    Returns the number of recorded program permutations
+*/
+uint32 ProgramGenerator::GetNumOfRecordedPrograms() const
+{
+	return m_lstPermutations.GetNumOfElements();
+}
+
+/**
+*  @brief
+*    Returns the generated shader source codes of a recorded program permutation
+*/
+bool ProgramGenerator::GetRecordedProgram(uint32 nVertexShaderFlags, uint32 nFragmentShaderFlags, String &sVertexShaderSourceCode, String &sFragmentShaderSourceCode) const
+{
+	const Permutation *pPermutation = GetPermutation(nVertexShaderFlags + static_cast<uint64>(static_cast<uint64>(nFragmentShaderFlags)<<32));
+	if (pPermutation) {
+		sVertexShaderSourceCode   = pPermutation->sVertexShaderSourceCode;
+		sFragmentShaderSourceCode = pPermutation->sFragmentShaderSourceCode;
+
+		// Done
+		return true;
+	}
+
+	// Error!
+	return false;
+}
+
+/**
+*  @brief
+*    Returns the number of program permutations loaded by "LoadCache()" which were not generated, yet
+*/
+uint32 ProgramGenerator::GetNumOfPendingPrograms() const
+{
+	return m_nNumOfPendingPrograms;
+}
+
+/**
+*  @brief
+*    Loads recorded program permutations from a cache file
+*/
+bool ProgramGenerator::LoadCache(const String &sFilename)
+{
+	// Open the file
+	File cFile(sFilename);
+	if (!cFile.Open(File::FileRead))
+		return false; // Error!
+
+	// Read and check the header
+	uint32 nHeader[4] = { 0, 0, 0, 0 }; // Magic number, version, source checksum, number of program permutations
+	if (cFile.Read(nHeader, sizeof(uint32), 4) != 4 || nHeader[0] != CacheMagic || nHeader[1] != CacheVersion) {
+		PL_LOG(Warning, "Program generator cache '" + sFilename + "' is invalid")
+		return false; // Error!
+	}
+	if (nHeader[2] != GetSourceChecksum()) {
+		// The cache file was written for other shader source codes, this is not an error but the cache can't be used
+		PL_LOG(Info, "Program generator cache '" + sFilename + "' is outdated and therefore ignored")
+		return false;
+	}
+
+	// Read the program permutations
+	for (uint32 i=0; i<nHeader[3]; i++) {
+		// Read the program permutation
+		uint64 nProgramID = 0;
+		String sVertexShaderSourceCode, sFragmentShaderSourceCode;
+		uint32 nBinaryFormat = 0, nBinarySize = 0;
+		if (cFile.Read(&nProgramID, sizeof(uint64), 1) != 1 || !ReadCacheString(cFile, sVertexShaderSourceCode) || !ReadCacheString(cFile, sFragmentShaderSourceCode) ||
+			cFile.Read(&nBinaryFormat, sizeof(uint32), 1) != 1 || cFile.Read(&nBinarySize, sizeof(uint32), 1) != 1 || nBinarySize > CacheMaxLength) {
+			PL_LOG(Warning, "Program generator cache '" + sFilename + "' is truncated")
+			return false; // Error!
+		}
+
+		// Record the program permutation, if it's not already recorded
+		Permutation *pPermutation = GetPermutation(nProgramID);
+		if (pPermutation) {
+			// Skip the binary
+			cFile.Seek(nBinarySize, File::SeekCurrent);
+		} else {
+			Permutation &sPermutation = AddPermutation(nProgramID);
+			sPermutation.sVertexShaderSourceCode   = sVertexShaderSourceCode;
+			sPermutation.sFragmentShaderSourceCode = sFragmentShaderSourceCode;
+			if (nBinarySize) {
+				sPermutation.nBinaryFormat = nBinaryFormat;
+				sPermutation.lstBinary.Resize(nBinarySize);
+				if (cFile.Read(sPermutation.lstBinary.GetData(), nBinarySize, 1) != 1)
+					sPermutation.lstBinary.Clear();
+			}
+			sPermutation.bPending = true;
+			m_nNumOfPendingPrograms++;
+		}
+	}
+
+	// Done
+	return true;
+}
+
+/**
+*  @brief
+*    Saves the recorded program permutations into a cache file
+*/
+bool ProgramGenerator::SaveCache(const String &sFilename) const
+{
+	// Create the file
+	File cFile(sFilename);
+	if (!cFile.Open(File::FileCreate | File::FileWrite))
+		return false; // Error!
+
+	// Write the header
+	const uint32 nHeader[4] = { CacheMagic, CacheVersion, GetSourceChecksum(), m_lstPermutations.GetNumOfElements() };
+	bool bResult = (cFile.Write(nHeader, sizeof(uint32), 4) == 4);
+
+	// Write the program permutations
+	Array<uint8> lstBinary;
+	for (uint32 i=0; i<m_lstPermutations.GetNumOfElements() && bResult; i++) {
+		const Permutation &sPermutation = *m_lstPermutations[i];
+
+		// Get the program binary, if there's one
+		uint32 nBinaryFormat = 0;
+		lstBinary.Clear();
+		if (sPermutation.pGeneratedProgram) {
+			sPermutation.pGeneratedProgram->pProgram->GetProgramBinary(nBinaryFormat, lstBinary);
+		} else if (sPermutation.lstBinary.GetNumOfElements()) {
+			// Still pending, just write back the loaded program binary
+			nBinaryFormat = sPermutation.nBinaryFormat;
+			lstBinary	  = sPermutation.lstBinary;
+		}
+		const uint32 nBinarySize = lstBinary.GetNumOfElements();
+
+		// Write the program permutation
+		bResult = (cFile.Write(&sPermutation.nProgramID, sizeof(uint64), 1) == 1 &&
+				   WriteCacheString(cFile, sPermutation.sVertexShaderSourceCode) && WriteCacheString(cFile, sPermutation.sFragmentShaderSourceCode) &&
+				   cFile.Write(&nBinaryFormat, sizeof(uint32), 1) == 1 && cFile.Write(&nBinarySize, sizeof(uint32), 1) == 1 &&
+				   (!nBinarySize || cFile.Write(lstBinary.GetData(), nBinarySize, 1) == 1));
+	}
+
+	// Done
+	return bResult;
+}
+
+/**
+*  @brief
+*    Generates pending program permutations
+*/
+uint32 ProgramGenerator::WarmUp(uint32 nMaxNumOfPrograms)
+{
+	uint32 nNumOfGeneratedPrograms = 0;
+	while (m_nNumOfPendingPrograms && m_nNextPendingProgram < m_lstPermutations.GetNumOfElements() && (!nMaxNumOfPrograms || nNumOfGeneratedPrograms < nMaxNumOfPrograms)) {
+		Permutation &sPermutation = *m_lstPermutations[m_nNextPendingProgram];
+		if (sPermutation.bPending) {
+			// Generate the program and ensure that it's compiled and linked right now
+			GeneratedProgram *pGeneratedProgram = GenerateProgram(sPermutation);
+			if (pGeneratedProgram)
+				pGeneratedProgram->pProgram->IsValid();
+			nNumOfGeneratedPrograms++;
+		}
+		m_nNextPendingProgram++;
+	}
+
+	// Return the number of still pending program permutations
+	return m_nNumOfPendingPrograms;
+}
+
 
 //[-------------------------------------------------------]
 //[ Private functions                                     ]
@@ -239,7 +399,11 @@ void ProgramGenerator::ClearCache()
 *    Copy constructor
 */
 ProgramGenerator::ProgramGenerator(const ProgramGenerator &cSource) :
-	m_pRenderer(nullptr)
+	m_pRenderer(nullptr),
+	m_pnPermutationSlots(nullptr),
+	m_nNumOfPermutationSlots(0),
+	m_nNumOfPendingPrograms(0),
+	m_nNextPendingProgram(0)
 {
 	// No implementation because the copy constructor is never used
 }
@@ -276,6 +440,241 @@ void ProgramGenerator::OnDirty(Program *pProgram)
 	}
 }
 
+/**
+*  @brief
+*    Returns the checksum identifying the shader language, shader source codes and profiles
+*/
+uint32 ProgramGenerator::GetSourceChecksum() const
+{
+	const String sSource = m_sShaderLanguage + '\n' + m_sVertexShaderProfile + '\n' + m_sFragmentShaderProfile + '\n' + m_sVertexShader + '\n' + m_sFragmentShader;
+	return ChecksumCRC32().GetChecksum(reinterpret_cast<const uint8*>(sSource.GetASCII()), sSource.GetLength());
+}
+
+/**
+*  @brief
+*    Generates shader source code
+*/
+String ProgramGenerator::GenerateSourceCode(const String &sProfile, const Array<const char *> &lstDefinitions, const String &sSourceCode) const
+{
+	String sGeneratedSourceCode;
+
+	// When using GLSL, the profile is the GLSL version to use - #version must occur before any other statement in the program!
+	if (m_sShaderLanguage == "GLSL" && sProfile.GetLength())
+		sGeneratedSourceCode += "#version " + sProfile + '\n';
+
+	// Add flag definitions to the shader source code
+	const uint32 nNumOfDefinitions = lstDefinitions.GetNumOfElements();
+	for (uint32 i=0; i<nNumOfDefinitions; i++) {
+		// Get the flag definition
+		const char *pszDefinition = lstDefinitions[i];
+		if (pszDefinition) {
+			sGeneratedSourceCode += "#define ";
+			sGeneratedSourceCode += pszDefinition;
+			sGeneratedSourceCode += '\n';
+		}
+	}
+
+	// Add the shader source code
+	sGeneratedSourceCode += sSourceCode;
+
+	// Done
+	return sGeneratedSourceCode;
+}
+
+/**
+*  @brief
+*    Returns a recorded program permutation
+*/
+ProgramGenerator::Permutation *ProgramGenerator::GetPermutation(uint64 nProgramID) const
+{
+	if (m_nNumOfPermutationSlots) {
+		// Linear probing until the program permutation or an empty slot was found
+		const uint32 nMask = m_nNumOfPermutationSlots - 1;
+		for (uint32 nSlot=GetProgramIDHash(nProgramID)&nMask; m_pnPermutationSlots[nSlot]; nSlot=(nSlot + 1)&nMask) {
+			Permutation *pPermutation = m_lstPermutations[m_pnPermutationSlots[nSlot] - 1];
+			if (pPermutation->nProgramID == nProgramID)
+				return pPermutation;
+		}
+	}
+
+	// There's no such program permutation
+	return nullptr;
+}
+
+/**
+*  @brief
+*    Records a new program permutation
+*/
+ProgramGenerator::Permutation &ProgramGenerator::AddPermutation(uint64 nProgramID)
+{
+	// Create the program permutation
+	Permutation *pPermutation = new Permutation;
+	pPermutation->nProgramID		= nProgramID;
+	pPermutation->nBinaryFormat		= 0;
+	pPermutation->pGeneratedProgram	= nullptr;
+	pPermutation->bPending			= false;
+	pPermutation->bVerified			= false;
+	m_lstPermutations.Add(pPermutation);
+	const uint32 nNumOfPermutations = m_lstPermutations.GetNumOfElements();
+
+	// Keep the flat hash table at most half full, grow it by rehashing all recorded program permutations
+	uint32 nFirstPermutation = nNumOfPermutations - 1; // By default, only the new program permutation must be inserted
+	if (nNumOfPermutations*2 > m_nNumOfPermutationSlots) {
+		if (m_pnPermutationSlots)
+			delete [] m_pnPermutationSlots;
+		m_nNumOfPermutationSlots = m_nNumOfPermutationSlots ? m_nNumOfPermutationSlots*2 : 64;
+		m_pnPermutationSlots = new uint32[m_nNumOfPermutationSlots];
+		MemoryManager::Set(m_pnPermutationSlots, 0, sizeof(uint32)*m_nNumOfPermutationSlots);
+		nFirstPermutation = 0;
+	}
+
+	// Insert the program permutations into the flat hash table
+	const uint32 nMask = m_nNumOfPermutationSlots - 1;
+	for (uint32 i=nFirstPermutation; i<nNumOfPermutations; i++) {
+		uint32 nSlot = GetProgramIDHash(m_lstPermutations[i]->nProgramID)&nMask;
+		while (m_pnPermutationSlots[nSlot])
+			nSlot = (nSlot + 1)&nMask;
+		m_pnPermutationSlots[nSlot] = i + 1;
+	}
+
+	// Done
+	return *pPermutation;
+}
+
+/**
+*  @brief
+*    Verifies a loaded program permutation against the flag definitions it's requested with
+*/
+bool ProgramGenerator::VerifyPermutation(Permutation &sPermutation, const Flags &cFlags)
+{
+	// The generated shader source codes contain the flag definitions, so they must be identical to the ones generated for the requested flags
+	if (sPermutation.sVertexShaderSourceCode   == GenerateSourceCode(m_sVertexShaderProfile,   cFlags.GetVertexShaderDefinitions(),   m_sVertexShader) &&
+		sPermutation.sFragmentShaderSourceCode == GenerateSourceCode(m_sFragmentShaderProfile, cFlags.GetFragmentShaderDefinitions(), m_sFragmentShader)) {
+		sPermutation.bVerified = true;
+
+		// Done
+		return true;
+	}
+
+	// The program flags were mapped to other flag definitions when the cache file was written, none of the loaded program permutations can be trusted
+	PL_LOG(Info, "Program generator cache is outdated because the flag definitions were changed, the loaded program permutations are discarded")
+
+	// Destroy all generated programs, some of them may have been generated by using outdated shader source codes
+	ClearCache();
+
+	// Discard the program permutations which were not verified, yet
+	for (uint32 i=0; i<m_lstPermutations.GetNumOfElements();) {
+		Permutation *pPermutation = m_lstPermutations[i];
+		if (pPermutation->bVerified) {
+			i++;
+		} else {
+			delete pPermutation;
+			m_lstPermutations.RemoveAtIndex(i);
+		}
+	}
+	m_nNumOfPendingPrograms = 0;
+	m_nNextPendingProgram   = 0;
+
+	// Rebuild the flat hash table using the remaining program permutations
+	if (m_pnPermutationSlots) {
+		MemoryManager::Set(m_pnPermutationSlots, 0, sizeof(uint32)*m_nNumOfPermutationSlots);
+		const uint32 nMask = m_nNumOfPermutationSlots - 1;
+		for (uint32 i=0; i<m_lstPermutations.GetNumOfElements(); i++) {
+			uint32 nSlot = GetProgramIDHash(m_lstPermutations[i]->nProgramID)&nMask;
+			while (m_pnPermutationSlots[nSlot])
+				nSlot = (nSlot + 1)&nMask;
+			m_pnPermutationSlots[nSlot] = i + 1;
+		}
+	}
+
+	// Error!
+	return false;
+}
+
+/**
+*  @brief
+*    Generates the program of a recorded program permutation
+*/
+ProgramGenerator::GeneratedProgram *ProgramGenerator::GenerateProgram(Permutation &sPermutation)
+{
+	// The program permutation is no longer pending
+	if (sPermutation.bPending) {
+		sPermutation.bPending = false;
+		m_nNumOfPendingPrograms--;
+	}
+
+	// Get the shader language to use
+	ShaderLanguage *pShaderLanguage = m_pRenderer->GetShaderLanguage(m_sShaderLanguage);
+	if (pShaderLanguage) {
+		// Get the unique vertex shader and fragment shader ID's, we're taking the flags for this :D
+		const uint32 nVertexShaderID   = static_cast<uint32>(sPermutation.nProgramID);
+		const uint32 nFragmentShaderID = static_cast<uint32>(sPermutation.nProgramID>>32);
+
+		// Is there already a vertex shader with the requested flags?
+		VertexShader *pVertexShader = m_mapVertexShaders.Get(nVertexShaderID);
+		if (!pVertexShader) {
+			// Create a new vertex shader instance
+			pVertexShader = pShaderLanguage->CreateVertexShader();
+			if (pVertexShader) {
+				// Set the generated shader source code
+				pVertexShader->SetSourceCode(sPermutation.sVertexShaderSourceCode, m_sVertexShaderProfile);
+
+				// Add the created shader to the cache of the program generator
+				m_lstVertexShaders.Add(pVertexShader);
+				m_mapVertexShaders.Add(nVertexShaderID, pVertexShader);
+			}
+		}
+
+		// If we have no vertex shader, we don't need to continue constructing a program...
+		if (pVertexShader) {
+			// Is there already a fragment shader with the requested flags?
+			FragmentShader *pFragmentShader = m_mapFragmentShaders.Get(nFragmentShaderID);
+			if (!pFragmentShader) {
+				// Create a new fragment shader instance
+				pFragmentShader = pShaderLanguage->CreateFragmentShader();
+				if (pFragmentShader) {
+					// Set the generated shader source code
+					pFragmentShader->SetSourceCode(sPermutation.sFragmentShaderSourceCode, m_sFragmentShaderProfile);
+
+					// Add the created shader to the cache of the program generator
+					m_lstFragmentShaders.Add(pFragmentShader);
+					m_mapFragmentShaders.Add(nFragmentShaderID, pFragmentShader);
+				}
+			}
+
+			// If we have no fragment shader, we don't need to continue constructing a program...
+			if (pFragmentShader) {
+				// Create a program instance and assign the created vertex and fragment shaders to it
+				Program *pProgram = pShaderLanguage->CreateProgram(pVertexShader, pFragmentShader);
+				if (pProgram) {
+					// Try to link the program by using the cached program binary, on failure it's linked as usual
+					if (sPermutation.lstBinary.GetNumOfElements()) {
+						pProgram->SetProgramBinary(sPermutation.nBinaryFormat, sPermutation.lstBinary.GetData(), sPermutation.lstBinary.GetNumOfElements());
+						sPermutation.lstBinary.Clear();
+					}
+
+					// Create a generated program contained
+					GeneratedProgram *pGeneratedProgram = new GeneratedProgram;
+					pGeneratedProgram->pProgram				= pProgram;
+					pGeneratedProgram->nVertexShaderFlags	= nVertexShaderID;
+					pGeneratedProgram->nFragmentShaderFlags	= nFragmentShaderID;
+					pGeneratedProgram->pUserData			= nullptr;
+
+					// Add our nark which will inform us as soon as the program gets dirty
+					pProgram->EventDirty.Connect(EventHandlerDirty);
+
+					// Add the created program to the cache of the program generator
+					m_lstPrograms.Add(pGeneratedProgram);
+					sPermutation.pGeneratedProgram = pGeneratedProgram;
+				}
+			}
+		}
+	}
+
+	// Return the program
+	return sPermutation.pGeneratedProgram;
+}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
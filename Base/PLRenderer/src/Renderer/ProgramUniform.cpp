@@ -25,6 +25,7 @@
 //[-------------------------------------------------------]
 //[ Includes                                              ]
 //[-------------------------------------------------------]
+#include <PLCore/Core/MemoryManager.h>
 #include "PLRenderer/Renderer/ProgramUniform.h"
 
 
@@ -32,6 +33,7 @@
 //[ Namespace                                             ]
 //[-------------------------------------------------------]
 namespace PLRenderer {
+using namespace PLCore;
 
 
 //[-------------------------------------------------------]
@@ -41,7 +43,8 @@ namespace PLRenderer {
 *  @brief
 *    Constructor
 */
-ProgramUniform::ProgramUniform()
+ProgramUniform::ProgramUniform() :
+	m_nCacheSize(0)
 {
 }
 
@@ -53,6 +56,41 @@ ProgramUniform::~ProgramUniform()
 {
 }
 
+/**
+*  @brief
+*    Updates the cached uniform value
+*/
+bool ProgramUniform::UpdateCache(const void *pData, uint32 nSize)
+{
+	// Is the value too large to be cached?
+	if (nSize > sizeof(m_nCache)) {
+		m_nCacheSize = 0;
+
+		// The value must be passed to the API
+		return true;
+	}
+
+	// Is the change redundant?
+	if (m_nCacheSize == nSize && !MemoryManager::Compare(m_nCache, pData, nSize))
+		return false;
+
+	// Update the cached value
+	MemoryManager::Copy(m_nCache, pData, nSize);
+	m_nCacheSize = nSize;
+
+	// The value must be passed to the API
+	return true;
+}
+
+/**
+*  @brief
+*    Invalidates the cached uniform value, the next value is passed to the API
+*/
+void ProgramUniform::InvalidateCache()
+{
+	m_nCacheSize = 0;
+}
+
 
 //[-------------------------------------------------------]
 //[ Private functions                                     ]
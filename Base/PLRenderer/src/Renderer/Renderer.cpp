@@ -25,6 +25,7 @@
 //[-------------------------------------------------------]
 //[ Includes                                              ]
 //[-------------------------------------------------------]
+#include "PLRenderer/Renderer/CommandList.h"
 #include "PLRenderer/Renderer/Renderer.h"
 
 
@@ -42,6 +43,19 @@ pl_class_metadata(Renderer, "PLRenderer", PLCore::Object, "Abstract renderer mai
 pl_class_metadata_end(Renderer)
 
 
+//[-------------------------------------------------------]
+//[ Public functions                                      ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Executes a command list
+*/
+bool Renderer::Execute(const CommandList &cCommandList)
+{
+	return cCommandList.Replay(*this);
+}
+
+
 //[-------------------------------------------------------]
 //[ Protected functions                                   ]
 //[-------------------------------------------------------]
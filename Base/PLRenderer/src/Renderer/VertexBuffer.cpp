@@ -25,6 +25,7 @@
 //[-------------------------------------------------------]
 //[ Includes                                              ]
 //[-------------------------------------------------------]
+#include <PLMath/Math.h>
 #include <PLMath/Half.h>
 #include <PLMath/Vector3.h>
 #include "PLRenderer/Renderer/Renderer.h"
@@ -42,6 +43,75 @@ using namespace PLGraphics;
 namespace PLRenderer {
 
 
+//[-------------------------------------------------------]
+//[ Global helper functions                               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Returns the number of components of the given vertex attribute type
+*/
+uint32 GetNumOfComponents(VertexBuffer::EType nType)
+{
+	switch (nType) {
+		case VertexBuffer::RGBA:   return 4;
+		case VertexBuffer::Float1: return 1;
+		case VertexBuffer::Float2: return 2;
+		case VertexBuffer::Float3: return 3;
+		case VertexBuffer::Float4: return 4;
+		case VertexBuffer::Short2: return 2;
+		case VertexBuffer::Short4: return 4;
+		case VertexBuffer::Half1:  return 1;
+		case VertexBuffer::Half2:  return 2;
+		case VertexBuffer::Half3:  return 3;
+		case VertexBuffer::Half4:  return 4;
+		case VertexBuffer::UByte4N: return 4;
+		case VertexBuffer::Short2N: return 2;
+		case VertexBuffer::Short4N: return 4;
+		default:				   return 0;
+	}
+}
+
+/**
+*  @brief
+*    Converts a floating point value into an unsigned normalized 8 bit integer (clamped to [0, 1], rounded to nearest)
+*/
+inline uint8 ToUNorm8(float fValue)
+{
+	return static_cast<uint8>(Math::Min(Math::Max(fValue, 0.0f), 1.0f)*255.0f + 0.5f);
+}
+
+/**
+*  @brief
+*    Converts an unsigned normalized 8 bit integer into a floating point value
+*/
+inline float FromUNorm8(uint8 nValue)
+{
+	return static_cast<float>(nValue)/255.0f;
+}
+
+/**
+*  @brief
+*    Converts a floating point value into a signed normalized 16 bit integer (clamped to [-1, 1], rounded to nearest)
+*/
+inline int16 ToSNorm16(float fValue)
+{
+	const float fScaled = Math::Min(Math::Max(fValue, -1.0f), 1.0f)*32767.0f;
+	return static_cast<int16>((fScaled < 0.0f) ? fScaled - 0.5f : fScaled + 0.5f);
+}
+
+/**
+*  @brief
+*    Converts a signed normalized 16 bit integer into a floating point value
+*
+*  @note
+*    - -32768 and -32767 both map to -1 (as defined by the graphics APIs)
+*/
+inline float FromSNorm16(int16 nValue)
+{
+	return Math::Max(static_cast<float>(nValue)/32767.0f, -1.0f);
+}
+
+
 //[-------------------------------------------------------]
 //[ Public functions                                      ]
 //[-------------------------------------------------------]
@@ -97,12 +167,12 @@ bool VertexBuffer::AddVertexAttribute(ESemantic nSemantic, uint32 nChannel, ETyp
 			return false; // Error, the vertex attribute is already defined!
 	}
 
-	// Check normal, tangent and binormal (only Float3/Half3 allowed due to restrictions of legacy APIs!)
-	if ((nSemantic == Normal || nSemantic == Tangent || nSemantic == Binormal) && nType != Float3 && nType != Half3)
+	// Check normal, tangent and binormal (only Float3/Half3/Short4N allowed due to restrictions of legacy APIs!)
+	if ((nSemantic == Normal || nSemantic == Tangent || nSemantic == Binormal) && nType != Float3 && nType != Half3 && nType != Short4N)
 		return false; // Error!
 
 	// Check color
-	if (nSemantic == Color && nType != RGBA)
+	if (nSemantic == Color && nType != RGBA && nType != UByte4N)
 		return false; // Error!
 
 	// Check whether the channel is correct
@@ -141,6 +211,7 @@ bool VertexBuffer::AddVertexAttribute(ESemantic nSemantic, uint32 nChannel, ETyp
 	pAttribute->nSizeAPI	   = 0;
 	pAttribute->nTypeAPI	   = 0;
 	pAttribute->nComponentsAPI = 0;
+	pAttribute->bNormalizedAPI = false;
 
 	// Call API dependent vertex attribute added function
 	VertexAttributeAdded(*pAttribute);
@@ -436,6 +507,54 @@ bool VertexBuffer::GetFloat(uint32 nIndex, uint32 nSemantic, uint32 nChannel, fl
 				}
 				break;
 			}
+
+			// Unsigned byte 4 normalized (four components per element, 8 bit unsigned integer per component mapped to [0, 1], may not be supported by each API)
+			case UByte4N:
+			{
+				const uint8 *pnVertex = static_cast<const uint8*>(GetData(nIndex, nSemantic, nChannel));
+				if (pnVertex) {
+					fX = FromUNorm8(pnVertex[0]);
+					fY = FromUNorm8(pnVertex[1]);
+					fZ = FromUNorm8(pnVertex[2]);
+					fW = FromUNorm8(pnVertex[3]);
+
+					// Done
+					return true;
+				}
+				break;
+			}
+
+			// Short 2 normalized (two components per element, 16 bit signed integer per component mapped to [-1, 1], may not be supported by each API)
+			case Short2N:
+			{
+				const int16 *pnVertex = static_cast<const int16*>(GetData(nIndex, nSemantic, nChannel));
+				if (pnVertex) {
+					fX = FromSNorm16(pnVertex[0]);
+					fY = FromSNorm16(pnVertex[1]);
+					fZ = 0.0f;
+					fW = 0.0f;
+
+					// Done
+					return true;
+				}
+				break;
+			}
+
+			// Short 4 normalized (four components per element, 16 bit signed integer per component mapped to [-1, 1], may not be supported by each API)
+			case Short4N:
+			{
+				const int16 *pnVertex = static_cast<const int16*>(GetData(nIndex, nSemantic, nChannel));
+				if (pnVertex) {
+					fX = FromSNorm16(pnVertex[0]);
+					fY = FromSNorm16(pnVertex[1]);
+					fZ = FromSNorm16(pnVertex[2]);
+					fW = FromSNorm16(pnVertex[3]);
+
+					// Done
+					return true;
+				}
+				break;
+			}
 		}
 	}
 
@@ -607,6 +726,52 @@ bool VertexBuffer::SetFloat(uint32 nIndex, uint32 nSemantic, uint32 nChannel, fl
 				}
 				break;
 			}
+
+			// Unsigned byte 4 normalized (four components per element, 8 bit unsigned integer per component mapped to [0, 1], may not be supported by each API)
+			case UByte4N:
+			{
+				uint8 *pnVertex = static_cast<uint8*>(GetData(nIndex, nSemantic, nChannel));
+				if (pnVertex) {
+					pnVertex[0] = ToUNorm8(fX);
+					pnVertex[1] = ToUNorm8(fY);
+					pnVertex[2] = ToUNorm8(fZ);
+					pnVertex[3] = ToUNorm8(fW);
+
+					// Done
+					return true;
+				}
+				break;
+			}
+
+			// Short 2 normalized (two components per element, 16 bit signed integer per component mapped to [-1, 1], may not be supported by each API)
+			case Short2N:
+			{
+				int16 *pnVertex = static_cast<int16*>(GetData(nIndex, nSemantic, nChannel));
+				if (pnVertex) {
+					pnVertex[0] = ToSNorm16(fX);
+					pnVertex[1] = ToSNorm16(fY);
+
+					// Done
+					return true;
+				}
+				break;
+			}
+
+			// Short 4 normalized (four components per element, 16 bit signed integer per component mapped to [-1, 1], may not be supported by each API)
+			case Short4N:
+			{
+				int16 *pnVertex = static_cast<int16*>(GetData(nIndex, nSemantic, nChannel));
+				if (pnVertex) {
+					pnVertex[0] = ToSNorm16(fX);
+					pnVertex[1] = ToSNorm16(fY);
+					pnVertex[2] = ToSNorm16(fZ);
+					pnVertex[3] = ToSNorm16(fW);
+
+					// Done
+					return true;
+				}
+				break;
+			}
 		}
 	}
 
@@ -614,6 +779,205 @@ bool VertexBuffer::SetFloat(uint32 nIndex, uint32 nSemantic, uint32 nChannel, fl
 	return false;
 }
 
+/**
+*  @brief
+*    Fills the data of a vertex buffer attribute of a range of vertices into a given floating point array
+*/
+bool VertexBuffer::GetFloatArray(uint32 nSemantic, uint32 nChannel, uint32 nFirstVertex, uint32 nNumOfVertices, float *pfDestination)
+{
+	// Get the first found vertex attribute with the requested semantic and check the given vertex range
+	const Attribute *pAttribute = GetVertexAttribute(static_cast<ESemantic>(nSemantic), nChannel);
+	if (!pAttribute || nFirstVertex + nNumOfVertices > GetNumOfElements())
+		return false; // Error!
+	if (!nNumOfVertices)
+		return true; // Done, nothing to do
+
+	// Color (API dependent storage)
+	const uint32 nNumOfComponents = GetNumOfComponents(pAttribute->nType);
+	if (pAttribute->nType == RGBA) {
+		for (uint32 nVertex=nFirstVertex; nVertex<nFirstVertex+nNumOfVertices; nVertex++, pfDestination+=4) {
+			const Color4 cColor = GetColor(nVertex, nChannel);
+			pfDestination[0] = cColor.r;
+			pfDestination[1] = cColor.g;
+			pfDestination[2] = cColor.b;
+			pfDestination[3] = cColor.a;
+		}
+
+		// Done
+		return true;
+	}
+
+	// Get the data of the first vertex, the data of the following vertices is "m_nVertexSize" bytes apart
+	const uint8 *pnVertex = static_cast<const uint8*>(GetData(nFirstVertex, nSemantic, nChannel));
+	if (!pnVertex)
+		return false; // Error!
+	const uint8 *pnVertexEnd = pnVertex + nNumOfVertices*m_nVertexSize;
+
+	// Check attribute type
+	switch (pAttribute->nType) {
+		case Float1:
+		case Float2:
+		case Float3:
+		case Float4:
+			for (; pnVertex<pnVertexEnd; pnVertex+=m_nVertexSize, pfDestination+=nNumOfComponents)
+				MemoryManager::Copy(pfDestination, pnVertex, sizeof(float)*nNumOfComponents);
+			break;
+
+		case Short2:
+		case Short4:
+			for (; pnVertex<pnVertexEnd; pnVertex+=m_nVertexSize) {
+				const uint16 *pnComponent = reinterpret_cast<const uint16*>(pnVertex);
+				for (uint32 i=0; i<nNumOfComponents; i++)
+					*pfDestination++ = static_cast<float>(pnComponent[i]);
+			}
+			break;
+
+		case Half1:
+		case Half2:
+		case Half3:
+		case Half4:
+			if (m_nVertexSize == sizeof(uint16)*nNumOfComponents) {
+				// The vertex buffer consists only of this attribute, convert all at once
+				Half::ToFloatArray(reinterpret_cast<const uint16*>(pnVertex), pfDestination, nNumOfVertices*nNumOfComponents);
+			} else {
+				// Gather the interleaved half data into blocks and convert them at once
+				static const uint32 BlockSize = 256;
+				uint16 nHalf[BlockSize*4];
+				while (pnVertex < pnVertexEnd) {
+					uint16 *pnHalf = nHalf;
+					uint32 nNumOfBlockVertices = 0;
+					for (; pnVertex<pnVertexEnd && nNumOfBlockVertices<BlockSize; pnVertex+=m_nVertexSize, pnHalf+=nNumOfComponents, nNumOfBlockVertices++)
+						MemoryManager::Copy(pnHalf, pnVertex, sizeof(uint16)*nNumOfComponents);
+					Half::ToFloatArray(nHalf, pfDestination, nNumOfBlockVertices*nNumOfComponents);
+					pfDestination += nNumOfBlockVertices*nNumOfComponents;
+				}
+			}
+			break;
+
+		case UByte4N:
+			for (; pnVertex<pnVertexEnd; pnVertex+=m_nVertexSize, pfDestination+=4) {
+				pfDestination[0] = FromUNorm8(pnVertex[0]);
+				pfDestination[1] = FromUNorm8(pnVertex[1]);
+				pfDestination[2] = FromUNorm8(pnVertex[2]);
+				pfDestination[3] = FromUNorm8(pnVertex[3]);
+			}
+			break;
+
+		case Short2N:
+		case Short4N:
+			for (; pnVertex<pnVertexEnd; pnVertex+=m_nVertexSize) {
+				const int16 *pnComponent = reinterpret_cast<const int16*>(pnVertex);
+				for (uint32 i=0; i<nNumOfComponents; i++)
+					*pfDestination++ = FromSNorm16(pnComponent[i]);
+			}
+			break;
+
+		default:
+			return false; // Error!
+	}
+
+	// Done
+	return true;
+}
+
+/**
+*  @brief
+*    Sets the data of a vertex buffer attribute of a range of vertices by using a given floating point array
+*/
+bool VertexBuffer::SetFloatArray(uint32 nSemantic, uint32 nChannel, uint32 nFirstVertex, uint32 nNumOfVertices, const float *pfSource)
+{
+	// Get the first found vertex attribute with the requested semantic and check the given vertex range
+	const Attribute *pAttribute = GetVertexAttribute(static_cast<ESemantic>(nSemantic), nChannel);
+	if (!pAttribute || nFirstVertex + nNumOfVertices > GetNumOfElements())
+		return false; // Error!
+	if (!nNumOfVertices)
+		return true; // Done, nothing to do
+
+	// Color (API dependent storage)
+	const uint32 nNumOfComponents = GetNumOfComponents(pAttribute->nType);
+	if (pAttribute->nType == RGBA) {
+		for (uint32 nVertex=nFirstVertex; nVertex<nFirstVertex+nNumOfVertices; nVertex++, pfSource+=4) {
+			if (!SetColor(nVertex, Color4(pfSource[0], pfSource[1], pfSource[2], pfSource[3]), nChannel))
+				return false; // Error!
+		}
+
+		// Done
+		return true;
+	}
+
+	// Get the data of the first vertex, the data of the following vertices is "m_nVertexSize" bytes apart
+	uint8 *pnVertex = static_cast<uint8*>(GetData(nFirstVertex, nSemantic, nChannel));
+	if (!pnVertex)
+		return false; // Error!
+	const uint8 *pnVertexEnd = pnVertex + nNumOfVertices*m_nVertexSize;
+
+	// Check attribute type
+	switch (pAttribute->nType) {
+		case Float1:
+		case Float2:
+		case Float3:
+		case Float4:
+			for (; pnVertex<pnVertexEnd; pnVertex+=m_nVertexSize, pfSource+=nNumOfComponents)
+				MemoryManager::Copy(pnVertex, pfSource, sizeof(float)*nNumOfComponents);
+			break;
+
+		case Short2:
+		case Short4:
+			for (; pnVertex<pnVertexEnd; pnVertex+=m_nVertexSize) {
+				uint16 *pnComponent = reinterpret_cast<uint16*>(pnVertex);
+				for (uint32 i=0; i<nNumOfComponents; i++)
+					pnComponent[i] = static_cast<uint16>(*pfSource++);
+			}
+			break;
+
+		case Half1:
+		case Half2:
+		case Half3:
+		case Half4:
+			if (m_nVertexSize == sizeof(uint16)*nNumOfComponents) {
+				// The vertex buffer consists only of this attribute, convert all at once
+				Half::FromFloatArray(pfSource, reinterpret_cast<uint16*>(pnVertex), nNumOfVertices*nNumOfComponents);
+			} else {
+				// Convert blocks at once and scatter the half data into the interleaved vertex data
+				static const uint32 BlockSize = 256;
+				uint16 nHalf[BlockSize*4];
+				for (uint32 nVertex=0; nVertex<nNumOfVertices; nVertex+=BlockSize) {
+					const uint32 nNumOfBlockVertices = (nNumOfVertices - nVertex < BlockSize) ? (nNumOfVertices - nVertex) : BlockSize;
+					Half::FromFloatArray(pfSource, nHalf, nNumOfBlockVertices*nNumOfComponents);
+					pfSource += nNumOfBlockVertices*nNumOfComponents;
+					const uint16 *pnHalf = nHalf;
+					for (uint32 i=0; i<nNumOfBlockVertices; i++, pnVertex+=m_nVertexSize, pnHalf+=nNumOfComponents)
+						MemoryManager::Copy(pnVertex, pnHalf, sizeof(uint16)*nNumOfComponents);
+				}
+			}
+			break;
+
+		case UByte4N:
+			for (; pnVertex<pnVertexEnd; pnVertex+=m_nVertexSize, pfSource+=4) {
+				pnVertex[0] = ToUNorm8(pfSource[0]);
+				pnVertex[1] = ToUNorm8(pfSource[1]);
+				pnVertex[2] = ToUNorm8(pfSource[2]);
+				pnVertex[3] = ToUNorm8(pfSource[3]);
+			}
+			break;
+
+		case Short2N:
+		case Short4N:
+			for (; pnVertex<pnVertexEnd; pnVertex+=m_nVertexSize) {
+				int16 *pnComponent = reinterpret_cast<int16*>(pnVertex);
+				for (uint32 i=0; i<nNumOfComponents; i++)
+					pnComponent[i] = ToSNorm16(*pfSource++);
+			}
+			break;
+
+		default:
+			return false; // Error!
+	}
+
+	// Done
+	return true;
+}
+
 /**
 *  @brief
 *    Returns the vertex buffer bounding box
@@ -28,7 +28,10 @@
 #include <PLCore/Base/Class.h>
 #include <PLCore/Tools/Stopwatch.h>
 #include <PLCore/Tools/Profiling.h>
+#include <PLCore/Container/ResourceBudget.h>
 #include "PLRenderer/Renderer/Renderer.h"
+#include "PLRenderer/Renderer/GlyphAtlas.h"
+#include "PLRenderer/Renderer/FontManager.h"
 #include "PLRenderer/Texture/TextureManager.h"
 #include "PLRenderer/Effect/EffectManager.h"
 #include "PLRenderer/Material/MaterialManager.h"
@@ -138,18 +141,35 @@ void RendererContext::Update()
 	EventUpdate();
 
 	// Update renderer
-	if (m_pRenderer)
+	if (m_pRenderer) {
 		m_pRenderer->Update();
 
+		// Start a new glyph atlas frame and take over the glyphs rasterized in the background
+		m_pRenderer->GetFontManager().GetGlyphAtlas().Update();
+	}
+
+	// Update the texture streaming
+	if (m_pTextureManager)
+		m_pTextureManager->UpdateStreaming();
+
+	// Enforce the global resource memory budgets
+	ResourceBudget *pResourceBudget = ResourceBudget::GetInstance();
+	if (pResourceBudget)
+		pResourceBudget->Update();
+
 	// Update profiling information
 	Profiling *pProfiling = Profiling::GetInstance();
 	if (pProfiling->IsActive()) {
 		if (m_pTextureManager)
 			pProfiling->Set("Renderer context", "Number of textures", m_pTextureManager->GetNumOfElements());
+		if (m_pTextureManager && m_pTextureManager->GetStreamingBudget())
+			pProfiling->Set("Renderer context", "Streamed texture memory", String::Format("%.3g / %.3g MiB", m_pTextureManager->GetStreamingMemoryUsage()/(1024.0*1024.0), m_pTextureManager->GetStreamingBudget()/(1024.0*1024.0)));
 		if (m_pEffectManager)
 			pProfiling->Set("Renderer context", "Number of effects", m_pEffectManager->GetNumOfElements());
 		if (m_pMaterialManager)
 			pProfiling->Set("Renderer context", "Number of materials", m_pMaterialManager->GetNumOfElements());
+		if (pResourceBudget)
+			pProfiling->Set("Renderer context", "Resource memory", String::Format("%.3g MiB (%d evictions)", pResourceBudget->GetMemoryUsage()/(1024.0*1024.0), pResourceBudget->GetNumOfEvictions()));
 		pProfiling->Set("Renderer context", "Update time", String::Format("%.3g ms", cStopwatch.GetMilliseconds()));
 	}
 }
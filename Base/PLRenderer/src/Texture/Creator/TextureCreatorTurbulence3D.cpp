@@ -25,7 +25,7 @@
 //[-------------------------------------------------------]
 //[ Includes                                              ]
 //[-------------------------------------------------------]
-#include <PLMath/PerlinNoiseTurbulence.h>
+#include <PLMath/NoiseGrid.h>
 #include <PLGraphics/Image/Image.h>
 #include <PLGraphics/Image/ImageBuffer.h>
 #include "PLRenderer/RendererContext.h"
@@ -95,23 +95,24 @@ Texture *TextureCreatorTurbulence3D::Create(TextureManager &cTextureManager, Tex
 	Image cImage = Image::CreateImage(DataByte, ColorGrayscale, Vector3i(XSize, YSize, ZSize));
 	ImageBuffer *pImageBuffer = cImage.GetBuffer();
 
+	// Evaluate the turbulence for the whole volume at once
+	const uint32 nNumOfPixels = XSize*YSize*ZSize;
+	float *pfTurbulence = new float[nNumOfPixels];
+	NoiseGrid::TileableTurbulence3(pfTurbulence, XSize, YSize, ZSize, Vector3::Zero, vScale, Vector3(XSize*vScale.x, YSize*vScale.y, ZSize*vScale.z), 16);
+
 	// Create the buffer
 	uint8 *pTurbBuffer = pImageBuffer->GetData();
 	uint8 *pDest = pTurbBuffer;
 	uint32 nMin = 255, nMax = 0;
-	for (uint32 nZ=0; nZ<ZSize; nZ++) {
-		for (uint32 nY=0; nY<YSize; nY++) {
-			for (uint32 nX=0; nX<XSize; nX++) {
-				const uint8 nT = static_cast<uint8>(127.5f*(1 + PerlinNoiseTurbulence::TileableTurbulence3(vScale.x*nX, vScale.y*nY, vScale.z*nZ, XSize*vScale.x, YSize*vScale.y, ZSize*vScale.z, 16)));
-				if (nT > nMax)
-					nMax = nT;
-				if (nT < nMin)
-					nMin = nT;
-				*pDest++ = nT;
-			}
-		}
+	for (uint32 i=0; i<nNumOfPixels; i++) {
+		const uint8 nT = static_cast<uint8>(127.5f*(1 + pfTurbulence[i]));
+		if (nT > nMax)
+			nMax = nT;
+		if (nT < nMin)
+			nMin = nT;
+		*pDest++ = nT;
 	}
-	const uint32 nNumOfPixels = XSize*YSize*ZSize;
+	delete [] pfTurbulence;
 	pDest = pTurbBuffer;
 	for (uint32 i=0; i<nNumOfPixels; i++, pDest++)
 		*pDest = static_cast<uint8>((255*(*pDest - nMin))/(nMax - nMin));
@@ -31,6 +31,7 @@
 #include <PLCore/Tools/Loader.h>
 #include <PLCore/Tools/LoaderImpl.h>
 #include <PLGraphics/Image/Image.h>
+#include <PLGraphics/Image/ImagePart.h>
 #include <PLGraphics/Image/ImageBuffer.h>
 #include <PLGraphics/Image/ImageEffects.h>
 #include "PLRenderer/RendererContext.h"
@@ -61,8 +62,9 @@ Texture::~Texture()
 	// First at all: Unload the texture
 	Unload();
 
-	// Delete renderer texture buffer resource handler
+	// Delete renderer texture buffer resource handlers
 	delete m_pTextureBufferHandler;
+	delete m_pStreamingTailHandler;
 }
 
 /**
@@ -81,6 +83,7 @@ TextureBuffer *Texture::GetTextureBuffer() const
 void Texture::SetTextureBuffer(TextureBuffer *pTextureBuffer)
 {
 	if (m_pTextureBufferHandler->GetResource() != pTextureBuffer) {
+		StopStreaming();
 		DestroyTextureBuffer();
 		m_pTextureBufferHandler->SetResource(pTextureBuffer);
 
@@ -111,6 +114,33 @@ bool Texture::Bind(uint32 nStage) const
 	}
 }
 
+/**
+*  @brief
+*    Reports the usage of this texture within the current frame
+*/
+void Texture::ReportUsage(float fScreenSize)
+{
+	if (m_bStreamed) {
+		// Get the mipmap where one texel is roughly covering one pixel
+		uint32 nMipmap = m_nStreamingTailMipmap;
+		if (fScreenSize > 0.0f) {
+			const float fSize = static_cast<float>(Math::Max(m_vStreamingSize.x, m_vStreamingSize.y));
+			nMipmap = (fScreenSize < fSize) ? static_cast<uint32>(Math::Log2(fSize/fScreenSize)) : 0;
+			if (nMipmap > m_nStreamingTailMipmap)
+				nMipmap = m_nStreamingTailMipmap;
+		}
+
+		// The first usage within a frame overwrites the wanted mipmap, the highest resolution wins within a frame
+		const uint32 nFrame = GetTextureManager().GetStreamingFrame();
+		if (m_nStreamingLastUsedFrame != nFrame) {
+			m_nStreamingLastUsedFrame = nFrame;
+			m_nStreamingWantedMipmap  = nMipmap;
+		} else if (m_nStreamingWantedMipmap > nMipmap) {
+			m_nStreamingWantedMipmap = nMipmap;
+		}
+	}
+}
+
 
 //[-------------------------------------------------------]
 //[ Public virtual Texture functions                      ]
@@ -132,7 +162,17 @@ bool Texture::IsAnimated() const
 Texture::Texture(TextureManager &cManager, const String &sName) : PLCore::Resource<Texture>(sName, &cManager),
 	m_pTextureBufferHandler(new ResourceHandler()),
 	m_bShareTextureBuffer(false),
-	m_nCompressionHint(Default)
+	m_nCompressionHint(Default),
+	m_pStreamingTailHandler(new ResourceHandler()),
+	m_bStreamed(false),
+	m_nStreamingFormat(TextureBuffer::Unknown),
+	m_nStreamingFlags(0),
+	m_nStreamingTailMipmap(0),
+	m_nStreamingResidentMipmap(0),
+	m_nStreamingRequestedMipmap(0),
+	m_nStreamingWantedMipmap(0),
+	m_nStreamingLastUsedFrame(0),
+	m_nStreamingResidentBytes(0)
 {
 }
 
@@ -173,10 +213,90 @@ void Texture::DestroyTextureBuffer()
 	m_pTextureBufferHandler->SetResource(nullptr);
 }
 
+/**
+*  @brief
+*    Sets the high resolution texture buffer of a streamed texture
+*/
+void Texture::SetStreamingTextureBuffer(TextureBuffer *pTextureBuffer, uint32 nMipmap)
+{
+	// Destroy the current high resolution texture buffer, the low resolution one stays resident
+	TextureBuffer *pTailTextureBuffer = static_cast<TextureBuffer*>(m_pStreamingTailHandler->GetResource());
+	TextureBuffer *pCurrentTextureBuffer = static_cast<TextureBuffer*>(m_pTextureBufferHandler->GetResource());
+	if (pCurrentTextureBuffer != pTailTextureBuffer) {
+		m_pTextureBufferHandler->SetResource(nullptr);
+		delete pCurrentTextureBuffer;
+	}
+
+	// Use the given texture buffer, or fall back to the low resolution one
+	if (pTextureBuffer) {
+		m_pTextureBufferHandler->SetResource(pTextureBuffer);
+		m_nStreamingResidentMipmap = nMipmap;
+	} else {
+		m_pTextureBufferHandler->SetResource(pTailTextureBuffer);
+		m_nStreamingResidentMipmap = m_nStreamingTailMipmap;
+	}
+	m_nStreamingRequestedMipmap = m_nStreamingResidentMipmap;
+
+	// Update the number of resident bytes, also within the texture manager
+	TextureManager &cTextureManager = GetTextureManager();
+	cTextureManager.m_nStreamingMemoryUsage -= m_nStreamingResidentBytes;
+	m_nStreamingResidentBytes = (pTailTextureBuffer ? pTailTextureBuffer->GetTotalNumOfBytes() : 0) + (pTextureBuffer ? pTextureBuffer->GetTotalNumOfBytes() : 0);
+	cTextureManager.m_nStreamingMemoryUsage += m_nStreamingResidentBytes;
+}
+
+/**
+*  @brief
+*    Stops the streaming of this texture and destroys the low resolution texture buffer
+*/
+void Texture::StopStreaming()
+{
+	if (m_bStreamed) {
+		// Cancel pending requests and unregister from the texture manager
+		GetTextureManager().RemoveStreamedTexture(*this);
+
+		// Destroy the high resolution texture buffer
+		SetStreamingTextureBuffer(nullptr, m_nStreamingTailMipmap);
+
+		// Destroy the low resolution texture buffer
+		TextureBuffer *pTailTextureBuffer = static_cast<TextureBuffer*>(m_pStreamingTailHandler->GetResource());
+		m_pTextureBufferHandler->SetResource(nullptr);
+		m_pStreamingTailHandler->SetResource(nullptr);
+		delete pTailTextureBuffer;
+
+		// Reset the streaming information
+		GetTextureManager().m_nStreamingMemoryUsage -= m_nStreamingResidentBytes;
+		m_bStreamed					= false;
+		m_vStreamingSize			= Vector3i::Zero;
+		m_nStreamingFormat			= TextureBuffer::Unknown;
+		m_nStreamingFlags			= 0;
+		m_nStreamingTailMipmap		= 0;
+		m_nStreamingResidentMipmap	= 0;
+		m_nStreamingRequestedMipmap	= 0;
+		m_nStreamingWantedMipmap	= 0;
+		m_nStreamingLastUsedFrame	= 0;
+		m_nStreamingResidentBytes	= 0;
+	}
+}
+
 
 //[-------------------------------------------------------]
 //[ Public virtual PLCore::Resource functions             ]
 //[-------------------------------------------------------]
+uint64 Texture::GetGPUMemoryUsage() const
+{
+	// Streamed texture?
+	if (m_bStreamed)
+		return m_nStreamingResidentBytes;
+
+	// A shared texture buffer is owned by someone else
+	const TextureBuffer *pTextureBuffer = GetTextureBuffer();
+	return (pTextureBuffer && !m_bShareTextureBuffer) ? pTextureBuffer->GetTotalNumOfBytes() : 0;
+}
+
+
+//[-------------------------------------------------------]
+//[ Public virtual PLCore::Loadable functions             ]
+//[-------------------------------------------------------]
 bool Texture::LoadByFilename(const String &sFilename, const String &sParams, const String &sMethod)
 {
 	// Unload texture
@@ -692,6 +812,66 @@ bool Texture::LoadByFilename(const String &sFilename, const String &sParams, con
 					if ((pImageBuffer->GetDataFormat() == DataHalf || pImageBuffer->GetDataFormat() == DataFloat) && (pImageBuffer->GetColorFormat() != ColorGrayscale || pImageBuffer->GetColorFormat() != ColorRGB))
 						cImage.ApplyEffect(ImageEffects::Convert((pImageBuffer->GetDataFormat() == DataHalf) ? DataHalf : DataFloat, ColorRGBA));
 
+					// Compress uncompressed images on load? (the renderer backend then uploads the compressed data instead of letting the driver compress the image)
+					if (nInternalFormat != TextureBuffer::Unknown && GetTextureManager().IsTextureCompressionOnLoad() &&
+						pImageBuffer->GetDataFormat() == DataByte && pImageBuffer->GetCompression() == CompressionNone) {
+						// Get the image compression matching the internal format, the color format must match the block layout
+						const EColorFormat nColorFormat = pImageBuffer->GetColorFormat();
+						ECompression nCompression = CompressionNone;
+						switch (nInternalFormat) {
+							case TextureBuffer::DXT1:
+								if (nColorFormat == ColorRGB || nColorFormat == ColorRGBA)
+									nCompression = CompressionDXT1;
+								break;
+
+							case TextureBuffer::DXT3:
+								if (nColorFormat == ColorRGBA)
+									nCompression = CompressionDXT3;
+								break;
+
+							case TextureBuffer::DXT5:
+								if (nColorFormat == ColorRGBA)
+									nCompression = CompressionDXT5;
+								break;
+
+							case TextureBuffer::LATC1:
+								if (nColorFormat == ColorGrayscale)
+									nCompression = CompressionLATC1;
+								break;
+
+							case TextureBuffer::LATC2:
+								if (nColorFormat == ColorGrayscaleA)
+									nCompression = CompressionLATC2;
+								break;
+
+							default:
+								// No compressed format
+								break;
+						}
+
+						// Compress all image parts including their mipmaps
+						if (nCompression != CompressionNone) {
+							const ECompressionQuality nQuality = GetTextureManager().GetTextureCompressionQuality();
+							for (uint32 nPart=0; nPart<cImage.GetNumOfParts(); nPart++) {
+								ImagePart *pImagePart = cImage.GetPart(nPart);
+
+								// Build the mipmaps now, the driver is not able to build them using the compressed data
+								if (bMipmapsAllowed && pImagePart->GetNumOfMipmaps() == 1)
+									pImagePart->BuildMipmaps();
+
+								for (uint32 nMipmap=0; nMipmap<pImagePart->GetNumOfMipmaps(); nMipmap++) {
+									ImageBuffer *pMipmapImageBuffer = pImagePart->GetMipmap(nMipmap);
+									pMipmapImageBuffer->SetCompression(nCompression);
+									if (!pMipmapImageBuffer->Compress(nQuality))
+										pMipmapImageBuffer->SetCompression(CompressionNone);
+								}
+							}
+
+							// Update the image buffer pointer
+							pImageBuffer = cImage.GetBuffer();
+						}
+					}
+
 					// Create the renderer texture buffer resource
 					TextureBuffer *pTextureBuffer;
 					if (cImage.GetNumOfParts() == 6) {
@@ -704,11 +884,36 @@ bool Texture::LoadByFilename(const String &sFilename, const String &sParams, con
 						// 1D texture buffer
 						pTextureBuffer = reinterpret_cast<TextureBuffer*>(cRenderer.CreateTextureBuffer1D(cImage, nInternalFormat, nTextureFlags));
 					} else {
+						// Get the mipmap the low resolution texture buffer starts with if the high resolution mipmaps of this plain 2D texture should be streamed
+						uint32 nTailMipmap = 0;
+						if (GetTextureManager().GetStreamingBudget() && !bRectangleTexture && bMipmapsAllowed && !bColorKey && nForceWidth < 0 && nForceHeight < 0 &&
+							cImage.GetBuffer()->GetDataFormat() == DataByte && (cImage.GetBuffer()->GetCompression() == CompressionNone || cImage.GetPart(0)->GetNumOfMipmaps() > 1)) {
+							while (Math::Max(nWidth >> nTailMipmap, nHeight >> nTailMipmap) > TextureManager::StreamingTailSize)
+								nTailMipmap++;
+						}
+
 						// 2D/rectancle texture buffer
-						if (bRectangleTexture)
+						if (bRectangleTexture) {
 							pTextureBuffer = reinterpret_cast<TextureBuffer*>(cRenderer.CreateTextureBufferRectangle(cImage, nInternalFormat, nTextureFlags));
-						else
+						} else if (nTailMipmap) {
+							// Streamed 2D texture buffer, just the low resolution mipmaps are created right now and the texture
+							// manager loads the higher resolution ones as soon as they are required
+							cImage.ApplyEffect(ImageEffects::Scale(Vector3i(Math::Max(nWidth >> nTailMipmap, 1u), Math::Max(nHeight >> nTailMipmap, 1u), 1), true));
+							pTextureBuffer = reinterpret_cast<TextureBuffer*>(cRenderer.CreateTextureBuffer2D(cImage, nInternalFormat, nTextureFlags));
+							if (pTextureBuffer) {
+								pTextureBuffer->AddHandler(*m_pStreamingTailHandler);
+								m_bStreamed					= true;
+								m_vStreamingSize			= Vector3i(nWidth, nHeight, 1);
+								m_nStreamingFormat			= nInternalFormat;
+								m_nStreamingFlags			= nTextureFlags;
+								m_nStreamingTailMipmap		= nTailMipmap;
+								m_nStreamingResidentMipmap	= nTailMipmap;
+								m_nStreamingRequestedMipmap	= nTailMipmap;
+								m_nStreamingWantedMipmap	= nTailMipmap;
+							}
+						} else {
 							pTextureBuffer = reinterpret_cast<TextureBuffer*>(cRenderer.CreateTextureBuffer2D(cImage, nInternalFormat, nTextureFlags));
+						}
 					}
 
 					// Renderer texture created?
@@ -718,6 +923,10 @@ bool Texture::LoadByFilename(const String &sFilename, const String &sParams, con
 						// Backup the given filename
 						m_sFilename = sFilename;
 
+						// Let the texture manager stream the high resolution mipmaps
+						if (m_bStreamed)
+							GetTextureManager().AddStreamedTexture(*this);
+
 						// Done
 						return true;
 					} else {
@@ -759,6 +968,7 @@ bool Texture::Unload()
 	if (m_pTextureBufferHandler->GetResource()) {
 		// Delete texture buffer
 		PL_LOG(Debug, "Delete texture: " + GetName())
+		StopStreaming();
 		DestroyTextureBuffer();
 
 		// Reset additional information
@@ -27,7 +27,14 @@
 //[-------------------------------------------------------]
 #include <PLCore/Log/Log.h>
 #include <PLCore/Base/Class.h>
+#include <PLCore/System/Mutex.h>
+#include <PLCore/System/Thread.h>
+#include <PLCore/System/Semaphore.h>
 #include <PLCore/Tools/Profiling.h>
+#include <PLGraphics/Image/Image.h>
+#include <PLGraphics/Image/ImageBuffer.h>
+#include <PLGraphics/Image/ImageEffects.h>
+#include "PLRenderer/RendererContext.h"
 #include "PLRenderer/Renderer/Renderer.h"
 #include "PLRenderer/Renderer/ResourceHandler.h"
 #include "PLRenderer/Texture/Creator/TextureCreator.h"
@@ -39,13 +46,92 @@
 //[ Namespace                                             ]
 //[-------------------------------------------------------]
 using namespace PLCore;
+using namespace PLMath;
+using namespace PLGraphics;
 namespace PLRenderer {
 
 
+//[-------------------------------------------------------]
+//[ Private structures                                    ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Mipmap load request of a streamed texture
+*/
+struct TextureManager::StreamingRequest {
+	Texture  *pTexture;	/**< Requesting texture, a null pointer if the request has been cancelled (only accessed by the main thread) */
+	String	  sUrl;		/**< Absolute filename of the texture image */
+	Vector3i  vSize;	/**< Size of the requested mipmap */
+	uint32	  nMipmap;	/**< Requested mipmap */
+	uint64	  nGrowth;	/**< Estimated number of bytes the resident bytes will grow by */
+	Image	  cImage;	/**< Loaded image */
+	bool	  bLoaded;	/**< Was the image loaded successfully? */
+};
+
+
+//[-------------------------------------------------------]
+//[ Global helper functions                               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Loads a mipmap of a streamed texture, may be called by the background thread
+*/
+static bool LoadStreamingImage(Image &cImage, const String &sUrl, const Vector3i &vSize)
+{
+	if (cImage.LoadByFilename(sUrl)) {
+		ImageBuffer *pImageBuffer = cImage.GetBuffer();
+		if (pImageBuffer) {
+			// We do NOT support palettes within textures!
+			if (pImageBuffer->GetColorFormat() == ColorPalette)
+				cImage.ApplyEffect(ImageEffects::RemovePalette());
+
+			// Scale down to the requested mipmap - we can scale by using another mipmap as base map
+			if (cImage.GetBuffer()->GetSize() != vSize)
+				cImage.ApplyEffect(ImageEffects::Scale(vSize, true));
+
+			// Done
+			return (cImage.GetBuffer()->GetSize() == vSize);
+		}
+	}
+
+	// Error!
+	return false;
+}
+
+/**
+*  @brief
+*    Returns the estimated number of bytes of a high resolution texture buffer of a streamed texture
+*/
+static uint64 GetStreamingNumOfBytes(const Vector3i &vSize, TextureBuffer::EPixelFormat nFormat, uint32 nMipmap)
+{
+	uint64 nNumOfBytes = 0;
+
+	// Sum up all mipmaps down to 1x1
+	uint32 nWidth  = Math::Max(static_cast<uint32>(vSize.x) >> nMipmap, 1u);
+	uint32 nHeight = Math::Max(static_cast<uint32>(vSize.y) >> nMipmap, 1u);
+	for (;;) {
+		if (nFormat == TextureBuffer::DXT1 || nFormat == TextureBuffer::LATC1)
+			nNumOfBytes += ((nWidth+3)/4)*((nHeight+3)/4)*8;
+		else if (TextureBuffer::IsCompressedFormat(nFormat))
+			nNumOfBytes += ((nWidth+3)/4)*((nHeight+3)/4)*16;
+		else
+			nNumOfBytes += TextureBuffer::GetBytesPerPixel(nFormat)*nWidth*nHeight;
+		if (nWidth == 1 && nHeight == 1)
+			break;
+		nWidth  = Math::Max(nWidth  >> 1, 1u);
+		nHeight = Math::Max(nHeight >> 1, 1u);
+	}
+
+	// Done
+	return nNumOfBytes;
+}
+
+
 //[-------------------------------------------------------]
 //[ Public static data                                    ]
 //[-------------------------------------------------------]
-const String TextureManager::Default = "Data/Textures/Default.dds";
+const String TextureManager::Default			= "Data/Textures/Default.dds";
+const uint32 TextureManager::StreamingTailSize	= 64;
 
 
 //[-------------------------------------------------------]
@@ -138,6 +224,154 @@ Texture *TextureManager::CreateTexture(const String &sName, const String &sParam
 	return nullptr;
 }
 
+/**
+*  @brief
+*    Sets the texture streaming budget
+*/
+void TextureManager::SetStreamingBudget(uint64 nBudget)
+{
+	m_nStreamingBudget = nBudget;
+
+	// Evict the high resolution mipmaps of unused textures if the new budget is lower
+	if (m_nStreamingBudget)
+		EvictStreamedTextures(0, nullptr);
+}
+
+/**
+*  @brief
+*    Updates the texture streaming
+*/
+void TextureManager::UpdateStreaming()
+{
+	// Load the queued requests on the main thread if there's no background thread (no locking required)
+	if (!m_pStreamingThread && m_lstStreamingQueue.GetNumOfElements()) {
+		for (uint32 i=0; i<m_lstStreamingQueue.GetNumOfElements(); i++) {
+			StreamingRequest *pRequest = m_lstStreamingQueue[i];
+			pRequest->bLoaded = LoadStreamingImage(pRequest->cImage, pRequest->sUrl, pRequest->vSize);
+			m_lstStreamingLoaded.Add(pRequest);
+		}
+		m_lstStreamingQueue.Reset();
+	}
+
+	// Take over the requests loaded by the background thread
+	Array<StreamingRequest*> lstLoaded;
+	m_pStreamingMutex->Lock();
+	for (uint32 i=0; i<m_lstStreamingLoaded.GetNumOfElements(); i++)
+		lstLoaded.Add(m_lstStreamingLoaded[i]);
+	m_lstStreamingLoaded.Reset();
+	m_pStreamingMutex->Unlock();
+
+	// Create the high resolution texture buffers of the loaded requests, as long as they fit into the budget
+	for (uint32 i=0; i<lstLoaded.GetNumOfElements(); i++) {
+		StreamingRequest *pRequest = lstLoaded[i];
+		m_lstStreamingRequests.Remove(pRequest);
+		m_nStreamingPendingBytes -= pRequest->nGrowth;
+		Texture *pTexture = pRequest->pTexture;
+		if (pTexture) {
+			pTexture->m_nStreamingRequestedMipmap = pTexture->m_nStreamingResidentMipmap;
+			if (pRequest->bLoaded && m_nStreamingBudget) {
+				TextureBuffer *pTextureBuffer = reinterpret_cast<TextureBuffer*>(GetRendererContext().GetRenderer().CreateTextureBuffer2D(pRequest->cImage, static_cast<TextureBuffer::EPixelFormat>(pTexture->m_nStreamingFormat), pTexture->m_nStreamingFlags));
+				if (pTextureBuffer) {
+					const uint64 nCurrentBytes = (pTexture->m_nStreamingResidentMipmap < pTexture->m_nStreamingTailMipmap) ? pTexture->GetTextureBuffer()->GetTotalNumOfBytes() : 0;
+					const uint64 nNewBytes     = pTextureBuffer->GetTotalNumOfBytes();
+					if (nNewBytes <= nCurrentBytes || EvictStreamedTextures(nNewBytes - nCurrentBytes, pTexture))
+						pTexture->SetStreamingTextureBuffer(pTextureBuffer, pRequest->nMipmap);
+					else
+						delete pTextureBuffer; // Does not fit into the budget, try again later
+				}
+			}
+		}
+		delete pRequest;
+	}
+
+	// Issue new requests for the streamed textures used within the current frame
+	if (m_nStreamingBudget) {
+		// Downgrades are issued at once, upgrades are collected and sorted by their priority (difference between resident and wanted mipmap)
+		Array<Texture*> lstUpgrades;
+		for (uint32 i=0; i<m_lstStreamedTextures.GetNumOfElements(); i++) {
+			Texture *pTexture = m_lstStreamedTextures[i];
+			if (pTexture->m_nStreamingLastUsedFrame == m_nStreamingFrame && pTexture->m_nStreamingRequestedMipmap == pTexture->m_nStreamingResidentMipmap) {
+				const uint32 nWanted   = pTexture->m_nStreamingWantedMipmap;
+				const uint32 nResident = pTexture->m_nStreamingResidentMipmap;
+				if (nWanted < nResident) {
+					uint32 nIndex = 0;
+					while (nIndex < lstUpgrades.GetNumOfElements() && lstUpgrades[nIndex]->m_nStreamingResidentMipmap - lstUpgrades[nIndex]->m_nStreamingWantedMipmap >= nResident - nWanted)
+						nIndex++;
+					lstUpgrades.AddAtIndex(pTexture, nIndex);
+
+				// Only downgrade if the resident mipmap is way too detailed, else the texture is just kept until it's evicted
+				} else if (nWanted > nResident + 1) {
+					if (nWanted >= pTexture->m_nStreamingTailMipmap)
+						pTexture->SetStreamingTextureBuffer(nullptr, pTexture->m_nStreamingTailMipmap);
+					else
+						RequestStreamingMipmap(*pTexture, nWanted, 0);
+				}
+			}
+		}
+
+		// Request the wanted mipmaps, or at least the most detailed ones which fit into the budget
+		for (uint32 i=0; i<lstUpgrades.GetNumOfElements(); i++) {
+			Texture *pTexture = lstUpgrades[i];
+			const uint64 nCurrentBytes = (pTexture->m_nStreamingResidentMipmap < pTexture->m_nStreamingTailMipmap) ? pTexture->GetTextureBuffer()->GetTotalNumOfBytes() : 0;
+			for (uint32 nMipmap=pTexture->m_nStreamingWantedMipmap; nMipmap<pTexture->m_nStreamingResidentMipmap; nMipmap++) {
+				const uint64 nBytes  = GetStreamingNumOfBytes(pTexture->m_vStreamingSize, pTexture->GetTextureBuffer()->GetFormat(), nMipmap);
+				const uint64 nGrowth = (nBytes > nCurrentBytes) ? nBytes - nCurrentBytes : 0;
+				if (EvictStreamedTextures(m_nStreamingPendingBytes + nGrowth, pTexture)) {
+					RequestStreamingMipmap(*pTexture, nMipmap, nGrowth);
+					break;
+				}
+			}
+		}
+	}
+
+	// Next frame, please
+	m_nStreamingFrame++;
+}
+
+
+//[-------------------------------------------------------]
+//[ Private static functions                              ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Background thread function loading the requested mipmaps
+*/
+int TextureManager::StreamingThreadFunction(void *pData)
+{
+	TextureManager &cThis = *static_cast<TextureManager*>(pData);
+
+	// Wait for requests
+	while (cThis.m_pStreamingSemaphore->Lock()) {
+		// Process all queued requests, there may be more requests than semaphore signals
+		for (;;) {
+			// Get the next queued request
+			StreamingRequest *pRequest = nullptr;
+			cThis.m_pStreamingMutex->Lock();
+			const bool bShutdown = cThis.m_bStreamingShutdown;
+			if (!bShutdown && cThis.m_lstStreamingQueue.GetNumOfElements()) {
+				pRequest = cThis.m_lstStreamingQueue[0];
+				cThis.m_lstStreamingQueue.RemoveAtIndex(0);
+			}
+			cThis.m_pStreamingMutex->Unlock();
+			if (bShutdown)
+				return 0; // Done
+			if (!pRequest)
+				break;
+
+			// Load and scale the image, this is the part which would stall the main thread
+			pRequest->bLoaded = LoadStreamingImage(pRequest->cImage, pRequest->sUrl, pRequest->vSize);
+
+			// Hand the request back to the main thread
+			cThis.m_pStreamingMutex->Lock();
+			cThis.m_lstStreamingLoaded.Add(pRequest);
+			cThis.m_pStreamingMutex->Unlock();
+		}
+	}
+
+	// Done
+	return 0;
+}
+
 
 //[-------------------------------------------------------]
 //[ Private functions                                     ]
@@ -151,7 +385,17 @@ TextureManager::TextureManager(RendererContext &cRendererContext) :
 	m_fTextureQuality(1.0f),
 	m_bTextureFitLower(true),
 	m_bTextureMipmapsAllowed(true),
-	m_bTextureCompressionAllowed(true)
+	m_bTextureCompressionAllowed(true),
+	m_bTextureCompressionOnLoad(false),
+	m_nTextureCompressionQuality(CompressionQualityFast),
+	m_nStreamingBudget(0),
+	m_nStreamingMemoryUsage(0),
+	m_nStreamingPendingBytes(0),
+	m_nStreamingFrame(1),
+	m_pStreamingThread(nullptr),
+	m_pStreamingMutex(new Mutex()),
+	m_pStreamingSemaphore(new Semaphore(0, 0x7fffffff)),
+	m_bStreamingShutdown(false)
 {
 	PL_LOG(Debug, "Create texture manager")
 
@@ -179,6 +423,160 @@ TextureManager::~TextureManager()
 
 	// Clear all textures
 	Clear();
+
+	// Stop the streaming background thread and destroy the remaining requests
+	StopStreamingThread();
+	for (uint32 i=0; i<m_lstStreamingRequests.GetNumOfElements(); i++)
+		delete m_lstStreamingRequests[i];
+	m_lstStreamingRequests.Clear();
+	m_lstStreamingQueue.Clear();
+	m_lstStreamingLoaded.Clear();
+	delete m_pStreamingSemaphore;
+	delete m_pStreamingMutex;
+}
+
+/**
+*  @brief
+*    Adds a streamed texture
+*/
+void TextureManager::AddStreamedTexture(Texture &cTexture)
+{
+	// Register the texture and its resident low resolution mipmaps
+	m_lstStreamedTextures.Add(&cTexture);
+	cTexture.SetStreamingTextureBuffer(nullptr, cTexture.m_nStreamingTailMipmap);
+
+	// Make room for the low resolution mipmaps, if possible
+	EvictStreamedTextures(0, &cTexture);
+}
+
+/**
+*  @brief
+*    Removes a streamed texture and cancels its pending requests
+*/
+void TextureManager::RemoveStreamedTexture(Texture &cTexture)
+{
+	CancelStreamingRequests(cTexture);
+	m_lstStreamedTextures.Remove(&cTexture);
+}
+
+/**
+*  @brief
+*    Requests the loading of a mipmap of a streamed texture
+*/
+void TextureManager::RequestStreamingMipmap(Texture &cTexture, uint32 nMipmap, uint64 nGrowth)
+{
+	// Create the request
+	StreamingRequest *pRequest = new StreamingRequest;
+	pRequest->pTexture = &cTexture;
+	pRequest->sUrl     = cTexture.GetUrl();
+	pRequest->vSize    = Vector3i(Math::Max(cTexture.m_vStreamingSize.x >> nMipmap, 1), Math::Max(cTexture.m_vStreamingSize.y >> nMipmap, 1), 1);
+	pRequest->nMipmap  = nMipmap;
+	pRequest->nGrowth  = nGrowth;
+	pRequest->bLoaded  = false;
+	m_lstStreamingRequests.Add(pRequest);
+	m_nStreamingPendingBytes += nGrowth;
+	cTexture.m_nStreamingRequestedMipmap = nMipmap;
+
+	// Hand the request over to the background thread
+	if (!m_pStreamingThread)
+		StartStreamingThread();
+	m_pStreamingMutex->Lock();
+	m_lstStreamingQueue.Add(pRequest);
+	m_pStreamingMutex->Unlock();
+	m_pStreamingSemaphore->Unlock();
+}
+
+/**
+*  @brief
+*    Cancels the pending requests of a streamed texture
+*/
+void TextureManager::CancelStreamingRequests(Texture &cTexture)
+{
+	for (uint32 i=0; i<m_lstStreamingRequests.GetNumOfElements(); i++) {
+		StreamingRequest *pRequest = m_lstStreamingRequests[i];
+		if (pRequest->pTexture == &cTexture) {
+			m_nStreamingPendingBytes -= pRequest->nGrowth;
+
+			// Destroy the request right now if it's still queued, else just forget the texture and destroy the request as soon as it's loaded
+			m_pStreamingMutex->Lock();
+			const bool bQueued = m_lstStreamingQueue.Remove(pRequest);
+			m_pStreamingMutex->Unlock();
+			if (bQueued) {
+				m_lstStreamingRequests.RemoveAtIndex(i);
+				i--;
+				delete pRequest;
+			} else {
+				pRequest->pTexture = nullptr;
+				pRequest->nGrowth  = 0;
+			}
+		}
+	}
+	cTexture.m_nStreamingRequestedMipmap = cTexture.m_nStreamingResidentMipmap;
+}
+
+/**
+*  @brief
+*    Evicts the high resolution mipmaps of the least recently used textures until the given number of bytes fits into the budget
+*/
+bool TextureManager::EvictStreamedTextures(uint64 nBytes, const Texture *pExclude)
+{
+	while (m_nStreamingMemoryUsage + nBytes > m_nStreamingBudget) {
+		// Find the least recently used texture which was not used within the current frame and has high resolution mipmaps
+		Texture *pLeastRecentlyUsed = nullptr;
+		for (uint32 i=0; i<m_lstStreamedTextures.GetNumOfElements(); i++) {
+			Texture *pTexture = m_lstStreamedTextures[i];
+			if (pTexture != pExclude && pTexture->m_nStreamingLastUsedFrame != m_nStreamingFrame && pTexture->m_nStreamingResidentMipmap < pTexture->m_nStreamingTailMipmap &&
+				(!pLeastRecentlyUsed || pTexture->m_nStreamingLastUsedFrame < pLeastRecentlyUsed->m_nStreamingLastUsedFrame))
+				pLeastRecentlyUsed = pTexture;
+		}
+		if (!pLeastRecentlyUsed)
+			return false; // Error, nothing left to evict!
+
+		// Fall back to the low resolution mipmaps
+		CancelStreamingRequests(*pLeastRecentlyUsed);
+		pLeastRecentlyUsed->SetStreamingTextureBuffer(nullptr, pLeastRecentlyUsed->m_nStreamingTailMipmap);
+	}
+
+	// Done
+	return true;
+}
+
+/**
+*  @brief
+*    Starts the streaming background thread
+*/
+void TextureManager::StartStreamingThread()
+{
+	m_bStreamingShutdown = false;
+	Thread *pThread = new Thread(StreamingThreadFunction, this);
+	pThread->SetName("Texture streaming");
+	if (pThread->Start()) {
+		m_pStreamingThread = pThread;
+	} else {
+		// Error! The requests are loaded on the main thread instead...
+		delete pThread;
+	}
+}
+
+/**
+*  @brief
+*    Stops the streaming background thread
+*/
+void TextureManager::StopStreamingThread()
+{
+	if (m_pStreamingThread) {
+		// Tell the background thread to stop and wake it up
+		m_pStreamingMutex->Lock();
+		m_bStreamingShutdown = true;
+		m_pStreamingMutex->Unlock();
+		m_pStreamingSemaphore->Unlock();
+
+		// Wait until the background thread has stopped
+		m_pStreamingThread->Join();
+		delete m_pStreamingThread;
+		m_pStreamingThread = nullptr;
+		m_bStreamingShutdown = false;
+	}
 }
 
 
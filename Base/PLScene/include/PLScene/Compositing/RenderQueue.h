@@ -0,0 +1,380 @@
+/*********************************************************\
+ *  File: RenderQueue.h                                  *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+#ifndef __PLSCENE_RENDERQUEUE_H__
+#define __PLSCENE_RENDERQUEUE_H__
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <PLCore/Container/Array.h>
+#include <PLCore/Container/HashMap.h>
+#include "PLScene/PLScene.h"
+
+
+//[-------------------------------------------------------]
+//[ Forward declarations                                  ]
+//[-------------------------------------------------------]
+namespace PLRenderer {
+	class Material;
+	class IndexBuffer;
+	class VertexBuffer;
+}
+namespace PLMesh {
+	class Geometry;
+}
+namespace PLScene {
+	class SQCull;
+	class VisNode;
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace PLScene {
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Render queue sorting the draw items of scene renderer passes by packed 64 bit sort keys
+*
+*  @remarks
+*    A scene renderer pass collects one item per visible mesh geometry it wants to draw, sorts the queue
+*    and then draws the items in sorted order. The sort key of an item is built by using "GetSortKey()":
+*  @verbatim
+*    State sorting:  Bits 63..60 layer, 59..48 program, 47..24 material, 23..0 depth (front to back)
+*    Depth sorting:  Bits 63..60 layer, 59..36 depth (back to front), 35..24 program, 23..0 material
+*  @endverbatim
+*    So, for solid geometry, items using the same program and material follow each other and the number of
+*    expensive state changes is reduced, while transparent geometry is still drawn from back to front. Programs
+*    and materials are given compact identifiers by "GetProgramID()" and "GetMaterialID()" in the order they are
+*    first seen, the identifiers are kept over frames so the order of equal items doesn't change. Sorting is a
+*    stable LSD radix sort over the bytes of the keys, bytes all keys have in common are skipped.
+*
+*    After sorting, "BuildBatches()" groups items which can be drawn together by using geometric primitive
+*    instancing: Items with equal layer, program and material using the same vertex buffer, index buffer and
+*    geometry (so the same mesh, LOD and material) become one batch. Batches keep the order of their first item.
+*
+*  @note
+*    - The queue does not own anything the items point to, it's only valid for the frame it was filled in
+*/
+class RenderQueue {
+
+
+	//[-------------------------------------------------------]
+	//[ Public definitions                                    ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Draw item
+		*/
+		struct Item {
+			PLCore::uint64			  nSortKey;			/**< Sort key, see "GetSortKey()" */
+			const SQCull			 *pCullQuery;		/**< Cull query the visibility node was found by, always valid! */
+			const VisNode			 *pVisNode;			/**< Visibility node of the scene node to draw, always valid! */
+			PLRenderer::Material	 *pMaterial;		/**< Used material, always valid! */
+			PLRenderer::VertexBuffer *pVertexBuffer;	/**< Used vertex buffer, always valid! */
+			PLRenderer::IndexBuffer	 *pIndexBuffer;		/**< Used index buffer, always valid! */
+			const PLMesh::Geometry	 *pGeometry;		/**< Geometry to draw, always valid! */
+			bool operator ==(const Item &sItem) const
+			{
+				return (pVisNode == sItem.pVisNode && pGeometry == sItem.pGeometry && pMaterial == sItem.pMaterial);
+			}
+		};
+
+		/**
+		*  @brief
+		*    Batch of items which can be drawn together
+		*/
+		struct Batch {
+			PLCore::uint32 nFirstItem;		/**< Index of the first item of the batch (see "GetItem()") */
+			PLCore::uint32 nNumOfItems;		/**< Number of items within the batch, always >0 */
+			bool operator ==(const Batch &sBatch) const
+			{
+				return (nFirstItem == sBatch.nFirstItem && nNumOfItems == sBatch.nNumOfItems);
+			}
+		};
+
+
+	//[-------------------------------------------------------]
+	//[ Public static functions                               ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Returns a packed sort key
+		*
+		*  @param[in] nLayer
+		*    Layer, only the lower 4 bits are used (for example to draw solid before transparent geometry)
+		*  @param[in] nProgramID
+		*    Program identifier (see "GetProgramID()"), only the lower 12 bits are used
+		*  @param[in] nMaterialID
+		*    Material identifier (see "GetMaterialID()"), only the lower 24 bits are used
+		*  @param[in] fDepth
+		*    Depth of the item, for example the squared distance to the camera, negative values are handled as 0
+		*  @param[in] bBackToFront
+		*    If 'true', the depth has priority over program and material and items are sorted from back to front,
+		*    else program and material have priority and items with equal states are sorted from front to back
+		*
+		*  @return
+		*    The packed sort key
+		*/
+		PLS_API static PLCore::uint64 GetSortKey(PLCore::uint32 nLayer, PLCore::uint32 nProgramID, PLCore::uint32 nMaterialID, float fDepth, bool bBackToFront);
+
+
+	//[-------------------------------------------------------]
+	//[ Public functions                                      ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Default constructor
+		*/
+		PLS_API RenderQueue();
+
+		/**
+		*  @brief
+		*    Destructor
+		*/
+		PLS_API ~RenderQueue();
+
+		/**
+		*  @brief
+		*    Removes all items
+		*
+		*  @note
+		*    - The memory is kept to avoid dynamic memory allocations in the next frame
+		*/
+		PLS_API void Clear();
+
+		/**
+		*  @brief
+		*    Returns the number of items within the queue
+		*
+		*  @return
+		*    The number of items within the queue
+		*/
+		inline PLCore::uint32 GetNumOfItems() const;
+
+		/**
+		*  @brief
+		*    Returns an item
+		*
+		*  @param[in] nIndex
+		*    Index of the item, must be valid
+		*
+		*  @return
+		*    The requested item, in sorted order after "Sort()" was called, else in the order the items were added
+		*/
+		inline const Item &GetItem(PLCore::uint32 nIndex) const;
+
+		/**
+		*  @brief
+		*    Adds an item
+		*
+		*  @param[in] sItem
+		*    Item to add
+		*/
+		PLS_API void Add(const Item &sItem);
+
+		/**
+		*  @brief
+		*    Sorts the items by their sort keys
+		*
+		*  @note
+		*    - The sort is stable, items with equal sort keys keep the order they were added in
+		*/
+		PLS_API void Sort();
+
+		/**
+		*  @brief
+		*    Groups the items into batches
+		*
+		*  @param[in] nMaxNumOfItems
+		*    Maximum number of items per batch, 0 or 1 for one batch per item
+		*
+		*  @remarks
+		*    Items with the same layer, program and material (the upper 40 bits of the state sort key) using the same
+		*    cull query, vertex buffer, index buffer and geometry are grouped into one batch. The items are reordered
+		*    so that the items of a batch follow each other. A batch is placed at the position of its first item, so
+		*    within the runs of equal states the depth order of the batches is kept. When using depth sorting (see
+		*    "GetSortKey()") the depth is within the upper bits, so only items with the same depth are grouped.
+		*
+		*  @note
+		*    - Call this after "Sort()", without calling it there are no batches
+		*/
+		PLS_API void BuildBatches(PLCore::uint32 nMaxNumOfItems);
+
+		/**
+		*  @brief
+		*    Returns the number of batches
+		*
+		*  @return
+		*    The number of batches built by "BuildBatches()"
+		*/
+		inline PLCore::uint32 GetNumOfBatches() const;
+
+		/**
+		*  @brief
+		*    Returns a batch
+		*
+		*  @param[in] nIndex
+		*    Index of the batch, must be valid
+		*
+		*  @return
+		*    The requested batch
+		*/
+		inline const Batch &GetBatch(PLCore::uint32 nIndex) const;
+
+		/**
+		*  @brief
+		*    Returns the identifier of a program
+		*
+		*  @param[in] pProgram
+		*    Program (or anything else identifying the used program), can be a null pointer
+		*
+		*  @return
+		*    Identifier of the program, 0 for a null pointer, else 1 for the first program seen and so on
+		*
+		*  @note
+		*    - If the 12 bits the sort key has for programs are used up, the identifiers are given again starting with 1
+		*/
+		PLS_API PLCore::uint32 GetProgramID(const void *pProgram);
+
+		/**
+		*  @brief
+		*    Returns the identifier of a material
+		*
+		*  @param[in] pMaterial
+		*    Material (or anything else identifying the used material), can be a null pointer
+		*
+		*  @return
+		*    Identifier of the material, 0 for a null pointer, else 1 for the first material seen and so on
+		*
+		*  @note
+		*    - If the 24 bits the sort key has for materials are used up, the identifiers are given again starting with 1
+		*/
+		PLS_API PLCore::uint32 GetMaterialID(const void *pMaterial);
+
+
+	//[-------------------------------------------------------]
+	//[ Private definitions                                   ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Sort entry
+		*/
+		struct Entry {
+			PLCore::uint64 nSortKey;	/**< Sort key of the item */
+			PLCore::uint32 nItem;		/**< Index of the item */
+			bool operator ==(const Entry &sEntry) const
+			{
+				return (nItem == sEntry.nItem);
+			}
+		};
+
+
+	//[-------------------------------------------------------]
+	//[ Private static functions                              ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Returns whether or not two items can be drawn within the same batch
+		*
+		*  @param[in] sFirst
+		*    First item
+		*  @param[in] sSecond
+		*    Second item
+		*
+		*  @return
+		*    'true' if both items can be drawn within the same batch, else 'false'
+		*/
+		static inline bool IsBatchable(const Item &sFirst, const Item &sSecond);
+
+
+	//[-------------------------------------------------------]
+	//[ Private functions                                     ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Copy constructor
+		*
+		*  @param[in] cSource
+		*    Source to copy from
+		*/
+		RenderQueue(const RenderQueue &cSource);
+
+		/**
+		*  @brief
+		*    Copy operator
+		*
+		*  @param[in] cSource
+		*    Source to copy from
+		*
+		*  @return
+		*    Reference to this instance
+		*/
+		RenderQueue &operator =(const RenderQueue &cSource);
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		PLCore::Array<Item>								m_lstItems;			/**< Items in the order they were added */
+		PLCore::Array<Entry>							m_lstEntries;		/**< Sort entries, one per item */
+		PLCore::Array<Entry>							m_lstSortBuffer;	/**< Temporary radix sort buffer */
+		PLCore::HashMap<PLCore::uint64, PLCore::uint32>	m_mapProgramIDs;	/**< Program identifiers */
+		PLCore::HashMap<PLCore::uint64, PLCore::uint32>	m_mapMaterialIDs;	/**< Material identifiers */
+		PLCore::Array<Batch>							m_lstBatches;		/**< Batches built by "BuildBatches()" */
+		PLCore::Array<PLCore::uint32>					m_lstBatchOfEntry;	/**< Temporary batch index per sort entry */
+		PLCore::HashMap<PLCore::uint64, PLCore::uint32>	m_mapBatches;		/**< Temporary open batches (batch index + 1) */
+
+
+};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // PLScene
+
+
+//[-------------------------------------------------------]
+//[ Implementation                                        ]
+//[-------------------------------------------------------]
+#include "PLScene/Compositing/RenderQueue.inl"
+
+
+#endif // __PLSCENE_RENDERQUEUE_H__
@@ -0,0 +1,88 @@
+/*********************************************************\
+ *  File: RenderQueue.inl                                *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace PLScene {
+
+
+//[-------------------------------------------------------]
+//[ Public functions                                      ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Returns the number of items within the queue
+*/
+inline PLCore::uint32 RenderQueue::GetNumOfItems() const
+{
+	return m_lstEntries.GetNumOfElements();
+}
+
+/**
+*  @brief
+*    Returns an item
+*/
+inline const RenderQueue::Item &RenderQueue::GetItem(PLCore::uint32 nIndex) const
+{
+	return m_lstItems[m_lstEntries[nIndex].nItem];
+}
+
+/**
+*  @brief
+*    Returns the number of batches
+*/
+inline PLCore::uint32 RenderQueue::GetNumOfBatches() const
+{
+	return m_lstBatches.GetNumOfElements();
+}
+
+/**
+*  @brief
+*    Returns a batch
+*/
+inline const RenderQueue::Batch &RenderQueue::GetBatch(PLCore::uint32 nIndex) const
+{
+	return m_lstBatches[nIndex];
+}
+
+
+//[-------------------------------------------------------]
+//[ Private static functions                              ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Returns whether or not two items can be drawn within the same batch
+*/
+inline bool RenderQueue::IsBatchable(const Item &sFirst, const Item &sSecond)
+{
+	return ((sFirst.nSortKey >> 24) == (sSecond.nSortKey >> 24) && sFirst.pCullQuery == sSecond.pCullQuery && sFirst.pMaterial == sSecond.pMaterial &&
+			sFirst.pVertexBuffer == sSecond.pVertexBuffer && sFirst.pIndexBuffer == sSecond.pIndexBuffer && sFirst.pGeometry == sSecond.pGeometry);
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // PLScene
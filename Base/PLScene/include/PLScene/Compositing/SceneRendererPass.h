@@ -173,6 +173,18 @@ class SceneRendererPass : public PLCore::Object, public PLCore::Element<SceneRen
 		*/
 		PLS_API void SetActive(bool bActive = true);
 
+		/**
+		*  @brief
+		*    Returns the time the last draw of this scene renderer pass took
+		*
+		*  @return
+		*    The time in microseconds the last draw took, 0 if the scene renderer pass was inactive
+		*
+		*  @note
+		*    - Measured by "SceneRenderer::DrawScene()", useful for profiling
+		*/
+		PLS_API PLCore::uint64 GetDrawTime() const;
+
 
 	//[-------------------------------------------------------]
 	//[ Protected functions                                   ]
@@ -212,6 +224,7 @@ class SceneRendererPass : public PLCore::Object, public PLCore::Element<SceneRen
 	//[-------------------------------------------------------]
 	private:
 		PLCore::uint32 m_nFlags;	/**< Flags */
+		PLCore::uint64 m_nDrawTime;	/**< Time in microseconds the last draw took */
 
 
 };
@@ -0,0 +1,186 @@
+/*********************************************************\
+ *  File: HLODBuilder.h                                  *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+
+
+#ifndef __PLSCENE_HLODBUILDER_H__
+#define __PLSCENE_HLODBUILDER_H__
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <PLCore/String/String.h>
+#include "PLScene/PLScene.h"
+
+
+//[-------------------------------------------------------]
+//[ Forward declarations                                  ]
+//[-------------------------------------------------------]
+namespace PLCore {
+	template <class AType> class Array;
+}
+namespace PLMath {
+	class Matrix3x4;
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace PLScene {
+
+
+//[-------------------------------------------------------]
+//[ Forward declarations                                  ]
+//[-------------------------------------------------------]
+class SNMesh;
+class SceneNode;
+class SceneContainer;
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Static tool class building hierarchical LOD proxies of scene containers
+*
+*  @remarks
+*    A proxy is a mesh scene node added to the parent container of the given scene container. It's
+*    configured as the "HLODProxy" of the scene container, so the cull query draws it instead of the
+*    whole scene container content as soon as the scene container is farther away than "HLODDistance".
+*    There are two kinds of proxies:
+*    - A merged proxy mesh: All visible meshes of the scene container (and of its scene containers)
+*      merged into one mesh, using the simplest LOD level of each mesh and one geometry per material
+*    - An impostor: A billboard showing a picture of the scene container content rendered once
+*
+*  @note
+*    - Proxies are snapshots, when the content of the scene container changes they have to be built again
+*    - Meshes are merged using their base vertex data, animations are not taken into account
+*/
+class HLODBuilder {
+
+
+	//[-------------------------------------------------------]
+	//[ Public static functions                               ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Builds a merged proxy mesh of the given scene container
+		*
+		*  @param[in] cContainer
+		*    Scene container to build the proxy of, must have a parent container
+		*  @param[in] fDistance
+		*    Distance to the camera the proxy is used at, see "SceneContainer::HLODDistance"
+		*  @param[in] sName
+		*    Name of the proxy scene node, if empty "<container name>_HLOD" is used
+		*
+		*  @return
+		*    The created proxy scene node, a null pointer on error (e.g. there are no visible meshes)
+		*/
+		static PLS_API SNMesh *BuildProxyMesh(SceneContainer &cContainer, float fDistance, const PLCore::String &sName = "");
+
+		/**
+		*  @brief
+		*    Builds an impostor of the given scene container
+		*
+		*  @param[in] cContainer
+		*    Scene container to build the impostor of, must have a parent container
+		*  @param[in] fDistance
+		*    Distance to the camera the impostor is used at, see "SceneContainer::HLODDistance"
+		*  @param[in] nSize
+		*    Width and height of the impostor texture
+		*  @param[in] sSceneRenderer
+		*    Filename of the scene renderer used to render the impostor texture
+		*  @param[in] sName
+		*    Name of the proxy scene node, if empty "<container name>_HLOD" is used
+		*
+		*  @return
+		*    The created proxy scene node, a null pointer on error
+		*
+		*  @remarks
+		*    The scene container content is rendered once from the front (looking along the positive z axis)
+		*    into a texture. The impostor is a quad showing this texture which is rotated around the y axis
+		*    towards the viewer by a "PLScene::SNMBillboardCylindrical" scene node modifier. The used material
+		*    is using alpha test, so the clear color alpha of the scene renderer should be 0.
+		*
+		*  @note
+		*    - Changes and restores the current render target of the renderer, so don't call this function
+		*      while a scene is drawn
+		*/
+		static PLS_API SNMesh *BuildImpostor(SceneContainer &cContainer, float fDistance, PLCore::uint32 nSize = 256,
+											 const PLCore::String &sSceneRenderer = "Forward.sr", const PLCore::String &sName = "");
+
+
+	//[-------------------------------------------------------]
+	//[ Private static functions                              ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Recursively collects the visible scene nodes with a mesh of a scene container
+		*
+		*  @param[in]  cContainer
+		*    Scene container to collect the scene nodes of
+		*  @param[in]  mTransform
+		*    Transform matrix from the given scene container into the space of the scene container the proxy is built for
+		*  @param[out] lstMeshes
+		*    Receives the scene nodes with a mesh (list is not cleared before new entries are added)
+		*  @param[out] lstTransforms
+		*    Receives the transform matrix of each collected scene node (list is not cleared before new entries are added)
+		*/
+		static void CollectMeshes(SceneContainer &cContainer, const PLMath::Matrix3x4 &mTransform, PLCore::Array<SceneNode*> &lstMeshes, PLCore::Array<PLMath::Matrix3x4> &lstTransforms);
+
+		/**
+		*  @brief
+		*    Adds a proxy mesh scene node to the parent container of the given scene container
+		*
+		*  @param[in] cContainer
+		*    Scene container the proxy is created for
+		*  @param[in] fDistance
+		*    Distance to the camera the proxy is used at
+		*  @param[in] sName
+		*    Name of the proxy scene node, if empty "<container name>_HLOD" is used
+		*  @param[in] sMesh
+		*    Name of the mesh to use
+		*
+		*  @return
+		*    The created proxy scene node, a null pointer on error
+		*/
+		static SNMesh *AddProxy(SceneContainer &cContainer, float fDistance, const PLCore::String &sName, const PLCore::String &sMesh);
+
+
+};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // PLScene
+
+
+#endif // __PLSCENE_HLODBUILDER_H__
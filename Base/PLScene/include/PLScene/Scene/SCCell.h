@@ -39,6 +39,12 @@
 namespace PLScene {
 
 
+//[-------------------------------------------------------]
+//[ Forward declarations                                  ]
+//[-------------------------------------------------------]
+class SceneNodeHandler;
+
+
 //[-------------------------------------------------------]
 //[ Classes                                               ]
 //[-------------------------------------------------------]
@@ -46,6 +52,12 @@ namespace PLScene {
 *  @brief
 *    Cell (other names: area/sector/zone/room/cluster) scene node container
 *
+*  @remarks
+*    The contents of a cell can be stored within a separately loadable sub-scene given by "StreamFilename".
+*    Such streamed contents are loaded into a child scene container, so the portals and other scene nodes
+*    of the cell itself stay untouched when the contents are loaded or unloaded. This way, large worlds
+*    don't need to keep all cells in memory at the same time, see "SNMCellStreaming".
+*
 *  @note
 *    - All world physics scene nodes should be derived from this class
 */
@@ -56,9 +68,19 @@ class SCCell : public SceneContainer {
 	//[ RTTI interface                                        ]
 	//[-------------------------------------------------------]
 	pl_class_def(PLS_API)
+		// Attributes
+		pl_attribute_getset(SCCell,	StreamFilename,	PLCore::String,	"",	ReadWrite)
 	pl_class_def_end
 
 
+	//[-------------------------------------------------------]
+	//[ Public RTTI get/set functions                         ]
+	//[-------------------------------------------------------]
+	public:
+		PLS_API PLCore::String GetStreamFilename() const;
+		PLS_API void SetStreamFilename(const PLCore::String &sValue);
+
+
 	//[-------------------------------------------------------]
 	//[ Public functions                                      ]
 	//[-------------------------------------------------------]
@@ -75,6 +97,60 @@ class SCCell : public SceneContainer {
 		*/
 		PLS_API virtual ~SCCell();
 
+		/**
+		*  @brief
+		*    Returns the scene container holding the streamed contents of this cell
+		*
+		*  @return
+		*    The scene container holding the streamed contents, a null pointer if the streamed contents are not loaded
+		*/
+		PLS_API SceneContainer *GetStreamedContents() const;
+
+		/**
+		*  @brief
+		*    Loads the streamed contents of this cell
+		*
+		*  @return
+		*    'true' if all went fine, else 'false' (maybe there's no stream filename?)
+		*
+		*  @note
+		*    - Blocks until the sub-scene is loaded, use "SNMCellStreaming" to read the sub-scene in the background
+		*    - Already loaded streamed contents are replaced
+		*/
+		PLS_API bool LoadStreamedContents();
+
+		/**
+		*  @brief
+		*    Loads the streamed contents of this cell from a given file
+		*
+		*  @param[in] cFile
+		*    File to load the sub-scene from, usually a memory buffered file with the URL of the stream filename
+		*
+		*  @return
+		*    'true' if all went fine, else 'false'
+		*
+		*  @note
+		*    - Already loaded streamed contents are replaced
+		*/
+		PLS_API bool LoadStreamedContents(PLCore::File &cFile);
+
+		/**
+		*  @brief
+		*    Unloads the streamed contents of this cell
+		*
+		*  @note
+		*    - The scene nodes of the streamed contents are destroyed during the next scene context cleanup
+		*/
+		PLS_API void UnloadStreamedContents();
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		PLCore::String	  m_sStreamFilename;	/**< Filename of the sub-scene holding the streamed contents */
+		SceneNodeHandler *m_pStreamedContents;	/**< Scene container holding the streamed contents (always valid!) */
+
 
 };
 
@@ -176,6 +176,7 @@ class SNPointLight : public SNLight {
 		PLS_API virtual void UpdateAABoundingBox() override;
 		PLS_API virtual void GetBoundingSphere(PLMath::Sphere &cSphere) override;
 		PLS_API virtual void GetContainerBoundingSphere(PLMath::Sphere &cSphere) override;
+		PLS_API virtual bool ResetFunction() override;
 
 
 	//[-------------------------------------------------------]
@@ -265,6 +265,7 @@ class SNSpotLight : public SNPointLight {
 		PLS_API virtual void UpdateAABoundingBox() override;
 		PLS_API virtual void GetBoundingSphere(PLMath::Sphere &cSphere) override;
 		PLS_API virtual void GetContainerBoundingSphere(PLMath::Sphere &cSphere) override;
+		PLS_API virtual bool ResetFunction() override;
 
 
 };
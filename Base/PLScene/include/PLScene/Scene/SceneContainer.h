@@ -31,6 +31,7 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include <PLCore/Container/Pool.h>
+#include <PLCore/Container/Array.h>
 #include <PLCore/Tools/Loadable.h>
 #include "PLScene/Scene/SceneNode.h"
 
@@ -46,6 +47,7 @@ namespace PLScene {
 //[-------------------------------------------------------]
 class SceneQuery;
 class SceneHierarchy;
+class SceneNodeHandler;
 class SceneQueryManager;
 
 
@@ -70,6 +72,9 @@ class SceneQueryManager;
 *    - Use "GetSceneContext()->GetRoot()" to get the 'root' node in which you can insert your scenes
 *    - Derived classes should use a 'SC'-prefix (example: SCCell)
 *    - By default, all draw function flags are set
+*    - Hierarchical LOD (HLOD): If "HLODDistance" and "HLODProxy" are set, the visibility determination replaces this
+*      scene container by the proxy scene node as soon as the camera is further away than the given distance, the scene
+*      nodes of this scene container are not traversed at all in this case - see "HLODBuilder" for a tool creating proxies
 */
 class SceneContainer : public SceneNode, public PLCore::ElementManager<SceneNode>, public PLCore::Loadable {
 
@@ -105,13 +110,15 @@ class SceneContainer : public SceneNode, public PLCore::ElementManager<SceneNode
 	//[-------------------------------------------------------]
 	pl_class_def(PLS_API)
 		// Attributes
-		pl_attribute_getset(SceneContainer,	Hierarchy,	PLCore::String,		"PLScene::SHList",									ReadWrite)
+		pl_attribute_getset(SceneContainer,	Hierarchy,		PLCore::String,		"PLScene::SHList",									ReadWrite)
+		pl_attribute_getset(SceneContainer,	HLODDistance,	float,				0.0f,												ReadWrite)
+		pl_attribute_getset(SceneContainer,	HLODProxy,		PLCore::String,		"",													ReadWrite)
 			// Overwritten SceneNode attributes
-		pl_attribute_getset(SceneContainer,	Flags,		PLCore::uint32,		0,													ReadWrite)
-		pl_attribute_getset(SceneContainer,	AABBMin,	PLMath::Vector3,	PLMath::Vector3(-10000.0f, -10000.0f, -10000.0f),	ReadWrite)
-		pl_attribute_getset(SceneContainer,	AABBMax,	PLMath::Vector3,	PLMath::Vector3( 10000.0f,  10000.0f,  10000.0f),	ReadWrite)
+		pl_attribute_getset(SceneContainer,	Flags,			PLCore::uint32,		0,													ReadWrite)
+		pl_attribute_getset(SceneContainer,	AABBMin,		PLMath::Vector3,	PLMath::Vector3(-10000.0f, -10000.0f, -10000.0f),	ReadWrite)
+		pl_attribute_getset(SceneContainer,	AABBMax,		PLMath::Vector3,	PLMath::Vector3( 10000.0f,  10000.0f,  10000.0f),	ReadWrite)
 			// Overwritten Loadable attributes
-		pl_attribute_getset(SceneContainer,	Filename,	PLCore::String,		"",													ReadWrite)
+		pl_attribute_getset(SceneContainer,	Filename,		PLCore::String,		"",													ReadWrite)
 		// Signals
 		pl_signal_1_def(SignalLoadProgress,	float)
 	pl_class_def_end
@@ -123,6 +130,10 @@ class SceneContainer : public SceneNode, public PLCore::ElementManager<SceneNode
 	public:
 		PLS_API PLCore::String GetHierarchy() const;
 		PLS_API void SetHierarchy(const PLCore::String &sValue);
+		PLS_API float GetHLODDistance() const;
+		PLS_API void SetHLODDistance(float fValue);
+		PLS_API PLCore::String GetHLODProxy() const;
+		PLS_API void SetHLODProxy(const PLCore::String &sValue);
 		PLS_API void SetFilename(const PLCore::String &sValue);
 
 
@@ -184,6 +195,30 @@ class SceneContainer : public SceneNode, public PLCore::ElementManager<SceneNode
 		*/
 		PLS_API SceneNode *CreateAtIndex(const PLCore::String &sClass, const PLCore::String &sName = "", const PLCore::String &sParameters = "", int nPosition = -1);
 
+		/**
+		*  @brief
+		*    Creates a new scene node of a known scene node type
+		*
+		*  @param[in] sName
+		*    Scene node name
+		*  @param[in] bAnonymous
+		*    If 'true', the scene node gets no name and is not registered within the name lookup of this scene container,
+		*    meaning it can't be found by using "GetByName()" - use this for short-living scene nodes spawned in masses
+		*
+		*  @return
+		*    Pointer to the new scene node, always valid
+		*
+		*  @remarks
+		*    This is the fast path of "Create()" for code knowing the scene node type at compile time: There's no class
+		*    lookup by name, no construction through the RTTI and no parameter string parsing. Scene nodes given up
+		*    by "SceneNode::Recycle()" are reused.
+		*
+		*  @note
+		*    - "AType" must be derived from "SceneNode" and must have its own RTTI class (see "pl_class")
+		*    - If the desired name is already in use, the name is chosen automatically
+		*/
+		template <class AType> AType *Create(const PLCore::String &sName = "", bool bAnonymous = false);
+
 		/**
 		*  @brief
 		*    Calculates and sets the axis align bounding box in 'scene node space'
@@ -208,6 +243,36 @@ class SceneContainer : public SceneNode, public PLCore::ElementManager<SceneNode
 		*/
 		PLS_API bool GetTransformMatrixTo(SceneContainer &cContainer, PLMath::Matrix3x4 &mTransform);
 
+		/**
+		*  @brief
+		*    Recalculates all dirty cached world matrices of this scene container and the scene containers within it
+		*
+		*  @remarks
+		*    Within each scene container, the cached world matrices are stored within one contiguous array which is
+		*    processed linear. Scene containers are processed after their parent scene container, so the world matrix
+		*    of the parent is always up-to-date. Scene containers without dirty world matrices are skipped.
+		*
+		*  @note
+		*    - Called by "SceneContext::Update()" for the root scene container, so usually there's no need to call this function manually
+		*    - See "SceneNode::GetWorldMatrix()"
+		*/
+		PLS_API void UpdateWorldMatrices();
+
+		/**
+		*  @brief
+		*    Returns the hierarchical LOD proxy scene node
+		*
+		*  @return
+		*    The scene node given by the "HLODProxy"-attribute, a null pointer if there's no such scene node
+		*
+		*  @remarks
+		*    The proxy scene node is searched within the parent scene container of this scene container and must be a
+		*    direct child of it, meaning it's a sibling of this scene container. This way, the proxy is within the same
+		*    space as this scene container and is not skipped together with the scene nodes of this scene container.
+		*    Proxy scene nodes are only drawn as replacement for this scene container, never on their own.
+		*/
+		PLS_API SceneNode *GetHLODProxyNode();
+
 		//[-------------------------------------------------------]
 		//[ Hierarchy functions                                   ]
 		//[-------------------------------------------------------]
@@ -293,6 +358,27 @@ class SceneContainer : public SceneNode, public PLCore::ElementManager<SceneNode
 		PLS_API bool DestroyQuery(SceneQuery &cQuery);
 
 
+	//[-------------------------------------------------------]
+	//[ Private structures                                    ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Cached world matrix of a scene node within this scene container
+		*/
+		struct WorldMatrix {
+			PLMath::Matrix3x4  mMatrix;		/**< Transform matrix from 'scene node space' into 'root space' */
+			SceneNode		  *pSceneNode;	/**< The scene node the world matrix belongs to, always valid */
+			bool			   bDirty;		/**< Recalculation of the world matrix required? */
+			bool			   bContainer;	/**< Is the scene node a scene container? */
+
+			bool operator ==(const WorldMatrix &sWorldMatrix) const
+			{
+				return (pSceneNode == sWorldMatrix.pSceneNode);
+			}
+		};
+
+
 	//[-------------------------------------------------------]
 	//[ Private functions                                     ]
 	//[-------------------------------------------------------]
@@ -338,6 +424,31 @@ class SceneContainer : public SceneNode, public PLCore::ElementManager<SceneNode
 		*/
 		bool Remove(SceneNode &cNode, bool bDeInitNode = true);
 
+		/**
+		*  @brief
+		*    Takes a pooled scene node of the given class from the scene context
+		*
+		*  @param[in] cClass
+		*    Scene node class
+		*
+		*  @return
+		*    The reset scene node, a null pointer if there's no pooled scene node of the given class
+		*/
+		PLS_API SceneNode *GetRecycledSceneNode(const PLCore::Class &cClass) const;
+
+		/**
+		*  @brief
+		*    Adds a scene node created by "Create<AType>()"
+		*
+		*  @param[in] cNode
+		*    Reference to the node that should be added
+		*  @param[in] sName
+		*    Node name
+		*  @param[in] bAnonymous
+		*    Add the node without name?
+		*/
+		PLS_API void AddCreatedSceneNode(SceneNode &cNode, const PLCore::String &sName, bool bAnonymous);
+
 
 	//[-------------------------------------------------------]
 	//[ Private data                                          ]
@@ -345,6 +456,9 @@ class SceneContainer : public SceneNode, public PLCore::ElementManager<SceneNode
 	private:
 		// Private data
 		PLCore::String	   m_sHierarchy;	/**< Class name of the scene container hierarchy */
+		float			   m_fHLODDistance;	/**< Distance from which on the hierarchical LOD proxy replaces this scene container, <= 0 if disabled */
+		PLCore::String	   m_sHLODProxy;	/**< Name of the hierarchical LOD proxy scene node */
+		SceneNodeHandler  *m_pHLODProxy;	/**< Hierarchical LOD proxy scene node, always valid! */
 		SceneContext	  *m_pSceneContext;	/**< The scene context this scene container is in (should be always valid!) */
 		SceneHierarchy	  *m_pHierarchy;	/**< Scene hierarchy, can be a null pointer */
 		SceneQueryManager *m_pQueryManager;	/**< Scene query manager, can be a null pointer */
@@ -352,6 +466,10 @@ class SceneContainer : public SceneNode, public PLCore::ElementManager<SceneNode
 		/** List of scene nodes which need a scene hierarchy refresh */
 		PLCore::Pool<SceneNode*> m_lstHierarchyRefresh;
 
+		// World matrix cache
+		PLCore::Array<WorldMatrix> m_lstWorldMatrices;		/**< Cached world matrices of the scene nodes within this scene container, the scene node knows its index */
+		bool					   m_bWorldMatricesDirty;	/**< Is there at least one dirty world matrix within this scene container or within one of its scene containers? */
+
 
 	//[-------------------------------------------------------]
 	//[ Protected virtual SceneNode functions                 ]
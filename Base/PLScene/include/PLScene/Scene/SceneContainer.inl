@@ -41,6 +41,32 @@ inline SceneNode *SceneContainer::Create(const PLCore::String &sClass, const PLC
 	return CreateAtIndex(sClass, sName, sParameters, -1);
 }
 
+/**
+*  @brief
+*    Creates a new scene node of a known scene node type
+*/
+template <class AType>
+AType *SceneContainer::Create(const PLCore::String &sName, bool bAnonymous)
+{
+	// To keep things as fast as possible we store a pointer to the class of the scene node type
+	// (no class manager lookup)
+	static const PLCore::Class *pClass = nullptr;
+
+	// Reuse a pooled scene node of this type, if there's one
+	AType *pNode = pClass ? static_cast<AType*>(GetRecycledSceneNode(*pClass)) : nullptr;
+	if (!pNode) {
+		pNode = new AType();
+		if (!pClass)
+			pClass = pNode->GetClass();
+	}
+
+	// Add the scene node
+	AddCreatedSceneNode(*pNode, sName, bAnonymous);
+
+	// Return the created scene node
+	return pNode;
+}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
@@ -31,6 +31,7 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include <PLCore/Container/Array.h>
+#include <PLCore/Container/HashMap.h>
 #include <PLCore/Base/Event/Event.h>
 #include <PLCore/Core/AbstractContext.h>
 #include "PLScene/PLScene.h"
@@ -39,6 +40,9 @@
 //[-------------------------------------------------------]
 //[ Forward declarations                                  ]
 //[-------------------------------------------------------]
+namespace PLCore {
+	class Class;
+}
 namespace PLMath {
 	class GraphPathManager;
 }
@@ -54,6 +58,7 @@ namespace PLScene {
 	class SceneContainer;
 	class SceneNodeHandler;
 	class SceneRendererManager;
+	class SceneUpdateScheduler;
 }
 
 
@@ -80,6 +85,7 @@ class SceneContext : public PLCore::AbstractContext {
 	//[ Friends                                               ]
 	//[-------------------------------------------------------]
 	friend class SceneNode;
+	friend class SceneContainer;
 
 
 	//[-------------------------------------------------------]
@@ -155,10 +161,53 @@ class SceneContext : public PLCore::AbstractContext {
 		*    If SceneNode::Delete() is called, scene nodes are not destroyed immediately,
 		*    instead they register them self into a 'to delete' list of the scene graph. As
 		*    soon this function is called, the scene nodes are destroyed. Normally this function
-		*    is called once per frame automatically.
+		*    is called once per frame automatically. Scene nodes given up by SceneNode::Recycle()
+		*    are reset and put into the scene node pool instead.
 		*/
 		PLS_API void Cleanup();
 
+		/**
+		*  @brief
+		*    Returns the number of pooled scene nodes waiting to be reused
+		*
+		*  @return
+		*    The number of pooled scene nodes
+		*
+		*  @see
+		*    - SceneNode::Recycle()
+		*/
+		PLS_API PLCore::uint32 GetNumOfRecycledSceneNodes() const;
+
+		/**
+		*  @brief
+		*    Returns the maximum number of pooled scene nodes per scene node class
+		*
+		*  @return
+		*    The maximum number of pooled scene nodes per scene node class
+		*
+		*  @remarks
+		*    Recycled scene nodes exceeding this limit are destroyed within "Cleanup()". The default is 1024.
+		*/
+		PLS_API PLCore::uint32 GetMaxNumOfRecycledSceneNodes() const;
+
+		/**
+		*  @brief
+		*    Sets the maximum number of pooled scene nodes per scene node class
+		*
+		*  @param[in] nMaxNumOfRecycledSceneNodes
+		*    The maximum number of pooled scene nodes per scene node class, 0 to disable pooling
+		*
+		*  @note
+		*    - Already pooled scene nodes are not destroyed, use "ClearRecycledSceneNodes()" for this
+		*/
+		PLS_API void SetMaxNumOfRecycledSceneNodes(PLCore::uint32 nMaxNumOfRecycledSceneNodes = 1024);
+
+		/**
+		*  @brief
+		*    Destroys all pooled scene nodes
+		*/
+		PLS_API void ClearRecycledSceneNodes();
+
 		/**
 		*  @brief
 		*    Method that is called once per update loop
@@ -171,9 +220,47 @@ class SceneContext : public PLCore::AbstractContext {
 		*    recommended to keep the work done within the implementation as compact as possible.
 		*    Don't use this method to perform 'polling'-everything, use events or if required
 		*    for example timers instead.
+		*
+		*    First the scheduled update of the update scheduler is performed, then "EventUpdate" is emitted.
+		*    Finally, all dirty cached world matrices of the scene graph are recalculated.
 		*/
 		PLS_API void Update(bool bRespectPause = true);
 
+		/**
+		*  @brief
+		*    Returns the update scheduler
+		*
+		*  @return
+		*    The update scheduler
+		*
+		*  @see
+		*    - SceneUpdateScheduler for more information
+		*/
+		PLS_API SceneUpdateScheduler &GetUpdateScheduler();
+
+		/**
+		*  @brief
+		*    Returns the world matrix cache statistics
+		*
+		*  @param[out] nHits
+		*    Receives the number of world matrix requests which were answered by using the cache
+		*  @param[out] nMisses
+		*    Receives the number of world matrix requests which required a recalculation
+		*  @param[out] nUpdates
+		*    Receives the number of world matrices which were recalculated within "Update()"
+		*
+		*  @note
+		*    - The statistics are accumulated until "ResetWorldMatrixStatistics()" is called
+		*    - See "SceneNode::GetWorldMatrix()"
+		*/
+		PLS_API void GetWorldMatrixStatistics(PLCore::uint32 &nHits, PLCore::uint32 &nMisses, PLCore::uint32 &nUpdates) const;
+
+		/**
+		*  @brief
+		*    Resets the world matrix cache statistics
+		*/
+		PLS_API void ResetWorldMatrixStatistics();
+
 		/**
 		*  @brief
 		*    Returns the scene renderer manager
@@ -260,6 +347,23 @@ class SceneContext : public PLCore::AbstractContext {
 		PLS_API bool EndProcess();
 
 
+	//[-------------------------------------------------------]
+	//[ Private functions                                     ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Takes a pooled scene node of the given class
+		*
+		*  @param[in] cClass
+		*    Scene node class
+		*
+		*  @return
+		*    The reset scene node, a null pointer if there's no pooled scene node of the given class
+		*/
+		SceneNode *GetRecycledSceneNode(const PLCore::Class &cClass);
+
+
 	//[-------------------------------------------------------]
 	//[ Private data                                          ]
 	//[-------------------------------------------------------]
@@ -269,8 +373,16 @@ class SceneContext : public PLCore::AbstractContext {
 		PLMath::GraphPathManager	 *m_pGraphPathManager;		/**< The graph path manager, can be a null pointer */
 		SceneNodeHandler			 *m_pRoot;					/**< The root of the scene graph (always valid!) */
 		PLCore::Array<SceneNode*>	  m_lstDeleteNodes;			/**< List of scene nodes to delete */
+		PLCore::Array<SceneNode*>	  m_lstRecycleNodes;		/**< List of scene nodes to reset and pool */
+		PLCore::HashMap<PLCore::uint64, PLCore::Array<SceneNode*>*> m_mapRecycledNodes;	/**< Pooled scene nodes per scene node class (key = class address) */
+		PLCore::uint32				  m_nNumOfRecycledSceneNodes;		/**< Number of pooled scene nodes */
+		PLCore::uint32				  m_nMaxNumOfRecycledSceneNodes;	/**< Maximum number of pooled scene nodes per scene node class */
 		SceneRendererManager		 *m_pSceneRendererManager;	/**< Scene renderer manager, can be a null pointer */
 		VisManager					 *m_pVisManager;			/**< Visibility manager, can be a null pointer */
+		SceneUpdateScheduler		 *m_pUpdateScheduler;		/**< Update scheduler, can be a null pointer */
+		PLCore::uint32				  m_nNumOfWorldMatrixHits;	/**< Number of world matrix cache hits */
+		PLCore::uint32				  m_nNumOfWorldMatrixMisses;	/**< Number of world matrix cache misses */
+		PLCore::uint32				  m_nNumOfWorldMatrixUpdates;	/**< Number of world matrices recalculated within "Update()" */
 		bool						  m_bProcessActive;			/**< Is there currently an active process? */
 		PLCore::uint32				  m_nProcessCounter;		/**< Internal process counter */
 
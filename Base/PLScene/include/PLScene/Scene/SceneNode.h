@@ -343,6 +343,58 @@ class SceneNode : public PLCore::Object, public PLCore::Element<SceneNode> {
 		*/
 		PLS_API bool IsInitialized() const;
 
+		/**
+		*  @brief
+		*    Returns whether the scene node is anonymous or not
+		*
+		*  @return
+		*    'true' if the scene node is anonymous, else 'false'
+		*
+		*  @remarks
+		*    Anonymous scene nodes are created by "SceneContainer::Create<AType>()". They have no name, are not
+		*    registered within the name lookup of their scene container ("SceneContainer::GetByName()" can't find
+		*    them) and can't be renamed. This makes spawning them cheaper, which is useful for e.g. thousands of
+		*    projectiles nobody is going to look up by name.
+		*/
+		inline bool IsAnonymous() const;
+
+		/**
+		*  @brief
+		*    Returns whether the scene node is the hierarchical LOD proxy of a scene container or not
+		*
+		*  @return
+		*    'true' if the scene node is a hierarchical LOD proxy, else 'false'
+		*
+		*  @see
+		*    - SceneContainer::GetHLODProxyNode()
+		*/
+		inline bool IsHLODProxy() const;
+
+		/**
+		*  @brief
+		*    Recycles this scene node
+		*
+		*  @return
+		*    'true' if all went fine, else 'false' (protected or already destroyed scene node?)
+		*
+		*  @remarks
+		*    Works like "Delete()", but "SceneContext::Cleanup()" doesn't destroy the scene node. Instead, it's reset to
+		*    its default attribute values and put into a per class pool of the scene context. "SceneContainer::Create()"
+		*    reuses pooled scene nodes of the requested class, which avoids the allocation, construction and destruction
+		*    costs when frequently spawning and despawning scene nodes.
+		*
+		*  @note
+		*    - Only scene node classes implementing "ResetFunction()" are pooled, other scene nodes are destroyed just
+		*      like with "Delete()"
+		*    - The scene node handlers are detached at once, from their point of view the scene node is gone
+		*    - The scene node modifiers are destroyed when the scene node is reset
+		*    - Scene containers and scene nodes which are not within a scene context are just deleted
+		*
+		*  @see
+		*    - SceneContext::GetMaxNumOfRecycledSceneNodes()
+		*/
+		PLS_API bool Recycle();
+
 		/**
 		*  @brief
 		*    Returns whether the scene node is active or not
@@ -477,6 +529,22 @@ class SceneNode : public PLCore::Object, public PLCore::Element<SceneNode> {
 		*/
 		PLS_API void MoveTo(const PLMath::Vector3 &vPosition);
 
+		/**
+		*  @brief
+		*    Returns the transform matrix from 'scene node space' into 'root space'
+		*
+		*  @return
+		*    The transform matrix from 'scene node space' into 'root space' (see it as 'world space' :),
+		*    the reference is only valid until the scene graph is changed the next time
+		*
+		*  @remarks
+		*    The world matrices of the scene nodes are cached within their scene containers. Transform
+		*    changes mark the cached world matrix of the scene node and of all its children as dirty, a
+		*    dirty world matrix is recalculated when it's requested the next time or when the scene context
+		*    recalculates all dirty world matrices at the end of its update.
+		*/
+		PLS_API const PLMath::Matrix3x4 &GetWorldMatrix();
+
 		//[-------------------------------------------------------]
 		//[ Bounding volume                                       ]
 		//[-------------------------------------------------------]
@@ -940,6 +1008,24 @@ class SceneNode : public PLCore::Object, public PLCore::Element<SceneNode> {
 		*/
 		PLS_API virtual void DeInitFunction();
 
+		/**
+		*  @brief
+		*    This function is called when a recycled scene node gets reset so it can be reused
+		*
+		*  @return
+		*    'true' if the scene node was reset and can be pooled, else 'false' (the scene node is destroyed instead)
+		*
+		*  @remarks
+		*    When this function is called, the scene node modifiers are already destroyed and all attributes are set
+		*    to their default values. Scene nodes with internal state which is not described by attributes have to reset
+		*    this state within their implementation. The default implementation returns 'false', so only scene node
+		*    classes which explicitly support recycling are pooled.
+		*
+		*  @see
+		*    - Recycle()
+		*/
+		PLS_API virtual bool ResetFunction();
+
 		/**
 		*  @brief
 		*    Called when the scene node has been activated or deactivated
@@ -1035,7 +1121,9 @@ class SceneNode : public PLCore::Object, public PLCore::Element<SceneNode> {
 			ClassFog						   = 1<<10,	/**< Derived from 'SNFog' */
 			// Misc
 			Initialized						   = 1<<11,	/**< The scene node is initialized */
-			DestroyThis						   = 1<<12	/**< The scene node should be destroyed */
+			DestroyThis						   = 1<<12,	/**< The scene node should be destroyed */
+			Anonymous						   = 1<<13,	/**< The scene node has no name and is not within the name lookup of its scene container */
+			HLODProxyNode					   = 1<<14	/**< The scene node is the hierarchical LOD proxy of a scene container */
 		};
 
 
@@ -1055,6 +1143,18 @@ class SceneNode : public PLCore::Object, public PLCore::Element<SceneNode> {
 		*/
 		void DeInitSceneNode();
 
+		/**
+		*  @brief
+		*    Resets the recycled scene node so it can be reused
+		*
+		*  @return
+		*    'true' if the scene node was reset and can be pooled, else 'false' (see "ResetFunction()")
+		*
+		*  @note
+		*    - The scene node must not be within a scene container
+		*/
+		bool ResetSceneNode();
+
 		/**
 		*  @brief
 		*    Clones the given scene node
@@ -1088,6 +1188,13 @@ class SceneNode : public PLCore::Object, public PLCore::Element<SceneNode> {
 		*/
 		void HierarchyRefreshRequired();
 
+		/**
+		*  @brief
+		*    Call this function if the scene node transform was changed and the
+		*    cached world matrix of this scene node and its children need an update
+		*/
+		void WorldMatrixRefreshRequired();
+
 		/**
 		*  @brief
 		*    Called on position transform change
@@ -1132,6 +1239,7 @@ class SceneNode : public PLCore::Object, public PLCore::Element<SceneNode> {
 		PLMath::Sphere					  m_cContainerBoundingSphere;		/**< Current bounding sphere in 'scene container space'*/
 		PLCore::List<SceneNodeModifier*>  m_lstModifiers;					/**< List of scene node modifiers */
 		SceneHierarchyNodeItem			 *m_pFirstSceneHierarchyNodeItem;	/**< The first scene hierarchy node item, can be a null pointer */
+		PLCore::uint32					  m_nWorldMatrixIndex;				/**< Index of the cached world matrix within the scene container this scene node is in */
 
 
 	//[-------------------------------------------------------]
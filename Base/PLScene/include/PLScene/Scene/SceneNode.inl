@@ -100,6 +100,24 @@ inline bool SceneNode::IsFog() const
 	return ((m_nInternalFlags & ClassFog) != 0);
 }
 
+/**
+*  @brief
+*    Returns whether the scene node is anonymous or not
+*/
+inline bool SceneNode::IsAnonymous() const
+{
+	return ((m_nInternalFlags & Anonymous) != 0);
+}
+
+/**
+*  @brief
+*    Returns whether the scene node is the hierarchical LOD proxy of a scene container or not
+*/
+inline bool SceneNode::IsHLODProxy() const
+{
+	return ((m_nInternalFlags & HLODProxyNode) != 0);
+}
+
 /**
 *  @brief
 *    Adds a modifier
@@ -33,6 +33,14 @@
 #include "PLScene/Scene/SceneNode.h"
 
 
+//[-------------------------------------------------------]
+//[ Forward declarations                                  ]
+//[-------------------------------------------------------]
+namespace PLScene {
+	class SceneUpdateScheduler;
+}
+
+
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
 //[-------------------------------------------------------]
@@ -62,6 +70,7 @@ class SceneNodeModifier : public PLCore::Object {
 	//[ Friends                                               ]
 	//[-------------------------------------------------------]
 	friend class SceneNode;
+	friend class SceneUpdateScheduler;
 
 
 	//[-------------------------------------------------------]
@@ -83,6 +92,30 @@ class SceneNodeModifier : public PLCore::Object {
 			pl_enum_value(Automatic,	"This scene node modifier was created automatically during runtime and should not be saved with the scene. Such scene nodes modifiers may also be hidden for instance within a scene editor.")
 		pl_enum_end
 
+		/**
+		*  @brief
+		*    Scheduled update stages, see "SceneUpdateScheduler"
+		*/
+		enum EUpdateStage {
+			UpdateStageAnimation  = 0,	/**< Animations of the owner scene node, for example keyframe animations */
+			UpdateStageConstraint = 1,	/**< Constraints depending on the animation results, for example looking at another scene node */
+			UpdateStageLate		  = 2,	/**< Everything depending on the constraint results */
+			NumOfUpdateStages	  = 3	/**< Number of update stages */
+		};
+
+		/**
+		*  @brief
+		*    Data a scheduled update is accessing, see "SceneUpdateScheduler"
+		*/
+		enum EUpdateAccess {
+			ReadTransform	 = 1<<0,	/**< Reads the transform of the owner scene node */
+			WriteTransform	 = 1<<1,	/**< Writes the transform of the owner scene node */
+			ReadMeshHandler	 = 1<<2,	/**< Reads the mesh handler of the owner scene node */
+			WriteMeshHandler = 1<<3,	/**< Writes the mesh handler of the owner scene node */
+			ReadParent		 = 1<<4,	/**< Reads the parent scene container or other scene nodes, the update is performed on the main thread */
+			MainThread		 = 1<<5		/**< The update must be performed on the main thread, for example because events with connected event handlers are emitted */
+		};
+
 
 	//[-------------------------------------------------------]
 	//[ RTTI interface                                        ]
@@ -252,6 +285,61 @@ class SceneNodeModifier : public PLCore::Object {
 		*/
 		PLS_API virtual void OnActivate(bool bActivate);
 
+		/**
+		*  @brief
+		*    Returns the stage of the scheduled update
+		*
+		*  @return
+		*    The stage of the scheduled update
+		*
+		*  @note
+		*    - Only used if the scene node modifier was added to the update scheduler of the scene context
+		*    - The returned stage must not change while the scene node modifier is added to the update scheduler
+		*    - The default implementation returns "UpdateStageAnimation"
+		*/
+		PLS_API virtual EUpdateStage GetUpdateStage() const;
+
+		/**
+		*  @brief
+		*    Returns the data the scheduled update is accessing
+		*
+		*  @return
+		*    The data the scheduled update is accessing (see "EUpdateAccess")
+		*
+		*  @remarks
+		*    This function is called every scheduled update, so the result may depend on the current
+		*    settings of the scene node modifier.
+		*
+		*  @note
+		*    - The default implementation returns "MainThread"
+		*/
+		PLS_API virtual PLCore::uint32 GetUpdateAccess() const;
+
+		/**
+		*  @brief
+		*    Computes the scheduled update
+		*
+		*  @remarks
+		*    This function may be called from a worker thread, concurrent with the "OnUpdateCompute()" of other scene node
+		*    modifiers. Only the data declared by "GetUpdateAccess()" may be read (by using constant functions only), and the
+		*    result must be stored within the scene node modifier itself. Events must not be emitted and the scene node must
+		*    not be changed, this is done within "OnUpdateApply()".
+		*
+		*  @note
+		*    - The default implementation is empty
+		*/
+		PLS_API virtual void OnUpdateCompute();
+
+		/**
+		*  @brief
+		*    Applies the result of the scheduled update computation
+		*
+		*  @note
+		*    - Always called from the main thread after "OnUpdateCompute()"
+		*    - The default implementation is empty
+		*/
+		PLS_API virtual void OnUpdateApply();
+
 
 	//[-------------------------------------------------------]
 	//[ Protected functions                                   ]
@@ -277,8 +365,11 @@ class SceneNodeModifier : public PLCore::Object {
 	//[ Private data                                          ]
 	//[-------------------------------------------------------]
 	private:
-		PLCore::uint32  m_nFlags;		/**< Flags */
-		SceneNode	   *m_pSceneNode;	/**< Owner scene node (ALWAYS valid!) */
+		PLCore::uint32		  m_nFlags;				/**< Flags */
+		SceneNode			 *m_pSceneNode;			/**< Owner scene node (ALWAYS valid!) */
+		SceneUpdateScheduler *m_pUpdateScheduler;	/**< Update scheduler this scene node modifier is added to, can be a null pointer */
+		PLCore::uint32		  m_nUpdateStage;		/**< Stage of the scheduled update, only valid if "m_pUpdateScheduler" is set */
+		PLCore::uint32		  m_nUpdateIndex;		/**< Index within the update scheduler stage list, only valid if "m_pUpdateScheduler" is set */
 
 
 };
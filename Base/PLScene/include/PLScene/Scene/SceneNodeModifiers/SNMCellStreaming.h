@@ -0,0 +1,282 @@
+/*********************************************************\
+ *  File: SNMCellStreaming.h                             *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+#ifndef __PLSCENE_SCENENODEMODIFIER_CELLSTREAMING_H__
+#define __PLSCENE_SCENENODEMODIFIER_CELLSTREAMING_H__
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <PLCore/Container/Array.h>
+#include "PLScene/Scene/SceneNodeModifier.h"
+
+
+//[-------------------------------------------------------]
+//[ Forward declarations                                  ]
+//[-------------------------------------------------------]
+namespace PLCore {
+	class Mutex;
+	class Thread;
+	class Semaphore;
+}
+namespace PLScene {
+	class SCCell;
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace PLScene {
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Cell streaming scene node modifier class
+*
+*  @remarks
+*    Loads and unloads the streamed contents of cells (see "SCCell::StreamFilename") depending on the
+*    distance of the owner scene node, usually the camera. The distance to a cell is measured along the
+*    cell-portals, so cells the owner scene node can't reach through portals are never loaded.
+*
+*    Once a cell comes within "LoadDistance", the sub-scene file is read into memory by a background
+*    thread. The scene nodes are created on the main thread during one of the next updates because scene
+*    graph manipulations are not thread safe, at most "MaxLoadsPerUpdate" cells are instanced per update
+*    to avoid frame rate spikes. A cell is unloaded as soon as it's farther away than "UnloadDistance",
+*    the gap between both distances avoids that cells are loaded and unloaded over and over again when
+*    the owner scene node moves along the border.
+*
+*    The memory used by the streamed contents is estimated by the size of the sub-scene files. If loading
+*    a cell would exceed "MemoryBudget", the farthest cells are unloaded first. If this is not possible
+*    because all loaded cells are closer, the cell is not loaded until there's enough space.
+*
+*  @note
+*    - If a cell has a "MaxDrawDistance" below "LoadDistance", this distance is used as load distance of the
+*      cell instead, the hysteresis between loading and unloading stays the same
+*    - Cells are loaded into a child scene container, see "SCCell::GetStreamedContents()"
+*/
+class SNMCellStreaming : public SceneNodeModifier {
+
+
+	//[-------------------------------------------------------]
+	//[ RTTI interface                                        ]
+	//[-------------------------------------------------------]
+	pl_class_def(PLS_API)
+		// Attributes
+		pl_attribute_directvalue(LoadDistance,		float,			100.0f,		ReadWrite)
+		pl_attribute_directvalue(UnloadDistance,	float,			150.0f,		ReadWrite)
+		pl_attribute_directvalue(MemoryBudget,		PLCore::uint32,	67108864,	ReadWrite)
+		pl_attribute_directvalue(MaxLoadsPerUpdate,	PLCore::uint32,	1,			ReadWrite)
+		pl_attribute_getset		(SNMCellStreaming,	NumOfThreads,	PLCore::uint32,	1,	ReadWrite)
+		// Slots
+		pl_slot_0_def(SNMCellStreaming,	OnUpdate)
+	pl_class_def_end
+
+
+	//[-------------------------------------------------------]
+	//[ Public RTTI get/set functions                         ]
+	//[-------------------------------------------------------]
+	public:
+		PLS_API PLCore::uint32 GetNumOfThreads() const;
+		PLS_API void SetNumOfThreads(PLCore::uint32 nValue);
+
+
+	//[-------------------------------------------------------]
+	//[ Public functions                                      ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Constructor
+		*
+		*  @param[in] cSceneNode
+		*    Owner scene node
+		*/
+		PLS_API SNMCellStreaming(SceneNode &cSceneNode);
+
+		/**
+		*  @brief
+		*    Destructor
+		*/
+		PLS_API virtual ~SNMCellStreaming();
+
+		/**
+		*  @brief
+		*    Returns the number of cells with loaded streamed contents
+		*
+		*  @return
+		*    The number of cells with loaded streamed contents
+		*/
+		PLS_API PLCore::uint32 GetNumOfLoadedCells() const;
+
+		/**
+		*  @brief
+		*    Returns the number of cells which are currently read in the background or waiting to be instanced
+		*
+		*  @return
+		*    The number of cells which are currently loading
+		*/
+		PLS_API PLCore::uint32 GetNumOfLoadingCells() const;
+
+		/**
+		*  @brief
+		*    Returns the estimated memory used by the streamed contents
+		*
+		*  @return
+		*    The estimated memory in bytes used by the loaded and loading cells, never above "MemoryBudget"
+		*/
+		PLS_API PLCore::uint32 GetMemoryUsage() const;
+
+
+	//[-------------------------------------------------------]
+	//[ Protected virtual SceneNodeModifier functions         ]
+	//[-------------------------------------------------------]
+	protected:
+		PLS_API virtual void OnActivate(bool bActivate) override;
+
+
+	//[-------------------------------------------------------]
+	//[ Private static functions                              ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Background thread function reading the requested sub-scene files into memory
+		*
+		*  @param[in] pData
+		*    Cell streaming scene node modifier instance, must be valid
+		*
+		*  @return
+		*    Thread exit code, always 0
+		*/
+		static int ReadThreadFunction(void *pData);
+
+
+	//[-------------------------------------------------------]
+	//[ Private structures                                    ]
+	//[-------------------------------------------------------]
+	private:
+		struct CellEntry;
+
+
+	//[-------------------------------------------------------]
+	//[ Private functions                                     ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Called when the scene node modifier needs to be updated
+		*/
+		void OnUpdate();
+
+		/**
+		*  @brief
+		*    Starts the background threads
+		*/
+		void StartThreads();
+
+		/**
+		*  @brief
+		*    Stops the background threads
+		*
+		*  @note
+		*    - Blocks until the currently read sub-scene files are read
+		*/
+		void StopThreads();
+
+		/**
+		*  @brief
+		*    Updates the portal distances of all cells within reach
+		*
+		*  @param[out] lstCells
+		*    Receives the reachable cells with a stream filename, the list is not cleared before
+		*  @param[out] lstDistances
+		*    Receives the portal distance of each reachable cell, the list is not cleared before
+		*/
+		void UpdateDistances(PLCore::Array<SCCell*> &lstCells, PLCore::Array<float> &lstDistances);
+
+		/**
+		*  @brief
+		*    Unloads a cell, or cancels its loading
+		*
+		*  @param[in] nEntry
+		*    Index of the cell within "m_lstCells"
+		*/
+		void Unload(PLCore::uint32 nEntry);
+
+		/**
+		*  @brief
+		*    Removes a cell entry which is neither queued nor read by a background thread
+		*
+		*  @param[in] nEntry
+		*    Index of the cell within "m_lstCells"
+		*/
+		void RemoveEntry(PLCore::uint32 nEntry);
+
+		/**
+		*  @brief
+		*    Returns the unload distance of a cell
+		*
+		*  @param[in] cCell
+		*    Cell to return the unload distance of
+		*  @param[out] fLoadDistance
+		*    Receives the load distance of the cell
+		*
+		*  @return
+		*    The unload distance of the cell
+		*/
+		float GetCellDistances(const SCCell &cCell, float &fLoadDistance) const;
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		PLCore::uint32					m_nNumOfThreads;	/**< Number of background threads, 0 to read on the main thread */
+		PLCore::Array<CellEntry*>		m_lstCells;			/**< Cells which are loaded or loading, only accessed by the main thread */
+		PLCore::uint32					m_nMemoryUsage;		/**< Estimated memory in bytes used by the cells within "m_lstCells" */
+		PLCore::Array<PLCore::Thread*>	m_lstThreads;		/**< Background threads */
+		PLCore::Mutex				   *m_pMutex;			/**< Mutex guarding the data shared with the background threads (always valid!) */
+		PLCore::Semaphore			   *m_pSemaphore;		/**< Semaphore counting the requests for the background threads (always valid!) */
+		// Shared with the background threads
+		PLCore::Array<CellEntry*>		m_lstQueue;			/**< Cells waiting to be read */
+		PLCore::Array<CellEntry*>		m_lstRead;			/**< Cells which have been read */
+		bool							m_bShutdown;		/**< Shall the background threads stop? */
+
+
+};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // PLScene
+
+
+#endif // __PLSCENE_SCENENODEMODIFIER_CELLSTREAMING_H__
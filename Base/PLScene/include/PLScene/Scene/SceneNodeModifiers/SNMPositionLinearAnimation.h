@@ -30,7 +30,6 @@
 //[-------------------------------------------------------]
 //[ Includes                                              ]
 //[-------------------------------------------------------]
-#include <PLCore/Base/Event/EventHandler.h>
 #include <PLMath/Vector3.h>
 #include "PLScene/Scene/SceneNodeModifiers/SNMTransform.h"
 
@@ -112,24 +111,17 @@ class SNMPositionLinearAnimation : public SNMTransform {
 	//[-------------------------------------------------------]
 	protected:
 		PLS_API virtual void OnActivate(bool bActivate) override;
+		PLS_API virtual PLCore::uint32 GetUpdateAccess() const override;
+		PLS_API virtual void OnUpdateCompute() override;
+		PLS_API virtual void OnUpdateApply() override;
 
 
 	//[-------------------------------------------------------]
-	//[ Private functions                                     ]
+	//[ Private data                                          ]
 	//[-------------------------------------------------------]
 	private:
-		/**
-		*  @brief
-		*    Called when the scene node modifier needs to be updated
-		*/
-		void OnUpdate();
-
-
-	//[-------------------------------------------------------]
-	//[ Private event handlers                                ]
-	//[-------------------------------------------------------]
-	private:
-		PLCore::EventHandler<> EventHandlerUpdate;
+		PLMath::Vector3 m_vPosition;	/**< Computed position */
+		bool			m_bApply;		/**< Apply the computed position? */
 
 
 };
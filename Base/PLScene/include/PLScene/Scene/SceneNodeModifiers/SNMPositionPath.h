@@ -31,6 +31,7 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include <PLCore/Base/Event/EventHandler.h>
+#include <PLMath/Vector3.h>
 #include "PLScene/Scene/SceneNodeModifiers/SNMTransform.h"
 
 
@@ -159,18 +160,15 @@ class SNMPositionPath : public SNMTransform {
 	//[-------------------------------------------------------]
 	protected:
 		PLS_API virtual void OnActivate(bool bActivate) override;
+		PLS_API virtual PLCore::uint32 GetUpdateAccess() const override;
+		PLS_API virtual void OnUpdateCompute() override;
+		PLS_API virtual void OnUpdateApply() override;
 
 
 	//[-------------------------------------------------------]
 	//[ Private functions                                     ]
 	//[-------------------------------------------------------]
 	private:
-		/**
-		*  @brief
-		*    Called when the scene node modifier needs to be updated
-		*/
-		void OnUpdate();
-
 		/**
 		*  @brief
 		*    Called on scene node debug draw
@@ -187,7 +185,6 @@ class SNMPositionPath : public SNMTransform {
 	//[ Private event handlers                                ]
 	//[-------------------------------------------------------]
 	private:
-		PLCore::EventHandler<>										  EventHandlerUpdate;
 		PLCore::EventHandler<PLRenderer::Renderer &, const VisNode *> EventHandlerDrawDebug;
 
 
@@ -202,7 +199,9 @@ class SNMPositionPath : public SNMTransform {
 		PLCore::uint32 m_nInterpolation;
 
 		// Private data
-		PLMath::GraphPathHandler *m_pPathHandler; /**< Our path (ALWAYS valid!) */
+		PLMath::GraphPathHandler *m_pPathHandler;	/**< Our path (ALWAYS valid!) */
+		PLMath::Vector3			  m_vPosition;		/**< Computed position */
+		bool					  m_bApply;			/**< Apply the computed position? */
 
 
 };
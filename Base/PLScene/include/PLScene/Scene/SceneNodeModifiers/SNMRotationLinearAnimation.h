@@ -30,8 +30,8 @@
 //[-------------------------------------------------------]
 //[ Includes                                              ]
 //[-------------------------------------------------------]
-#include <PLCore/Base/Event/EventHandler.h>
 #include <PLMath/Vector3.h>
+#include <PLMath/Quaternion.h>
 #include "PLScene/Scene/SceneNodeModifiers/SNMTransform.h"
 
 
@@ -88,24 +88,17 @@ class SNMRotationLinearAnimation : public SNMTransform {
 	//[-------------------------------------------------------]
 	protected:
 		PLS_API virtual void OnActivate(bool bActivate) override;
+		PLS_API virtual PLCore::uint32 GetUpdateAccess() const override;
+		PLS_API virtual void OnUpdateCompute() override;
+		PLS_API virtual void OnUpdateApply() override;
 
 
 	//[-------------------------------------------------------]
-	//[ Private functions                                     ]
+	//[ Private data                                          ]
 	//[-------------------------------------------------------]
 	private:
-		/**
-		*  @brief
-		*    Called when the scene node modifier needs to be updated
-		*/
-		void OnUpdate();
-
-
-	//[-------------------------------------------------------]
-	//[ Private event handlers                                ]
-	//[-------------------------------------------------------]
-	private:
-		PLCore::EventHandler<> EventHandlerUpdate;
+		PLMath::Quaternion m_qRotation;	/**< Computed rotation */
+		bool			   m_bApply;	/**< Apply the computed rotation? */
 
 
 };
@@ -79,6 +79,13 @@ class SNHelper : public SceneNode {
 		PLS_API virtual ~SNHelper();
 
 
+	//[-------------------------------------------------------]
+	//[ Protected virtual SceneNode functions                 ]
+	//[-------------------------------------------------------]
+	protected:
+		PLS_API virtual bool ResetFunction() override;
+
+
 };
 
 
@@ -284,6 +284,7 @@ class SNMesh : public SceneNode {
 	//[-------------------------------------------------------]
 	protected:
 		PLS_API virtual void DeInitFunction() override;
+		PLS_API virtual bool ResetFunction() override;
 
 
 };
@@ -60,6 +60,9 @@ class SceneHierarchyNode;
 *    child scene containers, a new axis aligned bounding box in this container space is calculated
 *    automatically. As result, even scene nodes which are not inside the 'original' intersection volume
 *    may be within this transformed volume.
+*
+*  @note
+*    - The result distance (see "SetResultBuffer()") is the distance between the centers of the axis aligned bounding boxes
 */
 class SQAABoundingBox : public SceneQuery {
 
@@ -57,6 +57,10 @@ class SceneHierarchyNode;
 *  @remarks
 *    This line test scene query will enumerate all scene nodes intersecting the
 *    given line.
+*
+*  @note
+*    - The result distance (see "SetResultBuffer()") is the distance from the line start to the scene node axis
+*      aligned bounding box, 0 if the line starts inside the axis aligned bounding box
 */
 class SQLine : public SceneQuery {
 
@@ -56,6 +56,9 @@ class SceneHierarchyNode;
 *  @remarks
 *    This plane set volume test scene query will enumerate all
 *    scene nodes within the given plane set.
+*
+*  @note
+*    - There's no result distance (see "SetResultBuffer()"), it's always 0
 */
 class SQPlaneSet : public SceneQuery {
 
@@ -56,6 +56,10 @@ class SceneHierarchyNode;
 *  @remarks
 *    This point test scene query will enumerate all scene nodes intersecting the
 *    given point.
+*
+*  @note
+*    - The result distance (see "SetResultBuffer()") is the distance between the point and the center of the
+*      scene node axis aligned bounding box
 */
 class SQPoint : public SceneQuery {
 
@@ -35,15 +35,22 @@
 
 
 //[-------------------------------------------------------]
-//[ Namespace                                             ]
+//[ Forward declarations                                  ]
 //[-------------------------------------------------------]
+namespace PLCore {
+	class Mutex;
+	class Semaphore;
+}
 namespace PLScene {
+	class SceneContainer;
+	class SceneHierarchyNode;
+}
 
 
 //[-------------------------------------------------------]
-//[ Forward declarations                                  ]
+//[ Namespace                                             ]
 //[-------------------------------------------------------]
-class SceneHierarchyNode;
+namespace PLScene {
 
 
 //[-------------------------------------------------------]
@@ -60,6 +67,13 @@ class SceneHierarchyNode;
 *    child scene containers, a new sphere in this container space is calculated automatically.
 *    As result, even scene nodes which are not inside the 'original' intersection volume may be
 *    within this transformed volume.
+*
+*    "PerformQueries()" performs many sphere queries (for example the sensors of hundreds of AI
+*    agents) within one traversal of the scene hierarchy and writes the results into arrays.
+*
+*  @note
+*    - The result distance (see "SetResultBuffer()") is the distance between the sphere center and the center
+*      of the scene node axis aligned bounding box
 */
 class SQSphere : public SceneQuery {
 
@@ -96,11 +110,155 @@ class SQSphere : public SceneQuery {
 		*/
 		PLS_API PLMath::Sphere &GetSphere();
 
+		/**
+		*  @brief
+		*    Performs many sphere queries within one traversal of the scene hierarchy
+		*
+		*  @param[in]  pSpheres
+		*    Spheres to query with, must be valid if "nNumOfSpheres" is not 0
+		*  @param[in]  nNumOfSpheres
+		*    Number of spheres to query with
+		*  @param[out] lstSceneNodes
+		*    Receives the found scene nodes of all spheres, the array is reset first
+		*  @param[out] lstFirstSceneNode
+		*    Receives "nNumOfSpheres+1" indices, the scene nodes found by sphere i are "lstSceneNodes[lstFirstSceneNode[i]]" up to
+		*    (excluding) "lstSceneNodes[lstFirstSceneNode[i+1]]", the array is reset first
+		*  @param[out] plstDistances
+		*    If not a null pointer, receives the result distance of each found scene node (see class remarks), the array is reset first
+		*  @param[in]  nNumOfThreads
+		*    Maximum number of threads to use, 0 for one thread per processor
+		*
+		*  @return
+		*    'true' if all went fine, else 'false' (there's no scene hierarchy)
+		*
+		*  @remarks
+		*    Each scene hierarchy node is only tested against the spheres which are intersecting its parent, so one traversal
+		*    replaces "nNumOfSpheres" calls of "PerformQuery()". When using multiple threads, the spheres are split into one
+		*    block per thread and each thread traverses the scene hierarchy for its block of spheres. The worker threads and
+		*    their buffers are created on first use and are kept alive until the query is destroyed.
+		*
+		*  @note
+		*    - The sphere of this query is not used, the "Recursive" flag is taken into account
+		*    - "SignalSceneNode" is not emitted, the found scene nodes are not touched and the query can't be stopped
+		*    - The order of the scene nodes found by one sphere is undefined
+		*    - When using multiple threads, the scene hierarchies and scene node bounding boxes are updated by the calling
+		*      thread first - the scene must not be changed while this function is running
+		*    - Must not be called by multiple threads at the same time for the same query
+		*/
+		PLS_API bool PerformQueries(const PLMath::Sphere *pSpheres, PLCore::uint32 nNumOfSpheres, PLCore::Array<SceneNode*> &lstSceneNodes,
+									PLCore::Array<PLCore::uint32> &lstFirstSceneNode, PLCore::Array<float> *plstDistances = nullptr, PLCore::uint32 nNumOfThreads = 1);
+
+
+	//[-------------------------------------------------------]
+	//[ Private definitions                                   ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Batch job of "PerformQueries()", one per thread
+		*/
+		struct BatchJob;
+
+
+	//[-------------------------------------------------------]
+	//[ Private static functions                              ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Updates the lazily updated states of the scene used by "PerformQueries()"
+		*
+		*  @param[in]      cContainer
+		*    Scene container to update
+		*  @param[in]      bRecursive
+		*    Take sub scene containers and cells into account?
+		*  @param[in, out] lstContainers
+		*    Already updated scene containers
+		*/
+		static void PrepareQueries(SceneContainer &cContainer, bool bRecursive, PLCore::Array<SceneContainer*> &lstContainers);
+
+		/**
+		*  @brief
+		*    Recursive part of "PerformQueries()"
+		*
+		*  @param[in, out] sJob
+		*    Batch job to work on
+		*  @param[in]      cHierarchyNode
+		*    Current scene hierarchy node we work on
+		*  @param[in]      pSpheres
+		*    Spheres of the batch job within the space of the current scene container, always valid
+		*  @param[in]      nFirstActive
+		*    Index of the first active sphere index within the active sphere stack of the batch job
+		*  @param[in]      nNumOfActive
+		*    Number of active spheres
+		*/
+		static void PerformQueriesRec(BatchJob &sJob, SceneHierarchyNode &cHierarchyNode, const PLMath::Sphere *pSpheres, PLCore::uint32 nFirstActive, PLCore::uint32 nNumOfActive);
+
+		/**
+		*  @brief
+		*    Performs the sphere queries of a batch job
+		*
+		*  @param[in, out] sJob
+		*    Batch job to work on
+		*/
+		static void PerformBatchJob(BatchJob &sJob);
+
+		/**
+		*  @brief
+		*    Static worker thread function performing the sphere queries of the batch jobs it was given
+		*
+		*  @param[in] pData
+		*    Batch job of the worker thread, always valid
+		*
+		*  @return
+		*    Thread exit code
+		*/
+		static int WorkerThreadFunction(void *pData);
+
 
 	//[-------------------------------------------------------]
 	//[ Private functions                                     ]
 	//[-------------------------------------------------------]
 	private:
+		/**
+		*  @brief
+		*    Copy constructor
+		*
+		*  @param[in] cSource
+		*    Source to copy from
+		*/
+		SQSphere(const SQSphere &cSource);
+
+		/**
+		*  @brief
+		*    Copy operator
+		*
+		*  @param[in] cSource
+		*    Source to copy from
+		*
+		*  @return
+		*    Reference to this instance
+		*/
+		SQSphere &operator =(const SQSphere &cSource);
+
+		/**
+		*  @brief
+		*    Creates batch jobs until there are the requested number of batch jobs
+		*
+		*  @param[in] nNumOfBatchJobs
+		*    Requested number of batch jobs, the first one is processed by the calling thread, each other one has its own worker thread
+		*
+		*  @return
+		*    The number of available batch jobs, can be less than requested if a worker thread couldn't be started
+		*/
+		PLCore::uint32 CreateBatchJobs(PLCore::uint32 nNumOfBatchJobs);
+
+		/**
+		*  @brief
+		*    Stops all worker threads and destroys all batch jobs
+		*/
+		void DestroyBatchJobs();
+
 		/**
 		*  @brief
 		*    Recursive part of PerformQuery()
@@ -118,7 +276,11 @@ class SQSphere : public SceneQuery {
 	//[ Private data                                          ]
 	//[-------------------------------------------------------]
 	private:
-		PLMath::Sphere m_cSphere;	/**< Sphere used for the query */
+		PLMath::Sphere			 m_cSphere;			/**< Sphere used for the query */
+		PLCore::Array<BatchJob*> m_lstBatchJobs;	/**< Batch jobs of "PerformQueries()" kept over calls, the first one is processed by the calling thread */
+		PLCore::Semaphore		*m_pDoneSemaphore;	/**< Semaphore signaled by a worker thread when its batch job is done, can be a null pointer */
+		PLCore::Mutex			*m_pMutex;			/**< Mutex guarding "m_bShutdown", can be a null pointer */
+		bool					 m_bShutdown;		/**< Shall the worker threads stop? Guarded by "m_pMutex" */
 
 
 	//[-------------------------------------------------------]
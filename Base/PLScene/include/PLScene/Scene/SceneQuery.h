@@ -32,6 +32,7 @@
 //[-------------------------------------------------------]
 #include <PLCore/Base/Object.h>
 #include <PLCore/Base/Event/Event.h>
+#include <PLCore/Container/Array.h>
 #include <PLCore/Container/Element.h>
 #include <PLCore/Container/ElementHandler.h>
 #include <PLCore/Container/ElementManager.h>
@@ -65,6 +66,11 @@ class SceneContainer;
 *    rendering the scene. This process can be quite efficient if the scene
 *    container provides a good scene hierarchy. Events will inform about the results.
 *
+*    Many users of scene queries just collect the found scene nodes within a list. If a result
+*    buffer is set (see "SetResultBuffer()"), the found scene nodes are appended to the given
+*    array instead of emitting "SignalSceneNode" for each of them, this way there's no event
+*    handler call per found scene node.
+*
 *  @note
 *    - Derived classes should use a 'SQ'-prefix (example: SQLine)
 */
@@ -147,6 +153,39 @@ class SceneQuery : public PLCore::Object, public PLCore::Element<SceneQuery> {
 		*/
 		inline void Stop();
 
+		/**
+		*  @brief
+		*    Sets the result buffer
+		*
+		*  @param[in] plstSceneNodes
+		*    Array the found scene nodes are appended to, a null pointer to emit "SignalSceneNode" for each found scene node instead (default)
+		*  @param[in] plstDistances
+		*    Optional array a query specific distance of each found scene node is appended to (see the query class), can be a null pointer,
+		*    ignored if "plstSceneNodes" is a null pointer
+		*
+		*  @note
+		*    - The given arrays are not reset by the query, they must stay valid as long as they're set
+		*/
+		PLS_API void SetResultBuffer(PLCore::Array<SceneNode*> *plstSceneNodes, PLCore::Array<float> *plstDistances = nullptr);
+
+		/**
+		*  @brief
+		*    Returns the array the found scene nodes are appended to
+		*
+		*  @return
+		*    The array the found scene nodes are appended to, a null pointer if "SignalSceneNode" is emitted instead
+		*/
+		inline PLCore::Array<SceneNode*> *GetResultSceneNodes() const;
+
+		/**
+		*  @brief
+		*    Returns the array the distances of the found scene nodes are appended to
+		*
+		*  @return
+		*    The array the distances of the found scene nodes are appended to, can be a null pointer
+		*/
+		inline PLCore::Array<float> *GetResultDistances() const;
+
 
 	//[-------------------------------------------------------]
 	//[ Public virtual SceneQuery functions                   ]
@@ -183,12 +222,28 @@ class SceneQuery : public PLCore::Object, public PLCore::Element<SceneQuery> {
 		*/
 		PLS_API virtual ~SceneQuery();
 
+		/**
+		*  @brief
+		*    Reports a found scene node
+		*
+		*  @param[in] cSceneNode
+		*    Found scene node
+		*  @param[in] fDistance
+		*    Query specific distance of the found scene node, only used if "m_plstResultDistances" is not a null pointer
+		*
+		*  @remarks
+		*    Appends the scene node to the result buffer if there's one, else "SignalSceneNode" is emitted.
+		*/
+		inline void AddResult(SceneNode &cSceneNode, float fDistance = 0.0f);
+
 
 	//[-------------------------------------------------------]
 	//[ Protected data                                        ]
 	//[-------------------------------------------------------]
 	protected:
-		PLCore::uint32 m_nFlags;	/**< Flags (see EFlags) */
+		PLCore::uint32			   m_nFlags;				/**< Flags (see EFlags) */
+		PLCore::Array<SceneNode*> *m_plstResultSceneNodes;	/**< Array the found scene nodes are appended to, can be a null pointer */
+		PLCore::Array<float>	  *m_plstResultDistances;	/**< Array the distances of the found scene nodes are appended to, can be a null pointer */
 
 
 	//[-------------------------------------------------------]
@@ -68,6 +68,52 @@ inline void SceneQuery::Stop()
 	m_nFlags |= StopQuery;
 }
 
+/**
+*  @brief
+*    Returns the array the found scene nodes are appended to
+*/
+inline PLCore::Array<SceneNode*> *SceneQuery::GetResultSceneNodes() const
+{
+	return m_plstResultSceneNodes;
+}
+
+/**
+*  @brief
+*    Returns the array the distances of the found scene nodes are appended to
+*/
+inline PLCore::Array<float> *SceneQuery::GetResultDistances() const
+{
+	return m_plstResultDistances;
+}
+
+
+//[-------------------------------------------------------]
+//[ Protected functions                                   ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Reports a found scene node
+*/
+inline void SceneQuery::AddResult(SceneNode &cSceneNode, float fDistance)
+{
+	if (m_plstResultSceneNodes) {
+		// The number of slots is doubled to avoid frequent reallocations
+		const PLCore::uint32 nNumOfElements = m_plstResultSceneNodes->GetNumOfElements();
+		if (nNumOfElements == m_plstResultSceneNodes->GetMaxNumOfElements())
+			m_plstResultSceneNodes->Resize((nNumOfElements < 32) ? 64 : nNumOfElements*2, false);
+		m_plstResultSceneNodes->Add(&cSceneNode);
+		if (m_plstResultDistances) {
+			const PLCore::uint32 nNumOfDistances = m_plstResultDistances->GetNumOfElements();
+			if (nNumOfDistances == m_plstResultDistances->GetMaxNumOfElements())
+				m_plstResultDistances->Resize((nNumOfDistances < 32) ? 64 : nNumOfDistances*2, false);
+			m_plstResultDistances->Add(fDistance);
+		}
+	} else {
+		// Emit signal
+		SignalSceneNode(*this, cSceneNode);
+	}
+}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
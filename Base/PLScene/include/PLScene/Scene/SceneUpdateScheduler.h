@@ -0,0 +1,303 @@
+/*********************************************************\
+ *  File: SceneUpdateScheduler.h                         *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+
+
+#ifndef __PLSCENE_SCENEUPDATESCHEDULER_H__
+#define __PLSCENE_SCENEUPDATESCHEDULER_H__
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <PLCore/Container/Array.h>
+#include "PLScene/Scene/SceneNodeModifier.h"
+
+
+//[-------------------------------------------------------]
+//[ Forward declarations                                  ]
+//[-------------------------------------------------------]
+namespace PLCore {
+	class Mutex;
+	class Semaphore;
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace PLScene {
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Scene update scheduler
+*
+*  @remarks
+*    Scene node modifiers connecting to "SceneContext::EventUpdate" are updated one after another on the main thread.
+*    Scene node modifiers added to the update scheduler instead declare the stage they are updated in and the data they
+*    are accessing (see "SceneNodeModifier::GetUpdateStage()" and "SceneNodeModifier::GetUpdateAccess()"). The stages
+*    are updated one after another. Within a stage, the update computations ("SceneNodeModifier::OnUpdateCompute()") of
+*    all scene node modifiers which are only accessing their owner scene node are performed concurrently on worker threads,
+*    then the results are applied on the main thread ("SceneNodeModifier::OnUpdateApply()") in the order the scene node
+*    modifiers were added. After this, the scene node modifiers which have to be updated on the main thread - because
+*    they are reading other scene nodes, are emitting events or are conflicting with another scene node modifier of
+*    the same scene node within the same stage - are updated in the order they were added.
+*
+*  @note
+*    - The scheduled update is performed by "SceneContext::Update()" before "SceneContext::EventUpdate" is emitted
+*    - The worker threads are created on first use and are kept alive until the update scheduler is destroyed or
+*      the number of threads is changed
+*/
+class SceneUpdateScheduler {
+
+
+	//[-------------------------------------------------------]
+	//[ Friends                                               ]
+	//[-------------------------------------------------------]
+	friend class SceneContext;
+
+
+	//[-------------------------------------------------------]
+	//[ Public functions                                      ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Adds a scene node modifier
+		*
+		*  @param[in] cModifier
+		*    Scene node modifier to add, nothing happens if it's already added
+		*
+		*  @note
+		*    - The scene node modifier is removed automatically when it's destroyed
+		*/
+		PLS_API void Add(SceneNodeModifier &cModifier);
+
+		/**
+		*  @brief
+		*    Removes a scene node modifier
+		*
+		*  @param[in] cModifier
+		*    Scene node modifier to remove, nothing happens if it's not added
+		*/
+		PLS_API void Remove(SceneNodeModifier &cModifier);
+
+		/**
+		*  @brief
+		*    Returns the number of added scene node modifiers
+		*
+		*  @return
+		*    The number of added scene node modifiers
+		*/
+		PLS_API PLCore::uint32 GetNumOfModifiers() const;
+
+		/**
+		*  @brief
+		*    Returns the maximum number of threads to use
+		*
+		*  @return
+		*    The maximum number of threads to use, 0 for one thread per processor
+		*/
+		PLS_API PLCore::uint32 GetNumOfThreads() const;
+
+		/**
+		*  @brief
+		*    Sets the maximum number of threads to use
+		*
+		*  @param[in] nNumOfThreads
+		*    The maximum number of threads to use (including the main thread), 0 for one thread per processor
+		*/
+		PLS_API void SetNumOfThreads(PLCore::uint32 nNumOfThreads = 0);
+
+		/**
+		*  @brief
+		*    Returns the number of scene node modifiers computed on worker threads during the last update
+		*
+		*  @return
+		*    The number of scene node modifiers computed concurrently during the last update
+		*/
+		PLS_API PLCore::uint32 GetNumOfConcurrentUpdates() const;
+
+		/**
+		*  @brief
+		*    Returns the number of scene node modifiers updated on the main thread during the last update
+		*
+		*  @return
+		*    The number of scene node modifiers updated on the main thread during the last update
+		*/
+		PLS_API PLCore::uint32 GetNumOfMainThreadUpdates() const;
+
+		/**
+		*  @brief
+		*    Performs the scheduled update of all added scene node modifiers
+		*
+		*  @note
+		*    - Must be called from the main thread
+		*    - Normally called automatically by "SceneContext::Update()"
+		*/
+		PLS_API void Update();
+
+
+	//[-------------------------------------------------------]
+	//[ Private definitions                                   ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Persistent worker thread
+		*/
+		struct WorkerThread;
+
+
+	//[-------------------------------------------------------]
+	//[ Private functions                                     ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Constructor
+		*/
+		SceneUpdateScheduler();
+
+		/**
+		*  @brief
+		*    Destructor
+		*/
+		~SceneUpdateScheduler();
+
+		/**
+		*  @brief
+		*    Copy constructor
+		*
+		*  @param[in] cSource
+		*    Source to copy from
+		*/
+		SceneUpdateScheduler(const SceneUpdateScheduler &cSource);
+
+		/**
+		*  @brief
+		*    Copy operator
+		*
+		*  @param[in] cSource
+		*    Source to copy from
+		*
+		*  @return
+		*    Reference to this instance
+		*/
+		SceneUpdateScheduler &operator =(const SceneUpdateScheduler &cSource);
+
+		/**
+		*  @brief
+		*    Removes the cleared slots of removed scene node modifiers from the stage lists
+		*/
+		void Compact();
+
+		/**
+		*  @brief
+		*    Returns whether or not a scene node modifier can be computed on a worker thread
+		*
+		*  @param[in] cModifier
+		*    Scene node modifier to check
+		*  @param[in] nAccess
+		*    The data the scene node modifier is accessing
+		*
+		*  @return
+		*    'true' if the scene node modifier can be computed on a worker thread, else 'false'
+		*/
+		bool IsConcurrent(const SceneNodeModifier &cModifier, PLCore::uint32 nAccess) const;
+
+		/**
+		*  @brief
+		*    Computes the updates of a list of scene node modifiers by using multiple threads
+		*
+		*  @param[in] lstModifiers
+		*    Scene node modifiers to compute
+		*/
+		void Compute(PLCore::Array<SceneNodeModifier*> &lstModifiers);
+
+		/**
+		*  @brief
+		*    Creates worker threads until there are the requested number of worker threads
+		*
+		*  @param[in] nNumOfWorkerThreads
+		*    Requested number of worker threads
+		*
+		*  @return
+		*    The number of available worker threads, can be less than requested if a thread couldn't be started
+		*/
+		PLCore::uint32 CreateWorkerThreads(PLCore::uint32 nNumOfWorkerThreads);
+
+		/**
+		*  @brief
+		*    Stops and destroys all worker threads
+		*/
+		void DestroyWorkerThreads();
+
+		/**
+		*  @brief
+		*    Static worker thread function computing the updates of the range of scene node modifiers it was given
+		*
+		*  @param[in] pData
+		*    Worker thread, always valid
+		*
+		*  @return
+		*    Thread exit code
+		*/
+		static int WorkerThreadFunction(void *pData);
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		PLCore::Array<SceneNodeModifier*> m_lstModifiers[SceneNodeModifier::NumOfUpdateStages];	/**< Added scene node modifiers per stage in the order they were added, cleared slots are null pointers */
+		PLCore::Array<SceneNodeModifier*> m_lstConcurrent;		/**< Scene node modifiers of the current stage computed on worker threads */
+		PLCore::Array<SceneNodeModifier*> m_lstMainThread;		/**< Scene node modifiers of the current stage updated on the main thread */
+		PLCore::uint32					  m_nNumOfModifiers;	/**< Number of added scene node modifiers */
+		PLCore::uint32					  m_nNumOfThreads;		/**< Maximum number of threads to use, 0 for one thread per processor */
+		PLCore::uint32					  m_nNumOfRemovedSlots;	/**< Number of cleared slots within the stage lists */
+		bool							  m_bUpdating;			/**< Is there currently an update running? */
+		PLCore::uint32					  m_nNumOfConcurrentUpdates;	/**< Number of scene node modifiers computed concurrently during the last update */
+		PLCore::uint32					  m_nNumOfMainThreadUpdates;	/**< Number of scene node modifiers updated on the main thread during the last update */
+		PLCore::Array<WorkerThread*>	  m_lstWorkerThreads;	/**< Persistent worker threads, the main thread computes the first block itself */
+		PLCore::Semaphore				 *m_pDoneSemaphore;		/**< Semaphore signaled by a worker thread when its block is computed (always valid!) */
+		PLCore::Mutex					 *m_pMutex;			/**< Mutex guarding "m_bShutdown" (always valid!) */
+		bool							  m_bShutdown;			/**< Shall the worker threads stop? Guarded by "m_pMutex" */
+
+
+};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // PLScene
+
+
+#endif // __PLSCENE_SCENEUPDATESCHEDULER_H__
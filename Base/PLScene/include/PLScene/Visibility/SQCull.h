@@ -52,6 +52,7 @@ namespace PLScene {
 	class SceneNodeHandler;
 	class SceneQueryHandler;
 	class SceneHierarchyNode;
+	class SoftwareOcclusionBuffer;
 }
 
 
@@ -101,7 +102,8 @@ class SQCull : public SceneQuery {
 			Frustum     = 0,	/**< Culls the scene with view frustum culling only */
 			StopAndWait = 1,	/**< Culls the scene with the hierarchical stop and wait algorithm */
 			Coherent    = 2,	/**< Culls the scene with the coherent hierarchical algorithm (CHC) */
-			Previous    = 3		/**< Culls the scene using the visibility information of the previous frame */
+			Previous    = 3,	/**< Culls the scene using the visibility information of the previous frame */
+			Software    = 4		/**< Culls the scene with view frustum culling and a software occlusion buffer occluders are rasterized into on the CPU */
 		};
 
 
@@ -121,15 +123,19 @@ class SQCull : public SceneQuery {
 		*    Several statistics of the culling process
 		*/
 		struct Statistics {
-			PLCore::uint64 nCullTime;							/**< Culling time of the specified algorithm (in ms) */
+			PLCore::uint64 nCullTime;							/**< Culling time of the specified algorithm (in microseconds) */
 			PLCore::uint32 nNumOfTraversedNodes;				/**< Number of traversed nodes */
 			PLCore::uint32 nNumOfOccluders;						/**< Number of used occludes */
-			PLCore::uint32 nNumOfQueryCulledNodes;				/**< Number of hierarchy nodes culled by the occlusion query */
+			PLCore::uint32 nNumOfQueryCulledNodes;				/**< Number of hierarchy nodes culled by the occlusion query (or by the software occlusion buffer) */
 			PLCore::uint32 nNumOfSkippedFrustumTests;			/**< Number of skipped frustum tests because for instance the parent node was
 																	 already complete within the frustum. (hierarchy node & scene node tests) */
 			PLCore::uint32 nNumOfFrustumCulledNodes;			/**< Number of hierarchy nodes culled by the frustum culling only */
 			PLCore::uint32 nNumOfNearPlaneIntersectingNodes;	/**< Number of hierarchy nodes with near plane intersection */
+			PLCore::uint32 nNumOfSoftwareCulledSceneNodes;		/**< Number of scene nodes within visible hierarchy nodes culled by the software occlusion buffer */
 			PLCore::uint32 nNumOfVisibleSceneNodes;				/**< Number of visible scene nodes */
+			PLCore::uint32 nNumOfHLODProxies;					/**< Number of scene containers replaced by their hierarchical LOD proxy scene node */
+			PLCore::uint32 nNumOfHLODSkippedSceneNodes;			/**< Number of scene nodes directly within scene containers replaced by their hierarchical LOD proxy
+																	 scene node (the scene nodes of nested scene containers are not counted) */
 			PLCore::uint32 nNumOfQueries;						/**< Total number of occlusion queries */
 			PLCore::uint32 nMaxNumOfQueries;					/**< Maximum number of occlusion queries active at the same time */
 			bool		   bWaitForQueryResult;					/**< Was waiting for a query result required? */
@@ -200,6 +206,35 @@ class SQCull : public SceneQuery {
 		*/
 		PLS_API void SetVisibilityThreshold(PLCore::uint32 nThreshold = 1);
 
+		/**
+		*  @brief
+		*    Returns the width of the software occlusion buffer
+		*
+		*  @return
+		*    Width of the software occlusion buffer in pixels
+		*
+		*  @remarks
+		*    The height of the software occlusion buffer is calculated by using the aspect ratio of the current
+		*    viewport. A low resolution is sufficient for a conservative test, a higher resolution lets small
+		*    gaps between occluders through but costs more rasterization time.
+		*
+		*  @note
+		*    - Used by the render mode Software
+		*/
+		PLS_API PLCore::uint32 GetSoftwareOcclusionBufferWidth() const;
+
+		/**
+		*  @brief
+		*    Sets the width of the software occlusion buffer
+		*
+		*  @param[in] nWidth
+		*    Width of the software occlusion buffer in pixels, rounded up to a multiple of "SoftwareOcclusionBuffer::TileSize"
+		*
+		*  @see
+		*    - GetSoftwareOcclusionBufferWidth()
+		*/
+		PLS_API void SetSoftwareOcclusionBufferWidth(PLCore::uint32 nWidth = 256);
+
 		/**
 		*  @brief
 		*    Returns the statistics
@@ -351,6 +386,43 @@ class SQCull : public SceneQuery {
 		*/
 		bool CullCoherentWithQueue();
 
+		/**
+		*  @brief
+		*    Culls the scene using view frustum culling and the software occlusion buffer
+		*
+		*  @remarks
+		*    The hierarchy nodes are traversed front to back. The occluder scene nodes ("SceneNode::CanOcclude"-flag
+		*    set) of visible hierarchy nodes are rasterized into the software occlusion buffer of the visibility root
+		*    container before the other scene nodes of the hierarchy node are tested, hierarchy nodes and scene nodes
+		*    (except lights) which are completely hidden by the occluders drawn so far are skipped. No GPU occlusion
+		*    queries are used, so there's never a need to wait for the GPU.
+		*
+		*  @return
+		*    'false' if the query was cancelled by the user, else 'true'
+		*/
+		bool CullSoftware();
+
+		/**
+		*  @brief
+		*    Returns the software occlusion buffer of the visibility root container
+		*
+		*  @return
+		*    The software occlusion buffer, a null pointer if the visibility root container doesn't use the software cull mode
+		*/
+		SoftwareOcclusionBuffer *GetSoftwareOcclusionBuffer() const;
+
+		/**
+		*  @brief
+		*    Rasterizes an occluder into the software occlusion buffer
+		*
+		*  @param[in] cSceneNode
+		*    Occluder scene node within the scene container of this query
+		*
+		*  @remarks
+		*    The triangles of the last (= usually simplest) LOD level of the scene node mesh are used.
+		*/
+		void DrawSoftwareOccluder(SceneNode &cSceneNode);
+
 		/**
 		*  @brief
 		*    Traverses a node
@@ -434,6 +506,7 @@ class SQCull : public SceneQuery {
 		// General data
 		EMode			   m_nMode;						/**< Used cull mode */
 		PLCore::uint32	   m_nVisibilityThreshold;		/**< Visibility threshold */
+		PLCore::uint32	   m_nSoftwareOcclusionBufferWidth;	/**< Width of the software occlusion buffer in pixels */
 		Statistics		   m_sStatistics;				/**< Some statistics */
 		SceneNodeHandler  *m_pCameraContainer;			/**< Container the camera is in */
 		bool			   m_bCameraInCell;				/**< Is the camera within a cell? */
@@ -457,6 +530,8 @@ class SQCull : public SceneQuery {
 		PLRenderer::OcclusionQuery					   **m_ppOcclusionQueries;		/**< Occlusion queries */
 		PLCore::BinaryHeap<float, SceneHierarchyNode*> 	 m_lstDistanceQueue;		/**< Distance queue */
 		PLCore::BinaryHeap<float, SceneNode*>			 m_lstNodeDistanceQueue;	/**< Distance queue for the scene nodes*/
+		SoftwareOcclusionBuffer							*m_pSoftwareOcclusionBuffer;	/**< Software occlusion buffer, only used by the visibility root container, can be a null pointer */
+		PLMath::Matrix4x4								 m_mSoftwareOcclusionMVP;		/**< Container space to clip space matrix used for the software occlusion buffer */
 
 		VisContainer *m_pVisRootContainer;	/**< Visibility root container */
 		VisContainer *m_pVisContainer;		/**< Visibility container (do NOT use this variable directly, use GetVisContainer()!) */
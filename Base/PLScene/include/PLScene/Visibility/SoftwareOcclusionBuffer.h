@@ -0,0 +1,250 @@
+/*********************************************************\
+ *  File: SoftwareOcclusionBuffer.h                      *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+#ifndef __PLSCENE_SOFTWAREOCCLUSIONBUFFER_H__
+#define __PLSCENE_SOFTWAREOCCLUSIONBUFFER_H__
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "PLScene/PLScene.h"
+
+
+//[-------------------------------------------------------]
+//[ Forward declarations                                  ]
+//[-------------------------------------------------------]
+namespace PLMath {
+	class Vector3;
+	class Matrix4x4;
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace PLScene {
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Low resolution software depth buffer for CPU occlusion culling
+*
+*  @remarks
+*    Occluder triangles are transformed into clip space and rasterized into a low resolution depth buffer on the
+*    CPU (four pixels at once when SSE2 is available). Each depth value is the normalized device coordinate
+*    depth (z/w), so the buffer works with any projection matrix where this value increases with the distance.
+*    The buffer is split into tiles of 8x8 pixels, and for each tile the farthest depth is kept up-to-date while
+*    drawing. An axis aligned bounding box is tested by projecting its corners and comparing its nearest depth
+*    against the farthest depth of all tiles covered by its screen rectangle (hierarchical z-buffer, HiZ), so the
+*    test never needs to look at single pixels.
+*
+*  @note
+*    - The test is conservative regarding the tiles: A box is only reported as hidden if all tiles it covers
+*      are completely filled with nearer occluder depths
+*    - Occluder triangles with a vertex behind the camera are skipped instead of being clipped, boxes with
+*      a corner behind the camera are always reported as visible
+*    - Occluder triangles are rasterized two-sided, pixels are covered if their center is inside a triangle
+*/
+class SoftwareOcclusionBuffer {
+
+
+	//[-------------------------------------------------------]
+	//[ Public definitions                                    ]
+	//[-------------------------------------------------------]
+	public:
+		static const PLCore::uint32 TileSize = 8;	/**< Width and height of a tile in pixels */
+
+
+	//[-------------------------------------------------------]
+	//[ Public functions                                      ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Default constructor
+		*/
+		PLS_API SoftwareOcclusionBuffer();
+
+		/**
+		*  @brief
+		*    Destructor
+		*/
+		PLS_API ~SoftwareOcclusionBuffer();
+
+		/**
+		*  @brief
+		*    Returns the width of the depth buffer
+		*
+		*  @return
+		*    Width of the depth buffer in pixels, always a multiple of "TileSize"
+		*/
+		inline PLCore::uint32 GetWidth() const;
+
+		/**
+		*  @brief
+		*    Returns the height of the depth buffer
+		*
+		*  @return
+		*    Height of the depth buffer in pixels, always a multiple of "TileSize"
+		*/
+		inline PLCore::uint32 GetHeight() const;
+
+		/**
+		*  @brief
+		*    Clears the depth buffer
+		*
+		*  @param[in] nWidth
+		*    Width of the depth buffer in pixels, rounded up to a multiple of "TileSize"
+		*  @param[in] nHeight
+		*    Height of the depth buffer in pixels, rounded up to a multiple of "TileSize"
+		*
+		*  @note
+		*    - The depth buffer is only reallocated if the dimension changes
+		*/
+		PLS_API void Clear(PLCore::uint32 nWidth, PLCore::uint32 nHeight);
+
+		/**
+		*  @brief
+		*    Draws occluder triangles into the depth buffer
+		*
+		*  @param[in] mWorldViewProjection
+		*    World view projection matrix transforming the given positions into clip space
+		*  @param[in] pvPositions
+		*    Triangle positions, three per triangle, can be a null pointer if "nNumOfTriangles" is 0
+		*  @param[in] nNumOfTriangles
+		*    Number of triangles to draw
+		*
+		*  @return
+		*    Number of triangles which were rasterized (not skipped because they have a vertex behind
+		*    the camera, are outside the buffer or are degenerated)
+		*/
+		PLS_API PLCore::uint32 DrawTriangles(const PLMath::Matrix4x4 &mWorldViewProjection, const PLMath::Vector3 *pvPositions, PLCore::uint32 nNumOfTriangles);
+
+		/**
+		*  @brief
+		*    Checks whether or not an axis aligned bounding box may be visible
+		*
+		*  @param[in] mWorldViewProjection
+		*    World view projection matrix transforming the given box into clip space
+		*  @param[in] vMin
+		*    Minimum position of the box
+		*  @param[in] vMax
+		*    Maximum position of the box
+		*
+		*  @return
+		*    'true' if the box may be visible, 'false' if it's for sure hidden by the drawn occluders
+		*/
+		PLS_API bool IsVisible(const PLMath::Matrix4x4 &mWorldViewProjection, const PLMath::Vector3 &vMin, const PLMath::Vector3 &vMax) const;
+
+
+	//[-------------------------------------------------------]
+	//[ Private functions                                     ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Copy constructor
+		*
+		*  @param[in] cSource
+		*    Source to copy from
+		*/
+		SoftwareOcclusionBuffer(const SoftwareOcclusionBuffer &cSource);
+
+		/**
+		*  @brief
+		*    Copy operator
+		*
+		*  @param[in] cSource
+		*    Source to copy from
+		*
+		*  @return
+		*    Reference to this instance
+		*/
+		SoftwareOcclusionBuffer &operator =(const SoftwareOcclusionBuffer &cSource);
+
+		/**
+		*  @brief
+		*    Rasterizes a single triangle
+		*
+		*  @param[in] pfV0
+		*    First vertex (x and y in pixels, depth)
+		*  @param[in] pfV1
+		*    Second vertex (x and y in pixels, depth)
+		*  @param[in] pfV2
+		*    Third vertex (x and y in pixels, depth)
+		*
+		*  @return
+		*    'true' if the triangle was rasterized, else 'false'
+		*/
+		bool RasterizeTriangle(const float *pfV0, const float *pfV1, const float *pfV2);
+
+		/**
+		*  @brief
+		*    Updates the farthest depth of all tiles within the given pixel rectangle
+		*
+		*  @param[in] nX0
+		*    Left pixel
+		*  @param[in] nY0
+		*    Top pixel
+		*  @param[in] nX1
+		*    Right pixel (inclusive)
+		*  @param[in] nY1
+		*    Bottom pixel (inclusive)
+		*/
+		void UpdateTiles(PLCore::uint32 nX0, PLCore::uint32 nY0, PLCore::uint32 nX1, PLCore::uint32 nY1);
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		PLCore::uint32  m_nWidth;			/**< Width of the depth buffer in pixels */
+		PLCore::uint32  m_nHeight;			/**< Height of the depth buffer in pixels */
+		PLCore::uint32  m_nNumOfTilesX;		/**< Number of tiles along the x axis */
+		PLCore::uint32  m_nNumOfTilesY;		/**< Number of tiles along the y axis */
+		float		   *m_pfDepth;			/**< Depth per pixel (m_nWidth*m_nHeight), can be a null pointer */
+		float		   *m_pfTileDepth;		/**< Farthest depth per tile (m_nNumOfTilesX*m_nNumOfTilesY), can be a null pointer */
+
+
+};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // PLScene
+
+
+//[-------------------------------------------------------]
+//[ Implementation                                        ]
+//[-------------------------------------------------------]
+#include "PLScene/Visibility/SoftwareOcclusionBuffer.inl"
+
+
+#endif // __PLSCENE_SOFTWAREOCCLUSIONBUFFER_H__
@@ -115,6 +115,23 @@ class VisContainer : public VisNode {
 		*/
 		PLS_API const Projection &GetProjection() const;
 
+		/**
+		*  @brief
+		*    Reports the texture usage of all visible scene nodes for texture streaming
+		*
+		*  @param[in] fViewportHeight
+		*    Height of the viewport in pixel
+		*
+		*  @remarks
+		*    The approximated screen space size of each visible scene node is calculated by using its
+		*    bounding sphere, the distance to the camera and the projection, and reported to the
+		*    materials of the scene node. Visible cells and containers are processed recursively.
+		*
+		*  @see
+		*    - PLRenderer::TextureManager::SetStreamingBudget()
+		*/
+		PLS_API void ReportTextureUsage(float fViewportHeight) const;
+
 
 	//[-------------------------------------------------------]
 	//[ Private functions                                     ]
@@ -0,0 +1,316 @@
+/*********************************************************\
+ *  File: RenderQueue.cpp                                *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <PLCore/Tools/Tools.h>
+#include <PLCore/Core/MemoryManager.h>
+#include "PLScene/Compositing/RenderQueue.h"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+using namespace PLCore;
+namespace PLScene {
+
+
+//[-------------------------------------------------------]
+//[ Public static functions                               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Returns a packed sort key
+*/
+uint64 RenderQueue::GetSortKey(uint32 nLayer, uint32 nProgramID, uint32 nMaterialID, float fDepth, bool bBackToFront)
+{
+	// Positive floating point values keep their order when their bits are compared as integers, use the upper 24 bits
+	const uint64 nDepth = (fDepth > 0.0f) ? (Tools::FloatToUInt32(fDepth) >> 8) : 0;
+
+	// Pack the sort key
+	const uint64 nLayerBits = static_cast<uint64>(nLayer & 0xF) << 60;
+	if (bBackToFront)
+		return nLayerBits | ((0xFFFFFF - nDepth) << 36) | (static_cast<uint64>(nProgramID & 0xFFF) << 24) | (nMaterialID & 0xFFFFFF);
+	else
+		return nLayerBits | (static_cast<uint64>(nProgramID & 0xFFF) << 48) | (static_cast<uint64>(nMaterialID & 0xFFFFFF) << 24) | nDepth;
+}
+
+
+//[-------------------------------------------------------]
+//[ Public functions                                      ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Default constructor
+*/
+RenderQueue::RenderQueue()
+{
+}
+
+/**
+*  @brief
+*    Destructor
+*/
+RenderQueue::~RenderQueue()
+{
+}
+
+/**
+*  @brief
+*    Removes all items
+*/
+void RenderQueue::Clear()
+{
+	m_lstItems.Reset();
+	m_lstEntries.Reset();
+	m_lstBatches.Reset();
+}
+
+/**
+*  @brief
+*    Adds an item
+*/
+void RenderQueue::Add(const Item &sItem)
+{
+	// Add the sort entry
+	Entry &sEntry = m_lstEntries.Add();
+	sEntry.nSortKey = sItem.nSortKey;
+	sEntry.nItem    = m_lstItems.GetNumOfElements();
+
+	// Add the item
+	m_lstItems.Add(sItem);
+}
+
+/**
+*  @brief
+*    Sorts the items by their sort keys
+*/
+void RenderQueue::Sort()
+{
+	const uint32 nNumOfEntries = m_lstEntries.GetNumOfElements();
+	if (nNumOfEntries > 1) {
+		// Build the histograms of all eight key bytes at once
+		uint32 nHistograms[8][256];
+		MemoryManager::Set(nHistograms, 0, sizeof(nHistograms));
+		const Entry *pEntries = m_lstEntries.GetData();
+		for (uint32 i=0; i<nNumOfEntries; i++) {
+			const uint64 nSortKey = pEntries[i].nSortKey;
+			for (uint32 nByte=0; nByte<8; nByte++)
+				nHistograms[nByte][(nSortKey >> (nByte*8)) & 0xFF]++;
+		}
+
+		// One counting sort pass per key byte, beginning with the least significant one
+		m_lstSortBuffer.Resize(nNumOfEntries, true, false);
+		Entry *pSource      = m_lstEntries.GetData();
+		Entry *pDestination = m_lstSortBuffer.GetData();
+		for (uint32 nByte=0; nByte<8; nByte++) {
+			// Skip this byte if all keys have the same value in it
+			const uint32  nShift      = nByte*8;
+				  uint32 *pnHistogram = nHistograms[nByte];
+			if (pnHistogram[(pSource[0].nSortKey >> nShift) & 0xFF] == nNumOfEntries)
+				continue;
+
+			// Turn the counts into start offsets
+			uint32 nOffset = 0;
+			for (uint32 i=0; i<256; i++) {
+				const uint32 nCount = pnHistogram[i];
+				pnHistogram[i] = nOffset;
+				nOffset += nCount;
+			}
+
+			// Scatter the entries, this keeps the order of entries with equal bytes
+			for (uint32 i=0; i<nNumOfEntries; i++) {
+				const Entry &sEntry = pSource[i];
+				pDestination[pnHistogram[(sEntry.nSortKey >> nShift) & 0xFF]++] = sEntry;
+			}
+
+			// The destination is the source of the next pass
+			Entry *pTemp = pSource;
+			pSource      = pDestination;
+			pDestination = pTemp;
+		}
+
+		// Ended within the sort buffer?
+		if (pSource != m_lstEntries.GetData())
+			MemoryManager::Copy(m_lstEntries.GetData(), pSource, nNumOfEntries*sizeof(Entry));
+	}
+}
+
+/**
+*  @brief
+*    Groups the items into batches
+*/
+void RenderQueue::BuildBatches(uint32 nMaxNumOfItems)
+{
+	m_lstBatches.Reset();
+	const uint32 nNumOfEntries = m_lstEntries.GetNumOfElements();
+	if (nNumOfEntries) {
+		// One batch per item?
+		if (nMaxNumOfItems <= 1) {
+			m_lstBatches.Resize(nNumOfEntries, true, false);
+			Batch *pBatches = m_lstBatches.GetData();
+			for (uint32 i=0; i<nNumOfEntries; i++) {
+				pBatches[i].nFirstItem  = i;
+				pBatches[i].nNumOfItems = 1;
+			}
+		} else {
+			// Assign the entries to batches, the hash map contains the last opened batch per key
+			m_lstBatchOfEntry.Resize(nNumOfEntries, true, false);
+			uint32		*pnBatchOfEntry = m_lstBatchOfEntry.GetData();
+			const Entry *pEntries		= m_lstEntries.GetData();
+			for (uint32 i=0; i<nNumOfEntries; i++) {
+				const Item &sItem = m_lstItems[pEntries[i].nItem];
+
+				// Different items may end up with the same key, "IsBatchable()" has the final word
+				const uint64 nKey = (sItem.nSortKey >> 24) ^ (reinterpret_cast<uint64>(sItem.pVertexBuffer) << 24) ^ (reinterpret_cast<uint64>(sItem.pGeometry) << 8) ^
+									reinterpret_cast<uint64>(sItem.pIndexBuffer) ^ (reinterpret_cast<uint64>(sItem.pCullQuery) << 16);
+
+				// Add the item to an open batch?
+				const uint32 nOpenBatch = m_mapBatches.Get(nKey);
+				if (nOpenBatch) {
+					Batch &sBatch = m_lstBatches[nOpenBatch - 1];
+					if (sBatch.nNumOfItems < nMaxNumOfItems && IsBatchable(m_lstItems[pEntries[sBatch.nFirstItem].nItem], sItem)) {
+						sBatch.nNumOfItems++;
+						pnBatchOfEntry[i] = nOpenBatch - 1;
+						continue;
+					}
+				}
+
+				// Open a new batch
+				pnBatchOfEntry[i] = m_lstBatches.GetNumOfElements();
+				Batch &sBatch = m_lstBatches.Add();
+				sBatch.nFirstItem  = i;
+				sBatch.nNumOfItems = 1;
+				m_mapBatches.Set(nKey, m_lstBatches.GetNumOfElements());
+			}
+			m_mapBatches.Clear();
+
+			// Reorder the entries so that the items of a batch follow each other
+			const uint32 nNumOfBatches = m_lstBatches.GetNumOfElements();
+			if (nNumOfBatches < nNumOfEntries) {
+				// Turn the item counts into start offsets, the counts are restored while scattering
+				Batch *pBatches = m_lstBatches.GetData();
+				uint32 nOffset = 0;
+				for (uint32 i=0; i<nNumOfBatches; i++) {
+					pBatches[i].nFirstItem = nOffset;
+					nOffset += pBatches[i].nNumOfItems;
+					pBatches[i].nNumOfItems = 0;
+				}
+
+				// Scatter the entries, this keeps the order of the entries within a batch
+				m_lstSortBuffer.Resize(nNumOfEntries, true, false);
+				Entry *pDestination = m_lstSortBuffer.GetData();
+				for (uint32 i=0; i<nNumOfEntries; i++) {
+					Batch &sBatch = pBatches[pnBatchOfEntry[i]];
+					pDestination[sBatch.nFirstItem + sBatch.nNumOfItems++] = pEntries[i];
+				}
+				MemoryManager::Copy(m_lstEntries.GetData(), pDestination, nNumOfEntries*sizeof(Entry));
+			}
+		}
+	}
+}
+
+/**
+*  @brief
+*    Returns the identifier of a program
+*/
+uint32 RenderQueue::GetProgramID(const void *pProgram)
+{
+	// A null pointer has always the identifier 0
+	if (!pProgram)
+		return 0;
+
+	// Already known?
+	const uint64 nKey = reinterpret_cast<uint64>(pProgram);
+	uint32 nID = m_mapProgramIDs.Get(nKey);
+	if (!nID) {
+		// Start again if all identifiers are used up
+		if (m_mapProgramIDs.GetNumOfElements() >= 0xFFF)
+			m_mapProgramIDs.Clear();
+
+		// Give the program the next free identifier
+		nID = m_mapProgramIDs.GetNumOfElements() + 1;
+		m_mapProgramIDs.Add(nKey, nID);
+	}
+
+	// Done
+	return nID;
+}
+
+/**
+*  @brief
+*    Returns the identifier of a material
+*/
+uint32 RenderQueue::GetMaterialID(const void *pMaterial)
+{
+	// A null pointer has always the identifier 0
+	if (!pMaterial)
+		return 0;
+
+	// Already known?
+	const uint64 nKey = reinterpret_cast<uint64>(pMaterial);
+	uint32 nID = m_mapMaterialIDs.Get(nKey);
+	if (!nID) {
+		// Start again if all identifiers are used up
+		if (m_mapMaterialIDs.GetNumOfElements() >= 0xFFFFFF)
+			m_mapMaterialIDs.Clear();
+
+		// Give the material the next free identifier
+		nID = m_mapMaterialIDs.GetNumOfElements() + 1;
+		m_mapMaterialIDs.Add(nKey, nID);
+	}
+
+	// Done
+	return nID;
+}
+
+
+//[-------------------------------------------------------]
+//[ Private functions                                     ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Copy constructor
+*/
+RenderQueue::RenderQueue(const RenderQueue &cSource)
+{
+	// No implementation because the copy constructor is never used
+}
+
+/**
+*  @brief
+*    Copy operator
+*/
+RenderQueue &RenderQueue::operator =(const RenderQueue &cSource)
+{
+	// No implementation because the copy operator is never used
+	return *this;
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // PLScene
@@ -27,6 +27,7 @@
 //[-------------------------------------------------------]
 #include <PLCore/Log/Log.h>
 #include <PLCore/Base/Class.h>
+#include <PLCore/System/System.h>
 #include "PLScene/Compositing/SceneRendererManager.h"
 #include "PLScene/Compositing/SceneRenderer.h"
 
@@ -127,8 +128,15 @@ void SceneRenderer::DrawScene(Renderer &cRenderer, const SQCull &cCullQuery)
 		SceneRendererPass *pPass = GetByIndex(i);
 
 		// Do ONLY take it into account if it's valid and active
-		if (pPass && pPass->IsActive())
-			pPass->Draw(cRenderer, cCullQuery);
+		if (pPass) {
+			if (pPass->IsActive()) {
+				const uint64 nStartTime = System::GetInstance()->GetMicroseconds();
+				pPass->Draw(cRenderer, cCullQuery);
+				pPass->m_nDrawTime = System::GetInstance()->GetMicroseconds() - nStartTime;
+			} else {
+				pPass->m_nDrawTime = 0;
+			}
+		}
 	}
 }
 
@@ -146,6 +146,15 @@ void SceneRendererPass::SetActive(bool bActive)
 		m_nFlags |=  Inactive;
 }
 
+/**
+*  @brief
+*    Returns the time the last draw of this scene renderer pass took
+*/
+uint64 SceneRendererPass::GetDrawTime() const
+{
+	return m_nDrawTime;
+}
+
 
 //[-------------------------------------------------------]
 //[ Protected functions                                   ]
@@ -157,7 +166,8 @@ void SceneRendererPass::SetActive(bool bActive)
 SceneRendererPass::SceneRendererPass() :
 	Flags(this),
 	Name(this),
-	m_nFlags(0)
+	m_nFlags(0),
+	m_nDrawTime(0)
 {
 }
 
@@ -0,0 +1,464 @@
+/*********************************************************\
+ *  File: HLODBuilder.cpp                                *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <PLMath/Matrix4x4.h>
+#include <PLGraphics/Image/Image.h>
+#include <PLRenderer/RendererContext.h>
+#include <PLRenderer/Renderer/Renderer.h>
+#include <PLRenderer/Renderer/IndexBuffer.h>
+#include <PLRenderer/Renderer/VertexBuffer.h>
+#include <PLRenderer/Renderer/TextureBuffer2D.h>
+#include <PLRenderer/Renderer/SurfaceTextureBuffer.h>
+#include <PLRenderer/Texture/Texture.h>
+#include <PLRenderer/Texture/TextureManager.h>
+#include <PLRenderer/Material/Material.h>
+#include <PLRenderer/Material/Parameter.h>
+#include <PLRenderer/Material/ParameterManager.h>
+#include <PLRenderer/Material/MaterialManager.h>
+#include <PLMesh/Geometry.h>
+#include <PLMesh/MeshManager.h>
+#include <PLMesh/MeshHandler.h>
+#include <PLMesh/MeshLODLevel.h>
+#include <PLMesh/MeshMorphTarget.h>
+#include "PLScene/Scene/SPScene.h"
+#include "PLScene/Scene/SNCamera.h"
+#include "PLScene/Scene/SceneContext.h"
+#include "PLScene/Scene/SceneContainer.h"
+#include "PLScene/Scene/SceneNodes/SNMesh.h"
+#include "PLScene/Scene/HLODBuilder.h"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+using namespace PLCore;
+using namespace PLMath;
+using namespace PLGraphics;
+using namespace PLRenderer;
+using namespace PLMesh;
+namespace PLScene {
+
+
+//[-------------------------------------------------------]
+//[ Public static functions                               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Builds a merged proxy mesh of the given scene container
+*/
+SNMesh *HLODBuilder::BuildProxyMesh(SceneContainer &cContainer, float fDistance, const String &sName)
+{
+	// We need a parent container for the proxy and a scene context
+	SceneContext *pSceneContext = cContainer.GetSceneContext();
+	if (!cContainer.GetContainer() || !pSceneContext)
+		return nullptr; // Error!
+
+	// Collect all visible scene nodes with a mesh
+	Array<SceneNode*> lstMeshes;
+	Array<Matrix3x4>  lstTransforms;
+	CollectMeshes(cContainer, Matrix3x4::Identity, lstMeshes, lstTransforms);
+
+	// Collect the used materials and count the vertices and indices, the simplest LOD level of each mesh is used
+	Array<Material*> lstMaterials;
+	Array<uint32>    lstNumOfIndices;
+	uint32 nNumOfVertices = 0;
+	uint32 nNumOfIndices  = 0;
+	for (uint32 i=0; i<lstMeshes.GetNumOfElements(); i++) {
+		const MeshHandler *pMeshHandler = lstMeshes[i]->GetMeshHandler();
+		const Mesh *pMesh = pMeshHandler->GetMesh();
+		const MeshLODLevel *pLODLevel = pMesh->GetLODLevel(pMesh->GetNumOfLODLevels()-1);
+		nNumOfVertices += pMesh->GetMorphTarget()->GetVertexBuffer()->GetNumOfElements();
+		const Array<Geometry> &lstGeometries = *pLODLevel->GetGeometries();
+		for (uint32 nGeometry=0; nGeometry<lstGeometries.GetNumOfElements(); nGeometry++) {
+			// Get the material slot of the merged mesh
+			Material *pMaterial = pMeshHandler->GetMaterial(lstGeometries[nGeometry].GetMaterial());
+			int nMaterial = lstMaterials.GetIndex(pMaterial);
+			if (nMaterial < 0) {
+				nMaterial = lstMaterials.GetNumOfElements();
+				lstMaterials.Add(pMaterial);
+				lstNumOfIndices.Add(0);
+			}
+
+			// Each triangle of the merged mesh is stored as triangle list
+			const uint32 nGeometryIndices = lstGeometries[nGeometry].GetNumOfTriangles()*3;
+			lstNumOfIndices[nMaterial] += nGeometryIndices;
+			nNumOfIndices += nGeometryIndices;
+		}
+	}
+	if (!nNumOfVertices || !nNumOfIndices)
+		return nullptr; // Error, nothing to merge!
+
+	// Create the mesh, if there's already a mesh with this name we have to get another, still free resource name
+	MeshManager &cMeshManager = pSceneContext->GetMeshManager();
+	const String sMeshName = cContainer.GetAbsoluteName() + "_HLOD";
+	String sMeshNameT = sMeshName;
+	for (uint32 i=0; cMeshManager.GetByName(sMeshNameT); i++)
+		sMeshNameT = sMeshName + '_' + static_cast<int>(i);
+	Mesh *pMesh = cMeshManager.CreateMesh(sMeshNameT);
+	if (!pMesh)
+		return nullptr; // Error!
+	for (uint32 i=0; i<lstMaterials.GetNumOfElements(); i++)
+		pMesh->AddMaterial(lstMaterials[i]);
+	MeshMorphTarget *pMorphTarget = pMesh->AddMorphTarget();
+	MeshLODLevel *pLODLevel = pMesh->AddLODLevel();
+	pLODLevel->CreateGeometries();
+	pLODLevel->CreateIndexBuffer();
+
+	// Merge the vertices, they are transformed into the space of the given scene container
+	VertexBuffer *pVertexBuffer = pMorphTarget->GetVertexBuffer();
+	pVertexBuffer->AddVertexAttribute(VertexBuffer::Position, 0, VertexBuffer::Float3);
+	pVertexBuffer->AddVertexAttribute(VertexBuffer::Normal,   0, VertexBuffer::Float3);
+	pVertexBuffer->AddVertexAttribute(VertexBuffer::TexCoord, 0, VertexBuffer::Float2);
+	pVertexBuffer->Allocate(nNumOfVertices, Usage::Static);
+	Array<uint32> lstVertexOffsets(lstMeshes.GetNumOfElements());
+	if (pVertexBuffer->Lock(Lock::WriteOnly)) {
+		uint32 nVertex = 0;
+		for (uint32 i=0; i<lstMeshes.GetNumOfElements(); i++) {
+			VertexBuffer *pSourceVertexBuffer = lstMeshes[i]->GetMeshHandler()->GetMesh()->GetMorphTarget()->GetVertexBuffer();
+			const Matrix3x4 &mTransform = lstTransforms[i];
+			lstVertexOffsets.Add(nVertex);
+			if (pSourceVertexBuffer->Lock(Lock::ReadOnly)) {
+				for (uint32 nSourceVertex=0; nSourceVertex<pSourceVertexBuffer->GetNumOfElements(); nSourceVertex++, nVertex++) {
+					// Position
+					const float *pfSource = static_cast<const float*>(pSourceVertexBuffer->GetData(nSourceVertex, VertexBuffer::Position));
+					const Vector3 vPosition = mTransform*Vector3(pfSource);
+					float *pfDestination = static_cast<float*>(pVertexBuffer->GetData(nVertex, VertexBuffer::Position));
+					pfDestination[Vector3::X] = vPosition.x;
+					pfDestination[Vector3::Y] = vPosition.y;
+					pfDestination[Vector3::Z] = vPosition.z;
+
+					// Normal
+					pfSource = static_cast<const float*>(pSourceVertexBuffer->GetData(nSourceVertex, VertexBuffer::Normal));
+					const Vector3 vNormal = pfSource ? mTransform.RotateVector(pfSource[Vector3::X], pfSource[Vector3::Y], pfSource[Vector3::Z]).Normalize() : Vector3::UnitZ;
+					pfDestination = static_cast<float*>(pVertexBuffer->GetData(nVertex, VertexBuffer::Normal));
+					pfDestination[Vector3::X] = vNormal.x;
+					pfDestination[Vector3::Y] = vNormal.y;
+					pfDestination[Vector3::Z] = vNormal.z;
+
+					// Texture coordinate
+					pfSource = static_cast<const float*>(pSourceVertexBuffer->GetData(nSourceVertex, VertexBuffer::TexCoord));
+					pfDestination = static_cast<float*>(pVertexBuffer->GetData(nVertex, VertexBuffer::TexCoord));
+					pfDestination[Vector2::X] = pfSource ? pfSource[Vector2::X] : 0.0f;
+					pfDestination[Vector2::Y] = pfSource ? pfSource[Vector2::Y] : 0.0f;
+				}
+
+				// Unlock the source vertex buffer
+				pSourceVertexBuffer->Unlock();
+			}
+		}
+
+		// Unlock the vertex buffer
+		pVertexBuffer->Unlock();
+	}
+
+	// Merge the triangles, sorted by material so there's only one geometry per material
+	IndexBuffer *pIndexBuffer = pLODLevel->GetIndexBuffer();
+	pIndexBuffer->SetElementTypeByMaximumIndex(nNumOfVertices-1);
+	pIndexBuffer->Allocate(nNumOfIndices, Usage::Static);
+	if (pIndexBuffer->Lock(Lock::WriteOnly)) {
+		Array<Geometry> &lstGeometries = *pLODLevel->GetGeometries();
+		uint32 nIndex = 0;
+		for (uint32 nMaterial=0; nMaterial<lstMaterials.GetNumOfElements(); nMaterial++) {
+			// Add the geometry of this material
+			Geometry &cGeometry = lstGeometries.Add();
+			cGeometry.SetPrimitiveType(Primitive::TriangleList);
+			cGeometry.SetMaterial(nMaterial);
+			cGeometry.SetStartIndex(nIndex);
+			cGeometry.SetIndexSize(lstNumOfIndices[nMaterial]);
+
+			// Add the triangles of all source geometries using this material
+			for (uint32 i=0; i<lstMeshes.GetNumOfElements(); i++) {
+				const MeshHandler *pMeshHandler = lstMeshes[i]->GetMeshHandler();
+				const Mesh *pSourceMesh = pMeshHandler->GetMesh();
+				const MeshLODLevel *pSourceLODLevel = pSourceMesh->GetLODLevel(pSourceMesh->GetNumOfLODLevels()-1);
+				const Array<Geometry> &lstSourceGeometries = *pSourceLODLevel->GetGeometries();
+				const uint32 nVertexOffset = lstVertexOffsets[i];
+				for (uint32 nGeometry=0; nGeometry<lstSourceGeometries.GetNumOfElements(); nGeometry++) {
+					if (pMeshHandler->GetMaterial(lstSourceGeometries[nGeometry].GetMaterial()) == lstMaterials[nMaterial]) {
+						const uint32 nNumOfTriangles = lstSourceGeometries[nGeometry].GetNumOfTriangles();
+						for (uint32 nTriangle=0; nTriangle<nNumOfTriangles; nTriangle++) {
+							uint32 nVertex1 = 0, nVertex2 = 0, nVertex3 = 0;
+							pSourceLODLevel->GetTriangle(nGeometry, nTriangle, nVertex1, nVertex2, nVertex3);
+							pIndexBuffer->SetData(nIndex++, nVertexOffset + nVertex1);
+							pIndexBuffer->SetData(nIndex++, nVertexOffset + nVertex2);
+							pIndexBuffer->SetData(nIndex++, nVertexOffset + nVertex3);
+						}
+					}
+				}
+			}
+		}
+
+		// Unlock the index buffer
+		pIndexBuffer->Unlock();
+	}
+
+	// Set the bounding box of the merged mesh
+	Vector3 vMin, vMax;
+	pMesh->CalculateBoundingBox(vMin, vMax);
+	pMesh->SetBoundingBox(vMin, vMax);
+
+	// Add the proxy scene node
+	return AddProxy(cContainer, fDistance, sName, pMesh->GetName());
+}
+
+/**
+*  @brief
+*    Builds an impostor of the given scene container
+*/
+SNMesh *HLODBuilder::BuildImpostor(SceneContainer &cContainer, float fDistance, uint32 nSize, const String &sSceneRenderer, const String &sName)
+{
+	// We need a parent container for the proxy and a scene context
+	SceneContext *pSceneContext = cContainer.GetSceneContext();
+	if (!cContainer.GetContainer() || !pSceneContext || !nSize)
+		return nullptr; // Error!
+	Renderer &cRenderer = pSceneContext->GetRendererContext().GetRenderer();
+
+	// Get the bounding sphere of the scene container content within the scene container space
+	const AABoundingBox &cAABB = cContainer.GetAABoundingBox();
+	const Vector3 vCenter = cAABB.GetCenter();
+	const float fRadius = cAABB.GetEnclosingRadius();
+	if (fRadius <= 0.0f)
+		return nullptr; // Error, nothing to render!
+
+	// Create the surface the scene container content is rendered into
+	SurfaceTextureBuffer *pSurfaceTextureBuffer = cRenderer.CreateSurfaceTextureBuffer2D(Vector2i(nSize, nSize), TextureBuffer::R8G8B8A8);
+	if (!pSurfaceTextureBuffer)
+		return nullptr; // Error!
+	SPScene *pPainter = static_cast<SPScene*>(cRenderer.CreateSurfacePainter("PLScene::SPScene"));
+	if (!pPainter) {
+		delete pSurfaceTextureBuffer;
+		return nullptr; // Error!
+	}
+	pSurfaceTextureBuffer->SetPainter(pPainter);
+	pSurfaceTextureBuffer->SetActive(false);	// WE update the surface, not the renderer
+	pPainter->SetRootContainer(&cContainer);
+	pPainter->SetSceneContainer(&cContainer);
+	pPainter->SetDefaultSceneRenderer(sSceneRenderer);
+
+	// Create a temporary camera within the scene container, the camera frustum encloses the bounding sphere of the
+	// scene container content and the camera is looking along the positive z axis
+	static const float fFOV = 30.0f;
+	const float fCameraDistance = fRadius/Math::Sin(static_cast<float>(fFOV*0.5f*Math::DegToRad));
+	SNCamera *pCamera = cContainer.Create<SNCamera>("", true);
+	pCamera->SetFOV(fFOV);
+	pCamera->SetAspect(1.0f);
+	pCamera->SetZNear(fCameraDistance - fRadius);
+	pCamera->SetZFar(fCameraDistance + fRadius);
+	pCamera->GetTransform().SetPosition(vCenter - Vector3::UnitZ*fCameraDistance);
+	pPainter->SetCamera(pCamera);
+
+	// Render the scene container content
+	SNCamera *pCameraBackup = SNCamera::GetCamera();
+	Surface *pSurfaceBackup = cRenderer.GetRenderTarget();
+	Matrix4x4 mViewProjection;
+	if (cRenderer.SetRenderTarget(pSurfaceTextureBuffer)) {
+		pPainter->OnPaint(*pSurfaceTextureBuffer);
+		mViewProjection = pCamera->GetProjectionMatrix(cRenderer.GetViewport())*pCamera->GetViewMatrix();
+	}
+	cRenderer.SetRenderTarget(pSurfaceBackup);
+	if (pCameraBackup)
+		pCameraBackup->SetCamera(cRenderer);
+
+	// Get the four corners of a quad through the center of the bounding sphere covering the whole rendered image
+	Vector3 vCenterClipSpace = vCenter;
+	vCenterClipSpace *= mViewProjection;
+	const Matrix4x4 mInvViewProjection = mViewProjection.GetInverted();
+	Vector3 vCorners[4] = {
+		Vector3(-1.0f, -1.0f, vCenterClipSpace.z),
+		Vector3( 1.0f, -1.0f, vCenterClipSpace.z),
+		Vector3( 1.0f,  1.0f, vCenterClipSpace.z),
+		Vector3(-1.0f,  1.0f, vCenterClipSpace.z)
+	};
+	for (uint32 i=0; i<4; i++)
+		vCorners[i] *= mInvViewProjection;
+
+	// Destroy the temporary camera
+	pCamera->Delete(true);
+
+	// Create the impostor texture, the rendered image is copied into a standard texture so the surface can be destroyed
+	Image cImage;
+	const bool bImage = pSurfaceTextureBuffer->GetTextureBuffer() && pSurfaceTextureBuffer->GetTextureBuffer()->CopyDataToImage(cImage, false);
+	delete pSurfaceTextureBuffer;
+	if (!bImage)
+		return nullptr; // Error!
+	TextureBuffer2D *pTextureBuffer = cRenderer.CreateTextureBuffer2D(cImage);
+	if (!pTextureBuffer)
+		return nullptr; // Error!
+	TextureManager &cTextureManager = pSceneContext->GetRendererContext().GetTextureManager();
+	const String sResourceName = cContainer.GetAbsoluteName() + "_HLOD";
+	String sTextureName = sResourceName;
+	for (uint32 i=0; cTextureManager.GetByName(sTextureName); i++)
+		sTextureName = sResourceName + '_' + static_cast<int>(i);
+	Texture *pTexture = cTextureManager.CreateTexture(sTextureName, *pTextureBuffer);
+	if (!pTexture) {
+		delete pTextureBuffer;
+		return nullptr; // Error!
+	}
+
+	// Create the impostor material, the background of the impostor texture is cut out by using alpha test
+	Material *pMaterial = pSceneContext->GetRendererContext().GetMaterialManager().LoadResource(pTexture->GetName());
+	if (pMaterial) {
+		Parameter *pParameter = pMaterial->GetParameterManager().CreateParameter(ParameterManager::Float, "AlphaReference");
+		if (pParameter)
+			pParameter->SetValue1f(0.5f);
+	}
+
+	// Create the impostor mesh
+	MeshManager &cMeshManager = pSceneContext->GetMeshManager();
+	String sMeshName = sResourceName;
+	for (uint32 i=0; cMeshManager.GetByName(sMeshName); i++)
+		sMeshName = sResourceName + '_' + static_cast<int>(i);
+	Mesh *pMesh = cMeshManager.CreateMesh(sMeshName);
+	if (!pMesh)
+		return nullptr; // Error!
+	pMesh->AddMaterial(pMaterial);
+	MeshMorphTarget *pMorphTarget = pMesh->AddMorphTarget();
+	MeshLODLevel *pLODLevel = pMesh->AddLODLevel();
+	pLODLevel->CreateGeometries();
+	pLODLevel->CreateIndexBuffer();
+	VertexBuffer *pVertexBuffer = pMorphTarget->GetVertexBuffer();
+	pVertexBuffer->AddVertexAttribute(VertexBuffer::Position, 0, VertexBuffer::Float3);
+	pVertexBuffer->AddVertexAttribute(VertexBuffer::Normal,   0, VertexBuffer::Float3);
+	pVertexBuffer->AddVertexAttribute(VertexBuffer::TexCoord, 0, VertexBuffer::Float2);
+	pVertexBuffer->Allocate(4, Usage::Static);
+	if (pVertexBuffer->Lock(Lock::WriteOnly)) {
+		static const float fTexCoords[4][2] = { { 0.0f, 0.0f }, { 1.0f, 0.0f }, { 1.0f, 1.0f }, { 0.0f, 1.0f } };
+		for (uint32 i=0; i<4; i++) {
+			float *pfVertex = static_cast<float*>(pVertexBuffer->GetData(i, VertexBuffer::Position));
+			pfVertex[Vector3::X] = vCorners[i].x;
+			pfVertex[Vector3::Y] = vCorners[i].y;
+			pfVertex[Vector3::Z] = vCorners[i].z;
+			pfVertex = static_cast<float*>(pVertexBuffer->GetData(i, VertexBuffer::Normal));
+			pfVertex[Vector3::X] =  0.0f;
+			pfVertex[Vector3::Y] =  0.0f;
+			pfVertex[Vector3::Z] = -1.0f;
+			pfVertex = static_cast<float*>(pVertexBuffer->GetData(i, VertexBuffer::TexCoord));
+			pfVertex[Vector2::X] = fTexCoords[i][0];
+			pfVertex[Vector2::Y] = fTexCoords[i][1];
+		}
+
+		// Unlock the vertex buffer
+		pVertexBuffer->Unlock();
+	}
+	IndexBuffer *pIndexBuffer = pLODLevel->GetIndexBuffer();
+	pIndexBuffer->SetElementTypeByMaximumIndex(3);
+	pIndexBuffer->Allocate(6, Usage::Static);
+	if (pIndexBuffer->Lock(Lock::WriteOnly)) {
+		// Both sides are visible
+		static const uint32 nIndices[6] = { 0, 1, 2, 0, 2, 3 };
+		for (uint32 i=0; i<6; i++)
+			pIndexBuffer->SetData(i, nIndices[i]);
+
+		// Unlock the index buffer
+		pIndexBuffer->Unlock();
+	}
+	Geometry &cGeometry = pLODLevel->GetGeometries()->Add();
+	cGeometry.SetPrimitiveType(Primitive::TriangleList);
+	cGeometry.SetMaterial(0);
+	cGeometry.SetStartIndex(0);
+	cGeometry.SetIndexSize(6);
+	Vector3 vMin, vMax;
+	pMesh->CalculateBoundingBox(vMin, vMax);
+	pMesh->SetBoundingBox(vMin, vMax);
+
+	// Add the proxy scene node, it's rotated towards the viewer around the y axis
+	SNMesh *pProxy = AddProxy(cContainer, fDistance, sName, pMesh->GetName());
+	if (pProxy)
+		pProxy->AddModifier("PLScene::SNMBillboardCylindrical");
+
+	// Done
+	return pProxy;
+}
+
+
+//[-------------------------------------------------------]
+//[ Private static functions                              ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Recursively collects the visible scene nodes with a mesh of a scene container
+*/
+void HLODBuilder::CollectMeshes(SceneContainer &cContainer, const Matrix3x4 &mTransform, Array<SceneNode*> &lstMeshes, Array<Matrix3x4> &lstTransforms)
+{
+	for (uint32 i=0; i<cContainer.GetNumOfElements(); i++) {
+		SceneNode *pSceneNode = cContainer.GetByIndex(i);
+
+		// Proxies of scene containers within this scene container are ignored, their source meshes are merged instead
+		if (pSceneNode->IsVisible() && !pSceneNode->IsHLODProxy()) {
+			// Get the transform matrix into the space of the scene container the proxy is built for
+			const Matrix3x4 mSceneNodeTransform = mTransform*pSceneNode->GetTransform().GetMatrix();
+
+			// Scene container?
+			if (pSceneNode->IsContainer()) {
+				CollectMeshes(static_cast<SceneContainer&>(*pSceneNode), mSceneNodeTransform, lstMeshes, lstTransforms);
+			} else {
+				// Get the mesh, the mesh must have vertices and at least one LOD level
+				const MeshHandler *pMeshHandler = pSceneNode->GetMeshHandler();
+				const Mesh *pMesh = pMeshHandler ? pMeshHandler->GetMesh() : nullptr;
+				if (pMesh && pMesh->GetNumOfLODLevels() && pMesh->GetMorphTarget() && pMesh->GetMorphTarget()->GetVertexBuffer()) {
+					lstMeshes.Add(pSceneNode);
+					lstTransforms.Add(mSceneNodeTransform);
+				}
+			}
+		}
+	}
+}
+
+/**
+*  @brief
+*    Adds a proxy mesh scene node to the parent container of the given scene container
+*/
+SNMesh *HLODBuilder::AddProxy(SceneContainer &cContainer, float fDistance, const String &sName, const String &sMesh)
+{
+	// Destroy the previous proxy scene node
+	SceneNode *pPreviousProxy = cContainer.GetHLODProxyNode();
+	cContainer.SetHLODProxy("");
+	if (pPreviousProxy)
+		pPreviousProxy->Delete(true);
+
+	// Create the proxy scene node within the parent container, it's using the transform of the scene container
+	SNMesh *pProxy = cContainer.GetContainer()->Create<SNMesh>(sName.GetLength() ? sName : cContainer.GetName() + "_HLOD");
+	if (pProxy) {
+		pProxy->SetMesh(sMesh);
+		pProxy->GetTransform() = cContainer.GetTransform();
+
+		// Let the scene container use the proxy scene node
+		cContainer.SetHLODDistance(fDistance);
+		cContainer.SetHLODProxy(pProxy->GetName());
+	}
+
+	// Done
+	return pProxy;
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // PLScene
@@ -25,12 +25,16 @@
 //[-------------------------------------------------------]
 //[ Includes                                              ]
 //[-------------------------------------------------------]
+#include <PLCore/File/File.h>
+#include <PLCore/Tools/LoadableManager.h>
+#include "PLScene/Scene/SceneNodeHandler.h"
 #include "PLScene/Scene/SCCell.h"
 
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
 //[-------------------------------------------------------]
+using namespace PLCore;
 namespace PLScene {
 
 
@@ -40,9 +44,30 @@ namespace PLScene {
 pl_class_metadata(SCCell, "PLScene", PLScene::SceneContainer, "Cell (other names: area/sector/zone/room/cluster) scene node container")
 	// Constructors
 	pl_constructor_0_metadata(DefaultConstructor,	"Default constructor",	"")
+	// Attributes
+	pl_attribute_metadata(StreamFilename,	PLCore::String,	"",	ReadWrite,	"Filename of the separately loadable sub-scene holding the contents of this cell, empty if the contents are part of the scene",	"Type='Scene'")
 pl_class_metadata_end(SCCell)
 
 
+//[-------------------------------------------------------]
+//[ Public RTTI get/set functions                         ]
+//[-------------------------------------------------------]
+String SCCell::GetStreamFilename() const
+{
+	return m_sStreamFilename;
+}
+
+void SCCell::SetStreamFilename(const String &sValue)
+{
+	if (m_sStreamFilename != sValue) {
+		m_sStreamFilename = sValue;
+
+		// The currently loaded streamed contents are no longer up-to-date
+		UnloadStreamedContents();
+	}
+}
+
+
 //[-------------------------------------------------------]
 //[ Public functions                                      ]
 //[-------------------------------------------------------]
@@ -50,7 +75,9 @@ pl_class_metadata_end(SCCell)
 *  @brief
 *    Default constructor
 */
-SCCell::SCCell()
+SCCell::SCCell() :
+	StreamFilename(this),
+	m_pStreamedContents(new SceneNodeHandler())
 {
 	// Set the internal flag
 	m_nInternalFlags |= ClassCell;
@@ -62,6 +89,73 @@ SCCell::SCCell()
 */
 SCCell::~SCCell()
 {
+	delete m_pStreamedContents;
+}
+
+/**
+*  @brief
+*    Returns the scene container holding the streamed contents of this cell
+*/
+SceneContainer *SCCell::GetStreamedContents() const
+{
+	return static_cast<SceneContainer*>(m_pStreamedContents->GetElement());
+}
+
+/**
+*  @brief
+*    Loads the streamed contents of this cell
+*/
+bool SCCell::LoadStreamedContents()
+{
+	// Is there a sub-scene?
+	if (m_sStreamFilename.GetLength()) {
+		// Open the file by using the base directories and read it into memory at once
+		File cFile;
+		if (LoadableManager::GetInstance()->OpenFile(cFile, m_sStreamFilename, false) && cFile.Open(File::FileRead | File::FileMemBuf))
+			return LoadStreamedContents(cFile);
+	}
+
+	// Error!
+	return false;
+}
+
+/**
+*  @brief
+*    Loads the streamed contents of this cell from a given file
+*/
+bool SCCell::LoadStreamedContents(File &cFile)
+{
+	// Unload the previous streamed contents
+	UnloadStreamedContents();
+
+	// Create the scene container holding the streamed contents, loading directly into this cell would destroy the portals
+	SceneNode *pContainer = Create("PLScene::SceneContainer", "StreamedContents");
+	if (pContainer) {
+		m_pStreamedContents->SetElement(pContainer);
+
+		// Load the sub-scene
+		if (static_cast<SceneContainer*>(pContainer)->LoadByFile(cFile))
+			return true; // Done
+
+		// Error!
+		UnloadStreamedContents();
+	}
+
+	// Error!
+	return false;
+}
+
+/**
+*  @brief
+*    Unloads the streamed contents of this cell
+*/
+void SCCell::UnloadStreamedContents()
+{
+	SceneNode *pContainer = m_pStreamedContents->GetElement();
+	if (pContainer) {
+		m_pStreamedContents->SetElement();
+		pContainer->Delete(true);
+	}
 }
 
 
@@ -200,6 +200,15 @@ void SNPointLight::GetContainerBoundingSphere(Sphere &cSphere)
 	cSphere.SetPos(GetTransform().GetPosition());
 }
 
+bool SNPointLight::ResetFunction()
+{
+	// A point light is described by its attributes, the cached box plane set is recalculated on demand
+	m_nInternalLightFlags |= RecalculateBoxPlaneSet;
+
+	// Done
+	return true;
+}
+
 
 //[-------------------------------------------------------]
 //[ Public virtual SceneNode functions                    ]
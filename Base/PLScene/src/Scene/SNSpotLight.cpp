@@ -440,6 +440,18 @@ void SNSpotLight::GetContainerBoundingSphere(Sphere &cSphere)
 	cSphere.SetPos(GetTransform().GetPosition());
 }
 
+bool SNSpotLight::ResetFunction()
+{
+	// The cached matrices and the frustum are recalculated on demand
+	m_nInternalLightFlags |= RecalculateProjectionMatrix;
+	m_nInternalLightFlags |= RecalculateViewMatrix;
+	m_nInternalLightFlags |= RecalculateFrustum;
+	m_nInternalLightFlags |= RecalculateFrustumVertices;
+
+	// Call base implementation
+	return SNPointLight::ResetFunction();
+}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
@@ -29,10 +29,11 @@
 #include <PLCore/Base/Class.h>
 #include <PLCore/Tools/Timing.h>
 #include <PLCore/Tools/Loader.h>
-#include <PLCore/Container/Stack.h>
+#include <PLMath/Math.h>
 #include "PLScene/Scene/SceneContext.h"
 #include "PLScene/Scene/SceneHierarchy.h"
 #include "PLScene/Scene/SceneHierarchyNode.h"
+#include "PLScene/Scene/SceneNodeHandler.h"
 #include "PLScene/Scene/SceneQueryManager.h"
 #include "PLScene/Scene/SceneLoader/SceneLoader.h"
 #include "PLScene/Scene/SceneContainer.h"
@@ -62,6 +63,8 @@ pl_class_metadata(SceneContainer, "PLScene", PLScene::SceneNode, "Scene containe
 	pl_method_3_metadata(LoadByFilename,			pl_ret_type(bool),			const PLCore::String&,	const PLCore::String&,	const PLCore::String&,			"Load a scene from a file given by filename. Scene filename as first parameter, optional load method parameters as second parameter, optional name of the load method to use as third parameter. Returns 'true' if all went fine, else 'false'.",																																																																														"")
 	// Attributes
 	pl_attribute_metadata(Hierarchy,	PLCore::String,								"PLScene::SHList",									ReadWrite,	"Class name of the scene container hierarchy",							"")
+	pl_attribute_metadata(HLODDistance,	float,										0.0f,												ReadWrite,	"Distance from which on the hierarchical LOD proxy replaces this scene container, <= 0 to disable hierarchical LOD",	"")
+	pl_attribute_metadata(HLODProxy,	PLCore::String,								"",													ReadWrite,	"Name of the hierarchical LOD proxy scene node, must be within the same scene container as this scene container",	"")
 		// Overwritten SceneNode attributes
 	pl_attribute_metadata(Flags,		pl_flag_type_def3(SceneContainer, EFlags),	0,													ReadWrite,	"Flags",																"")
 	pl_attribute_metadata(AABBMin,		PLMath::Vector3,							PLMath::Vector3(-10000.0f, -10000.0f, -10000.0f),	ReadWrite,	"Minimum position of the 'scene node space' axis aligned bounding box",	"")
@@ -94,6 +97,38 @@ void SceneContainer::SetHierarchy(const String &sValue)
 	m_sHierarchy = sValue;
 }
 
+float SceneContainer::GetHLODDistance() const
+{
+	return m_fHLODDistance;
+}
+
+void SceneContainer::SetHLODDistance(float fValue)
+{
+	m_fHLODDistance = fValue;
+}
+
+String SceneContainer::GetHLODProxy() const
+{
+	return m_sHLODProxy;
+}
+
+void SceneContainer::SetHLODProxy(const String &sValue)
+{
+	if (m_sHLODProxy != sValue) {
+		m_sHLODProxy = sValue;
+
+		// Release the current proxy scene node
+		SceneNode *pProxy = m_pHLODProxy->GetElement();
+		if (pProxy) {
+			pProxy->m_nInternalFlags &= ~HLODProxyNode;
+			m_pHLODProxy->SetElement();
+		}
+
+		// Search the new proxy scene node, if it doesn't exist yet it's searched again as soon as it's requested
+		GetHLODProxyNode();
+	}
+}
+
 void SceneContainer::SetFilename(const String &sValue)
 {
 	if (m_sFilename != sValue) {
@@ -115,15 +150,23 @@ void SceneContainer::SetFilename(const String &sValue)
 */
 SceneContainer::SceneContainer() :
 	Hierarchy(this),
+	HLODDistance(this),
+	HLODProxy(this),
 	Flags(this),
 	AABBMin(this),
 	AABBMax(this),
 	Filename(this),
 	m_sHierarchy("PLScene::SHList"),
+	m_fHLODDistance(0.0f),
+	m_pHLODProxy(new SceneNodeHandler()),
 	m_pSceneContext(nullptr),
 	m_pHierarchy(nullptr),
-	m_pQueryManager(nullptr)
+	m_pQueryManager(nullptr),
+	m_bWorldMatricesDirty(false)
 {
+	// The world matrix cache manages its size by itself
+	m_lstWorldMatrices.SetResizeCount(0);
+
 	// Overwritten SceneNode variables
 	m_cAABoundingBox.vMin.SetXYZ(-10000.0f, -10000.0f, -10000.0f);
 	m_cAABoundingBox.vMax.SetXYZ( 10000.0f,  10000.0f,  10000.0f);
@@ -146,6 +189,12 @@ SceneContainer::~SceneContainer()
 		delete m_pHierarchy;
 	if (m_pQueryManager)
 		delete m_pQueryManager;
+
+	// The proxy scene node is no longer a proxy
+	SceneNode *pProxy = m_pHLODProxy->GetElement();
+	if (pProxy)
+		pProxy->m_nInternalFlags &= ~HLODProxyNode;
+	delete m_pHLODProxy;
 }
 
 /**
@@ -165,7 +214,11 @@ SceneNode *SceneContainer::CreateAtIndex(const String &sClass, const String &sNa
 			const Class *pClass = ClassManager::GetInstance()->GetClass(sClass);
 			if (pClass && pClass->IsDerivedFrom(*pBaseClass)) {
 				PL_LOG(Debug, "Create scene node '" + sName + "' of type '" + sClass + '\'')
-				SceneNode *pNode = static_cast<SceneNode*>(pClass->Create());
+
+				// Reuse a pooled scene node of this class, if there's one
+				SceneNode *pNode = GetRecycledSceneNode(*pClass);
+				if (!pNode)
+					pNode = static_cast<SceneNode*>(pClass->Create());
 				if (pNode) {
 
 					// [TODO] Check/refactor the initialization/de-initialization process
@@ -221,35 +274,75 @@ bool SceneContainer::GetTransformMatrixTo(SceneContainer &cContainer, Matrix3x4
 	if (this == &cContainer) {
 		mTransform.SetIdentity();
 	} else {
-		// From this container space to the root space
-		mTransform = GetTransform().GetMatrix();
-		SceneContainer *pContainer = GetContainer();
-		while (pContainer) {
-			// Check if the job is already done and this container is just a child of the 'another scene container'
-			if (pContainer == &cContainer)
-				return true; // Done
-
-			// Transform
-			mTransform = pContainer->GetTransform().GetMatrix()*mTransform;
-			pContainer = pContainer->GetContainer();
-		}
+		// From this container space to the root space and from the root space to target container space,
+		// by using the cached world matrices there's no need to walk through the scene container chains
+		mTransform = cContainer.GetWorldMatrix().GetInverted()*GetWorldMatrix();
+	}
+
+	// Done
+	return true;
+}
 
-		// From root space to target container space
-		pContainer = &cContainer;
-		Stack<SceneContainer*> lstStack;
-		while (pContainer) {
-			lstStack.Push(pContainer);
-			pContainer = pContainer->GetContainer();
+/**
+*  @brief
+*    Recalculates all dirty cached world matrices of this scene container and the scene containers within it
+*/
+void SceneContainer::UpdateWorldMatrices()
+{
+	// Is there anything to do?
+	if (m_bWorldMatricesDirty) {
+		// Get the world matrix of this scene container, it's either already up-to-date or recalculated right now
+		const Matrix3x4 mWorldMatrix = GetWorldMatrix();
+
+		// Recalculate all dirty world matrices of this scene container within one linear pass
+		WorldMatrix *pWorldMatrix = m_lstWorldMatrices.GetData();
+		const WorldMatrix *pWorldMatrixEnd = pWorldMatrix + m_lstWorldMatrices.GetNumOfElements();
+		uint32 nNumOfUpdates = 0;
+		for (; pWorldMatrix<pWorldMatrixEnd; pWorldMatrix++) {
+			if (pWorldMatrix->bDirty) {
+				pWorldMatrix->mMatrix = mWorldMatrix*pWorldMatrix->pSceneNode->GetTransform().GetMatrix();
+				pWorldMatrix->bDirty  = false;
+				nNumOfUpdates++;
+			}
 		}
-		while (lstStack.GetNumOfElements()) {
-			pContainer = lstStack.Top();
-			lstStack.Pop();
-			mTransform = pContainer->GetTransform().GetInverseMatrix()*mTransform;
+		if (m_pSceneContext)
+			m_pSceneContext->m_nNumOfWorldMatrixUpdates += nNumOfUpdates;
+
+		// The world matrices of this scene container are now up-to-date, now process the scene containers within it
+		m_bWorldMatricesDirty = false;
+		pWorldMatrix = m_lstWorldMatrices.GetData();
+		for (; pWorldMatrix<pWorldMatrixEnd; pWorldMatrix++) {
+			if (pWorldMatrix->bContainer)
+				static_cast<SceneContainer*>(pWorldMatrix->pSceneNode)->UpdateWorldMatrices();
 		}
 	}
+}
 
-	// Done
-	return true;
+/**
+*  @brief
+*    Returns the hierarchical LOD proxy scene node
+*/
+SceneNode *SceneContainer::GetHLODProxyNode()
+{
+	// Search the proxy scene node if required, it's usually loaded after this scene container
+	SceneNode *pProxy = m_pHLODProxy->GetElement();
+	if (!pProxy && m_sHLODProxy.GetLength()) {
+		SceneContainer *pContainer = GetContainer();
+		if (pContainer) {
+			pProxy = pContainer->GetByName(m_sHLODProxy);
+			if (pProxy && pProxy != this && pProxy->GetContainer() == pContainer && !pProxy->IsContainer()) {
+				// Mark the scene node as proxy so it's not drawn on its own
+				pProxy->m_nInternalFlags |= HLODProxyNode;
+				m_pHLODProxy->SetElement(pProxy);
+			} else {
+				// Error, the proxy scene node must be a sibling of this scene container!
+				pProxy = nullptr;
+			}
+		}
+	}
+
+	// Return the proxy scene node
+	return pProxy;
 }
 
 
@@ -413,41 +506,55 @@ bool SceneContainer::Add(SceneNode &cNode, const String &sName, bool bInitNode,
 	if (cNode.IsContainer())
 		static_cast<SceneContainer&>(cNode).m_pSceneContext = m_pSceneContext;
 
+	// Add the scene node to the world matrix cache, the number of slots is doubled to avoid frequent reallocations
+	if (m_lstWorldMatrices.GetNumOfElements() == m_lstWorldMatrices.GetMaxNumOfElements())
+		m_lstWorldMatrices.Resize(Math::Max(static_cast<uint32>(16), m_lstWorldMatrices.GetNumOfElements()*2), false);
+	cNode.m_nWorldMatrixIndex = m_lstWorldMatrices.GetNumOfElements();
+	WorldMatrix &sWorldMatrix = m_lstWorldMatrices.Add();
+	sWorldMatrix.pSceneNode = &cNode;
+	sWorldMatrix.bDirty		= false;
+	sWorldMatrix.bContainer	= cNode.IsContainer();
+
+	// The world matrix of the scene node and all its children (if it's a scene container which was moved into this scene container) need an update
+	cNode.WorldMatrixRefreshRequired();
+
 	// Emit signal
 	cNode.SignalContainer();
 
-	// Setup name
-	String sNameT = sName;
-	if (!sNameT.GetLength() && cNode.m_sName.GetLength())
-		sNameT = cNode.m_sName; // Use it's default name
-
-	// Is there already another scene node with the same name?
-	bool bNameOccupied = false;
-	if (sNameT.GetLength()) {
-		SceneNode *pSceneNode = GetByName(sNameT);
-		if (pSceneNode && pSceneNode != &cNode)
-			bNameOccupied = true; // Sorry, this name is already in use
-	}
-	if (!bNameOccupied && sNameT.GetLength()) {
-		cNode.m_sName = sNameT;
-		m_mapElements.Add(sNameT, &cNode);
-	} else { // Find an unused node name
+	// Setup name, anonymous scene nodes are not within the name lookup
+	if (!cNode.IsAnonymous()) {
+		String sNameT = sName;
+		if (!sNameT.GetLength() && cNode.m_sName.GetLength())
+			sNameT = cNode.m_sName; // Use it's default name
+
+		// Is there already another scene node with the same name?
+		bool bNameOccupied = false;
 		if (sNameT.GetLength()) {
-			for (uint32 i=0; ; i++) {
-				const String sNewName = sNameT + static_cast<int>(i);
-				if (!GetByName(sNewName)) {
-					cNode.m_sName = sNewName;
-					m_mapElements.Add(sNewName, &cNode);
-					break;
+			SceneNode *pSceneNode = GetByName(sNameT);
+			if (pSceneNode && pSceneNode != &cNode)
+				bNameOccupied = true; // Sorry, this name is already in use
+		}
+		if (!bNameOccupied && sNameT.GetLength()) {
+			cNode.m_sName = sNameT;
+			m_mapElements.Add(sNameT, &cNode);
+		} else { // Find an unused node name
+			if (sNameT.GetLength()) {
+				for (uint32 i=0; ; i++) {
+					const String sNewName = sNameT + static_cast<int>(i);
+					if (!GetByName(sNewName)) {
+						cNode.m_sName = sNewName;
+						m_mapElements.Add(sNewName, &cNode);
+						break;
+					}
 				}
-			}
-		} else {
-			for (uint32 i=0; ; i++) {
-				const String sNewName = cNode.GetClass()->GetClassName() + static_cast<int>(i);
-				if (!GetByName(sNewName)) {
-					cNode.m_sName = sNewName;
-					m_mapElements.Add(sNewName, &cNode);
-					break;
+			} else {
+				for (uint32 i=0; ; i++) {
+					const String sNewName = cNode.GetClass()->GetClassName() + static_cast<int>(i);
+					if (!GetByName(sNewName)) {
+						cNode.m_sName = sNewName;
+						m_mapElements.Add(sNewName, &cNode);
+						break;
+					}
 				}
 			}
 		}
@@ -471,15 +578,28 @@ bool SceneContainer::Add(SceneNode &cNode, const String &sName, bool bInitNode,
 */
 bool SceneContainer::Remove(SceneNode &cNode, bool bDeInitNode)
 {
-	// Check the given node
-	if (!m_mapElements.Get(cNode.GetName()))
+	// Check the given node (anonymous scene nodes are not within the name lookup)
+	if (cNode.IsAnonymous() ? (cNode.m_pManager != this) : !m_mapElements.Get(cNode.GetName()))
 		return false; // Error!
 
 	// Remove node
 	if (bDeInitNode)
 		cNode.DeInitSceneNode();
-	m_mapElements.Remove(cNode.GetName());
+	if (!cNode.IsAnonymous())
+		m_mapElements.Remove(cNode.GetName());
 	const bool bResult = m_lstElements.Remove(&cNode);
+
+	// Remove the scene node from the world matrix cache by moving the last world matrix into the free slot
+	const uint32 nLastIndex = m_lstWorldMatrices.GetNumOfElements() - 1;
+	if (cNode.m_nWorldMatrixIndex != nLastIndex) {
+		WorldMatrix &sWorldMatrix = m_lstWorldMatrices[cNode.m_nWorldMatrixIndex];
+		sWorldMatrix = m_lstWorldMatrices[nLastIndex];
+		sWorldMatrix.pSceneNode->m_nWorldMatrixIndex = cNode.m_nWorldMatrixIndex;
+	}
+	if (nLastIndex)
+		m_lstWorldMatrices.RemoveAtIndex(nLastIndex);
+	else
+		m_lstWorldMatrices.Clear(); // Free the memory as soon as the scene container is empty
 	cNode.m_pManager = nullptr;
 
 	// Remove the scene node from the refresh list if required
@@ -494,6 +614,28 @@ bool SceneContainer::Remove(SceneNode &cNode, bool bDeInitNode)
 	return bResult;
 }
 
+/**
+*  @brief
+*    Takes a pooled scene node of the given class from the scene context
+*/
+SceneNode *SceneContainer::GetRecycledSceneNode(const Class &cClass) const
+{
+	return m_pSceneContext ? m_pSceneContext->GetRecycledSceneNode(cClass) : nullptr;
+}
+
+/**
+*  @brief
+*    Adds a scene node created by "Create<AType>()"
+*/
+void SceneContainer::AddCreatedSceneNode(SceneNode &cNode, const String &sName, bool bAnonymous)
+{
+	// See "CreateAtIndex()", there's no debug log in here because this is the fast path
+	cNode.m_pManager = this;
+	if (bAnonymous)
+		cNode.m_nInternalFlags |= SceneNode::Anonymous;
+	Add(cNode, sName);
+}
+
 
 //[-------------------------------------------------------]
 //[ Protected virtual SceneNode functions                 ]
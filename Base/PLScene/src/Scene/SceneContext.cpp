@@ -34,6 +34,7 @@
 #include <PLMesh/MeshManager.h>
 #include "PLScene/Scene/SceneContainer.h"
 #include "PLScene/Scene/SceneNodeHandler.h"
+#include "PLScene/Scene/SceneUpdateScheduler.h"
 #include "PLScene/Visibility/VisManager.h"
 #include "PLScene/Compositing/SceneRendererManager.h"
 #include "PLScene/Scene/SceneContext.h"
@@ -61,8 +62,14 @@ SceneContext::SceneContext(RendererContext &cRendererContext) :
 	m_pMeshManager(nullptr),
 	m_pGraphPathManager(nullptr),
 	m_pRoot(new SceneNodeHandler()),
+	m_nNumOfRecycledSceneNodes(0),
+	m_nMaxNumOfRecycledSceneNodes(1024),
 	m_pSceneRendererManager(nullptr),
 	m_pVisManager(nullptr),
+	m_pUpdateScheduler(nullptr),
+	m_nNumOfWorldMatrixHits(0),
+	m_nNumOfWorldMatrixMisses(0),
+	m_nNumOfWorldMatrixUpdates(0),
 	m_bProcessActive(false),
 	m_nProcessCounter(0)
 {
@@ -85,6 +92,13 @@ SceneContext::~SceneContext()
 	Cleanup();
 	delete m_pRoot;
 
+	// Destroy the pooled scene nodes
+	ClearRecycledSceneNodes();
+
+	// Destroy the update scheduler (after the scene nodes because scene node modifiers are removing themselves from it)
+	if (m_pUpdateScheduler)
+		delete m_pUpdateScheduler;
+
 	// Destroy the scene renderer manager
 	if (m_pSceneRendererManager)
 		delete m_pSceneRendererManager;
@@ -180,6 +194,77 @@ void SceneContext::Cleanup()
 		}
 		m_lstDeleteNodes.Clear();
 	}
+
+	// Reset recycled scene nodes and put them into the pool of their class
+	if (m_lstRecycleNodes.GetNumOfElements()) {
+		{
+			Iterator<SceneNode*> cIterator = m_lstRecycleNodes.GetIterator();
+			while (cIterator.HasNext()) {
+				SceneNode *pSceneNode = cIterator.Next();
+
+				// Get the pool of the scene node class
+				const uint64 nClass = reinterpret_cast<uint64>(pSceneNode->GetClass());
+				Array<SceneNode*> *plstPool = m_mapRecycledNodes.Get(nClass);
+
+				// Put the reset scene node into the pool, if the pool is already full or the scene node can't be reset: Kill it!
+				if ((plstPool ? plstPool->GetNumOfElements() : 0) < m_nMaxNumOfRecycledSceneNodes && pSceneNode->ResetSceneNode()) {
+					if (!plstPool) {
+						plstPool = new Array<SceneNode*>;
+						m_mapRecycledNodes.Add(nClass, plstPool);
+					}
+					plstPool->Add(pSceneNode);
+					m_nNumOfRecycledSceneNodes++;
+				} else {
+					delete pSceneNode;
+				}
+			}
+		}
+		m_lstRecycleNodes.Clear();
+	}
+}
+
+/**
+*  @brief
+*    Returns the number of pooled scene nodes waiting to be reused
+*/
+uint32 SceneContext::GetNumOfRecycledSceneNodes() const
+{
+	return m_nNumOfRecycledSceneNodes;
+}
+
+/**
+*  @brief
+*    Returns the maximum number of pooled scene nodes per scene node class
+*/
+uint32 SceneContext::GetMaxNumOfRecycledSceneNodes() const
+{
+	return m_nMaxNumOfRecycledSceneNodes;
+}
+
+/**
+*  @brief
+*    Sets the maximum number of pooled scene nodes per scene node class
+*/
+void SceneContext::SetMaxNumOfRecycledSceneNodes(uint32 nMaxNumOfRecycledSceneNodes)
+{
+	m_nMaxNumOfRecycledSceneNodes = nMaxNumOfRecycledSceneNodes;
+}
+
+/**
+*  @brief
+*    Destroys all pooled scene nodes
+*/
+void SceneContext::ClearRecycledSceneNodes()
+{
+	Iterator<Array<SceneNode*>*> cIterator = m_mapRecycledNodes.GetIterator();
+	while (cIterator.HasNext()) {
+		Array<SceneNode*> *plstPool = cIterator.Next();
+		for (uint32 i=0; i<plstPool->GetNumOfElements(); i++)
+			delete plstPool->Get(i);
+		delete plstPool;
+	}
+	m_mapRecycledNodes.Clear();
+	m_nNumOfRecycledSceneNodes = 0;
 }
 
 /**
@@ -188,7 +273,7 @@ void SceneContext::Cleanup()
 */
 void SceneContext::Update(bool bRespectPause)
 {
-	// Do only emit the update event when timing currently not paused
+	// Do only perform the update when timing currently not paused
 	if (!Timing::GetInstance()->IsPaused()) {
 		// Perform profiling?
 		Profiling *pProfiling = Profiling::GetInstance();
@@ -196,19 +281,76 @@ void SceneContext::Update(bool bRespectPause)
 			// Start the stopwatch
 			Stopwatch cStopwatch(true);
 
+			// Perform the scheduled update
+			if (m_pUpdateScheduler)
+				m_pUpdateScheduler->Update();
+			const float fScheduledUpdateTime = cStopwatch.GetMilliseconds();
+
 			// Emit event
 			EventUpdate();
 
+			// Recalculate the dirty world matrices
+			const float fWorldMatricesStartTime = cStopwatch.GetMilliseconds();
+			if (m_pRoot->GetElement())
+				static_cast<SceneContainer*>(m_pRoot->GetElement())->UpdateWorldMatrices();
+			const float fWorldMatricesTime = cStopwatch.GetMilliseconds() - fWorldMatricesStartTime;
+
 			// Update the profiling data
-			pProfiling->Set("Scene context", "Update time",		 String::Format("%.3f ms", cStopwatch.GetMilliseconds()));
-			pProfiling->Set("Scene context", "Updated elements", String::Format("%d", EventUpdate.GetNumOfConnects()));
+			pProfiling->Set("Scene context", "Update time",				String::Format("%.3f ms", cStopwatch.GetMilliseconds()));
+			pProfiling->Set("Scene context", "Updated elements",		String::Format("%d", EventUpdate.GetNumOfConnects()));
+			pProfiling->Set("Scene context", "Scheduled update time",	String::Format("%.3f ms", fScheduledUpdateTime));
+			pProfiling->Set("Scene context", "Scheduled elements",		String::Format("%d (%d concurrent)", m_pUpdateScheduler ? m_pUpdateScheduler->GetNumOfModifiers() : 0,
+																							  m_pUpdateScheduler ? m_pUpdateScheduler->GetNumOfConcurrentUpdates() : 0));
+			pProfiling->Set("Scene context", "World matrix update time",	String::Format("%.3f ms", fWorldMatricesTime));
+			pProfiling->Set("Scene context", "World matrix cache",		String::Format("%d hits, %d misses, %d updates", m_nNumOfWorldMatrixHits, m_nNumOfWorldMatrixMisses, m_nNumOfWorldMatrixUpdates));
 		} else {
+			// Perform the scheduled update
+			if (m_pUpdateScheduler)
+				m_pUpdateScheduler->Update();
+
 			// Emit event
 			EventUpdate();
+
+			// Recalculate the dirty world matrices
+			if (m_pRoot->GetElement())
+				static_cast<SceneContainer*>(m_pRoot->GetElement())->UpdateWorldMatrices();
 		}
 	}
 }
 
+/**
+*  @brief
+*    Returns the update scheduler
+*/
+SceneUpdateScheduler &SceneContext::GetUpdateScheduler()
+{
+	if (!m_pUpdateScheduler)
+		m_pUpdateScheduler = new SceneUpdateScheduler();
+	return *m_pUpdateScheduler;
+}
+
+/**
+*  @brief
+*    Returns the world matrix cache statistics
+*/
+void SceneContext::GetWorldMatrixStatistics(uint32 &nHits, uint32 &nMisses, uint32 &nUpdates) const
+{
+	nHits	 = m_nNumOfWorldMatrixHits;
+	nMisses	 = m_nNumOfWorldMatrixMisses;
+	nUpdates = m_nNumOfWorldMatrixUpdates;
+}
+
+/**
+*  @brief
+*    Resets the world matrix cache statistics
+*/
+void SceneContext::ResetWorldMatrixStatistics()
+{
+	m_nNumOfWorldMatrixHits	   = 0;
+	m_nNumOfWorldMatrixMisses  = 0;
+	m_nNumOfWorldMatrixUpdates = 0;
+}
+
 /**
 *  @brief
 *    Returns the scene renderer manager
@@ -296,6 +438,29 @@ bool SceneContext::EndProcess()
 }
 
 
+//[-------------------------------------------------------]
+//[ Private functions                                     ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Takes a pooled scene node of the given class
+*/
+SceneNode *SceneContext::GetRecycledSceneNode(const Class &cClass)
+{
+	Array<SceneNode*> *plstPool = m_mapRecycledNodes.Get(reinterpret_cast<uint64>(&cClass));
+	if (plstPool && plstPool->GetNumOfElements()) {
+		const uint32 nIndex = plstPool->GetNumOfElements() - 1;
+		SceneNode *pSceneNode = plstPool->Get(nIndex);
+		plstPool->RemoveAtIndex(nIndex);
+		m_nNumOfRecycledSceneNodes--;
+		return pSceneNode;
+	}
+
+	// There's no pooled scene node of the given class
+	return nullptr;
+}
+
+
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
 //[-------------------------------------------------------]
@@ -392,6 +392,44 @@ bool SceneNode::IsInitialized() const
 	return ((m_nInternalFlags & Initialized) != 0);
 }
 
+/**
+*  @brief
+*    Recycles this scene node
+*/
+bool SceneNode::Recycle()
+{
+	// Scene containers have children, there's no sense in pooling them
+	SceneContainer *pContainer    = GetContainer();
+	SceneContext   *pSceneContext = pContainer ? pContainer->GetSceneContext() : nullptr;
+	if (IsContainer() || !pSceneContext)
+		return Delete();
+
+	// Already destroyed or protected?
+	if (!(m_nInternalFlags & DestroyThis) && !m_bProtected) {
+		// Set the 'I am going to die'-flag, from the outside the scene node is gone
+		m_nInternalFlags |= DestroyThis;
+
+		// Emit signal
+		SignalDestroy();
+
+		// Remove scene node from scene node container, the scene node is now de-initialized automatically
+		pContainer->Remove(*this);
+
+		// Detach the scene node handlers, they must not see the scene node when it's reused
+		while (GetNumOfHandlers())
+			GetHandler(0)->SetElement();
+
+		// 'SceneContext::Cleanup()' will reset and pool the scene node
+		pSceneContext->m_lstRecycleNodes.Add(this);
+
+		// Done
+		return true;
+	} else {
+		// Error!
+		return false;
+	}
+}
+
 /**
 *  @brief
 *    Returns whether the scene node is active or not
@@ -615,6 +653,33 @@ void SceneNode::MoveTo(const Vector3 &vPosition)
 	}
 }
 
+/**
+*  @brief
+*    Returns the transform matrix from 'scene node space' into 'root space'
+*/
+const Matrix3x4 &SceneNode::GetWorldMatrix()
+{
+	// Is this scene node within a scene container? If not, this is the root scene container and there's nothing above it.
+	SceneContainer *pContainer = GetContainer();
+	if (pContainer) {
+		SceneContainer::WorldMatrix &sWorldMatrix = pContainer->m_lstWorldMatrices[m_nWorldMatrixIndex];
+		if (sWorldMatrix.bDirty) {
+			// Cache miss, the world matrix of the scene container is either up-to-date or recalculated right now
+			sWorldMatrix.mMatrix = pContainer->GetWorldMatrix()*m_cTransform.GetMatrix();
+			sWorldMatrix.bDirty  = false;
+			if (pContainer->m_pSceneContext)
+				pContainer->m_pSceneContext->m_nNumOfWorldMatrixMisses++;
+		} else {
+			// Cache hit
+			if (pContainer->m_pSceneContext)
+				pContainer->m_pSceneContext->m_nNumOfWorldMatrixHits++;
+		}
+		return sWorldMatrix.mMatrix;
+	} else {
+		return m_cTransform.GetMatrix();
+	}
+}
+
 
 //[-------------------------------------------------------]
 //[ Bounding volume                                       ]
@@ -1206,7 +1271,8 @@ SceneNode::SceneNode() :
 	m_nDrawFunctionFlags(UseDrawDebug),
 	m_nCounter(0),
 	m_nInternalFlags(RecalculateContainerAABoundingBox | RecalculateContainerBoundingSphere),
-	m_pFirstSceneHierarchyNodeItem(nullptr)
+	m_pFirstSceneHierarchyNodeItem(nullptr),
+	m_nWorldMatrixIndex(0)
 {
 	// Connect transform event handlers
 	m_cTransform.EventPosition.Connect(EventHandlerPosition);
@@ -1271,6 +1337,16 @@ void SceneNode::DeInitFunction()
 	ClearModifiers();
 }
 
+/**
+*  @brief
+*    This function is called when a recycled scene node gets reset so it can be reused
+*/
+bool SceneNode::ResetFunction()
+{
+	// Derived scene nodes may keep internal state which can't be reset through attributes, so don't pool them by default
+	return false;
+}
+
 /**
 *  @brief
 *    Called when the scene node has been activated or deactivated
@@ -1391,6 +1467,29 @@ void SceneNode::DeInitSceneNode()
 		DeInitFunction();
 }
 
+/**
+*  @brief
+*    Resets the recycled scene node so it can be reused
+*/
+bool SceneNode::ResetSceneNode()
+{
+	// Modifiers are added by the user of the scene node, a reused scene node starts without them
+	ClearModifiers();
+
+	// Set all attributes to their default values, this also resets the transform, flags and bounding box
+	SetDefaultValues();
+
+	// Reset the remaining state to the state of a freshly constructed scene node (the class flags are set by the constructors)
+	m_sName      = "";
+	m_bProtected = false;
+	m_nCounter   = 0;
+	m_nInternalFlags &= ~(Initialized | DestroyThis | Anonymous | HLODProxyNode | RecalculateHierarchy);
+	m_nInternalFlags |= RecalculateContainerAABoundingBox | RecalculateContainerBoundingSphere;
+
+	// Let the scene node reset its internal state
+	return ResetFunction();
+}
+
 /**
 *  @brief
 *    Clones the given scene node
@@ -1458,6 +1557,39 @@ void SceneNode::HierarchyRefreshRequired()
 	}
 }
 
+/**
+*  @brief
+*    Call this function if the scene node transform was changed and the
+*    cached world matrix of this scene node and its children need an update
+*/
+void SceneNode::WorldMatrixRefreshRequired()
+{
+	// Is this scene node within a scene container? (the root scene container has no cached world matrix)
+	SceneContainer *pContainer = GetContainer();
+	if (pContainer) {
+		// If the world matrix is already dirty, the world matrices of all children are dirty as well
+		SceneContainer::WorldMatrix &sWorldMatrix = pContainer->m_lstWorldMatrices[m_nWorldMatrixIndex];
+		if (sWorldMatrix.bDirty)
+			return; // Done
+
+		// Mark the world matrix as dirty
+		sWorldMatrix.bDirty = true;
+
+		// Let the scene container chain know that there's something to do
+		while (pContainer && !pContainer->m_bWorldMatricesDirty) {
+			pContainer->m_bWorldMatricesDirty = true;
+			pContainer = pContainer->GetContainer();
+		}
+	}
+
+	// Propagate to the children
+	if (m_nInternalFlags & ClassContainer) {
+		const SceneContainer &cContainer = static_cast<const SceneContainer&>(*this);
+		for (uint32 i=0; i<cContainer.m_lstElements.GetNumOfElements(); i++)
+			cContainer.m_lstElements[i]->WorldMatrixRefreshRequired();
+	}
+}
+
 /**
 *  @brief
 *    Called on position transform change
@@ -1472,6 +1604,9 @@ void SceneNode::OnPosition()
 
 	// We need a hierarchy refresh for this scene node
 	HierarchyRefreshRequired();
+
+	// The cached world matrix of this scene node and its children need an update
+	WorldMatrixRefreshRequired();
 }
 
 /**
@@ -1488,6 +1623,9 @@ void SceneNode::OnRotation()
 
 	// We need a hierarchy refresh for this scene node
 	HierarchyRefreshRequired();
+
+	// The cached world matrix of this scene node and its children need an update
+	WorldMatrixRefreshRequired();
 }
 
 /**
@@ -1504,6 +1642,9 @@ void SceneNode::OnScale()
 
 	// We need a hierarchy refresh for this scene node
 	HierarchyRefreshRequired();
+
+	// The cached world matrix of this scene node and its children need an update
+	WorldMatrixRefreshRequired();
 }
 
 
@@ -1556,8 +1697,8 @@ bool SceneNode::Delete(bool bProtectedToo)
 
 bool SceneNode::SetName(const String &sName)
 {
-	// Check parameter
-	if (m_sName != sName && sName.GetLength()) {
+	// Check parameter, anonymous scene nodes are not within the name lookup of their scene container and can't be renamed
+	if (m_sName != sName && sName.GetLength() && !(m_nInternalFlags & Anonymous)) {
 		// Is this the root scene node? The name if it can NOT be changed!
 		SceneContext *pSceneContext = GetSceneContext();
 		if (pSceneContext && this == pSceneContext->GetRoot()) {
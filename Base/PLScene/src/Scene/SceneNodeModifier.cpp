@@ -26,6 +26,7 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include <PLCore/Base/Class.h>
+#include "PLScene/Scene/SceneUpdateScheduler.h"
 #include "PLScene/Scene/SceneNodeModifier.h"
 
 
@@ -200,6 +201,44 @@ void SceneNodeModifier::OnActivate(bool bActivate)
 	// The default implementation is empty
 }
 
+/**
+*  @brief
+*    Returns the stage of the scheduled update
+*/
+SceneNodeModifier::EUpdateStage SceneNodeModifier::GetUpdateStage() const
+{
+	// The default implementation returns "UpdateStageAnimation"
+	return UpdateStageAnimation;
+}
+
+/**
+*  @brief
+*    Returns the data the scheduled update is accessing
+*/
+uint32 SceneNodeModifier::GetUpdateAccess() const
+{
+	// The default implementation returns "MainThread"
+	return MainThread;
+}
+
+/**
+*  @brief
+*    Computes the scheduled update
+*/
+void SceneNodeModifier::OnUpdateCompute()
+{
+	// The default implementation is empty
+}
+
+/**
+*  @brief
+*    Applies the result of the scheduled update computation
+*/
+void SceneNodeModifier::OnUpdateApply()
+{
+	// The default implementation is empty
+}
+
 
 //[-------------------------------------------------------]
 //[ Protected functions                                   ]
@@ -211,7 +250,10 @@ void SceneNodeModifier::OnActivate(bool bActivate)
 SceneNodeModifier::SceneNodeModifier(SceneNode &cSceneNode) :
 	Flags(this),
 	m_nFlags(0),
-	m_pSceneNode(&cSceneNode)
+	m_pSceneNode(&cSceneNode),
+	m_pUpdateScheduler(nullptr),
+	m_nUpdateStage(0),
+	m_nUpdateIndex(0)
 {
 }
 
@@ -221,6 +263,9 @@ SceneNodeModifier::SceneNodeModifier(SceneNode &cSceneNode) :
 */
 SceneNodeModifier::~SceneNodeModifier()
 {
+	// Remove this scene node modifier from the update scheduler
+	if (m_pUpdateScheduler)
+		m_pUpdateScheduler->Remove(*this);
 }
 
 
@@ -0,0 +1,598 @@
+/*********************************************************\
+ *  File: SNMCellStreaming.cpp                           *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <PLCore/Log/Log.h>
+#include <PLCore/File/File.h>
+#include <PLCore/System/Mutex.h>
+#include <PLCore/System/Thread.h>
+#include <PLCore/System/Semaphore.h>
+#include <PLCore/Container/HashMap.h>
+#include <PLCore/Tools/LoadableManager.h>
+#include "PLScene/Scene/SCCell.h"
+#include "PLScene/Scene/SceneContext.h"
+#include "PLScene/Scene/SNCellPortal.h"
+#include "PLScene/Scene/SceneNodeHandler.h"
+#include "PLScene/Scene/SceneNodeModifiers/SNMCellStreaming.h"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+using namespace PLCore;
+using namespace PLMath;
+namespace PLScene {
+
+
+//[-------------------------------------------------------]
+//[ Structures                                            ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Cell which is loaded or loading
+*/
+struct SNMCellStreaming::CellEntry {
+	SceneNodeHandler  cCell;		/**< The cell */
+	File			 *pFile;		/**< Opened sub-scene file, memory buffered as soon as it has been read, null pointer once the cell has been instanced */
+	uint32			  nSize;		/**< Estimated memory in bytes */
+	float			  fDistance;	/**< Current portal distance, negative if the cell is out of reach */
+	bool			  bRead;		/**< Has the sub-scene file been read? */
+	bool			  bCancelled;	/**< Loading has been cancelled, remove the entry as soon as the sub-scene file has been read */
+};
+
+/**
+*  @brief
+*    Scene container reached through cell-portals
+*/
+struct ContainerDistance {
+	SceneContainer *pContainer;	/**< Reached scene container, always valid */
+	Vector3			vPosition;	/**< Nearest entry point, in scene container space */
+	float			fDistance;	/**< Portal distance */
+	bool			bVisited;	/**< Have the cell-portals within the scene container been visited? */
+
+	bool operator ==(const ContainerDistance &sOther) const
+	{
+		return (pContainer == sOther.pContainer);
+	}
+};
+
+
+//[-------------------------------------------------------]
+//[ RTTI interface                                        ]
+//[-------------------------------------------------------]
+pl_class_metadata(SNMCellStreaming, "PLScene", PLScene::SceneNodeModifier, "Cell streaming scene node modifier class")
+	// Constructors
+	pl_constructor_1_metadata(ParameterConstructor,	SceneNode&,	"Parameter constructor",	"")
+	// Attributes
+	pl_attribute_metadata(LoadDistance,			float,			100.0f,		ReadWrite,	"Portal distance at which the streamed contents of a cell are loaded",											"Min='0.0'")
+	pl_attribute_metadata(UnloadDistance,		float,			150.0f,		ReadWrite,	"Portal distance at which the streamed contents of a cell are unloaded, should be greater than the load distance",	"Min='0.0'")
+	pl_attribute_metadata(MemoryBudget,			PLCore::uint32,	67108864,	ReadWrite,	"Maximum estimated memory in bytes used by the streamed contents",												"")
+	pl_attribute_metadata(MaxLoadsPerUpdate,	PLCore::uint32,	1,			ReadWrite,	"Maximum number of cells instanced per update",																	"Min='1'")
+	pl_attribute_metadata(NumOfThreads,			PLCore::uint32,	1,			ReadWrite,	"Number of background threads reading the sub-scene files, 0 to read them on the main thread",					"")
+	// Slots
+	pl_slot_0_metadata(OnUpdate,	"Called when the scene node modifier needs to be updated",	"")
+pl_class_metadata_end(SNMCellStreaming)
+
+
+//[-------------------------------------------------------]
+//[ Public RTTI get/set functions                         ]
+//[-------------------------------------------------------]
+uint32 SNMCellStreaming::GetNumOfThreads() const
+{
+	return m_nNumOfThreads;
+}
+
+void SNMCellStreaming::SetNumOfThreads(uint32 nValue)
+{
+	if (m_nNumOfThreads != nValue) {
+		// The background threads are started again as soon as they're required
+		StopThreads();
+		m_nNumOfThreads = nValue;
+	}
+}
+
+
+//[-------------------------------------------------------]
+//[ Public functions                                      ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Constructor
+*/
+SNMCellStreaming::SNMCellStreaming(SceneNode &cSceneNode) : SceneNodeModifier(cSceneNode),
+	LoadDistance(this),
+	UnloadDistance(this),
+	MemoryBudget(this),
+	MaxLoadsPerUpdate(this),
+	NumOfThreads(this),
+	SlotOnUpdate(this),
+	m_nNumOfThreads(1),
+	m_nMemoryUsage(0),
+	m_pMutex(new Mutex()),
+	m_pSemaphore(new Semaphore(0, 0x7fffffff)),
+	m_bShutdown(false)
+{
+}
+
+/**
+*  @brief
+*    Destructor
+*/
+SNMCellStreaming::~SNMCellStreaming()
+{
+	// Stop the background threads
+	StopThreads();
+
+	// Destroy the cell entries, loaded streamed contents stay within the cells
+	for (uint32 i=0; i<m_lstCells.GetNumOfElements(); i++) {
+		CellEntry *pEntry = m_lstCells[i];
+		if (pEntry->pFile)
+			delete pEntry->pFile;
+		delete pEntry;
+	}
+
+	// Destroy the synchronization objects
+	delete m_pSemaphore;
+	delete m_pMutex;
+}
+
+/**
+*  @brief
+*    Returns the number of cells with loaded streamed contents
+*/
+uint32 SNMCellStreaming::GetNumOfLoadedCells() const
+{
+	uint32 nNumOfCells = 0;
+	for (uint32 i=0; i<m_lstCells.GetNumOfElements(); i++) {
+		if (!m_lstCells[i]->pFile && !m_lstCells[i]->bCancelled)
+			nNumOfCells++;
+	}
+	return nNumOfCells;
+}
+
+/**
+*  @brief
+*    Returns the number of cells which are currently read in the background or waiting to be instanced
+*/
+uint32 SNMCellStreaming::GetNumOfLoadingCells() const
+{
+	uint32 nNumOfCells = 0;
+	for (uint32 i=0; i<m_lstCells.GetNumOfElements(); i++) {
+		if (m_lstCells[i]->pFile && !m_lstCells[i]->bCancelled)
+			nNumOfCells++;
+	}
+	return nNumOfCells;
+}
+
+/**
+*  @brief
+*    Returns the estimated memory used by the streamed contents
+*/
+uint32 SNMCellStreaming::GetMemoryUsage() const
+{
+	return m_nMemoryUsage;
+}
+
+
+//[-------------------------------------------------------]
+//[ Protected virtual SceneNodeModifier functions         ]
+//[-------------------------------------------------------]
+void SNMCellStreaming::OnActivate(bool bActivate)
+{
+	// Connect/disconnect event handler
+	SceneContext *pSceneContext = GetSceneContext();
+	if (pSceneContext) {
+		if (bActivate) {
+			pSceneContext->EventUpdate.Connect(SlotOnUpdate);
+		} else {
+			pSceneContext->EventUpdate.Disconnect(SlotOnUpdate);
+
+			// The background threads are started again as soon as they're required
+			StopThreads();
+		}
+	}
+}
+
+
+//[-------------------------------------------------------]
+//[ Private static functions                              ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Background thread function reading the requested sub-scene files into memory
+*/
+int SNMCellStreaming::ReadThreadFunction(void *pData)
+{
+	SNMCellStreaming &cThis = *static_cast<SNMCellStreaming*>(pData);
+
+	// Wait for requests
+	while (cThis.m_pSemaphore->Lock()) {
+		// Process all queued requests, there may be more requests than semaphore signals
+		for (;;) {
+			// Get the next queued cell
+			CellEntry *pEntry = nullptr;
+			cThis.m_pMutex->Lock();
+			const bool bShutdown = cThis.m_bShutdown;
+			if (!bShutdown && cThis.m_lstQueue.GetNumOfElements()) {
+				pEntry = cThis.m_lstQueue[0];
+				cThis.m_lstQueue.RemoveAtIndex(0);
+			}
+			cThis.m_pMutex->Unlock();
+			if (bShutdown)
+				return 0; // Done
+			if (!pEntry)
+				break;
+
+			// Read the whole sub-scene file into memory, this is the part which would stall the main thread
+			pEntry->pFile->Open(File::FileRead | File::FileMemBuf);
+
+			// Hand the cell back to the main thread
+			cThis.m_pMutex->Lock();
+			cThis.m_lstRead.Add(pEntry);
+			cThis.m_pMutex->Unlock();
+		}
+	}
+
+	// Done
+	return 0;
+}
+
+
+//[-------------------------------------------------------]
+//[ Private functions                                     ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Called when the scene node modifier needs to be updated
+*/
+void SNMCellStreaming::OnUpdate()
+{
+	// Read the queued sub-scene files on the main thread if there are no background threads (no locking required)
+	if (!m_lstThreads.GetNumOfElements() && m_lstQueue.GetNumOfElements()) {
+		for (uint32 i=0; i<m_lstQueue.GetNumOfElements(); i++) {
+			m_lstQueue[i]->pFile->Open(File::FileRead | File::FileMemBuf);
+			m_lstRead.Add(m_lstQueue[i]);
+		}
+		m_lstQueue.Reset();
+	}
+
+	// Take over the cells read by the background threads
+	m_pMutex->Lock();
+	for (uint32 i=0; i<m_lstRead.GetNumOfElements(); i++)
+		m_lstRead[i]->bRead = true;
+	m_lstRead.Reset();
+	m_pMutex->Unlock();
+
+	// Get the portal distances of all cells within reach
+	Array<SCCell*> lstCells;
+	Array<float> lstDistances;
+	UpdateDistances(lstCells, lstDistances);
+	HashMap<uint64, uint32> mapCells;
+	for (uint32 i=0; i<lstCells.GetNumOfElements(); i++)
+		mapCells.Add(reinterpret_cast<uint64>(lstCells[i]), i + 1);	// 0 means "not found"
+
+	// Update the distances of the known cells and unload the cells which are out of reach
+	for (uint32 i=m_lstCells.GetNumOfElements(); i>0; ) {
+		i--;
+		CellEntry &sEntry = *m_lstCells[i];
+		SCCell    *pCell  = static_cast<SCCell*>(sEntry.cCell.GetElement());
+		const uint32 nCell = pCell ? mapCells.Get(reinterpret_cast<uint64>(pCell)) : 0;
+		if (nCell) {
+			sEntry.fDistance = lstDistances[nCell - 1];
+			lstDistances[nCell - 1] = -1.0f;	// Mark as known
+		} else {
+			sEntry.fDistance = -1.0f;
+		}
+
+		// Remove cancelled cells as soon as they're no longer used by the background threads
+		if (sEntry.bCancelled) {
+			if (sEntry.bRead)
+				RemoveEntry(i);
+		} else {
+			float fLoadDistance;
+			if (!pCell || sEntry.fDistance < 0.0f || sEntry.fDistance > GetCellDistances(*pCell, fLoadDistance))
+				Unload(i);
+		}
+	}
+
+	// Instance the nearest read cells
+	for (uint32 nLoads=0; nLoads<MaxLoadsPerUpdate.Get(); nLoads++) {
+		// Get the nearest read cell
+		CellEntry *pNearest = nullptr;
+		for (uint32 i=0; i<m_lstCells.GetNumOfElements(); i++) {
+			CellEntry *pEntry = m_lstCells[i];
+			if (pEntry->bRead && pEntry->pFile && !pEntry->bCancelled && (!pNearest || pEntry->fDistance < pNearest->fDistance))
+				pNearest = pEntry;
+		}
+		if (!pNearest)
+			break;
+
+		// Create the scene nodes, the file has already been read into memory
+		SCCell *pCell = static_cast<SCCell*>(pNearest->cCell.GetElement());
+		if (!pCell->LoadStreamedContents(*pNearest->pFile))
+			PL_LOG(Error, "Failed to load the streamed contents of the cell '" + pCell->GetAbsoluteName() + "' from '" + pCell->GetStreamFilename() + '\'')
+		delete pNearest->pFile;
+		pNearest->pFile = nullptr;
+	}
+
+	// Request the nearest cells within load distance, unknown cells are the ones with a non-negative distance
+	for (;;) {
+		// Get the nearest unknown cell within its load distance
+		uint32 nNearest = lstCells.GetNumOfElements();
+		for (uint32 i=0; i<lstCells.GetNumOfElements(); i++) {
+			float fLoadDistance;
+			GetCellDistances(*lstCells[i], fLoadDistance);
+			if (lstDistances[i] >= 0.0f && lstDistances[i] <= fLoadDistance && (nNearest == lstCells.GetNumOfElements() || lstDistances[i] < lstDistances[nNearest]))
+				nNearest = i;
+		}
+		if (nNearest == lstCells.GetNumOfElements())
+			break;
+		SCCell &cCell = *lstCells[nNearest];
+		const float fDistance = lstDistances[nNearest];
+		lstDistances[nNearest] = -1.0f;	// Mark as known
+
+		// Open the sub-scene file, it's read later on by a background thread
+		File *pFile = new File();
+		uint32 nSize = 0;
+		if (LoadableManager::GetInstance()->OpenFile(*pFile, cCell.GetStreamFilename(), false)) {
+			nSize = pFile->GetSize();
+		} else {
+			// The entry is added nevertheless so we don't try it over and over again
+			PL_LOG(Error, "Failed to open the streamed contents '" + cCell.GetStreamFilename() + "' of the cell '" + cCell.GetAbsoluteName() + '\'')
+			delete pFile;
+			pFile = nullptr;
+		}
+
+		// Make room within the memory budget by unloading the farthest cells which are farther away than this cell
+		while (m_nMemoryUsage + nSize > MemoryBudget.Get()) {
+			uint32 nFarthest = m_lstCells.GetNumOfElements();
+			for (uint32 i=0; i<m_lstCells.GetNumOfElements(); i++) {
+				const CellEntry &sEntry = *m_lstCells[i];
+				if ((sEntry.bRead || !sEntry.pFile) && !sEntry.bCancelled && sEntry.fDistance > fDistance &&
+					(nFarthest == m_lstCells.GetNumOfElements() || sEntry.fDistance > m_lstCells[nFarthest]->fDistance))
+					nFarthest = i;
+			}
+			if (nFarthest == m_lstCells.GetNumOfElements())
+				break;
+			Unload(nFarthest);
+		}
+		if (m_nMemoryUsage + nSize > MemoryBudget.Get()) {
+			// There's no room for this cell, try it again as soon as closer cells have been unloaded
+			if (pFile)
+				delete pFile;
+			break;
+		}
+
+		// Add the cell
+		CellEntry *pEntry = new CellEntry;
+		pEntry->cCell.SetElement(&cCell);
+		pEntry->pFile      = pFile;
+		pEntry->nSize      = nSize;
+		pEntry->fDistance  = fDistance;
+		pEntry->bRead      = !pFile;
+		pEntry->bCancelled = false;
+		m_lstCells.Add(pEntry);
+		m_nMemoryUsage += nSize;
+
+		// Request reading the sub-scene file
+		if (pFile) {
+			if (!m_lstThreads.GetNumOfElements())
+				StartThreads();
+			m_pMutex->Lock();
+			m_lstQueue.Add(pEntry);
+			m_pMutex->Unlock();
+			m_pSemaphore->Unlock();
+		}
+	}
+}
+
+/**
+*  @brief
+*    Starts the background threads
+*/
+void SNMCellStreaming::StartThreads()
+{
+	m_bShutdown = false;
+	for (uint32 i=0; i<m_nNumOfThreads; i++) {
+		Thread *pThread = new Thread(ReadThreadFunction, this);
+		pThread->SetName("Cell streaming");
+		if (pThread->Start()) {
+			m_lstThreads.Add(pThread);
+		} else {
+			// Error! Without background threads, the sub-scene files are read on the main thread.
+			delete pThread;
+		}
+	}
+}
+
+/**
+*  @brief
+*    Stops the background threads
+*/
+void SNMCellStreaming::StopThreads()
+{
+	if (m_lstThreads.GetNumOfElements()) {
+		// Tell the background threads to stop
+		m_pMutex->Lock();
+		m_bShutdown = true;
+		m_pMutex->Unlock();
+		for (uint32 i=0; i<m_lstThreads.GetNumOfElements(); i++)
+			m_pSemaphore->Unlock();
+
+		// Wait until the background threads are done
+		for (uint32 i=0; i<m_lstThreads.GetNumOfElements(); i++) {
+			m_lstThreads[i]->Join();
+			delete m_lstThreads[i];
+		}
+		m_lstThreads.Clear();
+		m_bShutdown = false;
+	}
+}
+
+/**
+*  @brief
+*    Updates the portal distances of all cells within reach
+*/
+void SNMCellStreaming::UpdateDistances(Array<SCCell*> &lstCells, Array<float> &lstDistances)
+{
+	// Get the scene container the owner scene node is in
+	SceneContainer *pContainer = GetSceneNode().GetContainer();
+	if (pContainer) {
+		// Cells farther away are neither loaded nor kept loaded
+		const float fMaxDistance = Math::Max(LoadDistance.Get(), UnloadDistance.Get());
+
+		// Start at the owner scene node
+		Array<ContainerDistance> lstContainers;
+		HashMap<uint64, uint32> mapContainers;
+		ContainerDistance &sStart = lstContainers.Add();
+		sStart.pContainer = pContainer;
+		sStart.vPosition  = GetSceneNode().GetTransform().GetPosition();
+		sStart.fDistance  = 0.0f;
+		sStart.bVisited   = false;
+		mapContainers.Add(reinterpret_cast<uint64>(pContainer), 1);	// 0 means "not found"
+
+		// Visit the scene containers ordered by their portal distance (Dijkstra)
+		for (;;) {
+			// Get the nearest not yet visited scene container
+			uint32 nNearest = lstContainers.GetNumOfElements();
+			for (uint32 i=0; i<lstContainers.GetNumOfElements(); i++) {
+				const ContainerDistance &sContainer = lstContainers[i];
+				if (!sContainer.bVisited && (nNearest == lstContainers.GetNumOfElements() || sContainer.fDistance < lstContainers[nNearest].fDistance))
+					nNearest = i;
+			}
+			if (nNearest == lstContainers.GetNumOfElements())
+				break;
+			lstContainers[nNearest].bVisited = true;
+			SceneContainer &cContainer = *lstContainers[nNearest].pContainer;
+			const Vector3   vPosition  = lstContainers[nNearest].vPosition;
+			const float     fDistance  = lstContainers[nNearest].fDistance;
+
+			// Is this a cell with streamed contents?
+			if (cContainer.IsCell() && static_cast<SCCell&>(cContainer).GetStreamFilename().GetLength()) {
+				lstCells.Add(&static_cast<SCCell&>(cContainer));
+				lstDistances.Add(fDistance);
+			}
+
+			// Follow the cell-portals, closed cell-portals included because they may be opened at any time
+			for (uint32 i=0; i<cContainer.GetNumOfElements(); i++) {
+				SceneNode *pSceneNode = cContainer.GetByIndex(i);
+				if (pSceneNode->IsPortal() && pSceneNode->IsActive() && pSceneNode->IsInstanceOf("PLScene::SNCellPortal")) {
+					SNCellPortal &cCellPortal = static_cast<SNCellPortal&>(*pSceneNode);
+					SCCell *pCell = cCellPortal.GetTargetCellInstance();
+					if (pCell) {
+						// The distance to a cell-portal is the distance to the nearest point of its bounding box
+						const AABoundingBox &cBox = cCellPortal.GetContainerAABoundingBox();
+						const Vector3 vPortal(Math::ClampToInterval(vPosition.x, cBox.vMin.x, cBox.vMax.x),
+											  Math::ClampToInterval(vPosition.y, cBox.vMin.y, cBox.vMax.y),
+											  Math::ClampToInterval(vPosition.z, cBox.vMin.z, cBox.vMax.z));
+						const float fPortalDistance = fDistance + (vPortal - vPosition).GetLength();
+						if (fPortalDistance <= fMaxDistance) {
+							const uint32 nContainer = mapContainers.Get(reinterpret_cast<uint64>(pCell));
+							if (nContainer) {
+								ContainerDistance &sContainer = lstContainers[nContainer - 1];
+								if (!sContainer.bVisited && fPortalDistance < sContainer.fDistance) {
+									sContainer.vPosition = cCellPortal.GetWarpMatrix()*vPortal;
+									sContainer.fDistance = fPortalDistance;
+								}
+							} else {
+								ContainerDistance &sContainer = lstContainers.Add();
+								sContainer.pContainer = pCell;
+								sContainer.vPosition  = cCellPortal.GetWarpMatrix()*vPortal;
+								sContainer.fDistance  = fPortalDistance;
+								sContainer.bVisited   = false;
+								mapContainers.Add(reinterpret_cast<uint64>(pCell), lstContainers.GetNumOfElements());
+							}
+						}
+					}
+				}
+			}
+		}
+	}
+}
+
+/**
+*  @brief
+*    Unloads a cell, or cancels its loading
+*/
+void SNMCellStreaming::Unload(uint32 nEntry)
+{
+	CellEntry &sEntry = *m_lstCells[nEntry];
+	if (!sEntry.bCancelled) {
+		if (sEntry.bRead) {
+			// Read or instanced, unload the streamed contents in case they have been instanced
+			if (!sEntry.pFile) {
+				SCCell *pCell = static_cast<SCCell*>(sEntry.cCell.GetElement());
+				if (pCell)
+					pCell->UnloadStreamedContents();
+			}
+			RemoveEntry(nEntry);
+		} else {
+			// Still queued or currently read by a background thread
+			m_pMutex->Lock();
+			const bool bQueued = m_lstQueue.Remove(&sEntry);
+			m_pMutex->Unlock();
+			if (bQueued)
+				RemoveEntry(nEntry);
+			else
+				sEntry.bCancelled = true;
+		}
+	}
+}
+
+/**
+*  @brief
+*    Removes a cell entry which is neither queued nor read by a background thread
+*/
+void SNMCellStreaming::RemoveEntry(uint32 nEntry)
+{
+	CellEntry *pEntry = m_lstCells[nEntry];
+	if (pEntry->pFile)
+		delete pEntry->pFile;
+	m_nMemoryUsage -= pEntry->nSize;
+	m_lstCells.RemoveAtIndex(nEntry);
+	delete pEntry;
+}
+
+/**
+*  @brief
+*    Returns the unload distance of a cell
+*/
+float SNMCellStreaming::GetCellDistances(const SCCell &cCell, float &fLoadDistance) const
+{
+	// Cells which are never drawn farther away don't need to be loaded earlier
+	fLoadDistance = LoadDistance.Get();
+	if (cCell.MaxDrawDistance.Get() > 0.0f && cCell.MaxDrawDistance.Get() < fLoadDistance)
+		fLoadDistance = cCell.MaxDrawDistance.Get();
+
+	// The hysteresis between loading and unloading is the same for all cells
+	return fLoadDistance + Math::Max(UnloadDistance.Get() - LoadDistance.Get(), 0.0f);
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // PLScene
@@ -27,6 +27,7 @@
 //[-------------------------------------------------------]
 #include <PLCore/Tools/Timing.h>
 #include "PLScene/Scene/SceneContext.h"
+#include "PLScene/Scene/SceneUpdateScheduler.h"
 #include "PLScene/Scene/SceneNodeModifiers/SNMPositionLinearAnimation.h"
 
 
@@ -62,7 +63,7 @@ SNMPositionLinearAnimation::SNMPositionLinearAnimation(SceneNode &cSceneNode) :
 	AutoVector(this),
 	Vector(this),
 	Speed(this),
-	EventHandlerUpdate(&SNMPositionLinearAnimation::OnUpdate, this)
+	m_bApply(false)
 {
 }
 
@@ -80,28 +81,26 @@ SNMPositionLinearAnimation::~SNMPositionLinearAnimation()
 //[-------------------------------------------------------]
 void SNMPositionLinearAnimation::OnActivate(bool bActivate)
 {
-	// Connect/disconnect event handler
+	// Add/remove to/from the update scheduler
 	SceneContext *pSceneContext = GetSceneContext();
 	if (pSceneContext) {
 		if (bActivate)
-			pSceneContext->EventUpdate.Connect(EventHandlerUpdate);
+			pSceneContext->GetUpdateScheduler().Add(*this);
 		else
-			pSceneContext->EventUpdate.Disconnect(EventHandlerUpdate);
+			pSceneContext->GetUpdateScheduler().Remove(*this);
 	}
 }
 
+uint32 SNMPositionLinearAnimation::GetUpdateAccess() const
+{
+	// Only the transform of the owner scene node is read and written
+	return ReadTransform | WriteTransform;
+}
 
-//[-------------------------------------------------------]
-//[ Private functions                                     ]
-//[-------------------------------------------------------]
-/**
-*  @brief
-*    Called when the scene node modifier needs to be updated
-*/
-void SNMPositionLinearAnimation::OnUpdate()
+void SNMPositionLinearAnimation::OnUpdateCompute()
 {
 	// Get the scene node
-	SceneNode &cSceneNode = GetSceneNode();
+	const SceneNode &cSceneNode = GetSceneNode();
 
 	// Get movement vector
 	Vector3 vVector;
@@ -126,9 +125,17 @@ void SNMPositionLinearAnimation::OnUpdate()
 	// Apply vector, speed and time difference
 	const Vector3 vPosInc = vVector*Speed*Timing::GetInstance()->GetTimeDifference();
 
+	// Calculate the new position
+	m_bApply = !vPosInc.IsNull();
+	if (m_bApply)
+		m_vPosition = cSceneNode.GetTransform().GetPosition()-vPosInc;
+}
+
+void SNMPositionLinearAnimation::OnUpdateApply()
+{
 	// 'Move' to the new position
-	if (!vPosInc.IsNull())
-		cSceneNode.MoveTo(cSceneNode.GetTransform().GetPosition()-vPosInc);
+	if (m_bApply)
+		GetSceneNode().MoveTo(m_vPosition);
 }
 
 
@@ -26,7 +26,6 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include <PLCore/Tools/Timing.h>
-#include <PLCore/Container/Stack.h>
 #include "PLScene/Scene/SceneContext.h"
 #include "PLScene/Scene/SceneContainer.h"
 #include "PLScene/Scene/SceneNodeModifiers/SNMPositionMoveToTarget.h"
@@ -116,25 +115,11 @@ bool SNMPositionMoveToTarget::GetTargetPosition(Vector3 &vPos) const
 
 	// Are we in luck and the target is within the same container as the owner node?
 	if (GetSceneNode().GetContainer() != pTarget->GetContainer()) {
-		// Nope, we have to translate the position into the correct space :(
-		SceneContainer *pContainer = pTarget->GetContainer();
-		while (pContainer) {
-			vPos *= pContainer->GetTransform().GetMatrix();
-			pContainer = pContainer->GetContainer();
-		}
-
-		// To container space of the owner node
-		pContainer = GetSceneNode().GetContainer();
-		Stack<SceneContainer*> lstStack;
-		while (pContainer) {
-			lstStack.Push(pContainer);
-			pContainer = pContainer->GetContainer();
-		}
-		while (lstStack.GetNumOfElements()) {
-			pContainer = lstStack.Top();
-			lstStack.Pop();
-			vPos *= pContainer->GetTransform().GetInverseMatrix();
-		}
+		// Nope, we have to translate the position into the correct space by using the cached world matrices :(
+		if (pTarget->GetContainer())
+			vPos *= pTarget->GetContainer()->GetWorldMatrix();
+		if (GetSceneNode().GetContainer())
+			vPos *= GetSceneNode().GetContainer()->GetWorldMatrix().GetInverted();
 	}
 
 	// Done
@@ -40,6 +40,7 @@
 #include "PLScene/Visibility/SQCull.h"
 #include "PLScene/Visibility/VisContainer.h"
 #include "PLScene/Scene/SceneContext.h"
+#include "PLScene/Scene/SceneUpdateScheduler.h"
 #include "PLScene/Scene/SceneNodeModifiers/SNMPositionPath.h"
 
 
@@ -116,9 +117,9 @@ SNMPositionPath::SNMPositionPath(SceneNode &cSceneNode) : SNMTransform(cSceneNod
 	Speed(this),
 	Interpolation(this),
 	Flags(this),
-	EventHandlerUpdate	 (&SNMPositionPath::OnUpdate,    this),
 	EventHandlerDrawDebug(&SNMPositionPath::OnDrawDebug, this),
-	m_pPathHandler(new GraphPathHandler())
+	m_pPathHandler(new GraphPathHandler()),
+	m_bApply(false)
 {
 }
 
@@ -154,40 +155,51 @@ void SNMPositionPath::OnActivate(bool bActivate)
 		cSceneNode.SignalDrawDebug.Connect(EventHandlerDrawDebug);
 		SceneContext *pSceneContext = GetSceneContext();
 		if (pSceneContext)
-			pSceneContext->EventUpdate.Connect(EventHandlerUpdate);
+			pSceneContext->GetUpdateScheduler().Add(*this);
 
 		// Make a first update to ensure everything is up-to-date when we're going active (synchronization and logic update)
-		OnUpdate();
+		OnUpdateCompute();
+		OnUpdateApply();
 	} else {
 		// Disconnect event handlers
 		cSceneNode.SignalDrawDebug.Disconnect(EventHandlerDrawDebug);
 		SceneContext *pSceneContext = GetSceneContext();
 		if (pSceneContext)
-			pSceneContext->EventUpdate.Disconnect(EventHandlerUpdate);
+			pSceneContext->GetUpdateScheduler().Remove(*this);
 	}
 }
 
+uint32 SNMPositionPath::GetUpdateAccess() const
+{
+	// Only the position of the owner scene node is written, the path itself is never changed during the update
+	return WriteTransform;
+}
 
-//[-------------------------------------------------------]
-//[ Private data                                          ]
-//[-------------------------------------------------------]
-/**
-*  @brief
-*    Called when the scene node modifier needs to be updated
-*/
-void SNMPositionPath::OnUpdate()
+void SNMPositionPath::OnUpdateCompute()
 {
-	// Move the node on the path
+	// Calculate the new position on the path
 	const GraphPath *pPath = m_pPathHandler->GetResource();
-	if (pPath) {
+	m_bApply = (pPath != nullptr);
+	if (m_bApply) {
 		Progress = Progress + Speed*Timing::GetInstance()->GetTimeDifference();
 		if (GetFlags() & NodeIndexProgress)
-			GetSceneNode().MoveTo(pPath->GetPosByNodeIndex(Progress, (Interpolation == Linear)));
+			m_vPosition = pPath->GetPosByNodeIndex(Progress, (Interpolation == Linear));
 		else
-			GetSceneNode().MoveTo(pPath->GetPosByPercentageAlongPath(Progress, (Interpolation == Linear)));
+			m_vPosition = pPath->GetPosByPercentageAlongPath(Progress, (Interpolation == Linear));
 	}
 }
 
+void SNMPositionPath::OnUpdateApply()
+{
+	// Move the node on the path
+	if (m_bApply)
+		GetSceneNode().MoveTo(m_vPosition);
+}
+
+
+//[-------------------------------------------------------]
+//[ Private data                                          ]
+//[-------------------------------------------------------]
 /**
 *  @brief
 *    Called on scene node debug draw
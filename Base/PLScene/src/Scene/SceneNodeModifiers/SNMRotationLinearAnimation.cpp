@@ -28,6 +28,7 @@
 #include <PLCore/Tools/Timing.h>
 #include <PLMath/EulerAngles.h>
 #include "PLScene/Scene/SceneContext.h"
+#include "PLScene/Scene/SceneUpdateScheduler.h"
 #include "PLScene/Scene/SceneNodeModifiers/SNMRotationLinearAnimation.h"
 
 
@@ -59,7 +60,7 @@ pl_class_metadata_end(SNMRotationLinearAnimation)
 */
 SNMRotationLinearAnimation::SNMRotationLinearAnimation(SceneNode &cSceneNode) : SNMTransform(cSceneNode),
 	Velocity(this),
-	EventHandlerUpdate(&SNMRotationLinearAnimation::OnUpdate, this)
+	m_bApply(false)
 {
 }
 
@@ -77,28 +78,27 @@ SNMRotationLinearAnimation::~SNMRotationLinearAnimation()
 //[-------------------------------------------------------]
 void SNMRotationLinearAnimation::OnActivate(bool bActivate)
 {
-	// Connect/disconnect event handler
+	// Add/remove to/from the update scheduler
 	SceneContext *pSceneContext = GetSceneContext();
 	if (pSceneContext) {
 		if (bActivate)
-			pSceneContext->EventUpdate.Connect(EventHandlerUpdate);
+			pSceneContext->GetUpdateScheduler().Add(*this);
 		else
-			pSceneContext->EventUpdate.Disconnect(EventHandlerUpdate);
+			pSceneContext->GetUpdateScheduler().Remove(*this);
 	}
 }
 
+uint32 SNMRotationLinearAnimation::GetUpdateAccess() const
+{
+	// Only the transform of the owner scene node is read and written
+	return ReadTransform | WriteTransform;
+}
 
-//[-------------------------------------------------------]
-//[ Private functions                                     ]
-//[-------------------------------------------------------]
-/**
-*  @brief
-*    Called when the scene node modifier needs to be updated
-*/
-void SNMRotationLinearAnimation::OnUpdate()
+void SNMRotationLinearAnimation::OnUpdateCompute()
 {
 	// Is the velocity not null?
-	if (!Velocity.Get().IsNull()) {
+	m_bApply = !Velocity.Get().IsNull();
+	if (m_bApply) {
 		// Get rotation increase in Euler angles (degree)
 		Vector3 vRot = Velocity.Get();
 		vRot *= Timing::GetInstance()->GetTimeDifference();
@@ -107,11 +107,18 @@ void SNMRotationLinearAnimation::OnUpdate()
 		Quaternion qRot;
 		EulerAngles::ToQuaternion(static_cast<float>(vRot.x*Math::DegToRad), static_cast<float>(vRot.y*Math::DegToRad), static_cast<float>(vRot.z*Math::DegToRad), qRot);
 
-		// Apply the rotation increase
-		GetSceneNode().GetTransform().SetRotation(GetSceneNode().GetTransform().GetRotation()*qRot);
+		// Calculate the new rotation
+		m_qRotation = GetSceneNode().GetTransform().GetRotation()*qRot;
 	}
 }
 
+void SNMRotationLinearAnimation::OnUpdateApply()
+{
+	// Apply the new rotation
+	if (m_bApply)
+		GetSceneNode().GetTransform().SetRotation(m_qRotation);
+}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
@@ -28,6 +28,7 @@
 #include <PLMath/Matrix3x3.h>
 #include <PLMath/EulerAngles.h>
 #include "PLScene/Scene/SceneContext.h"
+#include "PLScene/Scene/SceneUpdateScheduler.h"
 #include "PLScene/Scene/SceneNodeModifiers/SNMRotationMoveDirection.h"
 
 
@@ -61,8 +62,8 @@ pl_class_metadata_end(SNMRotationMoveDirection)
 SNMRotationMoveDirection::SNMRotationMoveDirection(SceneNode &cSceneNode) : SNMTransform(cSceneNode),
 	Offset(this),
 	UpVector(this),
-	EventHandlerUpdate(&SNMRotationMoveDirection::OnUpdate, this),
-	m_vLastPos(GetSceneNode().GetTransform().GetPosition())
+	m_vLastPos(GetSceneNode().GetTransform().GetPosition()),
+	m_bApply(false)
 {
 }
 
@@ -80,46 +81,51 @@ SNMRotationMoveDirection::~SNMRotationMoveDirection()
 //[-------------------------------------------------------]
 void SNMRotationMoveDirection::OnActivate(bool bActivate)
 {
-	// Connect/disconnect event handler
+	// Add/remove to/from the update scheduler
 	SceneContext *pSceneContext = GetSceneContext();
 	if (pSceneContext) {
 		if (bActivate)
-			pSceneContext->EventUpdate.Connect(EventHandlerUpdate);
+			pSceneContext->GetUpdateScheduler().Add(*this);
 		else
-			pSceneContext->EventUpdate.Disconnect(EventHandlerUpdate);
+			pSceneContext->GetUpdateScheduler().Remove(*this);
 	}
 }
 
+SceneNodeModifier::EUpdateStage SNMRotationMoveDirection::GetUpdateStage() const
+{
+	// The movement direction depends on the animated position
+	return UpdateStageConstraint;
+}
 
-//[-------------------------------------------------------]
-//[ Private functions                                     ]
-//[-------------------------------------------------------]
-/**
-*  @brief
-*    Called when the scene node modifier needs to be updated
-*/
-void SNMRotationMoveDirection::OnUpdate()
+uint32 SNMRotationMoveDirection::GetUpdateAccess() const
 {
-	// Get the scene node
-	SceneNode &cSceneNode = GetSceneNode();
+	// Only the transform of the owner scene node is read and written
+	return ReadTransform | WriteTransform;
+}
+
+void SNMRotationMoveDirection::OnUpdateCompute()
+{
+	// Get the current scene node position
+	const Vector3 &vPos = GetSceneNode().GetTransform().GetPosition();
 
 	// Do ONLY update the rotation if the position difference is large enough. If this
 	// is not done, the node will 'ugly flacker' if the difference is quite small.
-	const Vector3 vDiff = cSceneNode.GetTransform().GetPosition()-m_vLastPos;
-	if (vDiff.DotProduct(vDiff) > Math::Epsilon) {
-		// Set rotation
+	const Vector3 vDiff = vPos-m_vLastPos;
+	m_bApply = (vDiff.DotProduct(vDiff) > Math::Epsilon);
+	if (m_bApply) {
+		// Calculate the new rotation
 		Matrix3x3 mRot;
-		mRot.LookAt(cSceneNode.GetTransform().GetPosition(), m_vLastPos, UpVector.Get());
+		mRot.LookAt(vPos, m_vLastPos, UpVector.Get());
 		mRot.Transpose();
 		if (Offset.Get().IsNull())
-			cSceneNode.GetTransform().SetRotation(Quaternion(mRot));
+			m_qRotation = mRot;
 		else {
 			// Get a quaternion representation of the rotation offset
 			Quaternion qRotOffset;
 			EulerAngles::ToQuaternion(static_cast<float>(Offset.Get().x*Math::DegToRad), static_cast<float>(Offset.Get().y*Math::DegToRad), static_cast<float>(Offset.Get().z*Math::DegToRad), qRotOffset);
 
-			// Set new rotation
-			cSceneNode.GetTransform().SetRotation(Quaternion(mRot)*qRotOffset);
+			// Calculate the new rotation
+			m_qRotation = Quaternion(mRot)*qRotOffset;
 		}
 
 		// We can also use Vector3::GetRotationTo(), but the results are not always good - in the worst case
@@ -136,10 +142,17 @@ void SNMRotationMoveDirection::OnUpdate()
 //		}
 
 		// Backup the current position
-		m_vLastPos = cSceneNode.GetTransform().GetPosition();
+		m_vLastPos = vPos;
 	}
 }
 
+void SNMRotationMoveDirection::OnUpdateApply()
+{
+	// Apply the new rotation
+	if (m_bApply)
+		GetSceneNode().GetTransform().SetRotation(m_qRotation);
+}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
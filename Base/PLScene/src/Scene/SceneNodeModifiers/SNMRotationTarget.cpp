@@ -25,7 +25,6 @@
 //[-------------------------------------------------------]
 //[ Includes                                              ]
 //[-------------------------------------------------------]
-#include <PLCore/Container/Stack.h>
 #include <PLMath/Matrix3x3.h>
 #include <PLMath/EulerAngles.h>
 #include <PLRenderer/RendererContext.h>
@@ -141,25 +140,11 @@ bool SNMRotationTarget::GetTargetPosition(Vector3 &vPos) const
 
 			// Are we in luck and the target is within the same container as the owner node?
 			if (GetSceneNode().GetContainer() != pTarget->GetContainer()) {
-				// Nope, we have to translate the position into the correct space :(
-				SceneContainer *pContainer = pTarget->GetContainer();
-				while (pContainer) {
-					vPos *= pContainer->GetTransform().GetMatrix();
-					pContainer = pContainer->GetContainer();
-				}
-
-				// To container space of the owner node
-				pContainer = GetSceneNode().GetContainer();
-				Stack<SceneContainer*> lstStack;
-				while (pContainer) {
-					lstStack.Push(pContainer);
-					pContainer = pContainer->GetContainer();
-				}
-				while (lstStack.GetNumOfElements()) {
-					pContainer = lstStack.Top();
-					lstStack.Pop();
-					vPos *= pContainer->GetTransform().GetInverseMatrix();
-				}
+				// Nope, we have to translate the position into the correct space by using the cached world matrices :(
+				if (pTarget->GetContainer())
+					vPos *= pTarget->GetContainer()->GetWorldMatrix();
+				if (GetSceneNode().GetContainer())
+					vPos *= GetSceneNode().GetContainer()->GetWorldMatrix().GetInverted();
 			}
 
 			// Done
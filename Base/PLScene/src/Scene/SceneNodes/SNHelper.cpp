@@ -63,6 +63,16 @@ SNHelper::~SNHelper()
 }
 
 
+//[-------------------------------------------------------]
+//[ Protected virtual SceneNode functions                 ]
+//[-------------------------------------------------------]
+bool SNHelper::ResetFunction()
+{
+	// A helper scene node is completely described by its attributes
+	return true;
+}
+
+
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
 //[-------------------------------------------------------]
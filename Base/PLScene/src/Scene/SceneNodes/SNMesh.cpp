@@ -605,6 +605,18 @@ void SNMesh::DeInitFunction()
 	UnloadMesh();
 }
 
+bool SNMesh::ResetFunction()
+{
+	// The mesh was unloaded when the scene node was de-initialized, but setting the default attribute
+	// values may have created a new mesh handler - a reused scene node starts without one
+	UnloadMesh();
+	m_sMesh = "";
+	m_sSkin = "";
+
+	// Done
+	return true;
+}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
@@ -112,8 +112,8 @@ bool SQAABoundingBox::PerformQueryRec(SceneHierarchyNode &cHierarchyNode)
 					// Touch the node
 					pSceneContext->TouchNode(*pSceneNode);
 
-					// Emit signal
-					SignalSceneNode(*this, *pSceneNode);
+					// Report the found scene node, the distance is the one between the centers of the bounding boxes
+					AddResult(*pSceneNode, m_plstResultDistances ? (pSceneNode->GetContainerAABoundingBox().GetCenter() - m_cAABoundingBox.GetCenter()).GetLength() : 0.0f);
 					if (m_nFlags & StopQuery)
 						return false; // Stop the query right now
 
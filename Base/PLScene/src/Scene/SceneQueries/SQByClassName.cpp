@@ -100,8 +100,8 @@ bool SQByClassName::PerformQueryRec(const SceneContainer &cContainer)
 
 		// Does the class name of this scene node match the given regular expression?
 		if (m_cRegEx.Match(pSceneNode->GetClass()->GetClassName())) {
-			// Emit signal
-			SignalSceneNode(*this, *pSceneNode);
+			// Report the found scene node
+			AddResult(*pSceneNode);
 			if (m_nFlags & StopQuery)
 				return false; // Stop the query right now
 		} else {
@@ -112,8 +112,8 @@ bool SQByClassName::PerformQueryRec(const SceneContainer &cContainer)
 				while (pClass) {
 					// Does the name of this class match the given regular expression?
 					if (m_cRegEx.Match(pClass->GetClassName())) {
-						// Emit signal
-						SignalSceneNode(*this, *pSceneNode);
+						// Report the found scene node
+						AddResult(*pSceneNode);
 						if (m_nFlags & StopQuery)
 							return false; // Stop the query right now
 
@@ -99,8 +99,8 @@ bool SQByName::PerformQueryRec(const SceneContainer &cContainer)
 
 		// Does the name of this scene node match the given regular expression?
 		if (m_cRegEx.Match(pSceneNode->GetName())) {
-			// Emit signal
-			SignalSceneNode(*this, *pSceneNode);
+			// Report the found scene node
+			AddResult(*pSceneNode);
 			if (m_nFlags & StopQuery)
 				return false; // Stop the query right now
 		}
@@ -79,8 +79,8 @@ bool SQEnumerate::PerformQueryRec(const SceneContainer &cContainer)
 		// Get the scene node
 		SceneNode *pSceneNode = cContainer.GetByIndex(i);
 
-		// Emit signal
-		SignalSceneNode(*this, *pSceneNode);
+		// Report the found scene node
+		AddResult(*pSceneNode);
 		if (m_nFlags & StopQuery)
 			return false; // Stop the query right now
 
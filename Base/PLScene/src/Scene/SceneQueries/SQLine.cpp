@@ -130,12 +130,13 @@ bool SQLine::PerformQueryRec(SceneHierarchyNode &cHierarchyNode)
 			if (pSceneNode && !pSceneContext->IsNodeTouched(*pSceneNode)) {
 				// Check scene node
 				const AABoundingBox &cAABB = pSceneNode->GetContainerAABoundingBox();
-				if (Intersect::AABoxLine(cAABB.vMin, cAABB.vMax, m_cLine.vStart, m_cLine.vEnd)) {
+				float fDistance = 0.0f;
+				if (Intersect::AABoxLine(cAABB.vMin, cAABB.vMax, m_cLine.vStart, m_cLine.vEnd, m_plstResultDistances ? &fDistance : nullptr)) {
 					// Touch this node
 					pSceneContext->TouchNode(*pSceneNode);
 
-					// Emit signal
-					SignalSceneNode(*this, *pSceneNode);
+					// Report the found scene node, the distance is the one from the line start to the scene node bounding box (0 if the line starts inside)
+					AddResult(*pSceneNode, (fDistance > 0.0f) ? fDistance : 0.0f);
 					if (m_nFlags & StopQuery)
 						return false; // Stop the query right now
 
@@ -114,8 +114,8 @@ bool SQPlaneSet::PerformQueryRec(SceneHierarchyNode &cHierarchyNode)
 					// Touch this node
 					pSceneContext->TouchNode(*pSceneNode);
 
-					// Emit signal
-					SignalSceneNode(*this, *pSceneNode);
+					// Report the found scene node
+					AddResult(*pSceneNode);
 					if (m_nFlags & StopQuery)
 						return false; // Stop the query right now
 
@@ -116,8 +116,8 @@ bool SQPoint::PerformQueryRec(SceneHierarchyNode &cHierarchyNode)
 					// Touch this node
 					pSceneContext->TouchNode(*pSceneNode);
 
-					// Emit signal
-					SignalSceneNode(*this, *pSceneNode);
+					// Report the found scene node, the distance is the one between the point and the center of the scene node bounding box
+					AddResult(*pSceneNode, m_plstResultDistances ? (cAABB.GetCenter() - m_vPoint).GetLength() : 0.0f);
 					if (m_nFlags & StopQuery)
 						return false; // Stop the query right now
 
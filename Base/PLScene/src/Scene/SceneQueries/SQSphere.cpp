@@ -25,6 +25,12 @@
 //[-------------------------------------------------------]
 //[ Includes                                              ]
 //[-------------------------------------------------------]
+#include <PLCore/Core/MemoryManager.h>
+#include <PLCore/System/System.h>
+#include <PLCore/System/Mutex.h>
+#include <PLCore/System/Thread.h>
+#include <PLCore/System/Semaphore.h>
+#include <PLCore/Container/HashMap.h>
 #include <PLMath/Intersect.h>
 #include "PLScene/Scene/SNCellPortal.h"
 #include "PLScene/Scene/SceneContext.h"
@@ -52,6 +58,62 @@ pl_class_metadata(SQSphere, "PLScene", PLScene::SceneQuery, "Sphere intersection
 pl_class_metadata_end(SQSphere)
 
 
+//[-------------------------------------------------------]
+//[ Global definitions                                    ]
+//[-------------------------------------------------------]
+static const uint32 MinSpheresPerThread = 64;	/**< Batches with less spheres per thread are not worth waking up a worker thread */
+static const uint32 MaxNumOfThreads		= 64;	/**< Maximum number of threads */
+
+
+//[-------------------------------------------------------]
+//[ Structures                                            ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Batch job of "PerformQueries()", one per thread
+*/
+struct SQSphere::BatchJob {
+	SQSphere				*pQuery;			/**< Owner query, always valid */
+	Thread					*pThread;			/**< Worker thread, null pointer for the batch job of the calling thread */
+	Semaphore				*pStartSemaphore;	/**< Semaphore signaled by the calling thread when there's work or the worker thread shall stop, null pointer for the batch job of the calling thread */
+	SceneHierarchyNode		*pRootNode;			/**< Root node of the scene hierarchy to traverse, always valid */
+	const Sphere			*pSpheres;			/**< Spheres of this batch job, always valid */
+	uint32					 nNumOfSpheres;		/**< Number of spheres of this batch job */
+	bool					 bRecursive;		/**< Take sub scene containers and cells into account? */
+	bool					 bDistances;		/**< Calculate the result distances? */
+	Array<uint32>			 lstActive;			/**< Stack of active sphere indices, one block per recursion level (used as plain buffer) */
+	uint32					 nNumOfActive;		/**< Number of used elements within the active sphere stack */
+	Array<const SceneNode*>	 lstPortals;		/**< Cell-portals of the current recursion path */
+	Array<uint32>			 lstHitSpheres;		/**< Sphere index of each hit, a scene node may be hit multiple times by the same sphere */
+	Array<SceneNode*>		 lstHitSceneNodes;	/**< Scene node of each hit */
+	Array<float>			 lstHitDistances;	/**< Result distance of each hit */
+	Array<uint32>			 lstCounts;			/**< Number of found scene nodes per sphere */
+	Array<SceneNode*>		 lstSceneNodes;		/**< Found scene nodes, sorted by sphere */
+	Array<float>			 lstDistances;		/**< Result distances of the found scene nodes */
+	Array<SceneNode*>		 lstSortedSceneNodes;	/**< Hit scene nodes sorted by sphere, including duplicates */
+	Array<float>			 lstSortedDistances;	/**< Result distances of the hit scene nodes sorted by sphere */
+	Array<Sphere*>			 lstContainerSpheres;	/**< Spheres within the space of a scene container, one array with "nMaxNumOfSpheres" spheres per container recursion level */
+	uint32					 nMaxNumOfSpheres;		/**< Number of spheres the arrays within "lstContainerSpheres" can hold */
+	uint32					 nContainerDepth;		/**< Current container recursion level */
+};
+
+
+//[-------------------------------------------------------]
+//[ Global functions                                      ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Ensures that the given array is able to hold the given number of elements without reallocation
+*/
+template <class T>
+static inline void Reserve(Array<T> &lstArray, uint32 nNumOfElements)
+{
+	// The number of slots is doubled to avoid frequent reallocations
+	if (nNumOfElements > lstArray.GetMaxNumOfElements())
+		lstArray.Resize(Math::Max(static_cast<uint32>(64), nNumOfElements*2), false);
+}
+
+
 //[-------------------------------------------------------]
 //[ Public functions                                      ]
 //[-------------------------------------------------------]
@@ -59,7 +121,10 @@ pl_class_metadata_end(SQSphere)
 *  @brief
 *    Default constructor
 */
-SQSphere::SQSphere()
+SQSphere::SQSphere() :
+	m_pDoneSemaphore(nullptr),
+	m_pMutex(nullptr),
+	m_bShutdown(false)
 {
 }
 
@@ -69,6 +134,11 @@ SQSphere::SQSphere()
 */
 SQSphere::~SQSphere()
 {
+	DestroyBatchJobs();
+	if (m_pMutex)
+		delete m_pMutex;
+	if (m_pDoneSemaphore)
+		delete m_pDoneSemaphore;
 }
 
 /**
@@ -80,10 +150,453 @@ Sphere &SQSphere::GetSphere()
 	return m_cSphere;
 }
 
+/**
+*  @brief
+*    Performs many sphere queries within one traversal of the scene hierarchy
+*/
+bool SQSphere::PerformQueries(const Sphere *pSpheres, uint32 nNumOfSpheres, Array<SceneNode*> &lstSceneNodes, Array<uint32> &lstFirstSceneNode, Array<float> *plstDistances, uint32 nNumOfThreads)
+{
+	// Reset the results
+	lstSceneNodes.Reset();
+	lstFirstSceneNode.Reset();
+	if (plstDistances)
+		plstDistances->Reset();
+
+	// Get the hierarchy we are working on
+	SceneHierarchy *pHierarchy = GetSceneContainer().GetHierarchyInstance();
+	if (!pHierarchy)
+		return false; // Error!
+
+	// Get the number of threads to use
+	if (!nNumOfThreads)
+		nNumOfThreads = System::GetInstance()->GetNumOfProcessors();
+	nNumOfThreads = Math::Min(nNumOfThreads, Math::Max(static_cast<uint32>(1), nNumOfSpheres/MinSpheresPerThread));
+	nNumOfThreads = Math::Min(nNumOfThreads, MaxNumOfThreads);
+
+	// Make sure there are enough batch jobs, each batch job except the first one has its own worker thread
+	nNumOfThreads = CreateBatchJobs(nNumOfThreads);
+
+	// The threads are only reading the scene, so update the lazily updated states on the calling thread
+	if (nNumOfThreads > 1) {
+		Array<SceneContainer*> lstContainers;
+		PrepareQueries(GetSceneContainer(), (m_nFlags & Recursive) != 0, lstContainers);
+	}
+
+	// Split the spheres into one block per thread and wake up the worker threads, the calling thread processes the first block itself
+	const uint32 nSpheresPerThread = nNumOfSpheres/nNumOfThreads;
+	for (uint32 i=0; i<nNumOfThreads; i++) {
+		BatchJob &sJob = *m_lstBatchJobs[i];
+		sJob.pRootNode	   = &pHierarchy->GetRootNode();
+		sJob.pSpheres	   = pSpheres + i*nSpheresPerThread;
+		sJob.nNumOfSpheres = (i == nNumOfThreads - 1) ? nNumOfSpheres - i*nSpheresPerThread : nSpheresPerThread;
+		sJob.bRecursive	   = (m_nFlags & Recursive) != 0;
+		sJob.bDistances	   = (plstDistances != nullptr);
+		if (i)
+			sJob.pStartSemaphore->Unlock();
+	}
+	PerformBatchJob(*m_lstBatchJobs[0]);
+
+	// Wait for the worker threads
+	for (uint32 i=1; i<nNumOfThreads; i++)
+		m_pDoneSemaphore->Lock();
+
+	// Merge the results of the batch jobs, they are already sorted by sphere
+	uint32 nNumOfSceneNodes = 0;
+	for (uint32 i=0; i<nNumOfThreads; i++)
+		nNumOfSceneNodes += m_lstBatchJobs[i]->lstSceneNodes.GetNumOfElements();
+	lstSceneNodes.Resize(nNumOfSceneNodes, false);
+	lstFirstSceneNode.Resize(nNumOfSpheres + 1, false);
+	if (plstDistances)
+		plstDistances->Resize(nNumOfSceneNodes, false);
+	for (uint32 i=0; i<nNumOfThreads; i++) {
+		const BatchJob &sJob = *m_lstBatchJobs[i];
+		uint32 nFirstSceneNode = lstSceneNodes.GetNumOfElements();
+		for (uint32 nSphere=0; nSphere<sJob.nNumOfSpheres; nSphere++) {
+			lstFirstSceneNode.Add(nFirstSceneNode);
+			nFirstSceneNode += sJob.lstCounts[nSphere];
+		}
+		lstSceneNodes.Add(sJob.lstSceneNodes.GetData(), sJob.lstSceneNodes.GetNumOfElements());
+		if (plstDistances)
+			plstDistances->Add(sJob.lstDistances.GetData(), sJob.lstDistances.GetNumOfElements());
+	}
+	lstFirstSceneNode.Add(lstSceneNodes.GetNumOfElements());
+
+	// Done
+	return true;
+}
+
+
+//[-------------------------------------------------------]
+//[ Private static functions                              ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Updates the lazily updated states of the scene used by "PerformQueries()"
+*/
+void SQSphere::PrepareQueries(SceneContainer &cContainer, bool bRecursive, Array<SceneContainer*> &lstContainers)
+{
+	// Was this scene container already updated? (cell-portals may lead back to it)
+	if (lstContainers.IsElement(&cContainer))
+		return;
+	lstContainers.Add(&cContainer);
+
+	// Update the scene hierarchy
+	if (!cContainer.GetHierarchyInstance())
+		return;
+
+	// Loop through all scene nodes
+	for (uint32 i=0; i<cContainer.GetNumOfElements(); i++) {
+		SceneNode *pSceneNode = cContainer.GetByIndex(i);
+
+		// Update the bounding box
+		pSceneNode->GetContainerAABoundingBox();
+
+		// Update what's required to continue recursive
+		if (bRecursive) {
+			// Is this a container and is recursion allowed?
+			if (pSceneNode->IsContainer() && !(pSceneNode->GetFlags() & SceneContainer::NoRecursion)) {
+				pSceneNode->GetTransform().GetInverseMatrix();
+				PrepareQueries(static_cast<SceneContainer&>(*pSceneNode), bRecursive, lstContainers);
+
+			// Is this a cell-portal?
+			} else if (pSceneNode->IsPortal() && pSceneNode->IsInstanceOf("PLScene::SNCellPortal") && !(pSceneNode->GetFlags() & SNCellPortal::NoPassThrough)) {
+				SNCellPortal   &cCellPortal	= static_cast<SNCellPortal&>(*pSceneNode);
+				SceneContainer *pCell		= reinterpret_cast<SceneContainer*>(cCellPortal.GetTargetCellInstance());
+				if (pCell && pCell != pSceneNode->GetContainer()) {
+					cCellPortal.GetWarpMatrix();
+					PrepareQueries(*pCell, bRecursive, lstContainers);
+				}
+			}
+		}
+	}
+}
+
+/**
+*  @brief
+*    Recursive part of "PerformQueries()"
+*/
+void SQSphere::PerformQueriesRec(BatchJob &sJob, SceneHierarchyNode &cHierarchyNode, const Sphere *pSpheres, uint32 nFirstActive, uint32 nNumOfActive)
+{
+	// Push the active spheres intersecting this scene hierarchy node onto the active sphere stack
+	const uint32 nFirst = sJob.nNumOfActive;
+	if (nFirst + nNumOfActive > sJob.lstActive.GetNumOfElements())
+		sJob.lstActive.Resize(Math::Max(static_cast<uint32>(64), (nFirst + nNumOfActive)*2));
+	uint32 nNum = 0;
+	{
+		uint32 *pnActive = sJob.lstActive.GetData();
+		const AABoundingBox &cAABB = cHierarchyNode.GetAABoundingBox();
+		for (uint32 i=0; i<nNumOfActive; i++) {
+			const uint32 nSphere = pnActive[nFirstActive + i];
+			if (Intersect::SphereAABox(pSpheres[nSphere], cAABB))
+				pnActive[nFirst + nNum++] = nSphere;
+		}
+	}
+	if (!nNum)
+		return; // Done, no sphere is intersecting this scene hierarchy node
+	sJob.nNumOfActive = nFirst + nNum;
+
+	// Check the scene nodes
+	const SceneHierarchyNodeItem *pItem = cHierarchyNode.GetFirstItem();
+	while (pItem) {
+		// Get the linked scene node
+		SceneNode *pSceneNode = pItem->GetSceneNode();
+		if (pSceneNode) {
+			// Check the scene node against all active spheres (the active sphere stack may be reallocated by the recursion below)
+			const AABoundingBox &cAABB = pSceneNode->GetContainerAABoundingBox();
+			const uint32 nFirstHit = sJob.lstHitSpheres.GetNumOfElements();
+			Reserve(sJob.lstHitSpheres,    nFirstHit + nNum);
+			Reserve(sJob.lstHitSceneNodes, nFirstHit + nNum);
+			Reserve(sJob.lstHitDistances,  nFirstHit + nNum);
+			const uint32 *pnActive = sJob.lstActive.GetData() + nFirst;
+			for (uint32 i=0; i<nNum; i++) {
+				const Sphere &cSphere = pSpheres[pnActive[i]];
+				if (Intersect::SphereAABox(cSphere, cAABB)) {
+					sJob.lstHitSpheres.Add(pnActive[i]);
+					sJob.lstHitSceneNodes.Add(pSceneNode);
+					sJob.lstHitDistances.Add(sJob.bDistances ? (cAABB.GetCenter() - cSphere.GetPos()).GetLength() : 0.0f);
+				}
+			}
+
+			// Continue recursive?
+			const uint32 nNumOfHits = sJob.lstHitSpheres.GetNumOfElements() - nFirstHit;
+			if (nNumOfHits && sJob.bRecursive) {
+				// Get the scene hierarchy to continue with and the matrix transforming the spheres into its space
+				SceneHierarchy	  *pHierarchy = nullptr;
+				const Matrix3x4   *pMatrix    = nullptr;
+				const SceneNode   *pPortal    = nullptr;
+
+				// Is this a container and is recursion allowed?
+				if (pSceneNode->IsContainer() && !(pSceneNode->GetFlags() & SceneContainer::NoRecursion)) {
+					pHierarchy = static_cast<SceneContainer*>(pSceneNode)->GetHierarchyInstance();
+					pMatrix    = &pSceneNode->GetTransform().GetInverseMatrix();
+
+				// Is this a cell-portal which is not already within the current recursion path?
+				} else if (pSceneNode->IsPortal() && pSceneNode->IsInstanceOf("PLScene::SNCellPortal") && !(pSceneNode->GetFlags() & SNCellPortal::NoPassThrough) &&
+						   !sJob.lstPortals.IsElement(pSceneNode)) {
+					SNCellPortal   &cCellPortal	= static_cast<SNCellPortal&>(*pSceneNode);
+					SceneContainer *pCell		= reinterpret_cast<SceneContainer*>(cCellPortal.GetTargetCellInstance());
+					if (pCell && pCell != pSceneNode->GetContainer()) {
+						pHierarchy = pCell->GetHierarchyInstance();
+						pMatrix    = &cCellPortal.GetWarpMatrix();
+						pPortal    = pSceneNode;
+					}
+				}
+
+				// Container recursion
+				if (pHierarchy) {
+					// Transform the hit spheres into container space - the spheres are not transformed in place because other
+					// scene nodes of this scene hierarchy node may need the current ones, so each container recursion level has its own spheres
+					if (sJob.nContainerDepth == sJob.lstContainerSpheres.GetNumOfElements())
+						sJob.lstContainerSpheres.Add(new Sphere[sJob.nMaxNumOfSpheres]);
+					Sphere *pContainerSpheres = sJob.lstContainerSpheres[sJob.nContainerDepth];
+					for (uint32 i=0; i<nNumOfHits; i++) {
+						const uint32  nSphere = sJob.lstHitSpheres[nFirstHit + i];
+						const Sphere &cSphere = pSpheres[nSphere];
+						pContainerSpheres[nSphere].SetPos(*pMatrix*cSphere.GetPos());
+						// Now comes the tricky part - the radius. We MUST assume that this is no uniform scale. :(
+						pContainerSpheres[nSphere].SetRadius(pMatrix->RotateVector(Vector3(cSphere.GetRadius(), cSphere.GetRadius(), cSphere.GetRadius())).GetLength());
+					}
+
+					// The hit spheres are the active spheres of the scene container
+					const uint32 nFirstHitActive = sJob.nNumOfActive;
+					if (nFirstHitActive + nNumOfHits > sJob.lstActive.GetNumOfElements())
+						sJob.lstActive.Resize(Math::Max(static_cast<uint32>(64), (nFirstHitActive + nNumOfHits)*2));
+					for (uint32 i=0; i<nNumOfHits; i++)
+						sJob.lstActive[nFirstHitActive + i] = sJob.lstHitSpheres[nFirstHit + i];
+					sJob.nNumOfActive += nNumOfHits;
+					if (pPortal)
+						sJob.lstPortals.Add(pPortal);
+					sJob.nContainerDepth++;
+					PerformQueriesRec(sJob, pHierarchy->GetRootNode(), pContainerSpheres, nFirstHitActive, nNumOfHits);
+					sJob.nContainerDepth--;
+					if (pPortal)
+						sJob.lstPortals.RemoveAtIndex(sJob.lstPortals.GetNumOfElements() - 1);
+					sJob.nNumOfActive = nFirstHitActive;
+				}
+			}
+		}
+
+		// Next item, please
+		pItem = pItem->GetNextItem();
+	}
+
+	// Check all sub-hierarchies
+	for (uint32 i=0; i<cHierarchyNode.GetNumOfNodes(); i++)
+		PerformQueriesRec(sJob, *cHierarchyNode.GetNode(i), pSpheres, nFirst, nNum);
+
+	// Pop the active spheres of this scene hierarchy node
+	sJob.nNumOfActive = nFirst;
+}
+
+/**
+*  @brief
+*    Performs the sphere queries of a batch job
+*/
+void SQSphere::PerformBatchJob(BatchJob &sJob)
+{
+	// The buffers are kept over calls, reset them and make sure the container spheres are large enough
+	sJob.lstHitSpheres.Reset();
+	sJob.lstHitSceneNodes.Reset();
+	sJob.lstHitDistances.Reset();
+	sJob.lstSceneNodes.Reset();
+	sJob.lstDistances.Reset();
+	sJob.lstPortals.Reset();
+	sJob.nContainerDepth = 0;
+	if (sJob.nMaxNumOfSpheres < sJob.nNumOfSpheres) {
+		for (uint32 i=0; i<sJob.lstContainerSpheres.GetNumOfElements(); i++)
+			delete [] sJob.lstContainerSpheres[i];
+		sJob.lstContainerSpheres.Reset();
+		sJob.nMaxNumOfSpheres = sJob.nNumOfSpheres;
+	}
+
+	// Traverse the scene hierarchy, initially all spheres are active
+	if (sJob.nNumOfSpheres*2 > sJob.lstActive.GetNumOfElements())
+		sJob.lstActive.Resize(Math::Max(static_cast<uint32>(64), sJob.nNumOfSpheres*2));
+	for (uint32 i=0; i<sJob.nNumOfSpheres; i++)
+		sJob.lstActive[i] = i;
+	sJob.nNumOfActive = sJob.nNumOfSpheres;
+	PerformQueriesRec(sJob, *sJob.pRootNode, sJob.pSpheres, 0, sJob.nNumOfSpheres);
+
+	// Count the hits per sphere
+	const uint32 nNumOfHits = sJob.lstHitSpheres.GetNumOfElements();
+	Reserve(sJob.lstCounts, sJob.nNumOfSpheres + 1);
+	sJob.lstCounts.Resize(sJob.lstCounts.GetMaxNumOfElements(), true, false);
+	MemoryManager::Set(sJob.lstCounts.GetData(), 0, (sJob.nNumOfSpheres + 1)*sizeof(uint32));
+	for (uint32 i=0; i<nNumOfHits; i++)
+		sJob.lstCounts[sJob.lstHitSpheres[i] + 1]++;
+
+	// Sort the hits by sphere (counting sort, first the counts are turned into offsets)
+	for (uint32 i=1; i<=sJob.nNumOfSpheres; i++)
+		sJob.lstCounts[i] += sJob.lstCounts[i - 1];
+	Reserve(sJob.lstSortedSceneNodes, nNumOfHits);
+	sJob.lstSortedSceneNodes.Resize(sJob.lstSortedSceneNodes.GetMaxNumOfElements(), true, false);
+	if (sJob.bDistances) {
+		Reserve(sJob.lstSortedDistances, nNumOfHits);
+		sJob.lstSortedDistances.Resize(sJob.lstSortedDistances.GetMaxNumOfElements(), true, false);
+	}
+	SceneNode **ppSortedSceneNodes = sJob.lstSortedSceneNodes.GetData();
+	float	   *pfSortedDistances  = sJob.lstSortedDistances.GetData();
+	for (uint32 i=0; i<nNumOfHits; i++) {
+		const uint32 nIndex = sJob.lstCounts[sJob.lstHitSpheres[i]]++;
+		ppSortedSceneNodes[nIndex] = sJob.lstHitSceneNodes[i];
+		if (sJob.bDistances)
+			pfSortedDistances[nIndex] = sJob.lstHitDistances[i];
+	}
+
+	// A scene node can be linked to multiple scene hierarchy nodes and therefore be hit multiple times by the same sphere,
+	// remove those duplicates - "lstCounts[i]" is now the end of the hits of sphere i
+	Reserve(sJob.lstSceneNodes, nNumOfHits);
+	if (sJob.bDistances)
+		Reserve(sJob.lstDistances, nNumOfHits);
+	HashMap<uint64, uint32> mapLastSphere;	// Scene node address -> last sphere index + 1
+	uint32 nHit = 0;
+	for (uint32 nSphere=0; nSphere<sJob.nNumOfSpheres; nSphere++) {
+		const uint32 nEnd = sJob.lstCounts[nSphere];
+		const uint32 nNumOfSceneNodes = sJob.lstSceneNodes.GetNumOfElements();
+		for (; nHit<nEnd; nHit++) {
+			SceneNode	 *pSceneNode = ppSortedSceneNodes[nHit];
+			const uint64  nKey		 = reinterpret_cast<uint64>(pSceneNode);
+			if (mapLastSphere.Get(nKey) != nSphere + 1) {
+				mapLastSphere.Set(nKey, nSphere + 1);
+				sJob.lstSceneNodes.Add(pSceneNode);
+				if (sJob.bDistances)
+					sJob.lstDistances.Add(pfSortedDistances[nHit]);
+			}
+		}
+		sJob.lstCounts[nSphere] = sJob.lstSceneNodes.GetNumOfElements() - nNumOfSceneNodes;
+	}
+}
+
+/**
+*  @brief
+*    Static worker thread function performing the sphere queries of the batch jobs it was given
+*/
+int SQSphere::WorkerThreadFunction(void *pData)
+{
+	BatchJob &sJob = *static_cast<BatchJob*>(pData);
+	SQSphere &cQuery = *sJob.pQuery;
+
+	// Wait for batch jobs to perform
+	while (sJob.pStartSemaphore->Lock()) {
+		// Shall the worker thread stop?
+		cQuery.m_pMutex->Lock();
+		const bool bShutdown = cQuery.m_bShutdown;
+		cQuery.m_pMutex->Unlock();
+		if (bShutdown)
+			break;
+
+		// Perform the batch job
+		PerformBatchJob(sJob);
+
+		// Tell the calling thread that this batch job is done
+		cQuery.m_pDoneSemaphore->Unlock();
+	}
+
+	// Done
+	return 0;
+}
+
 
 //[-------------------------------------------------------]
 //[ Private functions                                     ]
 //[-------------------------------------------------------]
+/**
+*  @brief
+*    Copy constructor
+*/
+SQSphere::SQSphere(const SQSphere &cSource) :
+	m_pDoneSemaphore(nullptr),
+	m_pMutex(nullptr),
+	m_bShutdown(false)
+{
+	// No implementation because the copy constructor is never used
+}
+
+/**
+*  @brief
+*    Copy operator
+*/
+SQSphere &SQSphere::operator =(const SQSphere &cSource)
+{
+	// No implementation because the copy operator is never used
+	return *this;
+}
+
+/**
+*  @brief
+*    Creates batch jobs until there are the requested number of batch jobs
+*/
+uint32 SQSphere::CreateBatchJobs(uint32 nNumOfBatchJobs)
+{
+	while (m_lstBatchJobs.GetNumOfElements() < nNumOfBatchJobs) {
+		BatchJob *pJob = new BatchJob;
+		pJob->pQuery		   = this;
+		pJob->pThread		   = nullptr;
+		pJob->pStartSemaphore  = nullptr;
+		pJob->pRootNode		   = nullptr;
+		pJob->pSpheres		   = nullptr;
+		pJob->nNumOfSpheres	   = 0;
+		pJob->bRecursive	   = false;
+		pJob->bDistances	   = false;
+		pJob->nNumOfActive	   = 0;
+		pJob->nMaxNumOfSpheres = 0;
+		pJob->nContainerDepth  = 0;
+
+		// Each batch job except the first one has its own worker thread
+		if (m_lstBatchJobs.GetNumOfElements()) {
+			if (!m_pDoneSemaphore) {
+				m_pDoneSemaphore = new Semaphore(0, MaxNumOfThreads);
+				m_pMutex		 = new Mutex();
+			}
+			pJob->pThread		  = new Thread(WorkerThreadFunction, pJob);
+			pJob->pStartSemaphore = new Semaphore(0, 1);
+			pJob->pThread->SetName("Sphere query");
+			if (!pJob->pThread->Start()) {
+				// Error! Go on with the worker threads we already have.
+				delete pJob->pStartSemaphore;
+				delete pJob->pThread;
+				delete pJob;
+				break;
+			}
+		}
+		m_lstBatchJobs.Add(pJob);
+	}
+
+	// Return the number of available batch jobs
+	return Math::Min(m_lstBatchJobs.GetNumOfElements(), nNumOfBatchJobs);
+}
+
+/**
+*  @brief
+*    Stops all worker threads and destroys all batch jobs
+*/
+void SQSphere::DestroyBatchJobs()
+{
+	if (m_lstBatchJobs.GetNumOfElements()) {
+		// Tell the worker threads to stop and wait until they're done
+		if (m_pMutex) {
+			m_pMutex->Lock();
+			m_bShutdown = true;
+			m_pMutex->Unlock();
+		}
+		for (uint32 i=1; i<m_lstBatchJobs.GetNumOfElements(); i++)
+			m_lstBatchJobs[i]->pStartSemaphore->Unlock();
+		for (uint32 i=0; i<m_lstBatchJobs.GetNumOfElements(); i++) {
+			BatchJob *pJob = m_lstBatchJobs[i];
+			if (pJob->pThread) {
+				pJob->pThread->Join();
+				delete pJob->pThread;
+				delete pJob->pStartSemaphore;
+			}
+			for (uint32 j=0; j<pJob->lstContainerSpheres.GetNumOfElements(); j++)
+				delete [] pJob->lstContainerSpheres[j];
+			delete pJob;
+		}
+		m_lstBatchJobs.Clear();
+		m_bShutdown = false;
+	}
+}
+
 /**
 *  @brief
 *    Recursive part of PerformQuery()
@@ -113,8 +626,8 @@ bool SQSphere::PerformQueryRec(SceneHierarchyNode &cHierarchyNode)
 					// Touch this node
 					pSceneContext->TouchNode(*pSceneNode);
 
-					// Emit signal
-					SignalSceneNode(*this, *pSceneNode);
+					// Report the found scene node, the distance is the one between the sphere center and the center of the scene node bounding box
+					AddResult(*pSceneNode, m_plstResultDistances ? (pSceneNode->GetContainerAABoundingBox().GetCenter() - m_cSphere.GetPos()).GetLength() : 0.0f);
 					if (m_nFlags & StopQuery)
 						return false; // Stop the query right now
 
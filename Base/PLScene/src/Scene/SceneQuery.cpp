@@ -57,6 +57,16 @@ SceneContext *SceneQuery::GetSceneContext() const
 	return m_pSceneContainer->GetSceneContext();
 }
 
+/**
+*  @brief
+*    Sets the result buffer
+*/
+void SceneQuery::SetResultBuffer(Array<SceneNode*> *plstSceneNodes, Array<float> *plstDistances)
+{
+	m_plstResultSceneNodes = plstSceneNodes;
+	m_plstResultDistances  = plstSceneNodes ? plstDistances : nullptr;
+}
+
 
 //[-------------------------------------------------------]
 //[ Protected functions                                   ]
@@ -67,6 +77,8 @@ SceneContext *SceneQuery::GetSceneContext() const
 */
 SceneQuery::SceneQuery() :
 	m_nFlags(Recursive),
+	m_plstResultSceneNodes(nullptr),
+	m_plstResultDistances(nullptr),
 	m_pSceneContainer(nullptr)
 {
 }
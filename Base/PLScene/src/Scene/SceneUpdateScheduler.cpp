@@ -0,0 +1,487 @@
+/*********************************************************\
+ *  File: SceneUpdateScheduler.cpp                       *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <PLCore/System/System.h>
+#include <PLCore/System/Mutex.h>
+#include <PLCore/System/Thread.h>
+#include <PLCore/System/Semaphore.h>
+#include <PLMath/Math.h>
+#include "PLScene/Scene/SceneUpdateScheduler.h"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+using namespace PLCore;
+using namespace PLMath;
+namespace PLScene {
+
+
+//[-------------------------------------------------------]
+//[ Global definitions                                    ]
+//[-------------------------------------------------------]
+static const uint32 MinModifiersPerThread = 256;	/**< Updates with less scene node modifiers per thread are not worth waking up a worker thread */
+static const uint32 MaxNumOfThreads		  = 64;		/**< Maximum number of threads */
+
+
+//[-------------------------------------------------------]
+//[ Structures                                            ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Persistent worker thread
+*/
+struct SceneUpdateScheduler::WorkerThread {
+	SceneUpdateScheduler  *pUpdateScheduler;	/**< Owner update scheduler, always valid */
+	Thread				  *pThread;				/**< The thread, always valid */
+	Semaphore			  *pStartSemaphore;		/**< Semaphore signaled by the main thread when there's a block to compute or the thread shall stop (always valid!) */
+	SceneNodeModifier	 **ppModifiers;			/**< Scene node modifiers to compute, can be a null pointer */
+	uint32				   nNumOfModifiers;		/**< Number of scene node modifiers to compute */
+};
+
+
+//[-------------------------------------------------------]
+//[ Public functions                                      ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Adds a scene node modifier
+*/
+void SceneUpdateScheduler::Add(SceneNodeModifier &cModifier)
+{
+	if (!cModifier.m_pUpdateScheduler) {
+		// Add the scene node modifier to the list of its stage
+		const uint32 nStage = static_cast<uint32>(cModifier.GetUpdateStage());
+		if (nStage < SceneNodeModifier::NumOfUpdateStages) {
+			Array<SceneNodeModifier*> &lstModifiers = m_lstModifiers[nStage];
+			cModifier.m_pUpdateScheduler = this;
+			cModifier.m_nUpdateStage	 = nStage;
+			cModifier.m_nUpdateIndex	 = lstModifiers.GetNumOfElements();
+
+			// The number of slots is doubled to avoid frequent reallocations
+			if (lstModifiers.GetNumOfElements() == lstModifiers.GetMaxNumOfElements())
+				lstModifiers.Resize(Math::Max(static_cast<uint32>(64), lstModifiers.GetNumOfElements()*2), false);
+			lstModifiers.Add(&cModifier);
+			m_nNumOfModifiers++;
+		}
+	}
+}
+
+/**
+*  @brief
+*    Removes a scene node modifier
+*/
+void SceneUpdateScheduler::Remove(SceneNodeModifier &cModifier)
+{
+	if (cModifier.m_pUpdateScheduler == this) {
+		// Just clear the slot, the stage lists are compacted later on so that the order of the other scene node modifiers is kept
+		m_lstModifiers[cModifier.m_nUpdateStage][cModifier.m_nUpdateIndex] = nullptr;
+		m_nNumOfRemovedSlots++;
+		if (m_bUpdating) {
+			// The scene node modifier may also be within the lists of the current stage
+			for (uint32 i=0; i<m_lstConcurrent.GetNumOfElements(); i++) {
+				if (m_lstConcurrent[i] == &cModifier)
+					m_lstConcurrent[i] = nullptr;
+			}
+			for (uint32 i=0; i<m_lstMainThread.GetNumOfElements(); i++) {
+				if (m_lstMainThread[i] == &cModifier)
+					m_lstMainThread[i] = nullptr;
+			}
+		}
+		cModifier.m_pUpdateScheduler = nullptr;
+		m_nNumOfModifiers--;
+
+		// Compact the stage lists if there are too many cleared slots
+		if (!m_bUpdating && m_nNumOfRemovedSlots > m_nNumOfModifiers)
+			Compact();
+	}
+}
+
+/**
+*  @brief
+*    Returns the number of added scene node modifiers
+*/
+uint32 SceneUpdateScheduler::GetNumOfModifiers() const
+{
+	return m_nNumOfModifiers;
+}
+
+/**
+*  @brief
+*    Returns the maximum number of threads to use
+*/
+uint32 SceneUpdateScheduler::GetNumOfThreads() const
+{
+	return m_nNumOfThreads;
+}
+
+/**
+*  @brief
+*    Sets the maximum number of threads to use
+*/
+void SceneUpdateScheduler::SetNumOfThreads(uint32 nNumOfThreads)
+{
+	if (m_nNumOfThreads != nNumOfThreads) {
+		m_nNumOfThreads = nNumOfThreads;
+
+		// The worker threads are created again on demand
+		if (!m_bUpdating)
+			DestroyWorkerThreads();
+	}
+}
+
+/**
+*  @brief
+*    Returns the number of scene node modifiers computed on worker threads during the last update
+*/
+uint32 SceneUpdateScheduler::GetNumOfConcurrentUpdates() const
+{
+	return m_nNumOfConcurrentUpdates;
+}
+
+/**
+*  @brief
+*    Returns the number of scene node modifiers updated on the main thread during the last update
+*/
+uint32 SceneUpdateScheduler::GetNumOfMainThreadUpdates() const
+{
+	return m_nNumOfMainThreadUpdates;
+}
+
+/**
+*  @brief
+*    Performs the scheduled update of all added scene node modifiers
+*/
+void SceneUpdateScheduler::Update()
+{
+	// Avoid recursive updates
+	if (m_bUpdating)
+		return;
+	m_bUpdating = true;
+	m_nNumOfConcurrentUpdates = 0;
+	m_nNumOfMainThreadUpdates = 0;
+
+	// Remove the cleared slots of removed scene node modifiers
+	if (m_nNumOfRemovedSlots)
+		Compact();
+
+	// Update the stages one after another
+	for (uint32 nStage=0; nStage<SceneNodeModifier::NumOfUpdateStages; nStage++) {
+		// Sort the scene node modifiers of this stage into concurrent and main thread ones, scene node
+		// modifiers added during the update are updated the next time
+		const Array<SceneNodeModifier*> &lstModifiers = m_lstModifiers[nStage];
+		const uint32 nNumOfModifiers = lstModifiers.GetNumOfElements();
+		if (!nNumOfModifiers)
+			continue; // Nothing to do
+		m_lstConcurrent.Reset();
+		m_lstMainThread.Reset();
+		if (m_lstConcurrent.GetMaxNumOfElements() < nNumOfModifiers) {
+			m_lstConcurrent.Resize(nNumOfModifiers, false);
+			m_lstMainThread.Resize(nNumOfModifiers, false);
+		}
+		for (uint32 i=0; i<nNumOfModifiers; i++) {
+			SceneNodeModifier *pModifier = lstModifiers[i];
+			if (pModifier) {
+				if (IsConcurrent(*pModifier, pModifier->GetUpdateAccess()))
+					m_lstConcurrent.Add(pModifier);
+				else
+					m_lstMainThread.Add(pModifier);
+			}
+		}
+		m_nNumOfConcurrentUpdates += m_lstConcurrent.GetNumOfElements();
+		m_nNumOfMainThreadUpdates += m_lstMainThread.GetNumOfElements();
+
+		// Compute the concurrent ones, then apply the results on the main thread
+		if (m_lstConcurrent.GetNumOfElements()) {
+			Compute(m_lstConcurrent);
+			for (uint32 i=0; i<m_lstConcurrent.GetNumOfElements(); i++) {
+				// The scene node modifier may have been removed by a previously applied one
+				SceneNodeModifier *pModifier = m_lstConcurrent[i];
+				if (pModifier)
+					pModifier->OnUpdateApply();
+			}
+		}
+
+		// Update the main thread ones
+		for (uint32 i=0; i<m_lstMainThread.GetNumOfElements(); i++) {
+			SceneNodeModifier *pModifier = m_lstMainThread[i];
+			if (pModifier) {
+				pModifier->OnUpdateCompute();
+				pModifier->OnUpdateApply();
+			}
+		}
+	}
+
+	m_lstConcurrent.Reset();
+	m_lstMainThread.Reset();
+	m_bUpdating = false;
+}
+
+
+//[-------------------------------------------------------]
+//[ Private functions                                     ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Constructor
+*/
+SceneUpdateScheduler::SceneUpdateScheduler() :
+	m_nNumOfModifiers(0),
+	m_nNumOfThreads(0),
+	m_nNumOfRemovedSlots(0),
+	m_bUpdating(false),
+	m_nNumOfConcurrentUpdates(0),
+	m_nNumOfMainThreadUpdates(0),
+	m_pDoneSemaphore(new Semaphore(0, MaxNumOfThreads)),
+	m_pMutex(new Mutex()),
+	m_bShutdown(false)
+{
+}
+
+/**
+*  @brief
+*    Destructor
+*/
+SceneUpdateScheduler::~SceneUpdateScheduler()
+{
+	// Stop the worker threads
+	DestroyWorkerThreads();
+	delete m_pMutex;
+	delete m_pDoneSemaphore;
+
+	// Scene node modifiers which are still added must not remove themselves from this update scheduler
+	for (uint32 nStage=0; nStage<SceneNodeModifier::NumOfUpdateStages; nStage++) {
+		const Array<SceneNodeModifier*> &lstModifiers = m_lstModifiers[nStage];
+		for (uint32 i=0; i<lstModifiers.GetNumOfElements(); i++) {
+			if (lstModifiers[i])
+				lstModifiers[i]->m_pUpdateScheduler = nullptr;
+		}
+	}
+}
+
+/**
+*  @brief
+*    Copy constructor
+*/
+SceneUpdateScheduler::SceneUpdateScheduler(const SceneUpdateScheduler &cSource) :
+	m_nNumOfModifiers(0),
+	m_nNumOfThreads(0),
+	m_nNumOfRemovedSlots(0),
+	m_bUpdating(false),
+	m_nNumOfConcurrentUpdates(0),
+	m_nNumOfMainThreadUpdates(0),
+	m_pDoneSemaphore(nullptr),
+	m_pMutex(nullptr),
+	m_bShutdown(false)
+{
+	// No implementation because the copy constructor is never used
+}
+
+/**
+*  @brief
+*    Copy operator
+*/
+SceneUpdateScheduler &SceneUpdateScheduler::operator =(const SceneUpdateScheduler &cSource)
+{
+	// No implementation because the copy operator is never used
+	return *this;
+}
+
+/**
+*  @brief
+*    Removes the cleared slots of removed scene node modifiers from the stage lists
+*/
+void SceneUpdateScheduler::Compact()
+{
+	for (uint32 nStage=0; nStage<SceneNodeModifier::NumOfUpdateStages; nStage++) {
+		Array<SceneNodeModifier*> &lstModifiers = m_lstModifiers[nStage];
+		uint32 nNumOfModifiers = 0;
+		for (uint32 i=0; i<lstModifiers.GetNumOfElements(); i++) {
+			SceneNodeModifier *pModifier = lstModifiers[i];
+			if (pModifier) {
+				pModifier->m_nUpdateIndex = nNumOfModifiers;
+				lstModifiers[nNumOfModifiers++] = pModifier;
+			}
+		}
+		lstModifiers.Resize(nNumOfModifiers, true, false);
+	}
+	m_nNumOfRemovedSlots = 0;
+}
+
+/**
+*  @brief
+*    Returns whether or not a scene node modifier can be computed on a worker thread
+*/
+bool SceneUpdateScheduler::IsConcurrent(const SceneNodeModifier &cModifier, uint32 nAccess) const
+{
+	// Reading other scene nodes or emitting events is only allowed on the main thread
+	if (nAccess & (SceneNodeModifier::ReadParent | SceneNodeModifier::MainThread))
+		return false;
+
+	// Is there another scene node modifier of the same scene node within the same stage accessing the same data?
+	// -> Write access is also read access, the read flags are one bit below the write flags
+	static const uint32 ReadMask = SceneNodeModifier::ReadTransform | SceneNodeModifier::ReadMeshHandler;
+	const uint32 nWrite = (nAccess >> 1) & ReadMask;
+	const uint32 nRead  = (nAccess & ReadMask) | nWrite;
+	const SceneNode &cSceneNode = cModifier.GetSceneNode();
+	for (uint32 i=0; i<cSceneNode.GetNumOfModifiers(); i++) {
+		const SceneNodeModifier *pModifier = cSceneNode.GetModifier("", i);
+		if (pModifier != &cModifier && pModifier->m_pUpdateScheduler == this && pModifier->m_nUpdateStage == cModifier.m_nUpdateStage) {
+			const uint32 nOtherAccess = pModifier->GetUpdateAccess();
+			const uint32 nOtherWrite  = (nOtherAccess >> 1) & ReadMask;
+			if ((nWrite & ((nOtherAccess & ReadMask) | nOtherWrite)) || (nOtherWrite & nRead))
+				return false;
+		}
+	}
+
+	// Concurrent computation is possible
+	return true;
+}
+
+/**
+*  @brief
+*    Computes the updates of a list of scene node modifiers by using multiple threads
+*/
+void SceneUpdateScheduler::Compute(Array<SceneNodeModifier*> &lstModifiers)
+{
+	// Get the number of threads to use
+	const uint32 nNumOfModifiers = lstModifiers.GetNumOfElements();
+	uint32 nNumOfThreads = m_nNumOfThreads ? m_nNumOfThreads : System::GetInstance()->GetNumOfProcessors();
+	nNumOfThreads = Math::Min(nNumOfThreads, Math::Max(static_cast<uint32>(1), nNumOfModifiers/MinModifiersPerThread));
+	nNumOfThreads = Math::Min(nNumOfThreads, MaxNumOfThreads);
+
+	// Make sure there are enough worker threads, the calling thread processes the first block itself
+	if (nNumOfThreads > 1)
+		nNumOfThreads = CreateWorkerThreads(nNumOfThreads - 1) + 1;
+
+	// Split the scene node modifiers into one block per thread and wake up the worker threads
+	const uint32 nModifiersPerThread = nNumOfModifiers/nNumOfThreads;
+	for (uint32 i=1; i<nNumOfThreads; i++) {
+		WorkerThread &sWorkerThread = *m_lstWorkerThreads[i - 1];
+		sWorkerThread.ppModifiers	  = lstModifiers.GetData() + i*nModifiersPerThread;
+		sWorkerThread.nNumOfModifiers = (i == nNumOfThreads - 1) ? nNumOfModifiers - i*nModifiersPerThread : nModifiersPerThread;
+		sWorkerThread.pStartSemaphore->Unlock();
+	}
+	SceneNodeModifier **ppModifiers = lstModifiers.GetData();
+	for (uint32 i=0; i<nModifiersPerThread; i++)
+		ppModifiers[i]->OnUpdateCompute();
+
+	// Wait for the worker threads
+	for (uint32 i=1; i<nNumOfThreads; i++)
+		m_pDoneSemaphore->Lock();
+}
+
+/**
+*  @brief
+*    Creates worker threads until there are the requested number of worker threads
+*/
+uint32 SceneUpdateScheduler::CreateWorkerThreads(uint32 nNumOfWorkerThreads)
+{
+	while (m_lstWorkerThreads.GetNumOfElements() < nNumOfWorkerThreads) {
+		WorkerThread *pWorkerThread = new WorkerThread;
+		pWorkerThread->pUpdateScheduler = this;
+		pWorkerThread->pThread			= new Thread(WorkerThreadFunction, pWorkerThread);
+		pWorkerThread->pStartSemaphore	= new Semaphore(0, 1);
+		pWorkerThread->ppModifiers		= nullptr;
+		pWorkerThread->nNumOfModifiers	= 0;
+		pWorkerThread->pThread->SetName("Scene update");
+		if (!pWorkerThread->pThread->Start()) {
+			// Error! Go on with the worker threads we already have.
+			delete pWorkerThread->pStartSemaphore;
+			delete pWorkerThread->pThread;
+			delete pWorkerThread;
+			break;
+		}
+		m_lstWorkerThreads.Add(pWorkerThread);
+	}
+
+	// Return the number of available worker threads
+	return Math::Min(m_lstWorkerThreads.GetNumOfElements(), nNumOfWorkerThreads);
+}
+
+/**
+*  @brief
+*    Stops and destroys all worker threads
+*/
+void SceneUpdateScheduler::DestroyWorkerThreads()
+{
+	if (m_lstWorkerThreads.GetNumOfElements()) {
+		// Tell the worker threads to stop and wait until they're done
+		m_pMutex->Lock();
+		m_bShutdown = true;
+		m_pMutex->Unlock();
+		for (uint32 i=0; i<m_lstWorkerThreads.GetNumOfElements(); i++)
+			m_lstWorkerThreads[i]->pStartSemaphore->Unlock();
+		for (uint32 i=0; i<m_lstWorkerThreads.GetNumOfElements(); i++) {
+			WorkerThread *pWorkerThread = m_lstWorkerThreads[i];
+			pWorkerThread->pThread->Join();
+			delete pWorkerThread->pThread;
+			delete pWorkerThread->pStartSemaphore;
+			delete pWorkerThread;
+		}
+		m_lstWorkerThreads.Clear();
+		m_bShutdown = false;
+	}
+}
+
+/**
+*  @brief
+*    Static worker thread function computing the updates of the range of scene node modifiers it was given
+*/
+int SceneUpdateScheduler::WorkerThreadFunction(void *pData)
+{
+	WorkerThread &sWorkerThread = *static_cast<WorkerThread*>(pData);
+	SceneUpdateScheduler &cUpdateScheduler = *sWorkerThread.pUpdateScheduler;
+
+	// Wait for blocks to compute
+	while (sWorkerThread.pStartSemaphore->Lock()) {
+		// Shall the worker thread stop?
+		cUpdateScheduler.m_pMutex->Lock();
+		const bool bShutdown = cUpdateScheduler.m_bShutdown;
+		cUpdateScheduler.m_pMutex->Unlock();
+		if (bShutdown)
+			break;
+
+		// Compute the block
+		for (uint32 i=0; i<sWorkerThread.nNumOfModifiers; i++)
+			sWorkerThread.ppModifiers[i]->OnUpdateCompute();
+
+		// Tell the main thread that this block is done
+		cUpdateScheduler.m_pDoneSemaphore->Unlock();
+	}
+
+	// Done
+	return 0;
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // PLScene
@@ -34,7 +34,9 @@
 #include <PLRenderer/Renderer/FixedFunctions.h>
 #include <PLRenderer/Renderer/OcclusionQuery.h>
 #include <PLRenderer/Effect/EffectManager.h>
+#include <PLMesh/Mesh.h>
 #include <PLMesh/MeshHandler.h>
+#include <PLMesh/MeshLODLevel.h>
 #include "PLScene/Scene/SceneContext.h"
 #include "PLScene/Scene/SNSpotLight.h"
 #include "PLScene/Scene/SNCellPortal.h"
@@ -48,6 +50,7 @@
 #include "PLScene/Scene/SceneHierarchyNodeItem.h"
 #include "PLScene/Visibility/VisContainer.h"
 #include "PLScene/Visibility/VisPortal.h"
+#include "PLScene/Visibility/SoftwareOcclusionBuffer.h"
 #include "PLScene/Visibility/SQCull.h"
 
 
@@ -81,6 +84,7 @@ pl_class_metadata_end(SQCull)
 SQCull::SQCull() :
 	m_nMode(Coherent),
 	m_nVisibilityThreshold(10),
+	m_nSoftwareOcclusionBufferWidth(256),
 	m_pCameraContainer(new SceneNodeHandler()),
 	m_bCameraInCell(false),
 	m_bSetIdentityWorldMatrix(true),
@@ -89,6 +93,7 @@ SQCull::SQCull() :
 	m_nCurrentQueries(0),
 	m_nOcclusionQueries(0),
 	m_ppOcclusionQueries(nullptr),
+	m_pSoftwareOcclusionBuffer(nullptr),
 	m_pVisRootContainer(nullptr),
 	m_pVisContainer(nullptr)
 {
@@ -113,6 +118,10 @@ SQCull::~SQCull()
 		delete [] m_ppOcclusionQueries;
 	}
 
+	// Destroy the software occlusion buffer
+	if (m_pSoftwareOcclusionBuffer)
+		delete m_pSoftwareOcclusionBuffer;
+
 	// If this is the root of the scene, destroy the visibility tree
 	if (m_pVisRootContainer == m_pVisContainer && m_pVisRootContainer) {
 		m_pVisRootContainer->m_pQueryHandler->SetElement(nullptr);
@@ -156,6 +165,24 @@ void SQCull::SetVisibilityThreshold(uint32 nThreshold)
 	m_nVisibilityThreshold = nThreshold;
 }
 
+/**
+*  @brief
+*    Returns the width of the software occlusion buffer
+*/
+uint32 SQCull::GetSoftwareOcclusionBufferWidth() const
+{
+	return m_nSoftwareOcclusionBufferWidth;
+}
+
+/**
+*  @brief
+*    Sets the width of the software occlusion buffer
+*/
+void SQCull::SetSoftwareOcclusionBufferWidth(uint32 nWidth)
+{
+	m_nSoftwareOcclusionBufferWidth = nWidth ? nWidth : 1;
+}
+
 /**
 *  @brief
 *    Returns the statistics
@@ -307,7 +334,10 @@ void SQCull::InitStatistics()
 	m_sStatistics.nNumOfSkippedFrustumTests		   = 0;
 	m_sStatistics.nNumOfFrustumCulledNodes		   = 0;
 	m_sStatistics.nNumOfNearPlaneIntersectingNodes = 0;
+	m_sStatistics.nNumOfSoftwareCulledSceneNodes   = 0;
 	m_sStatistics.nNumOfVisibleSceneNodes		   = 0;
+	m_sStatistics.nNumOfHLODProxies				   = 0;
+	m_sStatistics.nNumOfHLODSkippedSceneNodes	   = 0;
 	m_sStatistics.nNumOfQueries					   = 0;
 	m_sStatistics.nMaxNumOfQueries				   = 0;
 	m_sStatistics.bWaitForQueryResult			   = false;
@@ -535,6 +565,105 @@ bool SQCull::CullCoherentWithQueue()
 	return true;
 }
 
+/**
+*  @brief
+*    Culls the scene using view frustum culling and the software occlusion buffer
+*/
+bool SQCull::CullSoftware()
+{
+	// Get the software occlusion buffer and the matrix transforming from container space into clip space
+	const SoftwareOcclusionBuffer *pSoftwareOcclusionBuffer = GetSoftwareOcclusionBuffer();
+	m_mSoftwareOcclusionMVP  = m_mViewProjection;
+	m_mSoftwareOcclusionMVP *= GetVisContainer().GetWorldMatrix();
+
+	// Add root node
+	m_lstDistanceQueue.Add(0.0f, &GetSceneContainer().GetHierarchyInstance()->GetRootNode());
+
+	// Loop until the distance queue is empty
+	while (m_lstDistanceQueue.GetNumOfElements()) {
+		// Get the first node and it's nearest distance to the camera and remove the node from the queue
+		SceneHierarchyNode *pHierarchyNode;
+		float				fNearestSquaredDistance;
+		m_lstDistanceQueue.ExtractTop(&pHierarchyNode, &fNearestSquaredDistance);
+		m_sStatistics.nNumOfTraversedNodes++;
+
+		bool bIntersectsNearplane;
+		if (InsideViewFrustum(*pHierarchyNode, bIntersectsNearplane)) {
+			// Touch this node and resize our arrays if required
+			pHierarchyNode->Touch();
+			ResizeArrays();
+
+			// For near plane intersecting AABs the projection is not reliable => skip occlusion test
+			bool bVisible = true;
+			if (bIntersectsNearplane) {
+				m_sStatistics.nNumOfNearPlaneIntersectingNodes++;
+			} else if (pSoftwareOcclusionBuffer) {
+				// Test against the occluders rasterized so far
+				const AABoundingBox &cAABB = pHierarchyNode->GetAABoundingBox();
+				bVisible = pSoftwareOcclusionBuffer->IsVisible(m_mSoftwareOcclusionMVP, cAABB.vMin, cAABB.vMax);
+			}
+
+			// Node visible
+			if (bVisible) {
+				m_lstVisibility.Set(pHierarchyNode->GetID());
+				if (!TraverseNode(*pHierarchyNode)) {
+					m_lstDistanceQueue.Clear();
+
+					// Cancelled by the user
+					return false;
+				}
+			} else {
+				m_lstVisibility.Clear(pHierarchyNode->GetID());
+				m_sStatistics.nNumOfQueryCulledNodes++;
+			}
+		} else {
+			m_lstVisibility.Clear(pHierarchyNode->GetID());
+			m_sStatistics.nNumOfFrustumCulledNodes++;
+		}
+	}
+
+	// Done, not cancelled by the user
+	return true;
+}
+
+/**
+*  @brief
+*    Returns the software occlusion buffer of the visibility root container
+*/
+SoftwareOcclusionBuffer *SQCull::GetSoftwareOcclusionBuffer() const
+{
+	// Get the cull query of the visibility root container
+	const SQCull *pRootCullQuery = (m_pVisRootContainer && m_pVisRootContainer != m_pVisContainer) ? static_cast<SQCull*>(m_pVisRootContainer->m_pQueryHandler->GetElement()) : this;
+	return pRootCullQuery ? pRootCullQuery->m_pSoftwareOcclusionBuffer : nullptr;
+}
+
+/**
+*  @brief
+*    Rasterizes an occluder into the software occlusion buffer
+*/
+void SQCull::DrawSoftwareOccluder(SceneNode &cSceneNode)
+{
+	SoftwareOcclusionBuffer *pSoftwareOcclusionBuffer = GetSoftwareOcclusionBuffer();
+	const MeshHandler *pMeshHandler = cSceneNode.GetMeshHandler();
+	Mesh *pMesh = pMeshHandler ? pMeshHandler->GetMesh() : nullptr;
+	if (pSoftwareOcclusionBuffer && pMesh && pMesh->GetNumOfLODLevels()) {
+		// Get the triangle positions of the last LOD level, build them if required
+		MeshLODLevel *pLODLevel = pMesh->GetLODLevel(pMesh->GetNumOfLODLevels()-1);
+		const Array<Vector3> &lstTrianglePositions = pLODLevel->GetTrianglePositionList();
+		if (lstTrianglePositions.GetNumOfElements()) {
+			// Calculate the model view projection matrix
+			Matrix4x4 mMVP = m_mSoftwareOcclusionMVP;
+			mMVP *= cSceneNode.GetTransform().GetMatrix();
+
+			// Rasterize the occluder
+			if (pSoftwareOcclusionBuffer->DrawTriangles(mMVP, lstTrianglePositions.GetData(), lstTrianglePositions.GetNumOfElements()/3)) {
+				// Update the statistics
+				m_sStatistics.nNumOfOccluders++;
+			}
+		}
+	}
+}
+
 /**
 *  @brief
 *    Traverses a node
@@ -602,6 +731,29 @@ bool SQCull::TraverseNode(const SceneHierarchyNode &cHierarchyNode)
 		// Get the scene context
 		SceneContext *pSceneContext = GetSceneContext();
 		if (pSceneContext) {
+			// Get the software occlusion buffer, the occluders of previously traversed hierarchy nodes are already within it
+			SoftwareOcclusionBuffer *pSoftwareOcclusionBuffer = (m_nMode == Software) ? GetSoftwareOcclusionBuffer() : nullptr;
+			if (pSoftwareOcclusionBuffer) {
+				// Rasterize the occluders of this hierarchy node before the scene nodes are tested against the software occlusion buffer
+				const SceneHierarchyNodeItem *pItem = cHierarchyNode.GetFirstItem();
+				while (pItem) {
+					// Get the linked scene node
+					SceneNode *pSceneNode = pItem->GetSceneNode();
+
+					// Is this a not yet processed occluder? (a scene node can be linked to multiple hierarchy nodes)
+					if (pSceneNode && (pSceneNode->GetFlags() & SceneNode::CanOcclude) && pSceneNode->IsVisible() && !pSceneContext->IsNodeTouched(*pSceneNode)) {
+						// Don't draw occluders outside the frustum or hidden by other occluders
+						const AABoundingBox &cAABB = pSceneNode->GetContainerAABoundingBox();
+						if ((bTotalVisible || Intersect::PlaneSetAABox(m_cViewFrustum, cAABB.vMin, cAABB.vMax)) &&
+							pSoftwareOcclusionBuffer->IsVisible(m_mSoftwareOcclusionMVP, cAABB.vMin, cAABB.vMax))
+							DrawSoftwareOccluder(*pSceneNode);
+					}
+
+					// Next item, please
+					pItem = pItem->GetNextItem();
+				}
+			}
+
 			const SceneHierarchyNodeItem *pItem = cHierarchyNode.GetFirstItem();
 			while (pItem) {
 				// Get the linked scene node
@@ -609,7 +761,8 @@ bool SQCull::TraverseNode(const SceneHierarchyNode &cHierarchyNode)
 
 				// Is this scene node a cell? If yes, skip it if the camera is within a cell, too - we CAN'T see it from
 				// outside, we can ONLY see it through a cell-portal! :)
-				if (!pSceneNode || !pSceneNode->IsVisible() || (pSceneNode->IsCell() && m_bCameraInCell && pSceneNode != m_pCameraContainer->GetElement())) {
+				// Hierarchical LOD proxy scene nodes are skipped as well, they are only drawn as replacement for their scene container
+				if (!pSceneNode || !pSceneNode->IsVisible() || pSceneNode->IsHLODProxy() || (pSceneNode->IsCell() && m_bCameraInCell && pSceneNode != m_pCameraContainer->GetElement())) {
 					// Next item, please
 					pItem = pItem->GetNextItem();
 					continue;
@@ -698,6 +851,39 @@ bool SQCull::TraverseNode(const SceneHierarchyNode &cHierarchyNode)
 
 						}
 					}
+
+					// Check scene node against the software occlusion buffer, lights are skipped because their bounding box
+					// is not necessarily enclosing everything they are influencing
+					if (bVisible && pSoftwareOcclusionBuffer && !pSceneNode->IsLight() && !(pSceneNode->GetFlags() & SceneNode::NoCulling)) {
+						if (!pSoftwareOcclusionBuffer->IsVisible(m_mSoftwareOcclusionMVP, cAABB.vMin, cAABB.vMax)) {
+							bVisible = false;
+							m_sStatistics.nNumOfSoftwareCulledSceneNodes++;
+						}
+					}
+
+					// Replace a distant scene container by its hierarchical LOD proxy scene node, the scene container is skipped
+					// including all scene nodes within it
+					if (bVisible && pSceneNode->IsContainer()) {
+						SceneContainer &cContainer = static_cast<SceneContainer&>(*pSceneNode);
+						const float fHLODDistance = cContainer.GetHLODDistance();
+						if (fHLODDistance > 0.0f) {
+							// Get the proxy scene node even if the camera is near, this marks the scene node as proxy
+							SceneNode *pProxy = cContainer.GetHLODProxyNode();
+							if (pProxy && pProxy->IsVisible() && (cAABB.GetCenter()-m_vCameraPosition).GetSquaredLength() > fHLODDistance*fHLODDistance) {
+								// The scene container is processed
+								pSceneContext->TouchNode(cContainer);
+
+								// Update the statistics
+								m_sStatistics.nNumOfHLODProxies++;
+								m_sStatistics.nNumOfHLODSkippedSceneNodes += cContainer.GetNumOfElements();
+
+								// Continue with the proxy scene node, the bounding box of the scene container already passed the tests
+								pSceneNode = pProxy;
+								bVisible   = !pSceneContext->IsNodeTouched(*pProxy);
+							}
+						}
+					}
+
 					if (bVisible) {
 						// Touch this node
 						pSceneContext->TouchNode(*pSceneNode);
@@ -1153,6 +1339,18 @@ bool SQCull::PerformQuery()
 		m_nFlags &= ~StopQuery;
 		bool bContinue = true;
 
+		// Clear the software occlusion buffer if this is the root container, all container queries are drawing into this buffer
+		if (m_nMode == Software && m_pVisRootContainer == m_pVisContainer) {
+			if (!m_pSoftwareOcclusionBuffer)
+				m_pSoftwareOcclusionBuffer = new SoftwareOcclusionBuffer();
+
+			// The height is calculated by using the aspect ratio of the viewport
+			const Rectangle &cViewport = cRenderer.GetViewport();
+			const uint32 nWidth = m_nSoftwareOcclusionBufferWidth;
+			const uint32 nHeight = (cViewport.GetWidth() > 0.0f) ? static_cast<uint32>(nWidth*cViewport.GetHeight()/cViewport.GetWidth()) : nWidth;
+			m_pSoftwareOcclusionBuffer->Clear(nWidth, nHeight);
+		}
+
 
 		// [TODO] Allow viewport scale
 	//	cRenderer.SetViewport(Rectangle(0, 0, 100, 100));
@@ -1213,6 +1411,8 @@ bool SQCull::PerformQuery()
 			// Use the desired render mode
 			if (m_nMode == Frustum) {
 				bContinue = CullFrustum();
+			} else if (m_nMode == Software) {
+				bContinue = CullSoftware();
 			} else if (m_nMode == StopAndWait || m_nMode == Coherent) {
 				// [TODO] Make those settings configurable?
 				const float fSlopeScaleDepthBias	= -0.1f;
@@ -1261,7 +1461,7 @@ bool SQCull::PerformQuery()
 		m_sStatistics.nNumOfVisibleSceneNodes = cVisContainer.m_lstNodes.GetNumOfElements();
 
 		// Get culling time
-		m_sStatistics.nCullTime = static_cast<uint64>(cStopwatch.GetMilliseconds());
+		m_sStatistics.nCullTime = cStopwatch.GetMicroseconds();
 
 		// Reset hierarchy pointer - just for sure :)
 		m_pHierarchy = nullptr;
@@ -0,0 +1,386 @@
+/*********************************************************\
+ *  File: SoftwareOcclusionBuffer.cpp                    *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <PLMath/Math.h>
+#include <PLMath/Matrix4x4.h>
+#include "PLScene/Visibility/SoftwareOcclusionBuffer.h"
+#ifdef PLMATH_SSE2
+	#include <emmintrin.h>
+#endif
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+using namespace PLCore;
+using namespace PLMath;
+namespace PLScene {
+
+
+//[-------------------------------------------------------]
+//[ Global definitions                                    ]
+//[-------------------------------------------------------]
+static const float ClearDepth = 3.402823466e+38f;	/**< Depth of pixels no occluder was drawn into (largest float) */
+static const float MinimumW   = 1e-5f;				/**< Clip space w below which a position is considered to be behind the camera */
+
+
+//[-------------------------------------------------------]
+//[ Public functions                                      ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Default constructor
+*/
+SoftwareOcclusionBuffer::SoftwareOcclusionBuffer() :
+	m_nWidth(0),
+	m_nHeight(0),
+	m_nNumOfTilesX(0),
+	m_nNumOfTilesY(0),
+	m_pfDepth(nullptr),
+	m_pfTileDepth(nullptr)
+{
+}
+
+/**
+*  @brief
+*    Destructor
+*/
+SoftwareOcclusionBuffer::~SoftwareOcclusionBuffer()
+{
+	if (m_pfDepth)
+		delete [] m_pfDepth;
+	if (m_pfTileDepth)
+		delete [] m_pfTileDepth;
+}
+
+/**
+*  @brief
+*    Clears the depth buffer
+*/
+void SoftwareOcclusionBuffer::Clear(uint32 nWidth, uint32 nHeight)
+{
+	// Get the number of tiles, there's always at least one tile
+	const uint32 nNumOfTilesX = Math::Max((nWidth +TileSize-1)/TileSize, 1U);
+	const uint32 nNumOfTilesY = Math::Max((nHeight+TileSize-1)/TileSize, 1U);
+
+	// Reallocate the buffers if the dimension has changed
+	if (nNumOfTilesX != m_nNumOfTilesX || nNumOfTilesY != m_nNumOfTilesY) {
+		if (m_pfDepth)
+			delete [] m_pfDepth;
+		if (m_pfTileDepth)
+			delete [] m_pfTileDepth;
+		m_nNumOfTilesX = nNumOfTilesX;
+		m_nNumOfTilesY = nNumOfTilesY;
+		m_nWidth       = nNumOfTilesX*TileSize;
+		m_nHeight      = nNumOfTilesY*TileSize;
+		m_pfDepth      = new float[m_nWidth*m_nHeight];
+		m_pfTileDepth  = new float[m_nNumOfTilesX*m_nNumOfTilesY];
+	}
+
+	// Clear the buffers
+	for (uint32 i=0; i<m_nWidth*m_nHeight; i++)
+		m_pfDepth[i] = ClearDepth;
+	for (uint32 i=0; i<m_nNumOfTilesX*m_nNumOfTilesY; i++)
+		m_pfTileDepth[i] = ClearDepth;
+}
+
+/**
+*  @brief
+*    Draws occluder triangles into the depth buffer
+*/
+uint32 SoftwareOcclusionBuffer::DrawTriangles(const Matrix4x4 &mWorldViewProjection, const Vector3 *pvPositions, uint32 nNumOfTriangles)
+{
+	uint32 nNumOfRasterizedTriangles = 0;
+
+	// Is there a depth buffer?
+	if (m_pfDepth) {
+		const Matrix4x4 &m = mWorldViewProjection;
+		const float fHalfWidth  = m_nWidth *0.5f;
+		const float fHalfHeight = m_nHeight*0.5f;
+
+		// Loop through all triangles
+		for (uint32 nTriangle=0; nTriangle<nNumOfTriangles; nTriangle++, pvPositions+=3) {
+			// Transform the vertices into pixel coordinates and depth
+			float fV[3][3];
+			bool bValid = true;
+			for (uint32 i=0; i<3 && bValid; i++) {
+				const Vector3 &vV = pvPositions[i];
+				const float fW = m.wx*vV.x + m.wy*vV.y + m.wz*vV.z + m.ww;
+				if (fW < MinimumW) {
+					// Behind the camera
+					bValid = false;
+				} else {
+					const float fInvW = 1.0f/fW;
+					fV[i][0] = ( (m.xx*vV.x + m.xy*vV.y + m.xz*vV.z + m.xw)*fInvW + 1.0f)*fHalfWidth;
+					fV[i][1] = (-(m.yx*vV.x + m.yy*vV.y + m.yz*vV.z + m.yw)*fInvW + 1.0f)*fHalfHeight;
+					fV[i][2] =   (m.zx*vV.x + m.zy*vV.y + m.zz*vV.z + m.zw)*fInvW;
+				}
+			}
+
+			// Rasterize the triangle
+			if (bValid && RasterizeTriangle(fV[0], fV[1], fV[2]))
+				nNumOfRasterizedTriangles++;
+		}
+	}
+
+	// Done
+	return nNumOfRasterizedTriangles;
+}
+
+/**
+*  @brief
+*    Checks whether or not an axis aligned bounding box may be visible
+*/
+bool SoftwareOcclusionBuffer::IsVisible(const Matrix4x4 &mWorldViewProjection, const Vector3 &vMin, const Vector3 &vMax) const
+{
+	// Without a depth buffer, we can't tell
+	if (!m_pfDepth)
+		return true;
+
+	// Project the corners of the box and get the screen rectangle and the nearest depth
+	const Matrix4x4 &m = mWorldViewProjection;
+	float fMinX = ClearDepth, fMinY = ClearDepth, fMaxX = -ClearDepth, fMaxY = -ClearDepth, fMinZ = ClearDepth;
+	for (uint32 i=0; i<8; i++) {
+		const float fX = (i & 1) ? vMax.x : vMin.x;
+		const float fY = (i & 2) ? vMax.y : vMin.y;
+		const float fZ = (i & 4) ? vMax.z : vMin.z;
+		const float fW = m.wx*fX + m.wy*fY + m.wz*fZ + m.ww;
+		if (fW < MinimumW)
+			return true; // Behind the camera, we can't tell
+
+		// Pixel coordinates and depth
+		const float fInvW = 1.0f/fW;
+		const float fScreenX = ( (m.xx*fX + m.xy*fY + m.xz*fZ + m.xw)*fInvW + 1.0f)*(m_nWidth *0.5f);
+		const float fScreenY = (-(m.yx*fX + m.yy*fY + m.yz*fZ + m.yw)*fInvW + 1.0f)*(m_nHeight*0.5f);
+		const float fDepth   =   (m.zx*fX + m.zy*fY + m.zz*fZ + m.zw)*fInvW;
+		fMinX = Math::Min(fMinX, fScreenX);
+		fMinY = Math::Min(fMinY, fScreenY);
+		fMaxX = Math::Max(fMaxX, fScreenX);
+		fMaxY = Math::Max(fMaxY, fScreenY);
+		fMinZ = Math::Min(fMinZ, fDepth);
+	}
+
+	// Completely outside the buffer? (all corners are in front of the camera, so the box really can't be seen)
+	if (fMaxX < 0.0f || fMaxY < 0.0f || fMinX >= static_cast<float>(m_nWidth) || fMinY >= static_cast<float>(m_nHeight))
+		return false;
+
+	// Get the covered tiles
+	const uint32 nTileX0 = static_cast<uint32>(Math::Max(fMinX, 0.0f))/TileSize;
+	const uint32 nTileY0 = static_cast<uint32>(Math::Max(fMinY, 0.0f))/TileSize;
+	const uint32 nTileX1 = Math::Min(static_cast<uint32>(fMaxX)/TileSize, m_nNumOfTilesX-1);
+	const uint32 nTileY1 = Math::Min(static_cast<uint32>(fMaxY)/TileSize, m_nNumOfTilesY-1);
+
+	// The box may be visible if it's nearer than the farthest depth of at least one tile
+	for (uint32 nTileY=nTileY0; nTileY<=nTileY1; nTileY++) {
+		const float *pfTileDepth = &m_pfTileDepth[nTileY*m_nNumOfTilesX];
+		for (uint32 nTileX=nTileX0; nTileX<=nTileX1; nTileX++) {
+			if (fMinZ <= pfTileDepth[nTileX])
+				return true;
+		}
+	}
+
+	// The box is hidden
+	return false;
+}
+
+
+//[-------------------------------------------------------]
+//[ Private functions                                     ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Copy constructor
+*/
+SoftwareOcclusionBuffer::SoftwareOcclusionBuffer(const SoftwareOcclusionBuffer &cSource) :
+	m_nWidth(0),
+	m_nHeight(0),
+	m_nNumOfTilesX(0),
+	m_nNumOfTilesY(0),
+	m_pfDepth(nullptr),
+	m_pfTileDepth(nullptr)
+{
+	// No implementation because the copy constructor is never used
+}
+
+/**
+*  @brief
+*    Copy operator
+*/
+SoftwareOcclusionBuffer &SoftwareOcclusionBuffer::operator =(const SoftwareOcclusionBuffer &cSource)
+{
+	// No implementation because the copy operator is never used
+	return *this;
+}
+
+/**
+*  @brief
+*    Rasterizes a single triangle
+*/
+bool SoftwareOcclusionBuffer::RasterizeTriangle(const float *pfV0, const float *pfV1, const float *pfV2)
+{
+	// Get the doubled signed area, rasterize both sides by swapping two vertices of back facing triangles
+	double dArea = static_cast<double>(pfV1[0] - pfV0[0])*(pfV2[1] - pfV0[1]) - static_cast<double>(pfV2[0] - pfV0[0])*(pfV1[1] - pfV0[1]);
+	if (dArea < 0.0) {
+		const float *pfT = pfV1;
+		pfV1  = pfV2;
+		pfV2  = pfT;
+		dArea = -dArea;
+	}
+	if (dArea < 1e-8)
+		return false; // Degenerated
+
+	// Get the bounding rectangle of the triangle
+	const float fMinX = Math::Min(pfV0[0], Math::Min(pfV1[0], pfV2[0]));
+	const float fMinY = Math::Min(pfV0[1], Math::Min(pfV1[1], pfV2[1]));
+	const float fMaxX = Math::Max(pfV0[0], Math::Max(pfV1[0], pfV2[0]));
+	const float fMaxY = Math::Max(pfV0[1], Math::Max(pfV1[1], pfV2[1]));
+	if (fMaxX < 0.0f || fMaxY < 0.0f || fMinX >= static_cast<float>(m_nWidth) || fMinY >= static_cast<float>(m_nHeight))
+		return false; // Outside the buffer
+	const uint32 nX0 = static_cast<uint32>(Math::Max(fMinX, 0.0f));
+	const uint32 nY0 = static_cast<uint32>(Math::Max(fMinY, 0.0f));
+	const uint32 nX1 = Math::Min(static_cast<uint32>(fMaxX), m_nWidth -1);
+	const uint32 nY1 = Math::Min(static_cast<uint32>(fMaxY), m_nHeight-1);
+
+	// Setup the edge functions "fA*x + fB*y + fC" (positive inside the triangle) and the depth plane in double
+	// precision, because the vertices of large triangles may be far outside the buffer
+	const float *pfV[3] = { pfV0, pfV1, pfV2 };
+	double dA[3], dB[3], dC[3];
+	for (uint32 i=0; i<3; i++) {
+		const float *pfA = pfV[(i+1)%3];
+		const float *pfB = pfV[(i+2)%3];
+		dA[i] = static_cast<double>(pfA[1]) - pfB[1];
+		dB[i] = static_cast<double>(pfB[0]) - pfA[0];
+		dC[i] = static_cast<double>(pfA[0])*pfB[1] - static_cast<double>(pfA[1])*pfB[0];
+	}
+	// Edge function i is the barycentric weight of vertex i
+	const double dInvArea = 1.0/dArea;
+	const double dZA = (dA[0]*pfV0[2] + dA[1]*pfV1[2] + dA[2]*pfV2[2])*dInvArea;
+	const double dZB = (dB[0]*pfV0[2] + dB[1]*pfV1[2] + dB[2]*pfV2[2])*dInvArea;
+	const double dZC = (dC[0]*pfV0[2] + dC[1]*pfV1[2] + dC[2]*pfV2[2])*dInvArea;
+
+	// Walk the rows in blocks of four pixels, the buffer width is a multiple of four
+	const uint32 nBlockX0 = nX0 & ~3U;
+	const uint32 nBlockX1 = nX1 | 3U;
+	const double dX = nBlockX0 + 0.5;
+	for (uint32 nY=nY0; nY<=nY1; nY++) {
+		// Evaluate the functions at the center of the first pixel of the row
+		const double dY = nY + 0.5;
+		float *pfDepth = &m_pfDepth[nY*m_nWidth];
+
+		#ifdef PLMATH_SSE2
+			const __m128 fOffset = _mm_set_ps(3.0f, 2.0f, 1.0f, 0.0f);
+			__m128 fE0 = _mm_add_ps(_mm_set1_ps(static_cast<float>(dA[0]*dX + dB[0]*dY + dC[0])), _mm_mul_ps(_mm_set1_ps(static_cast<float>(dA[0])), fOffset));
+			__m128 fE1 = _mm_add_ps(_mm_set1_ps(static_cast<float>(dA[1]*dX + dB[1]*dY + dC[1])), _mm_mul_ps(_mm_set1_ps(static_cast<float>(dA[1])), fOffset));
+			__m128 fE2 = _mm_add_ps(_mm_set1_ps(static_cast<float>(dA[2]*dX + dB[2]*dY + dC[2])), _mm_mul_ps(_mm_set1_ps(static_cast<float>(dA[2])), fOffset));
+			__m128 fZ  = _mm_add_ps(_mm_set1_ps(static_cast<float>(dZA*dX + dZB*dY + dZC)), _mm_mul_ps(_mm_set1_ps(static_cast<float>(dZA)), fOffset));
+			const __m128 fStepE0 = _mm_set1_ps(static_cast<float>(dA[0]*4.0));
+			const __m128 fStepE1 = _mm_set1_ps(static_cast<float>(dA[1]*4.0));
+			const __m128 fStepE2 = _mm_set1_ps(static_cast<float>(dA[2]*4.0));
+			const __m128 fStepZ  = _mm_set1_ps(static_cast<float>(dZA*4.0));
+			const __m128 fZero   = _mm_setzero_ps();
+			for (uint32 nX=nBlockX0; nX<=nBlockX1; nX+=4) {
+				// Inside all three edges?
+				const __m128 fInside = _mm_and_ps(_mm_and_ps(_mm_cmpge_ps(fE0, fZero), _mm_cmpge_ps(fE1, fZero)), _mm_cmpge_ps(fE2, fZero));
+				if (_mm_movemask_ps(fInside)) {
+					// Keep the nearer depth
+					const __m128 fOld = _mm_loadu_ps(&pfDepth[nX]);
+					const __m128 fNew = _mm_and_ps(fInside, _mm_min_ps(fOld, fZ));
+					_mm_storeu_ps(&pfDepth[nX], _mm_or_ps(fNew, _mm_andnot_ps(fInside, fOld)));
+				}
+
+				// Next block
+				fE0 = _mm_add_ps(fE0, fStepE0);
+				fE1 = _mm_add_ps(fE1, fStepE1);
+				fE2 = _mm_add_ps(fE2, fStepE2);
+				fZ  = _mm_add_ps(fZ,  fStepZ);
+			}
+		#else
+			float fE0 = static_cast<float>(dA[0]*dX + dB[0]*dY + dC[0]);
+			float fE1 = static_cast<float>(dA[1]*dX + dB[1]*dY + dC[1]);
+			float fE2 = static_cast<float>(dA[2]*dX + dB[2]*dY + dC[2]);
+			float fZ  = static_cast<float>(dZA*dX + dZB*dY + dZC);
+			const float fStepE0 = static_cast<float>(dA[0]);
+			const float fStepE1 = static_cast<float>(dA[1]);
+			const float fStepE2 = static_cast<float>(dA[2]);
+			const float fStepZ  = static_cast<float>(dZA);
+			for (uint32 nX=nBlockX0; nX<=nBlockX1; nX++) {
+				// Inside all three edges? If so, keep the nearer depth
+				if (fE0 >= 0.0f && fE1 >= 0.0f && fE2 >= 0.0f && fZ < pfDepth[nX])
+					pfDepth[nX] = fZ;
+
+				// Next pixel
+				fE0 += fStepE0;
+				fE1 += fStepE1;
+				fE2 += fStepE2;
+				fZ  += fStepZ;
+			}
+		#endif
+	}
+
+	// Update the farthest depth of the touched tiles
+	UpdateTiles(nX0, nY0, nX1, nY1);
+
+	// Done
+	return true;
+}
+
+/**
+*  @brief
+*    Updates the farthest depth of all tiles within the given pixel rectangle
+*/
+void SoftwareOcclusionBuffer::UpdateTiles(uint32 nX0, uint32 nY0, uint32 nX1, uint32 nY1)
+{
+	for (uint32 nTileY=nY0/TileSize; nTileY<=nY1/TileSize; nTileY++) {
+		for (uint32 nTileX=nX0/TileSize; nTileX<=nX1/TileSize; nTileX++) {
+			// Get the farthest depth within the tile
+			const float *pfDepth = &m_pfDepth[nTileY*TileSize*m_nWidth + nTileX*TileSize];
+			#ifdef PLMATH_SSE2
+				__m128 fMax = _mm_loadu_ps(pfDepth);
+				for (uint32 nY=0; nY<TileSize; nY++, pfDepth+=m_nWidth) {
+					for (uint32 nX=0; nX<TileSize; nX+=4)
+						fMax = _mm_max_ps(fMax, _mm_loadu_ps(&pfDepth[nX]));
+				}
+				fMax = _mm_max_ps(fMax, _mm_shuffle_ps(fMax, fMax, _MM_SHUFFLE(1, 0, 3, 2)));
+				fMax = _mm_max_ps(fMax, _mm_shuffle_ps(fMax, fMax, _MM_SHUFFLE(2, 3, 0, 1)));
+				_mm_store_ss(&m_pfTileDepth[nTileY*m_nNumOfTilesX + nTileX], fMax);
+			#else
+				float fMax = pfDepth[0];
+				for (uint32 nY=0; nY<TileSize; nY++, pfDepth+=m_nWidth) {
+					for (uint32 nX=0; nX<TileSize; nX++)
+						fMax = Math::Max(fMax, pfDepth[nX]);
+				}
+				m_pfTileDepth[nTileY*m_nNumOfTilesX + nTileX] = fMax;
+			#endif
+		}
+	}
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // PLScene
@@ -25,6 +25,9 @@
 //[-------------------------------------------------------]
 //[ Includes                                              ]
 //[-------------------------------------------------------]
+#include <PLMath/Sphere.h>
+#include <PLRenderer/Material/Material.h>
+#include <PLMesh/MeshHandler.h>
 #include "PLScene/Scene/SNCellPortal.h"
 #include "PLScene/Scene/SceneContext.h"
 #include "PLScene/Scene/SceneContainer.h"
@@ -40,6 +43,9 @@
 //[ Namespace                                             ]
 //[-------------------------------------------------------]
 using namespace PLCore;
+using namespace PLMath;
+using namespace PLRenderer;
+using namespace PLMesh;
 namespace PLScene {
 
 
@@ -73,6 +79,49 @@ const VisContainer::Projection &VisContainer::GetProjection() const
 	return m_sProjection;
 }
 
+/**
+*  @brief
+*    Reports the texture usage of all visible scene nodes for texture streaming
+*/
+void VisContainer::ReportTextureUsage(float fViewportHeight) const
+{
+	Iterator<VisNode*> cIterator = m_lstNodes.GetIterator();
+	while (cIterator.HasNext()) {
+		const VisNode *pVisNode   = cIterator.Next();
+		SceneNode	  *pSceneNode = pVisNode->GetSceneNode();
+		if (pSceneNode) {
+			// Is this scene node a portal?
+			if (pVisNode->IsPortal()) {
+				const VisContainer *pVisCell = static_cast<const VisPortal*>(pVisNode)->GetTargetVisContainer();
+				if (pVisCell && pVisCell->GetCullQuery())
+					pVisCell->ReportTextureUsage(fViewportHeight);
+
+			// Is this scene node a container?
+			} else if (pVisNode->IsContainer()) {
+				if (static_cast<const VisContainer*>(pVisNode)->GetCullQuery())
+					static_cast<const VisContainer*>(pVisNode)->ReportTextureUsage(fViewportHeight);
+
+			// Report the usage of the materials of the mesh
+			} else {
+				const MeshHandler *pMeshHandler = pSceneNode->GetMeshHandler();
+				if (pMeshHandler && pMeshHandler->GetNumOfMaterials()) {
+					// Get the approximated screen space size of the bounding sphere, it covers the whole screen if the camera is inside
+					const float fRadius   = pSceneNode->GetContainerBoundingSphere().GetRadius();
+					const float fDistance = Math::Sqrt(pVisNode->GetSquaredDistanceToCamera());
+					const float fSize     = (fDistance > fRadius) ? fRadius*pVisNode->GetProjectionMatrix().yy*fViewportHeight/fDistance : fViewportHeight;
+
+					// Report the usage to all materials
+					for (uint32 i=0; i<pMeshHandler->GetNumOfMaterials(); i++) {
+						const Material *pMaterial = pMeshHandler->GetMaterial(i);
+						if (pMaterial)
+							pMaterial->ReportTextureUsage(fSize);
+					}
+				}
+			}
+		}
+	}
+}
+
 
 //[-------------------------------------------------------]
 //[ Private functions                                     ]
@@ -158,7 +158,7 @@ class SRPDirectionalLightingFixedFunctions : public SRPDirectionalLighting {
 	//[ Private virtual SRPDirectionalLighting functions      ]
 	//[-------------------------------------------------------]
 	private:
-		virtual void DrawMesh(PLRenderer::Renderer &cRenderer, const PLScene::SQCull &cCullQuery, const PLScene::VisNode &cVisNode, PLScene::SceneNode &cSceneNode, const PLMesh::MeshHandler &cMeshHandler, const PLMesh::Mesh &cMesh, const PLMesh::MeshLODLevel &cMeshLODLevel, PLRenderer::VertexBuffer &cVertexBuffer) override;
+		virtual void DrawItem(PLRenderer::Renderer &cRenderer, const PLScene::RenderQueue::Item &cItem) override;
 
 
 	//[-------------------------------------------------------]
@@ -31,6 +31,7 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include <PLGraphics/Color/Color3.h>
+#include <PLScene/Compositing/RenderQueue.h>
 #include <PLScene/Compositing/SceneRendererPass.h>
 #include "PLCompositing/PLCompositing.h"
 
@@ -38,17 +39,8 @@
 //[-------------------------------------------------------]
 //[ Forward declarations                                  ]
 //[-------------------------------------------------------]
-namespace PLRenderer {
-	class VertexBuffer;
-}
-namespace PLMesh {
-	class Mesh;
-	class MeshHandler;
-	class MeshLODLevel;
-}
 namespace PLScene {
 	class VisNode;
-	class SceneNode;
 }
 
 
@@ -72,6 +64,11 @@ namespace PLCompositing {
 *    scene renderer passes should be able to detect that a certain directional light source has already been rendered, and don't render
 *    this light a second time. As a result, this scene renderer pass can be used as stand alone, or as a part of for example a forward
 *    rendering pipeline.
+*
+*    The visible mesh geometries are collected within a render queue which is sorted by program, material and
+*    depth before drawing (solid geometry front to back, transparent geometry back to front) to reduce the
+*    number of state changes. If "Instancing" is enabled and the implementation supports it, visible mesh geometries
+*    sharing mesh, LOD and material are drawn by using one instanced draw call.
 */
 class SRPDirectionalLighting : public PLScene::SceneRendererPass {
 
@@ -119,6 +116,18 @@ class SRPDirectionalLighting : public PLScene::SceneRendererPass {
 			pl_enum_value(NoLighting,		"Do not perform lighting by using the first found directional light source")
 		pl_enum_end
 
+		/**
+		*  @brief
+		*    Statistics of the last drawn frame
+		*/
+		struct Statistics {
+			PLCore::uint32 nNumOfItems;				/**< Number of drawn render queue items (visible mesh geometries) */
+			PLCore::uint32 nNumOfBatches;			/**< Number of render queue batches the items were grouped into */
+			PLCore::uint32 nNumOfInstancedBatches;	/**< Number of batches drawn by using instancing */
+			PLCore::uint32 nNumOfInstancedItems;	/**< Number of items drawn by using instancing */
+			PLCore::uint32 nNumOfDrawCalls;			/**< Number of draw calls issued by this scene renderer pass */
+		};
+
 
 	//[-------------------------------------------------------]
 	//[ RTTI interface                                        ]
@@ -128,11 +137,27 @@ class SRPDirectionalLighting : public PLScene::SceneRendererPass {
 		pl_attribute_directvalue(							AmbientColor,		PLGraphics::Color3,	PLGraphics::Color3::White,	ReadWrite)
 		pl_attribute_directvalue(							LightingIntensity,	float,				1.0f,						ReadWrite)
 		pl_attribute_directvalue(							TextureFiltering,	ETextureFiltering,	Anisotropic8,				ReadWrite)
+		pl_attribute_directvalue(							SortRenderQueue,	bool,				true,						ReadWrite)
+		pl_attribute_directvalue(							Instancing,			bool,				true,						ReadWrite)
 			// Overwritten PLScene::SceneRendererPass attributes
 		pl_attribute_getset		(SRPDirectionalLighting,	Flags,				PLCore::uint32,		0,							ReadWrite)
 	pl_class_def_end
 
 
+	//[-------------------------------------------------------]
+	//[ Public functions                                      ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Returns the statistics of the last drawn frame
+		*
+		*  @return
+		*    The statistics of the last drawn frame
+		*/
+		PLCOM_API const Statistics &GetStatistics() const;
+
+
 	//[-------------------------------------------------------]
 	//[ Protected functions                                   ]
 	//[-------------------------------------------------------]
@@ -162,14 +187,18 @@ class SRPDirectionalLighting : public PLScene::SceneRendererPass {
 
 		/**
 		*  @brief
-		*    Draws recursive
+		*    Fills the render queue with all visible mesh geometries and draws them
 		*
 		*  @param[in] cRenderer
 		*    Renderer to use
 		*  @param[in] cCullQuery
 		*    Cull query to use
+		*
+		*  @note
+		*    - If "SortRenderQueue" is disabled, the geometries are drawn in the order of the visibility nodes (reverse order for transparent passes)
+		*    - Instancing is only used for sorted solid geometry
 		*/
-		PLCOM_API void DrawRec(PLRenderer::Renderer &cRenderer, const PLScene::SQCull &cCullQuery);
+		PLCOM_API void DrawRenderQueue(PLRenderer::Renderer &cRenderer, const PLScene::SQCull &cCullQuery);
 
 		/**
 		*  @brief
@@ -190,26 +219,72 @@ class SRPDirectionalLighting : public PLScene::SceneRendererPass {
 	protected:
 		/**
 		*  @brief
-		*    Draws a mesh
+		*    Returns the program a render queue item will be drawn with
+		*
+		*  @param[in] cItem
+		*    Render queue item, the sort key is not yet set
+		*
+		*  @return
+		*    Anything identifying the program, only used for sorting, a null pointer if there are no programs (default implementation)
+		*/
+		PLCOM_API virtual const void *GetItemProgram(const PLScene::RenderQueue::Item &cItem);
+
+		/**
+		*  @brief
+		*    Draws a render queue item
 		*
 		*  @param[in] cRenderer
 		*    Renderer to use
-		*  @param[in] cCullQuery
-		*    Cull query to use
-		*  @param[in] cVisNode
-		*    Visibility node to use
-		*  @param[in] cSceneNode
-		*    Mesh owner scene node
-		*  @param[in] cMeshHandler
-		*    Mesh handler to use
-		*  @param[in] cMesh
-		*    Mesh to draw
-		*  @param[in] cMeshLODLevel
-		*    LOD level of the mesh to draw
-		*  @param[in] cVertexBuffer
-		*    Vertex buffer to use
-		*/
-		virtual void DrawMesh(PLRenderer::Renderer &cRenderer, const PLScene::SQCull &cCullQuery, const PLScene::VisNode &cVisNode, PLScene::SceneNode &cSceneNode, const PLMesh::MeshHandler &cMeshHandler, const PLMesh::Mesh &cMesh, const PLMesh::MeshLODLevel &cMeshLODLevel, PLRenderer::VertexBuffer &cVertexBuffer) = 0;
+		*  @param[in] cItem
+		*    Render queue item to draw
+		*/
+		virtual void DrawItem(PLRenderer::Renderer &cRenderer, const PLScene::RenderQueue::Item &cItem) = 0;
+
+		/**
+		*  @brief
+		*    Returns the maximum number of render queue items which can be drawn by using one instanced draw call
+		*
+		*  @param[in] cRenderer
+		*    Renderer to use
+		*
+		*  @return
+		*    The maximum number of items per instanced draw call, 1 if instancing is not supported (default implementation)
+		*/
+		PLCOM_API virtual PLCore::uint32 GetMaxNumOfInstances(PLRenderer::Renderer &cRenderer) const;
+
+		/**
+		*  @brief
+		*    Called after the render queue was sorted and batched, before the batches are drawn
+		*
+		*  @param[in] cRenderer
+		*    Renderer to use
+		*  @param[in] cRenderQueue
+		*    The render queue to draw
+		*
+		*  @note
+		*    - Can for example be used to fill per frame instance data, the default implementation does nothing
+		*    - "DrawBatch()" is called for the batches in the order of the render queue
+		*/
+		PLCOM_API virtual void PrepareBatches(PLRenderer::Renderer &cRenderer, const PLScene::RenderQueue &cRenderQueue);
+
+		/**
+		*  @brief
+		*    Draws a render queue batch with more than one item
+		*
+		*  @param[in] cRenderer
+		*    Renderer to use
+		*  @param[in] cRenderQueue
+		*    The render queue to draw
+		*  @param[in] sBatch
+		*    Batch to draw, the items of the batch share mesh, LOD and material
+		*
+		*  @return
+		*    'true' if the batch was drawn by using instancing, else 'false'
+		*
+		*  @note
+		*    - The default implementation draws each item by using "DrawItem()"
+		*/
+		PLCOM_API virtual bool DrawBatch(PLRenderer::Renderer &cRenderer, const PLScene::RenderQueue &cRenderQueue, const PLScene::RenderQueue::Batch &sBatch);
 
 
 	//[-------------------------------------------------------]
@@ -228,6 +303,23 @@ class SRPDirectionalLighting : public PLScene::SceneRendererPass {
 		*/
 		const PLScene::VisNode *GetFirstDirectionalLightRec(const PLScene::SQCull &cCullQuery) const;
 
+		/**
+		*  @brief
+		*    Fills the render queue, recursive part
+		*
+		*  @param[in] cCullQuery
+		*    Cull query to use
+		*/
+		void FillRenderQueueRec(const PLScene::SQCull &cCullQuery);
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		PLScene::RenderQueue m_cRenderQueue;	/**< Render queue, only valid while drawing */
+		Statistics			 m_sStatistics;		/**< Statistics of the last drawn frame */
+
 
 };
 
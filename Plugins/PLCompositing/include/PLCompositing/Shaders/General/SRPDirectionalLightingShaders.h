@@ -33,6 +33,7 @@
 #include <PLCore/Base/Event/EventHandler.h>
 #include <PLRenderer/Renderer/ProgramGenerator.h>
 #include <PLScene/Scene/SceneNodeHandler.h>
+#include "PLCompositing/Shaders/General/SRPDirectionalLightingShadersMaterial.h"
 #include "PLCompositing/SRPDirectionalLighting.h"
 #include "PLCompositing/PLCompositing.h"
 
@@ -41,13 +42,17 @@
 //[ Forward declarations                                  ]
 //[-------------------------------------------------------]
 namespace PLRenderer {
+	class VertexBuffer;
 	class RenderStates;
+	class TextureBuffer;
 	class ProgramUniform;
 	class ProgramAttribute;
 }
+namespace PLScene {
+	class SceneNode;
+}
 namespace PLCompositing {
 	class SNDirectionalLight;
-	class SRPDirectionalLightingShadersMaterial;
 }
 
 
@@ -255,6 +260,50 @@ class SRPDirectionalLightingShaders : public SRPDirectionalLighting {
 		*/
 		void OnMaterialRemoved(PLRenderer::Material &cMaterial);
 
+		/**
+		*  @brief
+		*    Returns the SRPDirectionalLightingShaders-material of a material
+		*
+		*  @param[in] cMaterial
+		*    Material to return the SRPDirectionalLightingShaders-material from
+		*
+		*  @return
+		*    The SRPDirectionalLightingShaders-material, created and cached if required
+		*/
+		SRPDirectionalLightingShadersMaterial &GetSRPDirectionalLightingShadersMaterial(PLRenderer::Material &cMaterial);
+
+		/**
+		*  @brief
+		*    Returns the environment flags to use for drawing a scene node
+		*
+		*  @param[in] cSceneNode
+		*    Scene node to draw
+		*  @param[in] cVertexBuffer
+		*    Vertex buffer of the scene node
+		*
+		*  @return
+		*    Environment flags (see SRPDirectionalLightingShadersMaterial::EEnvironmentFlags)
+		*/
+		PLCore::uint32 GetEnvironmentFlags(const PLScene::SceneNode &cSceneNode, const PLRenderer::VertexBuffer &cVertexBuffer) const;
+
+		/**
+		*  @brief
+		*    Draws the geometry of a render queue item
+		*
+		*  @param[in] cRenderer
+		*    Renderer to use
+		*  @param[in] cItem
+		*    Render queue item to draw
+		*  @param[in] nFirstInstance
+		*    Instance map row of the first instance, ignored if "nNumOfInstances" is 0
+		*  @param[in] nNumOfInstances
+		*    Number of instances to draw by using geometric primitive instancing, 0 to draw only the given item without instancing
+		*
+		*  @return
+		*    'true' if all went fine, else 'false' (for example the generated program is not available)
+		*/
+		bool DrawGeometry(PLRenderer::Renderer &cRenderer, const PLScene::RenderQueue::Item &cItem, PLCore::uint32 nFirstInstance, PLCore::uint32 nNumOfInstances);
+
 
 	//[-------------------------------------------------------]
 	//[ Private event handlers                                ]
@@ -282,12 +331,28 @@ class SRPDirectionalLightingShaders : public SRPDirectionalLighting {
 		PLRenderer::RenderStates												*m_pRenderStates;		/**< Used to 'translate' render state strings, always valid! */
 		PLCore::HashMap<PLCore::uint64, SRPDirectionalLightingShadersMaterial*>  m_lstMaterialCache;	/**< List of cached materials */
 
+		// Current states while drawing the render queue
+		SRPDirectionalLightingShadersMaterial							*m_pCurrentMaterial;					/**< Current used SRPDirectionalLightingShaders-material, can be a null pointer */
+		PLCore::uint32													 m_nCurrentEnvironmentFlags;			/**< Current used environment flags */
+		SRPDirectionalLightingShadersMaterial::GeneratedProgramUserData	*m_pCurrentGeneratedProgramUserData;	/**< Generated program user data of the current used material, can be a null pointer */
+
+		// Instancing
+		bool						 m_bInstancingSupported;	/**< Is geometric primitive instancing supported by the program generator? */
+		PLRenderer::TextureBuffer	*m_pInstanceMap;			/**< Rectangle texture buffer with the per instance data of the current frame, one row per instance, can be a null pointer */
+		PLCore::Array<float>		 m_lstInstanceData;			/**< Per instance data to upload into the instance map (4 RGBA float texels per instance) */
+		PLCore::uint32				 m_nNumOfInstances;			/**< Number of instances within the instance map */
+		PLCore::uint32				 m_nNextInstance;			/**< Instance map row of the next batch to draw */
+
 
 	//[-------------------------------------------------------]
 	//[ Private virtual SRPDirectionalLighting functions      ]
 	//[-------------------------------------------------------]
 	private:
-		virtual void DrawMesh(PLRenderer::Renderer &cRenderer, const PLScene::SQCull &cCullQuery, const PLScene::VisNode &cVisNode, PLScene::SceneNode &cSceneNode, const PLMesh::MeshHandler &cMeshHandler, const PLMesh::Mesh &cMesh, const PLMesh::MeshLODLevel &cMeshLODLevel, PLRenderer::VertexBuffer &cVertexBuffer) override;
+		virtual const void *GetItemProgram(const PLScene::RenderQueue::Item &cItem) override;
+		virtual void DrawItem(PLRenderer::Renderer &cRenderer, const PLScene::RenderQueue::Item &cItem) override;
+		virtual PLCore::uint32 GetMaxNumOfInstances(PLRenderer::Renderer &cRenderer) const override;
+		virtual void PrepareBatches(PLRenderer::Renderer &cRenderer, const PLScene::RenderQueue &cRenderQueue) override;
+		virtual bool DrawBatch(PLRenderer::Renderer &cRenderer, const PLScene::RenderQueue &cRenderQueue, const PLScene::RenderQueue::Batch &sBatch) override;
 
 
 	//[-------------------------------------------------------]
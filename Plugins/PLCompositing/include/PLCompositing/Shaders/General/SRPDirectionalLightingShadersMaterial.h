@@ -106,7 +106,8 @@ class SRPDirectionalLightingShadersMaterial {
 			EnvironmentNormalMappingPossible	= 1<<3,	/**< Normal mapping is possible (normal & tangent & binormal data available) */
 			EnvironmentLightingEnabled			= 1<<4,	/**< Lighting enabled */
 			EnvironmentGlowEnabled				= 1<<6,	/**< Glow enabled */
-			EnvironmentDOFEnabled				= 1<<5	/**< DOF enabled */
+			EnvironmentDOFEnabled				= 1<<5,	/**< DOF enabled */
+			EnvironmentInstancing				= 1<<7	/**< Geometric primitive instancing, the per instance data is fetched from an instance map */
 		};
 
 		/**
@@ -126,6 +127,9 @@ class SRPDirectionalLightingShadersMaterial {
 			PLRenderer::ProgramUniform *pObjectSpaceToViewSpaceMatrix;
 			PLRenderer::ProgramUniform *pObjectSpaceToClipSpaceMatrix;
 			PLRenderer::ProgramUniform *pEyePos;
+			PLRenderer::ProgramUniform *pViewSpaceToClipSpaceMatrix;
+			PLRenderer::ProgramUniform *pInstanceMap;
+			PLRenderer::ProgramUniform *pInstanceOffset;
 			// Fragment shader uniforms
 			PLRenderer::ProgramUniform *pAmbientColor;
 			PLRenderer::ProgramUniform *pDiffuseColor;
@@ -203,6 +207,23 @@ class SRPDirectionalLightingShadersMaterial {
 		*/
 		GeneratedProgramUserData *MakeMaterialCurrent(PLCore::uint32 nRendererFlags, PLCore::uint32 nEnvironmentFlags, ETextureFiltering nTextureFiltering);
 
+		/**
+		*  @brief
+		*    Returns the generated program this material is using
+		*
+		*  @param[in] nRendererFlags
+		*    SRPDirectionalLightingShaders-flags to use
+		*  @param[in] nEnvironmentFlags
+		*    Environment flags to use (see EEnvironmentFlags)
+		*
+		*  @return
+		*    The generated program, a null pointer on error, do NOT delete the memory the pointer points to
+		*
+		*  @note
+		*    - Unlike "MakeMaterialCurrent()", the program is not set, this is for example used for sorting
+		*/
+		PLRenderer::ProgramGenerator::GeneratedProgram *GetGeneratedProgram(PLCore::uint32 nRendererFlags, PLCore::uint32 nEnvironmentFlags);
+
 
 	//[-------------------------------------------------------]
 	//[ Private definitions                                   ]
@@ -219,7 +240,8 @@ class SRPDirectionalLightingShadersMaterial {
 				VS_TWOSIDEDLIGHTING		= 1<<3,	/**< Two sided lighting possible? (VS_NORMAL should be defined!) */
 				VS_TANGENT_BINORMAL		= 1<<4,	/**< Use vertex tangent and binormal (VS_NORMAL should be defined!) */
 					VS_PARALLAXMAPPING	= 1<<5,	/**< Perform parallax mapping (VS_NORMAL and VS_TANGENT_BINORMAL should be defined!) */
-			VS_VIEWSPACEPOSITION		= 1<<6	/**< Calculate the view space position of the vertex (required for reflections and lighting) */
+			VS_VIEWSPACEPOSITION		= 1<<6,	/**< Calculate the view space position of the vertex (required for reflections and lighting) */
+			VS_INSTANCING				= 1<<7	/**< Geometric primitive instancing, fetch the object space to view space matrix and eye position from the instance map */
 		};
 
 		/**
@@ -302,6 +324,9 @@ class SRPDirectionalLightingShadersMaterial {
 		static const PLCore::String ObjectSpaceToViewSpaceMatrix;
 		static const PLCore::String ObjectSpaceToClipSpaceMatrix;
 		static const PLCore::String EyePos;
+		static const PLCore::String ViewSpaceToClipSpaceMatrix;
+		static const PLCore::String InstanceMap;
+		static const PLCore::String InstanceOffset;
 		static const PLCore::String AmbientColor;
 		// static const PLCore::String AlphaReference;	// Already defined
 		static const PLCore::String FresnelConstants;
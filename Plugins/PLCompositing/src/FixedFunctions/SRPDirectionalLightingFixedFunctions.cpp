@@ -93,227 +93,213 @@ SRPDirectionalLightingFixedFunctions::~SRPDirectionalLightingFixedFunctions()
 //[-------------------------------------------------------]
 //[ Private virtual SRPDirectionalLighting functions      ]
 //[-------------------------------------------------------]
-void SRPDirectionalLightingFixedFunctions::DrawMesh(Renderer &cRenderer, const SQCull &cCullQuery, const VisNode &cVisNode, SceneNode &cSceneNode, const MeshHandler &cMeshHandler, const Mesh &cMesh, const MeshLODLevel &cMeshLODLevel, VertexBuffer &cVertexBuffer)
+void SRPDirectionalLightingFixedFunctions::DrawItem(Renderer &cRenderer, const RenderQueue::Item &cItem)
 {
-	// Get the fixed functions interface (when we're in here, we know that it must exist!)
-	FixedFunctions *pFixedFunctions = cRenderer.GetFixedFunctions();
+	// Materials using an effect are not supported by this scene renderer pass
+	const Material *pMaterial = cItem.pMaterial;
+	if (!pMaterial->GetEffect()) {
+		// Get the fixed functions interface (when we're in here, we know that it must exist!)
+		FixedFunctions *pFixedFunctions = cRenderer.GetFixedFunctions();
+
+		// Set the current world matrix
+		pFixedFunctions->SetTransformState(FixedFunctions::Transform::World, cItem.pVisNode->GetWorldMatrix());
+
+		// Bind buffers
+		cRenderer.SetIndexBuffer(cItem.pIndexBuffer);
+		pFixedFunctions->SetVertexBuffer(cItem.pVertexBuffer);
+
+		// Get the opacity parameter, the render queue only contains materials matching this pass
+		static const String sOpacity = "Opacity";
+		const Parameter *pParameter = pMaterial->GetParameter(sOpacity);
+
+		// Material change?
+		if (m_pCurrentMaterial != pMaterial) {
+			// Update current material
+			m_nMaterialChanges++;
+			m_pCurrentMaterial = pMaterial;
+
+			// Get opacity
+			const float fOpacity = pParameter ? pParameter->GetValue1f() : 1.0f;
+			if (fOpacity < 1) {
+				// Get and set source blend function
+				uint32 nValue = BlendFunc::SrcAlpha;
+				static const String sSrcBlendFunc = "SrcBlendFunc";
+				pParameter = pMaterial->GetParameter(sSrcBlendFunc);
+				if (pParameter) {
+					m_pRenderStates->SetAttribute("SrcBlendFunc", pParameter->GetParameterString());
+					nValue = m_pRenderStates->Get(RenderState::SrcBlendFunc);
+				}
+				cRenderer.SetRenderState(RenderState::SrcBlendFunc, nValue);
+
+				// Get and set destination blend function
+				nValue = BlendFunc::InvSrcAlpha;
+				static const String sDstBlendFunc = "DstBlendFunc";
+				pParameter = pMaterial->GetParameter(sDstBlendFunc);
+				if (pParameter) {
+					m_pRenderStates->SetAttribute("DstBlendFunc", pParameter->GetParameterString());
+					nValue = m_pRenderStates->Get(RenderState::DstBlendFunc);
+				}
+				cRenderer.SetRenderState(RenderState::DstBlendFunc, nValue);
+			}
+
+			// Setup cull mode
+			static const String sTwoSided = "TwoSided";
+			pParameter = pMaterial->GetParameter(sTwoSided);
+			cRenderer.SetRenderState(RenderState::CullMode, (pParameter && pParameter->GetValue1f()) == 1.0f ? Cull::None : Cull::CCW);
+
+			// Setup transparency and diffuse color
+			static const String sDiffuseColor = "DiffuseColor";
+			pParameter = pMaterial->GetParameter(sDiffuseColor);
+			if (pParameter) {
+				float fDiffuseColor[3] = { 1.0f, 1.0f, 1.0f };
+				pParameter->GetValue3f(fDiffuseColor[0], fDiffuseColor[1], fDiffuseColor[2]);
+				pFixedFunctions->SetColor(Color4(fDiffuseColor[0], fDiffuseColor[1], fDiffuseColor[2], fOpacity));
+			} else {
+				pFixedFunctions->SetColor(Color4(1.0f, 1.0f, 1.0f, fOpacity));
+			}
 
-	// Set the current world matrix
-	pFixedFunctions->SetTransformState(FixedFunctions::Transform::World, cVisNode.GetWorldMatrix());
-
-	// Get buffers
-		  IndexBuffer     *pIndexBuffer  = cMeshLODLevel.GetIndexBuffer();
-	const Array<Geometry> &lstGeometries = *cMeshLODLevel.GetGeometries();
-
-	// Bind buffers
-	cRenderer.SetIndexBuffer(pIndexBuffer);
-	pFixedFunctions->SetVertexBuffer(&cVertexBuffer);
-
-	// Draw mesh
-	for (uint32 nMat=0; nMat<cMeshHandler.GetNumOfMaterials(); nMat++) {
-		// Get mesh material
-		const Material *pMaterial = cMeshHandler.GetMaterial(nMat);
-		if (pMaterial && !pMaterial->GetEffect()) {
-			// Draw geometries
-			for (uint32 nGeo=0; nGeo<lstGeometries.GetNumOfElements(); nGeo++) {
-				// Is this geometry active and is it using the current used mesh material?
-				const Geometry &cGeometry = lstGeometries[nGeo];
-				if (cGeometry.IsActive() && nMat == cGeometry.GetMaterial()) {
-					// Transparent material?
-					static const String sOpacity = "Opacity";
-					const Parameter *pParameter = pMaterial->GetParameter(sOpacity);
-					if ((GetFlags() & TransparentPass) ? (pParameter && pParameter->GetValue1f() < 1.0f) : (!pParameter || pParameter->GetValue1f() >= 1.0f)) {
-						// Material change?
-						if (m_pCurrentMaterial != pMaterial) {
-							// Update current material
-							m_nMaterialChanges++;
-							m_pCurrentMaterial = pMaterial;
-
-							// Get opacity
-							const float fOpacity = pParameter ? pParameter->GetValue1f() : 1.0f;
-							if (fOpacity < 1) {
-								// Get and set source blend function
-								uint32 nValue = BlendFunc::SrcAlpha;
-								static const String sSrcBlendFunc = "SrcBlendFunc";
-								pParameter = pMaterial->GetParameter(sSrcBlendFunc);
-								if (pParameter) {
-									m_pRenderStates->SetAttribute("SrcBlendFunc", pParameter->GetParameterString());
-									nValue = m_pRenderStates->Get(RenderState::SrcBlendFunc);
-								}
-								cRenderer.SetRenderState(RenderState::SrcBlendFunc, nValue);
-
-								// Get and set destination blend function
-								nValue = BlendFunc::InvSrcAlpha;
-								static const String sDstBlendFunc = "DstBlendFunc";
-								pParameter = pMaterial->GetParameter(sDstBlendFunc);
-								if (pParameter) {
-									m_pRenderStates->SetAttribute("DstBlendFunc", pParameter->GetParameterString());
-									nValue = m_pRenderStates->Get(RenderState::DstBlendFunc);
-								}
-								cRenderer.SetRenderState(RenderState::DstBlendFunc, nValue);
-							}
-
-							// Setup cull mode
-							static const String sTwoSided = "TwoSided";
-							pParameter = pMaterial->GetParameter(sTwoSided);
-							cRenderer.SetRenderState(RenderState::CullMode, (pParameter && pParameter->GetValue1f()) == 1.0f ? Cull::None : Cull::CCW);
-
-							// Setup transparency and diffuse color
-							static const String sDiffuseColor = "DiffuseColor";
-							pParameter = pMaterial->GetParameter(sDiffuseColor);
-							if (pParameter) {
-								float fDiffuseColor[3] = { 1.0f, 1.0f, 1.0f };
-								pParameter->GetValue3f(fDiffuseColor[0], fDiffuseColor[1], fDiffuseColor[2]);
-								pFixedFunctions->SetColor(Color4(fDiffuseColor[0], fDiffuseColor[1], fDiffuseColor[2], fOpacity));
-							} else {
-								pFixedFunctions->SetColor(Color4(1.0f, 1.0f, 1.0f, fOpacity));
-							}
-
-							// Specular highlight
-							if (GetFlags() & NoSpecular) {
-								pFixedFunctions->SetMaterialState(FixedFunctions::MaterialState::Specular,  Color4::Black.ToUInt32());
-								pFixedFunctions->SetMaterialState(FixedFunctions::MaterialState::Shininess, 0);
-							} else {
-								static const String sSpecularColor    = "SpecularColor";
-								static const String sSpecularExponent = "SpecularExponent";
-								float  fSpecularExponent = 45.0f;
-								Color4 cSpecularColor    = Color4::White;
-
-								// First, get specular color - if it's 0, we don't have any specular at all
-								pParameter = pMaterial->GetParameter(sSpecularColor);
-								if (pParameter)
-									cSpecularColor = pParameter->GetValue3fv();
-								if (cSpecularColor != 0.0f) {
-									// Get specular exponent
-									pParameter = pMaterial->GetParameter(sSpecularExponent);
-									if (pParameter)
-										pParameter->GetValue1f(fSpecularExponent);
-								}
-
-								// Set material states
-								pFixedFunctions->SetMaterialState(FixedFunctions::MaterialState::Specular,  cSpecularColor.ToUInt32());
-								pFixedFunctions->SetMaterialState(FixedFunctions::MaterialState::Shininess, Tools::FloatToUInt32(fSpecularExponent));
-							}
-
-							// Bind textures
-							// Diffuse map (stage 0)
-							const Texture *pTexture = nullptr;
-							if (GetFlags() & NoDiffuseMap)
-								cRenderer.SetTextureBuffer(0, nullptr);
-							else {
-								pParameter = pMaterial->GetParameter(Material::DiffuseMap);
-								if (pParameter)
-									pTexture = pParameter->GetValueTexture();
-								if (pTexture && pTexture->GetTextureBuffer()) {
-									pTexture->Bind(0);
-									SetupTextureFiltering(cRenderer, 0);
-
-									// Enable/disable alpha test - but only if this material is not transparent, else the result may look odd
-									if (pTexture->GetTextureBuffer()->GetComponentsPerPixel() == 4 && fOpacity >= 1) {
-										// Get alpha reference
-										static const String sAlphaReference = "AlphaReference";
-										pParameter = pMaterial->GetParameter(sAlphaReference);
-										float fAlphaReference = pParameter ? pParameter->GetValue1f() : 0.5f;
-
-										// Set alpha render states
-										if (fAlphaReference) {
-											pFixedFunctions->SetRenderState(FixedFunctions::RenderState::AlphaTestEnable,    true);
-											pFixedFunctions->SetRenderState(FixedFunctions::RenderState::AlphaTestReference, Tools::FloatToUInt32(fAlphaReference));
-										} else {
-											pFixedFunctions->SetRenderState(FixedFunctions::RenderState::AlphaTestEnable, false);
-										}
-									} else {
-										pFixedFunctions->SetRenderState(FixedFunctions::RenderState::AlphaTestEnable, false);
-									}
-								} else {
-									cRenderer.SetTextureBuffer(0, nullptr);
-
-									// Disable alpha test
-									pFixedFunctions->SetRenderState(FixedFunctions::RenderState::AlphaTestEnable, false);
-								}
-							}
-
-							// Light map (stage 1)
-							bool bLightMapUsed = false;
-							if (GetFlags() & NoLightMap)
-								cRenderer.SetTextureBuffer(1, nullptr);
-							else {
-								pTexture = nullptr;
-								pParameter = pMaterial->GetParameter(Material::LightMap);
-								if (pParameter)
-									pTexture = pParameter->GetValueTexture();
-								if (pTexture) {
-									pTexture->Bind(1);
-									SetupTextureFiltering(cRenderer, 1);
-									bLightMapUsed = true;
-								} else {
-									cRenderer.SetTextureBuffer(1, nullptr);
-								}
-							}
-
-							// Ambient occlusion map (stage 1)
-							if (!bLightMapUsed) {
-								if (GetFlags() & NoAmbientOcclusionMap)
-									cRenderer.SetTextureBuffer(1, nullptr);
-								else {
-									pTexture = nullptr;
-									pParameter = pMaterial->GetParameter(Material::AmbientOcclusionMap);
-									if (pParameter)
-										pTexture = pParameter->GetValueTexture();
-									if (pTexture) {
-										pTexture->Bind(1);
-										SetupTextureFiltering(cRenderer, 1);
-									} else {
-										cRenderer.SetTextureBuffer(1, nullptr);
-									}
-								}
-							}
-
-							// Reflection map (stage 2)
-							if (GetFlags() & NoReflectionMap)
-								cRenderer.SetTextureBuffer(2, nullptr);
-							else {
-								pTexture = nullptr;
-								pParameter = pMaterial->GetParameter(Material::ReflectionMap);
-								if (pParameter)
-									pTexture = pParameter->GetValueTexture();
-								if (pTexture) {
-									pTexture->Bind(2);
-									SetupTextureFiltering(cRenderer, 2);
-
-									// 2D or cube ?
-									const TextureBuffer *pTextureBuffer = pTexture->GetTextureBuffer();
-									if (pTextureBuffer) {
-										if (pTextureBuffer->GetType() == TextureBuffer::TypeTextureBufferCube) {
-											pFixedFunctions->SetTextureStageState(2, FixedFunctions::TextureStage::TexGen, FixedFunctions::TexCoordGen::ReflectionMap);
-											cRenderer.SetSamplerState(2, Sampler::AddressU, TextureAddressing::Clamp);
-											cRenderer.SetSamplerState(2, Sampler::AddressV, TextureAddressing::Clamp);
-											cRenderer.SetSamplerState(2, Sampler::AddressW, TextureAddressing::Clamp);
-										} else if (pTextureBuffer->GetType() == TextureBuffer::TypeTextureBuffer2D) {
-											pFixedFunctions->SetTextureStageState(2, FixedFunctions::TextureStage::TexGen, FixedFunctions::TexCoordGen::SphereMap);
-											cRenderer.SetSamplerState(2, Sampler::AddressU, TextureAddressing::Wrap);
-											cRenderer.SetSamplerState(2, Sampler::AddressV, TextureAddressing::Wrap);
-											cRenderer.SetSamplerState(2, Sampler::AddressW, TextureAddressing::Wrap);
-										}
-									}
-								} else {
-									cRenderer.SetTextureBuffer(2, nullptr);
-								}
-							}
+			// Specular highlight
+			if (GetFlags() & NoSpecular) {
+				pFixedFunctions->SetMaterialState(FixedFunctions::MaterialState::Specular,  Color4::Black.ToUInt32());
+				pFixedFunctions->SetMaterialState(FixedFunctions::MaterialState::Shininess, 0);
+			} else {
+				static const String sSpecularColor    = "SpecularColor";
+				static const String sSpecularExponent = "SpecularExponent";
+				float  fSpecularExponent = 45.0f;
+				Color4 cSpecularColor    = Color4::White;
+
+				// First, get specular color - if it's 0, we don't have any specular at all
+				pParameter = pMaterial->GetParameter(sSpecularColor);
+				if (pParameter)
+					cSpecularColor = pParameter->GetValue3fv();
+				if (cSpecularColor != 0.0f) {
+					// Get specular exponent
+					pParameter = pMaterial->GetParameter(sSpecularExponent);
+					if (pParameter)
+						pParameter->GetValue1f(fSpecularExponent);
+				}
+
+				// Set material states
+				pFixedFunctions->SetMaterialState(FixedFunctions::MaterialState::Specular,  cSpecularColor.ToUInt32());
+				pFixedFunctions->SetMaterialState(FixedFunctions::MaterialState::Shininess, Tools::FloatToUInt32(fSpecularExponent));
+			}
+
+			// Bind textures
+			// Diffuse map (stage 0)
+			const Texture *pTexture = nullptr;
+			if (GetFlags() & NoDiffuseMap)
+				cRenderer.SetTextureBuffer(0, nullptr);
+			else {
+				pParameter = pMaterial->GetParameter(Material::DiffuseMap);
+				if (pParameter)
+					pTexture = pParameter->GetValueTexture();
+				if (pTexture && pTexture->GetTextureBuffer()) {
+					pTexture->Bind(0);
+					SetupTextureFiltering(cRenderer, 0);
+
+					// Enable/disable alpha test - but only if this material is not transparent, else the result may look odd
+					if (pTexture->GetTextureBuffer()->GetComponentsPerPixel() == 4 && fOpacity >= 1) {
+						// Get alpha reference
+						static const String sAlphaReference = "AlphaReference";
+						pParameter = pMaterial->GetParameter(sAlphaReference);
+						float fAlphaReference = pParameter ? pParameter->GetValue1f() : 0.5f;
+
+						// Set alpha render states
+						if (fAlphaReference) {
+							pFixedFunctions->SetRenderState(FixedFunctions::RenderState::AlphaTestEnable,    true);
+							pFixedFunctions->SetRenderState(FixedFunctions::RenderState::AlphaTestReference, Tools::FloatToUInt32(fAlphaReference));
+						} else {
+							pFixedFunctions->SetRenderState(FixedFunctions::RenderState::AlphaTestEnable, false);
 						}
+					} else {
+						pFixedFunctions->SetRenderState(FixedFunctions::RenderState::AlphaTestEnable, false);
+					}
+				} else {
+					cRenderer.SetTextureBuffer(0, nullptr);
 
-						// Draw geometry
-						cRenderer.DrawIndexedPrimitives(
-							cGeometry.GetPrimitiveType(),
-							0,
-							cVertexBuffer.GetNumOfElements()-1,
-							cGeometry.GetStartIndex(),
-							cGeometry.GetIndexSize()
-						);
+					// Disable alpha test
+					pFixedFunctions->SetRenderState(FixedFunctions::RenderState::AlphaTestEnable, false);
+				}
+			}
+
+			// Light map (stage 1)
+			bool bLightMapUsed = false;
+			if (GetFlags() & NoLightMap)
+				cRenderer.SetTextureBuffer(1, nullptr);
+			else {
+				pTexture = nullptr;
+				pParameter = pMaterial->GetParameter(Material::LightMap);
+				if (pParameter)
+					pTexture = pParameter->GetValueTexture();
+				if (pTexture) {
+					pTexture->Bind(1);
+					SetupTextureFiltering(cRenderer, 1);
+					bLightMapUsed = true;
+				} else {
+					cRenderer.SetTextureBuffer(1, nullptr);
+				}
+			}
+
+			// Ambient occlusion map (stage 1)
+			if (!bLightMapUsed) {
+				if (GetFlags() & NoAmbientOcclusionMap)
+					cRenderer.SetTextureBuffer(1, nullptr);
+				else {
+					pTexture = nullptr;
+					pParameter = pMaterial->GetParameter(Material::AmbientOcclusionMap);
+					if (pParameter)
+						pTexture = pParameter->GetValueTexture();
+					if (pTexture) {
+						pTexture->Bind(1);
+						SetupTextureFiltering(cRenderer, 1);
+					} else {
+						cRenderer.SetTextureBuffer(1, nullptr);
 					}
 				}
 			}
+
+			// Reflection map (stage 2)
+			if (GetFlags() & NoReflectionMap)
+				cRenderer.SetTextureBuffer(2, nullptr);
+			else {
+				pTexture = nullptr;
+				pParameter = pMaterial->GetParameter(Material::ReflectionMap);
+				if (pParameter)
+					pTexture = pParameter->GetValueTexture();
+				if (pTexture) {
+					pTexture->Bind(2);
+					SetupTextureFiltering(cRenderer, 2);
+
+					// 2D or cube ?
+					const TextureBuffer *pTextureBuffer = pTexture->GetTextureBuffer();
+					if (pTextureBuffer) {
+						if (pTextureBuffer->GetType() == TextureBuffer::TypeTextureBufferCube) {
+							pFixedFunctions->SetTextureStageState(2, FixedFunctions::TextureStage::TexGen, FixedFunctions::TexCoordGen::ReflectionMap);
+							cRenderer.SetSamplerState(2, Sampler::AddressU, TextureAddressing::Clamp);
+							cRenderer.SetSamplerState(2, Sampler::AddressV, TextureAddressing::Clamp);
+							cRenderer.SetSamplerState(2, Sampler::AddressW, TextureAddressing::Clamp);
+						} else if (pTextureBuffer->GetType() == TextureBuffer::TypeTextureBuffer2D) {
+							pFixedFunctions->SetTextureStageState(2, FixedFunctions::TextureStage::TexGen, FixedFunctions::TexCoordGen::SphereMap);
+							cRenderer.SetSamplerState(2, Sampler::AddressU, TextureAddressing::Wrap);
+							cRenderer.SetSamplerState(2, Sampler::AddressV, TextureAddressing::Wrap);
+							cRenderer.SetSamplerState(2, Sampler::AddressW, TextureAddressing::Wrap);
+						}
+					}
+				} else {
+					cRenderer.SetTextureBuffer(2, nullptr);
+				}
+			}
 		}
+
+		// Draw geometry
+		const Geometry &cGeometry = *cItem.pGeometry;
+		cRenderer.DrawIndexedPrimitives(
+			cGeometry.GetPrimitiveType(),
+			0,
+			cItem.pVertexBuffer->GetNumOfElements()-1,
+			cGeometry.GetStartIndex(),
+			cGeometry.GetIndexSize()
+		);
 	}
 }
 
@@ -368,8 +354,8 @@ void SRPDirectionalLightingFixedFunctions::Draw(Renderer &cRenderer, const SQCul
 		m_nMaterialChanges = 0;
 		m_pCurrentMaterial = nullptr;
 
-		// Draw recursive from back to front
-		DrawRec(cRenderer, cCullQuery);
+		// Draw the visible mesh geometries
+		DrawRenderQueue(cRenderer, cCullQuery);
 	}
 }
 
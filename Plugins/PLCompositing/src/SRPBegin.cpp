@@ -26,10 +26,14 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include <PLMath/Rectangle.h>
+#include <PLRenderer/RendererContext.h>
 #include <PLRenderer/Renderer/Renderer.h>
 #include <PLRenderer/Renderer/DrawHelpers.h>
 #include <PLRenderer/Renderer/FixedFunctions.h>
+#include <PLRenderer/Texture/TextureManager.h>
 #include <PLScene/Scene/SNCamera.h>
+#include <PLScene/Visibility/SQCull.h>
+#include <PLScene/Visibility/VisContainer.h>
 #include "PLCompositing/SRPBegin.h"
 
 
@@ -292,6 +296,10 @@ void SRPBegin::Draw(Renderer &cRenderer, const SQCull &cCullQuery)
 			nFlags |= Clear::Stencil;
 		cRenderer.Clear(nFlags, ColorClear.Get());
 	}
+
+	// Report the texture usage of all visible scene nodes so the texture manager knows which mipmaps to stream
+	if (cRenderer.GetRendererContext().GetTextureManager().GetStreamingBudget())
+		cCullQuery.GetVisContainer().ReportTextureUsage(cRenderer.GetViewport().GetHeight());
 }
 
 
@@ -27,6 +27,7 @@
 //[-------------------------------------------------------]
 #include <PLCore/Tools/Tools.h>
 #include <PLRenderer/RendererContext.h>
+#include <PLRenderer/Renderer/DrawHelpers.h>
 #include <PLRenderer/Effect/EffectManager.h>
 #include <PLScene/Scene/SceneContainer.h>
 #include <PLScene/Scene/SceneHierarchy.h>
@@ -150,8 +151,10 @@ void SRPDebugHierarchies::Draw(Renderer &cRenderer, const SQCull &cCullQuery)
 	cRenderer.SetRenderState(RenderState::BlendEnable,		 (LineColor.Get().a < 1.0f));
 	cRenderer.SetRenderState(RenderState::ScissorTestEnable, true);
 
-	// Draw recursive from back to front
+	// Draw recursive from back to front, batch all hierarchy lines
+	cRenderer.GetDrawHelpers().BeginBatch();
 	DrawRec(cRenderer, cCullQuery);
+	cRenderer.GetDrawHelpers().EndBatch();
 }
 
 
@@ -193,7 +193,9 @@ void SRPDebugSceneNodeIcons::Draw(Renderer &cRenderer, const SQCull &cCullQuery)
 	// Draw recursive from back to front
 	const uint32 nFixedFillModeBackup = cRenderer.GetRenderState(RenderState::FixedFillMode);
 	cRenderer.SetRenderState(RenderState::FixedFillMode, Fill::Solid);
+	cRenderer.GetDrawHelpers().BeginBatch();	// Batch all icons, not only the ones of a single 2D mode
 	DrawRec(cRenderer, cCullQuery);
+	cRenderer.GetDrawHelpers().EndBatch();
 	cRenderer.SetRenderState(RenderState::FixedFillMode, nFixedFillModeBackup);
 }
 
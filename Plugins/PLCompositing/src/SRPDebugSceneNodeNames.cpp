@@ -178,8 +178,10 @@ void SRPDebugSceneNodeNames::Draw(Renderer &cRenderer, const SQCull &cCullQuery)
 		// We do not use scissor rectangles because we need to see the COMPLETE names :)
 		cRenderer.SetScissorRect();
 
-		// Draw recursive from front to back
+		// Draw recursive from front to back, batch all names
+		cRenderer.GetDrawHelpers().BeginBatch();
 		DrawRec(*pFont, cCullQuery);
+		cRenderer.GetDrawHelpers().EndBatch();
 	}
 }
 
@@ -25,8 +25,11 @@
 //[-------------------------------------------------------]
 //[ Includes                                              ]
 //[-------------------------------------------------------]
+#include <PLCore/Core/MemoryManager.h>
 #include <PLRenderer/Renderer/Renderer.h>
 #include <PLRenderer/Renderer/VertexBuffer.h>
+#include <PLRenderer/Material/Material.h>
+#include <PLRenderer/Material/Parameter.h>
 #include <PLMesh/Mesh.h>
 #include <PLMesh/MeshHandler.h>
 #include <PLMesh/MeshLODLevel.h>
@@ -41,6 +44,7 @@
 //[ Namespace                                             ]
 //[-------------------------------------------------------]
 using namespace PLCore;
+using namespace PLMath;
 using namespace PLRenderer;
 using namespace PLMesh;
 using namespace PLScene;
@@ -55,11 +59,26 @@ pl_class_metadata(SRPDirectionalLighting, "PLCompositing", PLScene::SceneRendere
 	pl_attribute_metadata(AmbientColor,			PLGraphics::Color3,												PLGraphics::Color3::White,				ReadWrite,	"Ambient color",				"")
 	pl_attribute_metadata(LightingIntensity,	float,															1.0f,									ReadWrite,	"General lighting intensity",	"")
 	pl_attribute_metadata(TextureFiltering,		pl_enum_type_def3(SRPDirectionalLighting, ETextureFiltering),	SRPDirectionalLighting::Anisotropic8,	ReadWrite,	"Texture filtering",			"")
+	pl_attribute_metadata(SortRenderQueue,		bool,															true,									ReadWrite,	"Sort the visible mesh geometries by program, material and depth to reduce state changes, if disabled they are drawn in visibility order",	"")
+	pl_attribute_metadata(Instancing,			bool,															true,									ReadWrite,	"Draw visible mesh geometries sharing mesh, LOD and material by using one instanced draw call (if supported)",	"")
 		// Overwritten PLScene::SceneRendererPass attributes
 	pl_attribute_metadata(Flags,				pl_flag_type_def3(SRPDirectionalLighting, EFlags),				0,										ReadWrite,	"Flags",						"")
 pl_class_metadata_end(SRPDirectionalLighting)
 
 
+//[-------------------------------------------------------]
+//[ Public functions                                      ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Returns the statistics of the last drawn frame
+*/
+const SRPDirectionalLighting::Statistics &SRPDirectionalLighting::GetStatistics() const
+{
+	return m_sStatistics;
+}
+
+
 //[-------------------------------------------------------]
 //[ Protected functions                                   ]
 //[-------------------------------------------------------]
@@ -71,8 +90,12 @@ SRPDirectionalLighting::SRPDirectionalLighting() :
 	AmbientColor(this),
 	LightingIntensity(this),
 	TextureFiltering(this),
+	SortRenderQueue(this),
+	Instancing(this),
 	Flags(this)
 {
+	// Init statistics
+	MemoryManager::Set(&m_sStatistics, 0, sizeof(Statistics));
 }
 
 /**
@@ -112,72 +135,63 @@ void SRPDirectionalLighting::SetupTextureFiltering(Renderer &cRenderer, uint32 n
 
 /**
 *  @brief
-*    Draws recursive
+*    Fills the render queue with all visible mesh geometries and draws them
 */
-void SRPDirectionalLighting::DrawRec(Renderer &cRenderer, const SQCull &cCullQuery)
+void SRPDirectionalLighting::DrawRenderQueue(Renderer &cRenderer, const SQCull &cCullQuery)
 {
-	// Set cull mode
-	cRenderer.SetRenderState(RenderState::CullMode, Cull::CCW);
+	// Collect the visible mesh geometries
+	m_cRenderQueue.Clear();
+	FillRenderQueueRec(cCullQuery);
 
-	// Get scene container
-	const VisContainer &cVisContainer = cCullQuery.GetVisContainer();
+	// Sort them by program, material and depth
+	if (SortRenderQueue)
+		m_cRenderQueue.Sort();
 
-	// Set the new scissor rectangle
-	cRenderer.SetScissorRect(&cVisContainer.GetProjection().cRectangle);
+	// Group them into batches, instancing is only used for sorted solid geometry
+	const bool bTransparentPass = (GetFlags() & TransparentPass) != 0;
+	m_cRenderQueue.BuildBatches((Instancing && SortRenderQueue && !bTransparentPass) ? GetMaxNumOfInstances(cRenderer) : 1);
+	PrepareBatches(cRenderer, m_cRenderQueue);
 
-	// Render all visible scene nodes of this scene container
-	Iterator<VisNode*> cIterator = (GetFlags() & TransparentPass) ? cVisContainer.GetVisNodes().GetEndIterator() : cVisContainer.GetVisNodes().GetIterator();
-	while ((GetFlags() & TransparentPass) ? cIterator.HasPrevious() : cIterator.HasNext()) {
-		// Get visibility node and scene node
-		const VisNode   *pVisNode   = (GetFlags() & TransparentPass) ? cIterator.Previous() : cIterator.Next();
-			  SceneNode *pSceneNode = pVisNode->GetSceneNode();
-		if (pSceneNode) {
-			// Is this scene node a portal?
-			if (pVisNode->IsPortal()) {
-				// Get the target cell visibility container
-				const VisContainer *pVisCell = static_cast<const VisPortal*>(pVisNode)->GetTargetVisContainer();
-				if (pVisCell && pVisCell->GetCullQuery()) {
-					// Draw the target cell
-					DrawRec(cRenderer, *pVisCell->GetCullQuery());
+	// Set cull mode
+	cRenderer.SetRenderState(RenderState::CullMode, Cull::CCW);
 
-					// Set the previous scissor rectangle
-					cRenderer.SetScissorRect(&cVisContainer.GetProjection().cRectangle);
-				}
+	// Init statistics
+	MemoryManager::Set(&m_sStatistics, 0, sizeof(Statistics));
+	m_sStatistics.nNumOfItems   = m_cRenderQueue.GetNumOfItems();
+	m_sStatistics.nNumOfBatches = m_cRenderQueue.GetNumOfBatches();
+	const uint32 nNumOfDrawCalls = cRenderer.GetStatistics().nDrawPrimitivCalls;
 
-			// Is this scene node a container? We do not need to check for cells because we will
-			// NEVER receive cells from SQCull directly, they are ONLY visible through portals! (see above)
-			} else if (pVisNode->IsContainer()) {
-				// Draw this container without special processing
-				if (static_cast<const VisContainer*>(pVisNode)->GetCullQuery()) {
-					DrawRec(cRenderer, *static_cast<const VisContainer*>(pVisNode)->GetCullQuery());
+	// Draw all batches, unsorted transparent geometry is drawn in reverse visibility order
+	const bool   bReverse      = !SortRenderQueue && bTransparentPass;
+	const uint32 nNumOfBatches = m_cRenderQueue.GetNumOfBatches();
+	const SQCull *pCullQuery   = nullptr;
+	for (uint32 i=0; i<nNumOfBatches; i++) {
+		const RenderQueue::Batch &sBatch = m_cRenderQueue.GetBatch(bReverse ? nNumOfBatches - 1 - i : i);
+		const RenderQueue::Item  &cItem  = m_cRenderQueue.GetItem(sBatch.nFirstItem);
 
-					// Set the previous scissor rectangle
-					cRenderer.SetScissorRect(&cVisContainer.GetProjection().cRectangle);
-				}
+		// Set the scissor rectangle of the scene container the scene nodes are in (all items of a batch share the cull query)
+		if (pCullQuery != cItem.pCullQuery) {
+			pCullQuery = cItem.pCullQuery;
+			cRenderer.SetScissorRect(&pCullQuery->GetVisContainer().GetProjection().cRectangle);
+		}
 
-			// This must just be a quite boring scene node :)
-			} else {
-				// Here we draw the stuff by hand in order to minimize state changes and other overhead
-				const MeshHandler *pMeshHandler = pSceneNode->GetMeshHandler();
-				if (pMeshHandler && pMeshHandler->GetVertexBuffer() && pMeshHandler->GetNumOfMaterials()) {
-					// Get the used mesh
-					const Mesh *pMesh = pMeshHandler->GetResource();
-					if (pMesh) {
-						// Get the mesh LOD level to use
-						const MeshLODLevel *pLODLevel = pMesh->GetLODLevel(0);
-						if (pLODLevel && pLODLevel->GetIndexBuffer()) {
-							// Get the vertex buffer which needs at least a position attribute
-							VertexBuffer *pVertexBuffer = pMeshHandler->GetVertexBuffer();
-							if (pVertexBuffer && pVertexBuffer->GetVertexAttribute(VertexBuffer::Position)) {
-								// Draw the mesh
-								DrawMesh(cRenderer, cCullQuery, *pVisNode, *pSceneNode, *pMeshHandler, *pMesh, *pLODLevel, *pVertexBuffer);
-							}
-						}
-					}
-				}
+		// Draw the batch
+		if (sBatch.nNumOfItems > 1) {
+			if (DrawBatch(cRenderer, m_cRenderQueue, sBatch)) {
+				m_sStatistics.nNumOfInstancedBatches++;
+				m_sStatistics.nNumOfInstancedItems += sBatch.nNumOfItems;
 			}
+		} else {
+			DrawItem(cRenderer, cItem);
 		}
 	}
+	m_sStatistics.nNumOfDrawCalls = cRenderer.GetStatistics().nDrawPrimitivCalls - nNumOfDrawCalls;
+
+	// Set the scissor rectangle of the given scene container
+	cRenderer.SetScissorRect(&cCullQuery.GetVisContainer().GetProjection().cRectangle);
+
+	// The items are only valid while drawing
+	m_cRenderQueue.Clear();
 }
 
 /**
@@ -191,6 +205,53 @@ const VisNode *SRPDirectionalLighting::GetFirstDirectionalLight(const SQCull &cC
 }
 
 
+//[-------------------------------------------------------]
+//[ Protected virtual SRPDirectionalLighting functions    ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Returns the program a render queue item will be drawn with
+*/
+const void *SRPDirectionalLighting::GetItemProgram(const RenderQueue::Item &cItem)
+{
+	// No programs by default
+	return nullptr;
+}
+
+/**
+*  @brief
+*    Returns the maximum number of render queue items which can be drawn by using one instanced draw call
+*/
+uint32 SRPDirectionalLighting::GetMaxNumOfInstances(Renderer &cRenderer) const
+{
+	// No instancing by default
+	return 1;
+}
+
+/**
+*  @brief
+*    Called after the render queue was sorted and batched, before the batches are drawn
+*/
+void SRPDirectionalLighting::PrepareBatches(Renderer &cRenderer, const RenderQueue &cRenderQueue)
+{
+	// Nothing to do by default
+}
+
+/**
+*  @brief
+*    Draws a render queue batch with more than one item
+*/
+bool SRPDirectionalLighting::DrawBatch(Renderer &cRenderer, const RenderQueue &cRenderQueue, const RenderQueue::Batch &sBatch)
+{
+	// Draw the items one after another
+	for (uint32 i=0; i<sBatch.nNumOfItems; i++)
+		DrawItem(cRenderer, cRenderQueue.GetItem(sBatch.nFirstItem + i));
+
+	// No instancing used
+	return false;
+}
+
+
 //[-------------------------------------------------------]
 //[ Private functions                                     ]
 //[-------------------------------------------------------]
@@ -244,6 +305,99 @@ const VisNode *SRPDirectionalLighting::GetFirstDirectionalLightRec(const SQCull
 	return nullptr;
 }
 
+/**
+*  @brief
+*    Fills the render queue, recursive part
+*/
+void SRPDirectionalLighting::FillRenderQueueRec(const SQCull &cCullQuery)
+{
+	// Get scene container
+	const VisContainer &cVisContainer = cCullQuery.GetVisContainer();
+
+	// Is this a transparent renderer pass?
+	const bool bTransparentPass = (GetFlags() & TransparentPass) != 0;
+
+	// Collect the geometries of all visible scene nodes of this scene container
+	Iterator<VisNode*> cIterator = cVisContainer.GetVisNodes().GetIterator();
+	while (cIterator.HasNext()) {
+		// Get visibility node and scene node
+		const VisNode   *pVisNode   = cIterator.Next();
+			  SceneNode *pSceneNode = pVisNode->GetSceneNode();
+		if (pSceneNode) {
+			// Is this scene node a portal?
+			if (pVisNode->IsPortal()) {
+				// Get the target cell visibility container
+				const VisContainer *pVisCell = static_cast<const VisPortal*>(pVisNode)->GetTargetVisContainer();
+				if (pVisCell && pVisCell->GetCullQuery())
+					FillRenderQueueRec(*pVisCell->GetCullQuery());
+
+			// Is this scene node a container? We do not need to check for cells because we will
+			// NEVER receive cells from SQCull directly, they are ONLY visible through portals! (see above)
+			} else if (pVisNode->IsContainer()) {
+				// Collect this container without special processing
+				if (static_cast<const VisContainer*>(pVisNode)->GetCullQuery())
+					FillRenderQueueRec(*static_cast<const VisContainer*>(pVisNode)->GetCullQuery());
+
+			// This must just be a quite boring scene node :)
+			} else {
+				const MeshHandler *pMeshHandler = pSceneNode->GetMeshHandler();
+				if (pMeshHandler && pMeshHandler->GetVertexBuffer() && pMeshHandler->GetNumOfMaterials()) {
+					// Get the used mesh
+					const Mesh *pMesh = pMeshHandler->GetResource();
+					if (pMesh) {
+						// Get the mesh LOD level to use
+						const MeshLODLevel *pLODLevel = pMesh->GetLODLevel(0);
+						if (pLODLevel && pLODLevel->GetIndexBuffer()) {
+							// Get the vertex buffer which needs at least a position attribute
+							VertexBuffer *pVertexBuffer = pMeshHandler->GetVertexBuffer();
+							if (pVertexBuffer && pVertexBuffer->GetVertexAttribute(VertexBuffer::Position)) {
+								// The squared distance between the camera and the scene node is used as depth
+								const Matrix4x4 &mWorldView = pVisNode->GetWorldViewMatrix();
+								const float fDepth = Vector3(mWorldView.xw, mWorldView.yw, mWorldView.zw).GetSquaredLength();
+
+								// Add all active geometries using a material matching this pass
+								const Array<Geometry> &lstGeometries = *pLODLevel->GetGeometries();
+								for (uint32 nGeo=0; nGeo<lstGeometries.GetNumOfElements(); nGeo++) {
+									const Geometry &cGeometry = lstGeometries[nGeo];
+									if (cGeometry.IsActive()) {
+										// Get the material the geometry is using
+										Material *pMaterial = pMeshHandler->GetMaterial(cGeometry.GetMaterial());
+										if (pMaterial) {
+											// Transparent material?
+											static const String sOpacity = "Opacity";
+											const Parameter *pParameter = pMaterial->GetParameter(sOpacity);
+											if (bTransparentPass ? (pParameter && pParameter->GetValue1f() < 1.0f) : (!pParameter || pParameter->GetValue1f() >= 1.0f)) {
+												// Fill the item
+												RenderQueue::Item sItem;
+												sItem.nSortKey		= 0;
+												sItem.pCullQuery	= &cCullQuery;
+												sItem.pVisNode		= pVisNode;
+												sItem.pMaterial		= pMaterial;
+												sItem.pVertexBuffer	= pVertexBuffer;
+												sItem.pIndexBuffer	= pLODLevel->GetIndexBuffer();
+												sItem.pGeometry		= &cGeometry;
+
+												// Transparent geometry is sorted back to front, everything else by states
+												const uint32 nLayer      = bTransparentPass ? 1 : 0;
+												const uint32 nProgramID  = m_cRenderQueue.GetProgramID(GetItemProgram(sItem));
+												const uint32 nMaterialID = m_cRenderQueue.GetMaterialID(pMaterial);
+												sItem.nSortKey = RenderQueue::GetSortKey(nLayer, nProgramID, nMaterialID, fDepth, bTransparentPass);
+
+												// Add the item
+												m_cRenderQueue.Add(sItem);
+											}
+										}
+									}
+								}
+							}
+						}
+					}
+				}
+			}
+		}
+	}
+}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
@@ -26,8 +26,10 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include <PLMath/Matrix3x3.h>
+#include <PLGraphics/Image/Image.h>
 #include <PLRenderer/RendererContext.h>
 #include <PLRenderer/Renderer/VertexBuffer.h>
+#include <PLRenderer/Renderer/TextureBuffer.h>
 #include <PLRenderer/Renderer/RenderStates.h>
 #include <PLRenderer/Renderer/Shader.h>
 #include <PLRenderer/Renderer/Program.h>
@@ -89,7 +91,14 @@ SRPDirectionalLightingShaders::SRPDirectionalLightingShaders() :
 	m_fDOFFarBlurDepth(0.0f),
 	m_fDOFBlurrinessCutoff(0.0f),
 	m_pProgramGenerator(nullptr),
-	m_pRenderStates(new RenderStates())
+	m_pRenderStates(new RenderStates()),
+	m_pCurrentMaterial(nullptr),
+	m_nCurrentEnvironmentFlags(0),
+	m_pCurrentGeneratedProgramUserData(nullptr),
+	m_bInstancingSupported(false),
+	m_pInstanceMap(nullptr),
+	m_nNumOfInstances(0),
+	m_nNextInstance(0)
 {
 }
 
@@ -112,6 +121,10 @@ SRPDirectionalLightingShaders::~SRPDirectionalLightingShaders()
 	// Destroy the program generator
 	if (m_pProgramGenerator)
 		delete m_pProgramGenerator;
+
+	// Destroy the instance map
+	if (m_pInstanceMap)
+		delete m_pInstanceMap;
 }
 
 /**
@@ -139,26 +152,34 @@ void SRPDirectionalLightingShaders::OnMaterialRemoved(Material &cMaterial)
 	if (pSRPDirectionalLightingShadersMaterial) {
 		// Remove the material from the cache
 		m_lstMaterialCache.Remove(nMaterialID);
+		if (m_pCurrentMaterial == pSRPDirectionalLightingShadersMaterial)
+			m_pCurrentMaterial = nullptr;
 		delete pSRPDirectionalLightingShadersMaterial;
 	}
 }
 
-
-//[-------------------------------------------------------]
-//[ Private virtual SRPDirectionalLighting functions      ]
-//[-------------------------------------------------------]
-void SRPDirectionalLightingShaders::DrawMesh(Renderer &cRenderer, const SQCull &cCullQuery, const VisNode &cVisNode, SceneNode &cSceneNode, const MeshHandler &cMeshHandler, const Mesh &cMesh, const MeshLODLevel &cMeshLODLevel, VertexBuffer &cVertexBuffer)
+/**
+*  @brief
+*    Returns the SRPDirectionalLightingShaders-material of a material
+*/
+SRPDirectionalLightingShadersMaterial &SRPDirectionalLightingShaders::GetSRPDirectionalLightingShadersMaterial(Material &cMaterial)
 {
-	// Get scene container
-	const VisContainer &cVisContainer = cCullQuery.GetVisContainer();
-
-	// Get buffers
-		  IndexBuffer     *pIndexBuffer  = cMeshLODLevel.GetIndexBuffer();
-	const Array<Geometry> &lstGeometries = *cMeshLODLevel.GetGeometries();
-
-	// Bind buffers
-	cRenderer.SetIndexBuffer(pIndexBuffer);
+	// SRPDirectionalLightingShaders-material caching
+	SRPDirectionalLightingShadersMaterial *pSRPDirectionalLightingShadersMaterial = m_lstMaterialCache.Get(reinterpret_cast<uint64>(&cMaterial));
+	if (!pSRPDirectionalLightingShadersMaterial) {
+		// The material is not yet cached
+		pSRPDirectionalLightingShadersMaterial = new SRPDirectionalLightingShadersMaterial(*m_pRenderStates, cMaterial, *m_pProgramGenerator);
+		m_lstMaterialCache.Add(reinterpret_cast<uint64>(&cMaterial), pSRPDirectionalLightingShadersMaterial);
+	}
+	return *pSRPDirectionalLightingShadersMaterial;
+}
 
+/**
+*  @brief
+*    Returns the environment flags to use for drawing a scene node
+*/
+uint32 SRPDirectionalLightingShaders::GetEnvironmentFlags(const SceneNode &cSceneNode, const VertexBuffer &cVertexBuffer) const
+{
 	// Is lighting enabled for this scene node?
 	const bool bLightingEnabled = !(cSceneNode.GetFlags() & SceneNode::NoLighting) && (m_cLightColor != Color3::Black);
 
@@ -167,7 +188,7 @@ void SRPDirectionalLightingShaders::DrawMesh(Renderer &cRenderer, const SQCull &
 	const bool bHasVertexTexCoord0 = (cVertexBuffer.GetVertexAttribute(VertexBuffer::TexCoord, 0) != nullptr);	// e.g. for diffuse maps
 	const bool bHasVertexTexCoord1 = (cVertexBuffer.GetVertexAttribute(VertexBuffer::TexCoord, 1) != nullptr);	// e.g. for light maps
 	const bool bHasVertexNormal    = (cVertexBuffer.GetVertexAttribute(VertexBuffer::Normal) != nullptr);
-		  bool bHasVertexTangent   = bHasVertexNormal && (cVertexBuffer.GetVertexAttribute(VertexBuffer::Tangent) != nullptr);
+	const bool bHasVertexTangent   = bHasVertexNormal && (cVertexBuffer.GetVertexAttribute(VertexBuffer::Tangent) != nullptr);
 	const bool bHasVertexBinormal  = bHasVertexTangent && (cVertexBuffer.GetVertexAttribute(VertexBuffer::Binormal) != nullptr);
 
 	// For better readability, define whether or not normal mapping is possible with the given vertex data
@@ -190,123 +211,278 @@ void SRPDirectionalLightingShaders::DrawMesh(Renderer &cRenderer, const SQCull &
 	if (m_fDOFBlurrinessCutoff)
 		nEnvironmentFlags |= SRPDirectionalLightingShadersMaterial::EnvironmentDOFEnabled;
 
-	// Draw mesh
-	for (uint32 nMat=0; nMat<cMeshHandler.GetNumOfMaterials(); nMat++) {
-		// Get mesh material
-		Material *pMaterial = cMeshHandler.GetMaterial(nMat);
-		if (pMaterial) {
-			// Draw geometries
-			for (uint32 nGeo=0; nGeo<lstGeometries.GetNumOfElements(); nGeo++) {
-				// Is this geometry active and is it using the current used mesh material?
-				const Geometry &cGeometry = lstGeometries[nGeo];
-				if (cGeometry.IsActive() && nMat == cGeometry.GetMaterial()) {
-					// Transparent material?
-					static const String sOpacity = "Opacity";
-					const Parameter *pParameter = pMaterial->GetParameter(sOpacity);
-					if ((GetFlags() & TransparentPass) ? (pParameter && pParameter->GetValue1f() < 1.0f) : (!pParameter || pParameter->GetValue1f() >= 1.0f)) {
-						// SRPDirectionalLightingShaders-material caching
-						SRPDirectionalLightingShadersMaterial *pSRPDirectionalLightingShadersMaterial = m_lstMaterialCache.Get(reinterpret_cast<uint64>(pMaterial));
-						if (!pSRPDirectionalLightingShadersMaterial) {
-							// The material is not yet cached
-							pSRPDirectionalLightingShadersMaterial = new SRPDirectionalLightingShadersMaterial(*m_pRenderStates, *pMaterial, *m_pProgramGenerator);
-							m_lstMaterialCache.Add(reinterpret_cast<uint64>(pMaterial), pSRPDirectionalLightingShadersMaterial);
-						}
-
-						// [TODO] Correct texture filter
-						SRPDirectionalLightingShadersMaterial::GeneratedProgramUserData *pGeneratedProgramUserData = pSRPDirectionalLightingShadersMaterial->MakeMaterialCurrent(GetFlags(), nEnvironmentFlags, SRPDirectionalLightingShadersMaterial::Anisotropic2);
-						if (pGeneratedProgramUserData) {
-							// Ambient color
-							if (pGeneratedProgramUserData->pAmbientColor)
-								pGeneratedProgramUserData->pAmbientColor->Set(AmbientColor.Get());
-
-							// Set the "ViewSpaceToWorldSpace" fragment shader parameter
-							if (pGeneratedProgramUserData->pViewSpaceToWorldSpace) {
-								// [TODO] Add *SQCullQuery::GetInvViewMatrix()?
-								Matrix3x3 mRot = cCullQuery.GetViewMatrix().GetInverted();
-								pGeneratedProgramUserData->pViewSpaceToWorldSpace->Set(mRot);
-							}
-
-							if (bLightingEnabled) {
-								// Set view space light direction and light color
-								if (pGeneratedProgramUserData->pLightDirection)
-									pGeneratedProgramUserData->pLightDirection->Set(m_vLightDirection);
-								if (pGeneratedProgramUserData->pLightColor)
-									pGeneratedProgramUserData->pLightColor->Set(m_cLightColor);
-							}
-
-							// DOF
-							if (pGeneratedProgramUserData->pDOFParams)
-								pGeneratedProgramUserData->pDOFParams->Set(m_fDOFNearBlurDepth, m_fDOFFocalPlaneDepth, m_fDOFFarBlurDepth, m_fDOFBlurrinessCutoff);
-
-							// Set object space to clip space matrix uniform
-							if (pGeneratedProgramUserData->pObjectSpaceToClipSpaceMatrix)
-								pGeneratedProgramUserData->pObjectSpaceToClipSpaceMatrix->Set(cVisNode.GetWorldViewProjectionMatrix());
-
-							// Set object space to view space matrix uniform
-							if (pGeneratedProgramUserData->pObjectSpaceToViewSpaceMatrix)
-								pGeneratedProgramUserData->pObjectSpaceToViewSpaceMatrix->Set(cVisNode.GetWorldViewMatrix());
-
-							// Parallax mapping - set object space eye position
-							if (pGeneratedProgramUserData->pHeightMap && pGeneratedProgramUserData->pEyePos)
-								pGeneratedProgramUserData->pEyePos->Set(cVisNode.GetInverseWorldMatrix()*(cVisContainer.GetWorldMatrix()*cCullQuery.GetCameraPosition()));
-
-							// Set program vertex attributes, this creates a connection between "Vertex Buffer Attribute" and "Vertex Shader Attribute"
-							if (pGeneratedProgramUserData->pVertexPosition)
-								pGeneratedProgramUserData->pVertexPosition->Set(&cVertexBuffer, PLRenderer::VertexBuffer::Position);
-							if (pGeneratedProgramUserData->pVertexTexCoord0)
-								pGeneratedProgramUserData->pVertexTexCoord0->Set(&cVertexBuffer, PLRenderer::VertexBuffer::TexCoord, 0);
-							if (pGeneratedProgramUserData->pVertexTexCoord1)
-								pGeneratedProgramUserData->pVertexTexCoord1->Set(&cVertexBuffer, PLRenderer::VertexBuffer::TexCoord, 1);
-							if (pGeneratedProgramUserData->pVertexNormal)
-								pGeneratedProgramUserData->pVertexNormal->Set(&cVertexBuffer, PLRenderer::VertexBuffer::Normal);
-							if (pGeneratedProgramUserData->pVertexTangent)
-								pGeneratedProgramUserData->pVertexTangent->Set(&cVertexBuffer, PLRenderer::VertexBuffer::Tangent);
-							if (pGeneratedProgramUserData->pVertexBinormal)
-								pGeneratedProgramUserData->pVertexBinormal->Set(&cVertexBuffer, PLRenderer::VertexBuffer::Binormal);
-
-							// Two sided lighting?
-							if (pGeneratedProgramUserData->pNormalScale)
-								pGeneratedProgramUserData->pNormalScale->Set(1.0f);
-
-							// Draw the geometry
-							cRenderer.DrawIndexedPrimitives(
-								cGeometry.GetPrimitiveType(),
-								0,
-								cVertexBuffer.GetNumOfElements()-1,
-								cGeometry.GetStartIndex(),
-								cGeometry.GetIndexSize()
-							);
-
-							// If this is a two sided material, draw the primitives again - but with
-							// flipped culling mode and vertex normals
-							if (pGeneratedProgramUserData->pNormalScale) {
-								// Flip normals
-								pGeneratedProgramUserData->pNormalScale->Set(-1.0f);
-
-								// Flip the backface culling
-								const uint32 nCullModeBackup = cRenderer.GetRenderState(RenderState::CullMode);
-								cRenderer.SetRenderState(RenderState::CullMode, Cull::CW);
-
-								// Draw geometry - again
-								cRenderer.DrawIndexedPrimitives(
-									cGeometry.GetPrimitiveType(),
-									0,
-									cVertexBuffer.GetNumOfElements()-1,
-									cGeometry.GetStartIndex(),
-									cGeometry.GetIndexSize()
-								);
-
-								// Restore the previous cull mode
-								cRenderer.SetRenderState(RenderState::CullMode, nCullModeBackup);
-							}
-						}
+	// Done
+	return nEnvironmentFlags;
+}
+
+/**
+*  @brief
+*    Draws the geometry of a render queue item
+*/
+bool SRPDirectionalLightingShaders::DrawGeometry(Renderer &cRenderer, const RenderQueue::Item &cItem, uint32 nFirstInstance, uint32 nNumOfInstances)
+{
+	// Get the item data
+	const SQCull		 &cCullQuery	= *cItem.pCullQuery;
+	const VisNode		 &cVisNode		= *cItem.pVisNode;
+		  VertexBuffer	 &cVertexBuffer	= *cItem.pVertexBuffer;
+	const Geometry		 &cGeometry		= *cItem.pGeometry;
+	const VisContainer	 &cVisContainer	= cCullQuery.GetVisContainer();
+
+	// Bind index buffer
+	cRenderer.SetIndexBuffer(cItem.pIndexBuffer);
+
+	// Get the environment flags and whether or not lighting is enabled for this scene node
+	uint32 nEnvironmentFlags = GetEnvironmentFlags(*cVisNode.GetSceneNode(), cVertexBuffer);
+	if (nNumOfInstances)
+		nEnvironmentFlags |= SRPDirectionalLightingShadersMaterial::EnvironmentInstancing;
+	const bool   bLightingEnabled  = (nEnvironmentFlags & SRPDirectionalLightingShadersMaterial::EnvironmentLightingEnabled) != 0;
+
+	// Material or environment change? Within the sorted render queue, items with the same states follow each other.
+	SRPDirectionalLightingShadersMaterial *pSRPDirectionalLightingShadersMaterial = &GetSRPDirectionalLightingShadersMaterial(*cItem.pMaterial);
+	if (m_pCurrentMaterial != pSRPDirectionalLightingShadersMaterial || m_nCurrentEnvironmentFlags != nEnvironmentFlags) {
+		m_pCurrentMaterial         = pSRPDirectionalLightingShadersMaterial;
+		m_nCurrentEnvironmentFlags = nEnvironmentFlags;
+
+		// [TODO] Correct texture filter
+		m_pCurrentGeneratedProgramUserData = pSRPDirectionalLightingShadersMaterial->MakeMaterialCurrent(GetFlags(), nEnvironmentFlags, SRPDirectionalLightingShadersMaterial::Anisotropic2);
+	}
+	SRPDirectionalLightingShadersMaterial::GeneratedProgramUserData *pGeneratedProgramUserData = m_pCurrentGeneratedProgramUserData;
+	if (pGeneratedProgramUserData && (!nNumOfInstances || pGeneratedProgramUserData->pInstanceMap)) {
+		// Ambient color
+		if (pGeneratedProgramUserData->pAmbientColor)
+			pGeneratedProgramUserData->pAmbientColor->Set(AmbientColor.Get());
+
+		// Set the "ViewSpaceToWorldSpace" fragment shader parameter
+		if (pGeneratedProgramUserData->pViewSpaceToWorldSpace) {
+			// [TODO] Add *SQCullQuery::GetInvViewMatrix()?
+			Matrix3x3 mRot = cCullQuery.GetViewMatrix().GetInverted();
+			pGeneratedProgramUserData->pViewSpaceToWorldSpace->Set(mRot);
+		}
+
+		if (bLightingEnabled) {
+			// Set view space light direction and light color
+			if (pGeneratedProgramUserData->pLightDirection)
+				pGeneratedProgramUserData->pLightDirection->Set(m_vLightDirection);
+			if (pGeneratedProgramUserData->pLightColor)
+				pGeneratedProgramUserData->pLightColor->Set(m_cLightColor);
+		}
+
+		// DOF
+		if (pGeneratedProgramUserData->pDOFParams)
+			pGeneratedProgramUserData->pDOFParams->Set(m_fDOFNearBlurDepth, m_fDOFFocalPlaneDepth, m_fDOFFarBlurDepth, m_fDOFBlurrinessCutoff);
+
+		// Set object space to clip space matrix uniform
+		if (pGeneratedProgramUserData->pObjectSpaceToClipSpaceMatrix)
+			pGeneratedProgramUserData->pObjectSpaceToClipSpaceMatrix->Set(cVisNode.GetWorldViewProjectionMatrix());
+
+		// Set object space to view space matrix uniform
+		if (pGeneratedProgramUserData->pObjectSpaceToViewSpaceMatrix)
+			pGeneratedProgramUserData->pObjectSpaceToViewSpaceMatrix->Set(cVisNode.GetWorldViewMatrix());
+
+		// Parallax mapping - set object space eye position
+		if (pGeneratedProgramUserData->pHeightMap && pGeneratedProgramUserData->pEyePos)
+			pGeneratedProgramUserData->pEyePos->Set(cVisNode.GetInverseWorldMatrix()*(cVisContainer.GetWorldMatrix()*cCullQuery.GetCameraPosition()));
+
+		// Instancing: Set the instance map, the instance map row of the first instance and the view space to clip space matrix
+		if (nNumOfInstances) {
+			const int nTextureUnit = pGeneratedProgramUserData->pInstanceMap->Set(m_pInstanceMap);
+			if (nTextureUnit >= 0) {
+				cRenderer.SetSamplerState(nTextureUnit, Sampler::AddressU,  TextureAddressing::Clamp);
+				cRenderer.SetSamplerState(nTextureUnit, Sampler::AddressV,  TextureAddressing::Clamp);
+				cRenderer.SetSamplerState(nTextureUnit, Sampler::MagFilter, TextureFiltering::None);
+				cRenderer.SetSamplerState(nTextureUnit, Sampler::MinFilter, TextureFiltering::None);
+				cRenderer.SetSamplerState(nTextureUnit, Sampler::MipFilter, TextureFiltering::None);
+			}
+			if (pGeneratedProgramUserData->pInstanceOffset)
+				pGeneratedProgramUserData->pInstanceOffset->Set(static_cast<int>(nFirstInstance));
+			if (pGeneratedProgramUserData->pViewSpaceToClipSpaceMatrix)
+				pGeneratedProgramUserData->pViewSpaceToClipSpaceMatrix->Set(cCullQuery.GetProjectionMatrix());
+		}
+
+		// Set program vertex attributes, this creates a connection between "Vertex Buffer Attribute" and "Vertex Shader Attribute"
+		if (pGeneratedProgramUserData->pVertexPosition)
+			pGeneratedProgramUserData->pVertexPosition->Set(&cVertexBuffer, PLRenderer::VertexBuffer::Position);
+		if (pGeneratedProgramUserData->pVertexTexCoord0)
+			pGeneratedProgramUserData->pVertexTexCoord0->Set(&cVertexBuffer, PLRenderer::VertexBuffer::TexCoord, 0);
+		if (pGeneratedProgramUserData->pVertexTexCoord1)
+			pGeneratedProgramUserData->pVertexTexCoord1->Set(&cVertexBuffer, PLRenderer::VertexBuffer::TexCoord, 1);
+		if (pGeneratedProgramUserData->pVertexNormal)
+			pGeneratedProgramUserData->pVertexNormal->Set(&cVertexBuffer, PLRenderer::VertexBuffer::Normal);
+		if (pGeneratedProgramUserData->pVertexTangent)
+			pGeneratedProgramUserData->pVertexTangent->Set(&cVertexBuffer, PLRenderer::VertexBuffer::Tangent);
+		if (pGeneratedProgramUserData->pVertexBinormal)
+			pGeneratedProgramUserData->pVertexBinormal->Set(&cVertexBuffer, PLRenderer::VertexBuffer::Binormal);
+
+		// Two sided lighting?
+		if (pGeneratedProgramUserData->pNormalScale)
+			pGeneratedProgramUserData->pNormalScale->Set(1.0f);
+
+		// Draw the geometry
+		if (nNumOfInstances) {
+			cRenderer.DrawIndexedPrimitivesInstanced(
+				cGeometry.GetPrimitiveType(),
+				0,
+				cVertexBuffer.GetNumOfElements()-1,
+				cGeometry.GetStartIndex(),
+				cGeometry.GetIndexSize(),
+				nNumOfInstances
+			);
+		} else {
+			cRenderer.DrawIndexedPrimitives(
+				cGeometry.GetPrimitiveType(),
+				0,
+				cVertexBuffer.GetNumOfElements()-1,
+				cGeometry.GetStartIndex(),
+				cGeometry.GetIndexSize()
+			);
+		}
+
+		// If this is a two sided material, draw the primitives again - but with
+		// flipped culling mode and vertex normals
+		if (pGeneratedProgramUserData->pNormalScale) {
+			// Flip normals
+			pGeneratedProgramUserData->pNormalScale->Set(-1.0f);
+
+			// Flip the backface culling
+			const uint32 nCullModeBackup = cRenderer.GetRenderState(RenderState::CullMode);
+			cRenderer.SetRenderState(RenderState::CullMode, Cull::CW);
+
+			// Draw geometry - again
+			if (nNumOfInstances) {
+				cRenderer.DrawIndexedPrimitivesInstanced(
+					cGeometry.GetPrimitiveType(),
+					0,
+					cVertexBuffer.GetNumOfElements()-1,
+					cGeometry.GetStartIndex(),
+					cGeometry.GetIndexSize(),
+					nNumOfInstances
+				);
+			} else {
+				cRenderer.DrawIndexedPrimitives(
+					cGeometry.GetPrimitiveType(),
+					0,
+					cVertexBuffer.GetNumOfElements()-1,
+					cGeometry.GetStartIndex(),
+					cGeometry.GetIndexSize()
+				);
+			}
+
+			// Restore the previous cull mode
+			cRenderer.SetRenderState(RenderState::CullMode, nCullModeBackup);
+		}
+
+		// Done
+		return true;
+	}
+
+	// Error!
+	return false;
+}
+
+
+//[-------------------------------------------------------]
+//[ Private virtual SRPDirectionalLighting functions      ]
+//[-------------------------------------------------------]
+const void *SRPDirectionalLightingShaders::GetItemProgram(const RenderQueue::Item &cItem)
+{
+	// The generated program depends on the material and on the environment
+	ProgramGenerator::GeneratedProgram *pGeneratedProgram = GetSRPDirectionalLightingShadersMaterial(*cItem.pMaterial).GetGeneratedProgram(GetFlags(), GetEnvironmentFlags(*cItem.pVisNode->GetSceneNode(), *cItem.pVertexBuffer));
+	return pGeneratedProgram ? pGeneratedProgram->pProgram : nullptr;
+}
+
+void SRPDirectionalLightingShaders::DrawItem(Renderer &cRenderer, const RenderQueue::Item &cItem)
+{
+	// Draw the item without instancing
+	DrawGeometry(cRenderer, cItem, 0, 0);
+}
+
+uint32 SRPDirectionalLightingShaders::GetMaxNumOfInstances(Renderer &cRenderer) const
+{
+	// The number of instances is limited by the height of the instance map
+	return m_bInstancingSupported ? cRenderer.GetCapabilities().nMaxRectangleTextureBufferSize : 1;
+}
+
+void SRPDirectionalLightingShaders::PrepareBatches(Renderer &cRenderer, const RenderQueue &cRenderQueue)
+{
+	// Count the instances
+	m_nNumOfInstances = 0;
+	m_nNextInstance   = 0;
+	const uint32 nNumOfBatches = cRenderQueue.GetNumOfBatches();
+	for (uint32 i=0; i<nNumOfBatches; i++) {
+		const uint32 nNumOfItems = cRenderQueue.GetBatch(i).nNumOfItems;
+		if (nNumOfItems > 1)
+			m_nNumOfInstances += nNumOfItems;
+	}
+	if (m_nNumOfInstances) {
+		// Batches not fitting into the instance map are drawn without instancing
+		const uint32 nMaxNumOfInstances = cRenderer.GetCapabilities().nMaxRectangleTextureBufferSize;
+		if (m_nNumOfInstances > nMaxNumOfInstances)
+			m_nNumOfInstances = nMaxNumOfInstances;
+
+		// (Re)create the instance map if it's too small, the height is a power of two to avoid creating it each frame
+		if (!m_pInstanceMap || m_lstInstanceData.GetNumOfElements()/16 < m_nNumOfInstances) {
+			if (m_pInstanceMap) {
+				delete m_pInstanceMap;
+				m_pInstanceMap = nullptr;
+			}
+			uint32 nHeight = 64;
+			while (nHeight < m_nNumOfInstances)
+				nHeight <<= 1;
+			if (nHeight > nMaxNumOfInstances)
+				nHeight = nMaxNumOfInstances;
+			Image cImage = Image::CreateImage(DataFloat, ColorRGBA, Vector3i(4, nHeight, 1));
+			m_pInstanceMap = cRenderer.CreateTextureBufferRectangle(cImage, TextureBuffer::R32G32B32A32F, 0);
+			m_lstInstanceData.Resize(4*4*nHeight, true, true);
+		}
+		if (m_pInstanceMap) {
+			// Fill the per instance data, one row with four RGBA float texels per instance
+			float *pfData = m_lstInstanceData.GetData();
+			uint32 nInstance = 0;
+			for (uint32 i=0; i<nNumOfBatches; i++) {
+				const RenderQueue::Batch &sBatch = cRenderQueue.GetBatch(i);
+				if (sBatch.nNumOfItems > 1) {
+					// Stop at the first batch not fitting into the instance map
+					if (nInstance + sBatch.nNumOfItems > m_nNumOfInstances)
+						break;
+					for (uint32 nItem=0; nItem<sBatch.nNumOfItems; nItem++, nInstance++, pfData+=16) {
+						const RenderQueue::Item &cItem = cRenderQueue.GetItem(sBatch.nFirstItem + nItem);
+
+						// Texel 0-2: Rows of the object space to view space matrix
+						const Matrix4x4 &mWorldView = cItem.pVisNode->GetWorldViewMatrix();
+						pfData[ 0] = mWorldView.xx; pfData[ 1] = mWorldView.xy; pfData[ 2] = mWorldView.xz; pfData[ 3] = mWorldView.xw;
+						pfData[ 4] = mWorldView.yx; pfData[ 5] = mWorldView.yy; pfData[ 6] = mWorldView.yz; pfData[ 7] = mWorldView.yw;
+						pfData[ 8] = mWorldView.zx; pfData[ 9] = mWorldView.zy; pfData[10] = mWorldView.zz; pfData[11] = mWorldView.zw;
+
+						// Texel 3: Object space eye position (parallax mapping)
+						const Vector3 vEyePos = cItem.pVisNode->GetInverseWorldMatrix()*(cItem.pCullQuery->GetVisContainer().GetWorldMatrix()*cItem.pCullQuery->GetCameraPosition());
+						pfData[12] = vEyePos.x; pfData[13] = vEyePos.y; pfData[14] = vEyePos.z; pfData[15] = 1.0f;
 					}
 				}
 			}
+			m_nNumOfInstances = nInstance;
+
+			// Upload the per instance data
+			m_pInstanceMap->CopyDataFrom(0, TextureBuffer::R32G32B32A32F, m_lstInstanceData.GetData());
+		} else {
+			m_nNumOfInstances = 0;
 		}
 	}
 }
 
+bool SRPDirectionalLightingShaders::DrawBatch(Renderer &cRenderer, const RenderQueue &cRenderQueue, const RenderQueue::Batch &sBatch)
+{
+	// Draw the batch by using instancing? The batches are drawn in the order their instances were put into the instance map.
+	if (m_nNextInstance + sBatch.nNumOfItems <= m_nNumOfInstances) {
+		const uint32 nFirstInstance = m_nNextInstance;
+		m_nNextInstance += sBatch.nNumOfItems;
+		if (DrawGeometry(cRenderer, cRenderQueue.GetItem(sBatch.nFirstItem), nFirstInstance, sBatch.nNumOfItems))
+			return true;
+	}
+
+	// Draw the items one after another
+	return SRPDirectionalLighting::DrawBatch(cRenderer, cRenderQueue, sBatch);
+}
+
 
 //[-------------------------------------------------------]
 //[ Private virtual PLScene::SceneRendererPass functions  ]
@@ -328,6 +504,7 @@ void SRPDirectionalLightingShaders::Draw(Renderer &cRenderer, const SQCull &cCul
 			delete m_pProgramGenerator;
 			m_pProgramGenerator = nullptr;
 		}
+		m_bInstancingSupported = false;
 
 		// Choose the shader source codes depending on the requested shader language
 		if (sShaderLanguage == "GLSL") {
@@ -338,6 +515,9 @@ void SRPDirectionalLightingShaders::Draw(Renderer &cRenderer, const SQCull &cCul
 			} else {
 				// Remove precision qualifiers because they usually create some nasty driver issues!
 				m_pProgramGenerator = new ProgramGenerator(cRenderer, sShaderLanguage, Shader::RemovePrecisionQualifiersFromGLSL(sDirectionalLighting_GLSL_VS), "120", Shader::RemovePrecisionQualifiersFromGLSL(sDirectionalLighting_GLSL_FS), "120");	// OpenGL 2.1 ("#version 120")
+
+				// The instancing vertex shader fetches the per instance data from a rectangle texture buffer by using the instance ID
+				m_bInstancingSupported = (cRenderer.GetCapabilities().bInstancing && cRenderer.GetCapabilities().bTextureBufferRectangle);
 			}
 		} else if (sShaderLanguage == "Cg") {
 			#include "SRPDirectionalLightingShaders_Cg.h"
@@ -416,8 +596,13 @@ void SRPDirectionalLightingShaders::Draw(Renderer &cRenderer, const SQCull &cCul
 			m_cLightNodeHandler.SetElement();
 		}
 
-		// Draw recursive from front to back
-		DrawRec(cRenderer, cCullQuery);
+		// Reset current states
+		m_pCurrentMaterial                 = nullptr;
+		m_nCurrentEnvironmentFlags         = 0;
+		m_pCurrentGeneratedProgramUserData = nullptr;
+
+		// Draw the visible mesh geometries
+		DrawRenderQueue(cRenderer, cCullQuery);
 
 		// Restore the color mask
 		cRenderer.SetColorMask(bRed, bGreen, bBlue, bAlpha);
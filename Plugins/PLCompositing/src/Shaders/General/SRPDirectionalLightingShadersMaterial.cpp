@@ -91,6 +91,9 @@ const String SRPDirectionalLightingShadersMaterial::NormalScale						= "NormalSc
 const String SRPDirectionalLightingShadersMaterial::ObjectSpaceToViewSpaceMatrix	= "ObjectSpaceToViewSpaceMatrix";
 const String SRPDirectionalLightingShadersMaterial::ObjectSpaceToClipSpaceMatrix	= "ObjectSpaceToClipSpaceMatrix";
 const String SRPDirectionalLightingShadersMaterial::EyePos							= "EyePos";
+const String SRPDirectionalLightingShadersMaterial::ViewSpaceToClipSpaceMatrix		= "ViewSpaceToClipSpaceMatrix";
+const String SRPDirectionalLightingShadersMaterial::InstanceMap						= "InstanceMap";
+const String SRPDirectionalLightingShadersMaterial::InstanceOffset					= "InstanceOffset";
 const String SRPDirectionalLightingShadersMaterial::AmbientColor					= "AmbientColor";
 // const String SRPDirectionalLightingShadersMaterial::AlphaReference				= "AlphaReference";	// Already defined
 const String SRPDirectionalLightingShadersMaterial::FresnelConstants				= "FresnelConstants";
@@ -195,12 +198,8 @@ SRPDirectionalLightingShadersMaterial::GeneratedProgramUserData *SRPDirectionalL
 	// Get the used renderer
 	Renderer &cRenderer = m_pProgramGenerator->GetRenderer();
 
-	// Synchronize this material cache with the owner
-	if (m_nRendererFlags != nRendererFlags || m_nEnvironmentFlags != nEnvironmentFlags || !m_bSynchronized)
-		Synchronize(nRendererFlags, nEnvironmentFlags);
-
-	// Get a program instance from the program generator using the given program flags
-	ProgramGenerator::GeneratedProgram *pGeneratedProgram = m_pProgramGenerator->GetProgram(m_cProgramFlags);
+	// Get a program instance from the program generator
+	ProgramGenerator::GeneratedProgram *pGeneratedProgram = GetGeneratedProgram(nRendererFlags, nEnvironmentFlags);
 
 	// Make our program to the current one
 	GeneratedProgramUserData *pGeneratedProgramUserData = nullptr;
@@ -222,6 +221,9 @@ SRPDirectionalLightingShadersMaterial::GeneratedProgramUserData *SRPDirectionalL
 			pGeneratedProgramUserData->pObjectSpaceToViewSpaceMatrix	= pProgram->GetUniform(ObjectSpaceToViewSpaceMatrix);
 			pGeneratedProgramUserData->pObjectSpaceToClipSpaceMatrix	= pProgram->GetUniform(ObjectSpaceToClipSpaceMatrix);
 			pGeneratedProgramUserData->pEyePos							= pProgram->GetUniform(EyePos);
+			pGeneratedProgramUserData->pViewSpaceToClipSpaceMatrix		= pProgram->GetUniform(ViewSpaceToClipSpaceMatrix);
+			pGeneratedProgramUserData->pInstanceMap						= pProgram->GetUniform(InstanceMap);
+			pGeneratedProgramUserData->pInstanceOffset					= pProgram->GetUniform(InstanceOffset);
 			// Fragment shader uniforms
 			pGeneratedProgramUserData->pAmbientColor					= pProgram->GetUniform(AmbientColor);
 			pGeneratedProgramUserData->pDiffuseColor					= pProgram->GetUniform(DiffuseColor);
@@ -531,6 +533,20 @@ SRPDirectionalLightingShadersMaterial::GeneratedProgramUserData *SRPDirectionalL
 	return pGeneratedProgramUserData;
 }
 
+/**
+*  @brief
+*    Returns the generated program this material is using
+*/
+ProgramGenerator::GeneratedProgram *SRPDirectionalLightingShadersMaterial::GetGeneratedProgram(uint32 nRendererFlags, uint32 nEnvironmentFlags)
+{
+	// Synchronize this material cache with the owner
+	if (m_nRendererFlags != nRendererFlags || m_nEnvironmentFlags != nEnvironmentFlags || !m_bSynchronized)
+		Synchronize(nRendererFlags, nEnvironmentFlags);
+
+	// Get a program instance from the program generator using the given program flags
+	return m_pProgramGenerator->GetProgram(m_cProgramFlags);
+}
+
 
 //[-------------------------------------------------------]
 //[ Private functions                                     ]
@@ -544,7 +560,8 @@ void SRPDirectionalLightingShadersMaterial::Synchronize(uint32 nRendererFlags, u
 	const Parameter *pParameter = nullptr;
 
 	// Backup the flags
-	m_nRendererFlags = nRendererFlags;
+	m_nRendererFlags    = nRendererFlags;
+	m_nEnvironmentFlags = nEnvironmentFlags;
 
 	// Reset the program flags
 	m_cProgramFlags.Reset();
@@ -588,6 +605,10 @@ void SRPDirectionalLightingShadersMaterial::Synchronize(uint32 nRendererFlags, u
 		}
 	}
 
+	// Instancing
+	if (nEnvironmentFlags & EnvironmentInstancing)
+		PL_ADD_VS_FLAG(m_cProgramFlags, VS_INSTANCING)
+
 	// Normal
 	if (nEnvironmentFlags & EnvironmentVertexNormal) {
 		PL_ADD_VS_FLAG(m_cProgramFlags, VS_NORMAL)
@@ -24,6 +24,13 @@
 
 // GLSL (OpenGL 2.1 ("#version 120") and OpenGL ES 2.0 ("#version 100")) vertex shader source code, "#version" is added by "PLRenderer::ProgramGenerator"
 static const PLCore::String sDirectionalLighting_GLSL_VS = "\
+// Extensions\n\
+#ifdef VS_INSTANCING\n\
+	#extension GL_EXT_gpu_shader4 : enable\n\
+	#extension GL_ARB_draw_instanced : enable\n\
+	#extension GL_ARB_texture_rectangle : enable\n\
+#endif\n\
+\n\
 // In attributes\n\
 attribute mediump vec4 VertexPosition;			// Object space vertex position input\n\
 #ifdef VS_TEXCOORD0\n\
@@ -66,19 +73,40 @@ attribute mediump vec4 VertexPosition;			// Object space vertex position input\n
 #if defined(VS_NORMAL) && defined(VS_TWOSIDEDLIGHTING)\n\
 	uniform mediump float NormalScale;					// Normal scale (negative to flip normals)\n\
 #endif\n\
-#if defined(VS_VIEWSPACEPOSITION) || defined(VS_NORMAL)\n\
-	uniform mediump mat4 ObjectSpaceToViewSpaceMatrix;	// Object space to view space matrix\n\
-#endif\n\
-uniform mediump mat4 ObjectSpaceToClipSpaceMatrix;		// Object space to clip space matrix\n\
-#if defined(VS_NORMAL) && defined(VS_TANGENT_BINORMAL) && defined(VS_PARALLAXMAPPING)\n\
-	uniform mediump vec3 EyePos;						// Object space eye position\n\
+#ifdef VS_INSTANCING\n\
+	uniform sampler2DRect InstanceMap;					// Per instance data, one row per instance: object space to view space matrix rows (texel 0-2) and object space eye position (texel 3)\n\
+	uniform int InstanceOffset;							// Instance map row of the first instance\n\
+	uniform mediump mat4 ViewSpaceToClipSpaceMatrix;	// View space to clip space matrix\n\
+#else\n\
+	#if defined(VS_VIEWSPACEPOSITION) || defined(VS_NORMAL)\n\
+		uniform mediump mat4 ObjectSpaceToViewSpaceMatrix;	// Object space to view space matrix\n\
+	#endif\n\
+	uniform mediump mat4 ObjectSpaceToClipSpaceMatrix;	// Object space to clip space matrix\n\
+	#if defined(VS_NORMAL) && defined(VS_TANGENT_BINORMAL) && defined(VS_PARALLAXMAPPING)\n\
+		uniform mediump vec3 EyePos;					// Object space eye position\n\
+	#endif\n\
 #endif\n\
 \n\
 // Programs\n\
 void main()\n\
 {\n\
+#ifdef VS_INSTANCING\n\
+	// Fetch the per instance data\n\
+	int instanceRow = InstanceOffset + gl_InstanceIDARB;\n\
+	mediump mat4 ObjectSpaceToViewSpaceMatrix = transpose(mat4(texelFetch2DRect(InstanceMap, ivec2(0, instanceRow)),\n\
+															   texelFetch2DRect(InstanceMap, ivec2(1, instanceRow)),\n\
+															   texelFetch2DRect(InstanceMap, ivec2(2, instanceRow)),\n\
+															   vec4(0.0, 0.0, 0.0, 1.0)));\n\
+	#if defined(VS_NORMAL) && defined(VS_TANGENT_BINORMAL) && defined(VS_PARALLAXMAPPING)\n\
+		mediump vec3 EyePos = texelFetch2DRect(InstanceMap, ivec2(3, instanceRow)).xyz;\n\
+	#endif\n\
+\n\
+	// Calculate the clip space vertex position, lower/left is (-1,-1) and upper/right is (1,1)\n\
+	gl_Position = ViewSpaceToClipSpaceMatrix*(ObjectSpaceToViewSpaceMatrix*VertexPosition);\n\
+#else\n\
 	// Calculate the clip space vertex position, lower/left is (-1,-1) and upper/right is (1,1)\n\
 	gl_Position = ObjectSpaceToClipSpaceMatrix*VertexPosition;\n\
+#endif\n\
 \n\
 #ifdef VS_TEXCOORD0\n\
 	#ifdef VS_TEXCOORD1\n\
@@ -45,6 +45,7 @@ PL_WARNING_PUSH
 PL_WARNING_POP
 #include <PLCore/File/File.h>
 #include <PLCore/Log/Log.h>
+#include <PLMath/Half.h>
 #include <PLGraphics/Image/Image.h>
 #include <PLGraphics/Image/ImagePart.h>
 #include <PLGraphics/Image/ImageBuffer.h>
@@ -255,11 +256,10 @@ bool ImageLoaderEXR::Save(const Image &cImage, File &cFile)
 				if (nComponents == 4)
 					header.channels().insert("A", Channel (HALF));
 
-				// Convert data to half
+				// Convert data to half (same bit layout as the OpenEXR "half" type)
 				const uint32 nNumOfElements = nWidth*nHeight*nComponents;
-				half *pData = new half[nNumOfElements];
-				for (uint32 i=0; i<nNumOfElements; i++)
-					pData[i] = pfPixels[i];
+				uint16 *pData = new uint16[nNumOfElements];
+				Half::FromFloatArray(pfPixels, pData, nNumOfElements);
 
 				// And save it
 				OutputFile file(ost, header);
@@ -132,6 +132,7 @@ class PGFume : public SNParticleGroup {
 	private:
 		virtual void OnActivate(bool bActivate) override;
 		virtual void OnAddedToVisibilityTree(PLScene::VisNode &cVisNode) override;
+		virtual bool ResetFunction() override;
 
 
 	//[-------------------------------------------------------]
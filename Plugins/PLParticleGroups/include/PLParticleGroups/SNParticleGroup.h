@@ -449,6 +449,7 @@ class SNParticleGroup : public PLScene::SceneNode {
 	protected:
 		PLPG_API virtual void InitFunction();
 		PLPG_API virtual void DeInitFunction();
+		PLPG_API virtual bool ResetFunction();
 		PLPG_API virtual void UpdateAABoundingBox();
 
 
@@ -155,6 +155,17 @@ void PGFume::OnAddedToVisibilityTree(VisNode &cVisNode)
 	m_bUpdate = true;
 }
 
+bool PGFume::ResetFunction()
+{
+	// Reset the particle generation, the init data is set again by "InitParticleGroup()"
+	m_bUpdate			  = false;
+	m_fParticleTime		  = 0.0f;
+	m_bCreateNewParticles = true;
+
+	// Call base implementation
+	return SNParticleGroup::ResetFunction();
+}
+
 
 //[-------------------------------------------------------]
 //[ Private functions                                     ]
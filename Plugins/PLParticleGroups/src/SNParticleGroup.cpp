@@ -844,6 +844,18 @@ void SNParticleGroup::DeInitFunction()
 	SceneNode::DeInitFunction();
 }
 
+bool SNParticleGroup::ResetFunction()
+{
+	// The particles and buffers were destroyed when the scene node was de-initialized, reset the remaining state
+	m_nUsedIndices		   = 0;
+	m_nUsedVertices		   = 0;
+	m_bRemoveAutomatically = false;
+	m_bCreateParticles	   = true;
+
+	// Done
+	return true;
+}
+
 void SNParticleGroup::UpdateAABoundingBox()
 {
 	float fBoundingBox[2][3] = {{0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 0.0f}};
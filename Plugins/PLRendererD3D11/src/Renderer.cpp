@@ -558,6 +558,9 @@ void Renderer::RestoreDeviceObjects()
 {
 	// Call base function
 	PLRenderer::RendererBackend::RestoreDeviceObjects();
+
+	// The shadow states don't match the API states anymore
+	InvalidateShadowStates();
 }
 
 
@@ -717,6 +720,8 @@ bool Renderer::SetRenderState(PLRenderer::RenderState::Enum nState, uint32 nValu
 		// Set the render state
 		m_nRenderState[nState] = nValue;
 		m_sStatistics.nRenderStateChanges++;
+	} else {
+		m_sStatistics.nRenderStateFiltered++;
 	}
 
 	// All went fine
@@ -732,6 +737,8 @@ bool Renderer::SetSamplerState(uint32 nStage, PLRenderer::Sampler::Enum nState,
 			// Set the sampler state
 			m_ppnSamplerState[nStage][nState] = nValue;
 			m_sStatistics.nSamplerStateChanges++;
+		} else {
+			m_sStatistics.nSamplerStateFiltered++;
 		}
 
 		// All went fine
@@ -760,8 +767,9 @@ bool Renderer::EndScene()
 
 bool Renderer::SetViewport(const PLMath::Rectangle *pRectangle, float fMinZ, float fMaxZ)
 {
-	// Call base implementation
-	PLRenderer::RendererBackend::SetViewport(pRectangle);
+	// Update the shadow state, nothing to do if the viewport didn't change
+	if (!UpdateViewport(pRectangle, fMinZ, fMaxZ))
+		return true; // Done
 
 	// Set viewport and depth range
 	if (m_pD3D11DeviceContext) {
@@ -770,8 +778,8 @@ bool Renderer::SetViewport(const PLMath::Rectangle *pRectangle, float fMinZ, flo
 		sD3D11Viewport.TopLeftY	= m_cViewportRect.GetY();
 		sD3D11Viewport.Width	= m_cViewportRect.GetWidth();
 		sD3D11Viewport.Height	= m_cViewportRect.GetHeight();
-		sD3D11Viewport.MinDepth	= fMinZ;
-		sD3D11Viewport.MaxDepth	= fMaxZ;
+		sD3D11Viewport.MinDepth	= m_fViewPortMinZ;
+		sD3D11Viewport.MaxDepth	= m_fViewPortMaxZ;
 		m_pD3D11DeviceContext->RSSetViewports(1, &sD3D11Viewport);
 	}
 
@@ -810,11 +818,8 @@ void Renderer::GetColorMask(bool &bRed, bool &bGreen, bool &bBlue, bool &bAlpha)
 
 bool Renderer::SetColorMask(bool bRed, bool bGreen, bool bBlue, bool bAlpha)
 {
-	// Set color mask
-	m_bColorMask[0] = bRed;
-	m_bColorMask[1] = bGreen;
-	m_bColorMask[2] = bBlue;
-	m_bColorMask[3] = bAlpha;
+	// Set color mask, it's not passed to Direct3D 11, yet
+	UpdateColorMask(bRed, bGreen, bBlue, bAlpha);
 
 	// Done
 	return true;
@@ -839,6 +844,9 @@ bool Renderer::SetRenderTarget(PLRenderer::Surface *pSurface, uint8 nFace)
 
 	// Is this surface already the current render target?
 	if (m_cCurrentSurface.GetSurface() != pSurface || m_nCurrentSurfaceFace != nFace) {
+		// Draw the batched primitives into the render target they were recorded for
+		FlushDrawHelpers();
+
 		// Make the dummy rendering context to the current one?
 		if (pSurface) {
 			// Check parameter
@@ -934,8 +942,12 @@ bool Renderer::SetTextureBuffer(int nStage, PLRenderer::TextureBuffer *pTextureB
 			return false; // Error!
 
 		// Is this texture buffer already set?
-		if (m_ppCurrentTextureBuffer[nStage] == pTextureBuffer)
-			return false; // Error!
+		if (m_ppCurrentTextureBuffer[nStage] == pTextureBuffer) {
+			m_sStatistics.nTextureBufferFiltered++;
+
+			// Error!
+			return false;
+		}
 
 		// Make this texture buffer to the renderers current one
 		PLRenderer::TextureBuffer *pT = m_ppCurrentTextureBuffer[nStage];
@@ -961,12 +973,17 @@ bool Renderer::SetTextureBuffer(int nStage, PLRenderer::TextureBuffer *pTextureB
 bool Renderer::SetIndexBuffer(PLRenderer::IndexBuffer *pIndexBuffer)
 {
 	// Is this index buffer already set?
-	if (m_pCurrentIndexBuffer == pIndexBuffer)
-		return false; // Error!
+	if (m_pCurrentIndexBuffer == pIndexBuffer) {
+		m_sStatistics.nIndexBufferFiltered++;
+
+		// Error!
+		return false;
+	}
 
 	// Make this index buffer to the renderers current one
 	PLRenderer::IndexBuffer *pT = m_pCurrentIndexBuffer;
 	m_pCurrentIndexBuffer = pIndexBuffer;
+	m_sStatistics.nIndexBufferBinds++;
 
 	// Should an index buffer be set?
 	if (pIndexBuffer) {
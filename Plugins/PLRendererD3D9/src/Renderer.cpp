@@ -793,6 +793,9 @@ void Renderer::RestoreDeviceObjects()
 {
 	// Call base function
 	PLRenderer::RendererBackend::RestoreDeviceObjects();
+
+	// The shadow states don't match the API states anymore
+	InvalidateShadowStates();
 }
 
 const Vector2 &Renderer::GetTexelToPixelOffset() const
@@ -1361,6 +1364,8 @@ bool Renderer::SetRenderState(PLRenderer::RenderState::Enum nState, uint32 nValu
 					return false; // Error, invalid render state!
 			}
 		}
+	} else {
+		m_sStatistics.nRenderStateFiltered++;
 	}
 
 	// All went fine
@@ -1407,8 +1412,12 @@ bool Renderer::SetSamplerState(uint32 nStage, PLRenderer::Sampler::Enum nState,
 				nValue = PLRenderer::TextureFiltering::None;
 
 				// Check if this sampler state is already set to this value
-				if (m_ppnInternalSamplerState[nStage][nState] == nValue)
-					return true; // Done - nothing to do here :)
+				if (m_ppnInternalSamplerState[nStage][nState] == nValue) {
+					m_sStatistics.nSamplerStateFiltered++;
+
+					// Done - nothing to do here :)
+					return true;
+				}
 			}
 		}
 
@@ -1493,6 +1502,8 @@ bool Renderer::SetSamplerState(uint32 nStage, PLRenderer::Sampler::Enum nState,
 			default:
 				return false; // Error, invalid sampler state!
 		}
+	} else {
+		m_sStatistics.nSamplerStateFiltered++;
 	}
 
 	// All went fine
@@ -1517,8 +1528,9 @@ bool Renderer::SetViewport(const PLMath::Rectangle *pRectangle, float fMinZ, flo
 {
 	// Check device
 	if (m_pDevice) {
-		// Call base implementation
-		PLRenderer::RendererBackend::SetViewport(pRectangle);
+		// Update the shadow state, nothing to do if the viewport didn't change
+		if (!UpdateViewport(pRectangle, fMinZ, fMaxZ))
+			return true; // Done
 
 		// Get D3D viewport
 		D3DVIEWPORT9 sViewData;
@@ -1526,8 +1538,8 @@ bool Renderer::SetViewport(const PLMath::Rectangle *pRectangle, float fMinZ, flo
 		sViewData.Y      = static_cast<DWORD>(m_cViewportRect.GetY());
 		sViewData.Width  = static_cast<DWORD>(m_cViewportRect.GetWidth());
 		sViewData.Height = static_cast<DWORD>(m_cViewportRect.GetHeight());
-		sViewData.MinZ   = fMinZ;
-		sViewData.MaxZ   = fMaxZ;
+		sViewData.MinZ   = m_fViewPortMinZ;
+		sViewData.MaxZ   = m_fViewPortMaxZ;
 
 		// Set viewport
 		if (SUCCEEDED(m_pDevice->SetViewport(&sViewData)))
@@ -1540,16 +1552,17 @@ bool Renderer::SetViewport(const PLMath::Rectangle *pRectangle, float fMinZ, flo
 
 bool Renderer::SetScissorRect(const PLMath::Rectangle *pRectangle)
 {
-	// Call base implementation
-	PLRenderer::RendererBackend::SetScissorRect(pRectangle);
-
 	// Check device
 	if (m_pDevice) {
+		// Update the shadow state, nothing to do if the scissor rectangle didn't change
+		if (!UpdateScissorRect(pRectangle))
+			return true; // Done
+
 		// Get scissor rectangle
-		uint32 nX      = static_cast<uint32>(m_cViewportRect.GetX());
-		uint32 nY      = static_cast<uint32>(m_cViewportRect.GetY());
-		uint32 nWidth  = static_cast<uint32>(m_cViewportRect.GetWidth());
-		uint32 nHeight = static_cast<uint32>(m_cViewportRect.GetHeight());
+		uint32 nX      = static_cast<uint32>(m_cScissorRect.GetX());
+		uint32 nY      = static_cast<uint32>(m_cScissorRect.GetY());
+		uint32 nWidth  = static_cast<uint32>(m_cScissorRect.GetWidth());
+		uint32 nHeight = static_cast<uint32>(m_cScissorRect.GetHeight());
 
 		// Set scissor rectangle
 		RECT sRect = {nX, nY, nX+nWidth, nY+nHeight};
@@ -1588,11 +1601,9 @@ bool Renderer::SetColorMask(bool bRed, bool bGreen, bool bBlue, bool bAlpha)
 	if (!m_pDevice)
 		return false; // Error!
 
-	// Set color mask
-	m_bColorMask[0] = bRed;
-	m_bColorMask[1] = bGreen;
-	m_bColorMask[2] = bBlue;
-	m_bColorMask[3] = bAlpha;
+	// Set color mask, nothing to do if the color mask didn't change
+	if (!UpdateColorMask(bRed, bGreen, bBlue, bAlpha))
+		return true; // Done
 	uint32 nValue = 0;
 	if (bRed)
 		nValue |= D3DCOLORWRITEENABLE_RED;
@@ -1661,6 +1672,9 @@ bool Renderer::SetRenderTarget(PLRenderer::Surface *pSurface, uint8 nFace)
 			return false; // Error!
 	}
 
+	// Draw the batched primitives into the render target they were recorded for
+	FlushDrawHelpers();
+
 	PLRenderer::Surface *pSurfaceBackup = m_cCurrentSurface.GetSurface();
 	if (m_cCurrentSurface.GetSurface())
 		UnmakeSurfaceCurrent(*m_cCurrentSurface.GetSurface());
@@ -1794,8 +1808,12 @@ bool Renderer::SetTextureBuffer(int nStage, PLRenderer::TextureBuffer *pTextureB
 			return false; // Error!
 
 		// Is this texture buffer already set?
-		if (m_ppCurrentTextureBuffer[nStage] == pTextureBuffer)
-			return false; // Error!
+		if (m_ppCurrentTextureBuffer[nStage] == pTextureBuffer) {
+			m_sStatistics.nTextureBufferFiltered++;
+
+			// Error!
+			return false;
+		}
 
 		// Make this texture buffer to the renderers current one
 		PLRenderer::TextureBuffer *pT = m_ppCurrentTextureBuffer[nStage];
@@ -1828,12 +1846,17 @@ bool Renderer::SetTextureBuffer(int nStage, PLRenderer::TextureBuffer *pTextureB
 bool Renderer::SetIndexBuffer(PLRenderer::IndexBuffer *pIndexBuffer)
 {
 	// Is this index buffer already set?
-	if (m_pCurrentIndexBuffer == pIndexBuffer)
-		return false; // Error!
+	if (m_pCurrentIndexBuffer == pIndexBuffer) {
+		m_sStatistics.nIndexBufferFiltered++;
+
+		// Error!
+		return false;
+	}
 
 	// Make this index buffer to the renderers current one
 	PLRenderer::IndexBuffer *pT = m_pCurrentIndexBuffer;
 	m_pCurrentIndexBuffer = pIndexBuffer;
+	m_sStatistics.nIndexBufferBinds++;
 
 	// Should an index buffer be set?
 	if (pIndexBuffer) {
@@ -366,6 +366,27 @@ void VertexBuffer::VertexAttributeAdded(Attribute &cAttribute)
 			cAttribute.nTypeAPI       = 0;
 			cAttribute.nComponentsAPI = 0;
 			break;
+
+		// Unsigned byte 4 normalized (four components per element, 8 bit unsigned integer per component mapped to [0, 1], may not be supported by each API)
+		case UByte4N:
+			cAttribute.nSizeAPI       = sizeof(uint8)*4;
+			cAttribute.nTypeAPI       = D3DDECLTYPE_UBYTE4N;
+			cAttribute.nComponentsAPI = 1;
+			break;
+
+		// Short 2 normalized (two components per element, 16 bit signed integer per component mapped to [-1, 1], may not be supported by each API)
+		case Short2N:
+			cAttribute.nSizeAPI       = sizeof(short)*2;
+			cAttribute.nTypeAPI       = D3DDECLTYPE_SHORT2N;
+			cAttribute.nComponentsAPI = 1;
+			break;
+
+		// Short 4 normalized (four components per element, 16 bit signed integer per component mapped to [-1, 1], may not be supported by each API)
+		case Short4N:
+			cAttribute.nSizeAPI       = sizeof(short)*4;
+			cAttribute.nTypeAPI       = D3DDECLTYPE_SHORT4N;
+			cAttribute.nComponentsAPI = 1;
+			break;
 	}
 }
 
@@ -0,0 +1,89 @@
+/*********************************************************\
+ *  File: FontGlyphTexture.h                             *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+#ifndef __PLRENDERERNULL_FONTGLYPHTEXTURE_H__
+#define __PLRENDERERNULL_FONTGLYPHTEXTURE_H__
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <PLRenderer/Renderer/FontGlyphTexture.h>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace PLRendererNull {
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Null renderer font glyph texture
+*/
+class FontGlyphTexture : public PLRenderer::FontGlyphTexture {
+
+
+	//[-------------------------------------------------------]
+	//[ Public functions                                      ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Constructor
+		*
+		*  @param[in] nCharacterCode
+		*    Character code
+		*  @param[in] nHeightInPixels
+		*    Font height in pixel
+		*  @param[in] fDescender
+		*    Font descender in pixel (usually negative)
+		*
+		*  @remarks
+		*    Printable characters get a synthetic glyph which is half as wide as high, control characters and
+		*    the space character have no size but still let the pen advance.
+		*/
+		FontGlyphTexture(unsigned long nCharacterCode, PLCore::uint32 nHeightInPixels, float fDescender);
+
+		/**
+		*  @brief
+		*    Destructor
+		*/
+		virtual ~FontGlyphTexture();
+
+
+};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // PLRendererNull
+
+
+#endif // __PLRENDERERNULL_FONTGLYPHTEXTURE_H__
@@ -0,0 +1,142 @@
+/*********************************************************\
+ *  File: FontTexture.h                                  *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+#ifndef __PLRENDERERNULL_FONTTEXTURE_H__
+#define __PLRENDERERNULL_FONTTEXTURE_H__
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <PLRenderer/Renderer/FontTexture.h>
+
+
+//[-------------------------------------------------------]
+//[ Forward declarations                                  ]
+//[-------------------------------------------------------]
+namespace PLCore {
+	class File;
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace PLRendererNull {
+
+
+//[-------------------------------------------------------]
+//[ Forward declarations                                  ]
+//[-------------------------------------------------------]
+class FontManager;
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Null renderer font texture
+*
+*  @remarks
+*    The glyphs are synthetic filled boxes. Draw() uses 256 of them laid out within a virtual 16x16 glyph grid, batched
+*    text rendering rasterizes them into the glyph atlas just as a real font texture does. Drawing issues the same number
+*    of draw calls a real font texture would issue, but nothing is actually rendered.
+*/
+class FontTexture : public PLRenderer::FontTexture {
+
+
+	//[-------------------------------------------------------]
+	//[ Friends                                               ]
+	//[-------------------------------------------------------]
+	friend class FontManager;
+
+
+	//[-------------------------------------------------------]
+	//[ Public functions                                      ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Destructor
+		*/
+		virtual ~FontTexture();
+
+
+	//[-------------------------------------------------------]
+	//[ Public virtual PLRenderer::Font functions             ]
+	//[-------------------------------------------------------]
+	public:
+		virtual bool SetSize(PLCore::uint32 nSize = 12, PLCore::uint32 nResolution = 96) override;
+		virtual bool IsValid() const override;
+		virtual float GetAscender() const override;
+		virtual float GetDescender() const override;
+		virtual float GetHeight() const override;
+		virtual void Draw(const PLCore::String &sText, const PLGraphics::Color4 &cColor, const PLMath::Matrix4x4 &mObjectSpaceToClipSpace, const PLMath::Vector2 &vScale = PLMath::Vector2::One, const PLMath::Vector2 &vBias = PLMath::Vector2::Zero, PLCore::uint32 nFlags = 0) override;
+		virtual void DrawGlyphVertices(const PLCore::Array<GlyphVertex> &lstVertices, PLCore::uint32 nFlags = 0) override;
+
+
+	//[-------------------------------------------------------]
+	//[ Protected virtual PLRenderer::FontTexture functions   ]
+	//[-------------------------------------------------------]
+	protected:
+		virtual bool RasterizeGlyph(PLCore::uint32 nSize, PLCore::uint32 nResolution, PLCore::uint32 nCharacterCode, PLRenderer::GlyphAtlas::Bitmap &sBitmap) override;
+
+
+	//[-------------------------------------------------------]
+	//[ Private functions                                     ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Constructor
+		*
+		*  @param[in] cFontManager
+		*    Creating font manager
+		*  @param[in] cFile
+		*    Font file, only used to reference the new font by filename
+		*/
+		FontTexture(FontManager &cFontManager, PLCore::File &cFile);
+
+		/**
+		*  @brief
+		*    Creates the synthetic glyphs if required
+		*
+		*  @return
+		*    'true' if there are glyphs, else 'false'
+		*/
+		bool CreateGlyphs();
+
+
+};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // PLRendererNull
+
+
+#endif // __PLRENDERERNULL_FONTTEXTURE_H__
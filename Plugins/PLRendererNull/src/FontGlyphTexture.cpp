@@ -0,0 +1,81 @@
+/*********************************************************\
+ *  File: FontGlyphTexture.cpp                           *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "PLRendererNull/FontGlyphTexture.h"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+using namespace PLCore;
+using namespace PLMath;
+namespace PLRendererNull {
+
+
+//[-------------------------------------------------------]
+//[ Public functions                                      ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Constructor
+*/
+FontGlyphTexture::FontGlyphTexture(unsigned long nCharacterCode, uint32 nHeightInPixels, float fDescender)
+{
+	// Printable character?
+	if (nCharacterCode > ' ' && nCharacterCode != 127) {
+		// Set the size (in pixel) of the glyph
+		m_nSize.Set(nHeightInPixels/2, nHeightInPixels);
+
+		// Set the distance (in pixel) from the current pen position to the glyph bitmap
+		m_vCorner.SetXY(0.0f, fDescender);
+	}
+
+	// Set the pen advance
+	m_vPenAdvance.x = static_cast<float>(nHeightInPixels/2);
+
+	// We've got 256 glyphs, this means there are 16 glyphs per row within the virtual glyph texture atlas
+	const float fX = static_cast<float>(nCharacterCode%16);
+	const float fY = static_cast<float>(nCharacterCode/16);
+
+	// Set the normalized minimum and maximum glyph texture coordinate inside the virtual glyph texture atlas
+	m_vTexCoordMin.SetXY(fX/16.0f, fY/16.0f);
+	m_vTexCoordMax.SetXY((fX + 0.5f)/16.0f, (fY + 1.0f)/16.0f);
+}
+
+/**
+*  @brief
+*    Destructor
+*/
+FontGlyphTexture::~FontGlyphTexture()
+{
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // PLRendererNull
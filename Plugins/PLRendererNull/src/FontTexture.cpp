@@ -0,0 +1,199 @@
+/*********************************************************\
+ *  File: FontTexture.cpp                                *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <PLCore/File/File.h>
+#include <PLCore/Core/MemoryManager.h>
+#include <PLRenderer/Renderer/Renderer.h>
+#include "PLRendererNull/FontManager.h"
+#include "PLRendererNull/FontGlyphTexture.h"
+#include "PLRendererNull/FontTexture.h"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+using namespace PLCore;
+using namespace PLMath;
+using namespace PLGraphics;
+namespace PLRendererNull {
+
+
+//[-------------------------------------------------------]
+//[ Public functions                                      ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Destructor
+*/
+FontTexture::~FontTexture()
+{
+	// Remove the glyphs of this font from the glyph atlas before the background rasterization could see a half destroyed font
+	RemoveGlyphsFromAtlas();
+}
+
+
+//[-------------------------------------------------------]
+//[ Public virtual PLRenderer::Font functions             ]
+//[-------------------------------------------------------]
+bool FontTexture::SetSize(uint32 nSize, uint32 nResolution)
+{
+	// Destroy the currently active glyphs
+	DestroyGlyphs();
+
+	// Set the new size, the glyphs are created on demand
+	m_nSize       = nSize;
+	m_nResolution = nResolution;
+
+	// Done
+	return true;
+}
+
+bool FontTexture::IsValid() const
+{
+	// There's no font data which could be invalid
+	return true;
+}
+
+float FontTexture::GetAscender() const
+{
+	return static_cast<float>(m_nSize)*0.8f;
+}
+
+float FontTexture::GetDescender() const
+{
+	return -static_cast<float>(m_nSize)*0.2f;
+}
+
+float FontTexture::GetHeight() const
+{
+	return static_cast<float>(m_nSize);
+}
+
+void FontTexture::Draw(const String &sText, const Color4 &cColor, const Matrix4x4 &mObjectSpaceToClipSpace, const Vector2 &vScale, const Vector2 &vBias, uint32 nFlags)
+{
+	// Create the glyphs if required
+	if (CreateGlyphs()) {
+		// Get the text to draw - we only support ASCII
+		const char *pszText = sText.GetASCII();
+
+		// Get the renderer instance
+		PLRenderer::Renderer &cRenderer = GetFontManager().GetRenderer();
+
+		// Iterate through all characters of the text to draw, one draw call per glyph just as the other backends do
+		for (uint32 i=0; i<sText.GetLength(); i++, pszText++) {
+			if (m_lstGlyphs[static_cast<unsigned char>(*pszText)])
+				cRenderer.DrawPrimitives(PLRenderer::Primitive::TriangleStrip, 0, 4);
+		}
+	}
+}
+
+void FontTexture::DrawGlyphVertices(const Array<GlyphVertex> &lstVertices, uint32 nFlags)
+{
+	// Draw the glyph quads, one draw call per used glyph atlas page just as the other backends do
+	PLRenderer::GlyphAtlas &cGlyphAtlas = GetFontManager().GetGlyphAtlas();
+	uint32 nVertex = 0;
+	uint32 nPage = 0;
+	uint32 nNumOfVertices = GetGlyphPageRun(lstVertices, nVertex, nPage);
+	while (nNumOfVertices) {
+		if (cGlyphAtlas.GetPageTextureBuffer(nPage))
+			GetFontManager().GetRenderer().DrawPrimitives(PLRenderer::Primitive::TriangleList, nVertex, nNumOfVertices);
+		nVertex += nNumOfVertices;
+		nNumOfVertices = GetGlyphPageRun(lstVertices, nVertex, nPage);
+	}
+}
+
+
+//[-------------------------------------------------------]
+//[ Protected virtual PLRenderer::FontTexture functions   ]
+//[-------------------------------------------------------]
+bool FontTexture::RasterizeGlyph(uint32 nSize, uint32 nResolution, uint32 nCharacterCode, PLRenderer::GlyphAtlas::Bitmap &sBitmap)
+{
+	// Get the font height and descender in pixels, see GetHeight() and GetDescender()
+	const uint32 nHeightInPixels = static_cast<uint32>(static_cast<float>(nSize)/72.0f*nResolution);
+	const float  fDescender		 = -static_cast<float>(nSize)*0.2f/72.0f*nResolution;
+	if (!nHeightInPixels)
+		return false; // Error!
+
+	// Printable characters get a filled box, ideographs (CJK and beyond) are square, all others half as wide
+	const uint32 nWidth = (nCharacterCode >= 0x2e80) ? nHeightInPixels : nHeightInPixels/2;
+	if (nCharacterCode > ' ' && nCharacterCode != 127) {
+		sBitmap.vSize.Set(nWidth, nHeightInPixels);
+		sBitmap.vCorner.SetXY(0.0f, fDescender);
+		sBitmap.pnData = new uint8[nWidth*nHeightInPixels];
+		MemoryManager::Set(sBitmap.pnData, 255, nWidth*nHeightInPixels);
+	}
+
+	// Set the pen advance
+	sBitmap.vPenAdvance.x = static_cast<float>(nWidth);
+
+	// Done
+	return true;
+}
+
+
+//[-------------------------------------------------------]
+//[ Private functions                                     ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Constructor
+*/
+FontTexture::FontTexture(FontManager &cFontManager, File &cFile) : PLRenderer::FontTexture(cFontManager, cFile.GetUrl().GetUrl())
+{
+}
+
+/**
+*  @brief
+*    Creates the synthetic glyphs if required
+*/
+bool FontTexture::CreateGlyphs()
+{
+	// Glyphs already there?
+	if (!m_lstGlyphs.GetNumOfElements()) {
+		// Get the font height in pixels
+		const uint32 nFontHeight = GetHeightInPixels();
+		if (nFontHeight) {
+			// Get the descender in pixels
+			const float fDescender = GetDescender()/72.0f*m_nResolution;
+
+			// Create the 256 glyphs
+			const uint32 nNumOfGlyphs = 256;
+			m_lstGlyphs.Resize(nNumOfGlyphs, true, true);
+			for (uint32 i=0; i<nNumOfGlyphs; i++)
+				m_lstGlyphs[i] = new FontGlyphTexture(i, nFontHeight, fDescender);
+		}
+	}
+
+	// Done
+	return (m_lstGlyphs.GetNumOfElements() != 0);
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // PLRendererNull
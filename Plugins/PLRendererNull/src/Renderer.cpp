@@ -29,7 +29,6 @@
 #include <PLGraphics/Image/Image.h>
 #include <PLRenderer/Renderer/SurfaceWindowHandler.h>
 #include <PLRenderer/Renderer/Backend/DrawHelpersBackend.h>
-#include <PLRenderer/Renderer/Backend/FontManagerBackend.h>
 #include "PLRendererNull/SurfaceWindow.h"
 #include "PLRendererNull/SurfaceTextureBuffer.h"
 #include "PLRendererNull/TextureBuffer1D.h"
@@ -42,6 +41,7 @@
 #include "PLRendererNull/VertexBuffer.h"
 #include "PLRendererNull/OcclusionQuery.h"
 #include "PLRendererNull/FixedFunctions.h"
+#include "PLRendererNull/FontManager.h"
 #include "PLRendererNull/Renderer.h"
 
 
@@ -72,7 +72,7 @@ pl_class_metadata_end(Renderer)
 */
 Renderer::Renderer(handle nNativeWindowHandle, EMode nMode, uint32 nZBufferBits, uint32 nStencilBits, uint32 nMultisampleAntialiasingSamples, String sDefaultShaderLanguage) : PLRenderer::RendererBackend(ModeFixedFunctions),	// Only fixed functions mode is supported... a kind of *g*
 	m_pFixedFunctions(nullptr),
-	m_pFontManager(new PLRenderer::FontManagerBackend(*this))
+	m_pFontManager(new FontManager(*this))
 {
 	// Ignore the given native window handle
 
@@ -121,6 +121,7 @@ Renderer::~Renderer()
 
 	// Destroy the fixed functions implementation
 	delete m_pFixedFunctions;
+	m_pFixedFunctions = nullptr;
 
 	// Destroy all renderer surfaces of this renderer
 	while (m_lstSurfaces.GetNumOfElements())
@@ -132,7 +133,7 @@ Renderer::~Renderer()
 	m_lstDisplayModeList.Clear();
 
 	// Destroy the Null font manager
-	delete static_cast<PLRenderer::FontManagerBackend*>(m_pFontManager);
+	delete static_cast<FontManager*>(m_pFontManager);
 	m_pFontManager = nullptr;
 
 	// Destroy the draw helpers instance
@@ -462,6 +463,8 @@ bool Renderer::SetRenderState(PLRenderer::RenderState::Enum nState, uint32 nValu
 		// Set the render state
 		m_nRenderState[nState] = nValue;
 		m_sStatistics.nRenderStateChanges++;
+	} else {
+		m_sStatistics.nRenderStateFiltered++;
 	}
 
 	// All went fine
@@ -477,6 +480,8 @@ bool Renderer::SetSamplerState(uint32 nStage, PLRenderer::Sampler::Enum nState,
 			// Set the sampler state
 			m_ppnSamplerState[nStage][nState] = nValue;
 			m_sStatistics.nSamplerStateChanges++;
+		} else {
+			m_sStatistics.nSamplerStateFiltered++;
 		}
 
 		// All went fine
@@ -534,11 +539,8 @@ void Renderer::GetColorMask(bool &bRed, bool &bGreen, bool &bBlue, bool &bAlpha)
 
 bool Renderer::SetColorMask(bool bRed, bool bGreen, bool bBlue, bool bAlpha)
 {
-	// Set color mask
-	m_bColorMask[0] = bRed;
-	m_bColorMask[1] = bGreen;
-	m_bColorMask[2] = bBlue;
-	m_bColorMask[3] = bAlpha;
+	// Set color mask, there's no API to pass it to
+	UpdateColorMask(bRed, bGreen, bBlue, bAlpha);
 
 	// Done
 	return true;
@@ -582,6 +584,9 @@ bool Renderer::SetRenderTarget(PLRenderer::Surface *pSurface, uint8 nFace)
 			return false; // Error!
 	}
 
+	// Draw the batched primitives into the render target they were recorded for
+	FlushDrawHelpers();
+
 	if (m_cCurrentSurface.GetSurface())
 		UnmakeSurfaceCurrent(*m_cCurrentSurface.GetSurface());
 	m_cCurrentSurface.SetSurface(pSurface);
@@ -642,8 +647,12 @@ bool Renderer::SetTextureBuffer(int nStage, PLRenderer::TextureBuffer *pTextureB
 			return false; // Error!
 
 		// Is this texture buffer already set?
-		if (m_ppCurrentTextureBuffer[nStage] == pTextureBuffer)
-			return false; // Error!
+		if (m_ppCurrentTextureBuffer[nStage] == pTextureBuffer) {
+			m_sStatistics.nTextureBufferFiltered++;
+
+			// Error!
+			return false;
+		}
 
 		// Make this texture buffer to the renderers current one
 		PLRenderer::TextureBuffer *pT = m_ppCurrentTextureBuffer[nStage];
@@ -669,12 +678,17 @@ bool Renderer::SetTextureBuffer(int nStage, PLRenderer::TextureBuffer *pTextureB
 bool Renderer::SetIndexBuffer(PLRenderer::IndexBuffer *pIndexBuffer)
 {
 	// Is this index buffer already set?
-	if (m_pCurrentIndexBuffer == pIndexBuffer)
-		return false; // Error!
+	if (m_pCurrentIndexBuffer == pIndexBuffer) {
+		m_sStatistics.nIndexBufferFiltered++;
+
+		// Error!
+		return false;
+	}
 
 	// Make this index buffer to the renderers current one
 	PLRenderer::IndexBuffer *pT = m_pCurrentIndexBuffer;
 	m_pCurrentIndexBuffer = pIndexBuffer;
+	m_sStatistics.nIndexBufferBinds++;
 
 	// Should an index buffer be set?
 	if (pIndexBuffer) {
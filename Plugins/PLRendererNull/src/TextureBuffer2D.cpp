@@ -25,7 +25,9 @@
 //[-------------------------------------------------------]
 //[ Includes                                              ]
 //[-------------------------------------------------------]
+#include <PLMath/Math.h>
 #include <PLGraphics/Image/Image.h>
+#include <PLGraphics/Image/ImagePart.h>
 #include <PLGraphics/Image/ImageBuffer.h>
 #include <PLRenderer/Renderer/Backend/RendererBackend.h>
 #include "PLRendererNull/TextureBuffer2D.h"
@@ -51,6 +53,7 @@ TextureBuffer2D::~TextureBuffer2D()
 {
 	// Update renderer statistics
 	static_cast<PLRenderer::RendererBackend&>(GetRenderer()).GetWritableStatistics().nTextureBuffersNum--;
+	static_cast<PLRenderer::RendererBackend&>(GetRenderer()).GetWritableStatistics().nTextureBuffersMem -= GetTotalNumOfBytes();
 }
 
 
@@ -74,6 +77,20 @@ TextureBuffer2D::TextureBuffer2D(PLRenderer::Renderer &cRenderer, Image &cImage,
 		m_vSize.x = pImageBuffer->GetSize().x;
 		m_vSize.y = pImageBuffer->GetSize().y;
 		m_nFormat = (nInternalFormat == Unknown) ? GetFormatFromImage(cImage) : nInternalFormat;
+
+		// Get the number of mipmaps the same way a real renderer would create them
+		if (nFlags & Mipmaps) {
+			m_nNumOfMipmaps = cImage.GetPart(0)->GetNumOfMipmaps() - 1;
+			if (!m_nNumOfMipmaps)
+				m_nNumOfMipmaps = static_cast<uint32>(Math::Log2(static_cast<float>(Math::Max(m_vSize.x, m_vSize.y))));
+		}
+
+		// Calculate the total number of bytes this texture buffer would require
+		for (uint32 nLevel=0; nLevel<=m_nNumOfMipmaps; nLevel++)
+			m_nTotalNumOfBytes += GetNumOfBytes(nLevel);
+
+		// Update renderer statistics
+		static_cast<PLRenderer::RendererBackend&>(cRenderer).GetWritableStatistics().nTextureBuffersMem += GetTotalNumOfBytes();
 	}
 }
 
@@ -90,6 +107,12 @@ TextureBuffer2D::TextureBuffer2D(PLRenderer::Renderer &cRenderer, const Vector2i
 	// Init data
 	m_vSize   = vSize;
 	m_nFormat = nInternalFormat;
+
+	// Calculate the total number of bytes this texture buffer would require
+	m_nTotalNumOfBytes = GetNumOfBytes();
+
+	// Update renderer statistics
+	static_cast<PLRenderer::RendererBackend&>(cRenderer).GetWritableStatistics().nTextureBuffersMem += GetTotalNumOfBytes();
 }
 
 
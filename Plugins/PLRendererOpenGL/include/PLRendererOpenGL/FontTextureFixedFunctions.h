@@ -71,6 +71,7 @@ class FontTextureFixedFunctions : public FontTexture {
 	//[-------------------------------------------------------]
 	public:
 		virtual void Draw(const PLCore::String &sText, const PLGraphics::Color4 &cColor, const PLMath::Matrix4x4 &mObjectSpaceToClipSpace, const PLMath::Vector2 &vScale = PLMath::Vector2::One, const PLMath::Vector2 &vBias = PLMath::Vector2::Zero, PLCore::uint32 nFlags = 0) override;
+		virtual bool AddGlyphVertices(PLCore::Array<GlyphVertex> &lstVertices, const PLCore::String &sText, const PLGraphics::Color4 &cColor, const PLMath::Matrix4x4 &mObjectSpaceToClipSpace, const PLMath::Vector2 &vScale = PLMath::Vector2::One, const PLMath::Vector2 &vBias = PLMath::Vector2::Zero, PLCore::uint32 nFlags = 0) override;
 
 
 	//[-------------------------------------------------------]
@@ -196,6 +196,8 @@ class ProgramGLSL : public Program {
 		virtual bool SetFragmentShader(PLRenderer::FragmentShader *pFragmentShader) override;
 		virtual bool IsValid() override;
 		virtual PLCore::String GetCompiledProgram() override;
+		virtual bool GetProgramBinary(PLCore::uint32 &nFormat, PLCore::Array<PLCore::uint8> &lstBinary) override;
+		virtual bool SetProgramBinary(PLCore::uint32 nFormat, const PLCore::uint8 *pnBinary, PLCore::uint32 nNumOfBytes) override;
 		virtual const PLCore::Array<PLRenderer::ProgramAttribute*> &GetAttributes() override;
 		virtual PLRenderer::ProgramAttribute *GetAttribute(const PLCore::String &sName) override;
 		virtual const PLCore::Array<PLRenderer::ProgramUniform*> &GetUniforms() override;
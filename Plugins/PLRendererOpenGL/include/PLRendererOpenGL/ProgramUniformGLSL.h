@@ -33,6 +33,14 @@
 #include "PLRendererOpenGL/ProgramUniform.h"
 
 
+//[-------------------------------------------------------]
+//[ Forward declarations                                  ]
+//[-------------------------------------------------------]
+namespace PLRendererOpenGL {
+	class Renderer;
+}
+
+
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
 //[-------------------------------------------------------]
@@ -70,6 +78,8 @@ class ProgramUniformGLSL : public ProgramUniform {
 		*  @brief
 		*    Constructor
 		*
+		*  @param[in] cRenderer
+		*    Owner renderer
 		*  @param[in] nOpenGLProgram
 		*    OpenGL program, must be valid!
 		*  @param[in] nOpenGLUniformLocation
@@ -77,7 +87,7 @@ class ProgramUniformGLSL : public ProgramUniform {
 		*  @param[in] nTextureUnit
 		*    Texture unit assigned to this uniform (for sampler uniforms), negative if not assigned to any texture unit
 		*/
-		ProgramUniformGLSL(GLuint nOpenGLProgram, int nOpenGLUniformLocation, int nTextureUnit);
+		ProgramUniformGLSL(Renderer &cRenderer, GLuint nOpenGLProgram, int nOpenGLUniformLocation, int nTextureUnit);
 
 		/**
 		*  @brief
@@ -85,14 +95,29 @@ class ProgramUniformGLSL : public ProgramUniform {
 		*/
 		virtual ~ProgramUniformGLSL();
 
+		/**
+		*  @brief
+		*    Updates the cached uniform value and the renderer statistics
+		*
+		*  @param[in] pData
+		*    Uniform value, must be valid
+		*  @param[in] nSize
+		*    Size of the uniform value in bytes
+		*
+		*  @return
+		*    'true' if the value must be passed to OpenGL, 'false' if the change is redundant
+		*/
+		bool UpdateValue(const void *pData, PLCore::uint32 nSize);
+
 
 	//[-------------------------------------------------------]
 	//[ Private functions                                     ]
 	//[-------------------------------------------------------]
 	private:
-		GLuint m_nOpenGLProgram;			/**< OpenGL program, always valid! */
-		int    m_nOpenGLUniformLocation;	/**< OpenGL uniform location, always valid! */
-		int    m_nTextureUnit;				/**< Texture unit assigned to this uniform (for sampler uniforms), negative if not assigned to any texture unit */
+		Renderer *m_pRenderer;				/**< Owner renderer, always valid! */
+		GLuint    m_nOpenGLProgram;			/**< OpenGL program, always valid! */
+		int       m_nOpenGLUniformLocation;	/**< OpenGL uniform location, always valid! */
+		int       m_nTextureUnit;				/**< Texture unit assigned to this uniform (for sampler uniforms), negative if not assigned to any texture unit */
 
 
 	//[-------------------------------------------------------]
@@ -1450,7 +1450,7 @@ bool FixedFunctions::SetVertexBuffer(PLRenderer::VertexBuffer *pVertexBuffer, ui
 							1,								// Weights are vertex attribute 1
 							cAttribute.nComponentsAPI,
 							cAttribute.nTypeAPI,
-							GL_FALSE,						// Normalization disabled
+							cAttribute.bNormalizedAPI ? GL_TRUE : GL_FALSE,	// Normalization of normalized integer types
 							nVertexSize,
 							BUFFER_OFFSET(cAttribute.nOffset));
 						glEnableVertexAttribArrayARB(1);
@@ -1480,7 +1480,7 @@ bool FixedFunctions::SetVertexBuffer(PLRenderer::VertexBuffer *pVertexBuffer, ui
 							5,								// Fog coordinates are vertex attribute 5
 							cAttribute.nComponentsAPI,
 							cAttribute.nTypeAPI,
-							GL_FALSE,						// Normalization disabled
+							cAttribute.bNormalizedAPI ? GL_TRUE : GL_FALSE,	// Normalization of normalized integer types
 							nVertexSize,
 							BUFFER_OFFSET(cAttribute.nOffset));
 						glEnableVertexAttribArrayARB(5);
@@ -1498,7 +1498,7 @@ bool FixedFunctions::SetVertexBuffer(PLRenderer::VertexBuffer *pVertexBuffer, ui
 							6,								// Point sprite size are vertex attribute 6
 							cAttribute.nComponentsAPI,
 							cAttribute.nTypeAPI,
-							GL_FALSE,						// Normalization disabled
+							cAttribute.bNormalizedAPI ? GL_TRUE : GL_FALSE,	// Normalization of normalized integer types
 							nVertexSize,
 							BUFFER_OFFSET(cAttribute.nOffset));
 						glEnableVertexAttribArrayARB(6);
@@ -1511,7 +1511,7 @@ bool FixedFunctions::SetVertexBuffer(PLRenderer::VertexBuffer *pVertexBuffer, ui
 							7,								// Matrix indices are vertex attribute 7
 							cAttribute.nComponentsAPI,
 							cAttribute.nTypeAPI,
-							GL_FALSE,						// Normalization disabled
+							cAttribute.bNormalizedAPI ? GL_TRUE : GL_FALSE,	// Normalization of normalized integer types
 							nVertexSize,
 							BUFFER_OFFSET(cAttribute.nOffset));
 						glEnableVertexAttribArrayARB(7);
@@ -1547,7 +1547,7 @@ bool FixedFunctions::SetVertexBuffer(PLRenderer::VertexBuffer *pVertexBuffer, ui
 							14,								// Tangent are vertex attribute 14
 							cAttribute.nComponentsAPI,
 							cAttribute.nTypeAPI,
-							GL_FALSE,						// Normalization disabled
+							cAttribute.bNormalizedAPI ? GL_TRUE : GL_FALSE,	// Normalization of normalized integer types
 							nVertexSize,
 							BUFFER_OFFSET(cAttribute.nOffset));
 						glEnableVertexAttribArrayARB(14);
@@ -1560,7 +1560,7 @@ bool FixedFunctions::SetVertexBuffer(PLRenderer::VertexBuffer *pVertexBuffer, ui
 							15,								// Binormal are vertex attribute 15
 							cAttribute.nComponentsAPI,
 							cAttribute.nTypeAPI,
-							GL_FALSE,						// Normalization disabled
+							cAttribute.bNormalizedAPI ? GL_TRUE : GL_FALSE,	// Normalization of normalized integer types
 							nVertexSize,
 							BUFFER_OFFSET(cAttribute.nOffset));
 						glEnableVertexAttribArrayARB(15);
@@ -86,3 +86,59 @@ FS_OUTPUT main(VS_OUTPUT In,	// Vertex shader or geometry shader output as fragm
 	// Done\n\
 	return Out;\n\
 }";
+
+
+// Cg vertex shader source code for batched text rendering
+static const PLCore::String sBatchVertexShaderSourceCodeCg = "\
+// Vertex output\n\
+struct VS_OUTPUT {\n\
+	float4 Position : POSITION;		// Clip space vertex position, lower/left is (-1,-1) and upper/right is (1,1)\n\
+	float2 TexCoord : TEXCOORD0;	// Vertex texture coordinate\n\
+	float4 Color    : COLOR;		// Vertex color\n\
+};\n\
+\n\
+// Programs\n\
+VS_OUTPUT main(float4 VertexPosition : POSITION,	// Clip space vertex position input, lower/left is (-1,-1) and upper/right is (1,1)\n\
+			   float2 VertexTexCoord : TEXCOORD0,	// Normalized vertex texture coordinate input\n\
+			   float4 VertexColor    : COLOR)		// Vertex color input\n\
+{\n\
+	VS_OUTPUT Out;\n\
+\n\
+	// The vertex position is already in clip space\n\
+	Out.Position = VertexPosition;\n\
+\n\
+	// Pass through the normalized vertex texture coordinate and the vertex color\n\
+	Out.TexCoord = VertexTexCoord;\n\
+	Out.Color    = VertexColor;\n\
+\n\
+	// Done\n\
+	return Out;\n\
+}";
+
+
+// Cg fragment shader source code for batched text rendering
+static const PLCore::String sBatchFragmentShaderSourceCodeCg = "\
+// Vertex output\n\
+struct VS_OUTPUT {\n\
+	float4 Position : POSITION;		// Clip space vertex position, lower/left is (-1,-1) and upper/right is (1,1)\n\
+	float2 TexCoord : TEXCOORD0;	// Vertex texture coordinate\n\
+	float4 Color    : COLOR;		// Vertex color\n\
+};\n\
+\n\
+// Fragment output\n\
+struct FS_OUTPUT {\n\
+	float4 Color0 : COLOR0;\n\
+};\n\
+\n\
+// Programs\n\
+FS_OUTPUT main(VS_OUTPUT In,	// Vertex shader or geometry shader output as fragment shader input\n\
+	uniform sampler2D GlyphMap	// Glyph atlas texture map\n\
+)\n\
+{\n\
+	FS_OUTPUT Out;\n\
+\n\
+	Out.Color0 = float4(In.Color.r, In.Color.g, In.Color.b, tex2D(GlyphMap, In.TexCoord).a*In.Color.a);\n\
+\n\
+	// Done\n\
+	return Out;\n\
+}";
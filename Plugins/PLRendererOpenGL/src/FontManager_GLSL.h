@@ -68,3 +68,40 @@ void main()\n\
 {\n\
 	gl_FragColor = vec4(Color.r, Color.g, Color.b, texture2D(GlyphMap, VertexTexCoordVS).a*Color.a);\n\
 }";
+
+
+// OpenGL 2.0 ("#version 110") GLSL vertex shader source code for batched text rendering, "#version" is added by "PLRenderer::ProgramGenerator"
+static const PLCore::String sBatchVertexShaderSourceCodeGLSL = "\
+// Attributes\n\
+attribute vec4 VertexPosition;		// Clip space vertex position input, lower/left is (-1,-1) and upper/right is (1,1)\n\
+attribute vec2 VertexTexCoord;		// Normalized vertex texture coordinate input\n\
+attribute vec4 VertexColor;			// Vertex color input\n\
+varying   vec2 VertexTexCoordVS;	// Normalized vertex texture coordinate output\n\
+varying   vec4 VertexColorVS;		// Vertex color output\n\
+\n\
+// Programs\n\
+void main()\n\
+{\n\
+	// The vertex position is already in clip space\n\
+	gl_Position = VertexPosition;\n\
+\n\
+	// Pass through the normalized vertex texture coordinate and the vertex color\n\
+	VertexTexCoordVS = VertexTexCoord;\n\
+	VertexColorVS    = VertexColor;\n\
+}";
+
+
+// OpenGL 2.0 ("#version 110") GLSL fragment shader source code for batched text rendering, "#version" is added by "PLRenderer::ProgramGenerator"
+static const PLCore::String sBatchFragmentShaderSourceCodeGLSL = "\
+// Attributes\n\
+varying vec2 VertexTexCoordVS;	// Interpolated vertex texture coordinate from vertex shader\n\
+varying vec4 VertexColorVS;		// Interpolated vertex color from vertex shader\n\
+\n\
+// Uniforms\n\
+uniform sampler2D GlyphMap;	// Glyph atlas texture map\n\
+\n\
+// Programs\n\
+void main()\n\
+{\n\
+	gl_FragColor = vec4(VertexColorVS.r, VertexColorVS.g, VertexColorVS.b, texture2D(GlyphMap, VertexTexCoordVS).a*VertexColorVS.a);\n\
+}";
@@ -54,9 +54,18 @@ namespace PLRendererOpenGL {
 */
 FontTexture::~FontTexture()
 {
+	// Remove the glyphs of this font from the glyph atlas, this waits for a running rasterization
+	RemoveGlyphsFromAtlas();
+
 	// Destroy the glyph texture atlas
 	DestroyGlyphTextureAtlas();
 
+	// Destroy the FreeType library rasterizer face
+	if (m_pFTRasterizerFace) {
+		FT_Done_Face(*m_pFTRasterizerFace);
+		delete m_pFTRasterizerFace;
+	}
+
 	// Destroy the FreeType library face
 	if (m_pFTFace) {
 		FT_Done_Face(*m_pFTFace);
@@ -138,14 +147,47 @@ float FontTexture::GetHeight() const
 	return m_pFTFace ? static_cast<float>((*m_pFTFace)->size->metrics.height)/64.0f : 0.0f;
 }
 
-float FontTexture::GetTextWidth(const String &sText)
+
+//[-------------------------------------------------------]
+//[ Protected virtual PLRenderer::FontTexture functions   ]
+//[-------------------------------------------------------]
+bool FontTexture::RasterizeGlyph(uint32 nSize, uint32 nResolution, uint32 nCharacterCode, PLRenderer::GlyphAtlas::Bitmap &sBitmap)
 {
-	// Create glyph texture atlas if required
-	if (!m_nOpenGLGlyphTextureAtlas)
-		CreateGlyphTextureAtlas();
+	// The glyph atlas may call this method from its rasterization thread, so the rasterizer face
+	// is used which is never touched by anything else while the glyph atlas knows this font
+	if (!m_pFTRasterizerFace)
+		return false; // Error!
+	FT_Face pFTFace = *m_pFTRasterizerFace;
+
+	// Set the requested font size (the FreeType library measures font size in terms of 1/64ths of pixels, so we have to adjust with *64)
+	if (m_nRasterizerSize != nSize || m_nRasterizerResolution != nResolution) {
+		if (FT_Set_Char_Size(pFTFace, 0L, nSize*64, nResolution, nResolution))
+			return false; // Error!
+		m_nRasterizerSize       = nSize;
+		m_nRasterizerResolution = nResolution;
+	}
 
-	// Let the base implementation to the rest of the job
-	return m_nOpenGLGlyphTextureAtlas ? PLRenderer::FontTexture::GetTextWidth(sText) : 0.0f;
+	// Load and render the glyph, characters without a glyph within the font result in the "missing glyph" of the font
+	if (FT_Load_Glyph(pFTFace, FT_Get_Char_Index(pFTFace, nCharacterCode), FT_LOAD_RENDER))
+		return false; // Error!
+	const FT_GlyphSlot pFTGlyphSlot = pFTFace->glyph;
+	const FT_Bitmap   &sFTBitmap    = pFTGlyphSlot->bitmap;
+
+	// Copy the glyph bitmap row by row, the pitch may differ from the width
+	if (sFTBitmap.width && sFTBitmap.rows && sFTBitmap.buffer) {
+		sBitmap.vSize.Set(sFTBitmap.width, sFTBitmap.rows);
+		sBitmap.pnData = new uint8[sFTBitmap.width*sFTBitmap.rows];
+		for (int nRow=0; nRow<static_cast<int>(sFTBitmap.rows); nRow++)
+			MemoryManager::Copy(&sBitmap.pnData[nRow*sFTBitmap.width], &sFTBitmap.buffer[nRow*sFTBitmap.pitch], sFTBitmap.width);
+	}
+
+	// Set the distance from the origin to the lower left corner of the glyph and the pen advance
+	// (the FreeType library measures the advance in terms of 1/64ths of pixels, so we have to adjust with /64)
+	sBitmap.vCorner.SetXY(static_cast<float>(pFTGlyphSlot->bitmap_left), static_cast<float>(pFTGlyphSlot->bitmap_top - static_cast<int>(sFTBitmap.rows)));
+	sBitmap.vPenAdvance.SetXY(static_cast<float>(pFTGlyphSlot->advance.x)/64.0f, static_cast<float>(pFTGlyphSlot->advance.y)/64.0f);
+
+	// Done
+	return true;
 }
 
 
@@ -160,6 +202,9 @@ FontTexture::FontTexture(FontManager &cFontManager, File &cFile) : PLRenderer::F
 	m_nFontFileSize(cFile.GetSize()),
 	m_pFontFileData(new uint8[m_nFontFileSize]),
 	m_pFTFace(nullptr),
+	m_pFTRasterizerFace(nullptr),
+	m_nRasterizerSize(0),
+	m_nRasterizerResolution(0),
 	m_nGlyphTextureAtlasPadding(3),
 	m_nOpenGLGlyphTextureAtlas(0)
 {
@@ -173,6 +218,15 @@ FontTexture::FontTexture(FontManager &cFontManager, File &cFile) : PLRenderer::F
 		delete m_pFTFace;
 		m_pFTFace = nullptr;
 	}
+
+	// Create a second FreeType library face on the same data for the glyph atlas, this way the glyph atlas is able
+	// to rasterize glyphs within its rasterization thread without getting in the way of the face above
+	m_pFTRasterizerFace = new FT_Face;
+	if (FT_New_Memory_Face(*cFontManager.GetFTLibrary(), static_cast<FT_Byte const*>(m_pFontFileData), static_cast<FT_Long>(m_nFontFileSize), 0, m_pFTRasterizerFace)) {
+		// Error!
+		delete m_pFTRasterizerFace;
+		m_pFTRasterizerFace = nullptr;
+	}
 }
 
 /**
@@ -60,6 +60,12 @@ void FontTextureFixedFunctions::Draw(const String &sText, const Color4 &cColor,
 	// [TODO] Implement me using display lists
 }
 
+bool FontTextureFixedFunctions::AddGlyphVertices(Array<GlyphVertex> &lstVertices, const String &sText, const Color4 &cColor, const Matrix4x4 &mObjectSpaceToClipSpace, const Vector2 &vScale, const Vector2 &vBias, uint32 nFlags)
+{
+	// There's no program to draw glyph atlas pages with, so batched text rendering is not supported
+	return false;
+}
+
 
 //[-------------------------------------------------------]
 //[ Private functions                                     ]
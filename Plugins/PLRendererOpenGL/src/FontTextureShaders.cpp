@@ -25,8 +25,11 @@
 //[-------------------------------------------------------]
 //[ Includes                                              ]
 //[-------------------------------------------------------]
+#include <PLCore/Core/MemoryManager.h>
 #include <PLRenderer/Renderer/Program.h>
 #include <PLRenderer/Renderer/ProgramUniform.h>
+#include <PLRenderer/Renderer/VertexBuffer.h>
+#include <PLRenderer/Renderer/TextureBuffer2D.h>
 #include "PLRendererOpenGL/Renderer.h"
 #include "PLRendererOpenGL/FontManager.h"
 #include "PLRendererOpenGL/ProgramUniform.h"
@@ -130,6 +133,50 @@ void FontTextureShaders::Draw(const String &sText, const Color4 &cColor, const M
 }
 
 
+void FontTextureShaders::DrawGlyphVertices(const Array<GlyphVertex> &lstVertices, uint32 nFlags)
+{
+	// Anything to draw?
+	const uint32 nNumOfVertices = lstVertices.GetNumOfElements();
+	if (nNumOfVertices) {
+		// Get the vertex buffer for batched text rendering and copy the glyph vertices into it
+		FontManager &cFontManager = static_cast<FontManager&>(*m_pFontManager);
+		PLRenderer::VertexBuffer *pVertexBuffer = cFontManager.GetBatchVertexBuffer(nNumOfVertices);
+		if (pVertexBuffer && pVertexBuffer->GetVertexSize() == sizeof(GlyphVertex) && pVertexBuffer->Lock(PLRenderer::Lock::WriteOnly)) {
+			MemoryManager::Copy(pVertexBuffer->GetData(), lstVertices.GetData(), nNumOfVertices*sizeof(GlyphVertex));
+			pVertexBuffer->Unlock();
+
+			// Get and set the program for batched text rendering
+			FontManager::GeneratedBatchProgramUserData *pGeneratedBatchProgramUserData = nullptr;
+			PLRenderer::Program *pProgram = cFontManager.GetBatchProgram(&pGeneratedBatchProgramUserData);
+			if (pProgram && pGeneratedBatchProgramUserData && pGeneratedBatchProgramUserData->pGlyphMap && cFontManager.GetRenderer().SetProgram(pProgram)) {
+				// Draw the glyph quads, one draw call per used glyph atlas page
+				PLRenderer::GlyphAtlas &cGlyphAtlas = cFontManager.GetGlyphAtlas();
+				uint32 nVertex = 0;
+				uint32 nPage = 0;
+				uint32 nNumOfPageVertices = GetGlyphPageRun(lstVertices, nVertex, nPage);
+				while (nNumOfPageVertices) {
+					// Set the glyph atlas page
+					PLRenderer::TextureBuffer2D *pPage = cGlyphAtlas.GetPageTextureBuffer(nPage);
+					if (pPage && pGeneratedBatchProgramUserData->pGlyphMap->Set(pPage) >= 0) {
+						// The integer part of the u texture coordinate is the page index, repeat makes it vanish, there are
+						// no mipmaps so the "Mipmapping"-flag is ignored (ProgramUniform::Set() left the page bound)
+						glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S,     GL_REPEAT);
+						glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+
+						// Draw all glyph quads of this page at once
+						cFontManager.GetRenderer().DrawPrimitives(PLRenderer::Primitive::TriangleList, nVertex, nNumOfPageVertices);
+					}
+
+					// Next page run, please
+					nVertex += nNumOfPageVertices;
+					nNumOfPageVertices = GetGlyphPageRun(lstVertices, nVertex, nPage);
+				}
+			}
+		}
+	}
+}
+
+
 //[-------------------------------------------------------]
 //[ Private functions                                     ]
 //[-------------------------------------------------------]
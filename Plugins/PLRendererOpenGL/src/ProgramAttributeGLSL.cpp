@@ -72,7 +72,7 @@ bool ProgramAttributeGLSL::Set(PLRenderer::VertexBuffer *pVertexBuffer, uint32 n
 			static_cast<PLRendererOpenGL::VertexBuffer*>(pVertexBuffer)->BindAndUpdate();
 
 			// Create the connection between "vertex program attribute" and "vertex buffer attribute"
-			glVertexAttribPointerARB(m_nOpenGLAttributeLocation, pVertexAttribute->nComponentsAPI, pVertexAttribute->nTypeAPI, GL_FALSE, pVertexBuffer->GetVertexSize(), reinterpret_cast<const void*>(pVertexAttribute->nOffset));
+			glVertexAttribPointerARB(m_nOpenGLAttributeLocation, pVertexAttribute->nComponentsAPI, pVertexAttribute->nTypeAPI, pVertexAttribute->bNormalizedAPI ? GL_TRUE : GL_FALSE, pVertexBuffer->GetVertexSize(), reinterpret_cast<const void*>(pVertexAttribute->nOffset));
 
 			// Enable vertex attribute array (OpenGL program independent, so we don't need to call glUseProgram first!)
 			glEnableVertexAttribArrayARB(m_nOpenGLAttributeLocation);
@@ -100,7 +100,7 @@ bool ProgramAttributeGLSL::Set(PLRenderer::VertexBuffer *pVertexBuffer, PLRender
 			static_cast<PLRendererOpenGL::VertexBuffer*>(pVertexBuffer)->BindAndUpdate();
 
 			// Create the connection between "vertex program attribute" and "vertex buffer attribute"
-			glVertexAttribPointerARB(m_nOpenGLAttributeLocation, pVertexAttribute->nComponentsAPI, pVertexAttribute->nTypeAPI, GL_FALSE, pVertexBuffer->GetVertexSize(), reinterpret_cast<const void*>(pVertexAttribute->nOffset));
+			glVertexAttribPointerARB(m_nOpenGLAttributeLocation, pVertexAttribute->nComponentsAPI, pVertexAttribute->nTypeAPI, pVertexAttribute->bNormalizedAPI ? GL_TRUE : GL_FALSE, pVertexBuffer->GetVertexSize(), reinterpret_cast<const void*>(pVertexAttribute->nOffset));
 
 			// Enable vertex attribute array (OpenGL program independent, so we don't need to call glUseProgram first!)
 			glEnableVertexAttribArrayARB(m_nOpenGLAttributeLocation);
@@ -326,7 +326,7 @@ void ProgramGLSL::BuildUniformInformation()
 							}
 
 							// Create a new program uniform instance
-							ProgramUniformGLSL *pProgramUniform = new ProgramUniformGLSL(nOpenGLProgram, nOpenGLUniformLocation, nTextureUnit);
+							ProgramUniformGLSL *pProgramUniform = new ProgramUniformGLSL(static_cast<Renderer&>(GetRenderer()), nOpenGLProgram, nOpenGLUniformLocation, nTextureUnit);
 
 							// Register the new program uniform
 							m_lstUniforms.Add(pProgramUniform);
@@ -744,6 +744,62 @@ String ProgramGLSL::GetCompiledProgram()
 	return "";
 }
 
+bool ProgramGLSL::GetProgramBinary(uint32 &nFormat, Array<uint8> &lstBinary)
+{
+	// GL_ARB_get_program_binary extension required
+	if (static_cast<Renderer&>(GetRenderer()).GetContext().GetExtensions().IsGL_ARB_get_program_binary()) {
+		// Get the OpenGL program - this also ensures that the program is linked
+		const GLuint nOpenGLProgram = GetOpenGLProgram();
+
+		// Is the OpenGL program linked?
+		if (IsLinked()) {
+			// Retrieve the binary length from the program object
+			GLint nBinaryLength = 0;
+			glGetObjectParameterivARB(nOpenGLProgram, GL_PROGRAM_BINARY_LENGTH, &nBinaryLength);
+			if (nBinaryLength > 0) {
+				// Retrieve the binary and its format from the program object
+				lstBinary.Resize(nBinaryLength);
+				GLenum nBinaryFormat = 0;
+				GLsizei nWritten = 0;
+				glGetProgramBinary(nOpenGLProgram, nBinaryLength, &nWritten, &nBinaryFormat, lstBinary.GetData());
+				if (nWritten > 0) {
+					lstBinary.Resize(nWritten);
+					nFormat = nBinaryFormat;
+
+					// Done
+					return true;
+				}
+			}
+		}
+	}
+
+	// Error!
+	return false;
+}
+
+bool ProgramGLSL::SetProgramBinary(uint32 nFormat, const uint8 *pnBinary, uint32 nNumOfBytes)
+{
+	// GL_ARB_get_program_binary extension required
+	if (!m_bLinked && pnBinary && nNumOfBytes && static_cast<Renderer&>(GetRenderer()).GetContext().GetExtensions().IsGL_ARB_get_program_binary()) {
+		// Load the binary, the driver may reject it, for example after a driver update
+		glProgramBinary(m_nOpenGLProgram, nFormat, pnBinary, nNumOfBytes);
+
+		// Check the link status
+		GLint nLinked = GL_FALSE;
+		glGetObjectParameterivARB(m_nOpenGLProgram, GL_OBJECT_LINK_STATUS_ARB, &nLinked);
+		if (nLinked == GL_TRUE) {
+			// Congratulations, the program is now linked! The shaders are only attached when a relink is required.
+			m_bLinked = true;
+
+			// Done
+			return true;
+		}
+	}
+
+	// Error! The program is going to be linked by using the shader source codes as usual.
+	return false;
+}
+
 const Array<PLRenderer::ProgramAttribute*> &ProgramGLSL::GetAttributes()
 {
 	// Build the attribute information, if required
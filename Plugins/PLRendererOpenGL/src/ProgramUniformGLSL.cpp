@@ -79,7 +79,8 @@ int ProgramUniformGLSL::Set(GLenum nOpenGLTextureTarget, GLuint nOpenGLTexture)
 *  @brief
 *    Constructor
 */
-ProgramUniformGLSL::ProgramUniformGLSL(GLuint nOpenGLProgram, int nOpenGLUniformLocation, int nTextureUnit) :
+ProgramUniformGLSL::ProgramUniformGLSL(Renderer &cRenderer, GLuint nOpenGLProgram, int nOpenGLUniformLocation, int nTextureUnit) :
+	m_pRenderer(&cRenderer),
 	m_nOpenGLProgram(nOpenGLProgram),
 	m_nOpenGLUniformLocation(nOpenGLUniformLocation),
 	m_nTextureUnit(nTextureUnit)
@@ -94,6 +95,25 @@ ProgramUniformGLSL::~ProgramUniformGLSL()
 {
 }
 
+/**
+*  @brief
+*    Updates the cached uniform value and the renderer statistics
+*/
+bool ProgramUniformGLSL::UpdateValue(const void *pData, PLCore::uint32 nSize)
+{
+	if (UpdateCache(pData, nSize)) {
+		m_pRenderer->GetWritableStatistics().nUniformChanges++;
+
+		// The value must be passed to OpenGL
+		return true;
+	} else {
+		m_pRenderer->GetWritableStatistics().nUniformFiltered++;
+
+		// The value is already set
+		return false;
+	}
+}
+
 
 //[-------------------------------------------------------]
 //[ Public virtual PLRenderer::ProgramUniform functions   ]
@@ -116,12 +136,14 @@ void ProgramUniformGLSL::Get(double &fX)
 
 void ProgramUniformGLSL::Set(int nX)
 {
-	glUniform1iARB(m_nOpenGLUniformLocation, nX);
+	if (UpdateValue(&nX, sizeof(nX)))
+		glUniform1iARB(m_nOpenGLUniformLocation, nX);
 }
 
 void ProgramUniformGLSL::Set(float fX)
 {
-	glUniform1fARB(m_nOpenGLUniformLocation, fX);
+	if (UpdateValue(&fX, sizeof(fX)))
+		glUniform1fARB(m_nOpenGLUniformLocation, fX);
 }
 
 void ProgramUniformGLSL::Set(double fX)
@@ -178,12 +200,16 @@ void ProgramUniformGLSL::Get2(double *pfComponents)
 
 void ProgramUniformGLSL::Set(int nX, int nY)
 {
-	glUniform2iARB(m_nOpenGLUniformLocation, nX, nY);
+	const int nValue[2] = { nX, nY };
+	if (UpdateValue(nValue, sizeof(nValue)))
+		glUniform2iARB(m_nOpenGLUniformLocation, nX, nY);
 }
 
 void ProgramUniformGLSL::Set(float fX, float fY)
 {
-	glUniform2fARB(m_nOpenGLUniformLocation, fX, fY);
+	const float fValue[2] = { fX, fY };
+	if (UpdateValue(fValue, sizeof(fValue)))
+		glUniform2fARB(m_nOpenGLUniformLocation, fX, fY);
 }
 
 void ProgramUniformGLSL::Set(double fX, double fY)
@@ -193,22 +219,26 @@ void ProgramUniformGLSL::Set(double fX, double fY)
 
 void ProgramUniformGLSL::Set(const Vector2i &vVector)
 {
-	glUniform2ivARB(m_nOpenGLUniformLocation, 1, vVector);
+	if (UpdateValue(static_cast<const int*>(vVector), sizeof(int)*2))
+		glUniform2ivARB(m_nOpenGLUniformLocation, 1, vVector);
 }
 
 void ProgramUniformGLSL::Set(const Vector2 &vVector)
 {
-	glUniform2fvARB(m_nOpenGLUniformLocation, 1, vVector);
+	if (UpdateValue(static_cast<const float*>(vVector), sizeof(float)*2))
+		glUniform2fvARB(m_nOpenGLUniformLocation, 1, vVector);
 }
 
 void ProgramUniformGLSL::Set2(const int *pnComponents)
 {
-	glUniform2ivARB(m_nOpenGLUniformLocation, 1, pnComponents);
+	if (UpdateValue(pnComponents, sizeof(int)*2))
+		glUniform2ivARB(m_nOpenGLUniformLocation, 1, pnComponents);
 }
 
 void ProgramUniformGLSL::Set2(const float *pfComponents)
 {
-	glUniform2fvARB(m_nOpenGLUniformLocation, 1, pfComponents);
+	if (UpdateValue(pfComponents, sizeof(float)*2))
+		glUniform2fvARB(m_nOpenGLUniformLocation, 1, pfComponents);
 }
 
 void ProgramUniformGLSL::Set2(const double *pfComponents)
@@ -272,12 +302,16 @@ void ProgramUniformGLSL::Get3(double *pfComponents)
 
 void ProgramUniformGLSL::Set(int nX, int nY, int nZ)
 {
-	glUniform3iARB(m_nOpenGLUniformLocation, nX, nY, nZ);
+	const int nValue[3] = { nX, nY, nZ };
+	if (UpdateValue(nValue, sizeof(nValue)))
+		glUniform3iARB(m_nOpenGLUniformLocation, nX, nY, nZ);
 }
 
 void ProgramUniformGLSL::Set(float fX, float fY, float fZ)
 {
-	glUniform3fARB(m_nOpenGLUniformLocation, fX, fY, fZ);
+	const float fValue[3] = { fX, fY, fZ };
+	if (UpdateValue(fValue, sizeof(fValue)))
+		glUniform3fARB(m_nOpenGLUniformLocation, fX, fY, fZ);
 }
 
 void ProgramUniformGLSL::Set(double fX, double fY, double fZ)
@@ -287,27 +321,32 @@ void ProgramUniformGLSL::Set(double fX, double fY, double fZ)
 
 void ProgramUniformGLSL::Set(const Vector3i &vVector)
 {
-	glUniform3ivARB(m_nOpenGLUniformLocation, 1, vVector);
+	if (UpdateValue(static_cast<const int*>(vVector), sizeof(int)*3))
+		glUniform3ivARB(m_nOpenGLUniformLocation, 1, vVector);
 }
 
 void ProgramUniformGLSL::Set(const Vector3 &vVector)
 {
-	glUniform3fvARB(m_nOpenGLUniformLocation, 1, vVector);
+	if (UpdateValue(static_cast<const float*>(vVector), sizeof(float)*3))
+		glUniform3fvARB(m_nOpenGLUniformLocation, 1, vVector);
 }
 
 void ProgramUniformGLSL::Set(const Color3 &cColor)
 {
-	glUniform3fvARB(m_nOpenGLUniformLocation, 1, cColor);
+	if (UpdateValue(static_cast<const float*>(cColor), sizeof(float)*3))
+		glUniform3fvARB(m_nOpenGLUniformLocation, 1, cColor);
 }
 
 void ProgramUniformGLSL::Set3(const int *pnComponents)
 {
-	glUniform3ivARB(m_nOpenGLUniformLocation, 1, pnComponents);
+	if (UpdateValue(pnComponents, sizeof(int)*3))
+		glUniform3ivARB(m_nOpenGLUniformLocation, 1, pnComponents);
 }
 
 void ProgramUniformGLSL::Set3(const float *pfComponents)
 {
-	glUniform3fvARB(m_nOpenGLUniformLocation, 1, pfComponents);
+	if (UpdateValue(pfComponents, sizeof(float)*3))
+		glUniform3fvARB(m_nOpenGLUniformLocation, 1, pfComponents);
 }
 
 void ProgramUniformGLSL::Set3(const double *pfComponents)
@@ -373,12 +412,16 @@ void ProgramUniformGLSL::Get4(double *pfComponents)
 
 void ProgramUniformGLSL::Set(int nX, int nY, int nZ, int nW)
 {
-	glUniform4iARB(m_nOpenGLUniformLocation, nX, nY, nZ, nW);
+	const int nValue[4] = { nX, nY, nZ, nW };
+	if (UpdateValue(nValue, sizeof(nValue)))
+		glUniform4iARB(m_nOpenGLUniformLocation, nX, nY, nZ, nW);
 }
 
 void ProgramUniformGLSL::Set(float fX, float fY, float fZ, float fW)
 {
-	glUniform4fARB(m_nOpenGLUniformLocation, fX, fY, fZ, fW);
+	const float fValue[4] = { fX, fY, fZ, fW };
+	if (UpdateValue(fValue, sizeof(fValue)))
+		glUniform4fARB(m_nOpenGLUniformLocation, fX, fY, fZ, fW);
 }
 
 void ProgramUniformGLSL::Set(double fX, double fY, double fZ, double fW)
@@ -388,27 +431,32 @@ void ProgramUniformGLSL::Set(double fX, double fY, double fZ, double fW)
 
 void ProgramUniformGLSL::Set(const Vector4 &vVector)
 {
-	glUniform4fvARB(m_nOpenGLUniformLocation, 1, vVector);
+	if (UpdateValue(static_cast<const float*>(vVector), sizeof(float)*4))
+		glUniform4fvARB(m_nOpenGLUniformLocation, 1, vVector);
 }
 
 void ProgramUniformGLSL::Set(const Color4 &cColor)
 {
-	glUniform4fvARB(m_nOpenGLUniformLocation, 1, cColor);
+	if (UpdateValue(static_cast<const float*>(cColor), sizeof(float)*4))
+		glUniform4fvARB(m_nOpenGLUniformLocation, 1, cColor);
 }
 
 void ProgramUniformGLSL::Set(const Quaternion &qQuaternion)
 {
-	glUniform4fvARB(m_nOpenGLUniformLocation, 1, qQuaternion);
+	if (UpdateValue(static_cast<const float*>(qQuaternion), sizeof(float)*4))
+		glUniform4fvARB(m_nOpenGLUniformLocation, 1, qQuaternion);
 }
 
 void ProgramUniformGLSL::Set4(const int *pnComponents)
 {
-	glUniform4ivARB(m_nOpenGLUniformLocation, 1, pnComponents);
+	if (UpdateValue(pnComponents, sizeof(int)*4))
+		glUniform4ivARB(m_nOpenGLUniformLocation, 1, pnComponents);
 }
 
 void ProgramUniformGLSL::Set4(const float *pfComponents)
 {
-	glUniform4fvARB(m_nOpenGLUniformLocation, 1, pfComponents);
+	if (UpdateValue(pfComponents, sizeof(float)*4))
+		glUniform4fvARB(m_nOpenGLUniformLocation, 1, pfComponents);
 }
 
 void ProgramUniformGLSL::Set4(const double *pfComponents)
@@ -429,12 +477,26 @@ void ProgramUniformGLSL::Get(Matrix4x4 &mMatrix)
 
 void ProgramUniformGLSL::Set(const Matrix3x3 &mMatrix, bool bTranspose)
 {
-	glUniformMatrix3fvARB(m_nOpenGLUniformLocation, 1, bTranspose, mMatrix);
+	// Only not transposed matrices are cached, else the cached value would be ambiguous
+	if (bTranspose) {
+		InvalidateCache();
+		m_pRenderer->GetWritableStatistics().nUniformChanges++;
+		glUniformMatrix3fvARB(m_nOpenGLUniformLocation, 1, GL_TRUE, mMatrix);
+	} else if (UpdateValue(static_cast<const float*>(mMatrix), sizeof(float)*9)) {
+		glUniformMatrix3fvARB(m_nOpenGLUniformLocation, 1, GL_FALSE, mMatrix);
+	}
 }
 
 void ProgramUniformGLSL::Set(const Matrix4x4 &mMatrix, bool bTranspose)
 {
-	glUniformMatrix4fvARB(m_nOpenGLUniformLocation, 1, bTranspose, mMatrix);
+	// Only not transposed matrices are cached, else the cached value would be ambiguous
+	if (bTranspose) {
+		InvalidateCache();
+		m_pRenderer->GetWritableStatistics().nUniformChanges++;
+		glUniformMatrix4fvARB(m_nOpenGLUniformLocation, 1, GL_TRUE, mMatrix);
+	} else if (UpdateValue(static_cast<const float*>(mMatrix), sizeof(float)*16)) {
+		glUniformMatrix4fvARB(m_nOpenGLUniformLocation, 1, GL_FALSE, mMatrix);
+	}
 }
 
 // Texture
@@ -81,32 +81,6 @@ class FontGlyphTexture : public PLRenderer::FontGlyphTexture {
 		*/
 		virtual ~FontGlyphTexture();
 
-		/**
-		*  @brief
-		*    Returns the normalized minimum glyph texture coordinate inside the glyph texture atlas
-		*
-		*  @return
-		*    The normalized minimum glyph texture coordinate inside the glyph texture atlas
-		*/
-		const PLMath::Vector2 &GetTexCoordMin() const;
-
-		/**
-		*  @brief
-		*    Returns the normalized maximum glyph texture coordinate inside the glyph texture atlas
-		*
-		*  @return
-		*    The normalized maximum glyph texture coordinate inside the glyph texture atlas
-		*/
-		const PLMath::Vector2 &GetTexCoordMax() const;
-
-
-	//[-------------------------------------------------------]
-	//[ Private functions                                     ]
-	//[-------------------------------------------------------]
-	private:
-		PLMath::Vector2 m_vTexCoordMin;	/**< Normalized minimum glyph texture coordinate inside the glyph texture atlas */
-		PLMath::Vector2 m_vTexCoordMax;	/**< Normalized maximum glyph texture coordinate inside the glyph texture atlas */
-
 
 };
 
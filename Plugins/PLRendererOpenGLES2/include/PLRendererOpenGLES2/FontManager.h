@@ -81,6 +81,19 @@ class FontManager : public PLRenderer::FontManagerBackend {
 			PLRenderer::ProgramUniform *pColor;
 		};
 
+		/**
+		*  @brief
+		*    Direct pointers to uniforms & attributes of a generated batched text rendering program
+		*/
+		struct GeneratedBatchProgramUserData {
+			// Vertex shader attributes
+			PLRenderer::ProgramAttribute *pVertexPosition;
+			PLRenderer::ProgramAttribute *pVertexTexCoord;
+			PLRenderer::ProgramAttribute *pVertexColor;
+			// Fragment shader uniforms
+			PLRenderer::ProgramUniform *pGlyphMap;
+		};
+
 
 	//[-------------------------------------------------------]
 	//[ Public functions                                      ]
@@ -126,6 +139,38 @@ class FontManager : public PLRenderer::FontManagerBackend {
 		*/
 		PLRenderer::Program *GetProgram(GeneratedProgramUserData **ppGeneratedProgramUserData = nullptr);
 
+		/**
+		*  @brief
+		*    Returns the vertex buffer used for batched text rendering
+		*
+		*  @param[in] nNumOfVertices
+		*    Minimum number of vertices the vertex buffer must be able to hold
+		*
+		*  @return
+		*    The vertex buffer used for batched text rendering, a null pointer on error
+		*
+		*  @note
+		*    - The layout of one vertex is identical to "PLRenderer::Font::GlyphVertex"
+		*    - The vertex buffer is reallocated if it's too small, previous content is lost in this case
+		*/
+		PLRenderer::VertexBuffer *GetBatchVertexBuffer(PLCore::uint32 nNumOfVertices);
+
+		/**
+		*  @brief
+		*    Returns the program for batched text rendering
+		*
+		*  @param[in] ppGeneratedBatchProgramUserData
+		*    If not a null pointer, this receives a pointer to an GeneratedBatchProgramUserData instance for fast direct uniform access
+		*
+		*  @return
+		*    The program for batched text rendering, can be a null pointer
+		*
+		*  @note
+		*    - The program is using the default shader language of the renderer
+		*    - The program has already proper vertex attributes set, they are connected to the vertex buffer returned by GetBatchVertexBuffer()
+		*/
+		PLRenderer::Program *GetBatchProgram(GeneratedBatchProgramUserData **ppGeneratedBatchProgramUserData = nullptr);
+
 
 	//[-------------------------------------------------------]
 	//[ Public virtual PLRenderer::FontManager functions      ]
@@ -152,10 +197,12 @@ class FontManager : public PLRenderer::FontManagerBackend {
 	//[ Private data                                          ]
 	//[-------------------------------------------------------]
 	private:
-		FT_Library							*m_pFTLibrary;			/**< FreeType library object, a null pointer on error (in case of an terrible error) */
-		PLRenderer::ProgramGenerator		*m_pProgramGenerator;	/**< Program generator, can be a null pointer */
-		PLRenderer::ProgramGenerator::Flags	 m_cProgramFlags;		/**< Program flags as class member to reduce dynamic memory allocations */
-		PLRenderer::VertexBuffer			*m_pVertexBuffer;		/**< Vertex buffer used for font rendering, can be a null pointer */
+		FT_Library							*m_pFTLibrary;				/**< FreeType library object, a null pointer on error (in case of an terrible error) */
+		PLRenderer::ProgramGenerator		*m_pProgramGenerator;		/**< Program generator, can be a null pointer */
+		PLRenderer::ProgramGenerator::Flags	 m_cProgramFlags;			/**< Program flags as class member to reduce dynamic memory allocations */
+		PLRenderer::VertexBuffer			*m_pVertexBuffer;			/**< Vertex buffer used for font rendering, can be a null pointer */
+		PLRenderer::ProgramGenerator		*m_pBatchProgramGenerator;	/**< Program generator for batched text rendering, can be a null pointer */
+		PLRenderer::VertexBuffer			*m_pBatchVertexBuffer;		/**< Vertex buffer used for batched text rendering, can be a null pointer */
 
 
 };
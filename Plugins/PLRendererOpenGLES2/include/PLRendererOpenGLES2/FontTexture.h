@@ -106,8 +106,15 @@ class FontTexture : public PLRenderer::FontTexture {
 		virtual float GetAscender() const override;
 		virtual float GetDescender() const override;
 		virtual float GetHeight() const override;
-		virtual float GetTextWidth(const PLCore::String &sText) override;
 		virtual void Draw(const PLCore::String &sText, const PLGraphics::Color4 &cColor, const PLMath::Matrix4x4 &mObjectSpaceToClipSpace, const PLMath::Vector2 &vScale = PLMath::Vector2::One, const PLMath::Vector2 &vBias = PLMath::Vector2::Zero, PLCore::uint32 nFlags = 0) override;
+		virtual void DrawGlyphVertices(const PLCore::Array<GlyphVertex> &lstVertices, PLCore::uint32 nFlags = 0) override;
+
+
+	//[-------------------------------------------------------]
+	//[ Protected virtual PLRenderer::FontTexture functions   ]
+	//[-------------------------------------------------------]
+	protected:
+		virtual bool RasterizeGlyph(PLCore::uint32 nSize, PLCore::uint32 nResolution, PLCore::uint32 nCharacterCode, PLRenderer::GlyphAtlas::Bitmap &sBitmap) override;
 
 
 	//[-------------------------------------------------------]
@@ -166,6 +173,9 @@ class FontTexture : public PLRenderer::FontTexture {
 		PLCore::uint32     m_nFontFileSize;					/**< Font file size in bytes */
 		PLCore::uint8  	  *m_pFontFileData;					/**< Font file data, can be a null pointer */
 		FT_Face			  *m_pFTFace;						/**< FreeType library face (aka "The Font"), a null pointer on error */
+		FT_Face			  *m_pFTRasterizerFace;				/**< FreeType library face used by the glyph atlas rasterization, a null pointer on error */
+		PLCore::uint32     m_nRasterizerSize;				/**< Font size the rasterizer face is currently set to */
+		PLCore::uint32     m_nRasterizerResolution;			/**< Font resolution the rasterizer face is currently set to */
 		PLCore::uint32     m_nGlyphTextureAtlasPadding;		/**< Glyph texture atlas gab between glyphs in pixel */
 		GLuint			   m_nOpenGLESGlyphTextureAtlas;	/**< OpenGL ES glyph texture atlas, can be null */
 		PLMath::Vector2i   m_vGlyphTextureAtlasSize;		/**< Glyph texture atlas size */
@@ -34,6 +34,14 @@
 #include "PLRendererOpenGLES2/Context.h"
 
 
+//[-------------------------------------------------------]
+//[ Forward declarations                                  ]
+//[-------------------------------------------------------]
+namespace PLRendererOpenGLES2 {
+	class Renderer;
+}
+
+
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
 //[-------------------------------------------------------]
@@ -83,6 +91,8 @@ class ProgramUniformGLSL : public PLRenderer::ProgramUniform {
 		*  @brief
 		*    Constructor
 		*
+		*  @param[in] cRenderer
+		*    Owner renderer
 		*  @param[in] nOpenGLESProgram
 		*    OpenGL ES program, must be valid!
 		*  @param[in] nOpenGLESUniformLocation
@@ -90,7 +100,7 @@ class ProgramUniformGLSL : public PLRenderer::ProgramUniform {
 		*  @param[in] nTextureUnit
 		*    Texture unit assigned to this uniform (for sampler uniforms), negative if not assigned to any texture unit
 		*/
-		ProgramUniformGLSL(GLuint nOpenGLESProgram, int nOpenGLESUniformLocation, int nTextureUnit);
+		ProgramUniformGLSL(Renderer &cRenderer, GLuint nOpenGLESProgram, int nOpenGLESUniformLocation, int nTextureUnit);
 
 		/**
 		*  @brief
@@ -98,14 +108,29 @@ class ProgramUniformGLSL : public PLRenderer::ProgramUniform {
 		*/
 		virtual ~ProgramUniformGLSL();
 
+		/**
+		*  @brief
+		*    Updates the cached uniform value and the renderer statistics
+		*
+		*  @param[in] pData
+		*    Uniform value, must be valid
+		*  @param[in] nSize
+		*    Size of the uniform value in bytes
+		*
+		*  @return
+		*    'true' if the value must be passed to OpenGL ES, 'false' if the change is redundant
+		*/
+		bool UpdateValue(const void *pData, PLCore::uint32 nSize);
+
 
 	//[-------------------------------------------------------]
 	//[ Private functions                                     ]
 	//[-------------------------------------------------------]
 	private:
-		GLuint m_nOpenGLESProgram;			/**< OpenGL ES program, always valid! */
-		int    m_nOpenGLESUniformLocation;	/**< OpenGL ES uniform location, always valid! */
-		int    m_nTextureUnit;				/**< Texture unit assigned to this uniform (for sampler uniforms), negative if not assigned to any texture unit */
+		Renderer *m_pRenderer;					/**< Owner renderer, always valid! */
+		GLuint    m_nOpenGLESProgram;			/**< OpenGL ES program, always valid! */
+		int       m_nOpenGLESUniformLocation;	/**< OpenGL ES uniform location, always valid! */
+		int       m_nTextureUnit;				/**< Texture unit assigned to this uniform (for sampler uniforms), negative if not assigned to any texture unit */
 
 
 	//[-------------------------------------------------------]
@@ -105,24 +105,6 @@ FontGlyphTexture::~FontGlyphTexture()
 {
 }
 
-/**
-*  @brief
-*    Returns the normalized minimum glyph texture coordinate inside the glyph texture atlas
-*/
-const Vector2 &FontGlyphTexture::GetTexCoordMin() const
-{
-	return m_vTexCoordMin;
-}
-
-/**
-*  @brief
-*    Returns the normalized maximum glyph texture coordinate inside the glyph texture atlas
-*/
-const Vector2 &FontGlyphTexture::GetTexCoordMax() const
-{
-	return m_vTexCoordMax;
-}
-
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
@@ -53,7 +53,9 @@ namespace PLRendererOpenGLES2 {
 FontManager::FontManager(PLRenderer::Renderer &cRenderer) : PLRenderer::FontManagerBackend(cRenderer),
 	m_pFTLibrary(new FT_Library),
 	m_pProgramGenerator(nullptr),
-	m_pVertexBuffer(nullptr)
+	m_pVertexBuffer(nullptr),
+	m_pBatchProgramGenerator(nullptr),
+	m_pBatchVertexBuffer(nullptr)
 {
 	// Initialize the FreeType library object
 	const FT_Error nError = FT_Init_FreeType(m_pFTLibrary);
@@ -77,6 +79,15 @@ FontManager::~FontManager()
 	if (m_pVertexBuffer)
 		delete m_pVertexBuffer;
 
+	// Destroy the batched text rendering program generator and vertex buffer
+	if (m_pBatchProgramGenerator)
+		delete m_pBatchProgramGenerator;
+	if (m_pBatchVertexBuffer)
+		delete m_pBatchVertexBuffer;
+
+	// Destroy the texture fonts while their FreeType library faces are still valid
+	ClearFontTexture();
+
 	// Destroy the FreeType library object
 	if (m_pFTLibrary) {
 		FT_Done_FreeType(*m_pFTLibrary);
@@ -156,6 +167,101 @@ PLRenderer::Program *FontManager::GetProgram(GeneratedProgramUserData **ppGenera
 }
 
 
+/**
+*  @brief
+*    Returns the vertex buffer used for batched text rendering
+*/
+PLRenderer::VertexBuffer *FontManager::GetBatchVertexBuffer(uint32 nNumOfVertices)
+{
+	// Initialize vertex buffer
+	if (!m_pBatchVertexBuffer) {
+		// Create the vertex buffer
+		m_pBatchVertexBuffer = m_pRenderer->CreateVertexBuffer();
+		if (!m_pBatchVertexBuffer)
+			return nullptr; // Error!
+
+		// Add the vertex attributes, the layout is identical to "PLRenderer::Font::GlyphVertex"
+		m_pBatchVertexBuffer->AddVertexAttribute(PLRenderer::VertexBuffer::Position, 0, PLRenderer::VertexBuffer::Float4);
+		m_pBatchVertexBuffer->AddVertexAttribute(PLRenderer::VertexBuffer::TexCoord, 0, PLRenderer::VertexBuffer::Float2);
+		m_pBatchVertexBuffer->AddVertexAttribute(PLRenderer::VertexBuffer::TexCoord, 1, PLRenderer::VertexBuffer::Float4);	// The color semantic only supports the API dependent RGBA type
+	}
+
+	// Is the vertex buffer large enough? If not, reallocate it and give it some room to grow.
+	if (m_pBatchVertexBuffer->GetNumOfElements() < nNumOfVertices) {
+		// Six vertices per glyph, start with room for 256 glyphs
+		uint32 nNumOfElements = m_pBatchVertexBuffer->GetNumOfElements() ? m_pBatchVertexBuffer->GetNumOfElements() : 256*6;
+		while (nNumOfElements < nNumOfVertices)
+			nNumOfElements *= 2;
+		if (!m_pBatchVertexBuffer->Allocate(nNumOfElements, PLRenderer::Usage::WriteOnly, false))
+			return nullptr; // Error!
+	}
+
+	// Return the vertex buffer
+	return m_pBatchVertexBuffer;
+}
+
+/**
+*  @brief
+*    Returns the program for batched text rendering
+*/
+PLRenderer::Program *FontManager::GetBatchProgram(GeneratedBatchProgramUserData **ppGeneratedBatchProgramUserData)
+{
+	// Create the program generator if there's currently no instance of it
+	if (!m_pBatchProgramGenerator) {
+		// Get the shader language to use
+		const String sShaderLanguage = m_pRenderer->GetDefaultShaderLanguage();
+
+		// Create the program generator
+		#include "FontManager_GLSL.h"
+		m_pBatchProgramGenerator = new PLRenderer::ProgramGenerator(*m_pRenderer, sShaderLanguage, sBatchVertexShaderSourceCodeGLSL, "100", sBatchFragmentShaderSourceCodeGLSL, "100");	// OpenGL ES 2.0 GLSL shader language 100
+	}
+
+	// If there's no program generator or vertex buffer, we don't need to continue
+	if (m_pBatchProgramGenerator && m_pBatchVertexBuffer) {
+		// Reset the program flags
+		m_cProgramFlags.Reset();
+
+		// Get a program instance from the program generator using the given program flags
+		PLRenderer::ProgramGenerator::GeneratedProgram *pGeneratedProgram = m_pBatchProgramGenerator->GetProgram(m_cProgramFlags);
+		if (pGeneratedProgram) {
+			PLRenderer::Program *pProgram = pGeneratedProgram->pProgram;
+
+			// Set pointers to uniforms & attributes of a generated program if they are not set yet
+			GeneratedBatchProgramUserData *pGeneratedBatchProgramUserData = static_cast<GeneratedBatchProgramUserData*>(pGeneratedProgram->pUserData);
+			if (!pGeneratedBatchProgramUserData) {
+				pGeneratedProgram->pUserData = pGeneratedBatchProgramUserData = new GeneratedBatchProgramUserData;
+				// Vertex shader attributes
+				static const String sVertexPosition = "VertexPosition";
+				pGeneratedBatchProgramUserData->pVertexPosition	= pProgram->GetAttribute(sVertexPosition);
+				static const String sVertexTexCoord = "VertexTexCoord";
+				pGeneratedBatchProgramUserData->pVertexTexCoord	= pProgram->GetAttribute(sVertexTexCoord);
+				static const String sVertexColor = "VertexColor";
+				pGeneratedBatchProgramUserData->pVertexColor	= pProgram->GetAttribute(sVertexColor);
+				// Fragment shader uniforms
+				static const String sGlyphMap = "GlyphMap";
+				pGeneratedBatchProgramUserData->pGlyphMap		= pProgram->GetUniform(sGlyphMap);
+			}
+			if (ppGeneratedBatchProgramUserData)
+				*ppGeneratedBatchProgramUserData = pGeneratedBatchProgramUserData;
+
+			// Set program vertex attributes, this creates a connection between "Vertex Buffer Attribute" and "Vertex Shader Attribute"
+			if (pGeneratedBatchProgramUserData->pVertexPosition)
+				pGeneratedBatchProgramUserData->pVertexPosition->Set(m_pBatchVertexBuffer, PLRenderer::VertexBuffer::Position);
+			if (pGeneratedBatchProgramUserData->pVertexTexCoord)
+				pGeneratedBatchProgramUserData->pVertexTexCoord->Set(m_pBatchVertexBuffer, PLRenderer::VertexBuffer::TexCoord);
+			if (pGeneratedBatchProgramUserData->pVertexColor)
+				pGeneratedBatchProgramUserData->pVertexColor->Set(m_pBatchVertexBuffer, PLRenderer::VertexBuffer::TexCoord, 1);
+
+			// Done
+			return pProgram;
+		}
+	}
+
+	// Error!
+	return nullptr;
+}
+
+
 //[-------------------------------------------------------]
 //[ Public virtual PLRenderer::FontManager functions      ]
 //[-------------------------------------------------------]
@@ -72,7 +72,7 @@ bool ProgramAttributeGLSL::Set(PLRenderer::VertexBuffer *pVertexBuffer, uint32 n
 			static_cast<PLRendererOpenGLES2::VertexBuffer*>(pVertexBuffer)->BindAndUpdate();
 
 			// Create the connection between "vertex program attribute" and "vertex buffer attribute"
-			glVertexAttribPointer(m_nOpenGLESAttributeLocation, pVertexAttribute->nComponentsAPI, pVertexAttribute->nTypeAPI, GL_FALSE, pVertexBuffer->GetVertexSize(), reinterpret_cast<const void*>(pVertexAttribute->nOffset));
+			glVertexAttribPointer(m_nOpenGLESAttributeLocation, pVertexAttribute->nComponentsAPI, pVertexAttribute->nTypeAPI, pVertexAttribute->bNormalizedAPI ? GL_TRUE : GL_FALSE, pVertexBuffer->GetVertexSize(), reinterpret_cast<const void*>(pVertexAttribute->nOffset));
 
 			// Enable vertex attribute array (OpenGL program independent, so we don't need to call glUseProgram first!)
 			glEnableVertexAttribArray(m_nOpenGLESAttributeLocation);
@@ -97,7 +97,7 @@ bool ProgramAttributeGLSL::Set(PLRenderer::VertexBuffer *pVertexBuffer, PLRender
 			static_cast<PLRendererOpenGLES2::VertexBuffer*>(pVertexBuffer)->BindAndUpdate();
 
 			// Create the connection between "vertex program attribute" and "vertex buffer attribute"
-			glVertexAttribPointer(m_nOpenGLESAttributeLocation, pVertexAttribute->nComponentsAPI, pVertexAttribute->nTypeAPI, GL_FALSE, pVertexBuffer->GetVertexSize(), reinterpret_cast<const void*>(pVertexAttribute->nOffset));
+			glVertexAttribPointer(m_nOpenGLESAttributeLocation, pVertexAttribute->nComponentsAPI, pVertexAttribute->nTypeAPI, pVertexAttribute->bNormalizedAPI ? GL_TRUE : GL_FALSE, pVertexBuffer->GetVertexSize(), reinterpret_cast<const void*>(pVertexAttribute->nOffset));
 
 			// Enable vertex attribute array (OpenGL program independent, so we don't need to call glUseProgram first!)
 			glEnableVertexAttribArray(m_nOpenGLESAttributeLocation);
@@ -265,7 +265,7 @@ void ProgramGLSL::BuildUniformInformation()
 							}
 
 							// Create a new program uniform instance
-							ProgramUniformGLSL *pProgramUniform = new ProgramUniformGLSL(nOpenGLESProgram, nOpenGLESUniformLocation, nTextureUnit);
+							ProgramUniformGLSL *pProgramUniform = new ProgramUniformGLSL(static_cast<Renderer&>(GetRenderer()), nOpenGLESProgram, nOpenGLESUniformLocation, nTextureUnit);
 
 							// Register the new program uniform
 							m_lstUniforms.Add(pProgramUniform);
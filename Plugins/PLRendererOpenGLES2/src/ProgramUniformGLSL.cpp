@@ -81,7 +81,8 @@ int ProgramUniformGLSL::Set(GLenum nOpenGLESTextureTarget, GLuint nOpenGLESTextu
 *  @brief
 *    Constructor
 */
-ProgramUniformGLSL::ProgramUniformGLSL(GLuint nOpenGLESProgram, int nOpenGLESUniformLocation, int nTextureUnit) :
+ProgramUniformGLSL::ProgramUniformGLSL(Renderer &cRenderer, GLuint nOpenGLESProgram, int nOpenGLESUniformLocation, int nTextureUnit) :
+	m_pRenderer(&cRenderer),
 	m_nOpenGLESProgram(nOpenGLESProgram),
 	m_nOpenGLESUniformLocation(nOpenGLESUniformLocation),
 	m_nTextureUnit(nTextureUnit)
@@ -96,6 +97,25 @@ ProgramUniformGLSL::~ProgramUniformGLSL()
 {
 }
 
+/**
+*  @brief
+*    Updates the cached uniform value and the renderer statistics
+*/
+bool ProgramUniformGLSL::UpdateValue(const void *pData, PLCore::uint32 nSize)
+{
+	if (UpdateCache(pData, nSize)) {
+		m_pRenderer->GetWritableStatistics().nUniformChanges++;
+
+		// The value must be passed to OpenGL ES
+		return true;
+	} else {
+		m_pRenderer->GetWritableStatistics().nUniformFiltered++;
+
+		// The value is already set
+		return false;
+	}
+}
+
 
 //[-------------------------------------------------------]
 //[ Public virtual PLRenderer::ProgramUniform functions   ]
@@ -118,12 +138,14 @@ void ProgramUniformGLSL::Get(double &fX)
 
 void ProgramUniformGLSL::Set(int nX)
 {
-	glUniform1i(m_nOpenGLESUniformLocation, nX);
+	if (UpdateValue(&nX, sizeof(nX)))
+		glUniform1i(m_nOpenGLESUniformLocation, nX);
 }
 
 void ProgramUniformGLSL::Set(float fX)
 {
-	glUniform1f(m_nOpenGLESUniformLocation, fX);
+	if (UpdateValue(&fX, sizeof(fX)))
+		glUniform1f(m_nOpenGLESUniformLocation, fX);
 }
 
 void ProgramUniformGLSL::Set(double fX)
@@ -180,12 +202,16 @@ void ProgramUniformGLSL::Get2(double *pfComponents)
 
 void ProgramUniformGLSL::Set(int nX, int nY)
 {
-	glUniform2i(m_nOpenGLESUniformLocation, nX, nY);
+	const int nValue[2] = { nX, nY };
+	if (UpdateValue(nValue, sizeof(nValue)))
+		glUniform2i(m_nOpenGLESUniformLocation, nX, nY);
 }
 
 void ProgramUniformGLSL::Set(float fX, float fY)
 {
-	glUniform2f(m_nOpenGLESUniformLocation, fX, fY);
+	const float fValue[2] = { fX, fY };
+	if (UpdateValue(fValue, sizeof(fValue)))
+		glUniform2f(m_nOpenGLESUniformLocation, fX, fY);
 }
 
 void ProgramUniformGLSL::Set(double fX, double fY)
@@ -195,22 +221,26 @@ void ProgramUniformGLSL::Set(double fX, double fY)
 
 void ProgramUniformGLSL::Set(const Vector2i &vVector)
 {
-	glUniform2iv(m_nOpenGLESUniformLocation, 1, vVector);
+	if (UpdateValue(static_cast<const int*>(vVector), sizeof(int)*2))
+		glUniform2iv(m_nOpenGLESUniformLocation, 1, vVector);
 }
 
 void ProgramUniformGLSL::Set(const Vector2 &vVector)
 {
-	glUniform2fv(m_nOpenGLESUniformLocation, 1, vVector);
+	if (UpdateValue(static_cast<const float*>(vVector), sizeof(float)*2))
+		glUniform2fv(m_nOpenGLESUniformLocation, 1, vVector);
 }
 
 void ProgramUniformGLSL::Set2(const int *pnComponents)
 {
-	glUniform2iv(m_nOpenGLESUniformLocation, 1, pnComponents);
+	if (UpdateValue(pnComponents, sizeof(int)*2))
+		glUniform2iv(m_nOpenGLESUniformLocation, 1, pnComponents);
 }
 
 void ProgramUniformGLSL::Set2(const float *pfComponents)
 {
-	glUniform2fv(m_nOpenGLESUniformLocation, 1, pfComponents);
+	if (UpdateValue(pfComponents, sizeof(float)*2))
+		glUniform2fv(m_nOpenGLESUniformLocation, 1, pfComponents);
 }
 
 void ProgramUniformGLSL::Set2(const double *pfComponents)
@@ -274,12 +304,16 @@ void ProgramUniformGLSL::Get3(double *pfComponents)
 
 void ProgramUniformGLSL::Set(int nX, int nY, int nZ)
 {
-	glUniform3i(m_nOpenGLESUniformLocation, nX, nY, nZ);
+	const int nValue[3] = { nX, nY, nZ };
+	if (UpdateValue(nValue, sizeof(nValue)))
+		glUniform3i(m_nOpenGLESUniformLocation, nX, nY, nZ);
 }
 
 void ProgramUniformGLSL::Set(float fX, float fY, float fZ)
 {
-	glUniform3f(m_nOpenGLESUniformLocation, fX, fY, fZ);
+	const float fValue[3] = { fX, fY, fZ };
+	if (UpdateValue(fValue, sizeof(fValue)))
+		glUniform3f(m_nOpenGLESUniformLocation, fX, fY, fZ);
 }
 
 void ProgramUniformGLSL::Set(double fX, double fY, double fZ)
@@ -289,27 +323,32 @@ void ProgramUniformGLSL::Set(double fX, double fY, double fZ)
 
 void ProgramUniformGLSL::Set(const Vector3i &vVector)
 {
-	glUniform3iv(m_nOpenGLESUniformLocation, 1, vVector);
+	if (UpdateValue(static_cast<const int*>(vVector), sizeof(int)*3))
+		glUniform3iv(m_nOpenGLESUniformLocation, 1, vVector);
 }
 
 void ProgramUniformGLSL::Set(const Vector3 &vVector)
 {
-	glUniform3fv(m_nOpenGLESUniformLocation, 1, vVector);
+	if (UpdateValue(static_cast<const float*>(vVector), sizeof(float)*3))
+		glUniform3fv(m_nOpenGLESUniformLocation, 1, vVector);
 }
 
 void ProgramUniformGLSL::Set(const Color3 &cColor)
 {
-	glUniform3fv(m_nOpenGLESUniformLocation, 1, cColor);
+	if (UpdateValue(static_cast<const float*>(cColor), sizeof(float)*3))
+		glUniform3fv(m_nOpenGLESUniformLocation, 1, cColor);
 }
 
 void ProgramUniformGLSL::Set3(const int *pnComponents)
 {
-	glUniform3iv(m_nOpenGLESUniformLocation, 1, pnComponents);
+	if (UpdateValue(pnComponents, sizeof(int)*3))
+		glUniform3iv(m_nOpenGLESUniformLocation, 1, pnComponents);
 }
 
 void ProgramUniformGLSL::Set3(const float *pfComponents)
 {
-	glUniform3fv(m_nOpenGLESUniformLocation, 1, pfComponents);
+	if (UpdateValue(pfComponents, sizeof(float)*3))
+		glUniform3fv(m_nOpenGLESUniformLocation, 1, pfComponents);
 }
 
 void ProgramUniformGLSL::Set3(const double *pfComponents)
@@ -375,12 +414,16 @@ void ProgramUniformGLSL::Get4(double *pfComponents)
 
 void ProgramUniformGLSL::Set(int nX, int nY, int nZ, int nW)
 {
-	glUniform4i(m_nOpenGLESUniformLocation, nX, nY, nZ, nW);
+	const int nValue[4] = { nX, nY, nZ, nW };
+	if (UpdateValue(nValue, sizeof(nValue)))
+		glUniform4i(m_nOpenGLESUniformLocation, nX, nY, nZ, nW);
 }
 
 void ProgramUniformGLSL::Set(float fX, float fY, float fZ, float fW)
 {
-	glUniform4f(m_nOpenGLESUniformLocation, fX, fY, fZ, fW);
+	const float fValue[4] = { fX, fY, fZ, fW };
+	if (UpdateValue(fValue, sizeof(fValue)))
+		glUniform4f(m_nOpenGLESUniformLocation, fX, fY, fZ, fW);
 }
 
 void ProgramUniformGLSL::Set(double fX, double fY, double fZ, double fW)
@@ -390,27 +433,32 @@ void ProgramUniformGLSL::Set(double fX, double fY, double fZ, double fW)
 
 void ProgramUniformGLSL::Set(const Vector4 &vVector)
 {
-	glUniform4fv(m_nOpenGLESUniformLocation, 1, vVector);
+	if (UpdateValue(static_cast<const float*>(vVector), sizeof(float)*4))
+		glUniform4fv(m_nOpenGLESUniformLocation, 1, vVector);
 }
 
 void ProgramUniformGLSL::Set(const Color4 &cColor)
 {
-	glUniform4fv(m_nOpenGLESUniformLocation, 1, cColor);
+	if (UpdateValue(static_cast<const float*>(cColor), sizeof(float)*4))
+		glUniform4fv(m_nOpenGLESUniformLocation, 1, cColor);
 }
 
 void ProgramUniformGLSL::Set(const Quaternion &qQuaternion)
 {
-	glUniform4fv(m_nOpenGLESUniformLocation, 1, qQuaternion);
+	if (UpdateValue(static_cast<const float*>(qQuaternion), sizeof(float)*4))
+		glUniform4fv(m_nOpenGLESUniformLocation, 1, qQuaternion);
 }
 
 void ProgramUniformGLSL::Set4(const int *pnComponents)
 {
-	glUniform4iv(m_nOpenGLESUniformLocation, 1, pnComponents);
+	if (UpdateValue(pnComponents, sizeof(int)*4))
+		glUniform4iv(m_nOpenGLESUniformLocation, 1, pnComponents);
 }
 
 void ProgramUniformGLSL::Set4(const float *pfComponents)
 {
-	glUniform4fv(m_nOpenGLESUniformLocation, 1, pfComponents);
+	if (UpdateValue(pfComponents, sizeof(float)*4))
+		glUniform4fv(m_nOpenGLESUniformLocation, 1, pfComponents);
 }
 
 void ProgramUniformGLSL::Set4(const double *pfComponents)
@@ -431,12 +479,26 @@ void ProgramUniformGLSL::Get(Matrix4x4 &mMatrix)
 
 void ProgramUniformGLSL::Set(const Matrix3x3 &mMatrix, bool bTranspose)
 {
-	glUniformMatrix3fv(m_nOpenGLESUniformLocation, 1, bTranspose, mMatrix);
+	// Only not transposed matrices are cached, else the cached value would be ambiguous
+	if (bTranspose) {
+		InvalidateCache();
+		m_pRenderer->GetWritableStatistics().nUniformChanges++;
+		glUniformMatrix3fv(m_nOpenGLESUniformLocation, 1, GL_TRUE, mMatrix);
+	} else if (UpdateValue(static_cast<const float*>(mMatrix), sizeof(float)*9)) {
+		glUniformMatrix3fv(m_nOpenGLESUniformLocation, 1, GL_FALSE, mMatrix);
+	}
 }
 
 void ProgramUniformGLSL::Set(const Matrix4x4 &mMatrix, bool bTranspose)
 {
-	glUniformMatrix4fv(m_nOpenGLESUniformLocation, 1, bTranspose, mMatrix);
+	// Only not transposed matrices are cached, else the cached value would be ambiguous
+	if (bTranspose) {
+		InvalidateCache();
+		m_pRenderer->GetWritableStatistics().nUniformChanges++;
+		glUniformMatrix4fv(m_nOpenGLESUniformLocation, 1, GL_TRUE, mMatrix);
+	} else if (UpdateValue(static_cast<const float*>(mMatrix), sizeof(float)*16)) {
+		glUniformMatrix4fv(m_nOpenGLESUniformLocation, 1, GL_FALSE, mMatrix);
+	}
 }
 
 // Texture
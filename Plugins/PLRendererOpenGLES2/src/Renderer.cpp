@@ -504,8 +504,12 @@ bool Renderer::SetShaderProgramTextureBuffer(int nStage, PLRenderer::TextureBuff
 			return false; // Error!
 
 		// Is this texture buffer already set?
-		if (m_ppCurrentTextureBuffer[nStage] == pTextureBuffer)
-			return false; // Error!
+		if (m_ppCurrentTextureBuffer[nStage] == pTextureBuffer) {
+			m_sStatistics.nTextureBufferFiltered++;
+
+			// Error!
+			return false;
+		}
 
 		// Make this texture buffer to the renderers current one
 		m_ppCurrentTextureBuffer[nStage] = pTextureBuffer;
@@ -1647,6 +1651,8 @@ bool Renderer::SetRenderState(PLRenderer::RenderState::Enum nState, uint32 nValu
 					break;
 			}
 		}
+	} else {
+		m_sStatistics.nRenderStateFiltered++;
 	}
 
 	// All went fine
@@ -1687,8 +1693,12 @@ bool Renderer::SetSamplerState(uint32 nStage, PLRenderer::Sampler::Enum nState,
 				nValue = PLRenderer::TextureFiltering::None;
 
 				// Check if this sampler state is already set to this value
-				if (m_ppnInternalSamplerState[nStage][nState] == nValue)
-					return true; // Nothing to do here :)
+				if (m_ppnInternalSamplerState[nStage][nState] == nValue) {
+					m_sStatistics.nSamplerStateFiltered++;
+
+					// Nothing to do here :)
+					return true;
+				}
 			}
 		}
 
@@ -1834,6 +1844,8 @@ bool Renderer::SetSamplerState(uint32 nStage, PLRenderer::Sampler::Enum nState,
 					return false; // Invalid sampler state!
 			}
 		}
+	} else {
+		m_sStatistics.nSamplerStateFiltered++;
 	}
 
 	// All went fine
@@ -1858,8 +1870,9 @@ bool Renderer::EndScene()
 
 bool Renderer::SetViewport(const PLMath::Rectangle *pRectangle, float fMinZ, float fMaxZ)
 {
-	// Call base implementation
-	PLRenderer::RendererBackend::SetViewport(pRectangle);
+	// Update the shadow state, nothing to do if the viewport didn't change
+	if (!UpdateViewport(pRectangle, fMinZ, fMaxZ))
+		return true; // Done
 
 	// OpenGL assumes LOWER-left corner of the viewport rectangle, in pixels
 	// and TOP-left corner given - so fit it :)
@@ -1871,7 +1884,7 @@ bool Renderer::SetViewport(const PLMath::Rectangle *pRectangle, float fMinZ, flo
 	glViewport(static_cast<GLint>(m_cViewportRect.GetX()), nY, static_cast<GLint>(m_cViewportRect.GetWidth()), static_cast<GLint>(m_cViewportRect.GetHeight()));
 
 	// Set depth range
-	glDepthRangef(fMinZ, fMaxZ);
+	glDepthRangef(m_fViewPortMinZ, m_fViewPortMaxZ);
 
 	// Done
 	return true;
@@ -1879,8 +1892,9 @@ bool Renderer::SetViewport(const PLMath::Rectangle *pRectangle, float fMinZ, flo
 
 bool Renderer::SetScissorRect(const PLMath::Rectangle *pRectangle)
 {
-	// Call base implementation
-	PLRenderer::RendererBackend::SetScissorRect(pRectangle);
+	// Update the shadow state, nothing to do if the scissor rectangle didn't change
+	if (!UpdateScissorRect(pRectangle))
+		return true; // Done
 
 	// OpenGL assumes LOWER-left corner of the viewport rectangle, in pixels
 	// and TOP-left corner given - so fit it :)
@@ -1928,12 +1942,9 @@ void Renderer::GetColorMask(bool &bRed, bool &bGreen, bool &bBlue, bool &bAlpha)
 
 bool Renderer::SetColorMask(bool bRed, bool bGreen, bool bBlue, bool bAlpha)
 {
-	// Set color mask
-	m_bColorMask[0] = bRed;
-	m_bColorMask[1] = bGreen;
-	m_bColorMask[2] = bBlue;
-	m_bColorMask[3] = bAlpha;
-	glColorMask(bRed, bGreen, bBlue, bAlpha);
+	// Set color mask, nothing to do if the color mask didn't change
+	if (UpdateColorMask(bRed, bGreen, bBlue, bAlpha))
+		glColorMask(bRed, bGreen, bBlue, bAlpha);
 
 	// Done
 	return true;
@@ -1995,6 +2006,9 @@ bool Renderer::SetRenderTarget(PLRenderer::Surface *pSurface, uint8 nFace)
 
 	// Is this surface already the current render target?
 	if (m_cCurrentSurface.GetSurface() != pSurface || m_nCurrentSurfaceFace != nFace) {
+		// Draw the batched primitives into the render target they were recorded for
+		FlushDrawHelpers();
+
 		// Check parameter
 		if (!m_lstSurfaces.IsElement(pSurface))
 			return false; // Error!
@@ -2102,8 +2116,12 @@ bool Renderer::SetTextureBuffer(int nStage, PLRenderer::TextureBuffer *pTextureB
 			return false; // Error!
 
 		// Is this texture buffer already set?
-		if (m_ppCurrentTextureBuffer[nStage] == pTextureBuffer)
-			return false; // Error!
+		if (m_ppCurrentTextureBuffer[nStage] == pTextureBuffer) {
+			m_sStatistics.nTextureBufferFiltered++;
+
+			// Error!
+			return false;
+		}
 
 		// Make this texture buffer to the renderers current one
 		PLRenderer::TextureBuffer *pT = m_ppCurrentTextureBuffer[nStage];
@@ -2129,11 +2147,16 @@ bool Renderer::SetTextureBuffer(int nStage, PLRenderer::TextureBuffer *pTextureB
 bool Renderer::SetIndexBuffer(PLRenderer::IndexBuffer *pIndexBuffer)
 {
 	// Is this index buffer already set?
-	if (m_pCurrentIndexBuffer == pIndexBuffer)
-		return false; // Error!
+	if (m_pCurrentIndexBuffer == pIndexBuffer) {
+		m_sStatistics.nIndexBufferFiltered++;
+
+		// Error!
+		return false;
+	}
 
 	// Make this index buffer to the renderers current one
 	m_pCurrentIndexBuffer = pIndexBuffer;
+	m_sStatistics.nIndexBufferBinds++;
 
 	// Should an index buffer be set?
 	if (pIndexBuffer) {
@@ -2160,6 +2183,8 @@ bool Renderer::SetProgram(PLRenderer::Program *pProgram)
 	// Is the new program the same one as the current one?
 	PLRenderer::Program *pCurrentProgram = static_cast<PLRenderer::Program*>(m_cProgramHandler.GetResource());
 	if (pCurrentProgram != pProgram) {
+		m_sStatistics.nProgramBinds++;
+
 		// Was there a previous program? (must be GLSL because that's the only supported shader language in here :D)
 		if (pCurrentProgram)
 			static_cast<ProgramGLSL*>(pCurrentProgram)->UnmakeCurrent();
@@ -2170,6 +2195,8 @@ bool Renderer::SetProgram(PLRenderer::Program *pProgram)
 		// Make the new program to the current one (must be GLSL because that's the only supported shader language in here :D)
 		if (pProgram)
 			return static_cast<ProgramGLSL*>(pProgram)->MakeCurrent();
+	} else {
+		m_sStatistics.nProgramFiltered++;
 	}
 
 	// Done
@@ -194,6 +194,13 @@ class Buffer : public PLSound::Buffer {
 		virtual bool IsStreamed() const override;
 
 
+	//[-------------------------------------------------------]
+	//[ Public virtual PLCore::Resource functions             ]
+	//[-------------------------------------------------------]
+	public:
+		virtual PLCore::uint64 GetCPUMemoryUsage() const override;
+
+
 	//[-------------------------------------------------------]
 	//[ Public virtual PLCore::Loadable functions             ]
 	//[-------------------------------------------------------]
@@ -317,6 +317,23 @@ bool Buffer::IsStreamed() const
 }
 
 
+//[-------------------------------------------------------]
+//[ Public virtual PLCore::Resource functions             ]
+//[-------------------------------------------------------]
+uint64 Buffer::GetCPUMemoryUsage() const
+{
+	// Streams only hold small stream buffers per source, else OpenAL holds the decoded sound data
+	if (m_nBuffer) {
+		ALint nSize = 0;
+		alGetBufferi(m_nBuffer, AL_SIZE, &nSize);
+		return nSize;
+	}
+
+	// Done
+	return 0;
+}
+
+
 //[-------------------------------------------------------]
 //[ Public virtual PLCore::Loadable functions             ]
 //[-------------------------------------------------------]
@@ -25,7 +25,7 @@
 //[-------------------------------------------------------]
 //[ Includes                                              ]
 //[-------------------------------------------------------]
-#include <PLMath/PerlinNoiseTurbulence.h>
+#include <PLMath/NoiseGrid.h>
 #include <PLGraphics/Image/Image.h>
 #include <PLRenderer/RendererContext.h>
 #include <PLRenderer/Texture/TextureManager.h>
@@ -76,69 +76,6 @@ TextureCreatorPyroclasticCloud3D::~TextureCreatorPyroclasticCloud3D()
 }
 
 
-// [TODO] Cleanup/remove: This is just a first test to have automatically generated volume data for first render tests
-/* --- harmonic summing functions - PDB --------------------------*/
-/*
-   In what follows "alpha" is the weight when the sum is formed.
-   Typically it is 2, As this approaches 1 the function is noisier.
-   "beta" is the harmonic scaling/spacing, typically 2.
-*/
-
-double PerlinNoise1D(double x,double alpha,double beta,int n)
-{
-	int i;
-	double val,sum = 0;
-	double p,scale = 1;
-
-	p = x;
-	for (i=0;i<n;i++) {
-		val = PerlinNoise::Noise1(p);
-		sum += val / scale;
-		scale *= alpha;
-		p *= beta;
-	}
-	return(sum);
-}
-
-double PerlinNoise2D(double x,double y,double alpha,double beta,int n)
-{
-	int i;
-	double val,sum = 0;
-	double p[2],scale = 1;
-
-	p[0] = x;
-	p[1] = y;
-	for (i=0;i<n;i++) {
-		val = PerlinNoise::Noise2(p);
-		sum += val / scale;
-		scale *= alpha;
-		p[0] *= beta;
-		p[1] *= beta;
-	}
-	return(sum);
-}
-
-double PerlinNoise3D(double x,double y,double z,double alpha,double beta,int n)
-{
-	int i;
-	double val,sum = 0;
-	double p[3],scale = 1;
-
-	p[0] = x;
-	p[1] = y;
-	p[2] = z;
-	for (i=0;i<n;i++) {
-		val = PerlinNoise::Noise3(p);
-		sum += val / scale;
-		scale *= alpha;
-		p[0] *= beta;
-		p[1] *= beta;
-		p[2] *= beta;
-	}
-	return(sum);
-}
-
-
 //[-------------------------------------------------------]
 //[ Private virtual TextureCreator functions              ]
 //[-------------------------------------------------------]
@@ -159,19 +96,19 @@ Texture *TextureCreatorPyroclasticCloud3D::Create(TextureManager &cTextureManage
 		float frequency = 3.0f / n;
 		float center = n / 2.0f + 0.5f;
 
-		for(int x=0; x < n; ++x) {
+		// Evaluate the harmonic noise sum for the whole volume at once
+		float *noise = new float[n*n*n];
+		NoiseGrid::FractalSum3(NoiseGrid::Perlin, noise, n, n, n, Vector3::Zero, Vector3(frequency, frequency, frequency), 5.0f, 6.0f, 3);
+
+		// Keep the original volume layout (z fastest), the noise grid itself is stored with x fastest
+		for (int x=0; x < n; ++x) {
 			for (int y=0; y < n; ++y) {
 				for (int z=0; z < n; ++z) {
 					float dx = center-x;
 					float dy = center-y;
 					float dz = center-z;
 
-					float off = fabsf((float) PerlinNoise3D(
-						x*frequency,
-						y*frequency,
-						z*frequency,
-						5,
-						6, 3));
+					float off = fabsf(noise[(z*n + y)*n + x]);
 
 					float d = sqrtf(dx*dx+dy*dy+dz*dz)/(n);
 					bool isFilled = (d-off) < r;
@@ -179,6 +116,7 @@ Texture *TextureCreatorPyroclasticCloud3D::Create(TextureManager &cTextureManage
 				}
 			}
 		}
+		delete [] noise;
 
 		// Create image
 		cImage = Image::CreateImageAndTakeoverData(DataByte, ColorGrayscale, Vector3i(n, n, n), CompressionNone, data);
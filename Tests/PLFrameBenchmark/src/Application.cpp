@@ -0,0 +1,586 @@
+/*********************************************************\
+ *  File: Application.cpp                                *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <algorithm>
+#if defined(WIN32)
+	#include <PLCore/PLCoreWindowsIncludes.h>
+	#include <psapi.h>
+#elif defined(LINUX)
+	#include <stdio.h>
+#endif
+#include <PLCore/File/File.h>
+#include <PLCore/String/RegEx.h>
+#include <PLCore/System/System.h>
+#include <PLCore/System/Console.h>
+#include <PLCore/Tools/Timing.h>
+#include <PLMesh/MeshHandler.h>
+#include <PLRenderer/RendererContext.h>
+#include <PLRenderer/Renderer/Renderer.h>
+#include <PLRenderer/Renderer/TextureBuffer.h>
+#include <PLRenderer/Renderer/SurfaceTextureBuffer.h>
+#include <PLRenderer/Material/Material.h>
+#include <PLRenderer/Material/MaterialManager.h>
+#include <PLRenderer/Material/ParameterManager.h>
+#include <PLScene/Scene/SPScene.h>
+#include <PLScene/Scene/SNCamera.h>
+#include <PLScene/Scene/SceneContext.h>
+#include <PLScene/Scene/SceneContainer.h>
+#include <PLScene/Compositing/SceneRenderer.h>
+#include <PLScene/Compositing/SceneRendererPass.h>
+#include <PLScene/Compositing/SceneRendererManager.h>
+#include <PLScene/Visibility/SQCull.h>
+#include "Application.h"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+using namespace PLCore;
+using namespace PLMath;
+using namespace PLRenderer;
+using namespace PLScene;
+
+
+//[-------------------------------------------------------]
+//[ RTTI interface                                        ]
+//[-------------------------------------------------------]
+pl_class_metadata(Application, "", PLCore::CoreApplication, "Headless frame benchmark application")
+	// Constructors
+	pl_constructor_0_metadata(DefaultConstructor,	"Default constructor",	"")
+pl_class_metadata_end(Application)
+
+
+//[-------------------------------------------------------]
+//[ Public functions                                      ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Constructor
+*/
+Application::Application() : CoreApplication()
+{
+	// Set application title
+	SetTitle("PixelLight frame benchmark");
+
+	// Register command line options:
+	//   PLFrameBenchmark [-s/--scene <filename>] [-g/--grid <size>] [-n/--frames <frames>] [-w/--warmup <frames>] [-r/--renderer <class>]
+	//                    [-p/--scenerenderer <filename>] [-o/--output <filename>] [-b/--baseline <filename>] [-t/--threshold <percent>]
+	m_cCommandLine.AddParameter("Scene",		 "-s", "--scene",		  "Scene to load, a procedural scene is generated if not set",				"",							false);
+	m_cCommandLine.AddParameter("Grid",			 "-g", "--grid",		  "Number of meshes along each axis of the procedural scene",				"32",						false);
+	m_cCommandLine.AddParameter("Frames",		 "-n", "--frames",		  "Number of measured frames",												"300",						false);
+	m_cCommandLine.AddParameter("Warmup",		 "-w", "--warmup",		  "Number of frames to render before measuring",							"10",						false);
+	m_cCommandLine.AddParameter("Renderer",		 "-r", "--renderer",	  "Renderer backend class",													"PLRendererNull::Renderer",	false);
+	m_cCommandLine.AddParameter("SceneRenderer", "-p", "--scenerenderer", "Scene renderer to use, the built-in fixed functions one is used if not set",	"",							false);
+	m_cCommandLine.AddParameter("Output",		 "-o", "--output",		  "JSON file to write the results into, the console is used if not set",	"",							false);
+	m_cCommandLine.AddParameter("Baseline",		 "-b", "--baseline",	  "JSON file of a previous run to compare the results against",				"",							false);
+	m_cCommandLine.AddParameter("Threshold",	 "-t", "--threshold",	  "Allowed increase of a metric in percent before it's a regression",		"10",						false);
+}
+
+/**
+*  @brief
+*    Destructor
+*/
+Application::~Application()
+{
+}
+
+
+//[-------------------------------------------------------]
+//[ Private virtual PLCore::CoreApplication functions     ]
+//[-------------------------------------------------------]
+void Application::Main()
+{
+	const Console &cConsole = System::GetInstance()->GetConsole();
+
+	// Get the options
+	const String sScene		 = m_cCommandLine.GetValue("Scene");
+	const String sRenderer	 = m_cCommandLine.GetValue("Renderer");
+	const uint32 nGrid		 = m_cCommandLine.GetValue("Grid").GetUInt32();
+	const uint32 nFrames	 = Math::Max(m_cCommandLine.GetValue("Frames").GetUInt32(), 1u);
+	const uint32 nWarmup	 = m_cCommandLine.GetValue("Warmup").GetUInt32();
+	const float  fThreshold	 = m_cCommandLine.GetValue("Threshold").GetFloat()/100.0f;
+	String		 sSceneRenderer = m_cCommandLine.GetValue("SceneRenderer");
+
+	// Create the renderer context, no window required
+	RendererContext *pRendererContext = RendererContext::CreateInstance(sRenderer, NULL_HANDLE);
+	if (!pRendererContext) {
+		cConsole.Print("Failed to create the renderer backend '" + sRenderer + "'\n");
+		Exit(1);
+		return;
+	}
+	Renderer &cRenderer = pRendererContext->GetRenderer();
+	SceneContext *pSceneContext = new SceneContext(*pRendererContext);
+
+	// Load or create the scene
+	bool bResult = false;
+	SceneContainer *pContainer = static_cast<SceneContainer*>(pSceneContext->GetRoot()->Create("PLScene::SceneContainer", "Scene"));
+	if (pContainer) {
+		if (sScene.GetLength()) {
+			bResult = pContainer->LoadByFilename(sScene);
+			if (!bResult)
+				cConsole.Print("Failed to load the scene '" + sScene + "'\n");
+		} else {
+			bResult = CreateScene(*pContainer, nGrid);
+		}
+	}
+
+	// Setup the scene renderer
+	if (bResult && !sSceneRenderer.GetLength()) {
+		sSceneRenderer = CreateSceneRenderer(*pSceneContext);
+		bResult = (sSceneRenderer.GetLength() != 0);
+	}
+
+	// Create the surface and the painter, the surface size matters when rendering with a real backend
+	SurfaceTextureBuffer *pSurface = bResult ? cRenderer.CreateSurfaceTextureBuffer2D(Vector2i(1280, 720), TextureBuffer::R8G8B8A8, SurfaceTextureBuffer::Depth) : nullptr;
+	SPScene *pPainter = pSurface ? static_cast<SPScene*>(cRenderer.CreateSurfacePainter("PLScene::SPScene")) : nullptr;
+	SceneRenderer *pSceneRenderer = nullptr;
+	if (pPainter) {
+		pSurface->SetPainter(pPainter);
+		pPainter->SetRootContainer(pSceneContext->GetRoot());
+		pPainter->SetSceneContainer(pContainer);
+		SNCamera *pCamera = FindCamera(*pContainer);
+		if (!pCamera)
+			pCamera = static_cast<SNCamera*>(pContainer->Create("PLScene::SNCamera", "BenchmarkCamera", "Rotation=\"0 180 0\""));
+		pPainter->SetCamera(pCamera);
+		pPainter->SetDefaultSceneRenderer(sSceneRenderer);
+		pSceneRenderer = pPainter->GetDefaultSceneRenderer();
+		if (!pSceneRenderer)
+			cConsole.Print("Failed to load the scene renderer '" + sSceneRenderer + "'\n");
+	}
+
+	if (pSceneRenderer) {
+		System &cSystem = *System::GetInstance();
+		const uint32 nNumOfPasses = pSceneRenderer->GetNumOfElements();
+
+		// Samples and counters of the measured frames
+		Array<float> lstFrame, lstUpdate, lstDraw, lstCull;
+		Array<float> lstPasses;	// nNumOfPasses samples per frame
+		lstFrame .Resize(nFrames);
+		lstUpdate.Resize(nFrames);
+		lstDraw  .Resize(nFrames);
+		lstCull  .Resize(nFrames);
+		lstPasses.Resize(nFrames*nNumOfPasses);
+		double fDrawCalls = 0.0, fTriangles = 0.0, fVertices = 0.0, fRenderStateChanges = 0.0, fSamplerStateChanges = 0.0, fTextureBinds = 0.0, fVisibleSceneNodes = 0.0;
+		double fIndexBufferBinds = 0.0, fProgramBinds = 0.0, fUniformChanges = 0.0, fViewportChanges = 0.0, fScissorRectChanges = 0.0, fColorMaskChanges = 0.0;
+		double fRenderStateFiltered = 0.0, fSamplerStateFiltered = 0.0, fTextureBindsFiltered = 0.0, fIndexBufferBindsFiltered = 0.0, fProgramBindsFiltered = 0.0,
+			   fUniformFiltered = 0.0, fViewportFiltered = 0.0, fScissorRectFiltered = 0.0, fColorMaskFiltered = 0.0;
+		double fDrawHelpersPrimitives = 0.0, fDrawHelpersBatches = 0.0;
+		uint64 nTextureMemory = 0, nVertexMemory = 0, nIndexMemory = 0, nUniformMemory = 0;
+
+		// Render the frames
+		for (uint32 nFrame=0; nFrame<nWarmup+nFrames; nFrame++) {
+			const uint64 nFrameStart = cSystem.GetMicroseconds();
+
+			// Update phase: timing, scene node modifiers and so on
+			Timing::GetInstance()->Update();
+			pSceneContext->Update();
+			const uint64 nUpdateEnd = cSystem.GetMicroseconds();
+
+			// Draw phase: visibility determination and scene renderer passes
+			pSurface->Draw();
+			const uint64 nDrawEnd = cSystem.GetMicroseconds();
+
+			// The renderer statistics are reset within "RendererContext::Update()", so get them first
+			const Statistics sStatistics = cRenderer.GetStatistics();
+			pRendererContext->Update();
+			pSceneContext->Cleanup();
+			const uint64 nFrameEnd = cSystem.GetMicroseconds();
+
+			// Write down the measurements
+			if (nFrame >= nWarmup) {
+				const uint32 nIndex = nFrame - nWarmup;
+				lstFrame [nIndex] = (nFrameEnd - nFrameStart)/1000.0f;
+				lstUpdate[nIndex] = (nUpdateEnd - nFrameStart)/1000.0f;
+				lstDraw  [nIndex] = (nDrawEnd - nUpdateEnd)/1000.0f;
+				const SQCull *pCullQuery = pPainter->GetCullQuery();
+				if (pCullQuery) {
+					lstCull[nIndex]     = pCullQuery->GetStatistics().nCullTime/1000.0f;
+					fVisibleSceneNodes += pCullQuery->GetStatistics().nNumOfVisibleSceneNodes;
+				} else {
+					lstCull[nIndex] = 0.0f;
+				}
+				for (uint32 nPass=0; nPass<nNumOfPasses; nPass++)
+					lstPasses[nPass*nFrames + nIndex] = pSceneRenderer->GetByIndex(nPass)->GetDrawTime()/1000.0f;
+				fDrawCalls			 += sStatistics.nDrawPrimitivCalls;
+				fTriangles			 += sStatistics.nTriangles;
+				fVertices			 += sStatistics.nVertices;
+				fRenderStateChanges	 += sStatistics.nRenderStateChanges;
+				fSamplerStateChanges += sStatistics.nSamplerStateChanges;
+				fTextureBinds		 += sStatistics.nTextureBufferBinds;
+				fIndexBufferBinds	 += sStatistics.nIndexBufferBinds;
+				fProgramBinds		 += sStatistics.nProgramBinds;
+				fUniformChanges		 += sStatistics.nUniformChanges;
+				fViewportChanges	 += sStatistics.nViewportChanges;
+				fScissorRectChanges	 += sStatistics.nScissorRectChanges;
+				fColorMaskChanges	 += sStatistics.nColorMaskChanges;
+
+				// Redundant changes filtered by the renderer backend
+				fRenderStateFiltered	  += sStatistics.nRenderStateFiltered;
+				fSamplerStateFiltered	  += sStatistics.nSamplerStateFiltered;
+				fTextureBindsFiltered	  += sStatistics.nTextureBufferFiltered;
+				fIndexBufferBindsFiltered += sStatistics.nIndexBufferFiltered;
+				fProgramBindsFiltered	  += sStatistics.nProgramFiltered;
+				fUniformFiltered		  += sStatistics.nUniformFiltered;
+				fViewportFiltered		  += sStatistics.nViewportFiltered;
+				fScissorRectFiltered	  += sStatistics.nScissorRectFiltered;
+				fColorMaskFiltered		  += sStatistics.nColorMaskFiltered;
+
+				// Draw helper primitives and the batches they were drawn with
+				fDrawHelpersPrimitives += sStatistics.nDrawHelpersPrimitives;
+				fDrawHelpersBatches	   += sStatistics.nDrawHelpersBatches;
+			}
+			if (nTextureMemory < sStatistics.nTextureBuffersMem)
+				nTextureMemory = sStatistics.nTextureBuffersMem;
+			if (nVertexMemory < sStatistics.nVertexBufferMem)
+				nVertexMemory = sStatistics.nVertexBufferMem;
+			if (nIndexMemory < sStatistics.nIndexBufferMem)
+				nIndexMemory = sStatistics.nIndexBufferMem;
+			if (nUniformMemory < sStatistics.nUniformBufferMem)
+				nUniformMemory = sStatistics.nUniformBufferMem;
+		}
+
+		// Timings
+		AddTimings("frame",  lstFrame);
+		AddTimings("update", lstUpdate);
+		AddTimings("draw",   lstDraw);
+		AddTimings("cull",   lstCull);
+		for (uint32 nPass=0; nPass<nNumOfPasses; nPass++) {
+			Array<float> lstPass;
+			lstPass.Resize(nFrames);
+			for (uint32 nIndex=0; nIndex<nFrames; nIndex++)
+				lstPass[nIndex] = lstPasses[nPass*nFrames + nIndex];
+			AddTimings("pass_" + pSceneRenderer->GetByIndex(nPass)->GetName(), lstPass);
+		}
+
+		// Counters, average per frame
+		AddMetric("draw_calls",				fDrawCalls/nFrames);
+		AddMetric("triangles",				fTriangles/nFrames);
+		AddMetric("vertices",				fVertices/nFrames);
+		AddMetric("render_state_changes",	fRenderStateChanges/nFrames);
+		AddMetric("sampler_state_changes",	fSamplerStateChanges/nFrames);
+		AddMetric("texture_binds",			fTextureBinds/nFrames);
+		AddMetric("index_buffer_binds",		fIndexBufferBinds/nFrames);
+		AddMetric("program_binds",			fProgramBinds/nFrames);
+		AddMetric("uniform_changes",		fUniformChanges/nFrames);
+		AddMetric("viewport_changes",		fViewportChanges/nFrames);
+		AddMetric("scissor_rect_changes",	fScissorRectChanges/nFrames);
+		AddMetric("color_mask_changes",		fColorMaskChanges/nFrames);
+		AddMetric("render_state_filtered",	fRenderStateFiltered/nFrames);
+		AddMetric("sampler_state_filtered",	fSamplerStateFiltered/nFrames);
+		AddMetric("texture_binds_filtered",	fTextureBindsFiltered/nFrames);
+		AddMetric("index_buffer_binds_filtered",	fIndexBufferBindsFiltered/nFrames);
+		AddMetric("program_binds_filtered",	fProgramBindsFiltered/nFrames);
+		AddMetric("uniform_changes_filtered",	fUniformFiltered/nFrames);
+		AddMetric("viewport_changes_filtered",	fViewportFiltered/nFrames);
+		AddMetric("scissor_rect_changes_filtered",	fScissorRectFiltered/nFrames);
+		AddMetric("color_mask_changes_filtered",	fColorMaskFiltered/nFrames);
+		AddMetric("draw_helper_primitives",	fDrawHelpersPrimitives/nFrames);
+		AddMetric("draw_helper_batches",	fDrawHelpersBatches/nFrames);
+		AddMetric("visible_scene_nodes",	fVisibleSceneNodes/nFrames);
+
+		// Memory high-water marks
+		AddMetric("texture_memory_peak_kb",	nTextureMemory/1024.0);
+		AddMetric("vertex_memory_peak_kb",	nVertexMemory/1024.0);
+		AddMetric("index_memory_peak_kb",	nIndexMemory/1024.0);
+		AddMetric("uniform_memory_peak_kb",	nUniformMemory/1024.0);
+		AddMetric("process_memory_peak_kb",	GetProcessPeakMemory()/1024.0);
+
+		// Write the results
+		const String sJson = GetJson(sScene, sRenderer, sSceneRenderer, nFrames);
+		const String sOutput = m_cCommandLine.GetValue("Output");
+		if (sOutput.GetLength()) {
+			File cFile(sOutput);
+			if (cFile.Open(File::FileCreate | File::FileWrite))
+				cFile.PutS(sJson);
+			else
+				cConsole.Print("Failed to write '" + sOutput + "'\n");
+		} else {
+			cConsole.Print(sJson);
+		}
+
+		// Compare against the baseline
+		const String sBaseline = m_cCommandLine.GetValue("Baseline");
+		if (sBaseline.GetLength()) {
+			Array<Metric> lstBaseline;
+			if (LoadBaseline(sBaseline, lstBaseline)) {
+				const uint32 nRegressions = CompareToBaseline(lstBaseline, fThreshold);
+				if (nRegressions) {
+					cConsole.Print(String("Found ") + nRegressions + " regression(s) against the baseline '" + sBaseline + "'\n");
+					Exit(1);
+				} else {
+					cConsole.Print("No regressions against the baseline '" + sBaseline + "'\n");
+				}
+			} else {
+				cConsole.Print("Failed to load the baseline '" + sBaseline + "'\n");
+				Exit(1);
+			}
+		}
+	} else {
+		Exit(1);
+	}
+
+	// Cleanup
+	if (pSurface)
+		delete pSurface;	// Destroys the painter, too
+	delete pSceneContext;
+	delete pRendererContext;
+}
+
+
+//[-------------------------------------------------------]
+//[ Private functions                                     ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Creates the procedural benchmark scene
+*/
+bool Application::CreateScene(SceneContainer &cContainer, uint32 nSize) const
+{
+	// Some materials using different render states, assigned round robin
+	static const uint32 NumOfMaterials = 4;
+	MaterialManager &cMaterialManager = cContainer.GetSceneContext()->GetRendererContext().GetMaterialManager();
+	Material *pMaterials[NumOfMaterials];
+	for (uint32 i=0; i<NumOfMaterials; i++) {
+		pMaterials[i] = cMaterialManager.Create(String("FrameBenchmark") + i);
+		if (!pMaterials[i])
+			return false;
+		pMaterials[i]->GetParameterManager().SetParameter1f("TwoSided", static_cast<float>(i%2));
+		pMaterials[i]->GetParameterManager().SetParameter3f("DiffuseColor", static_cast<float>(i)/NumOfMaterials, 1.0f, 1.0f);
+	}
+
+	// A grid of meshes in front of the camera (looking along the negative z axis), larger than the view frustum so there's something to cull
+	for (uint32 nY=0; nY<nSize; nY++) {
+		for (uint32 nX=0; nX<nSize; nX++) {
+			const int nPosX = static_cast<int>(nX*2) - static_cast<int>(nSize);
+			const int nPosY = static_cast<int>(nY*2) - static_cast<int>(nSize);
+			SceneNode *pSceneNode = cContainer.Create("PLScene::SNMesh", "", String("Position=\"") + nPosX + ' ' + nPosY + " -50\" Mesh=\"Create PLMesh::MeshCreatorCube Name=\\\"Box\\\"\"");
+			if (!pSceneNode || !pSceneNode->GetMeshHandler())
+				return false;
+			pSceneNode->GetMeshHandler()->SetMaterial(0, pMaterials[(nY*nSize + nX)%NumOfMaterials]);
+		}
+	}
+
+	// Light and camera
+	return (cContainer.Create("PLScene::SNDirectionalLight", "Sun", "Rotation=\"-45 30 0\"") &&
+			cContainer.Create("PLScene::SNCamera", "BenchmarkCamera", "Rotation=\"0 180 0\""));
+}
+
+/**
+*  @brief
+*    Returns the first camera found within the given scene container (recursive)
+*/
+SNCamera *Application::FindCamera(SceneContainer &cContainer) const
+{
+	for (uint32 i=0; i<cContainer.GetNumOfElements(); i++) {
+		SceneNode *pSceneNode = cContainer.GetByIndex(i);
+		if (pSceneNode->IsCamera())
+			return static_cast<SNCamera*>(pSceneNode);
+		if (pSceneNode->IsContainer()) {
+			SNCamera *pCamera = FindCamera(static_cast<SceneContainer&>(*pSceneNode));
+			if (pCamera)
+				return pCamera;
+		}
+	}
+
+	// No camera found
+	return nullptr;
+}
+
+/**
+*  @brief
+*    Creates the built-in fixed functions scene renderer
+*/
+String Application::CreateSceneRenderer(SceneContext &cSceneContext) const
+{
+	static const String Name = "FrameBenchmark";
+	SceneRenderer *pSceneRenderer = cSceneContext.GetSceneRendererManager().Create(Name);
+	if (pSceneRenderer) {
+		static const char *Passes[] = {
+			"PLCompositing::SRPBegin",								"Begin",
+			"PLCompositing::SRPFunctionsPre",						"FunctionsPre",
+			"PLCompositing::SRPDirectionalLightingFixedFunctions",	"DirectionalLighting",
+			"PLCompositing::SRPFunctionsSolid",						"FunctionsSolid",
+			"PLCompositing::SRPEmissiveFixedFunctions",				"Emissive",
+			"PLCompositing::SRPLightEffectsFixedFunctions",			"LightEffects",
+			"PLCompositing::SRPFunctionsTransparent",				"FunctionsTransparent",
+			"PLCompositing::SRPFunctionsPost",						"FunctionsPost",
+			"PLCompositing::SRPEnd",								"End"
+		};
+		for (uint32 i=0; i<sizeof(Passes)/sizeof(Passes[0]); i+=2) {
+			if (!pSceneRenderer->Create(Passes[i], Passes[i + 1]))
+				return "";
+		}
+		return Name;
+	}
+
+	// Error!
+	return "";
+}
+
+/**
+*  @brief
+*    Adds a metric
+*/
+void Application::AddMetric(const String &sName, double fValue)
+{
+	Metric &sMetric = m_lstMetrics.Add();
+	sMetric.sName  = sName;
+	sMetric.fValue = fValue;
+}
+
+/**
+*  @brief
+*    Adds the mean, median and 95th percentile metrics of the given timing samples
+*/
+void Application::AddTimings(const String &sName, Array<float> &lstSamples)
+{
+	const uint32 nNumOfSamples = lstSamples.GetNumOfElements();
+	if (nNumOfSamples) {
+		double fSum = 0.0;
+		for (uint32 i=0; i<nNumOfSamples; i++)
+			fSum += lstSamples[i];
+		std::sort(lstSamples.GetData(), lstSamples.GetData() + nNumOfSamples);
+		AddMetric(sName + "_ms_mean",   fSum/nNumOfSamples);
+		AddMetric(sName + "_ms_median", lstSamples[nNumOfSamples/2]);
+		AddMetric(sName + "_ms_p95",    lstSamples[Math::Min(nNumOfSamples*95/100, nNumOfSamples - 1)]);
+	}
+}
+
+/**
+*  @brief
+*    Returns the metrics as JSON
+*/
+String Application::GetJson(const String &sScene, const String &sRenderer, const String &sSceneRenderer, uint32 nFrames) const
+{
+	// Escape backslashes (e.g. within MS Windows paths) and quotation marks
+	String sEscapedScene = sScene;
+	sEscapedScene.Replace("\\", "\\\\");
+	sEscapedScene.Replace("\"", "\\\"");
+	String sEscapedSceneRenderer = sSceneRenderer;
+	sEscapedSceneRenderer.Replace("\\", "\\\\");
+	sEscapedSceneRenderer.Replace("\"", "\\\"");
+
+	String sJson = "{\n";
+	sJson += "\t\"scene\": \"" + (sScene.GetLength() ? sEscapedScene : "procedural") + "\",\n";
+	sJson += "\t\"renderer\": \"" + sRenderer + "\",\n";
+	sJson += "\t\"scene_renderer\": \"" + sEscapedSceneRenderer + "\",\n";
+	sJson += String("\t\"frames\": ") + nFrames + ",\n";
+	sJson += "\t\"metrics\": {\n";
+	for (uint32 i=0; i<m_lstMetrics.GetNumOfElements(); i++) {
+		const Metric &sMetric = m_lstMetrics[i];
+		sJson += "\t\t\"" + sMetric.sName + "\": " + String::Format("%.4f", sMetric.fValue);
+		sJson += (i < m_lstMetrics.GetNumOfElements() - 1) ? ",\n" : "\n";
+	}
+	sJson += "\t}\n}\n";
+	return sJson;
+}
+
+/**
+*  @brief
+*    Loads the metrics of a JSON file previously written by this application
+*/
+bool Application::LoadBaseline(const String &sFilename, Array<Metric> &lstMetrics) const
+{
+	File cFile(sFilename);
+	if (cFile.Open(File::FileRead)) {
+		const String sJson = cFile.GetContentAsString();
+		const int nMetrics = sJson.IndexOf("\"metrics\"");
+		if (nMetrics >= 0) {
+			// Read all '"<name>": <number>' pairs of the metrics object
+			RegEx cRegEx("\"([^\"]+)\"\\s*:\\s*(-?[0-9.eE+\\-]+)");
+			uint32 nPosition = static_cast<uint32>(nMetrics + 9);
+			while (cRegEx.Match(sJson, nPosition)) {
+				Metric &sMetric = lstMetrics.Add();
+				sMetric.sName  = cRegEx.GetResult(0);
+				sMetric.fValue = cRegEx.GetResult(1).GetDouble();
+				nPosition = cRegEx.GetPosition();
+			}
+			return true;
+		}
+	}
+
+	// Error!
+	return false;
+}
+
+/**
+*  @brief
+*    Compares the current metrics against the given baseline and prints the regressions
+*/
+uint32 Application::CompareToBaseline(const Array<Metric> &lstBaseline, float fThreshold) const
+{
+	const Console &cConsole = System::GetInstance()->GetConsole();
+	uint32 nRegressions = 0;
+	for (uint32 i=0; i<m_lstMetrics.GetNumOfElements(); i++) {
+		const Metric &sMetric = m_lstMetrics[i];
+		for (uint32 j=0; j<lstBaseline.GetNumOfElements(); j++) {
+			const Metric &sBaseline = lstBaseline[j];
+			if (sBaseline.sName == sMetric.sName) {
+				// Timings are noisy, tiny absolute differences are not worth a regression
+				const double fNoise = (sMetric.sName.IndexOf("_ms_") >= 0) ? 0.05 : 0.0;
+				if (sMetric.fValue > sBaseline.fValue*(1.0 + fThreshold) && sMetric.fValue - sBaseline.fValue > fNoise) {
+					cConsole.Print("Regression: " + sMetric.sName + ' ' + String::Format("%.4f", sMetric.fValue) + " (baseline " + String::Format("%.4f", sBaseline.fValue) + ")\n");
+					nRegressions++;
+				}
+				break;
+			}
+		}
+	}
+	return nRegressions;
+}
+
+/**
+*  @brief
+*    Returns the peak memory usage (high-water mark) of this process
+*/
+uint64 Application::GetProcessPeakMemory()
+{
+	#if defined(WIN32)
+		PROCESS_MEMORY_COUNTERS sCounters;
+		if (GetProcessMemoryInfo(GetCurrentProcess(), &sCounters, sizeof(sCounters)))
+			return sCounters.PeakWorkingSetSize;
+	#elif defined(LINUX)
+		// The "/proc"-files don't have a size, so we can't use "PLCore::File" in here
+		FILE *pFile = fopen("/proc/self/status", "r");
+		if (pFile) {
+			uint64 nPeak = 0;
+			char szLine[256];
+			while (fgets(szLine, sizeof(szLine), pFile)) {
+				unsigned long long nKilobytes = 0;
+				if (sscanf(szLine, "VmHWM: %llu kB", &nKilobytes) == 1) {
+					nPeak = nKilobytes*1024;
+					break;
+				}
+			}
+			fclose(pFile);
+			return nPeak;
+		}
+	#endif
+
+	// Not available
+	return 0;
+}
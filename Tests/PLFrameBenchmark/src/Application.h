@@ -0,0 +1,260 @@
+/*********************************************************\
+ *  File: Application.h                                  *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+#ifndef __PLFRAMEBENCHMARK_APPLICATION_H__
+#define __PLFRAMEBENCHMARK_APPLICATION_H__
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <PLCore/Container/Array.h>
+#include <PLCore/Application/CoreApplication.h>
+
+
+//[-------------------------------------------------------]
+//[ Forward declarations                                  ]
+//[-------------------------------------------------------]
+namespace PLScene {
+	class SNCamera;
+	class SceneContext;
+	class SceneContainer;
+}
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Headless frame benchmark application
+*
+*  @remarks
+*    Renders a given number of frames of a loaded or procedurally generated scene through the standard scene
+*    renderer without opening a window (by default by using the null renderer backend, which counts draw calls and
+*    state changes without requiring a GPU) and writes down per phase timings, renderer counters and memory high-water
+*    marks as JSON. When a baseline JSON file written by a previous run is given, the metrics are compared against
+*    it and the application exits with 1 if one of them got worse by more than the given threshold.
+*
+*  @note
+*    - All metrics are "lower is better"
+*    - Timings are given in milliseconds, memory in kilobytes, counters as average per frame
+*/
+class Application : public PLCore::CoreApplication {
+
+
+	//[-------------------------------------------------------]
+	//[ RTTI interface                                        ]
+	//[-------------------------------------------------------]
+	pl_class_def()
+	pl_class_def_end
+
+
+	//[-------------------------------------------------------]
+	//[ Public functions                                      ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Constructor
+		*/
+		Application();
+
+		/**
+		*  @brief
+		*    Destructor
+		*/
+		virtual ~Application();
+
+
+	//[-------------------------------------------------------]
+	//[ Private virtual PLCore::CoreApplication functions     ]
+	//[-------------------------------------------------------]
+	private:
+		virtual void Main() override;
+
+
+	//[-------------------------------------------------------]
+	//[ Private structures                                    ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Named benchmark metric
+		*/
+		struct Metric {
+			PLCore::String sName;	/**< Metric name */
+			double		   fValue;	/**< Metric value */
+
+			bool operator ==(const Metric &sOther) const
+			{
+				return (sName == sOther.sName && fValue == sOther.fValue);
+			}
+		};
+
+
+	//[-------------------------------------------------------]
+	//[ Private functions                                     ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Creates the procedural benchmark scene
+		*
+		*  @param[in] cContainer
+		*    Scene container to fill
+		*  @param[in] nSize
+		*    Number of meshes along each axis of the grid
+		*
+		*  @return
+		*    'true' if all went fine, else 'false'
+		*/
+		bool CreateScene(PLScene::SceneContainer &cContainer, PLCore::uint32 nSize) const;
+
+		/**
+		*  @brief
+		*    Returns the first camera found within the given scene container (recursive)
+		*
+		*  @param[in] cContainer
+		*    Scene container to search in
+		*
+		*  @return
+		*    The found camera, a null pointer if there's no camera
+		*/
+		PLScene::SNCamera *FindCamera(PLScene::SceneContainer &cContainer) const;
+
+		/**
+		*  @brief
+		*    Creates the built-in fixed functions scene renderer
+		*
+		*  @param[in] cSceneContext
+		*    Scene context to create the scene renderer in
+		*
+		*  @return
+		*    Name of the created scene renderer, empty string on error
+		*
+		*  @remarks
+		*    The null renderer backend has no shader support, so the built-in scene renderer is using the
+		*    fixed functions passes only. When rendering with a real backend, a scene renderer file (for
+		*    example "Forward.sr") can be given instead.
+		*/
+		PLCore::String CreateSceneRenderer(PLScene::SceneContext &cSceneContext) const;
+
+		/**
+		*  @brief
+		*    Adds a metric
+		*
+		*  @param[in] sName
+		*    Metric name
+		*  @param[in] fValue
+		*    Metric value
+		*/
+		void AddMetric(const PLCore::String &sName, double fValue);
+
+		/**
+		*  @brief
+		*    Adds the mean, median and 95th percentile metrics of the given timing samples
+		*
+		*  @param[in] sName
+		*    Timing name, "_ms_mean", "_ms_median" and "_ms_p95" is appended
+		*  @param[in] lstSamples
+		*    Timing samples in milliseconds, the array is sorted by this method
+		*/
+		void AddTimings(const PLCore::String &sName, PLCore::Array<float> &lstSamples);
+
+		/**
+		*  @brief
+		*    Returns the metrics as JSON
+		*
+		*  @param[in] sScene
+		*    Scene filename, empty string for the procedural scene
+		*  @param[in] sRenderer
+		*    Used renderer backend
+		*  @param[in] sSceneRenderer
+		*    Used scene renderer
+		*  @param[in] nFrames
+		*    Number of measured frames
+		*
+		*  @return
+		*    The metrics as JSON
+		*/
+		PLCore::String GetJson(const PLCore::String &sScene, const PLCore::String &sRenderer, const PLCore::String &sSceneRenderer, PLCore::uint32 nFrames) const;
+
+		/**
+		*  @brief
+		*    Loads the metrics of a JSON file previously written by this application
+		*
+		*  @param[in]  sFilename
+		*    JSON filename
+		*  @param[out] lstMetrics
+		*    Receives the metrics, the list is not cleared before
+		*
+		*  @return
+		*    'true' if all went fine, else 'false'
+		*
+		*  @note
+		*    - This is not a generic JSON parser, only the number members of the "metrics" object are read
+		*/
+		bool LoadBaseline(const PLCore::String &sFilename, PLCore::Array<Metric> &lstMetrics) const;
+
+		/**
+		*  @brief
+		*    Compares the current metrics against the given baseline and prints the regressions
+		*
+		*  @param[in] lstBaseline
+		*    Baseline metrics
+		*  @param[in] fThreshold
+		*    Allowed relative increase (for example 0.1 for 10%)
+		*
+		*  @return
+		*    Number of metrics which got worse by more than the given threshold
+		*
+		*  @note
+		*    - Metrics which are not within the baseline are ignored
+		*    - Timing differences below 0.05 milliseconds are considered to be noise
+		*/
+		PLCore::uint32 CompareToBaseline(const PLCore::Array<Metric> &lstBaseline, float fThreshold) const;
+
+		/**
+		*  @brief
+		*    Returns the peak memory usage (high-water mark) of this process
+		*
+		*  @return
+		*    The peak memory usage of this process in bytes, 0 if not available on this platform
+		*/
+		static PLCore::uint64 GetProcessPeakMemory();
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		PLCore::Array<Metric> m_lstMetrics;	/**< Metrics of the current run */
+
+
+};
+
+
+#endif // __PLFRAMEBENCHMARK_APPLICATION_H__
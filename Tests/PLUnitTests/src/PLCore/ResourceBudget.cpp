@@ -0,0 +1,179 @@
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <UnitTest++/UnitTest++.h>
+#include <PLCore/String/String.h>
+#include <PLCore/Container/ResourceManager.h>
+#include <PLCore/Container/ResourceHandler.h>
+#include <PLCore/Container/ResourceBudget.h>
+#include "UnitTest++AddIns/PLCheckMacros.h"
+#include "UnitTest++AddIns/PLChecks.h"
+
+using namespace PLCore;
+
+/*
+* Naming Convention for SUITE:
+* CLASSNAME
+*/
+SUITE(ResourceBudget) {
+	/*
+	* Naming Convention for METHOD:
+	* METHODNAME_SCENARIO
+	*/
+
+	//[-------------------------------------------------------]
+	//[ Classes                                               ]
+	//[-------------------------------------------------------]
+	// Resource "loading" 1000 bytes, no file access required
+	class BudgetResource : public Resource<BudgetResource> {
+	public:
+		uint32 nNumOfLoads;
+		uint64 nLoadedBytes;
+		BudgetResource(const String &sName, ResourceManager<BudgetResource> *pManager) :
+		Resource<BudgetResource>(sName, pManager),
+		nNumOfLoads(0),
+		nLoadedBytes(0)
+		{
+		}
+		virtual bool LoadByFilename(const String &sFilename, const String &sParams = "", const String &sMethod = "") override
+		{
+			Unload();
+			nNumOfLoads++;
+			nLoadedBytes = 1000;
+			m_sFilename  = sFilename;
+			m_sUrl		 = sFilename;
+			return true;
+		}
+		virtual bool Unload() override
+		{
+			nLoadedBytes = 0;
+			return Resource<BudgetResource>::Unload();
+		}
+		virtual String GetLoadableTypeName() const override
+		{
+			return "BudgetResource";
+		}
+		virtual uint64 GetCPUMemoryUsage() const override
+		{
+			return nLoadedBytes;
+		}
+	};
+
+	class BudgetManager : public ResourceManager<BudgetResource> {
+	public:
+		BudgetManager()
+		{
+			SetManagerName("Budget test manager");
+		}
+	private:
+		virtual BudgetResource *CreateResource(const String &sName) override
+		{
+			return new BudgetResource(sName, this);
+		}
+	};
+
+	// Our resource budget Test Fixture :)
+	struct ConstructTest
+	{
+		ConstructTest() :
+			pBudget(ResourceBudget::GetInstance())
+		{
+			/* some setup */
+			pBudget->SetMinUnusedFrames(2);
+			for (uint32 i=0; i<5; i++)
+				cHandlers[i].SetResource(cManager.LoadResource(String("Resource ") + i));
+		}
+		~ConstructTest() {
+			/* some teardown */
+			pBudget->SetBudget(cManager.GetBudgetCategory());
+			pBudget->SetMinUnusedFrames();
+		}
+
+		// Testing objects
+		ResourceBudget					*pBudget;
+		BudgetManager					 cManager;
+		ResourceHandler<BudgetResource>	 cHandlers[5];
+	};
+
+	TEST_FIXTURE(ConstructTest, GetMemoryUsage) {
+		CHECK_EQUAL("Budget test manager", cManager.GetBudgetCategory());
+		CHECK_EQUAL(5000U, pBudget->GetMemoryUsage(cManager.GetBudgetCategory()));
+		CHECK(pBudget->GetMemoryUsage() >= 5000U);
+
+		// Without a budget nothing is evicted
+		for (uint32 i=0; i<5; i++)
+			pBudget->Update();
+		CHECK_EQUAL(5000U, pBudget->GetMemoryUsage(cManager.GetBudgetCategory()));
+	}
+
+	TEST_FIXTURE(ConstructTest, Update_EvictLeastRecentlyUsed) {
+		pBudget->SetBudget(cManager.GetBudgetCategory(), 3000);
+		CHECK_EQUAL(3000U, pBudget->GetBudget(cManager.GetBudgetCategory()));
+
+		// Resources used within the last frames must not be evicted
+		CHECK_EQUAL(0U, pBudget->Update());
+		CHECK_EQUAL(5000U, pBudget->GetMemoryUsage(cManager.GetBudgetCategory()));
+
+		// Keep using resource 0, 1 and 4, resource 2 is used one frame later than resource 3
+		cHandlers[2].GetResource();
+		pBudget->Update();
+		for (uint32 i=0; i<3; i++) {
+			cHandlers[0].GetResource();
+			cHandlers[1].GetResource();
+			cHandlers[4].GetResource();
+			pBudget->Update();
+		}
+
+		// Resource 3 is the least recently used one, after it resource 2 must go
+		CHECK_EQUAL(3000U, pBudget->GetMemoryUsage(cManager.GetBudgetCategory()));
+		CHECK(!cManager.GetByIndex(0)->IsEvicted());
+		CHECK(!cManager.GetByIndex(1)->IsEvicted());
+		CHECK(cManager.GetByIndex(2)->IsEvicted());
+		CHECK(cManager.GetByIndex(3)->IsEvicted());
+		CHECK(!cManager.GetByIndex(4)->IsEvicted());
+		CHECK_EQUAL(5U, cManager.GetNumOfElements());
+
+		// The next access reloads the resource at once, the caller never gets an evicted resource
+		BudgetResource *pResource = cHandlers[3].GetResource();
+		CHECK(pResource);
+		CHECK(!pResource->IsEvicted());
+		CHECK_EQUAL(2U, pResource->nNumOfLoads);
+		CHECK_EQUAL(1000U, pResource->GetCPUMemoryUsage());
+		CHECK_EQUAL(pResource, cManager.LoadResource("Resource 3"));
+		CHECK_EQUAL(2U, pResource->nNumOfLoads);
+
+		// A loaded resource can still be reloaded explicitly
+		CHECK(pResource->Reload());
+		CHECK_EQUAL(3U, pResource->nNumOfLoads);
+
+		// Also when requested through the manager
+		pResource = cManager.LoadResource("Resource 2");
+		CHECK(pResource);
+		CHECK(!pResource->IsEvicted());
+		CHECK_EQUAL(2U, pResource->nNumOfLoads);
+	}
+
+	TEST_FIXTURE(ConstructTest, Update_ProtectedAndStandard) {
+		cManager.GetByIndex(0)->SetProtected(true);
+		cManager.SetStandard(cManager.GetByIndex(1));
+		pBudget->SetBudget(cManager.GetBudgetCategory(), 1);
+		for (uint32 i=0; i<3; i++)
+			pBudget->Update();
+
+		// Everything else is evicted, but never the protected and standard resources
+		CHECK_EQUAL(2000U, pBudget->GetMemoryUsage(cManager.GetBudgetCategory()));
+		CHECK(!cManager.GetByIndex(0)->IsEvicted());
+		CHECK(!cManager.GetByIndex(1)->IsEvicted());
+		CHECK(cManager.GetByIndex(2)->IsEvicted());
+		cManager.GetByIndex(0)->SetProtected(false);
+	}
+
+	TEST_FIXTURE(ConstructTest, GetTopConsumers) {
+		cManager.GetByIndex(2)->nLoadedBytes = 4096;
+		const String sText = pBudget->GetTopConsumers(2);
+		CHECK(sText.IndexOf("Budget test manager: 7.9 KiB") >= 0);
+		CHECK(sText.IndexOf("1. [Budget test manager] Resource 2: 4.0 KiB CPU") >= 0);
+		CHECK(sText.IndexOf("2. [Budget test manager]") >= 0);
+		CHECK(sText.IndexOf("3. [") < 0);
+	}
+}
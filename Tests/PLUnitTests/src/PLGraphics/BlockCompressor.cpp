@@ -0,0 +1,173 @@
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <math.h>
+#include <UnitTest++/UnitTest++.h>
+#include <PLCore/Core/MemoryManager.h>
+#include <PLMath/Vector3i.h>
+#include <PLGraphics/Image/Image.h>
+#include <PLGraphics/Image/ImageBuffer.h>
+#include <PLGraphics/Image/BlockCompressor.h>
+#include "UnitTest++AddIns/PLCheckMacros.h"
+#include "UnitTest++AddIns/PLChecks.h"
+
+using namespace PLCore;
+using namespace PLMath;
+using namespace PLGraphics;
+
+/*
+* Naming Convention for SUITE:
+* CLASSNAME
+*/
+SUITE(BlockCompressor) {
+	/*
+	* Naming Convention for METHOD:
+	* METHODNAME_SCENARIO
+	*/
+	const uint32 size = 256;	// Image width and height
+
+	// Our block compressor Test Fixture :)
+	struct ConstructTest
+	{
+		ConstructTest() :
+			pnRGBA(new uint8[size*size*4]),
+			pnCompressed(new uint8[size*size]),
+			pnReference(new uint8[size*size])
+		{
+			/* some setup */
+			CreateTestData(pnRGBA, size, size);
+		}
+		~ConstructTest() {
+			/* some teardown */
+			delete [] pnReference;
+			delete [] pnCompressed;
+			delete [] pnRGBA;
+		}
+
+		// Fills RGBA pixels with smooth gradients, hard edges and some noise, a mix of what textures usually contain
+		static void CreateTestData(uint8 *pnPixels, uint32 nWidth, uint32 nHeight)
+		{
+			uint32 nRandom = 12345;
+			for (uint32 y=0; y<nHeight; y++) {
+				for (uint32 x=0; x<nWidth; x++) {
+					nRandom = nRandom*1103515245 + 12345;
+					const int nNoise = static_cast<int>((nRandom >> 16) & 0xF) - 8;
+					const bool bEdge = ((x/37 + y/29) & 1) != 0;
+					const int nR = (x*255)/nWidth;
+					const int nG = bEdge ? 200 - static_cast<int>((y*150)/nHeight) : static_cast<int>((y*255)/nHeight);
+					const int nB = static_cast<int>(128 + 100*sin(x*0.05)*cos(y*0.03));
+					const int nA = bEdge ? 255 : static_cast<int>(((x + y)*255)/(nWidth + nHeight));
+					uint8 *pnPixel = &pnPixels[(y*nWidth + x)*4];
+					pnPixel[0] = static_cast<uint8>(nR + nNoise < 0 ? 0 : (nR + nNoise > 255 ? 255 : nR + nNoise));
+					pnPixel[1] = static_cast<uint8>(nG);
+					pnPixel[2] = static_cast<uint8>(nB + nNoise < 0 ? 0 : (nB + nNoise > 255 ? 255 : nB + nNoise));
+					pnPixel[3] = static_cast<uint8>(nA);
+				}
+			}
+		}
+
+		// Compresses test data by using "ImageBuffer::Compress()", decompresses it again by using "ImageBuffer::Decompress()"
+		// and returns the PSNR in dB of the components covered by the compression
+		static double CompressDecompressPSNR(const Vector3i &vSize, ECompression nCompression, ECompressionQuality nQuality)
+		{
+			// Get the color format and the components the compression is covering
+			EColorFormat nColorFormat;
+			uint32 nComponents;
+			switch (nCompression) {
+				case CompressionDXT1:  nColorFormat = ColorRGBA;		nComponents = 3; break;
+				case CompressionLATC1: nColorFormat = ColorGrayscale;	nComponents = 1; break;
+				case CompressionLATC2: nColorFormat = ColorGrayscaleA;	nComponents = 2; break;
+				default:			   nColorFormat = ColorRGBA;		nComponents = 4; break;
+			}
+			const uint32 nComponentsPerPixel = ImageBuffer::GetComponentsPerPixel(nColorFormat);
+			const uint32 nNumOfPixels		 = vSize.x*vSize.y*vSize.z;
+			uint8 *pnPixels = new uint8[nNumOfPixels*4];
+			uint8 *pnSource = new uint8[nNumOfPixels*nComponentsPerPixel];
+			CreateTestData(pnPixels, vSize.x, vSize.y*vSize.z);
+			for (uint32 i=0; i<nNumOfPixels; i++) {
+				for (uint32 c=0; c<nComponentsPerPixel; c++)
+					pnSource[i*nComponentsPerPixel + c] = pnPixels[i*4 + c];
+			}
+
+			// Compress
+			Image cImage = Image::CreateImageAndCopyData(DataByte, nColorFormat, vSize, nCompression, pnSource);
+			double fPSNR = 0.0;
+			if (cImage.GetBuffer()->Compress(nQuality)) {
+				// Decompress into another image
+				Image cDecompressed = Image::CreateImage(DataByte, nColorFormat, vSize, nCompression);
+				const ImageBuffer *pImageBuffer = cImage.GetBuffer();
+				MemoryManager::Copy(cDecompressed.GetBuffer()->GetCompressedData(), pImageBuffer->GetCompressedData(), pImageBuffer->GetCompressedDataSize());
+				const uint8 *pnDecompressed = static_cast<const ImageBuffer*>(cDecompressed.GetBuffer())->GetData();
+
+				// PSNR
+				double fSquaredError = 0.0;
+				for (uint32 i=0; i<nNumOfPixels; i++) {
+					for (uint32 c=0; c<nComponents; c++) {
+						const double fError = static_cast<double>(pnSource[i*nComponentsPerPixel + c]) - static_cast<double>(pnDecompressed[i*nComponentsPerPixel + c]);
+						fSquaredError += fError*fError;
+					}
+				}
+				const double fMSE = fSquaredError/(nNumOfPixels*nComponents);
+				fPSNR = (fMSE > 0.0) ? 10.0*log10(255.0*255.0/fMSE) : 100.0;
+			}
+
+			// Cleanup
+			delete [] pnSource;
+			delete [] pnPixels;
+
+			// Done
+			return fPSNR;
+		}
+
+		// Testing objects
+		uint8 *pnRGBA;
+		uint8 *pnCompressed;
+		uint8 *pnReference;
+	};
+
+	TEST_FIXTURE(ConstructTest, Compress_PSNR) {
+		static const ECompression nCompressions[] = { CompressionDXT1, CompressionDXT3, CompressionDXT5, CompressionLATC1, CompressionLATC2 };
+		static const double fMinPSNR[] = { 36.0, 35.0, 37.0, 45.0, 45.0 };
+		for (uint32 i=0; i<5; i++) {
+			const double fFast = CompressDecompressPSNR(Vector3i(size, size, 1), nCompressions[i], CompressionQualityFast);
+			const double fHigh = CompressDecompressPSNR(Vector3i(size, size, 1), nCompressions[i], CompressionQualityHigh);
+			CHECK(fFast > fMinPSNR[i]);
+			CHECK(fHigh >= fFast);
+		}
+	}
+
+	TEST_FIXTURE(ConstructTest, Compress_OddSizeAndVolume) {
+		// Blocks leaving the image replicate the border pixels, xy-planes are compressed independently
+		CHECK(CompressDecompressPSNR(Vector3i(37, 21, 1), CompressionDXT5, CompressionQualityFast) > 30.0);
+		CHECK(CompressDecompressPSNR(Vector3i(130, 67, 1), CompressionDXT1, CompressionQualityHigh) > 35.0);
+		CHECK(CompressDecompressPSNR(Vector3i(2, 3, 1), CompressionLATC1, CompressionQualityFast) > 30.0);
+		CHECK(CompressDecompressPSNR(Vector3i(1, 1, 1), CompressionDXT1, CompressionQualityHigh) > 45.0);
+		CHECK(CompressDecompressPSNR(Vector3i(64, 32, 8), CompressionLATC2, CompressionQualityFast) > 35.0);
+	}
+
+	TEST_FIXTURE(ConstructTest, EncodeDXTColorBlock_SingleColor) {
+		// Single colors are encoded using the single color tables, the error is at most one per component
+		uint8 nPixels[16*4];
+		for (uint32 nColor=0; nColor<256; nColor+=5) {
+			for (uint32 i=0; i<16; i++) {
+				nPixels[i*4]	 = static_cast<uint8>(nColor);
+				nPixels[i*4 + 1] = static_cast<uint8>(255 - nColor);
+				nPixels[i*4 + 2] = static_cast<uint8>((nColor*7) & 0xFF);
+				nPixels[i*4 + 3] = 255;
+			}
+			uint8 nBlock[8];
+			CHECK(BlockCompressor::EncodeDXTColorBlock(nBlock, nPixels, CompressionQualityFast) <= 3*16);
+		}
+	}
+
+	TEST_FIXTURE(ConstructTest, Compress_ThreadIndependent) {
+		// The result must not depend on the number of threads
+		CHECK(BlockCompressor::Compress(CompressionDXT1, CompressionQualityFast, pnRGBA, 4, Vector3i(size, size, 1), pnReference, 1));
+		CHECK(BlockCompressor::Compress(CompressionDXT1, CompressionQualityFast, pnRGBA, 4, Vector3i(size, size, 1), pnCompressed));
+		CHECK(!MemoryManager::Compare(pnCompressed, pnReference, size*size/2));
+
+		CHECK(BlockCompressor::Compress(CompressionDXT5, CompressionQualityHigh, pnRGBA, 4, Vector3i(size, size, 1), pnReference, 1));
+		CHECK(BlockCompressor::Compress(CompressionDXT5, CompressionQualityHigh, pnRGBA, 4, Vector3i(size, size, 1), pnCompressed));
+		CHECK(!MemoryManager::Compare(pnCompressed, pnReference, size*size));
+	}
+}
@@ -0,0 +1,171 @@
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <UnitTest++/UnitTest++.h>
+#include <PLMath/Half.h>
+
+using namespace PLCore;
+using namespace PLMath;
+
+/*
+* Naming Convention for SUITE:
+* CLASSNAME
+*/
+SUITE(Half) {
+	/*
+	* Naming Convention for METHOD:
+	* METHODNAME_SCENARIO
+	*/
+
+	// Returns the bits of a float
+	static uint32 GetBits(float fValue)
+	{
+		union {
+			uint32 i;
+			float  f;
+		} sValue;
+		sValue.f = fValue;
+		return sValue.i;
+	}
+
+	// Returns a float with the given bits
+	static float FromBits(uint32 nBits)
+	{
+		union {
+			uint32 i;
+			float  f;
+		} sValue;
+		sValue.i = nBits;
+		return sValue.f;
+	}
+
+	// Returns whether or not the given float is not a number
+	static bool IsNotANumber(float fValue)
+	{
+		return ((GetBits(fValue) & 0x7fffffff) > 0x7f800000);
+	}
+
+	// Checks the result of a bulk conversion into half against the single value conversion
+	static bool IsSameHalf(uint16 nExpected, uint16 nResult)
+	{
+		// Not a number must stay not a number with the same sign, the mantissa bits depend on the instruction set
+		if (Half::IsNotANumber(nExpected))
+			return (Half::IsNotANumber(nResult) && Half::IsNegative(nExpected) == Half::IsNegative(nResult));
+		return (nExpected == nResult);
+	}
+
+	struct ConstructTest
+	{
+		ConstructTest() :
+			nNumOfValues(65536)
+		{
+			/* some setup */
+			pnHalf  = new uint16[nNumOfValues];
+			pfFloat = new float[nNumOfValues];
+			for (uint32 i=0; i<nNumOfValues; i++)
+				pnHalf[i] = static_cast<uint16>(i);
+		}
+		~ConstructTest() {
+			/* some teardown */
+			delete [] pfFloat;
+			delete [] pnHalf;
+		}
+
+		uint32  nNumOfValues;
+		uint16 *pnHalf;
+		float  *pfFloat;
+	};
+
+	TEST_FIXTURE(ConstructTest, ToFloatArray_AllValues) {
+		Half::ToFloatArray(pnHalf, pfFloat, nNumOfValues);
+		uint32 nErrors = 0;
+		for (uint32 i=0; i<nNumOfValues; i++) {
+			const float fExpected = Half::ToFloat(pnHalf[i]);
+			if (Half::IsNotANumber(pnHalf[i])) {
+				// Signaling NANs may become quiet NANs, sign and payload have to be preserved
+				if (!IsNotANumber(pfFloat[i]) || ((GetBits(fExpected) ^ GetBits(pfFloat[i])) & ~0x00400000u))
+					nErrors++;
+			} else {
+				if (GetBits(fExpected) != GetBits(pfFloat[i]))
+					nErrors++;
+			}
+		}
+		CHECK_EQUAL(0u, nErrors);
+	}
+
+	TEST_FIXTURE(ConstructTest, FromFloatArray_AllValues) {
+		// Every half value must survive the round trip
+		for (uint32 i=0; i<nNumOfValues; i++)
+			pfFloat[i] = Half::ToFloat(pnHalf[i]);
+		uint16 *pnResult = new uint16[nNumOfValues];
+		Half::FromFloatArray(pfFloat, pnResult, nNumOfValues);
+		uint32 nErrors = 0;
+		for (uint32 i=0; i<nNumOfValues; i++) {
+			if (!IsSameHalf(pnHalf[i], pnResult[i]))
+				nErrors++;
+		}
+		delete [] pnResult;
+		CHECK_EQUAL(0u, nErrors);
+	}
+
+	TEST_FIXTURE(ConstructTest, FromFloatArray_Rounding) {
+		// Exact midpoints between two neighbouring positive half values (including denormalized ones) test round to nearest even,
+		// the float directly below and above each midpoint test the rounding direction
+		const uint32 nNumOfMidpoints = 0x7c00;
+		float  *pfSource = new float[nNumOfMidpoints*3];
+		uint16 *pnResult = new uint16[nNumOfMidpoints*3];
+		for (uint32 i=0; i<nNumOfMidpoints; i++) {
+			const float fMidpoint = (Half::ToFloat(static_cast<uint16>(i)) + Half::ToFloat(static_cast<uint16>(i + 1)))*0.5f;
+			pfSource[i*3 + 0] = FromBits(GetBits(fMidpoint) - 1);
+			pfSource[i*3 + 1] = fMidpoint;
+			pfSource[i*3 + 2] = FromBits(GetBits(fMidpoint) + 1);
+		}
+		Half::FromFloatArray(pfSource, pnResult, nNumOfMidpoints*3);
+		uint32 nErrors = 0;
+		for (uint32 i=0; i<nNumOfMidpoints*3; i++) {
+			if (!IsSameHalf(Half::FromFloat(pfSource[i]), pnResult[i]))
+				nErrors++;
+		}
+		delete [] pnResult;
+		delete [] pfSource;
+		CHECK_EQUAL(0u, nErrors);
+	}
+
+	TEST(FromFloatArray_FloatRange) {
+		// Sample the whole float range, including tiny numbers, denormalized floats, overflows, infinity and NAN
+		const uint32 nStep = 0x1ff1;
+		const uint32 nNumOfValues = 0xffffffffu/nStep + 1;
+		float  *pfSource = new float[nNumOfValues];
+		uint16 *pnResult = new uint16[nNumOfValues];
+		for (uint32 i=0; i<nNumOfValues; i++)
+			pfSource[i] = FromBits(i*nStep);
+		Half::FromFloatArray(pfSource, pnResult, nNumOfValues);
+		uint32 nErrors = 0;
+		for (uint32 i=0; i<nNumOfValues; i++) {
+			if (!IsSameHalf(Half::FromFloat(pfSource[i]), pnResult[i]))
+				nErrors++;
+		}
+		delete [] pnResult;
+		delete [] pfSource;
+		CHECK_EQUAL(0u, nErrors);
+	}
+
+	TEST(Array_RemainingValues) {
+		// Counts which are not a multiple of the SIMD block size must neither be truncated nor write behind the end
+		const float fSource[19] = { 0.0f, -0.0f, 1.0f, -1.0f, 0.5f, 65504.0f, 70000.0f, 6.0e-8f, 3.14159f, -2.71828f, 1000.0f, 0.1f, -0.1f, 2.0f, 4.0f, 8.0f, 16.0f, 32.0f, 64.0f };
+		for (uint32 nCount=1; nCount<=17; nCount++) {
+			uint16 nHalf[19];
+			float  fFloat[19];
+			nHalf[nCount]  = 0xabcd;
+			fFloat[nCount] = 123.0f;
+			Half::FromFloatArray(fSource, nHalf, nCount);
+			Half::ToFloatArray(nHalf, fFloat, nCount);
+			for (uint32 i=0; i<nCount; i++) {
+				CHECK_EQUAL(Half::FromFloat(fSource[i]), nHalf[i]);
+				CHECK_EQUAL(Half::ToFloat(nHalf[i]), fFloat[i]);
+			}
+			CHECK_EQUAL(0xabcd, nHalf[nCount]);
+			CHECK_EQUAL(123.0f, fFloat[nCount]);
+		}
+	}
+}
@@ -0,0 +1,245 @@
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <UnitTest++/UnitTest++.h>
+#include <PLCore/Container/Array.h>
+#include <PLMath/Math.h>
+#include <PLMath/PlaneSet.h>
+#include <PLMath/Intersect.h>
+#include <PLMath/Matrix3x4.h>
+#include <PLMath/Quadtree.h>
+#include <PLMath/LooseOctree.h>
+
+using namespace PLCore;
+using namespace PLMath;
+
+/*
+* Naming Convention for SUITE:
+* CLASSNAME
+*/
+SUITE(LooseOctree) {
+	/*
+	* Naming Convention for METHOD:
+	* METHODNAME_SCENARIO
+	*/
+
+	// Enough items to use multiple build threads
+	static const uint32 NumOfItems = 20000;
+
+	// Returns a random bounding box, mostly small ones but some large ones as well
+	static AABoundingBox GetRandomBox()
+	{
+		const Vector3 vCenter(Math::GetRandNegFloat()*100.0f, Math::GetRandNegFloat()*100.0f, Math::GetRandNegFloat()*20.0f);
+		const float fSize = (Math::GetRand() % 50) ? Math::GetRandMinMaxFloat(0.01f, 2.0f) : Math::GetRandMinMaxFloat(10.0f, 80.0f);
+		const Vector3 vHalfSize(fSize, Math::GetRandFloat()*fSize, Math::GetRandFloat()*fSize);
+		return AABoundingBox(vCenter - vHalfSize, vCenter + vHalfSize);
+	}
+
+	// Returns a rotated box plane set
+	static void GetPlaneSet(PlaneSet &cPlaneSet)
+	{
+		cPlaneSet.CreateBox(Vector3(-30.0f, -10.0f, -5.0f), Vector3(40.0f, 20.0f, 5.0f));
+		Matrix3x4 mTransform;
+		mTransform.FromEulerAngleZ(0.5f);
+		cPlaneSet *= mTransform;
+	}
+
+	// Brute force ray/box test
+	static bool RayBox(const Vector3 &vOrigin, const Vector3 &vDirection, float fMaxDistance, const AABoundingBox &cBox)
+	{
+		float fNear = 0.0f, fFar = fMaxDistance;
+		for (uint32 i=0; i<3; i++) {
+			if (vDirection[i] == 0.0f) {
+				if (vOrigin[i] < cBox.vMin[i] || vOrigin[i] > cBox.vMax[i])
+					return false;
+			} else {
+				const float fT1 = (cBox.vMin[i] - vOrigin[i])/vDirection[i];
+				const float fT2 = (cBox.vMax[i] - vOrigin[i])/vDirection[i];
+				fNear = Math::Max(fNear, Math::Min(fT1, fT2));
+				fFar  = Math::Min(fFar,  Math::Max(fT1, fT2));
+				if (fNear > fFar)
+					return false;
+			}
+		}
+		return true;
+	}
+
+	// Compares a query result against the expected item set
+	static bool AreEqualItemSets(const uint32 *pnItems, uint32 nNumOfItems, const Array<bool> &lstExpected)
+	{
+		uint32 nNumOfExpected = 0;
+		for (uint32 i=0; i<lstExpected.GetNumOfElements(); i++) {
+			if (lstExpected[i])
+				nNumOfExpected++;
+		}
+		if (nNumOfItems != nNumOfExpected)
+			return false;
+		for (uint32 i=0; i<nNumOfItems; i++) {
+			if (pnItems[i] >= lstExpected.GetNumOfElements() || !lstExpected[pnItems[i]])
+				return false;
+		}
+		return true;
+	}
+
+	// Checks the plane set and ray queries of the given octree against brute force
+	static bool CheckQueries(const LooseOctree &cOctree, const AABoundingBox *pcBoxes, const Array<bool> &lstInside)
+	{
+		uint32 *pnItems = new uint32[NumOfItems];
+		Array<bool> lstExpected;
+		lstExpected.Resize(NumOfItems);
+		bool bResult = true;
+
+		// Plane set query
+		PlaneSet cPlaneSet;
+		GetPlaneSet(cPlaneSet);
+		for (uint32 i=0; i<NumOfItems; i++)
+			lstExpected[i] = lstInside[i] && Intersect::PlaneSetAABox(cPlaneSet, pcBoxes[i].vMin, pcBoxes[i].vMax);
+		uint32 nNumOfItems = cOctree.GetItems(cPlaneSet, pnItems, NumOfItems);
+		if (!AreEqualItemSets(pnItems, nNumOfItems, lstExpected))
+			bResult = false;
+
+		// Ray queries, with and without maximum distance
+		const Vector3 vOrigin(-120.0f, 3.0f, 1.0f);
+		const Vector3 vDirection(1.0f, 0.05f, 0.0f);
+		for (uint32 nPass=0; nPass<2; nPass++) {
+			const float fMaxDistance = nPass ? 150.0f : -1.0f;
+			for (uint32 i=0; i<NumOfItems; i++)
+				lstExpected[i] = lstInside[i] && RayBox(vOrigin, vDirection, nPass ? fMaxDistance : 1.0e30f, pcBoxes[i]);
+			nNumOfItems = cOctree.GetItems(vOrigin, vDirection, pnItems, NumOfItems, fMaxDistance);
+			if (!AreEqualItemSets(pnItems, nNumOfItems, lstExpected))
+				bResult = false;
+		}
+
+		delete [] pnItems;
+		return bResult;
+	}
+
+	struct ConstructTest {
+		ConstructTest() :
+			pcBoxes(new AABoundingBox[NumOfItems])
+		{
+			lstInside.Resize(NumOfItems);
+			for (uint32 i=0; i<NumOfItems; i++) {
+				pcBoxes[i]   = GetRandomBox();
+				lstInside[i] = true;
+			}
+		}
+
+		~ConstructTest()
+		{
+			delete [] pcBoxes;
+		}
+
+		AABoundingBox *pcBoxes;
+		Array<bool>	   lstInside;
+	};
+
+	TEST(Empty) {
+		LooseOctree cOctree;
+		uint32 nItem = 0;
+		PlaneSet cPlaneSet;
+		GetPlaneSet(cPlaneSet);
+		CHECK(!cOctree.Insert(0, AABoundingBox(-1.0f, -1.0f, -1.0f, 1.0f, 1.0f, 1.0f)));
+		CHECK_EQUAL(0u, cOctree.GetItems(cPlaneSet, &nItem, 1));
+		cOctree.Build(nullptr, 0);
+		CHECK_EQUAL(0u, cOctree.GetNumOfItems());
+		CHECK_EQUAL(0u, cOctree.GetItems(cPlaneSet, &nItem, 1));
+	}
+
+	TEST_FIXTURE(ConstructTest, Build_SingleThread) {
+		LooseOctree cOctree;
+		cOctree.Build(pcBoxes, NumOfItems, 16, 1);
+		CHECK_EQUAL(NumOfItems, cOctree.GetNumOfItems());
+		CHECK(cOctree.GetNumOfNodes() > 1);
+		CHECK(CheckQueries(cOctree, pcBoxes, lstInside));
+	}
+
+	TEST_FIXTURE(ConstructTest, Build_MultipleThreads) {
+		LooseOctree cSingleThreadOctree, cOctree;
+		cSingleThreadOctree.Build(pcBoxes, NumOfItems, 16, 1);
+		cOctree.Build(pcBoxes, NumOfItems, 16, 4);
+		CHECK_EQUAL(NumOfItems, cOctree.GetNumOfItems());
+		CHECK_EQUAL(cSingleThreadOctree.GetNumOfNodes(), cOctree.GetNumOfNodes());
+		CHECK(CheckQueries(cOctree, pcBoxes, lstInside));
+	}
+
+	TEST_FIXTURE(ConstructTest, Insert_Remove_Update) {
+		LooseOctree cOctree;
+		cOctree.Init(AABoundingBox(-100.0f, -100.0f, -20.0f, 100.0f, 100.0f, 20.0f), 8);
+		for (uint32 i=0; i<NumOfItems; i++)
+			CHECK(cOctree.Insert(i, pcBoxes[i]));
+		CHECK(!cOctree.Insert(0, pcBoxes[0]));
+		CHECK_EQUAL(NumOfItems, cOctree.GetNumOfItems());
+		CHECK(CheckQueries(cOctree, pcBoxes, lstInside));
+
+		// Remove every third item and move every fifth item
+		for (uint32 i=0; i<NumOfItems; i+=3) {
+			CHECK(cOctree.Remove(i));
+			lstInside[i] = false;
+		}
+		CHECK(!cOctree.Remove(0));
+		CHECK(!cOctree.HasItem(0));
+		for (uint32 i=1; i<NumOfItems; i+=5) {
+			pcBoxes[i] = GetRandomBox();
+			CHECK_EQUAL(lstInside[i], cOctree.Update(i, pcBoxes[i]));
+		}
+		CHECK_EQUAL(NumOfItems - (NumOfItems + 2)/3, cOctree.GetNumOfItems());
+		CHECK(CheckQueries(cOctree, pcBoxes, lstInside));
+
+		// Items outside the initial region
+		pcBoxes[0]  = AABoundingBox(500.0f, 500.0f, 500.0f, 501.0f, 501.0f, 501.0f);
+		lstInside[0] = true;
+		CHECK(cOctree.Insert(0, pcBoxes[0]));
+		CHECK(CheckQueries(cOctree, pcBoxes, lstInside));
+	}
+
+	TEST_FIXTURE(ConstructTest, GetItems_MaxItems) {
+		LooseOctree cOctree;
+		cOctree.Build(pcBoxes, NumOfItems);
+		uint32 nItems[10];
+		CHECK_EQUAL(10u, cOctree.GetItems(Vector3(-120.0f, 3.0f, 1.0f), Vector3(1.0f, 0.0f, 0.0f), nItems, 10));
+		CHECK_EQUAL(0u, cOctree.GetItems(Vector3(-120.0f, 3.0f, 1.0f), Vector3(1.0f, 0.0f, 0.0f), nItems, 0));
+	}
+
+	TEST(Quadtree_GetVisiblePatches) {
+		// Odd sizes, all patches must be covered
+		const uint32 nXSize = 13, nYSize = 7;
+		QuadtreePatch cPatches[nXSize*nYSize];
+		QuadtreePatch *pPatches[nXSize*nYSize];
+		for (uint32 nY=0; nY<nYSize; nY++) {
+			for (uint32 nX=0; nX<nXSize; nX++) {
+				QuadtreePatch &cPatch = cPatches[nY*nXSize + nX];
+				cPatch.GetBBMin().SetXYZ(nX*10.0f - 70.0f, nY*10.0f - 40.0f, -1.0f);
+				cPatch.GetBBMax().SetXYZ(nX*10.0f - 60.0f, nY*10.0f - 30.0f,  1.0f);
+				pPatches[nY*nXSize + nX] = &cPatch;
+			}
+		}
+		Quadtree cQuadtree;
+		cQuadtree.Init(0, 0, nXSize, nYSize);
+		cQuadtree.Build();
+		cQuadtree.UpdateBoundingBoxes(pPatches);
+
+		// Compare against the visibility flags
+		PlaneSet cPlaneSet;
+		GetPlaneSet(cPlaneSet);
+		uint32 nPatches[nXSize*nYSize];
+		for (uint32 nPass=0; nPass<2; nPass++) {
+			cQuadtree.UpdateVisibility(cPlaneSet, pPatches);
+			const uint32 nNumOfPatches = cQuadtree.GetVisiblePatches(cPlaneSet, nPatches, nXSize*nYSize);
+			uint32 nNumOfExpected = 0;
+			for (uint32 i=0; i<nXSize*nYSize; i++) {
+				if (Intersect::PlaneSetAABox(cPlaneSet, cPatches[i].GetBBMin(), cPatches[i].GetBBMax()))
+					nNumOfExpected++;
+				CHECK_EQUAL(Intersect::PlaneSetAABox(cPlaneSet, cPatches[i].GetBBMin(), cPatches[i].GetBBMax()), cPatches[i].IsVisible());
+			}
+			CHECK_EQUAL(nNumOfExpected, nNumOfPatches);
+			for (uint32 i=0; i<nNumOfPatches; i++)
+				CHECK(cPatches[nPatches[i]].IsVisible());
+
+			// Move a patch into the plane set and update only this patch
+			cPatches[nXSize*nYSize - 1].GetBBMin().SetXYZ(0.0f, 0.0f, -1.0f);
+			cPatches[nXSize*nYSize - 1].GetBBMax().SetXYZ(1.0f, 1.0f,  1.0f);
+			cQuadtree.UpdatePatchBoundingBox(pPatches, nXSize - 1, nYSize - 1);
+		}
+	}
+}
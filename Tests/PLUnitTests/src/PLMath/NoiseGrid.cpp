@@ -0,0 +1,154 @@
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <UnitTest++/UnitTest++.h>
+#include <PLMath/Vector2.h>
+#include <PLMath/Vector3.h>
+#include <PLMath/SimplexNoise.h>
+#include <PLMath/PerlinNoiseTurbulence.h>
+#include <PLMath/NoiseGrid.h>
+
+using namespace PLMath;
+
+/*
+* Naming Convention for SUITE:
+* CLASSNAME
+*/
+SUITE(NoiseGrid) {
+	/*
+	* Naming Convention for METHOD:
+	* METHODNAME_SCENARIO
+	*/
+
+	// Odd sizes so the SIMD code path and the remaining samples are both covered, large enough for multiple threads
+	static const PLCore::uint32 Width  = 67;
+	static const PLCore::uint32 Height = 33;
+	static const PLCore::uint32 Depth  = 17;
+
+	struct ConstructTest
+	{
+		ConstructTest() :
+			vOrigin(-3.7f, 1.3f, -0.6f),
+			vStep(0.173f, 0.219f, 0.311f)
+		{
+			/* some setup */
+			pfGrid = new float[Width*Height*Depth];
+		}
+		~ConstructTest() {
+			/* some teardown */
+			delete [] pfGrid;
+		}
+
+		inline Vector3 GetPosition(PLCore::uint32 nX, PLCore::uint32 nY, PLCore::uint32 nZ) const
+		{
+			return Vector3(vOrigin.x + nX*vStep.x, vOrigin.y + nY*vStep.y, vOrigin.z + nZ*vStep.z);
+		}
+
+		float  *pfGrid;
+		Vector3 vOrigin;
+		Vector3 vStep;
+	};
+
+	TEST_FIXTURE(ConstructTest, Noise2_Perlin) {
+		NoiseGrid::Noise2(NoiseGrid::Perlin, pfGrid, Width, Height, Vector2(vOrigin.x, vOrigin.y), Vector2(vStep.x, vStep.y));
+		for (PLCore::uint32 nY=0; nY<Height; nY++) {
+			for (PLCore::uint32 nX=0; nX<Width; nX++) {
+				const Vector3 vPosition = GetPosition(nX, nY, 0);
+				const double vec[2] = { vPosition.x, vPosition.y };
+				CHECK_CLOSE(PerlinNoise::Noise2(vec), pfGrid[nY*Width + nX], 0.0001);
+			}
+		}
+	}
+
+	TEST_FIXTURE(ConstructTest, Noise3_Perlin) {
+		NoiseGrid::Noise3(NoiseGrid::Perlin, pfGrid, Width, Height, Depth, vOrigin, vStep);
+		for (PLCore::uint32 nZ=0; nZ<Depth; nZ++) {
+			for (PLCore::uint32 nY=0; nY<Height; nY++) {
+				for (PLCore::uint32 nX=0; nX<Width; nX++) {
+					const Vector3 vPosition = GetPosition(nX, nY, nZ);
+					const double vec[3] = { vPosition.x, vPosition.y, vPosition.z };
+					CHECK_CLOSE(PerlinNoise::Noise3(vec), pfGrid[(nZ*Height + nY)*Width + nX], 0.0001);
+				}
+			}
+		}
+	}
+
+	TEST_FIXTURE(ConstructTest, Noise3_Perlin_SingleThread) {
+		// Must produce exactly the same result as the multithreaded version
+		float *pfReference = new float[Width*Height*Depth];
+		NoiseGrid::Noise3(NoiseGrid::Perlin, pfReference, Width, Height, Depth, vOrigin, vStep, 1);
+		NoiseGrid::Noise3(NoiseGrid::Perlin, pfGrid, Width, Height, Depth, vOrigin, vStep, 4);
+		CHECK_ARRAY_EQUAL(pfReference, pfGrid, Width*Height*Depth);
+		delete [] pfReference;
+	}
+
+	TEST_FIXTURE(ConstructTest, Noise2_Simplex) {
+		NoiseGrid::Noise2(NoiseGrid::Simplex, pfGrid, Width, Height, Vector2(vOrigin.x, vOrigin.y), Vector2(vStep.x, vStep.y));
+		for (PLCore::uint32 nY=0; nY<Height; nY++) {
+			for (PLCore::uint32 nX=0; nX<Width; nX++) {
+				const Vector3 vPosition = GetPosition(nX, nY, 0);
+				const float fValue = SimplexNoise::Noise2(vPosition.x, vPosition.y);
+				CHECK(fValue >= -1.0f && fValue <= 1.0f);
+				CHECK_CLOSE(fValue, pfGrid[nY*Width + nX], 0.0001f);
+			}
+		}
+	}
+
+	TEST_FIXTURE(ConstructTest, Noise3_Simplex) {
+		NoiseGrid::Noise3(NoiseGrid::Simplex, pfGrid, Width, Height, Depth, vOrigin, vStep);
+		for (PLCore::uint32 nZ=0; nZ<Depth; nZ++) {
+			for (PLCore::uint32 nY=0; nY<Height; nY++) {
+				for (PLCore::uint32 nX=0; nX<Width; nX++) {
+					const Vector3 vPosition = GetPosition(nX, nY, nZ);
+					const float fValue = SimplexNoise::Noise3(vPosition.x, vPosition.y, vPosition.z);
+					CHECK(fValue >= -1.0f && fValue <= 1.0f);
+					CHECK_CLOSE(fValue, pfGrid[(nZ*Height + nY)*Width + nX], 0.0001f);
+				}
+			}
+		}
+	}
+
+	TEST_FIXTURE(ConstructTest, FractalSum3_Perlin) {
+		NoiseGrid::FractalSum3(NoiseGrid::Perlin, pfGrid, Width, Height, Depth, vOrigin, vStep, 2.0f, 2.0f, 4);
+		for (PLCore::uint32 nZ=0; nZ<Depth; nZ++) {
+			for (PLCore::uint32 nY=0; nY<Height; nY++) {
+				for (PLCore::uint32 nX=0; nX<Width; nX++) {
+					const Vector3 vPosition = GetPosition(nX, nY, nZ);
+					double fSum = 0.0, fScale = 1.0, vec[3] = { vPosition.x, vPosition.y, vPosition.z };
+					for (int nOctave=0; nOctave<4; nOctave++) {
+						fSum += PerlinNoise::Noise3(vec)/fScale;
+						fScale *= 2.0;
+						vec[0] *= 2.0;
+						vec[1] *= 2.0;
+						vec[2] *= 2.0;
+					}
+					CHECK_CLOSE(fSum, pfGrid[(nZ*Height + nY)*Width + nX], 0.001);
+				}
+			}
+		}
+	}
+
+	TEST_FIXTURE(ConstructTest, Turbulence3) {
+		NoiseGrid::Turbulence3(pfGrid, Width, Height, Depth, vOrigin, vStep, 8.0f);
+		for (PLCore::uint32 nZ=0; nZ<Depth; nZ++) {
+			for (PLCore::uint32 nY=0; nY<Height; nY++) {
+				for (PLCore::uint32 nX=0; nX<Width; nX++) {
+					const Vector3 vPosition = GetPosition(nX, nY, nZ);
+					CHECK_CLOSE(PerlinNoiseTurbulence::Turbulence3(vPosition.x, vPosition.y, vPosition.z, 8.0f), pfGrid[(nZ*Height + nY)*Width + nX], 0.001f);
+				}
+			}
+		}
+	}
+
+	TEST_FIXTURE(ConstructTest, TileableTurbulence3) {
+		const Vector3 vSize(Width*vStep.x, Height*vStep.y, Depth*vStep.z);
+		NoiseGrid::TileableTurbulence3(pfGrid, Width, Height, Depth, Vector3::Zero, vStep, vSize, 4.0f);
+		for (PLCore::uint32 nZ=0; nZ<Depth; nZ++) {
+			for (PLCore::uint32 nY=0; nY<Height; nY++) {
+				for (PLCore::uint32 nX=0; nX<Width; nX++) {
+					CHECK_CLOSE(PerlinNoiseTurbulence::TileableTurbulence3(nX*vStep.x, nY*vStep.y, nZ*vStep.z, vSize.x, vSize.y, vSize.z, 4.0f), pfGrid[(nZ*Height + nY)*Width + nX], 0.001f);
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,197 @@
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <UnitTest++/UnitTest++.h>
+#include <PLMath/Math.h>
+#include <PLMath/Matrix3x4.h>
+#include <PLMath/PoseBuffer.h>
+
+using namespace PLCore;
+using namespace PLMath;
+
+/*
+* Naming Convention for SUITE:
+* CLASSNAME
+*/
+SUITE(PoseBuffer) {
+	/*
+	* Naming Convention for METHOD:
+	* METHODNAME_SCENARIO
+	*/
+
+	// Not a multiple of four so the padding is covered as well
+	static const uint32 NumOfJoints = 23;
+
+	// Returns a random normalized rotation
+	static Quaternion GetRandomRotation()
+	{
+		return Quaternion(Math::GetRandNegFloat(), Math::GetRandNegFloat(), Math::GetRandNegFloat(), Math::GetRandNegFloat()).GetNormalized();
+	}
+
+	// Fills the given pose with random joint poses
+	static void SetRandomPose(PoseBuffer &cPose, bool bUniformScale)
+	{
+		for (uint32 nJoint=0; nJoint<cPose.GetNumOfJoints(); nJoint++) {
+			const float fScale = Math::GetRandMinMaxFloat(0.5f, 2.0f);
+			const Vector3 vScale = bUniformScale ? Vector3(fScale, fScale, fScale) : Vector3(fScale, Math::GetRandMinMaxFloat(0.5f, 2.0f), Math::GetRandMinMaxFloat(0.5f, 2.0f));
+			cPose.SetJoint(nJoint, Vector3(Math::GetRandNegFloat(), Math::GetRandNegFloat(), Math::GetRandNegFloat())*10.0f, GetRandomRotation(), vScale);
+		}
+	}
+
+	// Checks whether or not two rotations are equal, "q" and "-q" describe the same rotation
+	static bool AreEqualRotations(const Quaternion &q1, const Quaternion &q2, float fEpsilon)
+	{
+		return (Math::AreEqual(Math::Abs(q1.DotProduct(q2)), 1.0f, fEpsilon));
+	}
+
+	// Checks whether or not two vectors are equal
+	static bool AreEqualVectors(const Vector3 &v1, const Vector3 &v2, float fEpsilon)
+	{
+		return (Math::AreEqual(v1.x, v2.x, fEpsilon) && Math::AreEqual(v1.y, v2.y, fEpsilon) && Math::AreEqual(v1.z, v2.z, fEpsilon));
+	}
+
+	// Checks whether or not two matrices are equal
+	static bool AreEqualMatrices(const Matrix3x4 &m1, const Matrix3x4 &m2, float fEpsilon)
+	{
+		for (uint32 i=0; i<12; i++) {
+			if (!Math::AreEqual(m1.fM[i], m2.fM[i], fEpsilon))
+				return false;
+		}
+		return true;
+	}
+
+	struct ConstructTest
+	{
+		ConstructTest() :
+			cPose1(NumOfJoints),
+			cPose2(NumOfJoints)
+		{
+			/* some setup */
+			SetRandomPose(cPose1, false);
+			SetRandomPose(cPose2, false);
+		}
+		~ConstructTest() {
+			/* some teardown */
+		}
+
+		PoseBuffer cPose1;
+		PoseBuffer cPose2;
+		PoseBuffer cResult;
+	};
+
+	TEST(Resize_Identity) {
+		PoseBuffer cPose(3);
+		cPose.SetJoint(1, Vector3(1.0f, 2.0f, 3.0f), Quaternion(0.0f, 1.0f, 0.0f, 0.0f), Vector3(2.0f, 2.0f, 2.0f));
+		cPose.Resize(9);
+		CHECK_EQUAL(9u, cPose.GetNumOfJoints());
+		CHECK(cPose.GetPosition(1) == Vector3(1.0f, 2.0f, 3.0f));
+		CHECK(cPose.GetRotation(1) == Quaternion(0.0f, 1.0f, 0.0f, 0.0f));
+		CHECK(cPose.GetScale(1)    == Vector3(2.0f, 2.0f, 2.0f));
+		for (uint32 nJoint=3; nJoint<9; nJoint++) {
+			CHECK(cPose.GetPosition(nJoint) == Vector3::Zero);
+			CHECK(cPose.GetRotation(nJoint) == Quaternion::Identity);
+			CHECK(cPose.GetScale(nJoint)    == Vector3::One);
+		}
+
+		// Shrinking and growing again must give identity poses, not the old ones
+		cPose.Resize(1);
+		cPose.Resize(2);
+		CHECK(cPose.GetPosition(1) == Vector3::Zero);
+		CHECK(cPose.GetRotation(1) == Quaternion::Identity);
+	}
+
+	TEST_FIXTURE(ConstructTest, Nlerp_Scalar) {
+		CHECK(PoseBuffer::Nlerp(cPose1, cPose2, 0.3f, cResult));
+		CHECK_EQUAL(NumOfJoints, cResult.GetNumOfJoints());
+		for (uint32 nJoint=0; nJoint<NumOfJoints; nJoint++) {
+			const Quaternion qFrom = cPose1.GetRotation(nJoint);
+			Quaternion qTo = cPose2.GetRotation(nJoint);
+			if (qFrom.DotProduct(qTo) < 0.0f)
+				qTo *= -1.0f;
+			const Quaternion qExpected = (qFrom*0.7f + qTo*0.3f).GetNormalized();
+			const Quaternion qResult   = cResult.GetRotation(nJoint);
+			CHECK_CLOSE(qExpected.w, qResult.w, 0.0001f);
+			CHECK_CLOSE(qExpected.x, qResult.x, 0.0001f);
+			CHECK_CLOSE(qExpected.y, qResult.y, 0.0001f);
+			CHECK_CLOSE(qExpected.z, qResult.z, 0.0001f);
+			CHECK(AreEqualVectors(cResult.GetPosition(nJoint), cPose1.GetPosition(nJoint)*0.7f + cPose2.GetPosition(nJoint)*0.3f, 0.0001f));
+			CHECK(AreEqualVectors(cResult.GetScale(nJoint), cPose1.GetScale(nJoint)*0.7f + cPose2.GetScale(nJoint)*0.3f, 0.0001f));
+		}
+	}
+
+	TEST_FIXTURE(ConstructTest, Slerp_Quaternion) {
+		// Add nearly equal rotations which use the linear interpolation
+		cPose2.SetJoint(0, Vector3::Zero, cPose1.GetRotation(0));
+		cPose2.SetJoint(1, Vector3::Zero, cPose1.GetRotation(1)*-1.0f);
+		const float fTimes[] = { 0.0f, 0.25f, 0.5f, 0.9f, 1.0f };
+		for (uint32 t=0; t<5; t++) {
+			CHECK(PoseBuffer::Slerp(cPose1, cPose2, fTimes[t], cResult));
+			for (uint32 nJoint=0; nJoint<NumOfJoints; nJoint++) {
+				Quaternion qExpected;
+				qExpected.Slerp(cPose1.GetRotation(nJoint), cPose2.GetRotation(nJoint), fTimes[t]);
+				const Quaternion qResult = cResult.GetRotation(nJoint);
+				CHECK_CLOSE(qExpected.w, qResult.w, 0.0001f);
+				CHECK_CLOSE(qExpected.x, qResult.x, 0.0001f);
+				CHECK_CLOSE(qExpected.y, qResult.y, 0.0001f);
+				CHECK_CLOSE(qExpected.z, qResult.z, 0.0001f);
+			}
+		}
+	}
+
+	TEST_FIXTURE(ConstructTest, Blend_Weights) {
+		float fWeights[NumOfJoints];
+		for (uint32 nJoint=0; nJoint<NumOfJoints; nJoint++)
+			fWeights[nJoint] = static_cast<float>(nJoint%2);
+		CHECK(PoseBuffer::Blend(cPose1, cPose2, fWeights, cResult));
+		for (uint32 nJoint=0; nJoint<NumOfJoints; nJoint++) {
+			const PoseBuffer &cExpected = (nJoint%2) ? cPose2 : cPose1;
+			CHECK(AreEqualRotations(cExpected.GetRotation(nJoint), cResult.GetRotation(nJoint), 0.0001f));
+			CHECK(AreEqualVectors(cResult.GetPosition(nJoint), cExpected.GetPosition(nJoint), 0.0001f));
+			CHECK(AreEqualVectors(cResult.GetScale(nJoint), cExpected.GetScale(nJoint), 0.0001f));
+		}
+
+		// Different number of joints
+		PoseBuffer cOther(NumOfJoints - 1);
+		CHECK(!PoseBuffer::Blend(cPose1, cOther, fWeights, cResult));
+	}
+
+	TEST_FIXTURE(ConstructTest, ToMatrices_Quaternion) {
+		Matrix3x4 mMatrices[NumOfJoints];
+		PoseBuffer::ToMatrices(cPose1, mMatrices);
+		for (uint32 nJoint=0; nJoint<NumOfJoints; nJoint++) {
+			Matrix3x4 mRotation;
+			cPose1.GetRotation(nJoint).ToRotationMatrix(mRotation);
+			Matrix3x4 mExpected;
+			mExpected.SetScaleMatrix(cPose1.GetScale(nJoint));
+			mExpected = mRotation*mExpected;
+			mExpected.xw = cPose1.GetPosition(nJoint).x;
+			mExpected.yw = cPose1.GetPosition(nJoint).y;
+			mExpected.zw = cPose1.GetPosition(nJoint).z;
+			CHECK(AreEqualMatrices(mExpected, mMatrices[nJoint], 0.0001f));
+		}
+	}
+
+	TEST_FIXTURE(ConstructTest, LocalToModel_Matrices) {
+		// Random hierarchy with multiple roots, parents are located in front of their children
+		int32 nParents[NumOfJoints];
+		for (uint32 nJoint=0; nJoint<NumOfJoints; nJoint++)
+			nParents[nJoint] = (nJoint%7) ? static_cast<int32>(Math::GetRand()%nJoint) : -1;
+
+		// With uniform scales the result must be equal to the concatenation of the joint matrices
+		SetRandomPose(cPose1, true);
+		Matrix3x4 mLocal[NumOfJoints], mModel[NumOfJoints];
+		PoseBuffer::ToMatrices(cPose1, mLocal);
+		PoseBuffer::LocalToModel(cPose1, nParents, cResult);
+		PoseBuffer::ToMatrices(cResult, mModel);
+		for (uint32 nJoint=0; nJoint<NumOfJoints; nJoint++) {
+			if (nParents[nJoint] >= 0)
+				mLocal[nJoint] = mLocal[nParents[nJoint]]*mLocal[nJoint];
+			CHECK(AreEqualMatrices(mLocal[nJoint], mModel[nJoint], 0.001f));
+		}
+
+		// In place
+		PoseBuffer::LocalToModel(cPose1, nParents, cPose1);
+		for (uint32 nJoint=0; nJoint<NumOfJoints; nJoint++)
+			CHECK(AreEqualVectors(cPose1.GetPosition(nJoint), cResult.GetPosition(nJoint), 0.0001f));
+	}
+}
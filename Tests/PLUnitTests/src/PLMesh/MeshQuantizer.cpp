@@ -0,0 +1,128 @@
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <UnitTest++/UnitTest++.h>
+#include <PLCore/Runtime.h>
+#include <PLMath/Math.h>
+#include <PLGraphics/Color/Color4.h>
+#include <PLRenderer/RendererContext.h>
+#include <PLRenderer/Renderer/Renderer.h>
+#include <PLRenderer/Renderer/VertexBuffer.h>
+#include <PLMesh/MeshQuantizer.h>
+#include "UnitTest++AddIns/PLCheckMacros.h"
+#include "UnitTest++AddIns/PLChecks.h"
+
+using namespace PLCore;
+using namespace PLMath;
+using namespace PLGraphics;
+using namespace PLRenderer;
+using namespace PLMesh;
+
+/*
+* Naming Convention for SUITE:
+* CLASSNAME
+*/
+SUITE(MeshQuantizer) {
+	/*
+	* Naming Convention for METHOD:
+	* METHODNAME_SCENARIO
+	*/
+	const uint32 vertices = 1000;	// Number of vertices of the test vertex buffer
+
+	// Our mesh quantizer Test Fixture :)
+	struct ConstructTest
+	{
+		ConstructTest() :
+			pRendererContext(nullptr),
+			pVertexBuffer(nullptr)
+		{
+			/* some setup */
+			// The null renderer backend is sufficient, it keeps the vertex data within system memory
+			Runtime::ScanDirectoryPluginsAndData(false);
+			pRendererContext = RendererContext::CreateInstance("PLRendererNull::Renderer", NULL_HANDLE);
+			if (pRendererContext) {
+				// Typical static mesh vertex layout
+				pVertexBuffer = pRendererContext->GetRenderer().CreateVertexBuffer();
+				pVertexBuffer->AddVertexAttribute(VertexBuffer::Position, 0, VertexBuffer::Float3);
+				pVertexBuffer->AddVertexAttribute(VertexBuffer::Normal,   0, VertexBuffer::Float3);
+				pVertexBuffer->AddVertexAttribute(VertexBuffer::Tangent,  0, VertexBuffer::Float3);
+				pVertexBuffer->AddVertexAttribute(VertexBuffer::TexCoord, 0, VertexBuffer::Float2);
+				pVertexBuffer->AddVertexAttribute(VertexBuffer::Color,    0, VertexBuffer::RGBA);
+				pVertexBuffer->Allocate(vertices);
+				if (pVertexBuffer->Lock(Lock::WriteOnly)) {
+					for (uint32 i=0; i<vertices; i++) {
+						const float fAngle = static_cast<float>(i)*0.01f;
+						const float fNormal[3]  = { Math::Cos(fAngle), Math::Sin(fAngle), 0.0f };
+						const float fTangent[3] = { 0.0f, 0.0f, 1.0f };
+						pVertexBuffer->SetFloat(i, VertexBuffer::Position, 0, fNormal[0]*10.0f, fNormal[1]*10.0f, static_cast<float>(i%100)*0.1f);
+						pVertexBuffer->SetFloat(i, VertexBuffer::Normal,   0, fNormal[0], fNormal[1], fNormal[2]);
+						pVertexBuffer->SetFloat(i, VertexBuffer::Tangent,  0, fTangent[0], fTangent[1], fTangent[2]);
+						pVertexBuffer->SetFloat(i, VertexBuffer::TexCoord, 0, static_cast<float>(i%256)/256.0f, static_cast<float>(i/256)/64.0f);
+						pVertexBuffer->SetColor(i, Color4(0.5f, 0.25f, 1.0f, 1.0f));
+					}
+					pVertexBuffer->Unlock();
+				}
+			}
+		}
+		~ConstructTest() {
+			/* some teardown */
+			if (pVertexBuffer)
+				delete pVertexBuffer;
+			if (pRendererContext)
+				delete pRendererContext;
+		}
+
+		// Testing objects
+		RendererContext *pRendererContext;
+		VertexBuffer	*pVertexBuffer;
+		MeshQuantizer	 cMeshQuantizer;
+	};
+
+	TEST_FIXTURE(ConstructTest, Quantize_StaticMesh) {
+		CHECK(pVertexBuffer);
+		if (pVertexBuffer) {
+			MeshQuantizer::Result sResult;
+			CHECK(cMeshQuantizer.Quantize(*pVertexBuffer, &sResult));
+
+			// Normals, tangents and texture coordinates are quantized, positions are kept by default and RGBA colors are already compact
+			CHECK_EQUAL(3u, sResult.nNumOfQuantized);
+			CHECK_EQUAL(VertexBuffer::Float3,  pVertexBuffer->GetVertexAttribute(VertexBuffer::Position)->nType);
+			CHECK_EQUAL(VertexBuffer::Short4N, pVertexBuffer->GetVertexAttribute(VertexBuffer::Normal)->nType);
+			CHECK_EQUAL(VertexBuffer::Half2,   pVertexBuffer->GetVertexAttribute(VertexBuffer::TexCoord)->nType);
+			CHECK_EQUAL(VertexBuffer::RGBA,    pVertexBuffer->GetVertexAttribute(VertexBuffer::Color)->nType);
+			CHECK(sResult.nSizeAfter < sResult.nSizeBefore);
+			CHECK(sResult.fMaxVectorError <= 0.001f);
+
+			// The data must survive the quantization
+			if (pVertexBuffer->Lock(Lock::ReadOnly)) {
+				const float fAngle = 123*0.01f;
+				float fX, fY, fZ, fW;
+				pVertexBuffer->GetFloat(123, VertexBuffer::Normal, 0, fX, fY, fZ, fW);
+				CHECK_CLOSE(Math::Cos(fAngle), fX, 0.001f);
+				CHECK_CLOSE(Math::Sin(fAngle), fY, 0.001f);
+				pVertexBuffer->GetFloat(123, VertexBuffer::TexCoord, 0, fX, fY, fZ, fW);
+				CHECK_CLOSE(123.0f/256.0f, fX, 1.0f/2048.0f);
+				pVertexBuffer->Unlock();
+			}
+		}
+	}
+
+	TEST_FIXTURE(ConstructTest, Quantize_Positions) {
+		CHECK(pVertexBuffer);
+		if (pVertexBuffer) {
+			cMeshQuantizer.SetQuantizePositions(true);
+			MeshQuantizer::Result sResult;
+
+			// Half precision can't represent positions of up to 10 units within 0.001, so the positions are kept
+			CHECK(cMeshQuantizer.Quantize(*pVertexBuffer, &sResult));
+			CHECK_EQUAL(1u, sResult.nNumOfRejected);
+			CHECK_EQUAL(VertexBuffer::Float3, pVertexBuffer->GetVertexAttribute(VertexBuffer::Position)->nType);
+
+			// With a looser error bound they are quantized as well
+			cMeshQuantizer.SetMaxErrors(0.01f);
+			CHECK(cMeshQuantizer.Quantize(*pVertexBuffer, &sResult));
+			CHECK_EQUAL(VertexBuffer::Half4, pVertexBuffer->GetVertexAttribute(VertexBuffer::Position)->nType);
+			CHECK(sResult.fMaxPositionError <= 0.01f);
+		}
+	}
+}
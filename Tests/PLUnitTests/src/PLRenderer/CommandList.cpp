@@ -0,0 +1,213 @@
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <UnitTest++/UnitTest++.h>
+#include <PLCore/Runtime.h>
+#include <PLCore/System/Thread.h>
+#include <PLMath/Rectangle.h>
+#include <PLRenderer/RendererContext.h>
+#include <PLRenderer/Renderer/Renderer.h>
+#include <PLRenderer/Renderer/IndexBuffer.h>
+#include <PLRenderer/Renderer/CommandList.h>
+#include "UnitTest++AddIns/PLCheckMacros.h"
+#include "UnitTest++AddIns/PLChecks.h"
+
+using namespace PLCore;
+using namespace PLMath;
+using namespace PLRenderer;
+
+/*
+* Naming Convention for SUITE:
+* CLASSNAME
+*/
+SUITE(CommandList) {
+	/*
+	* Naming Convention for METHOD:
+	* METHODNAME_SCENARIO
+	*/
+	const uint32 draws   = 1000;	// Number of draw calls
+	const uint32 threads = 4;		// Number of threads recording command lists
+
+	// Our command list Test Fixture :)
+	struct ConstructTest
+	{
+		ConstructTest() :
+			pRendererContext(nullptr),
+			pIndexBuffer(nullptr)
+		{
+			/* some setup */
+			// The null renderer backend is sufficient, it updates the statistics like a real backend
+			Runtime::ScanDirectoryPluginsAndData(false);
+			pRendererContext = RendererContext::CreateInstance("PLRendererNull::Renderer", NULL_HANDLE);
+			if (pRendererContext) {
+				pIndexBuffer = pRendererContext->GetRenderer().CreateIndexBuffer();
+				pIndexBuffer->SetElementTypeByMaximumIndex(2999);
+				pIndexBuffer->Allocate(3000);
+			}
+		}
+		~ConstructTest() {
+			/* some teardown */
+			if (pIndexBuffer)
+				delete pIndexBuffer;
+			if (pRendererContext)
+				delete pRendererContext;
+		}
+
+		// Submits the calls of the given range of draw calls, the renderer and the command list share the same interface
+		template <class T>
+		void Submit(T &cTarget, uint32 nFirst, uint32 nNumOfDraws)
+		{
+			cTarget.SetIndexBuffer(pIndexBuffer);
+			for (uint32 i=nFirst; i<nFirst+nNumOfDraws; i++) {
+				cTarget.SetRenderState(RenderState::BlendEnable, (i/16)%2);
+				cTarget.SetRenderState(RenderState::CullMode, (i%3) ? Cull::CCW : Cull::None);
+				cTarget.SetSamplerState(0, Sampler::MagFilter, (i/8)%2 ? TextureFiltering::Linear : TextureFiltering::Point);
+				if (i%4)
+					cTarget.DrawIndexedPrimitives(Primitive::TriangleList, 0, 2999, 0, 300 + (i%10)*3);
+				else
+					cTarget.DrawPrimitivesInstanced(Primitive::TriangleStrip, 0, 4, 1 + i%7);
+			}
+		}
+
+		// Thread function recording one part of the draw calls
+		static int RecordThread(void *pData)
+		{
+			RecordJob &sJob = *static_cast<RecordJob*>(pData);
+			sJob.pTest->Submit(sJob.cCommandList, sJob.nFirst, draws/threads);
+			return 0;
+		}
+
+		// Returns a statistics snapshot of the given renderer after resetting all states
+		Statistics ResetStates()
+		{
+			Renderer &cRenderer = pRendererContext->GetRenderer();
+			cRenderer.ResetRenderStates();
+			cRenderer.ResetSamplerStates();
+			cRenderer.SetIndexBuffer();
+			return cRenderer.GetStatistics();
+		}
+
+		// Command list recorded by a thread
+		struct RecordJob {
+			ConstructTest *pTest;
+			uint32		   nFirst;
+			CommandList	   cCommandList;
+		};
+
+		// Testing objects
+		RendererContext *pRendererContext;
+		IndexBuffer		*pIndexBuffer;
+	};
+
+	TEST_FIXTURE(ConstructTest, Record_NumOfCommands) {
+		CommandList cCommandList;
+		CHECK_EQUAL(0U, cCommandList.GetNumOfCommands());
+		CHECK_EQUAL(0U, cCommandList.GetSize());
+
+		// Recording doesn't need a renderer
+		cCommandList.SetRenderState(RenderState::BlendEnable, true);
+		cCommandList.SetSamplerState(0, Sampler::MagFilter, TextureFiltering::Point);
+		cCommandList.DrawPrimitives(Primitive::TriangleList, 0, 3);
+		CHECK_EQUAL(3U, cCommandList.GetNumOfCommands());
+		const uint32 nSize = cCommandList.GetSize();
+		CHECK(nSize > 0);
+
+		// Reset and record again
+		cCommandList.Reset();
+		CHECK_EQUAL(0U, cCommandList.GetNumOfCommands());
+		CHECK_EQUAL(0U, cCommandList.GetSize());
+		cCommandList.SetRenderState(RenderState::BlendEnable, true);
+		cCommandList.SetSamplerState(0, Sampler::MagFilter, TextureFiltering::Point);
+		cCommandList.DrawPrimitives(Primitive::TriangleList, 0, 3);
+		CHECK_EQUAL(nSize, cCommandList.GetSize());
+	}
+
+	TEST_FIXTURE(ConstructTest, Execute_States) {
+		CHECK(pRendererContext);
+		if (pRendererContext) {
+			Renderer &cRenderer = pRendererContext->GetRenderer();
+			ResetStates();
+
+			// Values are copied, the rectangles don't need to stay valid
+			CommandList cCommandList;
+			{
+				const Rectangle cViewport(1.0f, 2.0f, 30.0f, 40.0f);
+				const Rectangle cScissorRect(5.0f, 6.0f, 7.0f, 8.0f);
+				cCommandList.SetViewport(&cViewport, 0.25f, 0.75f);
+				cCommandList.SetScissorRect(&cScissorRect);
+			}
+			cCommandList.SetColorMask(true, false, true, false);
+			cCommandList.SetRenderState(RenderState::CullMode, Cull::CW);
+			cCommandList.SetIndexBuffer(pIndexBuffer);
+
+			// Nothing is done before the command list is executed
+			CHECK(!cRenderer.GetIndexBuffer());
+			CHECK(cRenderer.Execute(cCommandList));
+			float fMinZ = 0.0f, fMaxZ = 0.0f;
+			const Rectangle &cViewport = cRenderer.GetViewport(&fMinZ, &fMaxZ);
+			CHECK_EQUAL(1.0f,  cViewport.vMin.x);
+			CHECK_EQUAL(40.0f, cViewport.vMax.y);
+			CHECK_EQUAL(0.25f, fMinZ);
+			CHECK_EQUAL(0.75f, fMaxZ);
+			CHECK_EQUAL(6.0f,  cRenderer.GetScissorRect().vMin.y);
+			CHECK_EQUAL(7.0f,  cRenderer.GetScissorRect().vMax.x);
+			bool bRed = false, bGreen = true, bBlue = false, bAlpha = true;
+			cRenderer.GetColorMask(bRed, bGreen, bBlue, bAlpha);
+			CHECK(bRed && !bGreen && bBlue && !bAlpha);
+			CHECK_EQUAL(static_cast<int>(Cull::CW), cRenderer.GetRenderState(RenderState::CullMode));
+			CHECK_EQUAL(pIndexBuffer, cRenderer.GetIndexBuffer());
+
+			// A failing call is reported like in immediate mode, setting the same index buffer again is a failure
+			CHECK(!cRenderer.Execute(cCommandList));
+
+			// Empty command list
+			cCommandList.Reset();
+			CHECK(cRenderer.Execute(cCommandList));
+		}
+	}
+
+	TEST_FIXTURE(ConstructTest, Execute_SameAsImmediate) {
+		CHECK(pRendererContext);
+		if (pRendererContext) {
+			Renderer &cRenderer = pRendererContext->GetRenderer();
+
+			// Call the renderer directly
+			const Statistics sImmediateBefore = ResetStates();
+			Submit(cRenderer, 0, draws);
+			const Statistics sImmediate = cRenderer.GetStatistics();
+			const int nBlendEnable = cRenderer.GetRenderState(RenderState::BlendEnable);
+			const int nCullMode    = cRenderer.GetRenderState(RenderState::CullMode);
+			const int nMagFilter   = cRenderer.GetSamplerState(0, Sampler::MagFilter);
+
+			// Record the same calls within several threads
+			RecordJob sJobs[threads];
+			Thread *pThreads[threads];
+			for (uint32 i=0; i<threads; i++) {
+				sJobs[i].pTest  = this;
+				sJobs[i].nFirst = i*(draws/threads);
+				pThreads[i] = new Thread(RecordThread, &sJobs[i]);
+				pThreads[i]->Start();
+			}
+			for (uint32 i=0; i<threads; i++) {
+				pThreads[i]->Join();
+				delete pThreads[i];
+			}
+
+			// Replay the command lists recorded by the threads, they must result in exactly the same calls
+			const Statistics sExecuteBefore = ResetStates();
+			for (uint32 i=0; i<threads; i++)
+				cRenderer.Execute(sJobs[i].cCommandList);	// Setting the same index buffer again is reported as failure, just like in immediate mode
+			const Statistics sExecute = cRenderer.GetStatistics();
+			CHECK_EQUAL(sImmediate.nRenderStateChanges  - sImmediateBefore.nRenderStateChanges,  sExecute.nRenderStateChanges  - sExecuteBefore.nRenderStateChanges);
+			CHECK_EQUAL(sImmediate.nSamplerStateChanges - sImmediateBefore.nSamplerStateChanges, sExecute.nSamplerStateChanges - sExecuteBefore.nSamplerStateChanges);
+			CHECK_EQUAL(sImmediate.nDrawPrimitivCalls   - sImmediateBefore.nDrawPrimitivCalls,   sExecute.nDrawPrimitivCalls   - sExecuteBefore.nDrawPrimitivCalls);
+			CHECK_EQUAL(sImmediate.nVertices            - sImmediateBefore.nVertices,            sExecute.nVertices            - sExecuteBefore.nVertices);
+			CHECK_EQUAL(sImmediate.nTriangles           - sImmediateBefore.nTriangles,           sExecute.nTriangles           - sExecuteBefore.nTriangles);
+			CHECK_EQUAL(draws, sExecute.nDrawPrimitivCalls - sExecuteBefore.nDrawPrimitivCalls);
+			CHECK_EQUAL(nBlendEnable, cRenderer.GetRenderState(RenderState::BlendEnable));
+			CHECK_EQUAL(nCullMode,    cRenderer.GetRenderState(RenderState::CullMode));
+			CHECK_EQUAL(nMagFilter,   cRenderer.GetSamplerState(0, Sampler::MagFilter));
+			CHECK_EQUAL(pIndexBuffer, cRenderer.GetIndexBuffer());
+		}
+	}
+}
@@ -0,0 +1,172 @@
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <UnitTest++/UnitTest++.h>
+#include <PLCore/Runtime.h>
+#include <PLCore/File/File.h>
+#include <PLMath/Matrix4x4.h>
+#include <PLGraphics/Color/Color4.h>
+#include <PLRenderer/RendererContext.h>
+#include <PLRenderer/Renderer/Renderer.h>
+#include <PLRenderer/Renderer/FontManager.h>
+#include <PLRenderer/Renderer/FontTexture.h>
+#include <PLRenderer/Renderer/GlyphAtlas.h>
+#include "UnitTest++AddIns/PLCheckMacros.h"
+#include "UnitTest++AddIns/PLChecks.h"
+
+using namespace PLCore;
+using namespace PLMath;
+using namespace PLGraphics;
+using namespace PLRenderer;
+
+/*
+* Naming Convention for SUITE:
+* CLASSNAME
+*/
+SUITE(GlyphAtlas) {
+	/*
+	* Naming Convention for METHOD:
+	* METHODNAME_SCENARIO
+	*/
+	// The null renderer backend rasterizes synthetic glyphs: at 12 points and 96 dpi they are 16 pixel high,
+	// ideographs (starting at U+2E80) are 16 pixel wide, all other characters 8 pixel
+	const uint32 ideograph = 0x4e00;	// First CJK unified ideograph
+
+	// Our glyph atlas Test Fixture :)
+	struct ConstructTest
+	{
+		ConstructTest() :
+			pRendererContext(nullptr),
+			pFont(nullptr),
+			pGlyphAtlas(nullptr)
+		{
+			/* some setup */
+			// The null renderer backend is sufficient, it updates the statistics like a real backend and its fonts are using synthetic glyphs
+			Runtime::ScanDirectoryPluginsAndData(false);
+			pRendererContext = RendererContext::CreateInstance("PLRendererNull::Renderer", NULL_HANDLE);
+			if (pRendererContext) {
+				File cFile("NullFont.ttf");
+				pFont = static_cast<FontTexture*>(pRendererContext->GetRenderer().GetFontManager().CreateFontTexture(cFile, 12, 96));
+				pGlyphAtlas = &pRendererContext->GetRenderer().GetFontManager().GetGlyphAtlas();
+			}
+		}
+		~ConstructTest() {
+			/* some teardown */
+			if (pFont)
+				delete pFont;
+			if (pRendererContext)
+				delete pRendererContext;
+		}
+
+		// Testing objects
+		RendererContext *pRendererContext;
+		FontTexture		*pFont;
+		GlyphAtlas		*pGlyphAtlas;
+	};
+
+	TEST_FIXTURE(ConstructTest, GetGlyph_PackingEfficiency) {
+		CHECK(pFont);
+		if (pFont) {
+			// Fill a single page with glyphs of several sizes and widths, all used within the same frame so nothing can be evicted
+			pGlyphAtlas->SetBackgroundRasterization(false);
+			pGlyphAtlas->SetPageSize(512);
+			pGlyphAtlas->SetMaxNumOfPages(1);
+			pGlyphAtlas->Clear();
+			bool bFull = false;
+			for (uint32 nCharacter=0; !bFull; nCharacter++) {
+				for (uint32 nSize=8; nSize<=16 && !bFull; nSize+=2) {
+					pFont->SetSize(nSize, 96);
+					const uint32 nCharacterCode = (nCharacter & 1) ? ideograph + nCharacter : 'A' + nCharacter;
+					bFull = (pGlyphAtlas->GetGlyph(*pFont, nCharacterCode)->nState != GlyphAtlas::Ready);
+				}
+			}
+
+			// All font sizes share the page, and the skyline packing wastes only a small part of it
+			CHECK_EQUAL(1U, pGlyphAtlas->GetNumOfPages());
+			CHECK_EQUAL(0U, pGlyphAtlas->GetNumOfEvictions());
+			CHECK(pGlyphAtlas->GetPackingEfficiency() > 0.75f);
+		}
+	}
+
+	TEST_FIXTURE(ConstructTest, GetGlyph_EvictsLeastRecentlyUsed) {
+		CHECK(pFont);
+		if (pFont) {
+			// A 64x64 page holds 3x3 ideographs (16x16 pixel plus padding)
+			pGlyphAtlas->SetBackgroundRasterization(false);
+			pGlyphAtlas->SetPageSize(64);
+			pGlyphAtlas->SetMaxNumOfPages(1);
+			pGlyphAtlas->Clear();
+			const GlyphAtlas::Glyph *pGlyphs[9];
+			for (uint32 i=0; i<9; i++) {
+				pGlyphs[i] = pGlyphAtlas->GetGlyph(*pFont, ideograph + i);
+				CHECK_EQUAL(GlyphAtlas::Ready, pGlyphs[i]->nState);
+			}
+
+			// The page is full and all glyphs were used within the current frame, so nothing can be evicted
+			CHECK_EQUAL(GlyphAtlas::Missing, pGlyphAtlas->GetGlyph(*pFont, ideograph + 9)->nState);
+			CHECK_EQUAL(0U, pGlyphAtlas->GetNumOfEvictions());
+
+			// Within the next frame, the first glyph is used again, so the second one is the least recently used one
+			pGlyphAtlas->Update();
+			CHECK_EQUAL(pGlyphs[0], pGlyphAtlas->GetGlyph(*pFont, ideograph));
+			CHECK_EQUAL(GlyphAtlas::Ready, pGlyphAtlas->GetGlyph(*pFont, ideograph + 9)->nState);
+			CHECK_EQUAL(1U, pGlyphAtlas->GetNumOfEvictions());
+			CHECK_EQUAL(9U, pGlyphAtlas->GetNumOfGlyphs());
+			CHECK_EQUAL(pGlyphs[0], pGlyphAtlas->GetGlyph(*pFont, ideograph));
+			CHECK_EQUAL(pGlyphs[2], pGlyphAtlas->GetGlyph(*pFont, ideograph + 2));
+
+			// Cycling through twice as many glyphs as fit into the page never needs a second page
+			for (uint32 nFrame=0; nFrame<10; nFrame++) {
+				pGlyphAtlas->Update();
+				for (uint32 i=0; i<9; i++)
+					CHECK_EQUAL(GlyphAtlas::Ready, pGlyphAtlas->GetGlyph(*pFont, ideograph + ((nFrame & 1) ? 9 : 0) + i)->nState);
+			}
+			CHECK_EQUAL(1U, pGlyphAtlas->GetNumOfPages());
+		}
+	}
+
+	TEST_FIXTURE(ConstructTest, GetGlyph_BackgroundRasterization) {
+		CHECK(pFont);
+		if (pFont) {
+			pGlyphAtlas->SetBackgroundRasterization(true);
+			pGlyphAtlas->SetPageSize(512);
+			pGlyphAtlas->SetMaxNumOfPages(4);
+			pGlyphAtlas->Clear();
+
+			// Until the background thread is done, the glyph is a placeholder
+			CHECK_EQUAL(GlyphAtlas::Pending, pGlyphAtlas->GetGlyph(*pFont, 'A')->nState);
+			CHECK_EQUAL(1U, pGlyphAtlas->GetNumOfPendingGlyphs());
+			const uint32 nGeneration = pGlyphAtlas->GetGeneration();
+
+			// Texts shaped with the placeholder must be shaped again as soon as the glyph is ready
+			pGlyphAtlas->WaitForRasterization();
+			CHECK_EQUAL(0U, pGlyphAtlas->GetNumOfPendingGlyphs());
+			CHECK(nGeneration != pGlyphAtlas->GetGeneration());
+			CHECK_EQUAL(GlyphAtlas::Ready, pGlyphAtlas->GetGlyph(*pFont, 'A')->nState);
+		}
+	}
+
+	TEST_FIXTURE(ConstructTest, DrawGlyphVertices_OneDrawCallPerPage) {
+		CHECK(pFont);
+		if (pFont) {
+			// 20 ideographs spread over three 64x64 pages
+			pGlyphAtlas->SetBackgroundRasterization(false);
+			pGlyphAtlas->SetPageSize(64);
+			pGlyphAtlas->SetMaxNumOfPages(4);
+			pGlyphAtlas->Clear();
+			wchar_t szText[21];
+			for (uint32 i=0; i<20; i++)
+				szText[i] = static_cast<wchar_t>(ideograph + i);
+			szText[20] = 0;
+			Array<Font::GlyphVertex> lstVertices;
+			CHECK(pFont->AddGlyphVertices(lstVertices, szText, Color4::White, Matrix4x4::Identity));
+			CHECK_EQUAL(20U*6, lstVertices.GetNumOfElements());
+			CHECK_EQUAL(3U, pGlyphAtlas->GetNumOfPages());
+
+			Renderer &cRenderer = pRendererContext->GetRenderer();
+			const uint32 nDrawCalls = cRenderer.GetStatistics().nDrawPrimitivCalls;
+			pFont->DrawGlyphVertices(lstVertices);
+			CHECK_EQUAL(3U, cRenderer.GetStatistics().nDrawPrimitivCalls - nDrawCalls);
+		}
+	}
+}
@@ -0,0 +1,141 @@
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <UnitTest++/UnitTest++.h>
+#include <PLCore/Runtime.h>
+#include <PLRenderer/RendererContext.h>
+#include <PLRenderer/Material/Material.h>
+#include <PLRenderer/Material/MaterialManager.h>
+#include <PLRenderer/Material/Parameter.h>
+#include <PLRenderer/Material/ParameterManager.h>
+#include "UnitTest++AddIns/PLCheckMacros.h"
+#include "UnitTest++AddIns/PLChecks.h"
+
+using namespace PLCore;
+using namespace PLRenderer;
+
+/*
+* Naming Convention for SUITE:
+* CLASSNAME
+*/
+SUITE(ParameterManager) {
+	/*
+	* Naming Convention for METHOD:
+	* METHODNAME_SCENARIO
+	*/
+
+	// Our parameter manager Test Fixture :)
+	struct ConstructTest
+	{
+		ConstructTest() :
+			pRendererContext(nullptr),
+			pMaterial(nullptr)
+		{
+			/* some setup */
+			// The null renderer backend is sufficient, no rendering is done
+			Runtime::ScanDirectoryPluginsAndData(false);
+			pRendererContext = RendererContext::CreateInstance("PLRendererNull::Renderer", NULL_HANDLE);
+			if (pRendererContext)
+				pMaterial = pRendererContext->GetMaterialManager().Create("ParameterManagerTest");
+		}
+		~ConstructTest() {
+			/* some teardown */
+			if (pMaterial)
+				delete pMaterial;
+			if (pRendererContext)
+				delete pRendererContext;
+		}
+
+		// Adds the parameters, every second one is a numeric parameter
+		void CreateParameters()
+		{
+			static const char *szNames[] = {
+				"TwoSided", "DiffuseColor", "DiffuseMap", "AlphaReference", "DiffuseRampMap", "IndexOfRefraction", "FresnelReflectionPower", "ReflectionColor"
+			};
+			for (uint32 i=0; i<8; i++) {
+				sNames[i] = szNames[i];
+				cIDs[i]   = ParameterID(sNames[i]);
+				pMaterial->GetParameterManager().CreateParameter((i%2) ? PLRenderer::Parameters::Float4 : PLRenderer::Parameters::String, sNames[i]);
+			}
+		}
+
+		// Testing objects
+		RendererContext *pRendererContext;
+		Material		*pMaterial;
+		String			 sNames[8];
+		ParameterID		 cIDs[8];
+	};
+
+	TEST_FIXTURE(ConstructTest, CreateParameter_WithoutValue) {
+		CHECK(pMaterial);
+		if (pMaterial) {
+			ParameterManager &cParameterManager = pMaterial->GetParameterManager();
+			CHECK_EQUAL(0U, cParameterManager.GetParameterBlockSize());
+
+			// A new numeric parameter gets its slot within the block even if no value was set, yet
+			cParameterManager.CreateParameter(PLRenderer::Parameters::Float4, "DiffuseColor");
+			CHECK_EQUAL(16U, cParameterManager.GetParameterBlockSize());
+			CHECK(cParameterManager.GetParameterBlockOffset(ParameterID("DiffuseColor")) >= 0);
+
+			// After the block was built, the layout must still grow with further parameters
+			cParameterManager.CreateParameter(PLRenderer::Parameters::Float4, "SpecularColor");
+			CHECK_EQUAL(32U, cParameterManager.GetParameterBlockSize());
+			CHECK(cParameterManager.GetParameterBlockOffset(ParameterID("SpecularColor")) >= 0);
+			CHECK(cParameterManager.GetParameterBlockOffset(ParameterID("SpecularColor")) != cParameterManager.GetParameterBlockOffset(ParameterID("DiffuseColor")));
+		}
+	}
+
+	TEST_FIXTURE(ConstructTest, GetParameter_SameResult) {
+		CHECK(pMaterial);
+		if (pMaterial) {
+			CreateParameters();
+
+			// Resolving by name and by interned ID must give the same parameter
+			for (uint32 i=0; i<8; i++) {
+				CHECK(pMaterial->GetParameter(cIDs[i]) != nullptr);
+				CHECK_EQUAL(pMaterial->GetParameter(sNames[i]), pMaterial->GetParameter(cIDs[i]));
+				CHECK_EQUAL(cIDs[i].GetID(), ParameterID(sNames[i]).GetID());
+				CHECK(cIDs[i].GetName() == sNames[i]);
+			}
+			CHECK(!pMaterial->GetParameter(ParameterID()));
+			CHECK(!pMaterial->GetParameter(ParameterID("UnknownParameter")));
+			CHECK(!pMaterial->GetParameter("UnknownParameter"));
+		}
+	}
+
+	TEST_FIXTURE(ConstructTest, ParameterBlock) {
+		CHECK(pMaterial);
+		if (pMaterial) {
+			CreateParameters();
+			ParameterManager &cParameterManager = pMaterial->GetParameterManager();
+
+			// Only the numeric parameters are within the block, each one within its own 16 byte slot
+			CHECK_EQUAL(4*16U, cParameterManager.GetParameterBlockSize());
+			CHECK(cParameterManager.GetParameterBlock() != nullptr);
+			CHECK(cParameterManager.GetParameterBlockOffset(cIDs[0]) < 0);
+
+			// Value changes are written directly into the block
+			Parameter *pParameter = cParameterManager.GetParameter(cIDs[1]);
+			pParameter->SetValue4f(1.0f, 2.0f, 3.0f, 4.0f);
+			const int nOffset = cParameterManager.GetParameterBlockOffset(cIDs[1]);
+			CHECK(nOffset >= 0);
+			const float *pfValue = reinterpret_cast<const float*>(cParameterManager.GetParameterBlock() + nOffset);
+			CHECK_EQUAL(1.0f, pfValue[0]);
+			CHECK_EQUAL(4.0f, pfValue[3]);
+
+			// Removing a parameter changes the layout, the values are kept
+			cParameterManager.RemoveParameter(sNames[3]);
+			CHECK_EQUAL(3*16U, cParameterManager.GetParameterBlockSize());
+			CHECK(cParameterManager.GetParameterBlockOffset(cIDs[3]) < 0);
+			pfValue = reinterpret_cast<const float*>(cParameterManager.GetParameterBlock() + cParameterManager.GetParameterBlockOffset(cIDs[1]));
+			CHECK_EQUAL(2.0f, pfValue[1]);
+
+			// Renaming a parameter updates the name and the ID lookup
+			CHECK(pParameter->SetName("RenamedParameter"));
+			CHECK(!cParameterManager.GetParameter(cIDs[1]));
+			CHECK(!cParameterManager.GetParameter(sNames[1]));
+			CHECK_EQUAL(pParameter, cParameterManager.GetParameter(ParameterID("RenamedParameter")));
+			CHECK_EQUAL(pParameter, cParameterManager.GetParameter("RenamedParameter"));
+		}
+	}
+}
@@ -0,0 +1,177 @@
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <UnitTest++/UnitTest++.h>
+#include <PLCore/Runtime.h>
+#include <PLMath/Vector3i.h>
+#include <PLMath/Rectangle.h>
+#include <PLMath/Matrix4x4.h>
+#include <PLGraphics/Image/Image.h>
+#include <PLGraphics/Color/Color4.h>
+#include <PLRenderer/RendererContext.h>
+#include <PLRenderer/Renderer/Renderer.h>
+#include <PLRenderer/Renderer/SamplerStates.h>
+#include <PLRenderer/Renderer/TextureBuffer2D.h>
+#include <PLRenderer/Renderer/Backend/DrawHelpersBackendShaders.h>
+#include "UnitTest++AddIns/PLCheckMacros.h"
+#include "UnitTest++AddIns/PLChecks.h"
+
+using namespace PLCore;
+using namespace PLMath;
+using namespace PLGraphics;
+using namespace PLRenderer;
+
+/*
+* Naming Convention for SUITE:
+* CLASSNAME
+*/
+SUITE(PrimitiveBatch) {
+	/*
+	* Naming Convention for METHOD:
+	* METHODNAME_SCENARIO
+	*/
+	const uint32 frames = 5;	// Number of drawn frames
+	const uint32 lines  = 200;	// Number of lines per frame
+	const uint32 icons  = 20;	// Number of icons per frame
+
+	//[-------------------------------------------------------]
+	//[ Classes                                               ]
+	//[-------------------------------------------------------]
+	// Shaders based draw helpers drawing the batches without a program, the null renderer backend has no shader language
+	class DrawHelpersBatchCounter : public DrawHelpersBackendShaders {
+	public:
+		DrawHelpersBatchCounter(Renderer &cRenderer) : DrawHelpersBackendShaders(cRenderer)
+		{
+		}
+	protected:
+		virtual bool DrawPrimitiveBatch(const Batch &sBatch, VertexBuffer &cVertexBuffer, uint32 nStartVertex) override
+		{
+			return m_pRenderer->DrawPrimitives(sBatch.sKey.nPrimitive, nStartVertex, sBatch.lstVertices.GetNumOfElements());
+		}
+	};
+
+	// Our primitive batch Test Fixture :)
+	struct ConstructTest
+	{
+		ConstructTest() :
+			pRendererContext(nullptr),
+			pDrawHelpers(nullptr)
+		{
+			/* some setup */
+			// The null renderer backend is sufficient, it updates the statistics like a real backend
+			pTextureBuffers[0] = pTextureBuffers[1] = nullptr;
+			Runtime::ScanDirectoryPluginsAndData(false);
+			pRendererContext = RendererContext::CreateInstance("PLRendererNull::Renderer", NULL_HANDLE);
+			if (pRendererContext) {
+				Renderer &cRenderer = pRendererContext->GetRenderer();
+				const Rectangle cViewport(0.0f, 0.0f, 1024.0f, 768.0f);
+				cRenderer.SetViewport(&cViewport);
+				pDrawHelpers = new DrawHelpersBatchCounter(cRenderer);
+				for (uint32 i=0; i<2; i++) {
+					Image cImage = Image::CreateImage(DataByte, ColorRGBA, Vector3i(16, 16, 1));
+					pTextureBuffers[i] = cRenderer.CreateTextureBuffer2D(cImage, TextureBuffer::Unknown, 0);
+				}
+			}
+		}
+		~ConstructTest() {
+			/* some teardown */
+			for (uint32 i=0; i<2; i++) {
+				if (pTextureBuffers[i])
+					delete pTextureBuffers[i];
+			}
+			if (pDrawHelpers)
+				delete pDrawHelpers;
+			if (pRendererContext)
+				delete pRendererContext;
+		}
+
+		// Returns the number of draw calls done by the renderer so far
+		uint32 GetNumOfDrawCalls() const
+		{
+			return pRendererContext->GetRenderer().GetStatistics().nDrawPrimitivCalls;
+		}
+
+		// Testing objects
+		RendererContext			*pRendererContext;
+		DrawHelpersBatchCounter	*pDrawHelpers;
+		TextureBuffer			*pTextureBuffers[2];
+	};
+
+	TEST_FIXTURE(ConstructTest, DrawLine_Batched) {
+		CHECK(pDrawHelpers);
+		if (pDrawHelpers) {
+			const Statistics &sStatistics = pRendererContext->GetRenderer().GetStatistics();
+			const uint32 nDrawCalls  = sStatistics.nDrawPrimitivCalls;
+			const uint32 nPrimitives = sStatistics.nDrawHelpersPrimitives;
+			Matrix4x4 mObjectSpaceToClipSpace;
+			mObjectSpaceToClipSpace.PerspectiveFov(1.0f, 1024.0f/768.0f, 0.1f, 1000.0f);
+			for (uint32 nFrame=0; nFrame<frames; nFrame++) {
+				pDrawHelpers->BeginBatch();
+				for (uint32 i=0; i<lines; i++) {
+					const float fX = static_cast<float>(i%50) - 25.0f;
+					const float fY = static_cast<float>(i/50) - 20.0f;
+					pDrawHelpers->DrawLine(Color4::White, Vector3(fX, fY, -50.0f), Vector3(fX + 0.5f, fY + 0.5f, -50.0f), mObjectSpaceToClipSpace, 1.0f);
+				}
+				pDrawHelpers->EndBatch();
+			}
+
+			// All lines share the same states, so there must be exactly one draw call per frame
+			CHECK_EQUAL(frames, sStatistics.nDrawPrimitivCalls - nDrawCalls);
+			CHECK_EQUAL(frames*lines, sStatistics.nDrawHelpersPrimitives - nPrimitives);
+		}
+	}
+
+	TEST_FIXTURE(ConstructTest, DrawImage_SortedByTexture) {
+		CHECK(pDrawHelpers && pTextureBuffers[0] && pTextureBuffers[1]);
+		if (pDrawHelpers && pTextureBuffers[0] && pTextureBuffers[1]) {
+			const uint32 nDrawCalls = GetNumOfDrawCalls();
+			SamplerStates cSamplerStates;
+			for (uint32 nFrame=0; nFrame<frames; nFrame++) {
+				pDrawHelpers->Begin2DMode(0.0f, 0.0f, 1024.0f, 768.0f);
+				for (uint32 i=0; i<icons; i++) {
+					// The icons of the row don't overlap, so they can be sorted by texture
+					pDrawHelpers->DrawImage(*pTextureBuffers[i & 1], cSamplerStates, Vector2(static_cast<float>(i*5), 0.0f), Vector2(4.0f, 4.0f), Color4::White, 0.5f);
+				}
+				pDrawHelpers->End2DMode();
+			}
+
+			// One draw call per texture and frame
+			CHECK_EQUAL(frames*2, GetNumOfDrawCalls() - nDrawCalls);
+		}
+	}
+
+	TEST_FIXTURE(ConstructTest, DrawImage_OverlappingKeepsOrder) {
+		CHECK(pDrawHelpers && pTextureBuffers[0] && pTextureBuffers[1]);
+		if (pDrawHelpers && pTextureBuffers[0] && pTextureBuffers[1]) {
+			const uint32 nDrawCalls = GetNumOfDrawCalls();
+			SamplerStates cSamplerStates;
+			pDrawHelpers->Begin2DMode(0.0f, 0.0f, 1024.0f, 768.0f);
+			for (uint32 i=0; i<icons; i++) {
+				// Each icon overlaps the previous one, so the textures must not be sorted
+				pDrawHelpers->DrawImage(*pTextureBuffers[i & 1], cSamplerStates, Vector2(static_cast<float>(i*2), 0.0f), Vector2(32.0f, 32.0f));
+			}
+			pDrawHelpers->End2DMode();
+			CHECK_EQUAL(icons, GetNumOfDrawCalls() - nDrawCalls);
+		}
+	}
+
+	TEST_FIXTURE(ConstructTest, DrawQuad_RenderStatesRestored) {
+		CHECK(pDrawHelpers);
+		if (pDrawHelpers) {
+			Renderer &cRenderer = pRendererContext->GetRenderer();
+			const uint32 nDrawCalls = GetNumOfDrawCalls();
+			pDrawHelpers->Begin2DMode(0.0f, 0.0f, 1024.0f, 768.0f);
+			cRenderer.SetRenderState(RenderState::BlendEnable, false);
+			pDrawHelpers->DrawQuad(Color4::Red, Vector2(0.0f, 0.0f), Vector2(10.0f, 10.0f));
+			cRenderer.SetRenderState(RenderState::BlendEnable, true);
+			pDrawHelpers->DrawQuad(Color4::Green, Vector2(100.0f, 0.0f), Vector2(10.0f, 10.0f));
+			cRenderer.SetRenderState(RenderState::BlendEnable, false);
+			pDrawHelpers->DrawQuad(Color4::Blue, Vector2(200.0f, 0.0f), Vector2(10.0f, 10.0f));
+			pDrawHelpers->End2DMode();
+
+			// Two blend states, two draw calls, and the current blend state is untouched
+			CHECK_EQUAL(2U, GetNumOfDrawCalls() - nDrawCalls);
+			CHECK_EQUAL(0, cRenderer.GetRenderState(RenderState::BlendEnable));
+		}
+	}
+}
@@ -0,0 +1,214 @@
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <UnitTest++/UnitTest++.h>
+#include <PLCore/Runtime.h>
+#include <PLCore/File/File.h>
+#include <PLCore/File/Directory.h>
+#include <PLCore/File/FileSearch.h>
+#include <PLCore/System/System.h>
+#include <PLRenderer/RendererContext.h>
+#include <PLRenderer/Renderer/ProgramGenerator.h>
+#include "UnitTest++AddIns/PLCheckMacros.h"
+#include "UnitTest++AddIns/PLChecks.h"
+
+using namespace PLCore;
+using namespace PLRenderer;
+
+/*
+* Naming Convention for SUITE:
+* CLASSNAME
+*/
+SUITE(ProgramGenerator) {
+	/*
+	* Naming Convention for METHOD:
+	* METHODNAME_SCENARIO
+	*/
+	const uint32  permutations	  = 64;	// Number of requested program permutations
+	const char	 *vertexFlags[8]   = { "VS_TWOSIDED", "VS_TEXCOORD0", "VS_NORMAL", "VS_TANGENT_BINORMAL", "VS_SKINNING", "VS_INSTANCING", "VS_FOG", "VS_SHADOW" };
+	const char	 *fragmentFlags[8] = { "FS_ALPHATEST", "FS_DIFFUSEMAP", "FS_NORMALMAP", "FS_SPECULAR", "FS_EMISSIVEMAP", "FS_LIGHT", "FS_SHADOWMAP", "FS_GAMMACORRECTION" };
+
+	// Our program generator Test Fixture :)
+	struct ConstructTest
+	{
+		ConstructTest() :
+			pRendererContext(nullptr)
+		{
+			/* some setup */
+			// The null renderer backend is sufficient, the recording and replay logic doesn't need a GPU
+			Runtime::ScanDirectoryPluginsAndData(false);
+			pRendererContext = RendererContext::CreateInstance("PLRendererNull::Renderer", NULL_HANDLE);
+			sCacheFile		 = System::GetInstance()->GetCurrentDir() + "/ProgramGeneratorTest.cache";
+			sCacheDirectory	 = System::GetInstance()->GetCurrentDir() + "/ProgramGeneratorTest";
+		}
+		~ConstructTest() {
+			/* some teardown */
+			if (pRendererContext)
+				delete pRendererContext;
+
+			// Remove the cache files
+			File(sCacheFile).Delete();
+			Directory cDirectory(sCacheDirectory);
+			if (cDirectory.Exists()) {
+				FileSearch cFileSearch(cDirectory, "*.cache");
+				while (cFileSearch.HasNextFile())
+					File(sCacheDirectory + '/' + cFileSearch.GetNextFile()).Delete();
+				cDirectory.Delete();
+			}
+		}
+
+		// Sets the program flags of a permutation, with "bReversed" the flag bits are mapped to other flag definitions
+		void SetFlags(ProgramGenerator::Flags &cFlags, uint32 nPermutation, bool bReversed = false)
+		{
+			cFlags.Reset();
+			for (uint32 i=0; i<8; i++) {
+				if (nPermutation & (1<<i))
+					cFlags.AddVertexShaderFlag(1<<i, vertexFlags[bReversed ? 7 - i : i]);
+				if ((nPermutation*7) & (1<<i))
+					cFlags.AddFragmentShaderFlag(1<<i, fragmentFlags[bReversed ? 7 - i : i]);
+			}
+		}
+
+		// Requests the given number of program permutations
+		void GetPrograms(ProgramGenerator &cProgramGenerator, uint32 nNumOfPermutations)
+		{
+			ProgramGenerator::Flags cFlags;
+			for (uint32 i=0; i<nNumOfPermutations; i++) {
+				SetFlags(cFlags, i);
+				cProgramGenerator.GetProgram(cFlags);
+			}
+		}
+
+		// Testing objects
+		RendererContext *pRendererContext;
+		String			 sCacheFile;
+		String			 sCacheDirectory;
+	};
+
+	TEST_FIXTURE(ConstructTest, GetProgram_RecordsPermutations) {
+		CHECK(pRendererContext);
+		if (pRendererContext) {
+			ProgramGenerator cProgramGenerator(pRendererContext->GetRenderer(), "GLSL", "void main() {}", "110", "void main() {}", "110");
+
+			// Each permutation is requested multiple times, but only recorded once
+			GetPrograms(cProgramGenerator, permutations);
+			GetPrograms(cProgramGenerator, permutations);
+			CHECK_EQUAL(permutations, cProgramGenerator.GetNumOfRecordedPrograms());
+			CHECK_EQUAL(0U, cProgramGenerator.GetNumOfPendingPrograms());
+
+			// The generated shader source codes contain the flag definitions
+			String sVertexShaderSourceCode, sFragmentShaderSourceCode;
+			CHECK(cProgramGenerator.GetRecordedProgram(1|2, 1|4|16, sVertexShaderSourceCode, sFragmentShaderSourceCode));
+			CHECK_EQUAL("#version 110\n#define VS_TWOSIDED\n#define VS_TEXCOORD0\nvoid main() {}", sVertexShaderSourceCode.GetASCII());
+			CHECK(sFragmentShaderSourceCode.IndexOf("#define FS_EMISSIVEMAP\n") > 0);
+			CHECK(!cProgramGenerator.GetRecordedProgram(1, 1, sVertexShaderSourceCode, sFragmentShaderSourceCode));
+		}
+	}
+
+	TEST_FIXTURE(ConstructTest, LoadCache_ReplaysPermutations) {
+		CHECK(pRendererContext);
+		if (pRendererContext) {
+			// Record and save the permutations
+			{
+				ProgramGenerator cProgramGenerator(pRendererContext->GetRenderer(), "GLSL", "void main() {}", "110", "void main() {}", "110");
+				GetPrograms(cProgramGenerator, permutations);
+				CHECK(cProgramGenerator.SaveCache(sCacheFile));
+			}
+
+			// On the next start, the permutations are pending until they were warmed up
+			ProgramGenerator cProgramGenerator(pRendererContext->GetRenderer(), "GLSL", "void main() {}", "110", "void main() {}", "110");
+			CHECK(cProgramGenerator.LoadCache(sCacheFile));
+			CHECK_EQUAL(permutations, cProgramGenerator.GetNumOfRecordedPrograms());
+			CHECK_EQUAL(permutations, cProgramGenerator.GetNumOfPendingPrograms());
+			CHECK_EQUAL(permutations - 16, cProgramGenerator.WarmUp(16));
+
+			// Requesting a pending permutation generates it as well
+			ProgramGenerator::Flags cFlags;
+			SetFlags(cFlags, permutations - 1);
+			cProgramGenerator.GetProgram(cFlags);
+			CHECK_EQUAL(permutations - 17, cProgramGenerator.GetNumOfPendingPrograms());
+			CHECK_EQUAL(0U, cProgramGenerator.WarmUp());
+			CHECK_EQUAL(permutations, cProgramGenerator.GetNumOfRecordedPrograms());
+
+			// The loaded shader source codes are identical to the generated ones
+			String sVertexShaderSourceCode, sFragmentShaderSourceCode;
+			CHECK(cProgramGenerator.GetRecordedProgram(1|2, 1|4|16, sVertexShaderSourceCode, sFragmentShaderSourceCode));
+			CHECK_EQUAL("#version 110\n#define VS_TWOSIDED\n#define VS_TEXCOORD0\nvoid main() {}", sVertexShaderSourceCode.GetASCII());
+
+			// Requesting the warmed up permutations with the flag definitions used when the cache was written keeps them
+			GetPrograms(cProgramGenerator, permutations);
+			CHECK_EQUAL(permutations, cProgramGenerator.GetNumOfRecordedPrograms());
+		}
+	}
+
+	TEST_FIXTURE(ConstructTest, LoadCache_OutdatedIgnored) {
+		CHECK(pRendererContext);
+		if (pRendererContext) {
+			{
+				ProgramGenerator cProgramGenerator(pRendererContext->GetRenderer(), "GLSL", "void main() {}", "110", "void main() {}", "110");
+				GetPrograms(cProgramGenerator, permutations);
+				CHECK(cProgramGenerator.SaveCache(sCacheFile));
+			}
+
+			// The shader source code changed since the cache was written
+			ProgramGenerator cProgramGenerator(pRendererContext->GetRenderer(), "GLSL", "void main() { }", "110", "void main() {}", "110");
+			CHECK(!cProgramGenerator.LoadCache(sCacheFile));
+			CHECK_EQUAL(0U, cProgramGenerator.GetNumOfRecordedPrograms());
+			CHECK_EQUAL(0U, cProgramGenerator.GetNumOfPendingPrograms());
+			CHECK(!cProgramGenerator.LoadCache(sCacheFile + ".missing"));
+		}
+	}
+
+	TEST_FIXTURE(ConstructTest, GetProgram_ChangedFlagDefinitions) {
+		CHECK(pRendererContext);
+		if (pRendererContext) {
+			{
+				ProgramGenerator cProgramGenerator(pRendererContext->GetRenderer(), "GLSL", "void main() {}", "110", "void main() {}", "110");
+				GetPrograms(cProgramGenerator, permutations);
+				CHECK(cProgramGenerator.SaveCache(sCacheFile));
+			}
+
+			// The shader source codes are unchanged, but the flag bits are now mapped to other flag definitions
+			ProgramGenerator cProgramGenerator(pRendererContext->GetRenderer(), "GLSL", "void main() {}", "110", "void main() {}", "110");
+			CHECK(cProgramGenerator.LoadCache(sCacheFile));
+			CHECK_EQUAL(0U, cProgramGenerator.WarmUp());
+			ProgramGenerator::Flags cFlags;
+			SetFlags(cFlags, 1|2, true);
+			cProgramGenerator.GetProgram(cFlags);
+
+			// All loaded permutations were discarded, only the requested one is recorded using the current flag definitions
+			CHECK_EQUAL(1U, cProgramGenerator.GetNumOfRecordedPrograms());
+			CHECK_EQUAL(0U, cProgramGenerator.GetNumOfPendingPrograms());
+			String sVertexShaderSourceCode, sFragmentShaderSourceCode;
+			CHECK(cProgramGenerator.GetRecordedProgram(1|2, 1|4|16, sVertexShaderSourceCode, sFragmentShaderSourceCode));
+			CHECK_EQUAL("#version 110\n#define VS_SHADOW\n#define VS_FOG\nvoid main() {}", sVertexShaderSourceCode.GetASCII());
+			CHECK(!cProgramGenerator.GetRecordedProgram(1, 7, sVertexShaderSourceCode, sFragmentShaderSourceCode));
+		}
+	}
+
+	TEST_FIXTURE(ConstructTest, SetProgramCacheDirectory_SavedAndWarmedUp) {
+		CHECK(pRendererContext);
+		if (pRendererContext) {
+			pRendererContext->SetProgramCacheDirectory(sCacheDirectory);
+
+			// The program generator saves its recorded permutations on destruction, the directory is created automatically
+			{
+				ProgramGenerator cProgramGenerator(pRendererContext->GetRenderer(), "GLSL", "void main() {}", "110", "void main() {}", "110");
+				CHECK_EQUAL(0U, cProgramGenerator.GetNumOfRecordedPrograms());
+				GetPrograms(cProgramGenerator, permutations);
+			}
+			CHECK(Directory(sCacheDirectory).Exists());
+
+			// On the next start, the permutations are loaded and generated at once
+			{
+				ProgramGenerator cProgramGenerator(pRendererContext->GetRenderer(), "GLSL", "void main() {}", "110", "void main() {}", "110");
+				CHECK_EQUAL(permutations, cProgramGenerator.GetNumOfRecordedPrograms());
+				CHECK_EQUAL(0U, cProgramGenerator.GetNumOfPendingPrograms());
+			}
+
+			// Program generators with other shader source codes use their own cache file
+			ProgramGenerator cProgramGenerator(pRendererContext->GetRenderer(), "GLSL", "void main() { }", "110", "void main() {}", "110");
+			CHECK_EQUAL(0U, cProgramGenerator.GetNumOfRecordedPrograms());
+		}
+	}
+}
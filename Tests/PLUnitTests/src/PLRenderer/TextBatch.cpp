@@ -0,0 +1,104 @@
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <UnitTest++/UnitTest++.h>
+#include <PLCore/Runtime.h>
+#include <PLCore/File/File.h>
+#include <PLGraphics/Color/Color4.h>
+#include <PLRenderer/RendererContext.h>
+#include <PLRenderer/Renderer/Renderer.h>
+#include <PLRenderer/Renderer/DrawHelpers.h>
+#include <PLRenderer/Renderer/FontManager.h>
+#include <PLRenderer/Renderer/FontTexture.h>
+#include <PLRenderer/Renderer/GlyphAtlas.h>
+#include "UnitTest++AddIns/PLCheckMacros.h"
+#include "UnitTest++AddIns/PLChecks.h"
+
+using namespace PLCore;
+using namespace PLMath;
+using namespace PLGraphics;
+using namespace PLRenderer;
+
+/*
+* Naming Convention for SUITE:
+* CLASSNAME
+*/
+SUITE(TextBatch) {
+	/*
+	* Naming Convention for METHOD:
+	* METHODNAME_SCENARIO
+	*/
+	const uint32 frames = 5;	// Number of drawn frames
+	const uint32 texts  = 20;	// Number of texts per frame
+
+	// Our text batch Test Fixture :)
+	struct ConstructTest
+	{
+		ConstructTest() :
+			pRendererContext(nullptr),
+			pFont(nullptr)
+		{
+			/* some setup */
+			// The null renderer backend is sufficient, it updates the statistics like a real backend and its fonts are using synthetic glyphs
+			Runtime::ScanDirectoryPluginsAndData(false);
+			pRendererContext = RendererContext::CreateInstance("PLRendererNull::Renderer", NULL_HANDLE);
+			if (pRendererContext) {
+				File cFile("NullFont.ttf");
+				pFont = pRendererContext->GetRenderer().GetFontManager().CreateFontTexture(cFile, 12, 96);
+				for (uint32 i=0; i<texts; i++)
+					sTexts[i] = String("Label ") + i + ": " + (i*7919)%1000 + " units";
+
+				// Rasterize the glyphs of the texts up front, else the first frame would only contain placeholders
+				if (pFont) {
+					for (uint32 i=0; i<texts; i++)
+						pFont->GetTextWidth(sTexts[i]);
+					pRendererContext->GetRenderer().GetFontManager().GetGlyphAtlas().WaitForRasterization();
+				}
+			}
+		}
+		~ConstructTest() {
+			/* some teardown */
+			if (pFont)
+				delete pFont;
+			if (pRendererContext)
+				delete pRendererContext;
+		}
+
+		// Draws the texts within the given number of frames, returns the number of draw calls
+		uint32 DrawFrames(uint32 nNumOfFrames)
+		{
+			Renderer &cRenderer = pRendererContext->GetRenderer();
+			DrawHelpers &cDrawHelpers = cRenderer.GetDrawHelpers();
+			const uint32 nDrawCalls = cRenderer.GetStatistics().nDrawPrimitivCalls;
+			for (uint32 nFrame=0; nFrame<nNumOfFrames; nFrame++) {
+				cDrawHelpers.Begin2DMode(0.0f, 0.0f, 1024.0f, 768.0f);
+				for (uint32 i=0; i<texts; i++)
+					cDrawHelpers.DrawText(*pFont, sTexts[i], Color4::White, Vector2(10.0f, static_cast<float>(i*12)));
+				cDrawHelpers.End2DMode();
+			}
+			return cRenderer.GetStatistics().nDrawPrimitivCalls - nDrawCalls;
+		}
+
+		// Testing objects
+		RendererContext *pRendererContext;
+		Font			*pFont;
+		String			 sTexts[texts];
+	};
+
+	TEST_FIXTURE(ConstructTest, DrawText_OneDrawCallPerFont) {
+		CHECK(pFont);
+		if (pFont) {
+			// All texts of a frame are using the same font, so there must be exactly one draw call per frame
+			CHECK_EQUAL(frames, DrawFrames(frames));
+		}
+	}
+
+	TEST_FIXTURE(ConstructTest, DrawText_ShapedTextsCached) {
+		CHECK(pFont);
+		if (pFont) {
+			// The texts didn't change from frame to frame, so each one was only shaped once
+			DrawFrames(frames);
+			CHECK_EQUAL(texts, static_cast<FontTexture*>(pFont)->GetNumOfShapedTexts());
+		}
+	}
+}
@@ -0,0 +1,211 @@
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <UnitTest++/UnitTest++.h>
+#include <PLCore/Runtime.h>
+#include <PLCore/File/File.h>
+#include <PLCore/File/Directory.h>
+#include <PLCore/System/System.h>
+#include <PLMath/Math.h>
+#include <PLRenderer/RendererContext.h>
+#include <PLScene/Scene/SCCell.h>
+#include <PLScene/Scene/SceneContext.h>
+#include <PLScene/Scene/SceneNodeModifiers/SNMCellStreaming.h>
+#include "UnitTest++AddIns/PLCheckMacros.h"
+#include "UnitTest++AddIns/PLChecks.h"
+
+using namespace PLCore;
+using namespace PLMath;
+using namespace PLRenderer;
+using namespace PLScene;
+
+/*
+* Naming Convention for SUITE:
+* CLASSNAME
+*/
+SUITE(SNMCellStreaming) {
+	/*
+	* Naming Convention for METHOD:
+	* METHODNAME_SCENARIO
+	*/
+	const uint32 cells        = 10;		// Number of cells along x, one row
+	const float  cellSize     = 20.0f;	// Cell size along x and z
+	const uint32 nodesPerCell = 8;		// Number of scene nodes within the streamed contents of each cell
+
+	// Our cell streaming Test Fixture :)
+	struct ConstructTest
+	{
+		ConstructTest() :
+			pRendererContext(nullptr),
+			pSceneContext(nullptr),
+			pWorld(nullptr),
+			pCamera(nullptr),
+			pCellStreaming(nullptr),
+			nFileSize(0)
+		{
+			/* some setup */
+			// Cell streaming doesn't need the GPU, but the scene context needs a renderer context
+			Runtime::ScanDirectoryPluginsAndData(false);
+			pRendererContext = RendererContext::CreateInstance("PLRendererNull::Renderer", NULL_HANDLE);
+			if (pRendererContext) {
+				pSceneContext = new SceneContext(*pRendererContext);
+				pWorld = static_cast<SceneContainer*>(pSceneContext->GetRoot()->Create("PLScene::SceneContainer", "World"));
+				if (pWorld) {
+					// Write the separately loadable sub-scenes of the cells
+					sDirectory = System::GetInstance()->GetCurrentDir() + "/CellStreamingTest/";
+					Directory(sDirectory).Create();
+					for (uint32 nX=0; nX<cells; nX++) {
+						String sScene = "<?xml version=\"1.0\" ?>\n<Scene Version=\"1\">\n";
+						for (uint32 i=0; i<nodesPerCell; i++)
+							sScene += String("\t<Node Class=\"PLScene::SNPointLight\" Position=\"") + (static_cast<int>(i%4)*4 - 6) + " 1 " + (static_cast<int>(i/4)*8 - 4) + "\" Range=\"3\" />\n";
+						sScene += "</Scene>\n";
+						File cFile(sDirectory + "Cell_" + nX + ".scene");
+						if (cFile.Open(File::FileWrite | File::FileCreate)) {
+							cFile.PutS(sScene);
+							nFileSize = cFile.GetSize();
+							cFile.Close();
+						}
+					}
+
+					// The cells, each one is reachable from the world and from the neighbour cells
+					for (uint32 nX=0; nX<cells; nX++) {
+						const String sName = String("Cell_") + nX;
+						const String sPosition = String(nX*cellSize) + " 0 0";
+						SceneContainer *pCell = static_cast<SceneContainer*>(pWorld->Create("PLScene::SCCell", sName, "Position=\"" + sPosition + "\" AABBMin=\"-10 -10 -10\" AABBMax=\"10 10 10\" StreamFilename=\"" + sDirectory + sName + ".scene\""));
+						pWorld->Create("PLScene::SNCellPortal", "Portal_" + sName, "Position=\"" + sPosition + "\" TargetCell=\"" + sName + '\"');
+						if (pCell) {
+							if (nX)
+								pCell->Create("PLScene::SNCellPortal", "", String("Position=\"-10 0 0\" TargetCell=\"Parent.Cell_") + (nX - 1) + '\"');
+							if (nX < cells - 1)
+								pCell->Create("PLScene::SNCellPortal", "", String("Position=\"10 0 0\" TargetCell=\"Parent.Cell_") + (nX + 1) + '\"');
+						}
+					}
+
+					// The camera streaming in the cells
+					pCamera = pWorld->Create("PLScene::SNCamera", "Camera");
+					if (pCamera)
+						pCellStreaming = static_cast<SNMCellStreaming*>(pCamera->AddModifier("PLScene::SNMCellStreaming", String("LoadDistance=\"30\" UnloadDistance=\"50\" MaxLoadsPerUpdate=\"2\" MemoryBudget=\"") + nFileSize*cells + '\"'));
+				}
+			}
+		}
+		~ConstructTest() {
+			/* some teardown */
+			if (pSceneContext)
+				delete pSceneContext;
+			if (pRendererContext)
+				delete pRendererContext;
+
+			// Remove the sub-scene files
+			if (sDirectory.GetLength()) {
+				for (uint32 nX=0; nX<cells; nX++)
+					File(sDirectory + "Cell_" + nX + ".scene").Delete();
+				Directory(sDirectory).Delete();
+			}
+		}
+
+		// Updates the scene context like the application would do once per frame
+		void UpdateFrame()
+		{
+			pSceneContext->Update(false);
+			pSceneContext->Cleanup();
+		}
+
+		// Moves the camera and updates until there are no more cells to load, returns whether or not the memory usage was always within the budget
+		bool MoveCamera(float fX)
+		{
+			bool bWithinBudget = true;
+			pCamera->GetTransform().SetPosition(Vector3(fX, 0.0f, 0.0f));
+			for (uint32 i=0; i<1000; i++) {
+				UpdateFrame();
+				if (pCellStreaming->GetMemoryUsage() > pCellStreaming->MemoryBudget.Get())
+					bWithinBudget = false;
+				if (!pCellStreaming->GetNumOfLoadingCells() && i > 2)
+					break;
+				System::GetInstance()->Sleep(1);
+			}
+			return bWithinBudget;
+		}
+
+		// Returns whether or not the streamed contents of the given cell are loaded
+		bool IsLoaded(uint32 nX) const
+		{
+			const SCCell *pCell = static_cast<SCCell*>(pWorld->GetByName(String("Cell_") + nX));
+			const SceneContainer *pContents = pCell ? pCell->GetStreamedContents() : nullptr;
+			return (pContents && pContents->GetNumOfElements() == nodesPerCell);
+		}
+
+		// Returns the number of scene nodes within the streamed contents of all cells
+		uint32 GetNumOfStreamedSceneNodes() const
+		{
+			uint32 nNumOfSceneNodes = 0;
+			for (uint32 i=0; i<pWorld->GetNumOfElements(); i++) {
+				SceneNode *pSceneNode = pWorld->GetByIndex(i);
+				if (pSceneNode->IsCell()) {
+					const SceneContainer *pContents = static_cast<SCCell*>(pSceneNode)->GetStreamedContents();
+					if (pContents)
+						nNumOfSceneNodes += pContents->GetNumOfElements();
+				}
+			}
+			return nNumOfSceneNodes;
+		}
+
+		// Testing objects
+		RendererContext  *pRendererContext;
+		SceneContext	 *pSceneContext;
+		SceneContainer	 *pWorld;
+		SceneNode		 *pCamera;
+		SNMCellStreaming *pCellStreaming;
+		uint32			  nFileSize;
+		String			  sDirectory;
+	};
+
+	TEST_FIXTURE(ConstructTest, Update_LoadAndUnloadDistance) {
+		CHECK(pCellStreaming);
+		if (pCellStreaming) {
+			// The cells within load distance are loaded
+			CHECK(MoveCamera(0.0f));
+			CHECK(IsLoaded(0));
+			CHECK(IsLoaded(1));
+			CHECK(!IsLoaded(3));
+			CHECK(!IsLoaded(cells - 1));
+
+			// Cells between load and unload distance stay loaded, the ones behind are unloaded (the distance is measured along the portals)
+			CHECK(MoveCamera(2*cellSize));
+			CHECK(IsLoaded(0));
+			CHECK(IsLoaded(3));
+			CHECK(MoveCamera(7*cellSize));
+			CHECK(!IsLoaded(0));
+			CHECK(!IsLoaded(3));
+			CHECK(IsLoaded(7));
+			CHECK(IsLoaded(8));
+			CHECK_EQUAL(pCellStreaming->GetNumOfLoadedCells()*nFileSize, pCellStreaming->GetMemoryUsage());
+			CHECK_EQUAL(pCellStreaming->GetNumOfLoadedCells()*nodesPerCell, GetNumOfStreamedSceneNodes());
+		}
+	}
+
+	TEST_FIXTURE(ConstructTest, Update_MemoryBudget) {
+		CHECK(pCellStreaming);
+		if (pCellStreaming) {
+			// Only two cells fit into the budget, the nearest ones are kept
+			pCellStreaming->MemoryBudget.Set(nFileSize*2);
+			for (uint32 nX=0; nX<cells; nX++) {
+				CHECK(MoveCamera(nX*cellSize));
+				CHECK(pCellStreaming->GetNumOfLoadedCells() <= 2);
+				CHECK(IsLoaded(nX));
+			}
+		}
+	}
+
+	TEST_FIXTURE(ConstructTest, Update_Leave) {
+		CHECK(pCellStreaming);
+		if (pCellStreaming) {
+			// Everything is unloaded once the camera is out of reach
+			CHECK(MoveCamera(4*cellSize));
+			CHECK(pCellStreaming->GetNumOfLoadedCells() > 0);
+			CHECK(MoveCamera(-1000.0f));
+			CHECK_EQUAL(0U, pCellStreaming->GetNumOfLoadedCells());
+			CHECK_EQUAL(0U, pCellStreaming->GetMemoryUsage());
+			CHECK_EQUAL(0U, GetNumOfStreamedSceneNodes());
+		}
+	}
+}
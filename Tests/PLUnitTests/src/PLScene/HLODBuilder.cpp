@@ -0,0 +1,235 @@
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <UnitTest++/UnitTest++.h>
+#include <PLCore/Runtime.h>
+#include <PLMath/Math.h>
+#include <PLMath/Frustum.h>
+#include <PLMath/Matrix4x4.h>
+#include <PLMesh/Mesh.h>
+#include <PLMesh/MeshHandler.h>
+#include <PLRenderer/RendererContext.h>
+#include <PLScene/Scene/HLODBuilder.h>
+#include <PLScene/Scene/SceneContext.h>
+#include <PLScene/Scene/SceneContainer.h>
+#include <PLScene/Scene/SceneNodes/SNMesh.h>
+#include <PLScene/Visibility/SQCull.h>
+#include <PLScene/Visibility/VisNode.h>
+#include <PLScene/Visibility/VisContainer.h>
+#include "UnitTest++AddIns/PLCheckMacros.h"
+#include "UnitTest++AddIns/PLChecks.h"
+
+using namespace PLCore;
+using namespace PLMath;
+using namespace PLMesh;
+using namespace PLRenderer;
+using namespace PLScene;
+
+/*
+* Naming Convention for SUITE:
+* CLASSNAME
+*/
+SUITE(HLODBuilder) {
+	/*
+	* Naming Convention for METHOD:
+	* METHODNAME_SCENARIO
+	*/
+	const uint32 trianglesPerBox = 12;	// Number of triangles of a cube mesh
+
+	// Our hierarchical LOD Test Fixture :)
+	struct ConstructTest
+	{
+		ConstructTest() :
+			pRendererContext(nullptr),
+			pSceneContext(nullptr),
+			pContainer(nullptr),
+			pTown(nullptr),
+			pCullQuery(nullptr)
+		{
+			/* some setup */
+			// The null renderer backend is sufficient, it keeps the buffer data the proxy meshes are built from
+			Runtime::ScanDirectoryPluginsAndData(false);
+			pRendererContext = RendererContext::CreateInstance("PLRendererNull::Renderer", NULL_HANDLE);
+			if (pRendererContext) {
+				pSceneContext = new SceneContext(*pRendererContext);
+				pContainer = static_cast<SceneContainer*>(pSceneContext->GetRoot()->Create("PLScene::SceneContainer", "Scene"));
+				if (pContainer) {
+					// A scene container far away in front of the camera with four boxes, an invisible one and a
+					// scene container with a scaled box
+					pTown = static_cast<SceneContainer*>(pContainer->Create("PLScene::SceneContainer", "Town", "Position=\"0 0 -100\""));
+					if (pTown) {
+						for (uint32 i=0; i<4; i++)
+							pTown->Create("PLScene::SNMesh", String("Box") + i, String("Position=\"") + static_cast<int>(i%2)*3 + " 0 " + static_cast<int>(i/2)*3 + "\" Mesh=\"Create PLMesh::MeshCreatorCube Name=\\\"Box\\\"\"");
+						pTown->Create("PLScene::SNMesh", "Invisible", "Position=\"-20 0 0\" Flags=\"Invisible\" Mesh=\"Create PLMesh::MeshCreatorCube Name=\\\"Box\\\"\"");
+						SceneContainer *pBlock = static_cast<SceneContainer*>(pTown->Create("PLScene::SceneContainer", "Block", "Position=\"10 0 0\""));
+						if (pBlock)
+							pBlock->Create("PLScene::SNMesh", "Tower", "Position=\"0 1 0\" Scale=\"2 4 2\" Mesh=\"Create PLMesh::MeshCreatorCube Name=\\\"Box\\\"\"");
+					}
+
+					// Create the cull query
+					pCullQuery = static_cast<SQCull*>(pContainer->CreateQuery("PLScene::SQCull"));
+					if (pCullQuery) {
+						pCullQuery->SetFlags(0);
+						pCullQuery->SetMode(SQCull::Frustum);
+					}
+				}
+			}
+		}
+		~ConstructTest() {
+			/* some teardown */
+			if (pCullQuery)
+				pCullQuery->GetSceneContainer().DestroyQuery(*pCullQuery);
+			if (pSceneContext)
+				delete pSceneContext;
+			if (pRendererContext)
+				delete pRendererContext;
+		}
+
+		// Performs the visibility determination for a camera at the origin looking along the negative z axis
+		void Cull()
+		{
+			Matrix4x4 mProjection;
+			mProjection.PerspectiveFov(static_cast<float>(60.0f*Math::DegToRad), 16.0f/9.0f, 0.1f, 1000.0f);
+			Frustum cFrustum;
+			cFrustum.CreateViewPlanes(mProjection, false);
+			pCullQuery->SetCameraPosition(Vector3::Zero);
+			pCullQuery->SetViewFrustum(cFrustum);
+			pCullQuery->SetProjectionMatrix(mProjection);
+			pCullQuery->SetViewMatrix(Matrix4x4::Identity);
+			pCullQuery->SetViewProjectionMatrix(mProjection);
+			pCullQuery->PerformQuery();
+		}
+
+		// Returns whether or not the given scene node is within the given visibility container or one of its visibility containers
+		static bool IsVisible(const VisContainer &cVisContainer, const SceneNode &cSceneNode)
+		{
+			Iterator<VisNode*> cIterator = cVisContainer.GetVisNodes().GetIterator();
+			while (cIterator.HasNext()) {
+				const VisNode *pVisNode = cIterator.Next();
+				if (pVisNode->GetSceneNode() == &cSceneNode)
+					return true;
+				if (pVisNode->IsContainer() && IsVisible(static_cast<const VisContainer&>(*pVisNode), cSceneNode))
+					return true;
+			}
+			return false;
+		}
+
+		// Returns whether or not the given scene node was found to be visible by the last visibility determination
+		bool IsVisible(const SceneNode &cSceneNode) const
+		{
+			return IsVisible(pCullQuery->GetVisContainer(), cSceneNode);
+		}
+
+		// Returns the number of triangles of the mesh of the given scene node
+		static uint32 GetNumOfTriangles(SceneNode &cSceneNode)
+		{
+			const MeshHandler *pMeshHandler = cSceneNode.GetMeshHandler();
+			const Mesh *pMesh = pMeshHandler ? pMeshHandler->GetMesh() : nullptr;
+			return pMesh ? pMesh->GetMaxNumOfTriangles() : 0;
+		}
+
+		// Testing objects
+		RendererContext *pRendererContext;
+		SceneContext	*pSceneContext;
+		SceneContainer	*pContainer;
+		SceneContainer	*pTown;
+		SQCull			*pCullQuery;
+	};
+
+	TEST_FIXTURE(ConstructTest, BuildProxyMesh_Merged) {
+		CHECK(pTown);
+		if (pTown) {
+			SNMesh *pProxy = HLODBuilder::BuildProxyMesh(*pTown, 50.0f);
+			CHECK(pProxy);
+			if (pProxy) {
+				// The proxy is used by the scene container and placed within its parent container
+				CHECK(pProxy->IsHLODProxy());
+				CHECK_EQUAL(pTown->GetHLODProxyNode(), static_cast<SceneNode*>(pProxy));
+				CHECK_EQUAL(50.0f, pTown->GetHLODDistance());
+				CHECK_EQUAL(pContainer, pProxy->GetContainer());
+				CHECK_EQUAL("Town_HLOD", pProxy->GetName());
+				CHECK(pProxy->GetTransform().GetPosition() == pTown->GetTransform().GetPosition());
+
+				// All visible boxes including the one within the inner scene container are merged, one geometry for all boxes sharing the same material
+				CHECK_EQUAL(5*trianglesPerBox, GetNumOfTriangles(*pProxy));
+				const Mesh *pMesh = pProxy->GetMeshHandler()->GetMesh();
+				CHECK_EQUAL(1U, pMesh->GetNumOfMaterials());
+
+				// The vertices are within the space of the scene container, the invisible box is not included
+				Vector3 vMin, vMax;
+				pMesh->GetBoundingBox(vMin, vMax);
+				CHECK_CLOSE(-0.5f, vMin.x, 0.0001f);
+				CHECK_CLOSE(-1.0f, vMin.y, 0.0001f);
+				CHECK_CLOSE(-1.0f, vMin.z, 0.0001f);
+				CHECK_CLOSE(11.0f, vMax.x, 0.0001f);
+				CHECK_CLOSE( 3.0f, vMax.y, 0.0001f);
+				CHECK_CLOSE( 3.5f, vMax.z, 0.0001f);
+			}
+		}
+	}
+
+	TEST_FIXTURE(ConstructTest, BuildProxyMesh_Rebuild) {
+		CHECK(pTown);
+		if (pTown) {
+			SNMesh *pProxy = HLODBuilder::BuildProxyMesh(*pTown, 50.0f);
+			CHECK(pProxy);
+
+			// The proxy is a snapshot, after changing the content it has to be built again which replaces the previous proxy
+			pTown->Create("PLScene::SNMesh", "Box4", "Position=\"3 0 6\" Mesh=\"Create PLMesh::MeshCreatorCube Name=\\\"Box\\\"\"");
+			SNMesh *pNewProxy = HLODBuilder::BuildProxyMesh(*pTown, 60.0f, "Proxy");
+			CHECK(pNewProxy);
+			if (pNewProxy) {
+				pSceneContext->Cleanup();
+				CHECK_EQUAL(static_cast<SceneNode*>(pNewProxy), pTown->GetHLODProxyNode());
+				CHECK_EQUAL(static_cast<SceneNode*>(pNewProxy), pContainer->GetByName("Proxy"));
+				CHECK(!pContainer->GetByName("Town_HLOD"));
+				CHECK_EQUAL(60.0f, pTown->GetHLODDistance());
+				CHECK_EQUAL(6*trianglesPerBox, GetNumOfTriangles(*pNewProxy));
+			}
+		}
+	}
+
+	TEST_FIXTURE(ConstructTest, BuildProxyMesh_Error) {
+		CHECK(pTown);
+		if (pTown) {
+			// Nothing to merge
+			SceneContainer *pEmpty = pContainer->Create<SceneContainer>("Empty");
+			CHECK(!HLODBuilder::BuildProxyMesh(*pEmpty, 50.0f));
+			CHECK(!pEmpty->GetHLODProxyNode());
+
+			// No parent container for the proxy
+			CHECK(!HLODBuilder::BuildProxyMesh(*pSceneContext->GetRoot(), 50.0f));
+		}
+	}
+
+	TEST_FIXTURE(ConstructTest, PerformQuery_Distance) {
+		CHECK(pTown && pCullQuery);
+		if (pTown && pCullQuery) {
+			SceneNode *pBox = pTown->GetByName("Box0");
+			SNMesh *pProxy = HLODBuilder::BuildProxyMesh(*pTown, 50.0f);
+			CHECK(pProxy);
+			if (pProxy) {
+				// The scene container is farther away than the HLOD distance, only the proxy is visible
+				Cull();
+				CHECK(IsVisible(*pProxy));
+				CHECK(!IsVisible(*pBox));
+				CHECK_EQUAL(1U, pCullQuery->GetStatistics().nNumOfHLODProxies);
+				CHECK_EQUAL(pTown->GetNumOfElements(), pCullQuery->GetStatistics().nNumOfHLODSkippedSceneNodes);
+
+				// The scene container is nearer than the HLOD distance, its content is visible but not the proxy
+				pTown->SetHLODDistance(500.0f);
+				Cull();
+				CHECK(!IsVisible(*pProxy));
+				CHECK(IsVisible(*pBox));
+				CHECK_EQUAL(0U, pCullQuery->GetStatistics().nNumOfHLODProxies);
+
+				// An invisible proxy is not used
+				pTown->SetHLODDistance(50.0f);
+				pProxy->SetVisible(false);
+				Cull();
+				CHECK(IsVisible(*pBox));
+				CHECK_EQUAL(0U, pCullQuery->GetStatistics().nNumOfHLODProxies);
+			}
+		}
+	}
+}
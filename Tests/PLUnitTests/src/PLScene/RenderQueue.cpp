@@ -0,0 +1,256 @@
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <UnitTest++/UnitTest++.h>
+#include <PLScene/Compositing/RenderQueue.h>
+#include "UnitTest++AddIns/PLCheckMacros.h"
+#include "UnitTest++AddIns/PLChecks.h"
+
+using namespace PLCore;
+using namespace PLRenderer;
+using namespace PLScene;
+
+/*
+* Naming Convention for SUITE:
+* CLASSNAME
+*/
+SUITE(RenderQueue) {
+	/*
+	* Naming Convention for METHOD:
+	* METHODNAME_SCENARIO
+	*/
+	// Our render queue Test Fixture :)
+	struct ConstructTest
+	{
+		ConstructTest() {
+			/* some setup */
+		}
+		~ConstructTest() {
+			/* some teardown */
+		}
+
+		// The render queue only compares the pointers of the items, so there's no need for real objects - every object is
+		// represented by a unique address within a dummy buffer
+		RenderQueue::Item CreateItem(uint32 nVisNode, uint32 nMaterial, uint32 nProgram, float fDepth, bool bBackToFront = false)
+		{
+			RenderQueue::Item sItem;
+			sItem.pCullQuery    = reinterpret_cast<const SQCull*>(nDummy);
+			sItem.pVisNode      = reinterpret_cast<const VisNode*>(nDummy + nVisNode);
+			sItem.pMaterial     = reinterpret_cast<Material*>(nDummy + nMaterial);
+			sItem.pVertexBuffer = reinterpret_cast<VertexBuffer*>(nDummy + 1);
+			sItem.pIndexBuffer  = reinterpret_cast<IndexBuffer*>(nDummy + 2);
+			sItem.pGeometry     = reinterpret_cast<const PLMesh::Geometry*>(nDummy + 3);
+			sItem.nSortKey      = RenderQueue::GetSortKey(0, cRenderQueue.GetProgramID(nDummy + nProgram), cRenderQueue.GetMaterialID(sItem.pMaterial), fDepth, bBackToFront);
+			return sItem;
+		}
+
+		// Returns the index of the visibility node of the given item within the dummy buffer
+		uint32 GetVisNode(const RenderQueue::Item &sItem) const
+		{
+			return static_cast<uint32>(reinterpret_cast<const char*>(sItem.pVisNode) - nDummy);
+		}
+
+		// Returns whether or not two items are using the same states and buffers
+		static bool IsSameState(const RenderQueue::Item &sFirst, const RenderQueue::Item &sSecond)
+		{
+			return ((sFirst.nSortKey >> 24) == (sSecond.nSortKey >> 24) && sFirst.pCullQuery == sSecond.pCullQuery && sFirst.pMaterial == sSecond.pMaterial &&
+					sFirst.pVertexBuffer == sSecond.pVertexBuffer && sFirst.pIndexBuffer == sSecond.pIndexBuffer && sFirst.pGeometry == sSecond.pGeometry);
+		}
+
+		// Returns whether or not the batches are valid: The items of a batch follow each other and are using the same states and buffers,
+		// items of different batches are not
+		bool CheckBatches() const
+		{
+			uint32 nNextItem = 0;
+			for (uint32 i=0; i<cRenderQueue.GetNumOfBatches(); i++) {
+				const RenderQueue::Batch &sBatch = cRenderQueue.GetBatch(i);
+				if (sBatch.nFirstItem != nNextItem || !sBatch.nNumOfItems)
+					return false;
+				nNextItem += sBatch.nNumOfItems;
+				for (uint32 j=1; j<sBatch.nNumOfItems; j++) {
+					if (!IsSameState(cRenderQueue.GetItem(sBatch.nFirstItem), cRenderQueue.GetItem(sBatch.nFirstItem + j)))
+						return false;
+				}
+			}
+			return (nNextItem == cRenderQueue.GetNumOfItems());
+		}
+
+		// Testing objects
+		RenderQueue cRenderQueue;
+		char		nDummy[4096];
+	};
+
+	TEST_FIXTURE(ConstructTest, GetSortKey_Packing) {
+		// State sorting: Layer, program, material, depth
+		CHECK_EQUAL(static_cast<uint64>(0x5123456789ABCDULL) | (static_cast<uint64>(0x3) << 60), RenderQueue::GetSortKey(0x3, 0x051, 0x234567, 0.0f, false) | 0x89ABCD);
+		CHECK_EQUAL(static_cast<uint64>(0x2) << 60, RenderQueue::GetSortKey(0x12, 0, 0, 0.0f, false));
+		CHECK_EQUAL(static_cast<uint64>(0xFFF) << 48, RenderQueue::GetSortKey(0, 0x1FFF, 0, 0.0f, false));
+		CHECK_EQUAL(static_cast<uint64>(0xFFFFFF) << 24, RenderQueue::GetSortKey(0, 0, 0x1FFFFFF, 0.0f, false));
+
+		// Depth sorting: Layer, inverted depth, program, material
+		CHECK_EQUAL((static_cast<uint64>(0x3) << 60) | (static_cast<uint64>(0xFFFFFF) << 36) | (static_cast<uint64>(0x051) << 24) | 0x234567, RenderQueue::GetSortKey(0x3, 0x051, 0x234567, 0.0f, true));
+
+		// Negative depths are handled as 0, nearer items have smaller state sort keys and larger depth sort keys
+		CHECK_EQUAL(RenderQueue::GetSortKey(1, 2, 3, 0.0f, false), RenderQueue::GetSortKey(1, 2, 3, -5.0f, false));
+		CHECK(RenderQueue::GetSortKey(1, 2, 3, 1.0f, false) < RenderQueue::GetSortKey(1, 2, 3, 2.0f, false));
+		CHECK(RenderQueue::GetSortKey(1, 2, 3, 1.0f, true) > RenderQueue::GetSortKey(1, 2, 3, 2.0f, true));
+
+		// The layer has priority over everything else, program and material have priority over the depth
+		CHECK(RenderQueue::GetSortKey(0, 0xFFF, 0xFFFFFF, 1000.0f, false) < RenderQueue::GetSortKey(1, 0, 0, 0.0f, false));
+		CHECK(RenderQueue::GetSortKey(0, 0xFFF, 0xFFFFFF, 0.0f, true) < RenderQueue::GetSortKey(1, 0, 0, 1000.0f, true));
+		CHECK(RenderQueue::GetSortKey(0, 1, 2, 1000.0f, false) < RenderQueue::GetSortKey(0, 1, 3, 0.0f, false));
+		CHECK(RenderQueue::GetSortKey(0, 1, 2, 1000.0f, false) < RenderQueue::GetSortKey(0, 2, 1, 0.0f, false));
+	}
+
+	TEST_FIXTURE(ConstructTest, GetProgramID_KeptOverFrames) {
+		CHECK_EQUAL(0U, cRenderQueue.GetProgramID(nullptr));
+		CHECK_EQUAL(0U, cRenderQueue.GetMaterialID(nullptr));
+		CHECK_EQUAL(1U, cRenderQueue.GetProgramID(nDummy + 10));
+		CHECK_EQUAL(2U, cRenderQueue.GetProgramID(nDummy + 5));
+		CHECK_EQUAL(1U, cRenderQueue.GetMaterialID(nDummy + 5));
+		cRenderQueue.Clear();
+		CHECK_EQUAL(1U, cRenderQueue.GetProgramID(nDummy + 10));
+		CHECK_EQUAL(2U, cRenderQueue.GetProgramID(nDummy + 5));
+		CHECK_EQUAL(1U, cRenderQueue.GetMaterialID(nDummy + 5));
+	}
+
+	TEST_FIXTURE(ConstructTest, Sort_RadixOrder) {
+		// Pseudo random keys covering all key bytes, every key is also used a second time
+		const uint32 nNumOfItems = 2000;
+		uint64 nRandom = 12345;
+		for (uint32 i=0; i<nNumOfItems; i++) {
+			RenderQueue::Item sItem = CreateItem(i, 0, 0, 0.0f);
+			nRandom = nRandom*6364136223846793005ULL + 1442695040888963407ULL;
+			sItem.nSortKey = (i%2) ? cRenderQueue.GetItem(i - 1).nSortKey : nRandom;
+			cRenderQueue.Add(sItem);
+		}
+		cRenderQueue.Sort();
+
+		// Ascending order, each item is still there once and equal keys keep the order the items were added in
+		CHECK_EQUAL(nNumOfItems, cRenderQueue.GetNumOfItems());
+		bool bAscending = true;
+		bool bStable	= true;
+		uint32 nVisNodeSum = GetVisNode(cRenderQueue.GetItem(0));
+		for (uint32 i=1; i<nNumOfItems; i++) {
+			const RenderQueue::Item &sPrevious = cRenderQueue.GetItem(i - 1);
+			const RenderQueue::Item &sItem	   = cRenderQueue.GetItem(i);
+			if (sPrevious.nSortKey > sItem.nSortKey)
+				bAscending = false;
+			if (sPrevious.nSortKey == sItem.nSortKey && GetVisNode(sPrevious) > GetVisNode(sItem))
+				bStable = false;
+			nVisNodeSum += GetVisNode(sItem);
+		}
+		CHECK(bAscending);
+		CHECK(bStable);
+		CHECK_EQUAL(nNumOfItems*(nNumOfItems - 1)/2, nVisNodeSum);
+	}
+
+	TEST_FIXTURE(ConstructTest, Sort_StableStateOrder) {
+		// Two materials and two programs in mixed order, all items at the same depth so only the states are sorted
+		for (uint32 i=0; i<64; i++)
+			cRenderQueue.Add(CreateItem(i, 100 + (i*7)%2, 200 + (i/3)%2, 10.0f));
+		cRenderQueue.Sort();
+
+		// The items are grouped by program (first seen first), then by material, and keep the order they were added in within a group
+		bool bStable = true;
+		uint32 nNumOfStateChanges = 0;
+		for (uint32 i=1; i<cRenderQueue.GetNumOfItems(); i++) {
+			const RenderQueue::Item &sPrevious = cRenderQueue.GetItem(i - 1);
+			const RenderQueue::Item &sItem	   = cRenderQueue.GetItem(i);
+			if (sPrevious.nSortKey == sItem.nSortKey) {
+				if (GetVisNode(sPrevious) > GetVisNode(sItem))
+					bStable = false;
+			} else {
+				nNumOfStateChanges++;
+			}
+		}
+		CHECK(bStable);
+		CHECK_EQUAL(3U, nNumOfStateChanges);
+		CHECK_EQUAL(0U, GetVisNode(cRenderQueue.GetItem(0)));
+
+		// Sorting again doesn't change anything
+		uint32 nOrder[64];
+		for (uint32 i=0; i<64; i++)
+			nOrder[i] = GetVisNode(cRenderQueue.GetItem(i));
+		cRenderQueue.Sort();
+		for (uint32 i=0; i<64; i++)
+			CHECK_EQUAL(nOrder[i], GetVisNode(cRenderQueue.GetItem(i)));
+	}
+
+	TEST_FIXTURE(ConstructTest, Sort_TransparentBackToFront) {
+		// Solid items within layer 0 sorted front to back, transparent items within layer 1 sorted back to front
+		static const float fDepths[] = { 5.0f, 0.5f, 100.0f, 20.0f, 20.5f, 3.0f, 1000.0f, 0.0f };
+		for (uint32 i=0; i<8; i++) {
+			RenderQueue::Item sSolid = CreateItem(i, 100, 200, fDepths[i]);
+			cRenderQueue.Add(sSolid);
+			RenderQueue::Item sTransparent = CreateItem(8 + i, 100 + i%3, 200 + i%2, fDepths[i], true);
+			sTransparent.nSortKey |= static_cast<uint64>(1) << 60;
+			cRenderQueue.Add(sTransparent);
+		}
+		cRenderQueue.Sort();
+
+		// First all solid items from front to back, then all transparent items from back to front, no matter which states they're using
+		CHECK_EQUAL(16U, cRenderQueue.GetNumOfItems());
+		static const uint32 nExpected[] = { 7, 1, 5, 0, 3, 4, 2, 6, 14, 10, 12, 11, 8, 13, 9, 15 };
+		for (uint32 i=0; i<16; i++)
+			CHECK_EQUAL(nExpected[i], GetVisNode(cRenderQueue.GetItem(i)));
+	}
+
+	TEST_FIXTURE(ConstructTest, BuildBatches_Grouping) {
+		// Seven kinds of items, the first one is the reference, each of the others differs from it in exactly one state or buffer
+		const uint32 kinds = 7;
+		const uint32 items = 3;	// Number of items per kind
+		for (uint32 i=0; i<items; i++) {
+			for (uint32 nKind=0; nKind<kinds; nKind++) {
+				RenderQueue::Item sItem = CreateItem(i*kinds + nKind, (nKind == 1) ? 101 : 100, (nKind == 2) ? 201 : 200, static_cast<float>(i*kinds + nKind));
+				switch (nKind) {
+					case 3: sItem.pVertexBuffer = reinterpret_cast<VertexBuffer*>(nDummy + 11);			  break;
+					case 4: sItem.pIndexBuffer  = reinterpret_cast<IndexBuffer*>(nDummy + 12);			  break;
+					case 5: sItem.pGeometry     = reinterpret_cast<const PLMesh::Geometry*>(nDummy + 13); break;
+					case 6: sItem.pCullQuery    = reinterpret_cast<const SQCull*>(nDummy + 14);			  break;
+				}
+				cRenderQueue.Add(sItem);
+			}
+		}
+		cRenderQueue.Sort();
+
+		// Identical items are merged into one batch, items which differ in anything never share a batch
+		cRenderQueue.BuildBatches(256);
+		CHECK_EQUAL(kinds, cRenderQueue.GetNumOfBatches());
+		CHECK(CheckBatches());
+		for (uint32 i=0; i<cRenderQueue.GetNumOfBatches(); i++) {
+			const RenderQueue::Batch &sBatch = cRenderQueue.GetBatch(i);
+			CHECK_EQUAL(items, sBatch.nNumOfItems);
+
+			// The items within a batch keep their order
+			for (uint32 j=1; j<sBatch.nNumOfItems; j++)
+				CHECK(GetVisNode(cRenderQueue.GetItem(sBatch.nFirstItem + j - 1)) < GetVisNode(cRenderQueue.GetItem(sBatch.nFirstItem + j)));
+		}
+
+		// The maximum number of items per batch is respected, rebuilding the batches of already batched items works as well
+		cRenderQueue.BuildBatches(2);
+		CHECK_EQUAL(kinds*2, cRenderQueue.GetNumOfBatches());
+		CHECK(CheckBatches());
+		cRenderQueue.BuildBatches(1);
+		CHECK_EQUAL(kinds*items, cRenderQueue.GetNumOfBatches());
+		CHECK(CheckBatches());
+	}
+
+	TEST_FIXTURE(ConstructTest, BuildBatches_BackToFront) {
+		// When sorting by depth, only identical items at the same depth are merged
+		static const float fDepths[] = { 10.0f, 5.0f, 10.0f, 5.0f, 7.0f, 10.0f };
+		for (uint32 i=0; i<6; i++)
+			cRenderQueue.Add(CreateItem(i, 100, 200, fDepths[i], true));
+		cRenderQueue.Sort();
+		cRenderQueue.BuildBatches(256);
+		CHECK_EQUAL(3U, cRenderQueue.GetNumOfBatches());
+		CHECK(CheckBatches());
+		if (cRenderQueue.GetNumOfBatches() == 3) {
+			// The batches are still drawn from back to front
+			CHECK_EQUAL(3U, cRenderQueue.GetBatch(0).nNumOfItems);
+			CHECK_EQUAL(1U, cRenderQueue.GetBatch(1).nNumOfItems);
+			CHECK_EQUAL(2U, cRenderQueue.GetBatch(2).nNumOfItems);
+			CHECK_EQUAL(4U, GetVisNode(cRenderQueue.GetItem(cRenderQueue.GetBatch(1).nFirstItem)));
+		}
+	}
+}
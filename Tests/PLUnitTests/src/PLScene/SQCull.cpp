@@ -0,0 +1,178 @@
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <UnitTest++/UnitTest++.h>
+#include <PLCore/Runtime.h>
+#include <PLMath/Math.h>
+#include <PLMath/Frustum.h>
+#include <PLMath/Matrix4x4.h>
+#include <PLRenderer/RendererContext.h>
+#include <PLScene/Scene/SceneNode.h>
+#include <PLScene/Scene/SceneContext.h>
+#include <PLScene/Scene/SceneContainer.h>
+#include <PLScene/Visibility/SQCull.h>
+#include <PLScene/Visibility/VisNode.h>
+#include <PLScene/Visibility/VisContainer.h>
+#include "UnitTest++AddIns/PLCheckMacros.h"
+#include "UnitTest++AddIns/PLChecks.h"
+
+using namespace PLCore;
+using namespace PLMath;
+using namespace PLRenderer;
+using namespace PLScene;
+
+/*
+* Naming Convention for SUITE:
+* CLASSNAME
+*/
+SUITE(SQCull) {
+	/*
+	* Naming Convention for METHOD:
+	* METHODNAME_SCENARIO
+	*/
+	// Our cull query Test Fixture :)
+	struct ConstructTest
+	{
+		ConstructTest() :
+			pRendererContext(nullptr),
+			pSceneContext(nullptr),
+			pOccluder(nullptr),
+			pHidden(nullptr),
+			pPartlyVisible(nullptr),
+			pVisible(nullptr),
+			pCullQuery(nullptr)
+		{
+			/* some setup */
+			// The null renderer backend is sufficient, the software occlusion buffer doesn't need the GPU
+			Runtime::ScanDirectoryPluginsAndData(false);
+			pRendererContext = RendererContext::CreateInstance("PLRendererNull::Renderer", NULL_HANDLE);
+			if (pRendererContext) {
+				pSceneContext = new SceneContext(*pRendererContext);
+				SceneContainer *pContainer = static_cast<SceneContainer*>(pSceneContext->GetRoot()->Create("PLScene::SceneContainer", "Scene", "Hierarchy=\"PLScene::SHKdTree\""));
+				if (pContainer) {
+					// A 10x10 wall in front of the camera at the origin, looking along the negative z axis
+					pOccluder = pContainer->Create("PLScene::SNMesh", "Wall", "Position=\"0 0 -10\" Scale=\"10 10 1\" Flags=\"CanOcclude\" Mesh=\"Create PLMesh::MeshCreatorCube Name=\\\"Wall\\\"\"");
+
+					// A box completely behind the wall, one sticking out on the right side of the wall and one next to it
+					pHidden		   = pContainer->Create("PLScene::SNMesh", "Hidden",		"Position=\"0 0 -20\" Mesh=\"Create PLMesh::MeshCreatorCube Name=\\\"Box\\\"\"");
+					pPartlyVisible = pContainer->Create("PLScene::SNMesh", "PartlyVisible", "Position=\"10 0 -20\" Scale=\"4 4 4\" Mesh=\"Create PLMesh::MeshCreatorCube Name=\\\"Box\\\"\"");
+					pVisible	   = pContainer->Create("PLScene::SNMesh", "Visible",		"Position=\"15 0 -20\" Mesh=\"Create PLMesh::MeshCreatorCube Name=\\\"Box\\\"\"");
+
+					// Create the cull query
+					pCullQuery = static_cast<SQCull*>(pContainer->CreateQuery("PLScene::SQCull"));
+					if (pCullQuery)
+						pCullQuery->SetFlags(0);
+				}
+			}
+		}
+		~ConstructTest() {
+			/* some teardown */
+			if (pCullQuery)
+				pCullQuery->GetSceneContainer().DestroyQuery(*pCullQuery);
+			if (pSceneContext)
+				delete pSceneContext;
+			if (pRendererContext)
+				delete pRendererContext;
+		}
+
+		// Performs the visibility determination for a camera at the origin looking along the negative z axis
+		void Cull(SQCull::EMode nMode)
+		{
+			Matrix4x4 mProjection;
+			mProjection.PerspectiveFov(static_cast<float>(60.0f*Math::DegToRad), 16.0f/9.0f, 0.1f, 1000.0f);
+			Frustum cFrustum;
+			cFrustum.CreateViewPlanes(mProjection, false);
+			pCullQuery->SetMode(nMode);
+			pCullQuery->SetCameraPosition(Vector3::Zero);
+			pCullQuery->SetViewFrustum(cFrustum);
+			pCullQuery->SetProjectionMatrix(mProjection);
+			pCullQuery->SetViewMatrix(Matrix4x4::Identity);
+			pCullQuery->SetViewProjectionMatrix(mProjection);
+			pCullQuery->PerformQuery();
+		}
+
+		// Returns whether or not the given scene node was found to be visible by the last visibility determination
+		bool IsVisible(const SceneNode &cSceneNode) const
+		{
+			Iterator<VisNode*> cIterator = pCullQuery->GetVisContainer().GetVisNodes().GetIterator();
+			while (cIterator.HasNext()) {
+				if (cIterator.Next()->GetSceneNode() == &cSceneNode)
+					return true;
+			}
+			return false;
+		}
+
+		// Testing objects
+		RendererContext *pRendererContext;
+		SceneContext	*pSceneContext;
+		SceneNode		*pOccluder;
+		SceneNode		*pHidden;
+		SceneNode		*pPartlyVisible;
+		SceneNode		*pVisible;
+		SQCull			*pCullQuery;
+	};
+
+	TEST_FIXTURE(ConstructTest, PerformQuery_Software_OccludedCulled) {
+		CHECK(pCullQuery);
+		if (pCullQuery) {
+			// View frustum culling only: Everything is visible
+			Cull(SQCull::Frustum);
+			CHECK(IsVisible(*pOccluder));
+			CHECK(IsVisible(*pHidden));
+			CHECK(IsVisible(*pPartlyVisible));
+			CHECK(IsVisible(*pVisible));
+
+			// The box behind the wall is culled by the software occlusion buffer
+			Cull(SQCull::Software);
+			CHECK(IsVisible(*pOccluder));
+			CHECK(!IsVisible(*pHidden));
+			CHECK(IsVisible(*pVisible));
+			CHECK_EQUAL(1U, pCullQuery->GetStatistics().nNumOfOccluders);
+		}
+	}
+
+	TEST_FIXTURE(ConstructTest, PerformQuery_Software_PartlyVisible) {
+		CHECK(pCullQuery);
+		if (pCullQuery) {
+			// Only the left part of the box is behind the wall, so it must not be culled
+			Cull(SQCull::Software);
+			CHECK(IsVisible(*pPartlyVisible));
+			CHECK(!IsVisible(*pHidden));
+
+			// Neither when the box is just slightly sticking out
+			pPartlyVisible->GetTransform().SetPosition(Vector3(8.0f, 0.0f, -20.0f));
+			Cull(SQCull::Software);
+			CHECK(IsVisible(*pPartlyVisible));
+		}
+	}
+
+	TEST_FIXTURE(ConstructTest, PerformQuery_Software_OccluderMoved) {
+		CHECK(pCullQuery);
+		if (pCullQuery) {
+			Cull(SQCull::Software);
+			CHECK(!IsVisible(*pHidden));
+
+			// Move the wall aside, the occluder must be rasterized at its new position
+			pOccluder->GetTransform().SetPosition(Vector3(-100.0f, 0.0f, -10.0f));
+			Cull(SQCull::Software);
+			CHECK(IsVisible(*pHidden));
+			CHECK(IsVisible(*pPartlyVisible));
+			CHECK_EQUAL(0U, pCullQuery->GetStatistics().nNumOfOccluders);
+
+			// Move the wall in front of the right boxes, the box which was hidden before is visible now
+			pOccluder->GetTransform().SetPosition(Vector3(12.0f, 0.0f, -10.0f));
+			Cull(SQCull::Software);
+			CHECK(IsVisible(*pHidden));
+			CHECK(!IsVisible(*pVisible));
+
+			// Scaling the wall changes its triangles as well
+			pOccluder->GetTransform().SetPosition(Vector3(0.0f, 0.0f, -10.0f));
+			pOccluder->GetTransform().SetScale(Vector3(1.0f, 1.0f, 1.0f));
+			Cull(SQCull::Software);
+			CHECK(IsVisible(*pHidden));
+			pOccluder->GetTransform().SetScale(Vector3(10.0f, 10.0f, 1.0f));
+			Cull(SQCull::Software);
+			CHECK(!IsVisible(*pHidden));
+		}
+	}
+}
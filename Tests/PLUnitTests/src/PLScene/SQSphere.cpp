@@ -0,0 +1,199 @@
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <UnitTest++/UnitTest++.h>
+#include <PLCore/Runtime.h>
+#include <PLCore/Base/Event/EventHandler.h>
+#include <PLMath/Math.h>
+#include <PLRenderer/RendererContext.h>
+#include <PLScene/Scene/SceneNode.h>
+#include <PLScene/Scene/SceneContext.h>
+#include <PLScene/Scene/SceneContainer.h>
+#include <PLScene/Scene/SceneQueries/SQSphere.h>
+#include "UnitTest++AddIns/PLCheckMacros.h"
+#include "UnitTest++AddIns/PLChecks.h"
+
+using namespace PLCore;
+using namespace PLMath;
+using namespace PLRenderer;
+using namespace PLScene;
+
+/*
+* Naming Convention for SUITE:
+* CLASSNAME
+*/
+SUITE(SQSphere) {
+	/*
+	* Naming Convention for METHOD:
+	* METHODNAME_SCENARIO
+	*/
+	const uint32 grid    = 16;	// Number of scene nodes along x and z
+	const uint32 spheres = 300;	// Maximum number of spheres to query with
+
+	// Our sphere query Test Fixture :)
+	struct ConstructTest
+	{
+		ConstructTest() :
+			pRendererContext(nullptr),
+			pSceneContext(nullptr),
+			pInner(nullptr),
+			pSphereQuery(nullptr)
+		{
+			/* some setup */
+			// The scene queries don't need the GPU, but the scene context needs a renderer context
+			Runtime::ScanDirectoryPluginsAndData(false);
+			pRendererContext = RendererContext::CreateInstance("PLRendererNull::Renderer", NULL_HANDLE);
+			if (pRendererContext) {
+				pSceneContext = new SceneContext(*pRendererContext);
+				SceneContainer *pContainer = static_cast<SceneContainer*>(pSceneContext->GetRoot()->Create("PLScene::SceneContainer", "Scene", "Hierarchy=\"PLScene::SHKdTree\""));
+				if (pContainer) {
+					// Small scene nodes on a plane
+					for (uint32 nZ=0; nZ<grid; nZ++) {
+						for (uint32 nX=0; nX<grid; nX++) {
+							const int nPosX = static_cast<int>(nX*2) - static_cast<int>(grid);
+							const int nPosZ = static_cast<int>(nZ*2) - static_cast<int>(grid);
+							pContainer->Create("PLScene::SNMesh", "", String("Position=\"") + nPosX + " 0 " + nPosZ + "\" Mesh=\"Create PLMesh::MeshCreatorCube Name=\\\"Box\\\"\"");
+						}
+					}
+
+					// A transformed scene container with some more scene nodes, the spheres have to be transformed into its space
+					pInner = static_cast<SceneContainer*>(pContainer->Create("PLScene::SceneContainer", "Inner", "Position=\"3 2 -5\" Rotation=\"0 30 0\" Scale=\"2 1 0.5\" Hierarchy=\"PLScene::SHKdTree\""));
+					if (pInner) {
+						for (uint32 i=0; i<grid; i++)
+							pInner->Create("PLScene::SNMesh", "", String("Position=\"") + static_cast<int>(i%4)*2 + " 0 " + static_cast<int>(i/4)*3 + "\" Mesh=\"Create PLMesh::MeshCreatorCube Name=\\\"Box\\\"\"");
+					}
+
+					// Spheres of different sizes all over the plane
+					uint32 nRandom = 12345;
+					for (uint32 i=0; i<spheres; i++) {
+						nRandom = nRandom*1103515245 + 12345;
+						const float fX = static_cast<float>((nRandom >> 8)%(grid*200))*0.01f - grid;
+						nRandom = nRandom*1103515245 + 12345;
+						const float fZ = static_cast<float>((nRandom >> 8)%(grid*200))*0.01f - grid;
+						cSpheres[i].SetPos(Vector3(fX, 0.5f, fZ));
+						cSpheres[i].SetRadius(0.5f + static_cast<float>(i%8)*0.5f);
+					}
+
+					// Create the sphere query
+					pSphereQuery = static_cast<SQSphere*>(pContainer->CreateQuery("PLScene::SQSphere"));
+				}
+			}
+		}
+		~ConstructTest() {
+			/* some teardown */
+			if (pSphereQuery)
+				pSphereQuery->GetSceneContainer().DestroyQuery(*pSphereQuery);
+			if (pSceneContext)
+				delete pSceneContext;
+			if (pRendererContext)
+				delete pRendererContext;
+		}
+
+		// Collects the scene nodes found by "PerformQuery()" when using the signal
+		void OnSceneNode(SceneQuery &cQuery, SceneNode &cSceneNode)
+		{
+			lstSignalSceneNodes.Add(&cSceneNode);
+		}
+
+		// Performs the batched queries and compares the results with the ones of single queries using the result buffer and the signal,
+		// returns the total number of found scene nodes or -1 if the results are not equal
+		int Compare(uint32 nNumOfSpheres, uint32 nNumOfThreads)
+		{
+			Array<SceneNode*> lstBatchedSceneNodes;
+			Array<uint32>	  lstFirstSceneNode;
+			Array<float>	  lstBatchedDistances;
+			if (!pSphereQuery->PerformQueries(cSpheres, nNumOfSpheres, lstBatchedSceneNodes, lstFirstSceneNode, &lstBatchedDistances, nNumOfThreads))
+				return -1;
+			if (lstFirstSceneNode.GetNumOfElements() != nNumOfSpheres + 1 || lstBatchedDistances.GetNumOfElements() != lstBatchedSceneNodes.GetNumOfElements())
+				return -1;
+
+			EventHandler<SceneQuery&, SceneNode&> cEventHandler(&ConstructTest::OnSceneNode, this);
+			Array<SceneNode*> lstBufferSceneNodes;
+			Array<float>	  lstBufferDistances;
+			for (uint32 i=0; i<nNumOfSpheres; i++) {
+				pSphereQuery->GetSphere() = cSpheres[i];
+
+				// Result buffer
+				lstBufferSceneNodes.Reset();
+				lstBufferDistances.Reset();
+				pSphereQuery->SetResultBuffer(&lstBufferSceneNodes, &lstBufferDistances);
+				pSphereQuery->PerformQuery();
+				pSphereQuery->SetResultBuffer(nullptr);
+
+				// Signal
+				lstSignalSceneNodes.Reset();
+				pSphereQuery->SignalSceneNode.Connect(cEventHandler);
+				pSphereQuery->PerformQuery();
+				pSphereQuery->SignalSceneNode.Disconnect(cEventHandler);
+
+				// The order of the scene nodes found by one sphere is undefined
+				const uint32 nFirst = lstFirstSceneNode[i];
+				const uint32 nCount = lstFirstSceneNode[i + 1] - nFirst;
+				if (lstBufferSceneNodes.GetNumOfElements() != nCount || lstSignalSceneNodes.GetNumOfElements() != nCount)
+					return -1;
+				for (uint32 j=0; j<nCount; j++) {
+					const int nIndex = lstBufferSceneNodes.GetIndex(lstBatchedSceneNodes[nFirst + j]);
+					if (nIndex < 0 || !lstSignalSceneNodes.IsElement(lstBatchedSceneNodes[nFirst + j]))
+						return -1;
+					if (Math::Abs(lstBufferDistances[nIndex] - lstBatchedDistances[nFirst + j]) > 0.0001f)
+						return -1;
+				}
+			}
+
+			// Done
+			return static_cast<int>(lstBatchedSceneNodes.GetNumOfElements());
+		}
+
+		// Returns whether or not the batched queries are finding scene nodes within the inner scene container
+		bool FindsInner(uint32 nNumOfThreads)
+		{
+			Array<SceneNode*> lstSceneNodes;
+			Array<uint32>	  lstFirstSceneNode;
+			pSphereQuery->PerformQueries(cSpheres, spheres, lstSceneNodes, lstFirstSceneNode, nullptr, nNumOfThreads);
+			for (uint32 i=0; i<lstSceneNodes.GetNumOfElements(); i++) {
+				if (lstSceneNodes[i]->GetContainer() == pInner)
+					return true;
+			}
+			return false;
+		}
+
+		// Testing objects
+		RendererContext   *pRendererContext;
+		SceneContext	  *pSceneContext;
+		SceneContainer	  *pInner;
+		SQSphere		  *pSphereQuery;
+		Sphere			   cSpheres[spheres];
+		Array<SceneNode*>  lstSignalSceneNodes;
+	};
+
+	TEST_FIXTURE(ConstructTest, PerformQueries_EqualToPerformQuery) {
+		CHECK(pSphereQuery && pInner);
+		if (pSphereQuery && pInner) {
+			// Recursive, the spheres are transformed into the space of the inner scene container
+			CHECK(FindsInner(1));
+			CHECK(Compare(spheres, 1) > static_cast<int>(spheres));
+
+			// Not recursive
+			pSphereQuery->SetFlags(0);
+			CHECK(!FindsInner(1));
+			CHECK(Compare(spheres, 1) > static_cast<int>(spheres));
+		}
+	}
+
+	TEST_FIXTURE(ConstructTest, PerformQueries_Threaded) {
+		CHECK(pSphereQuery && pInner);
+		if (pSphereQuery && pInner) {
+			// The results don't depend on the number of threads
+			const int nFound = Compare(spheres, 1);
+			CHECK(nFound > 0);
+			CHECK_EQUAL(nFound, Compare(spheres, 4));
+			CHECK(FindsInner(4));
+
+			// The worker threads and their buffers are reused by the following calls, with less and more spheres per thread
+			CHECK(Compare(130, 2) > 0);
+			CHECK(Compare(spheres, 2) == nFound);
+			CHECK(Compare(0, 4) == 0);
+			CHECK(Compare(spheres, 0) == nFound);
+		}
+	}
+}
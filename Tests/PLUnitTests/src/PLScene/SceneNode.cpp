@@ -0,0 +1,172 @@
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <UnitTest++/UnitTest++.h>
+#include <PLCore/Runtime.h>
+#include <PLMath/Math.h>
+#include <PLMath/Matrix3x4.h>
+#include <PLRenderer/RendererContext.h>
+#include <PLScene/Scene/SceneNode.h>
+#include <PLScene/Scene/SceneContext.h>
+#include <PLScene/Scene/SceneContainer.h>
+#include "UnitTest++AddIns/PLCheckMacros.h"
+#include "UnitTest++AddIns/PLChecks.h"
+
+using namespace PLCore;
+using namespace PLMath;
+using namespace PLRenderer;
+using namespace PLScene;
+
+/*
+* Naming Convention for SUITE:
+* CLASSNAME
+*/
+SUITE(SceneNode) {
+	/*
+	* Naming Convention for METHOD:
+	* METHODNAME_SCENARIO
+	*/
+	const uint32 leafs = 5;	// Number of scene nodes within the inner scene container
+
+	// Our scene node Test Fixture :)
+	struct ConstructTest
+	{
+		ConstructTest() :
+			pRendererContext(nullptr),
+			pSceneContext(nullptr),
+			pOuter(nullptr),
+			pInner(nullptr),
+			pOther(nullptr)
+		{
+			/* some setup */
+			// The null renderer backend is sufficient, nothing is drawn
+			Runtime::ScanDirectoryPluginsAndData(false);
+			pRendererContext = RendererContext::CreateInstance("PLRendererNull::Renderer", NULL_HANDLE);
+			if (pRendererContext) {
+				pSceneContext = new SceneContext(*pRendererContext);
+				SceneContainer *pContainer = static_cast<SceneContainer*>(pSceneContext->GetRoot()->Create("PLScene::SceneContainer", "Scene"));
+				if (pContainer) {
+					// Two nested transformed scene containers, and another one to move scene nodes into
+					pOuter = static_cast<SceneContainer*>(pContainer->Create("PLScene::SceneContainer", "Outer", "Position=\"1 2 3\" Rotation=\"10 20 30\""));
+					pOther = static_cast<SceneContainer*>(pContainer->Create("PLScene::SceneContainer", "Other", "Position=\"-5 0 0\" Rotation=\"0 90 0\" Scale=\"2 2 2\""));
+					if (pOuter) {
+						pInner = static_cast<SceneContainer*>(pOuter->Create("PLScene::SceneContainer", "Inner", "Position=\"0 0 4\" Rotation=\"0 45 0\""));
+						if (pInner) {
+							for (uint32 i=0; i<leafs; i++)
+								lstLeafs.Add(pInner->Create("PLScene::SNHelper", String("Leaf") + i, String("Position=\"") + static_cast<int>(i) + " 1 0\""));
+						}
+					}
+				}
+			}
+		}
+		~ConstructTest() {
+			/* some teardown */
+			if (pSceneContext)
+				delete pSceneContext;
+			if (pRendererContext)
+				delete pRendererContext;
+		}
+
+		// Walks through the scene container chain, this is what had to be done without the world matrix cache
+		static Matrix3x4 GetUncachedWorldMatrix(SceneNode &cSceneNode)
+		{
+			Matrix3x4 mWorld = cSceneNode.GetTransform().GetMatrix();
+			for (SceneContainer *pContainer=cSceneNode.GetContainer(); pContainer; pContainer=pContainer->GetContainer())
+				mWorld = pContainer->GetTransform().GetMatrix()*mWorld;
+			return mWorld;
+		}
+
+		// Returns whether or not the cached world matrices of all leafs are equal to the uncached ones
+		bool CompareLeafs()
+		{
+			for (uint32 i=0; i<lstLeafs.GetNumOfElements(); i++) {
+				const Matrix3x4 mUncached = GetUncachedWorldMatrix(*lstLeafs[i]);
+				const Matrix3x4 &mCached  = lstLeafs[i]->GetWorldMatrix();
+				for (uint32 j=0; j<12; j++) {
+					if (Math::Abs(mCached.fM[j] - mUncached.fM[j]) > 0.0001f)
+						return false;
+				}
+			}
+			return true;
+		}
+
+		// Testing objects
+		RendererContext   *pRendererContext;
+		SceneContext	  *pSceneContext;
+		SceneContainer	  *pOuter;
+		SceneContainer	  *pInner;
+		SceneContainer	  *pOther;
+		Array<SceneNode*>  lstLeafs;
+	};
+
+	TEST_FIXTURE(ConstructTest, GetWorldMatrix_ParentTransformChanged) {
+		CHECK(pInner);
+		if (pInner) {
+			CHECK_EQUAL(leafs, lstLeafs.GetNumOfElements());
+			CHECK(CompareLeafs());
+
+			// Changing a scene container invalidates the cached world matrices of everything below it
+			pOuter->GetTransform().SetPosition(Vector3(7.0f, -3.0f, 0.5f));
+			CHECK(CompareLeafs());
+			pOuter->GetTransform().SetRotation(Quaternion(Vector3::UnitY, 1.0f));
+			pInner->GetTransform().SetScale(Vector3(0.5f, 1.0f, 3.0f));
+			CHECK(CompareLeafs());
+
+			// Same when the dirty world matrices are recalculated by the scene context update instead of on demand
+			pOuter->GetTransform().SetPosition(Vector3(-1.0f, 0.0f, 2.0f));
+			pSceneContext->Update();
+			CHECK(CompareLeafs());
+		}
+	}
+
+	TEST_FIXTURE(ConstructTest, GetWorldMatrix_Reparented) {
+		CHECK(pInner && pOther);
+		if (pInner && pOther) {
+			CHECK(CompareLeafs());
+
+			// Move the first leaf into another scene container, the last leaf takes over its slot within the world matrix cache
+			CHECK(lstLeafs[0]->SetContainer(*pOther));
+			CHECK_EQUAL(pOther, lstLeafs[0]->GetContainer());
+			CHECK(CompareLeafs());
+
+			// The moved leaf follows its new scene container only
+			pOther->GetTransform().SetPosition(Vector3(0.0f, 8.0f, 0.0f));
+			pOuter->GetTransform().SetPosition(Vector3(3.0f, 3.0f, 3.0f));
+			CHECK(CompareLeafs());
+
+			// Move the whole inner scene container into the other one
+			CHECK(pInner->SetContainer(*pOther));
+			CHECK(CompareLeafs());
+			pOther->GetTransform().SetRotation(Quaternion(Vector3::UnitX, 0.5f));
+			pSceneContext->Update();
+			CHECK(CompareLeafs());
+		}
+	}
+
+	TEST_FIXTURE(ConstructTest, GetWorldMatrix_SwapRemove) {
+		CHECK(pInner);
+		if (pInner) {
+			CHECK(CompareLeafs());
+
+			// Removing a scene node moves the last cached world matrix into the free slot
+			CHECK(lstLeafs[1]->Delete());
+			lstLeafs.RemoveAtIndex(1);
+			CHECK(CompareLeafs());
+
+			// Changing the moved scene node must invalidate its new slot, not its old one
+			lstLeafs[leafs - 2]->GetTransform().SetPosition(Vector3(0.0f, -6.0f, 9.0f));
+			CHECK(CompareLeafs());
+
+			// Remove the last scene node as well as the first one, then change the scene container
+			CHECK(lstLeafs[leafs - 2]->Delete());
+			lstLeafs.RemoveAtIndex(leafs - 2);
+			CHECK(lstLeafs[0]->Delete());
+			lstLeafs.RemoveAtIndex(0);
+			pInner->GetTransform().SetRotation(Quaternion(Vector3::UnitZ, 2.0f));
+			CHECK(CompareLeafs());
+			lstLeafs[0]->GetTransform().SetPosition(Vector3(1.0f, 1.0f, 1.0f));
+			pSceneContext->Update();
+			CHECK(CompareLeafs());
+		}
+	}
+}
@@ -0,0 +1,160 @@
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <UnitTest++/UnitTest++.h>
+#include <PLCore/Runtime.h>
+#include <PLMesh/MeshHandler.h>
+#include <PLRenderer/RendererContext.h>
+#include <PLScene/Scene/SNPointLight.h>
+#include <PLScene/Scene/SceneContext.h>
+#include <PLScene/Scene/SceneContainer.h>
+#include <PLScene/Scene/SceneNodes/SNMesh.h>
+#include <PLScene/Scene/SceneNodes/SNHelper.h>
+#include "UnitTest++AddIns/PLCheckMacros.h"
+#include "UnitTest++AddIns/PLChecks.h"
+
+using namespace PLCore;
+using namespace PLMath;
+using namespace PLMesh;
+using namespace PLRenderer;
+using namespace PLScene;
+
+/*
+* Naming Convention for SUITE:
+* CLASSNAME
+*/
+SUITE(SceneNodePool) {
+	/*
+	* Naming Convention for METHOD:
+	* METHODNAME_SCENARIO
+	*/
+	// Our scene node pool Test Fixture :)
+	struct ConstructTest
+	{
+		ConstructTest() :
+			pRendererContext(nullptr),
+			pSceneContext(nullptr),
+			pContainer(nullptr)
+		{
+			/* some setup */
+			// The null renderer backend is sufficient, nothing is drawn
+			Runtime::ScanDirectoryPluginsAndData(false);
+			pRendererContext = RendererContext::CreateInstance("PLRendererNull::Renderer", NULL_HANDLE);
+			if (pRendererContext) {
+				pSceneContext = new SceneContext(*pRendererContext);
+				pContainer = static_cast<SceneContainer*>(pSceneContext->GetRoot()->Create("PLScene::SceneContainer", "Scene"));
+			}
+		}
+		~ConstructTest() {
+			/* some teardown */
+			if (pSceneContext)
+				delete pSceneContext;
+			if (pRendererContext)
+				delete pRendererContext;
+		}
+
+		// Recycles the given scene node and performs the per frame cleanup of the scene context which puts it into the pool
+		void Recycle(SceneNode &cSceneNode)
+		{
+			cSceneNode.Recycle();
+			pSceneContext->Cleanup();
+		}
+
+		// Testing objects
+		RendererContext *pRendererContext;
+		SceneContext	*pSceneContext;
+		SceneContainer	*pContainer;
+	};
+
+	TEST_FIXTURE(ConstructTest, Recycle_Helper) {
+		CHECK(pContainer);
+		if (pContainer) {
+			// A recycled scene node must look like a freshly created one
+			SNHelper *pSceneNode = pContainer->Create<SNHelper>("Recycled");
+			pSceneNode->GetTransform().SetPosition(Vector3(1.0f, 2.0f, 3.0f));
+			pSceneNode->SetFlags(pSceneNode->GetFlags() | SceneNode::Invisible);
+			Recycle(*pSceneNode);
+			CHECK_EQUAL(1U, pSceneContext->GetNumOfRecycledSceneNodes());
+			SNHelper *pReused = pContainer->Create<SNHelper>("", true);
+			CHECK_EQUAL(pSceneNode, pReused);
+			CHECK_EQUAL(0U, pSceneContext->GetNumOfRecycledSceneNodes());
+			CHECK(pReused->IsAnonymous());
+			CHECK(pReused->IsInitialized());
+			CHECK(pReused->IsVisible());
+			CHECK(pReused->GetTransform().GetPosition().IsNull());
+			CHECK(!pContainer->GetByName("Recycled"));
+		}
+	}
+
+	TEST_FIXTURE(ConstructTest, Recycle_Mesh) {
+		CHECK(pContainer);
+		if (pContainer) {
+			SNMesh *pSceneNode = static_cast<SNMesh*>(pContainer->Create("PLScene::SNMesh", "Mesh", "Position=\"1 2 3\" Scale=\"2 2 2\" Flags=\"CastShadow\" Mesh=\"Create PLMesh::MeshCreatorCube Name=\\\"Box\\\"\""));
+			CHECK(pSceneNode);
+			if (pSceneNode) {
+				const String sBox = (pSceneNode->GetMeshHandler() && pSceneNode->GetMeshHandler()->GetMesh()) ? pSceneNode->GetMeshHandler()->GetMesh()->GetName() : "";
+				CHECK(sBox.GetLength());
+				CHECK(pSceneNode->AddModifier("PLScene::SNMRotationLinearAnimation"));
+				CHECK(pSceneNode->AddModifier("PLScene::SNMMeshUpdate"));
+				CHECK_EQUAL(2U, pSceneNode->GetNumOfModifiers());
+
+				// Mesh scene nodes are pooled
+				Recycle(*pSceneNode);
+				CHECK_EQUAL(1U, pSceneContext->GetNumOfRecycledSceneNodes());
+
+				// The reused scene node has the default transform and flags, no mesh and no modifiers
+				SceneNode *pReused = pContainer->Create("PLScene::SNMesh");
+				CHECK_EQUAL(static_cast<SceneNode*>(pSceneNode), pReused);
+				CHECK_EQUAL(0U, pSceneContext->GetNumOfRecycledSceneNodes());
+				CHECK(pSceneNode->IsInitialized());
+				CHECK(pSceneNode->GetTransform().GetPosition().IsNull());
+				CHECK(pSceneNode->GetTransform().GetScale() == Vector3::One);
+				CHECK_EQUAL(0U, pSceneNode->GetFlags());
+				CHECK(!pSceneNode->GetMeshHandler());
+				CHECK(pSceneNode->GetMesh() == "");
+				CHECK_EQUAL(0U, pSceneNode->GetNumOfModifiers());
+
+				// A new mesh is loaded as usual
+				pSceneNode->SetMesh("Create PLMesh::MeshCreatorSphere Name=\"Sphere\"");
+				CHECK(pSceneNode->GetMeshHandler() && pSceneNode->GetMeshHandler()->GetMesh());
+				CHECK_EQUAL("Sphere", pSceneNode->GetMeshHandler()->GetMesh()->GetName());
+
+				// Reuse by class name and attribute values
+				Recycle(*pSceneNode);
+				pReused = pContainer->Create("PLScene::SNMesh", "", "Position=\"4 5 6\" Mesh=\"Create PLMesh::MeshCreatorCube Name=\\\"Box\\\"\"");
+				CHECK_EQUAL(static_cast<SceneNode*>(pSceneNode), pReused);
+				CHECK(pSceneNode->GetTransform().GetPosition() == Vector3(4.0f, 5.0f, 6.0f));
+				CHECK(pSceneNode->GetMeshHandler() && pSceneNode->GetMeshHandler()->GetMesh());
+				CHECK_EQUAL(sBox, pSceneNode->GetMeshHandler()->GetMesh()->GetName());
+				CHECK_EQUAL(0U, pSceneNode->GetNumOfModifiers());
+			}
+		}
+	}
+
+	TEST_FIXTURE(ConstructTest, Recycle_PointLight) {
+		CHECK(pContainer);
+		if (pContainer) {
+			SNPointLight *pSceneNode = pContainer->Create<SNPointLight>();
+			pSceneNode->SetRange(100.0f);
+			const float fDefaultRange = pContainer->Create<SNPointLight>()->GetRange();
+			Recycle(*pSceneNode);
+			CHECK_EQUAL(1U, pSceneContext->GetNumOfRecycledSceneNodes());
+			SNPointLight *pReused = pContainer->Create<SNPointLight>();
+			CHECK_EQUAL(pSceneNode, pReused);
+			CHECK_EQUAL(fDefaultRange, pReused->GetRange());
+		}
+	}
+
+	TEST_FIXTURE(ConstructTest, Recycle_NotPooled) {
+		CHECK(pContainer);
+		if (pContainer) {
+			// Scene nodes not implementing a reset are destroyed instead
+			Recycle(*pContainer->Create("PLScene::SNCamera"));
+			CHECK_EQUAL(0U, pSceneContext->GetNumOfRecycledSceneNodes());
+
+			// Scene containers as well
+			Recycle(*pContainer->Create("PLScene::SceneContainer"));
+			CHECK_EQUAL(0U, pSceneContext->GetNumOfRecycledSceneNodes());
+		}
+	}
+}
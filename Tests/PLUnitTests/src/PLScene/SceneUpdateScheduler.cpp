@@ -0,0 +1,299 @@
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <UnitTest++/UnitTest++.h>
+#include <PLCore/Runtime.h>
+#include <PLCore/Base/Class.h>
+#include <PLCore/Container/Array.h>
+#include <PLRenderer/RendererContext.h>
+#include <PLScene/Scene/SceneNode.h>
+#include <PLScene/Scene/SceneContext.h>
+#include <PLScene/Scene/SceneContainer.h>
+#include <PLScene/Scene/SceneNodeModifier.h>
+#include <PLScene/Scene/SceneUpdateScheduler.h>
+#include "UnitTest++AddIns/PLCheckMacros.h"
+#include "UnitTest++AddIns/PLChecks.h"
+
+using namespace PLCore;
+using namespace PLRenderer;
+using namespace PLScene;
+
+/*
+* Naming Convention for SUITE:
+* CLASSNAME
+*/
+SUITE(SceneUpdateScheduler) {
+	// Number of applied scheduled updates and the IDs of the scene node modifiers in the order they were applied,
+	// only changed on the main thread
+	uint32		  numOfApplies = 0;
+	Array<uint32> appliedIDs;
+
+	// Number of applied scheduled updates when "SceneContext::EventUpdate" was emitted
+	uint32 numOfAppliesOnEventUpdate = 0;
+
+	//[-------------------------------------------------------]
+	//[ Classes                                               ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Scene node modifier test class recording its scheduled updates
+	*/
+	class TestUpdateModifier : public SceneNodeModifier {
+
+
+		//[-------------------------------------------------------]
+		//[ RTTI interface                                        ]
+		//[-------------------------------------------------------]
+		pl_class_def()
+			// Attributes
+			pl_attribute_directvalue(ID,		uint32,	0,	ReadWrite)
+			pl_attribute_directvalue(Stage,		uint32,	0,	ReadWrite)
+			pl_attribute_directvalue(Access,	uint32,	0,	ReadWrite)
+		pl_class_def_end
+
+
+		//[-------------------------------------------------------]
+		//[ Public functions                                      ]
+		//[-------------------------------------------------------]
+		public:
+			TestUpdateModifier(SceneNode &cSceneNode) : SceneNodeModifier(cSceneNode),
+				ID(this),
+				Stage(this),
+				Access(this),
+				nNumOfComputes(0),
+				nAppliesBeforeCompute(0),
+				nAppliesBeforeApply(0)
+			{
+			}
+
+			virtual ~TestUpdateModifier()
+			{
+			}
+
+			// Results of the last scheduled update
+			uint32 nNumOfComputes;			// Number of computed updates
+			uint32 nAppliesBeforeCompute;	// Number of applied updates of all scene node modifiers when the update was computed
+			uint32 nAppliesBeforeApply;		// Number of applied updates of all scene node modifiers when the update was applied
+
+
+		//[-------------------------------------------------------]
+		//[ Protected virtual SceneNodeModifier functions         ]
+		//[-------------------------------------------------------]
+		protected:
+			virtual void OnActivate(bool bActivate) override
+			{
+				// Add/remove to/from the update scheduler
+				SceneContext *pSceneContext = GetSceneContext();
+				if (pSceneContext) {
+					if (bActivate)
+						pSceneContext->GetUpdateScheduler().Add(*this);
+					else
+						pSceneContext->GetUpdateScheduler().Remove(*this);
+				}
+			}
+
+			virtual EUpdateStage GetUpdateStage() const override
+			{
+				return static_cast<EUpdateStage>(Stage.Get());
+			}
+
+			virtual uint32 GetUpdateAccess() const override
+			{
+				return Access;
+			}
+
+			virtual void OnUpdateCompute() override
+			{
+				// May be called from a worker thread, the main thread doesn't apply updates while updates are computed
+				nNumOfComputes++;
+				nAppliesBeforeCompute = numOfApplies;
+			}
+
+			virtual void OnUpdateApply() override
+			{
+				nAppliesBeforeApply = numOfApplies;
+				numOfApplies++;
+				appliedIDs.Add(ID);
+			}
+
+
+	};
+
+
+	//[-------------------------------------------------------]
+	//[ RTTI interface                                        ]
+	//[-------------------------------------------------------]
+	pl_class_metadata(TestUpdateModifier, "", PLScene::SceneNodeModifier, "Scene node modifier test class recording its scheduled updates")
+		// Constructors
+		pl_constructor_1_metadata(ParameterConstructor,	SceneNode&,	"Parameter constructor",	"")
+		// Attributes
+		pl_attribute_metadata(ID,		uint32,	0,	ReadWrite,	"ID of the scene node modifier",	"")
+		pl_attribute_metadata(Stage,	uint32,	0,	ReadWrite,	"Stage of the scheduled update",	"")
+		pl_attribute_metadata(Access,	uint32,	0,	ReadWrite,	"Data the update is accessing",		"")
+	pl_class_metadata_end(TestUpdateModifier)
+
+
+	/*
+	* Naming Convention for METHOD:
+	* METHODNAME_SCENARIO
+	*/
+	// Event handler connected to "SceneContext::EventUpdate"
+	void OnEventUpdate()
+	{
+		numOfAppliesOnEventUpdate = numOfApplies;
+	}
+
+	// Our scene update scheduler Test Fixture :)
+	struct ConstructTest
+	{
+		ConstructTest() :
+			pRendererContext(nullptr),
+			pSceneContext(nullptr),
+			pContainer(nullptr)
+		{
+			/* some setup */
+			// The null renderer backend is sufficient, nothing is drawn
+			Runtime::ScanDirectoryPluginsAndData(false);
+			pRendererContext = RendererContext::CreateInstance("PLRendererNull::Renderer", NULL_HANDLE);
+			if (pRendererContext) {
+				pSceneContext = new SceneContext(*pRendererContext);
+				pContainer = static_cast<SceneContainer*>(pSceneContext->GetRoot()->Create("PLScene::SceneContainer", "Scene"));
+			}
+			numOfApplies = 0;
+			appliedIDs.Reset();
+		}
+		~ConstructTest() {
+			/* some teardown */
+			if (pSceneContext)
+				delete pSceneContext;
+			if (pRendererContext)
+				delete pRendererContext;
+		}
+
+		// Adds a test scene node modifier to the given scene node
+		TestUpdateModifier *AddModifier(SceneNode &cSceneNode, uint32 nID, SceneNodeModifier::EUpdateStage nStage, uint32 nAccess)
+		{
+			return static_cast<TestUpdateModifier*>(cSceneNode.AddModifier("TestUpdateModifier", String("ID=\"") + nID + "\" Stage=\"" + static_cast<uint32>(nStage) + "\" Access=\"" + nAccess + '\"'));
+		}
+
+		// Testing objects
+		RendererContext *pRendererContext;
+		SceneContext	*pSceneContext;
+		SceneContainer	*pContainer;
+	};
+
+	TEST_FIXTURE(ConstructTest, Update_ConflictingAccess) {
+		CHECK(pContainer);
+		if (pContainer) {
+			SceneUpdateScheduler &cUpdateScheduler = pSceneContext->GetUpdateScheduler();
+
+			// Reading the same data on the same scene node: No conflict
+			SceneNode *pSceneNode = pContainer->Create("PLScene::SNHelper", "ReadRead");
+			AddModifier(*pSceneNode, 0, SceneNodeModifier::UpdateStageAnimation, SceneNodeModifier::ReadTransform);
+			AddModifier(*pSceneNode, 1, SceneNodeModifier::UpdateStageAnimation, SceneNodeModifier::ReadTransform);
+			cUpdateScheduler.Update();
+			CHECK_EQUAL(2U, cUpdateScheduler.GetNumOfConcurrentUpdates());
+			CHECK_EQUAL(0U, cUpdateScheduler.GetNumOfMainThreadUpdates());
+
+			// Writing different data on the same scene node: No conflict
+			pSceneNode = pContainer->Create("PLScene::SNHelper", "WriteWrite");
+			AddModifier(*pSceneNode, 2, SceneNodeModifier::UpdateStageAnimation, SceneNodeModifier::ReadTransform | SceneNodeModifier::WriteTransform);
+			AddModifier(*pSceneNode, 3, SceneNodeModifier::UpdateStageAnimation, SceneNodeModifier::WriteMeshHandler);
+			cUpdateScheduler.Update();
+			CHECK_EQUAL(4U, cUpdateScheduler.GetNumOfConcurrentUpdates());
+			CHECK_EQUAL(0U, cUpdateScheduler.GetNumOfMainThreadUpdates());
+
+			// Reading data written by another scene node modifier of the same scene node within the same stage: Conflict
+			pSceneNode = pContainer->Create("PLScene::SNHelper", "WriteRead");
+			AddModifier(*pSceneNode, 4, SceneNodeModifier::UpdateStageAnimation, SceneNodeModifier::WriteTransform);
+			AddModifier(*pSceneNode, 5, SceneNodeModifier::UpdateStageAnimation, SceneNodeModifier::ReadTransform);
+			cUpdateScheduler.Update();
+			CHECK_EQUAL(4U, cUpdateScheduler.GetNumOfConcurrentUpdates());
+			CHECK_EQUAL(2U, cUpdateScheduler.GetNumOfMainThreadUpdates());
+
+			// Writing the same data within different stages: No conflict
+			pSceneNode = pContainer->Create("PLScene::SNHelper", "StageStage");
+			AddModifier(*pSceneNode, 6, SceneNodeModifier::UpdateStageAnimation,  SceneNodeModifier::WriteTransform);
+			AddModifier(*pSceneNode, 7, SceneNodeModifier::UpdateStageConstraint, SceneNodeModifier::WriteTransform);
+			cUpdateScheduler.Update();
+			CHECK_EQUAL(6U, cUpdateScheduler.GetNumOfConcurrentUpdates());
+			CHECK_EQUAL(2U, cUpdateScheduler.GetNumOfMainThreadUpdates());
+
+			// Reading other scene nodes or emitting events: Always updated on the main thread
+			pSceneNode = pContainer->Create("PLScene::SNHelper", "MainThread");
+			AddModifier(*pSceneNode, 8, SceneNodeModifier::UpdateStageAnimation, SceneNodeModifier::ReadParent);
+			pSceneNode = pContainer->Create("PLScene::SNHelper", "Events");
+			AddModifier(*pSceneNode, 9, SceneNodeModifier::UpdateStageAnimation, SceneNodeModifier::MainThread);
+			cUpdateScheduler.Update();
+			CHECK_EQUAL(6U, cUpdateScheduler.GetNumOfConcurrentUpdates());
+			CHECK_EQUAL(4U, cUpdateScheduler.GetNumOfMainThreadUpdates());
+			CHECK_EQUAL(10U, cUpdateScheduler.GetNumOfModifiers());
+		}
+	}
+
+	TEST_FIXTURE(ConstructTest, Update_BeforeEventUpdate) {
+		CHECK(pContainer);
+		if (pContainer) {
+			// The stages are updated one after another, within a stage the concurrent scene node modifiers are applied
+			// first, then the main thread ones are updated - always in the order they were added
+			SceneNode *pSceneNode = pContainer->Create("PLScene::SNHelper", "Node");
+			AddModifier(*pSceneNode, 0, SceneNodeModifier::UpdateStageLate,		  SceneNodeModifier::ReadTransform);
+			AddModifier(*pSceneNode, 1, SceneNodeModifier::UpdateStageConstraint, SceneNodeModifier::ReadParent);
+			AddModifier(*pSceneNode, 2, SceneNodeModifier::UpdateStageAnimation,  SceneNodeModifier::MainThread);
+			AddModifier(*pSceneNode, 3, SceneNodeModifier::UpdateStageAnimation,  SceneNodeModifier::WriteTransform);
+			AddModifier(*pSceneNode, 4, SceneNodeModifier::UpdateStageConstraint, SceneNodeModifier::WriteMeshHandler);
+
+			// Legacy scene node modifiers connected to "SceneContext::EventUpdate" are updated after all scheduled updates
+			EventHandler<> EventHandlerUpdate(&OnEventUpdate);
+			pSceneContext->EventUpdate.Connect(EventHandlerUpdate);
+			numOfAppliesOnEventUpdate = 0;
+			pSceneContext->Update();
+			CHECK_EQUAL(5U, numOfAppliesOnEventUpdate);
+			CHECK_EQUAL(5U, appliedIDs.GetNumOfElements());
+			if (appliedIDs.GetNumOfElements() == 5) {
+				CHECK_EQUAL(3U, appliedIDs[0]);
+				CHECK_EQUAL(2U, appliedIDs[1]);
+				CHECK_EQUAL(4U, appliedIDs[2]);
+				CHECK_EQUAL(1U, appliedIDs[3]);
+				CHECK_EQUAL(0U, appliedIDs[4]);
+			}
+			pSceneContext->EventUpdate.Disconnect(EventHandlerUpdate);
+		}
+	}
+
+	TEST_FIXTURE(ConstructTest, Update_ComputeBeforeApply) {
+		CHECK(pContainer);
+		if (pContainer) {
+			// Enough concurrent scene node modifiers to use the worker threads, the last scene node gets a conflicting
+			// scene node modifier so two of them are updated on the main thread
+			const uint32 nNumOfModifiers = 1024;
+			Array<TestUpdateModifier*> lstModifiers;
+			for (uint32 i=0; i<nNumOfModifiers; i++) {
+				SceneNode *pSceneNode = pContainer->Create("PLScene::SNHelper", String("Node") + i);
+				lstModifiers.Add(AddModifier(*pSceneNode, i, SceneNodeModifier::UpdateStageAnimation, SceneNodeModifier::ReadTransform | SceneNodeModifier::WriteTransform));
+				if (i == nNumOfModifiers - 1)
+					lstModifiers.Add(AddModifier(*pSceneNode, i + 1, SceneNodeModifier::UpdateStageAnimation, SceneNodeModifier::ReadTransform));
+			}
+			SceneUpdateScheduler &cUpdateScheduler = pSceneContext->GetUpdateScheduler();
+			cUpdateScheduler.SetNumOfThreads(4);
+			cUpdateScheduler.Update();
+			CHECK_EQUAL(nNumOfModifiers - 1, cUpdateScheduler.GetNumOfConcurrentUpdates());
+			CHECK_EQUAL(2U, cUpdateScheduler.GetNumOfMainThreadUpdates());
+
+			// All concurrent updates are computed before the first one is applied, the main thread updates are computed
+			// right before they are applied
+			for (uint32 i=0; i<lstModifiers.GetNumOfElements(); i++) {
+				const TestUpdateModifier &cModifier = *lstModifiers[i];
+				CHECK_EQUAL(1U, cModifier.nNumOfComputes);
+				CHECK_EQUAL(i, cModifier.nAppliesBeforeApply);
+				CHECK_EQUAL((i < nNumOfModifiers - 1) ? 0U : i, cModifier.nAppliesBeforeCompute);
+			}
+
+			// Changing the number of threads stops the worker threads, the next update creates them again
+			cUpdateScheduler.SetNumOfThreads(2);
+			cUpdateScheduler.Update();
+			CHECK_EQUAL(nNumOfModifiers - 1, cUpdateScheduler.GetNumOfConcurrentUpdates());
+			CHECK_EQUAL(2U*(nNumOfModifiers + 1), numOfApplies);
+		}
+	}
+}
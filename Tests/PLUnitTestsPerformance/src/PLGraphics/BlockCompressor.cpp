@@ -0,0 +1,139 @@
+/*********************************************************\
+ *  File: BlockCompressor.cpp                            *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <math.h>
+#include <fstream>
+#include <UnitTest++/UnitTest++.h>
+#include <PLCore/System/System.h>
+#include <PLMath/Vector3i.h>
+#include <PLGraphics/Image/BlockCompressor.h>
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+using namespace std;
+using namespace PLCore;
+using namespace PLMath;
+using namespace PLGraphics;
+
+
+//[-------------------------------------------------------]
+//[ Global variables                                      ]
+//[-------------------------------------------------------]
+extern ofstream outputFile;
+
+
+//[-------------------------------------------------------]
+//[ Global functions                                      ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Fills RGBA pixels with smooth gradients, hard edges and some noise, a mix of what textures usually contain
+*/
+void CreateBlockCompressorTestData(uint8 *pnRGBA, uint32 nWidth, uint32 nHeight)
+{
+	uint32 nRandom = 12345;
+	for (uint32 y=0; y<nHeight; y++) {
+		for (uint32 x=0; x<nWidth; x++) {
+			nRandom = nRandom*1103515245 + 12345;
+			const int nNoise = static_cast<int>((nRandom >> 16) & 0xF) - 8;
+			const bool bEdge = ((x/37 + y/29) & 1) != 0;
+			const int nR = (x*255)/nWidth;
+			const int nG = bEdge ? 200 - static_cast<int>((y*150)/nHeight) : static_cast<int>((y*255)/nHeight);
+			const int nB = static_cast<int>(128 + 100*sin(x*0.05)*cos(y*0.03));
+			const int nA = bEdge ? 255 : static_cast<int>(((x + y)*255)/(nWidth + nHeight));
+			uint8 *pnPixel = &pnRGBA[(y*nWidth + x)*4];
+			pnPixel[0] = static_cast<uint8>(nR + nNoise < 0 ? 0 : (nR + nNoise > 255 ? 255 : nR + nNoise));
+			pnPixel[1] = static_cast<uint8>(nG);
+			pnPixel[2] = static_cast<uint8>(nB + nNoise < 0 ? 0 : (nB + nNoise > 255 ? 255 : nB + nNoise));
+			pnPixel[3] = static_cast<uint8>(nA);
+		}
+	}
+}
+
+
+/*
+* Naming Convention for SUITE:
+* CLASSNAME
+*/
+SUITE(BlockCompressor_Performance) {
+	/*
+	* Naming Convention for METHOD:
+	* METHODNAME_SCENARIO
+	*/
+	// general objects for testing, the buffers are allocated once when the suite is set up and released on exit
+	const uint32 size = 512;	// Image width and height
+	struct BlockCompressorTestData {
+		uint8 *pnRGBA;
+		uint8 *pnCompressed;
+
+		BlockCompressorTestData() :
+			pnRGBA(new uint8[size*size*4]),
+			pnCompressed(new uint8[size*size])
+		{
+			CreateBlockCompressorTestData(pnRGBA, size, size);
+		}
+
+		~BlockCompressorTestData()
+		{
+			delete [] pnCompressed;
+			delete [] pnRGBA;
+		}
+	} testData;
+	uint8 *&pnRGBA		 = testData.pnRGBA;
+	uint8 *&pnCompressed = testData.pnCompressed;
+
+	TEST(DXT1_Fast_SingleThread){
+		const uint64 nStart = System::GetInstance()->GetMicroseconds();
+		BlockCompressor::Compress(CompressionDXT1, CompressionQualityFast, pnRGBA, 4, Vector3i(size, size, 1), pnCompressed, 1);
+		const uint64 nTime = System::GetInstance()->GetMicroseconds() - nStart;
+		outputFile << "DXT1 fast, 1 thread: " << (size*size)/static_cast<double>(nTime ? nTime : 1) << " MPixel/s\n";
+	}
+
+	TEST(DXT1_Fast){
+		const uint64 nStart = System::GetInstance()->GetMicroseconds();
+		BlockCompressor::Compress(CompressionDXT1, CompressionQualityFast, pnRGBA, 4, Vector3i(size, size, 1), pnCompressed);
+		const uint64 nTime = System::GetInstance()->GetMicroseconds() - nStart;
+		outputFile << "DXT1 fast, " << System::GetInstance()->GetNumOfProcessors() << " processors: " << (size*size)/static_cast<double>(nTime ? nTime : 1) << " MPixel/s\n";
+	}
+
+	TEST(DXT5_High_SingleThread){
+		const uint64 nStart = System::GetInstance()->GetMicroseconds();
+		BlockCompressor::Compress(CompressionDXT5, CompressionQualityHigh, pnRGBA, 4, Vector3i(size, size, 1), pnCompressed, 1);
+		const uint64 nTime = System::GetInstance()->GetMicroseconds() - nStart;
+		outputFile << "DXT5 high, 1 thread: " << (size*size)/static_cast<double>(nTime ? nTime : 1) << " MPixel/s\n";
+	}
+
+	TEST(DXT5_High){
+		const uint64 nStart = System::GetInstance()->GetMicroseconds();
+		BlockCompressor::Compress(CompressionDXT5, CompressionQualityHigh, pnRGBA, 4, Vector3i(size, size, 1), pnCompressed);
+		const uint64 nTime = System::GetInstance()->GetMicroseconds() - nStart;
+		outputFile << "DXT5 high, " << System::GetInstance()->GetNumOfProcessors() << " processors: " << (size*size)/static_cast<double>(nTime ? nTime : 1) << " MPixel/s\n";
+	}
+}
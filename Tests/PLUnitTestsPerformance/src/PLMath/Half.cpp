@@ -0,0 +1,99 @@
+/*********************************************************\
+ *  File: Half.cpp                                       *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <fstream>
+#include <UnitTest++/UnitTest++.h>
+#include <PLMath/Half.h>
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+using namespace std;
+using namespace PLMath;
+
+
+//[-------------------------------------------------------]
+//[ Global variables                                      ]
+//[-------------------------------------------------------]
+extern ofstream outputFile;
+
+
+/*
+* Naming Convention for SUITE:
+* CLASSNAME
+*/
+SUITE(Half_Performance) {
+	/*
+	* Naming Convention for METHOD:
+	* METHODNAME_SCENARIO
+	*/
+	// general objects for testing, the data is created once when the suite is set up and released on exit
+	const PLCore::uint32 count = 2048*2048*4;	// number of values (2048x2048 RGBA image)
+	struct HalfTestData {
+		PLCore::uint16 *halfs;
+		float		   *floats;
+
+		HalfTestData() :
+			halfs(new PLCore::uint16[count]),
+			floats(new float[count])
+		{
+			// Cover the whole half range, including denormalized values, infinity and NAN
+			for (PLCore::uint32 i=0; i<count; i++) {
+				halfs[i]  = static_cast<PLCore::uint16>(i*40503u);
+				floats[i] = 0.0f;
+			}
+		}
+
+		~HalfTestData()
+		{
+			delete [] floats;
+			delete [] halfs;
+		}
+	} testData;
+	PLCore::uint16 *halfs = testData.halfs;
+	float *floats = testData.floats;
+
+	TEST(Scalar_ToFloat_16M){
+		for (PLCore::uint32 i=0; i<count; i++)
+			floats[i] = Half::ToFloat(halfs[i]);
+	}
+
+	TEST(Bulk_ToFloatArray_16M){
+		Half::ToFloatArray(halfs, floats, count);
+	}
+
+	TEST(Scalar_FromFloat_16M){
+		for (PLCore::uint32 i=0; i<count; i++)
+			halfs[i] = Half::FromFloat(floats[i]);
+	}
+
+	TEST(Bulk_FromFloatArray_16M){
+		Half::FromFloatArray(floats, halfs, count);
+	}
+}
@@ -0,0 +1,122 @@
+/*********************************************************\
+ *  File: LooseOctree.cpp                                *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <fstream>
+#include <UnitTest++/UnitTest++.h>
+#include <PLMath/Math.h>
+#include <PLMath/PlaneSet.h>
+#include <PLMath/Intersect.h>
+#include <PLMath/LooseOctree.h>
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+using namespace std;
+using namespace PLCore;
+using namespace PLMath;
+
+
+//[-------------------------------------------------------]
+//[ Global variables                                      ]
+//[-------------------------------------------------------]
+extern ofstream outputFile;
+
+
+/*
+* Naming Convention for SUITE:
+* CLASSNAME
+*/
+SUITE(LooseOctree_Performance) {
+	/*
+	* Naming Convention for METHOD:
+	* METHODNAME_SCENARIO
+	*/
+	// general objects for testing, the boxes are created once when the suite is set up and released on exit
+	const uint32 count = 200000;
+	struct LooseOctreeTestData {
+		AABoundingBox *boxes;
+		uint32		  *items;
+		LooseOctree	   octree;
+		PlaneSet	   planeSet;
+
+		LooseOctreeTestData() :
+			boxes(new AABoundingBox[count]),
+			items(new uint32[count])
+		{
+			for (uint32 i=0; i<count; i++) {
+				const Vector3 vCenter(Math::GetRandNegFloat()*1000.0f, Math::GetRandNegFloat()*1000.0f, Math::GetRandNegFloat()*100.0f);
+				const float fSize = Math::GetRandMinMaxFloat(0.1f, 5.0f);
+				boxes[i] = AABoundingBox(vCenter - Vector3(fSize, fSize, fSize), vCenter + Vector3(fSize, fSize, fSize));
+			}
+			planeSet.CreateBox(Vector3(-200.0f, -100.0f, -50.0f), Vector3(100.0f, 200.0f, 50.0f));
+		}
+
+		~LooseOctreeTestData()
+		{
+			octree.Clear();
+			delete [] items;
+			delete [] boxes;
+		}
+	} testData;
+	AABoundingBox *&boxes	 = testData.boxes;
+	uint32		  *&items	 = testData.items;
+	LooseOctree	   &octree	 = testData.octree;
+	PlaneSet	   &planeSet = testData.planeSet;
+
+	TEST(Build_SingleThread_200000){
+		octree.Build(boxes, count, 16, 1);
+	}
+
+	TEST(Build_MultipleThreads_200000){
+		octree.Build(boxes, count, 16);
+	}
+
+	TEST(Insert_200000){
+		octree.Init(AABoundingBox(-1000.0f, -1000.0f, -100.0f, 1000.0f, 1000.0f, 100.0f));
+		for (uint32 i=0; i<count; i++)
+			octree.Insert(i, boxes[i]);
+	}
+
+	TEST(BruteForce_PlaneSet_200000){
+		uint32 nNumOfItems = 0;
+		for (uint32 i=0; i<count; i++) {
+			if (Intersect::PlaneSetAABox(planeSet, boxes[i].vMin, boxes[i].vMax))
+				items[nNumOfItems++] = i;
+		}
+	}
+
+	TEST(Octree_PlaneSet_200000){
+		octree.GetItems(planeSet, items, count);
+	}
+
+	TEST(Octree_Ray_200000){
+		for (uint32 i=0; i<100; i++)
+			octree.GetItems(Vector3(-1000.0f, i*10.0f - 500.0f, 0.0f), Vector3(1.0f, 0.1f, 0.0f), items, count);
+	}
+}
@@ -0,0 +1,120 @@
+/*********************************************************\
+ *  File: NoiseGrid.cpp                                  *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <fstream>
+#include <UnitTest++/UnitTest++.h>
+#include <PLMath/Vector3.h>
+#include <PLMath/PerlinNoise.h>
+#include <PLMath/SimplexNoise.h>
+#include <PLMath/NoiseGrid.h>
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+using namespace std;
+using namespace PLMath;
+
+
+//[-------------------------------------------------------]
+//[ Global variables                                      ]
+//[-------------------------------------------------------]
+extern ofstream outputFile;
+
+
+/*
+* Naming Convention for SUITE:
+* CLASSNAME
+*/
+SUITE(NoiseGrid_Performance) {
+	/*
+	* Naming Convention for METHOD:
+	* METHODNAME_SCENARIO
+	*/
+	// general objects for testing, the volume is created once when the suite is set up and released on exit
+	const PLCore::uint32 size = 128;	// volume size (size*size*size samples)
+	const float step = 3.0f/size;		// sample distance
+	struct NoiseGridTestData {
+		float *volume;
+
+		NoiseGridTestData() :
+			volume(new float[256*256*256])
+		{
+		}
+
+		~NoiseGridTestData()
+		{
+			delete [] volume;
+		}
+	} testData;
+	float *&volume = testData.volume;
+
+	TEST(Scalar_Perlin_Noise3_128){
+		float *dest = volume;
+		for (PLCore::uint32 z=0; z<size; z++) {
+			for (PLCore::uint32 y=0; y<size; y++) {
+				for (PLCore::uint32 x=0; x<size; x++) {
+					const double vec[3] = { x*step, y*step, z*step };
+					*dest++ = static_cast<float>(PerlinNoise::Noise3(vec));
+				}
+			}
+		}
+	}
+
+	TEST(Grid_Perlin_Noise3_128_SingleThread){
+		NoiseGrid::Noise3(NoiseGrid::Perlin, volume, size, size, size, Vector3::Zero, Vector3(step, step, step), 1);
+	}
+
+	TEST(Grid_Perlin_Noise3_128){
+		NoiseGrid::Noise3(NoiseGrid::Perlin, volume, size, size, size, Vector3::Zero, Vector3(step, step, step));
+	}
+
+	TEST(Scalar_Simplex_Noise3_128){
+		float *dest = volume;
+		for (PLCore::uint32 z=0; z<size; z++) {
+			for (PLCore::uint32 y=0; y<size; y++) {
+				for (PLCore::uint32 x=0; x<size; x++)
+					*dest++ = SimplexNoise::Noise3(x*step, y*step, z*step);
+			}
+		}
+	}
+
+	TEST(Grid_Simplex_Noise3_128_SingleThread){
+		NoiseGrid::Noise3(NoiseGrid::Simplex, volume, size, size, size, Vector3::Zero, Vector3(step, step, step), 1);
+	}
+
+	TEST(Grid_Simplex_Noise3_128){
+		NoiseGrid::Noise3(NoiseGrid::Simplex, volume, size, size, size, Vector3::Zero, Vector3(step, step, step));
+	}
+
+	TEST(Grid_Perlin_FractalSum3_256){
+		NoiseGrid::FractalSum3(NoiseGrid::Perlin, volume, 256, 256, 256, Vector3::Zero, Vector3(step/2, step/2, step/2), 5.0f, 6.0f, 3);
+	}
+
+	TEST(Grid_Simplex_FractalSum3_256){
+		NoiseGrid::FractalSum3(NoiseGrid::Simplex, volume, 256, 256, 256, Vector3::Zero, Vector3(step/2, step/2, step/2), 5.0f, 6.0f, 3);
+	}
+}
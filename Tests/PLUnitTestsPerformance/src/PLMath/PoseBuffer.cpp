@@ -0,0 +1,185 @@
+/*********************************************************\
+ *  File: PoseBuffer.cpp                                 *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <fstream>
+#include <UnitTest++/UnitTest++.h>
+#include <PLMath/Math.h>
+#include <PLMath/Matrix3x4.h>
+#include <PLMath/PoseBuffer.h>
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+using namespace std;
+using namespace PLCore;
+using namespace PLMath;
+
+
+//[-------------------------------------------------------]
+//[ Global variables                                      ]
+//[-------------------------------------------------------]
+extern ofstream outputFile;
+
+
+/*
+* Naming Convention for SUITE:
+* CLASSNAME
+*/
+SUITE(PoseBuffer_Performance) {
+	/*
+	* Naming Convention for METHOD:
+	* METHODNAME_SCENARIO
+	*/
+	// general objects for testing, the poses are created once when the suite is set up and released on exit
+	const uint32 numOfSkeletons = 1000;
+	const uint32 numOfJoints    = 60;
+	const uint32 count          = numOfSkeletons*numOfJoints;
+	struct PoseBufferTestData {
+		// Array of structures
+		Vector3    *positions1;
+		Vector3    *positions2;
+		Quaternion *rotations1;
+		Quaternion *rotations2;
+		Vector3    *scales;
+		Vector3    *resultPositions;
+		Quaternion *resultRotations;
+		Vector3    *resultScales;
+
+		// Structure of arrays, one pose buffer per skeleton
+		PoseBuffer *poses1;
+		PoseBuffer *poses2;
+		PoseBuffer *result;
+
+		int32     *parents;
+		Matrix3x4 *matrices;
+
+		PoseBufferTestData() :
+			positions1(new Vector3[count]),
+			positions2(new Vector3[count]),
+			rotations1(new Quaternion[count]),
+			rotations2(new Quaternion[count]),
+			scales(new Vector3[count]),
+			resultPositions(new Vector3[count]),
+			resultRotations(new Quaternion[count]),
+			resultScales(new Vector3[count]),
+			poses1(new PoseBuffer[numOfSkeletons]),
+			poses2(new PoseBuffer[numOfSkeletons]),
+			result(new PoseBuffer[numOfSkeletons]),
+			parents(new int32[numOfJoints]),
+			matrices(new Matrix3x4[count])
+		{
+			// Simple chain based hierarchy, every fifth joint starts a new chain attached to the root
+			for (uint32 nJoint=0; nJoint<numOfJoints; nJoint++)
+				parents[nJoint] = nJoint ? ((nJoint%5) ? static_cast<int32>(nJoint - 1) : 0) : -1;
+
+			for (uint32 nSkeleton=0; nSkeleton<numOfSkeletons; nSkeleton++) {
+				poses1[nSkeleton].Resize(numOfJoints);
+				poses2[nSkeleton].Resize(numOfJoints);
+				for (uint32 nJoint=0; nJoint<numOfJoints; nJoint++) {
+					const uint32 i = nSkeleton*numOfJoints + nJoint;
+					positions1[i] = Vector3(Math::GetRandNegFloat(), Math::GetRandNegFloat(), Math::GetRandNegFloat());
+					positions2[i] = Vector3(Math::GetRandNegFloat(), Math::GetRandNegFloat(), Math::GetRandNegFloat());
+					rotations1[i] = Quaternion(Math::GetRandNegFloat(), Math::GetRandNegFloat(), Math::GetRandNegFloat(), Math::GetRandNegFloat()).GetNormalized();
+					rotations2[i] = Quaternion(Math::GetRandNegFloat(), Math::GetRandNegFloat(), Math::GetRandNegFloat(), Math::GetRandNegFloat()).GetNormalized();
+					scales[i]     = Vector3::One;
+					poses1[nSkeleton].SetJoint(nJoint, positions1[i], rotations1[i], scales[i]);
+					poses2[nSkeleton].SetJoint(nJoint, positions2[i], rotations2[i], scales[i]);
+				}
+			}
+		}
+
+		~PoseBufferTestData()
+		{
+			delete [] matrices;
+			delete [] parents;
+			delete [] result;
+			delete [] poses2;
+			delete [] poses1;
+			delete [] resultScales;
+			delete [] resultRotations;
+			delete [] resultPositions;
+			delete [] scales;
+			delete [] rotations2;
+			delete [] rotations1;
+			delete [] positions2;
+			delete [] positions1;
+		}
+	} testData;
+	Vector3    *&positions1      = testData.positions1;
+	Vector3    *&positions2      = testData.positions2;
+	Quaternion *&rotations1      = testData.rotations1;
+	Quaternion *&rotations2      = testData.rotations2;
+	Vector3    *&scales          = testData.scales;
+	Vector3    *&resultPositions = testData.resultPositions;
+	Quaternion *&resultRotations = testData.resultRotations;
+	Vector3    *&resultScales    = testData.resultScales;
+	PoseBuffer *&poses1          = testData.poses1;
+	PoseBuffer *&poses2          = testData.poses2;
+	PoseBuffer *&result          = testData.result;
+	int32      *&parents         = testData.parents;
+	Matrix3x4  *&matrices        = testData.matrices;
+
+	TEST(AoS_Slerp_LocalToModel_1000x60){
+		for (uint32 nSkeleton=0; nSkeleton<numOfSkeletons; nSkeleton++) {
+			Matrix3x4 *pmMatrices = &matrices[nSkeleton*numOfJoints];
+			for (uint32 nJoint=0; nJoint<numOfJoints; nJoint++) {
+				const uint32 i = nSkeleton*numOfJoints + nJoint;
+				Quaternion qRotation;
+				qRotation.Slerp(rotations1[i], rotations2[i], 0.3f);
+				pmMatrices[nJoint].FromQuatTrans(qRotation, positions1[i]*0.7f + positions2[i]*0.3f);
+				if (parents[nJoint] >= 0)
+					pmMatrices[nJoint] = pmMatrices[parents[nJoint]]*pmMatrices[nJoint];
+			}
+		}
+	}
+
+	TEST(SoA_Slerp_LocalToModel_1000x60){
+		for (uint32 nSkeleton=0; nSkeleton<numOfSkeletons; nSkeleton++) {
+			PoseBuffer::Slerp(poses1[nSkeleton], poses2[nSkeleton], 0.3f, result[nSkeleton]);
+			PoseBuffer::LocalToModel(result[nSkeleton], parents, result[nSkeleton]);
+			PoseBuffer::ToMatrices(result[nSkeleton], &matrices[nSkeleton*numOfJoints]);
+		}
+	}
+
+	TEST(AoS_Nlerp_1000x60){
+		for (uint32 i=0; i<count; i++) {
+			Quaternion qTo = rotations2[i];
+			if (rotations1[i].DotProduct(qTo) < 0.0f)
+				qTo *= -1.0f;
+			resultPositions[i] = positions1[i]*0.7f + positions2[i]*0.3f;
+			resultRotations[i] = (rotations1[i]*0.7f + qTo*0.3f).GetNormalized();
+			resultScales[i]    = scales[i]*0.7f + scales[i]*0.3f;
+		}
+	}
+
+	TEST(SoA_Nlerp_1000x60){
+		for (uint32 nSkeleton=0; nSkeleton<numOfSkeletons; nSkeleton++)
+			PoseBuffer::Nlerp(poses1[nSkeleton], poses2[nSkeleton], 0.3f, result[nSkeleton]);
+	}
+}
@@ -0,0 +1,132 @@
+/*********************************************************\
+ *  File: MeshQuantizer.cpp                              *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <fstream>
+#include <UnitTest++/UnitTest++.h>
+#include <PLCore/Runtime.h>
+#include <PLMath/Math.h>
+#include <PLGraphics/Color/Color4.h>
+#include <PLRenderer/RendererContext.h>
+#include <PLRenderer/Renderer/Renderer.h>
+#include <PLRenderer/Renderer/VertexBuffer.h>
+#include <PLMesh/MeshQuantizer.h>
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+using namespace std;
+using namespace PLCore;
+using namespace PLMath;
+using namespace PLGraphics;
+using namespace PLRenderer;
+using namespace PLMesh;
+
+
+//[-------------------------------------------------------]
+//[ Global variables                                      ]
+//[-------------------------------------------------------]
+extern ofstream outputFile;
+
+
+/*
+* Naming Convention for SUITE:
+* CLASSNAME
+*/
+SUITE(MeshQuantizer_Performance) {
+	/*
+	* Naming Convention for METHOD:
+	* METHODNAME_SCENARIO
+	*/
+	// general objects for testing, the renderer context is created once when the suite is set up and released on exit
+	const uint32 vertices = 10000;	// Number of vertices of the test vertex buffer
+	struct MeshQuantizerTestData {
+		RendererContext *pRendererContext;
+
+		MeshQuantizerTestData() :
+			// The null renderer backend is sufficient, it keeps the vertex data within system memory
+			pRendererContext((Runtime::ScanDirectoryPluginsAndData(false), RendererContext::CreateInstance("PLRendererNull::Renderer", NULL_HANDLE)))
+		{
+		}
+
+		~MeshQuantizerTestData()
+		{
+			if (pRendererContext)
+				delete pRendererContext;
+		}
+	} testData;
+	RendererContext *&pRendererContext = testData.pRendererContext;
+
+	VertexBuffer *CreateVertexBuffer(Renderer &cRenderer)
+	{
+		// Typical static mesh vertex layout
+		VertexBuffer *pVertexBuffer = cRenderer.CreateVertexBuffer();
+		pVertexBuffer->AddVertexAttribute(VertexBuffer::Position, 0, VertexBuffer::Float3);
+		pVertexBuffer->AddVertexAttribute(VertexBuffer::Normal,   0, VertexBuffer::Float3);
+		pVertexBuffer->AddVertexAttribute(VertexBuffer::Tangent,  0, VertexBuffer::Float3);
+		pVertexBuffer->AddVertexAttribute(VertexBuffer::TexCoord, 0, VertexBuffer::Float2);
+		pVertexBuffer->AddVertexAttribute(VertexBuffer::Color,    0, VertexBuffer::RGBA);
+		pVertexBuffer->Allocate(vertices);
+		if (pVertexBuffer->Lock(Lock::WriteOnly)) {
+			for (uint32 i=0; i<vertices; i++) {
+				const float fAngle = static_cast<float>(i)*0.01f;
+				const float fNormal[3]  = { Math::Cos(fAngle), Math::Sin(fAngle), 0.0f };
+				const float fTangent[3] = { 0.0f, 0.0f, 1.0f };
+				pVertexBuffer->SetFloat(i, VertexBuffer::Position, 0, fNormal[0]*10.0f, fNormal[1]*10.0f, static_cast<float>(i%100)*0.1f);
+				pVertexBuffer->SetFloat(i, VertexBuffer::Normal,   0, fNormal[0], fNormal[1], fNormal[2]);
+				pVertexBuffer->SetFloat(i, VertexBuffer::Tangent,  0, fTangent[0], fTangent[1], fTangent[2]);
+				pVertexBuffer->SetFloat(i, VertexBuffer::TexCoord, 0, static_cast<float>(i%256)/256.0f, static_cast<float>(i/256)/64.0f);
+				pVertexBuffer->SetColor(i, Color4(0.5f, 0.25f, 1.0f, 1.0f));
+			}
+			pVertexBuffer->Unlock();
+		}
+		return pVertexBuffer;
+	}
+
+	TEST(Quantize_StaticMesh){
+		if (pRendererContext) {
+			VertexBuffer *pVertexBuffer = CreateVertexBuffer(pRendererContext->GetRenderer());
+			MeshQuantizer cMeshQuantizer;
+			MeshQuantizer::Result sResult;
+			cMeshQuantizer.Quantize(*pVertexBuffer, &sResult);
+			outputFile << "Static mesh vertex data: " << sResult.nSizeBefore << " -> " << sResult.nSizeAfter << " bytes (" << vertices << " vertices)\n";
+			delete pVertexBuffer;
+		}
+	}
+
+	TEST(Quantize_Positions){
+		if (pRendererContext) {
+			VertexBuffer *pVertexBuffer = CreateVertexBuffer(pRendererContext->GetRenderer());
+			MeshQuantizer cMeshQuantizer;
+			cMeshQuantizer.SetQuantizePositions(true);
+			cMeshQuantizer.SetMaxErrors(0.01f);
+			MeshQuantizer::Result sResult;
+			cMeshQuantizer.Quantize(*pVertexBuffer, &sResult);
+			outputFile << "Static mesh vertex data including positions: " << sResult.nSizeBefore << " -> " << sResult.nSizeAfter << " bytes\n";
+			delete pVertexBuffer;
+		}
+	}
+}
@@ -0,0 +1,176 @@
+/*********************************************************\
+ *  File: CommandList.cpp                                *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <fstream>
+#include <UnitTest++/UnitTest++.h>
+#include <PLCore/Runtime.h>
+#include <PLCore/System/Thread.h>
+#include <PLRenderer/RendererContext.h>
+#include <PLRenderer/Renderer/Renderer.h>
+#include <PLRenderer/Renderer/IndexBuffer.h>
+#include <PLRenderer/Renderer/CommandList.h>
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+using namespace std;
+using namespace PLCore;
+using namespace PLRenderer;
+
+
+//[-------------------------------------------------------]
+//[ Global variables                                      ]
+//[-------------------------------------------------------]
+extern ofstream outputFile;
+
+
+/*
+* Naming Convention for SUITE:
+* CLASSNAME
+*/
+SUITE(CommandList_Performance) {
+	/*
+	* Naming Convention for METHOD:
+	* METHODNAME_SCENARIO
+	*/
+	// general objects for testing, the index buffer is created once when the suite is set up and released on exit
+	const uint32 draws   = 100000;	// Number of draw calls per frame
+	const uint32 threads = 4;		// Number of threads recording command lists
+	struct CommandListTestData {
+		RendererContext *pRendererContext;
+		IndexBuffer		*pIndexBuffer;
+		CommandList		 cCommandLists[threads];
+
+		CommandListTestData() :
+			// The null renderer backend is sufficient, it updates the statistics like a real backend
+			pRendererContext((Runtime::ScanDirectoryPluginsAndData(false), RendererContext::CreateInstance("PLRendererNull::Renderer", NULL_HANDLE))),
+			pIndexBuffer(nullptr)
+		{
+			if (pRendererContext) {
+				pIndexBuffer = pRendererContext->GetRenderer().CreateIndexBuffer();
+				pIndexBuffer->SetElementTypeByMaximumIndex(2999);
+				pIndexBuffer->Allocate(3000);
+			}
+		}
+
+		~CommandListTestData()
+		{
+			if (pIndexBuffer)
+				delete pIndexBuffer;
+			if (pRendererContext)
+				delete pRendererContext;
+		}
+	} testData;
+	RendererContext *&pRendererContext = testData.pRendererContext;
+	IndexBuffer		*&pIndexBuffer	   = testData.pIndexBuffer;
+	CommandList (&cCommandLists)[threads] = testData.cCommandLists;
+
+	// Submits the calls of the given range of draw calls, the renderer and the command list share the same interface
+	template <class T>
+	void Submit(T &cTarget, uint32 nFirst, uint32 nNumOfDraws)
+	{
+		cTarget.SetIndexBuffer(pIndexBuffer);
+		for (uint32 i=nFirst; i<nFirst+nNumOfDraws; i++) {
+			cTarget.SetRenderState(RenderState::BlendEnable, (i/16)%2);
+			cTarget.SetRenderState(RenderState::CullMode, (i%3) ? Cull::CCW : Cull::None);
+			cTarget.SetSamplerState(0, Sampler::MagFilter, (i/8)%2 ? TextureFiltering::Linear : TextureFiltering::Point);
+			if (i%4)
+				cTarget.DrawIndexedPrimitives(Primitive::TriangleList, 0, 2999, 0, 300 + (i%10)*3);
+			else
+				cTarget.DrawPrimitivesInstanced(Primitive::TriangleStrip, 0, 4, 1 + i%7);
+		}
+	}
+
+	// Thread function recording one part of the draw calls
+	int RecordThread(void *pData)
+	{
+		const uint32 nThread = static_cast<uint32>(static_cast<CommandList*>(pData) - cCommandLists);
+		static_cast<CommandList*>(pData)->Reset();
+		Submit(*static_cast<CommandList*>(pData), nThread*(draws/threads), draws/threads);
+		return 0;
+	}
+
+	// Returns a statistics snapshot of the given renderer after resetting all states
+	Statistics ResetStates(Renderer &cRenderer)
+	{
+		cRenderer.ResetRenderStates();
+		cRenderer.ResetSamplerStates();
+		cRenderer.SetIndexBuffer();
+		return cRenderer.GetStatistics();
+	}
+
+	TEST(Immediate){
+		if (pRendererContext) {
+			Renderer &cRenderer = pRendererContext->GetRenderer();
+			ResetStates(cRenderer);
+			Submit(cRenderer, 0, draws);
+		} else {
+			outputFile << "Null renderer backend not available, command list benchmark skipped\n";
+		}
+	}
+
+	TEST(Record_SingleThread){
+		if (pRendererContext) {
+			cCommandLists[0].Reset();
+			Submit(cCommandLists[0], 0, draws);
+			outputFile << "Recorded commands: " << cCommandLists[0].GetNumOfCommands() << ", bytes: " << cCommandLists[0].GetSize() << '\n';
+		}
+	}
+
+	TEST(Execute_SingleThread){
+		if (pRendererContext) {
+			Renderer &cRenderer = pRendererContext->GetRenderer();
+			ResetStates(cRenderer);
+			cRenderer.Execute(cCommandLists[0]);
+		}
+	}
+
+	TEST(Record_Threads){
+		if (pRendererContext) {
+			Thread *pThreads[threads];
+			for (uint32 i=0; i<threads; i++) {
+				pThreads[i] = new Thread(RecordThread, &cCommandLists[i]);
+				pThreads[i]->Start();
+			}
+			for (uint32 i=0; i<threads; i++) {
+				pThreads[i]->Join();
+				delete pThreads[i];
+			}
+		}
+	}
+
+	TEST(Execute_Threads){
+		if (pRendererContext) {
+			Renderer &cRenderer = pRendererContext->GetRenderer();
+			const Statistics sExecuteBefore = ResetStates(cRenderer);
+			for (uint32 i=0; i<threads; i++)
+				cRenderer.Execute(cCommandLists[i]);	// Setting the same index buffer again is reported as failure, just like in immediate mode
+			const Statistics sExecute = cRenderer.GetStatistics();
+			outputFile << "Draw calls: " << sExecute.nDrawPrimitivCalls - sExecuteBefore.nDrawPrimitivCalls << ", render state changes: " << sExecute.nRenderStateChanges - sExecuteBefore.nRenderStateChanges << '\n';
+		}
+	}
+}
@@ -0,0 +1,140 @@
+/*********************************************************\
+ *  File: GlyphAtlas.cpp                                 *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <fstream>
+#include <UnitTest++/UnitTest++.h>
+#include <PLCore/Runtime.h>
+#include <PLCore/File/File.h>
+#include <PLCore/System/System.h>
+#include <PLRenderer/RendererContext.h>
+#include <PLRenderer/Renderer/FontManager.h>
+#include <PLRenderer/Renderer/FontTexture.h>
+#include <PLRenderer/Renderer/GlyphAtlas.h>
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+using namespace std;
+using namespace PLCore;
+using namespace PLRenderer;
+
+
+//[-------------------------------------------------------]
+//[ Global variables                                      ]
+//[-------------------------------------------------------]
+extern ofstream outputFile;
+
+
+/*
+* Naming Convention for SUITE:
+* CLASSNAME
+*/
+SUITE(GlyphAtlas_Performance) {
+	/*
+	* Naming Convention for METHOD:
+	* METHODNAME_SCENARIO
+	*/
+	// general objects for testing, the renderer context and the font are created once when the suite is set up and released on exit
+	// The null renderer backend rasterizes synthetic glyphs: at 12 points and 96 dpi they are 16 pixel high,
+	// ideographs (starting at U+2E80) are 16 pixel wide, all other characters 8 pixel
+	const uint32 ideograph = 0x4e00;	// First CJK unified ideograph
+	struct GlyphAtlasTestData {
+		RendererContext *pRendererContext;
+		FontTexture		*pFont;
+		GlyphAtlas		*pGlyphAtlas;
+
+		GlyphAtlasTestData() :
+			pRendererContext(nullptr),
+			pFont(nullptr),
+			pGlyphAtlas(nullptr)
+		{
+			// The null renderer backend is sufficient, its fonts are using synthetic glyphs
+			Runtime::ScanDirectoryPluginsAndData(false);
+			pRendererContext = RendererContext::CreateInstance("PLRendererNull::Renderer", NULL_HANDLE);
+			if (pRendererContext) {
+				File cFile("NullFont.ttf");
+				pFont = static_cast<FontTexture*>(pRendererContext->GetRenderer().GetFontManager().CreateFontTexture(cFile, 12, 96));
+				pGlyphAtlas = &pRendererContext->GetRenderer().GetFontManager().GetGlyphAtlas();
+				pGlyphAtlas->SetBackgroundRasterization(false);
+			}
+		}
+
+		~GlyphAtlasTestData()
+		{
+			if (pFont)
+				delete pFont;
+			if (pRendererContext)
+				delete pRendererContext;
+		}
+	} testData;
+	FontTexture *&pFont		  = testData.pFont;
+	GlyphAtlas  *&pGlyphAtlas = testData.pGlyphAtlas;
+
+	TEST(GetGlyph_PackingEfficiency){
+		if (pFont) {
+			// Fill a single page with glyphs of several sizes and widths, all used within the same frame so nothing can be evicted
+			pGlyphAtlas->SetPageSize(512);
+			pGlyphAtlas->SetMaxNumOfPages(1);
+			pGlyphAtlas->Clear();
+			const uint64 nStart = System::GetInstance()->GetMicroseconds();
+			uint32 nNumOfGlyphs = 0;
+			bool bFull = false;
+			for (uint32 nCharacter=0; !bFull; nCharacter++) {
+				for (uint32 nSize=8; nSize<=16 && !bFull; nSize+=2) {
+					pFont->SetSize(nSize, 96);
+					const uint32 nCharacterCode = (nCharacter & 1) ? ideograph + nCharacter : 'A' + nCharacter;
+					const GlyphAtlas::Glyph *pGlyph = pGlyphAtlas->GetGlyph(*pFont, nCharacterCode);
+					if (pGlyph->nState == GlyphAtlas::Ready)
+						nNumOfGlyphs++;
+					else
+						bFull = true;
+				}
+			}
+			const uint64 nTime = System::GetInstance()->GetMicroseconds() - nStart;
+			pFont->SetSize(12, 96);
+			outputFile << "Glyph atlas: " << nNumOfGlyphs << " glyphs of 5 sizes packed into one 512x512 page, " << pGlyphAtlas->GetPackingEfficiency()*100.0f << "% of the page used, " << nTime << " us\n";
+		}
+	}
+
+	TEST(GetGlyph_Eviction){
+		if (pFont) {
+			// A 64x64 page holds 3x3 ideographs (16x16 pixel plus padding), cycle through twice as many glyphs as fit into the page
+			pGlyphAtlas->SetPageSize(64);
+			pGlyphAtlas->SetMaxNumOfPages(1);
+			pGlyphAtlas->Clear();
+			const uint32 frames = 100;
+			const uint64 nStart = System::GetInstance()->GetMicroseconds();
+			for (uint32 nFrame=0; nFrame<frames; nFrame++) {
+				pGlyphAtlas->Update();
+				for (uint32 i=0; i<9; i++)
+					pGlyphAtlas->GetGlyph(*pFont, ideograph + ((nFrame & 1) ? 9 : 0) + i);
+			}
+			const uint64 nTime = System::GetInstance()->GetMicroseconds() - nStart;
+			outputFile << "Glyph atlas: " << pGlyphAtlas->GetNumOfEvictions() << " evictions within " << frames << " frames, " << nTime/frames << " us per frame\n";
+		}
+	}
+}
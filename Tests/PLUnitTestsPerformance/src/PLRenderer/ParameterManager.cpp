@@ -0,0 +1,141 @@
+/*********************************************************\
+ *  File: ParameterManager.cpp                           *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <fstream>
+#include <UnitTest++/UnitTest++.h>
+#include <PLCore/Runtime.h>
+#include <PLRenderer/RendererContext.h>
+#include <PLRenderer/Material/Material.h>
+#include <PLRenderer/Material/MaterialManager.h>
+#include <PLRenderer/Material/Parameter.h>
+#include <PLRenderer/Material/ParameterManager.h>
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+using namespace std;
+using namespace PLCore;
+using namespace PLRenderer;
+
+
+//[-------------------------------------------------------]
+//[ Global variables                                      ]
+//[-------------------------------------------------------]
+extern ofstream outputFile;
+
+
+/*
+* Naming Convention for SUITE:
+* CLASSNAME
+*/
+SUITE(ParameterManager_Performance) {
+	/*
+	* Naming Convention for METHOD:
+	* METHODNAME_SCENARIO
+	*/
+	// general objects for testing, the material is created once when the suite is set up and released on exit
+	const uint32		 draws      = 100000;	// Number of draw calls, each draw resolves all parameters
+	const uint32		 parameters = 16;		// Number of material parameters
+	const char			*names[parameters] = {
+		"TwoSided", "DiffuseColor", "DiffuseMap", "AlphaReference", "DiffuseRampMap", "IndexOfRefraction", "FresnelReflectionPower", "ReflectionColor",
+		"Reflectivity", "NormalMap", "NormalMapBumpiness", "Parallax", "HeightMap", "SpecularColor", "SpecularExponent", "SpecularMap"
+	};
+	struct ParameterManagerTestData {
+		RendererContext *pRendererContext;
+		Material		*pMaterial;
+		String			 sNames[parameters];
+		ParameterID		 cIDs[parameters];
+
+		ParameterManagerTestData() :
+			pRendererContext(nullptr),
+			pMaterial(nullptr)
+		{
+			// The null renderer backend is sufficient, no rendering is done
+			Runtime::ScanDirectoryPluginsAndData(false);
+			pRendererContext = RendererContext::CreateInstance("PLRendererNull::Renderer", NULL_HANDLE);
+			if (pRendererContext) {
+				pMaterial = pRendererContext->GetMaterialManager().Create("ParameterManager_Performance");
+				if (pMaterial) {
+					// Add the parameters, every second one is a numeric parameter
+					for (uint32 i=0; i<parameters; i++) {
+						sNames[i] = names[i];
+						cIDs[i]   = ParameterID(sNames[i]);
+						pMaterial->GetParameterManager().CreateParameter((i%2) ? PLRenderer::Parameters::Float4 : PLRenderer::Parameters::String, sNames[i]);
+					}
+				}
+			}
+		}
+
+		~ParameterManagerTestData()
+		{
+			if (pMaterial)
+				delete pMaterial;
+			if (pRendererContext)
+				delete pRendererContext;
+		}
+	} testData;
+	Material	*&pMaterial = testData.pMaterial;
+	String		 *sNames    = testData.sNames;
+	ParameterID	 *cIDs      = testData.cIDs;
+	uint32		  nChecksum = 0;	// Prevents the compiler from optimizing the lookups away
+
+	TEST(Resolve_String){
+		if (pMaterial) {
+			for (uint32 nDraw=0; nDraw<draws; nDraw++) {
+				for (uint32 i=0; i<parameters; i++)
+					nChecksum += (pMaterial->GetParameter(sNames[i]) != nullptr);
+			}
+		}
+	}
+
+	TEST(Resolve_ID){
+		if (pMaterial) {
+			for (uint32 nDraw=0; nDraw<draws; nDraw++) {
+				for (uint32 i=0; i<parameters; i++)
+					nChecksum += (pMaterial->GetParameter(cIDs[i]) != nullptr);
+			}
+		}
+	}
+
+	TEST(Resolve_Unknown_String){
+		if (pMaterial) {
+			const String sUnknown = "UnknownParameter";
+			for (uint32 nDraw=0; nDraw<draws; nDraw++)
+				nChecksum += (pMaterial->GetParameter(sUnknown) != nullptr);
+		}
+	}
+
+	TEST(Resolve_Unknown_ID){
+		if (pMaterial) {
+			const ParameterID cUnknown("UnknownParameter");
+			for (uint32 nDraw=0; nDraw<draws; nDraw++)
+				nChecksum += (pMaterial->GetParameter(cUnknown) != nullptr);
+		}
+	}
+}
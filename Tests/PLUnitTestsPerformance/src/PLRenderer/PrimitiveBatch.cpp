@@ -0,0 +1,178 @@
+/*********************************************************\
+ *  File: PrimitiveBatch.cpp                             *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <fstream>
+#include <UnitTest++/UnitTest++.h>
+#include <PLCore/Runtime.h>
+#include <PLCore/System/System.h>
+#include <PLMath/Vector3i.h>
+#include <PLMath/Rectangle.h>
+#include <PLMath/Matrix4x4.h>
+#include <PLGraphics/Image/Image.h>
+#include <PLGraphics/Color/Color4.h>
+#include <PLRenderer/RendererContext.h>
+#include <PLRenderer/Renderer/Renderer.h>
+#include <PLRenderer/Renderer/SamplerStates.h>
+#include <PLRenderer/Renderer/TextureBuffer2D.h>
+#include <PLRenderer/Renderer/Backend/DrawHelpersBackendShaders.h>
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+using namespace std;
+using namespace PLCore;
+using namespace PLMath;
+using namespace PLGraphics;
+using namespace PLRenderer;
+
+
+//[-------------------------------------------------------]
+//[ Global variables                                      ]
+//[-------------------------------------------------------]
+extern ofstream outputFile;
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Shaders based draw helpers drawing the batches without a program
+*
+*  @remarks
+*    The null renderer backend has no shader language, so the batches are drawn without a program,
+*    this is enough to count the draw calls within the renderer statistics.
+*/
+class DrawHelpersBatchCounter : public DrawHelpersBackendShaders {
+	public:
+		DrawHelpersBatchCounter(Renderer &cRenderer) : DrawHelpersBackendShaders(cRenderer)
+		{
+		}
+
+	protected:
+		virtual bool DrawPrimitiveBatch(const Batch &sBatch, VertexBuffer &cVertexBuffer, uint32 nStartVertex) override
+		{
+			return m_pRenderer->DrawPrimitives(sBatch.sKey.nPrimitive, nStartVertex, sBatch.lstVertices.GetNumOfElements());
+		}
+};
+
+
+/*
+* Naming Convention for SUITE:
+* CLASSNAME
+*/
+SUITE(PrimitiveBatch_Performance) {
+	/*
+	* Naming Convention for METHOD:
+	* METHODNAME_SCENARIO
+	*/
+	// general objects for testing, the draw helpers and textures are created once when the suite is set up and released on exit
+	const uint32 frames = 100;	// Number of drawn frames
+	const uint32 lines  = 2000;	// Number of lines per frame, wireframe bounding boxes of a debug pass
+	const uint32 icons  = 200;	// Number of icons per frame, scene node icons of a debug pass
+	struct PrimitiveBatchTestData {
+		RendererContext			*pRendererContext;
+		DrawHelpersBatchCounter	*pDrawHelpers;
+		TextureBuffer			*pTextureBuffers[2];
+
+		PrimitiveBatchTestData() :
+			// The null renderer backend is sufficient, it updates the statistics like a real backend
+			pRendererContext((Runtime::ScanDirectoryPluginsAndData(false), RendererContext::CreateInstance("PLRendererNull::Renderer", NULL_HANDLE))),
+			pDrawHelpers(nullptr)
+		{
+			pTextureBuffers[0] = pTextureBuffers[1] = nullptr;
+			if (pRendererContext) {
+				Renderer &cRenderer = pRendererContext->GetRenderer();
+				const Rectangle cViewport(0.0f, 0.0f, 1024.0f, 768.0f);
+				cRenderer.SetViewport(&cViewport);
+				pDrawHelpers = new DrawHelpersBatchCounter(cRenderer);
+				for (uint32 i=0; i<2; i++) {
+					Image cImage = Image::CreateImage(DataByte, ColorRGBA, Vector3i(16, 16, 1));
+					pTextureBuffers[i] = cRenderer.CreateTextureBuffer2D(cImage, TextureBuffer::Unknown, 0);
+				}
+			}
+		}
+
+		~PrimitiveBatchTestData()
+		{
+			for (uint32 i=0; i<2; i++) {
+				if (pTextureBuffers[i])
+					delete pTextureBuffers[i];
+			}
+			if (pDrawHelpers)
+				delete pDrawHelpers;
+			if (pRendererContext)
+				delete pRendererContext;
+		}
+	} testData;
+	RendererContext			*&pRendererContext = testData.pRendererContext;
+	DrawHelpersBatchCounter	*&pDrawHelpers	   = testData.pDrawHelpers;
+	TextureBuffer *(&pTextureBuffers)[2] = testData.pTextureBuffers;
+
+	TEST(DrawLine_Batched){
+		if (pDrawHelpers) {
+			Renderer &cRenderer = pRendererContext->GetRenderer();
+			const Statistics &sStatistics = cRenderer.GetStatistics();
+			const uint32 nDrawCalls = sStatistics.nDrawPrimitivCalls;
+			Matrix4x4 mObjectSpaceToClipSpace;
+			mObjectSpaceToClipSpace.PerspectiveFov(1.0f, 1024.0f/768.0f, 0.1f, 1000.0f);
+			const uint64 nStart = System::GetInstance()->GetMicroseconds();
+			for (uint32 nFrame=0; nFrame<frames; nFrame++) {
+				pDrawHelpers->BeginBatch();
+				for (uint32 i=0; i<lines; i++) {
+					const float fX = static_cast<float>(i%50) - 25.0f;
+					const float fY = static_cast<float>(i/50) - 20.0f;
+					pDrawHelpers->DrawLine(Color4::White, Vector3(fX, fY, -50.0f), Vector3(fX + 0.5f, fY + 0.5f, -50.0f), mObjectSpaceToClipSpace, 1.0f);
+				}
+				pDrawHelpers->EndBatch();
+			}
+			const uint64 nTime = System::GetInstance()->GetMicroseconds() - nStart;
+			outputFile << "Lines: " << lines << " immediate draw calls per frame, " << (sStatistics.nDrawPrimitivCalls - nDrawCalls)/frames << " batched draw call per frame, " << nTime/frames << " us per frame\n";
+		} else {
+			outputFile << "Null renderer backend not available, primitive batch benchmark skipped\n";
+		}
+	}
+
+	TEST(DrawImage_SortedByTexture){
+		if (pDrawHelpers && pTextureBuffers[0] && pTextureBuffers[1]) {
+			Renderer &cRenderer = pRendererContext->GetRenderer();
+			const uint32 nDrawCalls = cRenderer.GetStatistics().nDrawPrimitivCalls;
+			SamplerStates cSamplerStates;
+			for (uint32 nFrame=0; nFrame<frames; nFrame++) {
+				pDrawHelpers->Begin2DMode(0.0f, 0.0f, 1024.0f, 768.0f);
+				for (uint32 i=0; i<icons; i++) {
+					// The icons of the row don't overlap, so they can be sorted by texture (the overlap test
+					// uses the bounding rectangle of each batch, so icons spread over several rows would not)
+					const Vector2 vPosition(static_cast<float>(i*5), 0.0f);
+					pDrawHelpers->DrawImage(*pTextureBuffers[i & 1], cSamplerStates, vPosition, Vector2(4.0f, 4.0f), Color4::White, 0.5f);
+				}
+				pDrawHelpers->End2DMode();
+			}
+			outputFile << "Icons: " << icons << " immediate draw calls per frame, " << (cRenderer.GetStatistics().nDrawPrimitivCalls - nDrawCalls)/frames << " batched draw calls per frame\n";
+		}
+	}
+}
@@ -0,0 +1,134 @@
+/*********************************************************\
+ *  File: ProgramGenerator.cpp                           *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <fstream>
+#include <UnitTest++/UnitTest++.h>
+#include <PLCore/Runtime.h>
+#include <PLCore/File/File.h>
+#include <PLCore/System/System.h>
+#include <PLRenderer/RendererContext.h>
+#include <PLRenderer/Renderer/ProgramGenerator.h>
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+using namespace std;
+using namespace PLCore;
+using namespace PLRenderer;
+
+
+//[-------------------------------------------------------]
+//[ Global variables                                      ]
+//[-------------------------------------------------------]
+extern ofstream outputFile;
+
+
+/*
+* Naming Convention for SUITE:
+* CLASSNAME
+*/
+SUITE(ProgramGenerator_Performance) {
+	/*
+	* Naming Convention for METHOD:
+	* METHODNAME_SCENARIO
+	*/
+	// general objects for testing, the renderer context is created once when the suite is set up and released on exit
+	const uint32	 permutations = 256;	// Number of requested program permutations, material and light combinations of a scene
+	const uint32	 lookups	  = 100000;	// Number of program lookups during rendering
+	const char		*vertexFlags[8]   = { "VS_TWOSIDED", "VS_TEXCOORD0", "VS_NORMAL", "VS_TANGENT_BINORMAL", "VS_SKINNING", "VS_INSTANCING", "VS_FOG", "VS_SHADOW" };
+	const char		*fragmentFlags[8] = { "FS_ALPHATEST", "FS_DIFFUSEMAP", "FS_NORMALMAP", "FS_SPECULAR", "FS_EMISSIVEMAP", "FS_LIGHT", "FS_SHADOWMAP", "FS_GAMMACORRECTION" };
+	struct ProgramGeneratorTestData {
+		RendererContext *pRendererContext;
+		String			 sCacheFile;
+
+		ProgramGeneratorTestData() :
+			// The null renderer backend is sufficient, the recording and replay logic doesn't need a GPU
+			pRendererContext((Runtime::ScanDirectoryPluginsAndData(false), RendererContext::CreateInstance("PLRendererNull::Renderer", NULL_HANDLE))),
+			sCacheFile(System::GetInstance()->GetCurrentDir() + "/ProgramGeneratorPerformance.cache")
+		{
+		}
+
+		~ProgramGeneratorTestData()
+		{
+			File(sCacheFile).Delete();
+			if (pRendererContext)
+				delete pRendererContext;
+		}
+	} testData;
+	RendererContext *&pRendererContext = testData.pRendererContext;
+
+	// Sets the program flags of a permutation
+	void SetFlags(ProgramGenerator::Flags &cFlags, uint32 nPermutation)
+	{
+		cFlags.Reset();
+		for (uint32 i=0; i<8; i++) {
+			if (nPermutation & (1<<i))
+				cFlags.AddVertexShaderFlag(1<<i, vertexFlags[i]);
+			if ((nPermutation*7) & (1<<i))
+				cFlags.AddFragmentShaderFlag(1<<i, fragmentFlags[i]);
+		}
+	}
+
+	TEST(GetProgram_Lookups){
+		if (pRendererContext) {
+			ProgramGenerator cProgramGenerator(pRendererContext->GetRenderer(), "GLSL", "void main() {}", "110", "void main() {}", "110");
+			ProgramGenerator::Flags cFlags;
+
+			// Each permutation is requested multiple times, but only recorded once
+			const uint64 nStart = System::GetInstance()->GetMicroseconds();
+			for (uint32 i=0; i<lookups; i++) {
+				SetFlags(cFlags, i%permutations);
+				cProgramGenerator.GetProgram(cFlags);
+			}
+			const uint64 nTime = System::GetInstance()->GetMicroseconds() - nStart;
+			outputFile << "Program lookups: " << lookups << " lookups of " << permutations << " permutations in " << nTime << " us\n";
+		}
+	}
+
+	TEST(LoadCache_WarmUp){
+		if (pRendererContext) {
+			// Record and save the permutations
+			{
+				ProgramGenerator cProgramGenerator(pRendererContext->GetRenderer(), "GLSL", "void main() {}", "110", "void main() {}", "110");
+				ProgramGenerator::Flags cFlags;
+				for (uint32 i=0; i<permutations; i++) {
+					SetFlags(cFlags, i);
+					cProgramGenerator.GetProgram(cFlags);
+				}
+				cProgramGenerator.SaveCache(testData.sCacheFile);
+			}
+
+			// On the next start, the permutations are loaded and generated behind the loading screen
+			ProgramGenerator cProgramGenerator(pRendererContext->GetRenderer(), "GLSL", "void main() {}", "110", "void main() {}", "110");
+			const uint64 nStart = System::GetInstance()->GetMicroseconds();
+			cProgramGenerator.LoadCache(testData.sCacheFile);
+			cProgramGenerator.WarmUp();
+			const uint64 nTime = System::GetInstance()->GetMicroseconds() - nStart;
+			outputFile << "Program cache: " << cProgramGenerator.GetNumOfRecordedPrograms() << " permutations loaded and warmed up in " << nTime << " us\n";
+		}
+	}
+}
@@ -0,0 +1,136 @@
+/*********************************************************\
+ *  File: TextBatch.cpp                                  *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <fstream>
+#include <UnitTest++/UnitTest++.h>
+#include <PLCore/Runtime.h>
+#include <PLCore/File/File.h>
+#include <PLMath/Matrix4x4.h>
+#include <PLGraphics/Color/Color4.h>
+#include <PLRenderer/RendererContext.h>
+#include <PLRenderer/Renderer/Renderer.h>
+#include <PLRenderer/Renderer/DrawHelpers.h>
+#include <PLRenderer/Renderer/FontManager.h>
+#include <PLRenderer/Renderer/FontTexture.h>
+#include <PLRenderer/Renderer/GlyphAtlas.h>
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+using namespace std;
+using namespace PLCore;
+using namespace PLMath;
+using namespace PLGraphics;
+using namespace PLRenderer;
+
+
+//[-------------------------------------------------------]
+//[ Global variables                                      ]
+//[-------------------------------------------------------]
+extern ofstream outputFile;
+
+
+/*
+* Naming Convention for SUITE:
+* CLASSNAME
+*/
+SUITE(TextBatch_Performance) {
+	/*
+	* Naming Convention for METHOD:
+	* METHODNAME_SCENARIO
+	*/
+	// general objects for testing, the font is created once when the suite is set up and released on exit
+	const uint32 frames = 100;	// Number of drawn frames
+	const uint32 texts  = 200;	// Number of texts per frame, a typical HUD/debug overlay
+	struct TextBatchTestData {
+		RendererContext *pRendererContext;
+		Font			*pFont;
+		String			 sTexts[texts];
+
+		TextBatchTestData() :
+			// The null renderer backend is sufficient, it updates the statistics like a real backend and its fonts are using synthetic glyphs
+			pRendererContext((Runtime::ScanDirectoryPluginsAndData(false), RendererContext::CreateInstance("PLRendererNull::Renderer", NULL_HANDLE))),
+			pFont(nullptr)
+		{
+			if (pRendererContext) {
+				File cFile("NullFont.ttf");
+				pFont = pRendererContext->GetRenderer().GetFontManager().CreateFontTexture(cFile, 12, 96);
+				for (uint32 i=0; i<texts; i++)
+					sTexts[i] = String("Label ") + i + ": " + (i*7919)%1000 + " units";
+
+				// Rasterize the glyphs of the texts up front, else the first frame would only contain placeholders
+				if (pFont) {
+					for (uint32 i=0; i<texts; i++)
+						pFont->GetTextWidth(sTexts[i]);
+					pRendererContext->GetRenderer().GetFontManager().GetGlyphAtlas().WaitForRasterization();
+				}
+			}
+		}
+
+		~TextBatchTestData()
+		{
+			if (pFont)
+				delete pFont;
+			if (pRendererContext)
+				delete pRendererContext;
+		}
+	} testData;
+	RendererContext *&pRendererContext = testData.pRendererContext;
+	Font			*&pFont			   = testData.pFont;
+	String (&sTexts)[texts] = testData.sTexts;
+
+	TEST(Draw_PerGlyph){
+		if (pFont) {
+			Renderer &cRenderer = pRendererContext->GetRenderer();
+			const uint32 nDrawCalls = cRenderer.GetStatistics().nDrawPrimitivCalls;
+			Matrix4x4 mObjectSpaceToClipSpace;
+			mObjectSpaceToClipSpace.SetScaleMatrix(2.0f/1024.0f, 2.0f/768.0f, 1.0f);
+			for (uint32 nFrame=0; nFrame<frames; nFrame++) {
+				for (uint32 i=0; i<texts; i++)
+					pFont->Draw(sTexts[i], Color4::White, mObjectSpaceToClipSpace, Vector2::One, Vector2(10.0f, static_cast<float>(i*12)));
+			}
+			outputFile << "Per glyph draw calls per frame: " << (cRenderer.GetStatistics().nDrawPrimitivCalls - nDrawCalls)/frames << '\n';
+		} else {
+			outputFile << "Null renderer backend not available, text batch benchmark skipped\n";
+		}
+	}
+
+	TEST(DrawText_Batched){
+		if (pFont) {
+			Renderer &cRenderer = pRendererContext->GetRenderer();
+			DrawHelpers &cDrawHelpers = cRenderer.GetDrawHelpers();
+			const uint32 nDrawCalls = cRenderer.GetStatistics().nDrawPrimitivCalls;
+			for (uint32 nFrame=0; nFrame<frames; nFrame++) {
+				cDrawHelpers.Begin2DMode(0.0f, 0.0f, 1024.0f, 768.0f);
+				for (uint32 i=0; i<texts; i++)
+					cDrawHelpers.DrawText(*pFont, sTexts[i], Color4::White, Vector2(10.0f, static_cast<float>(i*12)));
+				cDrawHelpers.End2DMode();
+			}
+			outputFile << "Batched draw calls per frame: " << (cRenderer.GetStatistics().nDrawPrimitivCalls - nDrawCalls)/frames << ", shaped texts: " << static_cast<FontTexture*>(pFont)->GetNumOfShapedTexts() << '\n';
+		}
+	}
+}
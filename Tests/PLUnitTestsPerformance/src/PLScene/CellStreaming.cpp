@@ -0,0 +1,214 @@
+/*********************************************************\
+ *  File: CellStreaming.cpp                              *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <fstream>
+#include <UnitTest++/UnitTest++.h>
+#include <PLCore/Runtime.h>
+#include <PLCore/File/File.h>
+#include <PLCore/File/Directory.h>
+#include <PLCore/System/System.h>
+#include <PLRenderer/RendererContext.h>
+#include <PLScene/Scene/SCCell.h>
+#include <PLScene/Scene/SceneContext.h>
+#include <PLScene/Scene/SceneNodeModifiers/SNMCellStreaming.h>
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+using namespace std;
+using namespace PLCore;
+using namespace PLMath;
+using namespace PLRenderer;
+using namespace PLScene;
+
+
+//[-------------------------------------------------------]
+//[ Global variables                                      ]
+//[-------------------------------------------------------]
+extern ofstream outputFile;
+
+
+/*
+* Naming Convention for SUITE:
+* CLASSNAME
+*/
+SUITE(SNMCellStreaming_Performance) {
+	/*
+	* Naming Convention for METHOD:
+	* METHODNAME_SCENARIO
+	*/
+	// general objects for testing, the world is created once when the suite is set up and released on exit
+	const uint32 cellsX       = 40;		// Number of cells along x
+	const uint32 cellsZ       = 25;		// Number of cells along z, 1000 cells in total
+	const float  cellSize     = 20.0f;	// Cell size along x and z
+	const uint32 nodesPerCell = 32;		// Number of scene nodes within the streamed contents of each cell
+	const uint32 steps        = 1000;	// Number of camera steps
+	struct CellStreamingTestData {
+		RendererContext  *pRendererContext;
+		SceneContext	 *pSceneContext;
+		SceneNode		 *pCamera;
+		SNMCellStreaming *pCellStreaming;
+		SceneContainer	 *pWorld;
+		String			  sDirectory;
+
+		CellStreamingTestData() :
+			// Cell streaming doesn't need the GPU, but the scene context needs a renderer context
+			pRendererContext((Runtime::ScanDirectoryPluginsAndData(false), RendererContext::CreateInstance("PLRendererNull::Renderer", NULL_HANDLE))),
+			pSceneContext(nullptr),
+			pCamera(nullptr),
+			pCellStreaming(nullptr),
+			pWorld(nullptr)
+		{
+			if (pRendererContext) {
+				pSceneContext = new SceneContext(*pRendererContext);
+				pWorld = static_cast<SceneContainer*>(pSceneContext->GetRoot()->Create("PLScene::SceneContainer", "World"));
+				if (pWorld) {
+					// Write the separately loadable sub-scenes of the cells
+					sDirectory = System::GetInstance()->GetCurrentDir() + "/CellStreaming/";
+					Directory(sDirectory).Create();
+					uint32 nFileSize = 0;
+					for (uint32 nZ=0; nZ<cellsZ; nZ++) {
+						for (uint32 nX=0; nX<cellsX; nX++) {
+							String sScene = "<?xml version=\"1.0\" ?>\n<Scene Version=\"1\">\n";
+							for (uint32 i=0; i<nodesPerCell; i++)
+								sScene += String("\t<Node Class=\"PLScene::SNPointLight\" Position=\"") + (static_cast<int>(i%8)*2 - 7) + " 1 " + (static_cast<int>(i/8)*4 - 6) + "\" Range=\"3\" />\n";
+							sScene += "</Scene>\n";
+							File cFile(sDirectory + "Cell_" + nX + '_' + nZ + ".scene");
+							if (cFile.Open(File::FileWrite | File::FileCreate)) {
+								cFile.PutS(sScene);
+								nFileSize = cFile.GetSize();
+								cFile.Close();
+							}
+						}
+					}
+
+					// The cells, each one is reachable from the world and from the neighbour cells
+					for (uint32 nZ=0; nZ<cellsZ; nZ++) {
+						for (uint32 nX=0; nX<cellsX; nX++) {
+							const String sName = String("Cell_") + nX + '_' + nZ;
+							const String sPosition = String(nX*cellSize) + " 0 " + nZ*cellSize;
+							SceneContainer *pCell = static_cast<SceneContainer*>(pWorld->Create("PLScene::SCCell", sName, "Position=\"" + sPosition + "\" AABBMin=\"-10 -10 -10\" AABBMax=\"10 10 10\" StreamFilename=\"" + sDirectory + sName + ".scene\""));
+							pWorld->Create("PLScene::SNCellPortal", "Portal_" + sName, "Position=\"" + sPosition + "\" TargetCell=\"" + sName + '\"');
+							if (pCell) {
+								if (nX)
+									pCell->Create("PLScene::SNCellPortal", "", String("Position=\"-10 0 0\" TargetCell=\"Parent.Cell_") + (nX - 1) + '_' + nZ + '\"');
+								if (nX < cellsX - 1)
+									pCell->Create("PLScene::SNCellPortal", "", String("Position=\"10 0 0\" TargetCell=\"Parent.Cell_") + (nX + 1) + '_' + nZ + '\"');
+								if (nZ)
+									pCell->Create("PLScene::SNCellPortal", "", String("Position=\"0 0 -10\" TargetCell=\"Parent.Cell_") + nX + '_' + (nZ - 1) + '\"');
+								if (nZ < cellsZ - 1)
+									pCell->Create("PLScene::SNCellPortal", "", String("Position=\"0 0 10\" TargetCell=\"Parent.Cell_") + nX + '_' + (nZ + 1) + '\"');
+							}
+						}
+					}
+
+					// The camera streaming in the cells, the budget is smaller than the cells within load distance
+					pCamera = pWorld->Create("PLScene::SNCamera", "Camera");
+					if (pCamera)
+						pCellStreaming = static_cast<SNMCellStreaming*>(pCamera->AddModifier("PLScene::SNMCellStreaming", String("LoadDistance=\"60\" UnloadDistance=\"80\" MaxLoadsPerUpdate=\"2\" MemoryBudget=\"") + nFileSize*24 + '\"'));
+				}
+			}
+		}
+
+		~CellStreamingTestData()
+		{
+			if (pSceneContext)
+				delete pSceneContext;
+			if (pRendererContext)
+				delete pRendererContext;
+
+			// Remove the sub-scene files
+			if (sDirectory.GetLength()) {
+				for (uint32 nZ=0; nZ<cellsZ; nZ++) {
+					for (uint32 nX=0; nX<cellsX; nX++)
+						File(sDirectory + "Cell_" + nX + '_' + nZ + ".scene").Delete();
+				}
+				Directory(sDirectory).Delete();
+			}
+		}
+	} testData;
+	SceneContext	 *&pSceneContext  = testData.pSceneContext;
+	SceneNode		 *&pCamera        = testData.pCamera;
+	SNMCellStreaming *&pCellStreaming = testData.pCellStreaming;
+	SceneContainer	 *&pWorld         = testData.pWorld;
+
+	// Returns the number of scene nodes within the streamed contents of all cells
+	uint32 GetNumOfStreamedSceneNodes()
+	{
+		uint32 nNumOfSceneNodes = 0;
+		for (uint32 i=0; i<pWorld->GetNumOfElements(); i++) {
+			SceneNode *pSceneNode = pWorld->GetByIndex(i);
+			if (pSceneNode->IsCell()) {
+				const SceneContainer *pContents = static_cast<SCCell*>(pSceneNode)->GetStreamedContents();
+				if (pContents)
+					nNumOfSceneNodes += pContents->GetNumOfElements();
+			}
+		}
+		return nNumOfSceneNodes;
+	}
+
+	// Updates the scene context like the application would do once per frame
+	void UpdateFrame()
+	{
+		pSceneContext->Update(false);
+		pSceneContext->Cleanup();
+	}
+
+	TEST(Stream_Flight){
+		if (pCellStreaming) {
+			uint32 nMaxLoadedCells = 0, nMaxSceneNodes = 0, nMaxMemoryUsage = 0;
+			for (uint32 nStep=0; nStep<steps; nStep++) {
+				// Zigzag through the whole world
+				const float fX = (cellsX - 1)*cellSize*nStep/steps;
+				const float fZ = (cellsZ - 1)*cellSize*Math::Abs(Math::Sin(nStep*0.02f));
+				pCamera->GetTransform().SetPosition(Vector3(fX, 0.0f, fZ));
+				UpdateFrame();
+				nMaxLoadedCells = Math::Max(nMaxLoadedCells, pCellStreaming->GetNumOfLoadedCells());
+				nMaxMemoryUsage = Math::Max(nMaxMemoryUsage, pCellStreaming->GetMemoryUsage());
+				if (!(nStep%100))
+					nMaxSceneNodes = Math::Max(nMaxSceneNodes, GetNumOfStreamedSceneNodes());
+			}
+			outputFile << "Cells: " << cellsX*cellsZ << ", max loaded cells: " << nMaxLoadedCells << ", max streamed scene nodes: " << nMaxSceneNodes << '\n';
+			outputFile << "Memory budget: " << pCellStreaming->MemoryBudget.Get() << " bytes, max memory usage: " << nMaxMemoryUsage << " bytes\n";
+		} else {
+			outputFile << "Null renderer backend not available, cell streaming benchmark skipped\n";
+		}
+	}
+
+	TEST(Stream_Leave){
+		if (pCellStreaming) {
+			// Everything is unloaded once the camera is out of reach, wait for the background reads
+			pCamera->GetTransform().SetPosition(Vector3(-1000.0f, 0.0f, -1000.0f));
+			uint32 nNumOfUpdates = 0;
+			for (; nNumOfUpdates<1000 && (pCellStreaming->GetMemoryUsage() || GetNumOfStreamedSceneNodes()); nNumOfUpdates++) {
+				UpdateFrame();
+				System::GetInstance()->Sleep(1);
+			}
+			outputFile << "Updates until everything is unloaded: " << nNumOfUpdates << ", loaded cells: " << pCellStreaming->GetNumOfLoadedCells() << '\n';
+		}
+	}
+}
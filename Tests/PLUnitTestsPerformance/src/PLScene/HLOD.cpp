@@ -0,0 +1,162 @@
+/*********************************************************\
+ *  File: HLOD.cpp                                       *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <fstream>
+#include <UnitTest++/UnitTest++.h>
+#include <PLCore/Runtime.h>
+#include <PLMath/Frustum.h>
+#include <PLRenderer/RendererContext.h>
+#include <PLScene/Scene/HLODBuilder.h>
+#include <PLScene/Scene/SceneContext.h>
+#include <PLScene/Scene/SceneContainer.h>
+#include <PLScene/Scene/SceneNodes/SNMesh.h>
+#include <PLScene/Visibility/SQCull.h>
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+using namespace std;
+using namespace PLCore;
+using namespace PLMath;
+using namespace PLRenderer;
+using namespace PLScene;
+
+
+//[-------------------------------------------------------]
+//[ Global variables                                      ]
+//[-------------------------------------------------------]
+extern ofstream outputFile;
+
+
+/*
+* Naming Convention for SUITE:
+* CLASSNAME
+*/
+SUITE(HLOD_Performance) {
+	/*
+	* Naming Convention for METHOD:
+	* METHODNAME_SCENARIO
+	*/
+	// general objects for testing, the scene is created once when the suite is set up and released on exit
+	const uint32 towns  = 16;	// Number of scene containers in front of the camera
+	const uint32 grid   = 8;	// Number of scene nodes along x and z within each scene container
+	const uint32 frames = 100;
+	struct HLODTestData {
+		RendererContext *pRendererContext;
+		SceneContext	*pSceneContext;
+		SceneContainer	*pContainer;
+		SQCull			*pCullQuery;
+
+		HLODTestData() :
+			// The null renderer backend is sufficient, it keeps the buffer data the proxy meshes are built from
+			pRendererContext((Runtime::ScanDirectoryPluginsAndData(false), RendererContext::CreateInstance("PLRendererNull::Renderer", NULL_HANDLE))),
+			pSceneContext(nullptr),
+			pContainer(nullptr),
+			pCullQuery(nullptr)
+		{
+			if (pRendererContext) {
+				pSceneContext = new SceneContext(*pRendererContext);
+				pContainer = static_cast<SceneContainer*>(pSceneContext->GetRoot()->Create("PLScene::SceneContainer", "Scene"));
+				if (pContainer) {
+					// Scene containers with lots of small scene nodes, all of them far away from the camera
+					for (uint32 nTown=0; nTown<towns; nTown++) {
+						SceneContainer *pTown = pContainer->Create<SceneContainer>(String("Town") + static_cast<int>(nTown));
+						pTown->GetTransform().SetPosition(Vector3(static_cast<float>(nTown%4)*40.0f - 60.0f, 0.0f, -100.0f - static_cast<float>(nTown/4)*40.0f));
+						for (uint32 nZ=0; nZ<grid; nZ++) {
+							for (uint32 nX=0; nX<grid; nX++) {
+								SNMesh *pSceneNode = pTown->Create<SNMesh>();
+								pSceneNode->SetMesh("Create PLMesh::MeshCreatorCube Name=\"Box\"");
+								pSceneNode->GetTransform().SetPosition(Vector3(static_cast<float>(nX*3), 0.0f, static_cast<float>(nZ*3)));
+							}
+						}
+					}
+
+					// Create the cull query
+					pCullQuery = static_cast<SQCull*>(pContainer->CreateQuery("PLScene::SQCull"));
+					if (pCullQuery) {
+						pCullQuery->SetFlags(0);
+						pCullQuery->SetMode(SQCull::Frustum);
+					}
+				}
+			}
+		}
+
+		~HLODTestData()
+		{
+			if (pCullQuery)
+				pCullQuery->GetSceneContainer().DestroyQuery(*pCullQuery);
+			if (pSceneContext)
+				delete pSceneContext;
+			if (pRendererContext)
+				delete pRendererContext;
+		}
+	} testData;
+	SceneContainer *&pContainer = testData.pContainer;
+	SQCull		   *&pCullQuery = testData.pCullQuery;
+
+	// Performs the visibility determination for a camera at the origin looking along the negative z axis
+	void Cull()
+	{
+		Matrix4x4 mProjection;
+		mProjection.PerspectiveFov(static_cast<float>(60.0f*Math::DegToRad), 16.0f/9.0f, 0.1f, 1000.0f);
+		Frustum cFrustum;
+		cFrustum.CreateViewPlanes(mProjection, false);
+		pCullQuery->SetCameraPosition(Vector3::Zero);
+		pCullQuery->SetViewFrustum(cFrustum);
+		pCullQuery->SetProjectionMatrix(mProjection);
+		pCullQuery->SetViewMatrix(Matrix4x4::Identity);
+		pCullQuery->SetViewProjectionMatrix(mProjection);
+		for (uint32 nFrame=0; nFrame<frames; nFrame++)
+			pCullQuery->PerformQuery();
+
+		// Write down the statistics of the last frame
+		const SQCull::Statistics &sStatistics = pCullQuery->GetStatistics();
+		outputFile << "Visible scene nodes: " << sStatistics.nNumOfVisibleSceneNodes << ", traversed hierarchy nodes: " << sStatistics.nNumOfTraversedNodes
+				   << ", HLOD proxies: " << sStatistics.nNumOfHLODProxies << ", HLOD skipped scene nodes: " << sStatistics.nNumOfHLODSkippedSceneNodes << '\n';
+	}
+
+	TEST(PerformQuery_Full){
+		if (pCullQuery)
+			Cull();
+		else
+			outputFile << "Null renderer backend not available, HLOD benchmark skipped\n";
+	}
+
+	TEST(BuildProxyMesh){
+		if (pContainer) {
+			for (uint32 nTown=0; nTown<towns; nTown++) {
+				SceneContainer *pTown = static_cast<SceneContainer*>(pContainer->GetByName(String("Town") + static_cast<int>(nTown)));
+				HLODBuilder::BuildProxyMesh(*pTown, 50.0f);
+			}
+		}
+	}
+
+	TEST(PerformQuery_HLOD){
+		if (pCullQuery)
+			Cull();
+	}
+}
@@ -0,0 +1,203 @@
+/*********************************************************\
+ *  File: RenderQueue.cpp                                *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <fstream>
+#include <UnitTest++/UnitTest++.h>
+#include <PLCore/Runtime.h>
+#include <PLMesh/MeshHandler.h>
+#include <PLRenderer/RendererContext.h>
+#include <PLRenderer/Renderer/Renderer.h>
+#include <PLRenderer/Renderer/TextureBuffer.h>
+#include <PLRenderer/Renderer/SurfaceTextureBuffer.h>
+#include <PLRenderer/Material/Material.h>
+#include <PLRenderer/Material/MaterialManager.h>
+#include <PLRenderer/Material/ParameterManager.h>
+#include <PLScene/Scene/SPScene.h>
+#include <PLScene/Scene/SceneContext.h>
+#include <PLScene/Scene/SceneContainer.h>
+#include <PLScene/Compositing/RenderQueue.h>
+#include <PLScene/Compositing/SceneRenderer.h>
+#include <PLScene/Compositing/SceneRendererPass.h>
+#include <PLScene/Compositing/SceneRendererManager.h>
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+using namespace std;
+using namespace PLCore;
+using namespace PLMath;
+using namespace PLGraphics;
+using namespace PLRenderer;
+using namespace PLScene;
+
+
+//[-------------------------------------------------------]
+//[ Global variables                                      ]
+//[-------------------------------------------------------]
+extern ofstream outputFile;
+
+
+/*
+* Naming Convention for SUITE:
+* CLASSNAME
+*/
+SUITE(RenderQueue_Performance) {
+	/*
+	* Naming Convention for METHOD:
+	* METHODNAME_SCENARIO
+	*/
+	// general objects for testing, the scene is created once when the suite is set up and released on exit
+	const uint32 grid      = 32;	// Number of scene nodes along x and y
+	const uint32 materials = 4;	// Number of different materials, assigned round robin
+	const uint32 frames    = 100;
+	struct RenderQueueTestData {
+		RendererContext		 *pRendererContext;
+		SceneContext		 *pSceneContext;
+		SPScene				 *pPainter;
+		SceneRendererPass	 *pSceneRendererPass;
+		SurfaceTextureBuffer *pSurfaceTextureBuffer;
+
+		RenderQueueTestData() :
+			// The null renderer backend counts the state changes, the shader based passes require a real GPU so we're using the fixed functions pass
+			pRendererContext((Runtime::ScanDirectoryPluginsAndData(false), RendererContext::CreateInstance("PLRendererNull::Renderer", NULL_HANDLE))),
+			pSceneContext(nullptr),
+			pPainter(nullptr),
+			pSceneRendererPass(nullptr),
+			pSurfaceTextureBuffer(nullptr)
+		{
+			if (pRendererContext) {
+				pSceneContext = new SceneContext(*pRendererContext);
+				SceneContainer *pContainer = static_cast<SceneContainer*>(pSceneContext->GetRoot()->Create("PLScene::SceneContainer", "Scene"));
+				SceneRenderer *pSceneRenderer = pSceneContext->GetSceneRendererManager().Create("RenderQueue");
+				if (pContainer && pSceneRenderer) {
+					pSceneRendererPass = pSceneRenderer->Create("PLCompositing::SRPDirectionalLightingFixedFunctions", "DirectionalLighting");
+					if (pSceneRendererPass) {
+						// Some materials using different render states
+						Material *pMaterials[materials];
+						for (uint32 i=0; i<materials; i++) {
+							pMaterials[i] = pRendererContext->GetMaterialManager().Create(String("RenderQueue") + i);
+							pMaterials[i]->GetParameterManager().SetParameter1f("TwoSided", static_cast<float>(i%2));
+							pMaterials[i]->GetParameterManager().SetParameter3f("DiffuseColor", static_cast<float>(i)/materials, 1.0f, 1.0f);
+						}
+
+						// Lots of small scene nodes in front of the camera, each mesh gets its own material
+						for (uint32 nY=0; nY<grid; nY++) {
+							for (uint32 nX=0; nX<grid; nX++) {
+								const int nPosX = static_cast<int>(nX*2) - static_cast<int>(grid);
+								const int nPosY = static_cast<int>(nY*2) - static_cast<int>(grid);
+								SceneNode *pSceneNode = pContainer->Create("PLScene::SNMesh", "", String("Position=\"") + nPosX + ' ' + nPosY + " -50\" Mesh=\"Create PLMesh::MeshCreatorCube Name=\\\"Box\\\"\"");
+								if (pSceneNode && pSceneNode->GetMeshHandler())
+									pSceneNode->GetMeshHandler()->SetMaterial(0, pMaterials[(nY*grid + nX)%materials]);
+							}
+						}
+
+						// Create the painter
+						pPainter = new SPScene(pRendererContext->GetRenderer());
+						pPainter->SetRootContainer(pSceneContext->GetRoot());
+						pPainter->SetSceneContainer(pContainer);
+						pPainter->SetDefaultSceneRenderer("RenderQueue");
+						pSurfaceTextureBuffer = pRendererContext->GetRenderer().CreateSurfaceTextureBuffer2D(Vector2i(64, 64), TextureBuffer::R8G8B8A8);
+					}
+				}
+			}
+		}
+
+		~RenderQueueTestData()
+		{
+			if (pSurfaceTextureBuffer)
+				delete pSurfaceTextureBuffer;
+			if (pPainter)
+				delete pPainter;
+			if (pSceneContext)
+				delete pSceneContext;
+			if (pRendererContext)
+				delete pRendererContext;
+		}
+	} testData;
+	RendererContext		 *&pRendererContext		= testData.pRendererContext;
+	SPScene				 *&pPainter				= testData.pPainter;
+	SceneRendererPass	 *&pSceneRendererPass	= testData.pSceneRendererPass;
+	SurfaceTextureBuffer *&pSurfaceTextureBuffer	= testData.pSurfaceTextureBuffer;
+
+	// Draws the scene and writes down the renderer statistics of the last frame
+	void Draw(bool bSortRenderQueue)
+	{
+		pSceneRendererPass->SetAttribute("SortRenderQueue", bSortRenderQueue ? "1" : "0");
+		Renderer &cRenderer = pRendererContext->GetRenderer();
+		Statistics sStatistics;
+		for (uint32 nFrame=0; nFrame<frames; nFrame++) {
+			sStatistics = cRenderer.GetStatistics();
+			pPainter->OnPaint(*pSurfaceTextureBuffer);
+		}
+
+		// The renderer statistics are accumulated, so write down the difference
+		const Statistics &sCurrentStatistics = cRenderer.GetStatistics();
+		outputFile << "Render state changes: "     << (sCurrentStatistics.nRenderStateChanges  - sStatistics.nRenderStateChanges)
+				   << ", sampler state changes: "  << (sCurrentStatistics.nSamplerStateChanges - sStatistics.nSamplerStateChanges)
+				   << ", texture buffer binds: "   << (sCurrentStatistics.nTextureBufferBinds  - sStatistics.nTextureBufferBinds)
+				   << ", draw calls: "             << (sCurrentStatistics.nDrawPrimitivCalls   - sStatistics.nDrawPrimitivCalls) << '\n';
+	}
+
+	TEST(Draw_Unsorted){
+		if (pSurfaceTextureBuffer)
+			Draw(false);
+		else
+			outputFile << "Null renderer backend not available, render queue benchmark skipped\n";
+	}
+
+	TEST(Draw_Sorted){
+		if (pSurfaceTextureBuffer)
+			Draw(true);
+	}
+
+	TEST(BuildBatches){
+		// The render queue only compares the pointers of the items when sorting and batching, so there's no need for real
+		// objects - every mesh and material is represented by a unique address within a dummy buffer
+		const uint32 meshes = 8;
+		char nDummy[meshes + materials];
+		RenderQueue cRenderQueue;
+		for (uint32 nFrame=0; nFrame<frames; nFrame++) {
+			cRenderQueue.Clear();
+			for (uint32 i=0; i<grid*grid; i++) {
+				const uint32 nMesh     = i%meshes;
+				const uint32 nMaterial = (i/meshes)%materials;
+				RenderQueue::Item sItem;
+				sItem.pCullQuery    = reinterpret_cast<const SQCull*>(nDummy);
+				sItem.pVisNode      = reinterpret_cast<const VisNode*>(nDummy + nMesh);
+				sItem.pMaterial     = reinterpret_cast<Material*>(nDummy + meshes + nMaterial);
+				sItem.pVertexBuffer = reinterpret_cast<VertexBuffer*>(nDummy + nMesh);
+				sItem.pIndexBuffer  = reinterpret_cast<IndexBuffer*>(nDummy + nMesh);
+				sItem.pGeometry     = reinterpret_cast<const PLMesh::Geometry*>(nDummy + nMesh);
+				sItem.nSortKey      = RenderQueue::GetSortKey(0, 0, cRenderQueue.GetMaterialID(sItem.pMaterial), static_cast<float>(i), false);
+				cRenderQueue.Add(sItem);
+			}
+			cRenderQueue.Sort();
+			cRenderQueue.BuildBatches(256);
+		}
+		outputFile << "Items: " << cRenderQueue.GetNumOfItems() << ", batches: " << cRenderQueue.GetNumOfBatches() << '\n';
+	}
+}
@@ -0,0 +1,147 @@
+/*********************************************************\
+ *  File: SQCull.cpp                                     *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <fstream>
+#include <UnitTest++/UnitTest++.h>
+#include <PLCore/Runtime.h>
+#include <PLMath/Frustum.h>
+#include <PLRenderer/RendererContext.h>
+#include <PLRenderer/Renderer/Renderer.h>
+#include <PLScene/Scene/SceneContext.h>
+#include <PLScene/Scene/SceneContainer.h>
+#include <PLScene/Visibility/SQCull.h>
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+using namespace std;
+using namespace PLCore;
+using namespace PLMath;
+using namespace PLRenderer;
+using namespace PLScene;
+
+
+//[-------------------------------------------------------]
+//[ Global variables                                      ]
+//[-------------------------------------------------------]
+extern ofstream outputFile;
+
+
+/*
+* Naming Convention for SUITE:
+* CLASSNAME
+*/
+SUITE(SQCull_Performance) {
+	/*
+	* Naming Convention for METHOD:
+	* METHODNAME_SCENARIO
+	*/
+	// general objects for testing, the scene is created once when the suite is set up and released on exit
+	const uint32 grid   = 48;	// Number of scene nodes along x and z behind the wall
+	const uint32 frames = 100;
+	struct SQCullTestData {
+		RendererContext *pRendererContext;
+		SceneContext	*pSceneContext;
+		SQCull			*pCullQuery;
+
+		SQCullTestData() :
+			// The null renderer backend is sufficient, the software occlusion buffer doesn't need the GPU
+			pRendererContext((Runtime::ScanDirectoryPluginsAndData(false), RendererContext::CreateInstance("PLRendererNull::Renderer", NULL_HANDLE))),
+			pSceneContext(nullptr),
+			pCullQuery(nullptr)
+		{
+			if (pRendererContext) {
+				pSceneContext = new SceneContext(*pRendererContext);
+				SceneContainer *pContainer = static_cast<SceneContainer*>(pSceneContext->GetRoot()->Create("PLScene::SceneContainer", "Scene", "Hierarchy=\"PLScene::SHKdTree\""));
+				if (pContainer) {
+					// A wall in front of the camera hiding most of the scene
+					pContainer->Create("PLScene::SNMesh", "Wall", "Position=\"0 0 -10\" Scale=\"40 20 1\" Flags=\"CanOcclude\" Mesh=\"Create PLMesh::MeshCreatorCube Name=\\\"Wall\\\"\"");
+
+					// Lots of small scene nodes behind the wall
+					for (uint32 nZ=0; nZ<grid; nZ++) {
+						for (uint32 nX=0; nX<grid; nX++) {
+							const int nPosX = static_cast<int>(nX*2) - static_cast<int>(grid);
+							const int nPosZ = -12 - static_cast<int>(nZ*2);
+							pContainer->Create("PLScene::SNMesh", "", String("Position=\"") + nPosX + " 0 " + nPosZ + "\" Mesh=\"Create PLMesh::MeshCreatorCube Name=\\\"Box\\\"\"");
+						}
+					}
+
+					// Create the cull query
+					pCullQuery = static_cast<SQCull*>(pContainer->CreateQuery("PLScene::SQCull"));
+					if (pCullQuery)
+						pCullQuery->SetFlags(0);
+				}
+			}
+		}
+
+		~SQCullTestData()
+		{
+			if (pCullQuery)
+				pCullQuery->GetSceneContainer().DestroyQuery(*pCullQuery);
+			if (pSceneContext)
+				delete pSceneContext;
+			if (pRendererContext)
+				delete pRendererContext;
+		}
+	} testData;
+	SQCull *&pCullQuery = testData.pCullQuery;
+
+	// Performs the visibility determination for a camera at the origin looking along the negative z axis
+	void Cull(SQCull::EMode nMode)
+	{
+		Matrix4x4 mProjection;
+		mProjection.PerspectiveFov(static_cast<float>(60.0f*Math::DegToRad), 16.0f/9.0f, 0.1f, 1000.0f);
+		Frustum cFrustum;
+		cFrustum.CreateViewPlanes(mProjection, false);
+		pCullQuery->SetMode(nMode);
+		pCullQuery->SetCameraPosition(Vector3::Zero);
+		pCullQuery->SetViewFrustum(cFrustum);
+		pCullQuery->SetProjectionMatrix(mProjection);
+		pCullQuery->SetViewMatrix(Matrix4x4::Identity);
+		pCullQuery->SetViewProjectionMatrix(mProjection);
+		for (uint32 nFrame=0; nFrame<frames; nFrame++)
+			pCullQuery->PerformQuery();
+
+		// Write down the statistics of the last frame
+		const SQCull::Statistics &sStatistics = pCullQuery->GetStatistics();
+		outputFile << "Visible scene nodes: " << sStatistics.nNumOfVisibleSceneNodes << ", traversed hierarchy nodes: " << sStatistics.nNumOfTraversedNodes
+				   << ", frustum culled: " << sStatistics.nNumOfFrustumCulledNodes << ", occlusion culled: " << sStatistics.nNumOfQueryCulledNodes
+				   << ", occlusion culled scene nodes: " << sStatistics.nNumOfSoftwareCulledSceneNodes << ", occluders: " << sStatistics.nNumOfOccluders << '\n';
+	}
+
+	TEST(PerformQuery_Frustum){
+		if (pCullQuery)
+			Cull(SQCull::Frustum);
+		else
+			outputFile << "Null renderer backend not available, cull query benchmark skipped\n";
+	}
+
+	TEST(PerformQuery_Software){
+		if (pCullQuery)
+			Cull(SQCull::Software);
+	}
+}
@@ -0,0 +1,167 @@
+/*********************************************************\
+ *  File: SQSphere.cpp                                   *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <fstream>
+#include <UnitTest++/UnitTest++.h>
+#include <PLCore/Runtime.h>
+#include <PLCore/Base/Event/EventHandler.h>
+#include <PLRenderer/RendererContext.h>
+#include <PLScene/Scene/SceneContext.h>
+#include <PLScene/Scene/SceneContainer.h>
+#include <PLScene/Scene/SceneQueries/SQSphere.h>
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+using namespace std;
+using namespace PLCore;
+using namespace PLMath;
+using namespace PLRenderer;
+using namespace PLScene;
+
+
+//[-------------------------------------------------------]
+//[ Global variables                                      ]
+//[-------------------------------------------------------]
+extern ofstream outputFile;
+
+
+/*
+* Naming Convention for SUITE:
+* CLASSNAME
+*/
+SUITE(SQSphere_Performance) {
+	/*
+	* Naming Convention for METHOD:
+	* METHODNAME_SCENARIO
+	*/
+	// general objects for testing, the scene is created once when the suite is set up and released on exit
+	const uint32 grid    = 64;		// Number of scene nodes along x and z
+	const uint32 sensors = 1024;	// Number of sensor spheres
+	struct SQSphereTestData {
+		RendererContext *pRendererContext;
+		SceneContext	*pSceneContext;
+		SQSphere		*pSphereQuery;
+		Sphere			 cSpheres[sensors];
+
+		SQSphereTestData() :
+			// The scene queries don't need the GPU, but the scene context needs a renderer context
+			pRendererContext((Runtime::ScanDirectoryPluginsAndData(false), RendererContext::CreateInstance("PLRendererNull::Renderer", NULL_HANDLE))),
+			pSceneContext(nullptr),
+			pSphereQuery(nullptr)
+		{
+			if (pRendererContext) {
+				pSceneContext = new SceneContext(*pRendererContext);
+				SceneContainer *pContainer = static_cast<SceneContainer*>(pSceneContext->GetRoot()->Create("PLScene::SceneContainer", "Scene", "Hierarchy=\"PLScene::SHKdTree\""));
+				if (pContainer) {
+					// Lots of small scene nodes on a plane
+					for (uint32 nZ=0; nZ<grid; nZ++) {
+						for (uint32 nX=0; nX<grid; nX++) {
+							const int nPosX = static_cast<int>(nX*2) - static_cast<int>(grid);
+							const int nPosZ = static_cast<int>(nZ*2) - static_cast<int>(grid);
+							pContainer->Create("PLScene::SNMesh", "", String("Position=\"") + nPosX + " 0 " + nPosZ + "\" Mesh=\"Create PLMesh::MeshCreatorCube Name=\\\"Box\\\"\"");
+						}
+					}
+
+					// The sensor spheres of the AI agents walking around on the plane
+					for (uint32 i=0; i<sensors; i++) {
+						cSpheres[i].SetPos(Vector3(static_cast<float>((i*37)%(grid*2)) - grid, 0.0f, static_cast<float>((i*101)%(grid*2)) - grid));
+						cSpheres[i].SetRadius(4.0f);
+					}
+
+					// Create the sphere query
+					pSphereQuery = static_cast<SQSphere*>(pContainer->CreateQuery("PLScene::SQSphere"));
+				}
+			}
+		}
+
+		~SQSphereTestData()
+		{
+			if (pSphereQuery)
+				pSphereQuery->GetSceneContainer().DestroyQuery(*pSphereQuery);
+			if (pSceneContext)
+				delete pSceneContext;
+			if (pRendererContext)
+				delete pRendererContext;
+		}
+	} testData;
+	SQSphere *&pSphereQuery = testData.pSphereQuery;
+	Sphere   (&cSpheres)[sensors] = testData.cSpheres;
+	Array<SceneNode*> lstSceneNodes;
+
+	// Collects the found scene nodes, this is what most users of the signal are doing
+	void OnSceneNode(SceneQuery &cQuery, SceneNode &cSceneNode)
+	{
+		lstSceneNodes.Add(&cSceneNode);
+	}
+
+	TEST(PerformQuery_Signal){
+		if (pSphereQuery) {
+			EventHandler<SceneQuery&, SceneNode&> cEventHandler(&OnSceneNode);
+			pSphereQuery->SignalSceneNode.Connect(cEventHandler);
+			lstSceneNodes.Resize(sensors*64, false);
+			lstSceneNodes.Reset();
+			for (uint32 i=0; i<sensors; i++) {
+				pSphereQuery->GetSphere() = cSpheres[i];
+				pSphereQuery->PerformQuery();
+			}
+			pSphereQuery->SignalSceneNode.Disconnect(cEventHandler);
+			outputFile << "Found scene nodes: " << lstSceneNodes.GetNumOfElements() << '\n';
+		} else {
+			outputFile << "Null renderer backend not available, sphere query benchmark skipped\n";
+		}
+	}
+
+	TEST(PerformQuery_ResultBuffer){
+		if (pSphereQuery) {
+			lstSceneNodes.Reset();
+			pSphereQuery->SetResultBuffer(&lstSceneNodes);
+			for (uint32 i=0; i<sensors; i++) {
+				pSphereQuery->GetSphere() = cSpheres[i];
+				pSphereQuery->PerformQuery();
+			}
+			pSphereQuery->SetResultBuffer(nullptr);
+			outputFile << "Found scene nodes: " << lstSceneNodes.GetNumOfElements() << '\n';
+		}
+	}
+
+	TEST(PerformQueries_Batched){
+		if (pSphereQuery) {
+			Array<uint32> lstFirstSceneNode;
+			pSphereQuery->PerformQueries(cSpheres, sensors, lstSceneNodes, lstFirstSceneNode, nullptr, 1);
+			outputFile << "Found scene nodes: " << lstSceneNodes.GetNumOfElements() << '\n';
+		}
+	}
+
+	TEST(PerformQueries_Threaded){
+		if (pSphereQuery) {
+			Array<uint32> lstFirstSceneNode;
+			pSphereQuery->PerformQueries(cSpheres, sensors, lstSceneNodes, lstFirstSceneNode, nullptr, 0);
+			outputFile << "Found scene nodes: " << lstSceneNodes.GetNumOfElements() << '\n';
+		}
+	}
+}
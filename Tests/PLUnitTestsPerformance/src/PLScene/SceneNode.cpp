@@ -0,0 +1,167 @@
+/*********************************************************\
+ *  File: SceneNode.cpp                                  *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+
+
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <fstream>
+#include <UnitTest++/UnitTest++.h>
+#include <PLCore/Runtime.h>
+#include <PLRenderer/RendererContext.h>
+#include <PLScene/Scene/SceneContext.h>
+#include <PLScene/Scene/SceneContainer.h>
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+using namespace std;
+using namespace PLCore;
+using namespace PLMath;
+using namespace PLRenderer;
+using namespace PLScene;
+
+
+//[-------------------------------------------------------]
+//[ Global variables                                      ]
+//[-------------------------------------------------------]
+extern ofstream outputFile;
+
+
+/*
+* Naming Convention for SUITE:
+* CLASSNAME
+*/
+SUITE(SceneNode_Performance) {
+	/*
+	* Naming Convention for METHOD:
+	* METHODNAME_SCENARIO
+	*/
+	// general objects for testing, the scene is created once when the suite is set up and released on exit
+	const uint32 chains = 16;	// Number of scene container chains below the root
+	const uint32 depth  = 64;	// Number of nested scene containers per chain
+	const uint32 leafs  = 8;	// Number of scene nodes within each scene container
+	const uint32 frames = 100;
+	struct SceneNodeTestData {
+		RendererContext	  *pRendererContext;
+		SceneContext	  *pSceneContext;
+		Array<SceneNode*>  lstSceneNodes;
+
+		SceneNodeTestData() :
+			// The null renderer backend is sufficient, nothing is drawn
+			pRendererContext((Runtime::ScanDirectoryPluginsAndData(false), RendererContext::CreateInstance("PLRendererNull::Renderer", NULL_HANDLE))),
+			pSceneContext(nullptr)
+		{
+			if (pRendererContext) {
+				pSceneContext = new SceneContext(*pRendererContext);
+				for (uint32 nChain=0; nChain<chains; nChain++) {
+					SceneContainer *pContainer = pSceneContext->GetRoot();
+					for (uint32 nDepth=0; nDepth<depth && pContainer; nDepth++) {
+						pContainer = static_cast<SceneContainer*>(pContainer->Create("PLScene::SceneContainer", "", "Position=\"0 0 1\" Rotation=\"0 5 0\""));
+						if (pContainer) {
+							lstSceneNodes.Add(pContainer);
+							for (uint32 i=0; i<leafs; i++) {
+								SceneNode *pSceneNode = pContainer->Create("PLScene::SNHelper", "", String("Position=\"") + static_cast<int>(i) + " 0 0\"");
+								if (pSceneNode)
+									lstSceneNodes.Add(pSceneNode);
+							}
+						}
+					}
+				}
+			}
+		}
+
+		~SceneNodeTestData()
+		{
+			lstSceneNodes.Clear();
+			if (pSceneContext)
+				delete pSceneContext;
+			if (pRendererContext)
+				delete pRendererContext;
+		}
+	} testData;
+	SceneContext	  *&pSceneContext = testData.pSceneContext;
+	Array<SceneNode*>  &lstSceneNodes = testData.lstSceneNodes;
+	Matrix3x4			mSum;
+
+	// Moves every 10th scene node, scene containers included, so parts of the hierarchy are moved
+	void MoveSceneNodes(uint32 nFrame)
+	{
+		for (uint32 i=nFrame%10; i<lstSceneNodes.GetNumOfElements(); i+=10)
+			lstSceneNodes[i]->GetTransform().SetPosition(Vector3(static_cast<float>(nFrame%7), static_cast<float>(i%5), 1.0f));
+	}
+
+	// Walks through the scene container chain, this is what had to be done without the world matrix cache
+	void GetUncachedWorldMatrix(SceneNode &cSceneNode, Matrix3x4 &mWorld)
+	{
+		mWorld = cSceneNode.GetTransform().GetMatrix();
+		for (SceneContainer *pContainer=cSceneNode.GetContainer(); pContainer; pContainer=pContainer->GetContainer())
+			mWorld = pContainer->GetTransform().GetMatrix()*mWorld;
+	}
+
+	TEST(WorldMatrix_Uncached_PartialMotion){
+		if (!pSceneContext)
+			outputFile << "Null renderer backend not available, scene node benchmark skipped\n";
+		Matrix3x4 mWorld;
+		for (uint32 nFrame=0; nFrame<frames; nFrame++) {
+			MoveSceneNodes(nFrame);
+			for (uint32 i=0; i<lstSceneNodes.GetNumOfElements(); i++) {
+				GetUncachedWorldMatrix(*lstSceneNodes[i], mWorld);
+				mSum.fM[3] += mWorld.fM[3];
+			}
+		}
+	}
+
+	TEST(WorldMatrix_Cached_PartialMotion){
+		if (pSceneContext) {
+			pSceneContext->ResetWorldMatrixStatistics();
+			for (uint32 nFrame=0; nFrame<frames; nFrame++) {
+				MoveSceneNodes(nFrame);
+				pSceneContext->GetRoot()->UpdateWorldMatrices();
+				for (uint32 i=0; i<lstSceneNodes.GetNumOfElements(); i++)
+					mSum.fM[3] += lstSceneNodes[i]->GetWorldMatrix().fM[3];
+			}
+			uint32 nHits, nMisses, nUpdates;
+			pSceneContext->GetWorldMatrixStatistics(nHits, nMisses, nUpdates);
+			outputFile << "World matrix cache: " << nHits << " hits, " << nMisses << " misses, " << nUpdates << " updates\n";
+		}
+	}
+
+	TEST(WorldMatrix_Cached_OnDemand_PartialMotion){
+		if (pSceneContext) {
+			pSceneContext->ResetWorldMatrixStatistics();
+			for (uint32 nFrame=0; nFrame<frames; nFrame++) {
+				MoveSceneNodes(nFrame);
+				for (uint32 i=0; i<lstSceneNodes.GetNumOfElements(); i++)
+					mSum.fM[3] += lstSceneNodes[i]->GetWorldMatrix().fM[3];
+			}
+			uint32 nHits, nMisses, nUpdates;
+			pSceneContext->GetWorldMatrixStatistics(nHits, nMisses, nUpdates);
+			outputFile << "World matrix cache: " << nHits << " hits, " << nMisses << " misses, " << nUpdates << " updates\n";
+		}
+	}
+}
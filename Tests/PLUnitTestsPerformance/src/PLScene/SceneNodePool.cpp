@@ -0,0 +1,180 @@
+/*********************************************************\
+ *  File: SceneNodePool.cpp                              *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <fstream>
+#include <UnitTest++/UnitTest++.h>
+#include <PLCore/Runtime.h>
+#include <PLRenderer/RendererContext.h>
+#include <PLScene/Scene/SceneContext.h>
+#include <PLScene/Scene/SceneContainer.h>
+#include <PLScene/Scene/SceneNodes/SNHelper.h>
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+using namespace std;
+using namespace PLCore;
+using namespace PLMath;
+using namespace PLRenderer;
+using namespace PLScene;
+
+
+//[-------------------------------------------------------]
+//[ Global variables                                      ]
+//[-------------------------------------------------------]
+extern ofstream outputFile;
+
+
+/*
+* Naming Convention for SUITE:
+* CLASSNAME
+*/
+SUITE(SceneNodePool_Performance) {
+	/*
+	* Naming Convention for METHOD:
+	* METHODNAME_SCENARIO
+	*/
+	// general objects for testing, the scene container with the static scene nodes is created once when the suite is set up and released on exit
+	const uint32 statics = 1000;	// Number of named scene nodes which stay within the scene container
+	const uint32 spawns  = 250; 	// Number of scene nodes spawned and despawned per frame
+	const uint32 frames  = 40;
+	struct SceneNodePoolTestData {
+		RendererContext	  *pRendererContext;
+		SceneContext	  *pSceneContext;
+		SceneContainer	  *pContainer;
+		Array<SceneNode*>  lstSpawned;
+
+		SceneNodePoolTestData() :
+			// The null renderer backend is sufficient, nothing is drawn
+			pRendererContext((Runtime::ScanDirectoryPluginsAndData(false), RendererContext::CreateInstance("PLRendererNull::Renderer", NULL_HANDLE))),
+			pSceneContext(nullptr),
+			pContainer(nullptr)
+		{
+			if (pRendererContext) {
+				pSceneContext = new SceneContext(*pRendererContext);
+				pContainer = static_cast<SceneContainer*>(pSceneContext->GetRoot()->Create("PLScene::SceneContainer", "Particles"));
+				if (pContainer) {
+					for (uint32 i=0; i<statics; i++)
+						pContainer->Create("PLScene::SNHelper", String("Static") + static_cast<int>(i));
+				}
+			}
+		}
+
+		~SceneNodePoolTestData()
+		{
+			if (pSceneContext)
+				delete pSceneContext;
+			if (pRendererContext)
+				delete pRendererContext;
+		}
+	} testData;
+	SceneContext	  *&pSceneContext = testData.pSceneContext;
+	SceneContainer	  *&pContainer	  = testData.pContainer;
+	Array<SceneNode*>  &lstSpawned	  = testData.lstSpawned;
+
+	// Despawns the scene nodes spawned within the previous frame and performs the per frame cleanup of the scene context
+	void Despawn(bool bRecycle)
+	{
+		for (uint32 i=0; i<lstSpawned.GetNumOfElements(); i++) {
+			if (bRecycle)
+				lstSpawned[i]->Recycle();
+			else
+				lstSpawned[i]->Delete();
+		}
+		lstSpawned.Reset();
+		pSceneContext->Cleanup();
+	}
+
+	TEST(SpawnDespawn_ByClassName_Delete){
+		if (pContainer) {
+			for (uint32 nFrame=0; nFrame<frames; nFrame++) {
+				for (uint32 i=0; i<spawns; i++)
+					lstSpawned.Add(pContainer->Create("PLScene::SNHelper", "", "Position=\"1 2 3\""));
+				Despawn(false);
+			}
+		} else {
+			outputFile << "Null renderer backend not available, scene node pool benchmark skipped\n";
+		}
+	}
+
+	TEST(SpawnDespawn_ByClassName_Recycle){
+		if (pContainer) {
+			for (uint32 nFrame=0; nFrame<frames; nFrame++) {
+				for (uint32 i=0; i<spawns; i++)
+					lstSpawned.Add(pContainer->Create("PLScene::SNHelper", "", "Position=\"1 2 3\""));
+				Despawn(true);
+			}
+			outputFile << "Pooled scene nodes: " << pSceneContext->GetNumOfRecycledSceneNodes() << '\n';
+		}
+	}
+
+	TEST(SpawnDespawn_Typed_Recycle){
+		if (pContainer) {
+			for (uint32 nFrame=0; nFrame<frames; nFrame++) {
+				for (uint32 i=0; i<spawns; i++) {
+					SNHelper *pSceneNode = pContainer->Create<SNHelper>();
+					pSceneNode->GetTransform().SetPosition(Vector3(1.0f, 2.0f, 3.0f));
+					lstSpawned.Add(pSceneNode);
+				}
+				Despawn(true);
+			}
+		}
+	}
+
+	TEST(SpawnDespawn_TypedAnonymous_Recycle){
+		if (pContainer) {
+			for (uint32 nFrame=0; nFrame<frames; nFrame++) {
+				for (uint32 i=0; i<spawns; i++) {
+					SNHelper *pSceneNode = pContainer->Create<SNHelper>("", true);
+					pSceneNode->GetTransform().SetPosition(Vector3(1.0f, 2.0f, 3.0f));
+					lstSpawned.Add(pSceneNode);
+				}
+				Despawn(true);
+			}
+		}
+	}
+
+	TEST(SpawnDespawn_Mesh_Delete){
+		if (pContainer) {
+			for (uint32 nFrame=0; nFrame<frames; nFrame++) {
+				for (uint32 i=0; i<spawns; i++)
+					lstSpawned.Add(pContainer->Create("PLScene::SNMesh", "", "Position=\"1 2 3\" Mesh=\"Create PLMesh::MeshCreatorCube Name=\\\"Box\\\"\""));
+				Despawn(false);
+			}
+		}
+	}
+
+	TEST(SpawnDespawn_Mesh_Recycle){
+		if (pContainer) {
+			for (uint32 nFrame=0; nFrame<frames; nFrame++) {
+				for (uint32 i=0; i<spawns; i++)
+					lstSpawned.Add(pContainer->Create("PLScene::SNMesh", "", "Position=\"1 2 3\" Mesh=\"Create PLMesh::MeshCreatorCube Name=\\\"Box\\\"\""));
+				Despawn(true);
+			}
+		}
+	}
+}
@@ -0,0 +1,122 @@
+/*********************************************************\
+ *  File: SceneUpdateScheduler.cpp                       *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+
+
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <fstream>
+#include <UnitTest++/UnitTest++.h>
+#include <PLCore/Runtime.h>
+#include <PLRenderer/RendererContext.h>
+#include <PLScene/Scene/SceneContext.h>
+#include <PLScene/Scene/SceneContainer.h>
+#include <PLScene/Scene/SceneUpdateScheduler.h>
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+using namespace std;
+using namespace PLCore;
+using namespace PLRenderer;
+using namespace PLScene;
+
+
+//[-------------------------------------------------------]
+//[ Global variables                                      ]
+//[-------------------------------------------------------]
+extern ofstream outputFile;
+
+
+/*
+* Naming Convention for SUITE:
+* CLASSNAME
+*/
+SUITE(SceneUpdateScheduler_Performance) {
+	/*
+	* Naming Convention for METHOD:
+	* METHODNAME_SCENARIO
+	*/
+	// general objects for testing, the scene is created once when the suite is set up and released on exit
+	const uint32 count   = 20000;
+	const uint32 updates = 100;
+	struct SceneUpdateSchedulerTestData {
+		RendererContext *pRendererContext;
+		SceneContext	*pSceneContext;
+
+		SceneUpdateSchedulerTestData() :
+			// The null renderer backend is sufficient, nothing is drawn
+			pRendererContext((Runtime::ScanDirectoryPluginsAndData(false), RendererContext::CreateInstance("PLRendererNull::Renderer", NULL_HANDLE))),
+			pSceneContext(nullptr)
+		{
+			if (pRendererContext) {
+				pSceneContext = new SceneContext(*pRendererContext);
+				SceneContainer *pContainer = pSceneContext->GetRoot();
+				if (pContainer) {
+					for (uint32 i=0; i<count; i++) {
+						SceneNode *pSceneNode = pContainer->Create("PLScene::SNHelper", String("Node") + i, String("Position=\"") + static_cast<float>(i%100) + ' ' + static_cast<float>(i/100) + " 0\"");
+						if (pSceneNode) {
+							// Modifiers writing the transform of the same scene node can't be updated concurrently, so use one per scene node
+							if (i%2)
+								pSceneNode->AddModifier("PLScene::SNMPositionLinearAnimation", "Speed=\"0.1\"");
+							else
+								pSceneNode->AddModifier("PLScene::SNMRotationLinearAnimation", "Velocity=\"10 20 30\"");
+						}
+					}
+				}
+			}
+		}
+
+		~SceneUpdateSchedulerTestData()
+		{
+			if (pSceneContext)
+				delete pSceneContext;
+			if (pRendererContext)
+				delete pRendererContext;
+		}
+	} testData;
+	SceneContext *&pSceneContext = testData.pSceneContext;
+
+	void UpdateScene(uint32 nNumOfThreads)
+	{
+		if (pSceneContext) {
+			pSceneContext->GetUpdateScheduler().SetNumOfThreads(nNumOfThreads);
+			for (uint32 i=0; i<updates; i++)
+				pSceneContext->Update();
+		} else {
+			outputFile << "Null renderer backend not available, scene update benchmark skipped\n";
+		}
+	}
+
+	TEST(Update_SingleThread_20000){
+		UpdateScene(1);
+	}
+
+	TEST(Update_MultipleThreads_20000){
+		UpdateScene(0);
+	}
+}
@@ -0,0 +1,226 @@
+/*********************************************************\
+ *  File: TextureStreaming.cpp                           *
+ *
+ *  Copyright (C) 2002-2013 The PixelLight Team (http://www.pixellight.org/)
+ *
+ *  This file is part of PixelLight.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ *  and associated documentation files (the "Software"), to deal in the Software without
+ *  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ *  Software is furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or
+ *  substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ *  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <fstream>
+#include <UnitTest++/UnitTest++.h>
+#include <PLCore/Runtime.h>
+#include <PLCore/File/File.h>
+#include <PLCore/File/Directory.h>
+#include <PLCore/System/System.h>
+#include <PLMath/Frustum.h>
+#include <PLGraphics/Image/Image.h>
+#include <PLGraphics/Image/ImageBuffer.h>
+#include <PLRenderer/RendererContext.h>
+#include <PLRenderer/Material/Material.h>
+#include <PLRenderer/Material/Parameter.h>
+#include <PLRenderer/Material/MaterialManager.h>
+#include <PLRenderer/Material/ParameterManager.h>
+#include <PLRenderer/Texture/TextureManager.h>
+#include <PLMesh/MeshHandler.h>
+#include <PLScene/Scene/SceneNode.h>
+#include <PLScene/Scene/SceneContext.h>
+#include <PLScene/Scene/SceneContainer.h>
+#include <PLScene/Visibility/SQCull.h>
+#include <PLScene/Visibility/VisContainer.h>
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+using namespace std;
+using namespace PLCore;
+using namespace PLMath;
+using namespace PLGraphics;
+using namespace PLRenderer;
+using namespace PLMesh;
+using namespace PLScene;
+
+
+//[-------------------------------------------------------]
+//[ Global variables                                      ]
+//[-------------------------------------------------------]
+extern ofstream outputFile;
+
+
+/*
+* Naming Convention for SUITE:
+* CLASSNAME
+*/
+SUITE(TextureStreaming_Performance) {
+	/*
+	* Naming Convention for METHOD:
+	* METHODNAME_SCENARIO
+	*/
+	// general objects for testing, the scene is created once when the suite is set up and released on exit
+	const uint32		 textures    = 32;				// Number of textured scene nodes along the flight path
+	const uint32		 textureSize = 512;				// Width and height of each texture
+	const uint64		 budget      = 4*1024*1024;		// Texture streaming budget in bytes
+	const float			 height      = 720.0f;			// Viewport height in pixel
+	struct TextureStreamingTestData {
+		RendererContext *pRendererContext;
+		SceneContext	*pSceneContext;
+		SQCull			*pCullQuery;
+		String			 sDirectory;
+		Array<Texture*>	 lstTextures;
+
+		TextureStreamingTestData() :
+			pRendererContext(nullptr),
+			pSceneContext(nullptr),
+			pCullQuery(nullptr)
+		{
+			// The null renderer backend is sufficient, it keeps track of the texture buffer memory
+			Runtime::ScanDirectoryPluginsAndData(false);
+			pRendererContext = RendererContext::CreateInstance("PLRendererNull::Renderer", NULL_HANDLE);
+			if (pRendererContext) {
+				pRendererContext->GetTextureManager().SetStreamingBudget(budget);
+				pSceneContext = new SceneContext(*pRendererContext);
+				SceneContainer *pContainer = static_cast<SceneContainer*>(pSceneContext->GetRoot()->Create("PLScene::SceneContainer", "Scene"));
+				if (pContainer) {
+					// Write the texture images
+					sDirectory = System::GetInstance()->GetCurrentDir() + "/TextureStreaming/";
+					Directory(sDirectory).Create();
+					for (uint32 i=0; i<textures; i++) {
+						Image cImage = Image::CreateImage(DataByte, ColorRGB, Vector3i(textureSize, textureSize, 1));
+						uint8 *pData = cImage.GetBuffer()->GetData();
+						for (uint32 nPixel=0; nPixel<textureSize*textureSize; nPixel++, pData+=3) {
+							pData[0] = static_cast<uint8>(i*8);
+							pData[1] = static_cast<uint8>(nPixel%textureSize);
+							pData[2] = static_cast<uint8>(nPixel/textureSize);
+						}
+						cImage.SaveByFilename(sDirectory + "Texture" + i + ".tga");
+					}
+
+					// Textured boxes along both sides of the flight path
+					for (uint32 i=0; i<textures; i++) {
+						const String sPosition = String(((i%2) ? 8 : -8)) + " 0 " + (-10*static_cast<int>(i));
+						SceneNode *pSceneNode = pContainer->Create("PLScene::SNMesh", String("Box") + i, "Position=\"" + sPosition + "\" Scale=\"6 6 6\" Mesh=\"Create PLMesh::MeshCreatorCube Name=\\\"Box\\\"\"");
+						if (pSceneNode && pSceneNode->GetMeshHandler()) {
+							Material *pMaterial = pRendererContext->GetMaterialManager().Create(String("TextureStreaming") + i);
+							if (pMaterial) {
+								Parameter *pParameter = pMaterial->GetParameterManager().CreateParameter(ParameterManager::TextureBuffer, Material::DiffuseMap);
+								if (pParameter && pParameter->SetValueTexture(sDirectory + "Texture" + i + ".tga"))
+									lstTextures.Add(pParameter->GetValueTexture());
+								pSceneNode->GetMeshHandler()->SetMaterial(0, pMaterial);
+							}
+						}
+					}
+
+					// Create the cull query
+					pCullQuery = static_cast<SQCull*>(pContainer->CreateQuery("PLScene::SQCull"));
+					if (pCullQuery) {
+						pCullQuery->SetFlags(0);
+						pCullQuery->SetMode(SQCull::Frustum);
+					}
+				}
+			}
+		}
+
+		~TextureStreamingTestData()
+		{
+			lstTextures.Clear();
+			if (pCullQuery)
+				pCullQuery->GetSceneContainer().DestroyQuery(*pCullQuery);
+			if (pSceneContext)
+				delete pSceneContext;
+			if (pRendererContext)
+				delete pRendererContext;
+
+			// Remove the texture images
+			if (sDirectory.GetLength()) {
+				for (uint32 i=0; i<textures; i++)
+					File(sDirectory + "Texture" + i + ".tga").Delete();
+				Directory(sDirectory).Delete();
+			}
+		}
+	} testData;
+	RendererContext *&pRendererContext = testData.pRendererContext;
+	SQCull			*&pCullQuery       = testData.pCullQuery;
+	Array<Texture*>	 &lstTextures      = testData.lstTextures;
+
+	// Culls the scene for a camera at the given position looking along the negative z axis, reports the texture usage and updates the renderer context
+	void UpdateFrame(const Vector3 &vPosition)
+	{
+		Matrix4x4 mProjection;
+		mProjection.PerspectiveFov(static_cast<float>(60.0f*Math::DegToRad), 16.0f/9.0f, 0.1f, 1000.0f);
+		Matrix4x4 mView;
+		mView.SetTranslationMatrix(-vPosition);
+		const Matrix4x4 mViewProjection = mProjection*mView;
+		Frustum cFrustum;
+		cFrustum.CreateViewPlanes(mViewProjection, false);
+		pCullQuery->SetCameraPosition(vPosition);
+		pCullQuery->SetViewFrustum(cFrustum);
+		pCullQuery->SetProjectionMatrix(mProjection);
+		pCullQuery->SetViewMatrix(mView);
+		pCullQuery->SetViewProjectionMatrix(mViewProjection);
+		pCullQuery->PerformQuery();
+		pCullQuery->GetVisContainer().ReportTextureUsage(height);
+		pRendererContext->Update();
+	}
+
+	// Returns the number of streamed textures which are currently resident with their full resolution
+	uint32 GetNumOfFullResolutionTextures()
+	{
+		uint32 nNumOfTextures = 0;
+		for (uint32 i=0; i<lstTextures.GetNumOfElements(); i++) {
+			if (lstTextures[i]->IsStreamed() && !lstTextures[i]->GetStreamingResidentMipmap())
+				nNumOfTextures++;
+		}
+		return nNumOfTextures;
+	}
+
+	TEST(Stream_Flight){
+		if (pCullQuery) {
+			const TextureManager &cTextureManager = pRendererContext->GetTextureManager();
+			uint64 nMaxMemoryUsage = 0;
+			uint32 nMaxFullResolutionTextures = 0;
+			for (float fZ=20.0f; fZ>-10.0f*textures; fZ-=0.5f) {
+				UpdateFrame(Vector3(0.0f, 0.0f, fZ));
+				if (nMaxMemoryUsage < cTextureManager.GetStreamingMemoryUsage())
+					nMaxMemoryUsage = cTextureManager.GetStreamingMemoryUsage();
+				nMaxFullResolutionTextures = Math::Max(nMaxFullResolutionTextures, GetNumOfFullResolutionTextures());
+
+				// Give the background thread some time
+				System::GetInstance()->Sleep(1);
+			}
+			outputFile << "Streamed textures: " << textures << " (" << textureSize << 'x' << textureSize << "), max full resolution textures: " << nMaxFullResolutionTextures << '\n';
+			outputFile << "Streaming budget: " << budget << " bytes, max memory usage: " << nMaxMemoryUsage << " bytes\n";
+		}
+	}
+
+	TEST(Stream_Stop){
+		if (pCullQuery) {
+			// Nearby textures are loaded with their full resolution once the camera stops, wait for the background loads
+			const TextureManager &cTextureManager = pRendererContext->GetTextureManager();
+			const Vector3 vPosition(0.0f, 0.0f, -10.0f*(textures/2) + 5.0f);
+			uint32 nFrames = 0;
+			for (; nFrames<1000 && (cTextureManager.GetNumOfStreamingRequests() || !GetNumOfFullResolutionTextures()); nFrames++) {
+				UpdateFrame(vPosition);
+				System::GetInstance()->Sleep(1);
+			}
+			outputFile << "Frames until the nearby textures were streamed in: " << nFrames << ", full resolution textures: " << GetNumOfFullResolutionTextures() << '\n';
+		}
+	}
+}